@@ -0,0 +1,44 @@
+#include "contrib/offload/private_key_providers/source/config.h"
+
+#include <memory>
+
+#include "envoy/registry/registry.h"
+#include "envoy/server/transport_socket_config.h"
+
+#include "source/common/config/utility.h"
+#include "source/common/protobuf/message_validator_impl.h"
+#include "source/common/protobuf/utility.h"
+
+#include "contrib/envoy/extensions/private_key_providers/offload/v3alpha/offload.pb.h"
+#include "contrib/envoy/extensions/private_key_providers/offload/v3alpha/offload.pb.validate.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace PrivateKeyMethodProvider {
+namespace Offload {
+
+Ssl::PrivateKeyMethodProviderSharedPtr
+OffloadPrivateKeyMethodFactory::createPrivateKeyMethodProviderInstance(
+    const envoy::extensions::transport_sockets::tls::v3::PrivateKeyProvider& proto_config,
+    Server::Configuration::TransportSocketFactoryContext& private_key_provider_context) {
+  ProtobufTypes::MessagePtr message =
+      std::make_unique<envoy::extensions::private_key_providers::offload::v3alpha::
+                           OffloadPrivateKeyMethodConfig>();
+
+  Config::Utility::translateOpaqueConfig(proto_config.typed_config(),
+                                         ProtobufMessage::getNullValidationVisitor(), *message);
+  const envoy::extensions::private_key_providers::offload::v3alpha::OffloadPrivateKeyMethodConfig
+      conf = MessageUtil::downcastAndValidate<
+          const envoy::extensions::private_key_providers::offload::v3alpha::
+              OffloadPrivateKeyMethodConfig&>(
+          *message, private_key_provider_context.messageValidationVisitor());
+
+  return std::make_shared<OffloadPrivateKeyMethodProvider>(conf, private_key_provider_context);
+}
+
+REGISTER_FACTORY(OffloadPrivateKeyMethodFactory, Ssl::PrivateKeyMethodProviderInstanceFactory);
+
+} // namespace Offload
+} // namespace PrivateKeyMethodProvider
+} // namespace Extensions
+} // namespace Envoy
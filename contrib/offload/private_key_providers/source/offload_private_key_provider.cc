@@ -0,0 +1,340 @@
+#include "contrib/offload/private_key_providers/source/offload_private_key_provider.h"
+
+#include <memory>
+
+#include "envoy/registry/registry.h"
+#include "envoy/server/transport_socket_config.h"
+#include "envoy/singleton/manager.h"
+
+#include "source/common/common/macros.h"
+#include "source/common/config/datasource.h"
+
+#include "absl/strings/str_cat.h"
+#include "openssl/evp.h"
+#include "openssl/pem.h"
+#include "openssl/rsa.h"
+#include "openssl/ssl.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace PrivateKeyMethodProvider {
+namespace Offload {
+
+SINGLETON_MANAGER_REGISTRATION(offload_thread_pool);
+
+OffloadThreadPool::OffloadThreadPool(Api::Api& api, uint32_t pool_size) {
+  threads_.reserve(pool_size);
+  for (uint32_t i = 0; i < pool_size; i++) {
+    threads_.push_back(api.threadFactory().createThread(
+        [this]() -> void { workerLoop(); }, Thread::Options{absl::StrCat("tls_offload_", i)}));
+  }
+}
+
+OffloadThreadPool::~OffloadThreadPool() {
+  {
+    absl::MutexLock lock(&mutex_);
+    shutdown_ = true;
+  }
+  for (auto& thread : threads_) {
+    thread->join();
+  }
+}
+
+void OffloadThreadPool::post(std::function<void()> op) {
+  absl::MutexLock lock(&mutex_);
+  queue_.push_back(std::move(op));
+}
+
+void OffloadThreadPool::workerLoop() {
+  while (true) {
+    std::function<void()> op;
+    {
+      absl::MutexLock lock(&mutex_);
+      mutex_.Await(absl::Condition(this, &OffloadThreadPool::hasWork));
+      if (shutdown_ && queue_.empty()) {
+        return;
+      }
+      op = std::move(queue_.front());
+      queue_.pop_front();
+    }
+    op();
+  }
+}
+
+OffloadContext::OffloadContext(Ssl::PrivateKeyConnectionCallbacks& cb,
+                               Event::Dispatcher& dispatcher, bssl::UniquePtr<EVP_PKEY> pkey,
+                               uint16_t signature_algorithm, const uint8_t* in, size_t in_len)
+    : cb_(cb), dispatcher_(dispatcher), pkey_(std::move(pkey)),
+      signature_algorithm_(signature_algorithm), input_(in, in + in_len) {}
+
+bool OffloadContext::ready() const {
+  absl::MutexLock lock(&mutex_);
+  return ready_;
+}
+
+bool OffloadContext::success() const {
+  absl::MutexLock lock(&mutex_);
+  return success_;
+}
+
+bool OffloadContext::doSign() {
+  const EVP_MD* md = SSL_get_signature_algorithm_digest(signature_algorithm_);
+  if (md == nullptr) {
+    return false;
+  }
+
+  bssl::ScopedEVP_MD_CTX md_ctx;
+  EVP_PKEY_CTX* pkey_ctx;
+  if (!EVP_DigestSignInit(md_ctx.get(), &pkey_ctx, md, nullptr, pkey_.get())) {
+    return false;
+  }
+  if (SSL_is_signature_algorithm_rsa_pss(signature_algorithm_)) {
+    if (!EVP_PKEY_CTX_set_rsa_padding(pkey_ctx, RSA_PKCS1_PSS_PADDING) ||
+        !EVP_PKEY_CTX_set_rsa_pss_saltlen(pkey_ctx, -1)) {
+      return false;
+    }
+  }
+
+  size_t sig_len;
+  if (!EVP_DigestSign(md_ctx.get(), nullptr, &sig_len, input_.data(), input_.size())) {
+    return false;
+  }
+  output_.resize(sig_len);
+  if (!EVP_DigestSign(md_ctx.get(), output_.data(), &sig_len, input_.data(), input_.size())) {
+    return false;
+  }
+  output_.resize(sig_len);
+  return true;
+}
+
+bool OffloadContext::doDecrypt() {
+  RSA* rsa = EVP_PKEY_get0_RSA(pkey_.get());
+  if (rsa == nullptr) {
+    return false;
+  }
+
+  size_t out_len;
+  output_.resize(RSA_size(rsa));
+  if (!RSA_decrypt(rsa, &out_len, output_.data(), output_.size(), input_.data(), input_.size(),
+                   RSA_NO_PADDING)) {
+    return false;
+  }
+  output_.resize(out_len);
+  return true;
+}
+
+void OffloadContext::run() {
+  const bool ok = signature_algorithm_ != 0 ? doSign() : doDecrypt();
+  {
+    absl::MutexLock lock(&mutex_);
+    success_ = ok;
+    ready_ = true;
+  }
+  dispatcher_.post([ctx = shared_from_this()]() { ctx->onComplete(); });
+}
+
+void OffloadContext::onComplete() {
+  if (expired_) {
+    // The connection was torn down while the operation was in flight.
+    return;
+  }
+  cb_.onPrivateKeyMethodComplete();
+}
+
+OffloadPrivateKeyConnection::OffloadPrivateKeyConnection(Ssl::PrivateKeyConnectionCallbacks& cb,
+                                                         Event::Dispatcher& dispatcher,
+                                                         OffloadThreadPool& pool,
+                                                         bssl::UniquePtr<EVP_PKEY> pkey)
+    : cb_(cb), dispatcher_(dispatcher), pool_(pool), pkey_(std::move(pkey)) {}
+
+OffloadPrivateKeyConnection::~OffloadPrivateKeyConnection() {
+  if (context_ != nullptr) {
+    context_->expire();
+  }
+}
+
+void OffloadPrivateKeyConnection::startOperation(uint16_t signature_algorithm, const uint8_t* in,
+                                                 size_t in_len) {
+  context_ = std::make_shared<OffloadContext>(cb_, dispatcher_, bssl::UpRef(pkey_),
+                                              signature_algorithm, in, in_len);
+  pool_.post([ctx = context_]() { ctx->run(); });
+}
+
+namespace {
+
+ssl_private_key_result_t privateKeySignInternal(OffloadPrivateKeyConnection* ops, uint8_t*,
+                                                size_t*, size_t, uint16_t signature_algorithm,
+                                                const uint8_t* in, size_t in_len) {
+  if (ops == nullptr) {
+    return ssl_private_key_failure;
+  }
+
+  EVP_PKEY* pkey = ops->getPrivateKey();
+  if (pkey == nullptr ||
+      EVP_PKEY_id(pkey) != SSL_get_signature_algorithm_key_type(signature_algorithm) ||
+      SSL_get_signature_algorithm_digest(signature_algorithm) == nullptr) {
+    return ssl_private_key_failure;
+  }
+
+  ops->startOperation(signature_algorithm, in, in_len);
+  return ssl_private_key_retry;
+}
+
+ssl_private_key_result_t privateKeySign(SSL* ssl, uint8_t* out, size_t* out_len, size_t max_out,
+                                        uint16_t signature_algorithm, const uint8_t* in,
+                                        size_t in_len) {
+  return ssl == nullptr ? ssl_private_key_failure
+                        : privateKeySignInternal(
+                              static_cast<OffloadPrivateKeyConnection*>(SSL_get_ex_data(
+                                  ssl, OffloadPrivateKeyMethodProvider::connectionIndex())),
+                              out, out_len, max_out, signature_algorithm, in, in_len);
+}
+
+ssl_private_key_result_t privateKeyDecryptInternal(OffloadPrivateKeyConnection* ops, uint8_t*,
+                                                   size_t*, size_t, const uint8_t* in,
+                                                   size_t in_len) {
+  if (ops == nullptr) {
+    return ssl_private_key_failure;
+  }
+
+  EVP_PKEY* pkey = ops->getPrivateKey();
+  if (pkey == nullptr || EVP_PKEY_get0_RSA(pkey) == nullptr) {
+    return ssl_private_key_failure;
+  }
+
+  ops->startOperation(0, in, in_len);
+  return ssl_private_key_retry;
+}
+
+ssl_private_key_result_t privateKeyDecrypt(SSL* ssl, uint8_t* out, size_t* out_len, size_t max_out,
+                                           const uint8_t* in, size_t in_len) {
+  return ssl == nullptr ? ssl_private_key_failure
+                        : privateKeyDecryptInternal(
+                              static_cast<OffloadPrivateKeyConnection*>(SSL_get_ex_data(
+                                  ssl, OffloadPrivateKeyMethodProvider::connectionIndex())),
+                              out, out_len, max_out, in, in_len);
+}
+
+ssl_private_key_result_t privateKeyCompleteInternal(OffloadPrivateKeyConnection* ops, uint8_t* out,
+                                                    size_t* out_len, size_t max_out) {
+  if (ops == nullptr) {
+    return ssl_private_key_failure;
+  }
+
+  OffloadContextSharedPtr ctx = ops->currentContext();
+  if (ctx == nullptr) {
+    return ssl_private_key_failure;
+  }
+
+  // This can happen if the top-level SSL function is called again before the operation has been
+  // completed on the thread pool.
+  if (!ctx->ready()) {
+    return ssl_private_key_retry;
+  }
+
+  ops->clearContext();
+
+  if (!ctx->success()) {
+    return ssl_private_key_failure;
+  }
+
+  const std::vector<uint8_t>& output = ctx->output();
+  if (output.size() > max_out) {
+    return ssl_private_key_failure;
+  }
+
+  memcpy(out, output.data(), output.size()); // NOLINT(safe-memcpy)
+  *out_len = output.size();
+  return ssl_private_key_success;
+}
+
+ssl_private_key_result_t privateKeyComplete(SSL* ssl, uint8_t* out, size_t* out_len,
+                                            size_t max_out) {
+  return ssl == nullptr ? ssl_private_key_failure
+                        : privateKeyCompleteInternal(
+                              static_cast<OffloadPrivateKeyConnection*>(SSL_get_ex_data(
+                                  ssl, OffloadPrivateKeyMethodProvider::connectionIndex())),
+                              out, out_len, max_out);
+}
+
+} // namespace
+
+int OffloadPrivateKeyMethodProvider::connectionIndex() {
+  CONSTRUCT_ON_FIRST_USE(int, SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr));
+}
+
+Ssl::BoringSslPrivateKeyMethodSharedPtr
+OffloadPrivateKeyMethodProvider::getBoringSslPrivateKeyMethod() {
+  return method_;
+}
+
+// The key operations are performed with the BoringSSL primitives that the worker threads would
+// otherwise use, so the provider does not change the FIPS posture of the build.
+bool OffloadPrivateKeyMethodProvider::checkFips() { return true; }
+
+bool OffloadPrivateKeyMethodProvider::isAvailable() { return initialized_; }
+
+void OffloadPrivateKeyMethodProvider::registerPrivateKeyMethod(
+    SSL* ssl, Ssl::PrivateKeyConnectionCallbacks& cb, Event::Dispatcher& dispatcher) {
+  if (SSL_get_ex_data(ssl, connectionIndex()) != nullptr) {
+    throw EnvoyException(
+        "Registering the offload provider twice for same context is not yet supported.");
+  }
+
+  OffloadPrivateKeyConnection* ops =
+      new OffloadPrivateKeyConnection(cb, dispatcher, *pool_, bssl::UpRef(pkey_));
+  SSL_set_ex_data(ssl, connectionIndex(), ops);
+}
+
+void OffloadPrivateKeyMethodProvider::unregisterPrivateKeyMethod(SSL* ssl) {
+  OffloadPrivateKeyConnection* ops =
+      static_cast<OffloadPrivateKeyConnection*>(SSL_get_ex_data(ssl, connectionIndex()));
+  SSL_set_ex_data(ssl, connectionIndex(), nullptr);
+  delete ops;
+}
+
+OffloadPrivateKeyMethodProvider::OffloadPrivateKeyMethodProvider(
+    const envoy::extensions::private_key_providers::offload::v3alpha::
+        OffloadPrivateKeyMethodConfig& conf,
+    Server::Configuration::TransportSocketFactoryContext& factory_context)
+    : api_(factory_context.serverFactoryContext().api()) {
+
+  const uint32_t pool_size = conf.pool_size();
+  pool_ = factory_context.serverFactoryContext().singletonManager().getTyped<OffloadThreadPool>(
+      SINGLETON_MANAGER_REGISTERED_NAME(offload_thread_pool),
+      [this, pool_size] { return std::make_shared<OffloadThreadPool>(api_, pool_size); });
+
+  ASSERT(pool_);
+
+  std::string private_key =
+      THROW_OR_RETURN_VALUE(Config::DataSource::read(conf.private_key(), false, api_), std::string);
+
+  bssl::UniquePtr<BIO> bio(
+      BIO_new_mem_buf(const_cast<char*>(private_key.data()), private_key.size()));
+
+  bssl::UniquePtr<EVP_PKEY> pkey(PEM_read_bio_PrivateKey(bio.get(), nullptr, nullptr, nullptr));
+  if (pkey == nullptr) {
+    throw EnvoyException("Failed to read private key.");
+  }
+
+  const int key_type = EVP_PKEY_id(pkey.get());
+  if (key_type != EVP_PKEY_RSA && key_type != EVP_PKEY_EC) {
+    ENVOY_LOG(warn, "Only RSA and ECDSA keys are supported.");
+    return;
+  }
+  pkey_ = std::move(pkey);
+
+  method_ = std::make_shared<SSL_PRIVATE_KEY_METHOD>();
+  method_->sign = privateKeySign;
+  method_->decrypt = privateKeyDecrypt;
+  method_->complete = privateKeyComplete;
+
+  initialized_ = true;
+  ENVOY_LOG(info, "initialized offload private key provider, thread pool size {}",
+            pool_->poolSize());
+}
+
+} // namespace Offload
+} // namespace PrivateKeyMethodProvider
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <deque>
+#include <vector>
+
+#include "envoy/api/api.h"
+#include "envoy/event/dispatcher.h"
+#include "envoy/singleton/instance.h"
+#include "envoy/ssl/private_key/private_key.h"
+#include "envoy/ssl/private_key/private_key_config.h"
+
+#include "source/common/common/logger.h"
+#include "source/common/common/thread.h"
+
+#include "absl/synchronization/mutex.h"
+#include "contrib/envoy/extensions/private_key_providers/offload/v3alpha/offload.pb.h"
+#include "openssl/ssl.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace PrivateKeyMethodProvider {
+namespace Offload {
+
+// Fixed-size pool of threads running private key operations. A single pool is shared by all
+// provider instances in the process via the singleton manager.
+class OffloadThreadPool : public Singleton::Instance,
+                          public Logger::Loggable<Logger::Id::connection> {
+public:
+  OffloadThreadPool(Api::Api& api, uint32_t pool_size);
+  ~OffloadThreadPool() override;
+
+  // Enqueue a private key operation to run on one of the pool threads.
+  void post(std::function<void()> op);
+
+  uint32_t poolSize() const { return static_cast<uint32_t>(threads_.size()); }
+
+private:
+  bool hasWork() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+    return shutdown_ || !queue_.empty();
+  }
+  void workerLoop();
+
+  absl::Mutex mutex_;
+  std::deque<std::function<void()>> queue_ ABSL_GUARDED_BY(mutex_);
+  bool shutdown_ ABSL_GUARDED_BY(mutex_){};
+  std::vector<Thread::ThreadPtr> threads_;
+};
+
+using OffloadThreadPoolSharedPtr = std::shared_ptr<OffloadThreadPool>;
+
+// State of a single in-flight private key operation, shared between the worker thread that
+// starts it and the pool thread that computes the result. The pool thread stores the result and
+// posts the completion back to the worker dispatcher. The connection may go away while the
+// operation is in flight; the connection expires the context on teardown and the posted
+// completion then drops the result.
+class OffloadContext : public std::enable_shared_from_this<OffloadContext> {
+public:
+  OffloadContext(Ssl::PrivateKeyConnectionCallbacks& cb, Event::Dispatcher& dispatcher,
+                 bssl::UniquePtr<EVP_PKEY> pkey, uint16_t signature_algorithm,
+                 const uint8_t* in, size_t in_len);
+
+  // Pool thread: perform the key operation and schedule the completion callback on the worker
+  // dispatcher.
+  void run();
+
+  // Worker thread.
+  void expire() { expired_ = true; }
+  bool ready() const;
+  bool success() const;
+  const std::vector<uint8_t>& output() const { return output_; }
+
+private:
+  bool doSign();
+  bool doDecrypt();
+  void onComplete();
+
+  Ssl::PrivateKeyConnectionCallbacks& cb_;
+  Event::Dispatcher& dispatcher_;
+  const bssl::UniquePtr<EVP_PKEY> pkey_;
+  // Signing algorithm for sign operations, or zero for raw RSA decrypt operations.
+  const uint16_t signature_algorithm_;
+  const std::vector<uint8_t> input_;
+
+  // Only touched on the worker thread.
+  bool expired_{};
+
+  // Result fields, written once by the pool thread and read by the worker thread.
+  mutable absl::Mutex mutex_;
+  bool ready_ ABSL_GUARDED_BY(mutex_){};
+  bool success_ ABSL_GUARDED_BY(mutex_){};
+  std::vector<uint8_t> output_;
+};
+
+using OffloadContextSharedPtr = std::shared_ptr<OffloadContext>;
+
+class OffloadPrivateKeyConnection {
+public:
+  OffloadPrivateKeyConnection(Ssl::PrivateKeyConnectionCallbacks& cb,
+                              Event::Dispatcher& dispatcher, OffloadThreadPool& pool,
+                              bssl::UniquePtr<EVP_PKEY> pkey);
+  ~OffloadPrivateKeyConnection();
+
+  EVP_PKEY* getPrivateKey() { return pkey_.get(); }
+
+  // Start an asynchronous operation on the thread pool. A zero signature algorithm denotes a raw
+  // RSA decrypt operation.
+  void startOperation(uint16_t signature_algorithm, const uint8_t* in, size_t in_len);
+
+  OffloadContextSharedPtr currentContext() { return context_; }
+  void clearContext() { context_.reset(); }
+
+private:
+  Ssl::PrivateKeyConnectionCallbacks& cb_;
+  Event::Dispatcher& dispatcher_;
+  OffloadThreadPool& pool_;
+  bssl::UniquePtr<EVP_PKEY> pkey_;
+  OffloadContextSharedPtr context_;
+};
+
+class OffloadPrivateKeyMethodProvider : public virtual Ssl::PrivateKeyMethodProvider,
+                                        public Logger::Loggable<Logger::Id::connection> {
+public:
+  OffloadPrivateKeyMethodProvider(
+      const envoy::extensions::private_key_providers::offload::v3alpha::
+          OffloadPrivateKeyMethodConfig& config,
+      Server::Configuration::TransportSocketFactoryContext& private_key_provider_context);
+
+  // Ssl::PrivateKeyMethodProvider
+  void registerPrivateKeyMethod(SSL* ssl, Ssl::PrivateKeyConnectionCallbacks& cb,
+                                Event::Dispatcher& dispatcher) override;
+  void unregisterPrivateKeyMethod(SSL* ssl) override;
+  bool checkFips() override;
+  bool isAvailable() override;
+  Ssl::BoringSslPrivateKeyMethodSharedPtr getBoringSslPrivateKeyMethod() override;
+
+  static int connectionIndex();
+
+private:
+  Ssl::BoringSslPrivateKeyMethodSharedPtr method_{};
+  OffloadThreadPoolSharedPtr pool_;
+  Api::Api& api_;
+  bssl::UniquePtr<EVP_PKEY> pkey_;
+  bool initialized_{};
+};
+
+} // namespace Offload
+} // namespace PrivateKeyMethodProvider
+} // namespace Extensions
+} // namespace Envoy
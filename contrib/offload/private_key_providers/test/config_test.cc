@@ -0,0 +1,210 @@
+#include <string>
+
+#include "source/common/tls/private_key/private_key_manager_impl.h"
+
+#include "test/mocks/server/transport_socket_factory_context.h"
+#include "test/mocks/ssl/mocks.h"
+#include "test/mocks/thread_local/mocks.h"
+#include "test/test_common/environment.h"
+#include "test/test_common/registry.h"
+#include "test/test_common/utility.h"
+
+#include "contrib/offload/private_key_providers/source/config.h"
+#include "gtest/gtest.h"
+#include "openssl/evp.h"
+#include "openssl/pem.h"
+#include "openssl/rsa.h"
+#include "openssl/ssl.h"
+
+using testing::NiceMock;
+using testing::ReturnRef;
+
+namespace Envoy {
+namespace Extensions {
+namespace PrivateKeyMethodProvider {
+namespace Offload {
+
+envoy::extensions::transport_sockets::tls::v3::PrivateKeyProvider
+parsePrivateKeyProviderFromV3Yaml(const std::string& yaml_string) {
+  envoy::extensions::transport_sockets::tls::v3::PrivateKeyProvider private_key_provider;
+  TestUtility::loadFromYaml(TestEnvironment::substitute(yaml_string), private_key_provider);
+  return private_key_provider;
+}
+
+// Completes the dispatcher run when the asynchronous private key operation is done.
+class TestCallbacks : public Ssl::PrivateKeyConnectionCallbacks {
+public:
+  TestCallbacks(Event::Dispatcher& dispatcher) : dispatcher_(dispatcher) {}
+
+  void onPrivateKeyMethodComplete() override { dispatcher_.exit(); }
+
+private:
+  Event::Dispatcher& dispatcher_;
+};
+
+class OffloadConfigTest : public testing::Test {
+public:
+  OffloadConfigTest() : api_(Api::createApiForTest(store_)) {
+    ON_CALL(factory_context_.server_context_, api()).WillByDefault(ReturnRef(*api_));
+    ON_CALL(factory_context_.server_context_, threadLocal()).WillByDefault(ReturnRef(tls_));
+    ON_CALL(factory_context_, sslContextManager()).WillByDefault(ReturnRef(context_manager_));
+    ON_CALL(context_manager_, privateKeyMethodManager())
+        .WillByDefault(ReturnRef(private_key_method_manager_));
+  }
+
+  Ssl::PrivateKeyMethodProviderSharedPtr createWithConfig(std::string yaml) {
+    OffloadPrivateKeyMethodFactory offload_factory;
+    Registry::InjectFactory<Ssl::PrivateKeyMethodProviderInstanceFactory>
+        offload_private_key_method_factory(offload_factory);
+
+    return factory_context_.sslContextManager()
+        .privateKeyMethodManager()
+        .createPrivateKeyMethodProvider(parsePrivateKeyProviderFromV3Yaml(yaml), factory_context_);
+  }
+
+  bssl::UniquePtr<EVP_PKEY> readKey(const std::string& relative_path) {
+    const std::string pem = TestEnvironment::readFileToStringForTest(TestEnvironment::substitute(
+        absl::StrCat("{{ test_rundir }}/contrib/offload/private_key_providers/test/test_data/",
+                     relative_path)));
+    bssl::UniquePtr<BIO> bio(BIO_new_mem_buf(const_cast<char*>(pem.data()), pem.size()));
+    return bssl::UniquePtr<EVP_PKEY>(PEM_read_bio_PrivateKey(bio.get(), nullptr, nullptr, nullptr));
+  }
+
+  // Run a complete asynchronous signing operation through the provider and verify the resulting
+  // signature against the key.
+  void testSignRoundTrip(Ssl::PrivateKeyMethodProviderSharedPtr provider,
+                         const std::string& key_file, uint16_t signature_algorithm) {
+    Event::DispatcherPtr dispatcher = api_->allocateDispatcher("test_thread");
+    TestCallbacks callbacks(*dispatcher);
+
+    bssl::UniquePtr<SSL_CTX> ctx(SSL_CTX_new(TLS_method()));
+    bssl::UniquePtr<SSL> ssl(SSL_new(ctx.get()));
+    provider->registerPrivateKeyMethod(ssl.get(), callbacks, *dispatcher);
+
+    Ssl::BoringSslPrivateKeyMethodSharedPtr method = provider->getBoringSslPrivateKeyMethod();
+    const std::string message = "hello world";
+    uint8_t signature[512];
+    size_t signature_len = 0;
+    ssl_private_key_result_t res = method->sign(
+        ssl.get(), signature, &signature_len, sizeof(signature), signature_algorithm,
+        reinterpret_cast<const uint8_t*>(message.data()), message.size());
+    EXPECT_EQ(res, ssl_private_key_retry);
+
+    // The operation completes on the pool thread and posts back to the dispatcher.
+    dispatcher->run(Event::Dispatcher::RunType::RunUntilExit);
+
+    res = method->complete(ssl.get(), signature, &signature_len, sizeof(signature));
+    EXPECT_EQ(res, ssl_private_key_success);
+    EXPECT_GT(signature_len, 0);
+
+    bssl::UniquePtr<EVP_PKEY> pkey = readKey(key_file);
+    ASSERT_NE(nullptr, pkey);
+    bssl::ScopedEVP_MD_CTX md_ctx;
+    EVP_PKEY_CTX* pkey_ctx;
+    ASSERT_TRUE(EVP_DigestVerifyInit(md_ctx.get(), &pkey_ctx,
+                                     SSL_get_signature_algorithm_digest(signature_algorithm),
+                                     nullptr, pkey.get()));
+    if (SSL_is_signature_algorithm_rsa_pss(signature_algorithm)) {
+      ASSERT_TRUE(EVP_PKEY_CTX_set_rsa_padding(pkey_ctx, RSA_PKCS1_PSS_PADDING));
+      ASSERT_TRUE(EVP_PKEY_CTX_set_rsa_pss_saltlen(pkey_ctx, -1));
+    }
+    EXPECT_TRUE(EVP_DigestVerify(md_ctx.get(), signature, signature_len,
+                                 reinterpret_cast<const uint8_t*>(message.data()),
+                                 message.size()));
+
+    provider->unregisterPrivateKeyMethod(ssl.get());
+  }
+
+  NiceMock<Server::Configuration::MockTransportSocketFactoryContext> factory_context_;
+  Stats::IsolatedStoreImpl store_;
+  Api::ApiPtr api_;
+  NiceMock<ThreadLocal::MockInstance> tls_;
+  NiceMock<Ssl::MockContextManager> context_manager_;
+  TransportSockets::Tls::PrivateKeyMethodManagerImpl private_key_method_manager_;
+};
+
+TEST_F(OffloadConfigTest, CreateRsa2048) {
+  const std::string yaml = R"EOF(
+      provider_name: offload
+      typed_config:
+        "@type": type.googleapis.com/envoy.extensions.private_key_providers.offload.v3alpha.OffloadPrivateKeyMethodConfig
+        pool_size: 2
+        private_key: { "filename": "{{ test_rundir }}/contrib/offload/private_key_providers/test/test_data/rsa-2048.pem" }
+)EOF";
+
+  Ssl::PrivateKeyMethodProviderSharedPtr provider = createWithConfig(yaml);
+  EXPECT_NE(nullptr, provider);
+  EXPECT_EQ(true, provider->checkFips());
+  EXPECT_EQ(provider->isAvailable(), true);
+  Ssl::BoringSslPrivateKeyMethodSharedPtr method = provider->getBoringSslPrivateKeyMethod();
+  EXPECT_NE(nullptr, method);
+
+  ssl_private_key_result_t res;
+  res = method->sign(nullptr, nullptr, nullptr, 0, 0, nullptr, 0);
+  EXPECT_EQ(res, ssl_private_key_failure);
+  res = method->decrypt(nullptr, nullptr, nullptr, 0, nullptr, 0);
+  EXPECT_EQ(res, ssl_private_key_failure);
+  res = method->complete(nullptr, nullptr, nullptr, 0);
+  EXPECT_EQ(res, ssl_private_key_failure);
+}
+
+TEST_F(OffloadConfigTest, RsaPssSignRoundTrip) {
+  const std::string yaml = R"EOF(
+      provider_name: offload
+      typed_config:
+        "@type": type.googleapis.com/envoy.extensions.private_key_providers.offload.v3alpha.OffloadPrivateKeyMethodConfig
+        pool_size: 2
+        private_key: { "filename": "{{ test_rundir }}/contrib/offload/private_key_providers/test/test_data/rsa-2048.pem" }
+)EOF";
+
+  Ssl::PrivateKeyMethodProviderSharedPtr provider = createWithConfig(yaml);
+  ASSERT_NE(nullptr, provider);
+  ASSERT_TRUE(provider->isAvailable());
+  testSignRoundTrip(provider, "rsa-2048.pem", SSL_SIGN_RSA_PSS_RSAE_SHA256);
+}
+
+TEST_F(OffloadConfigTest, EcdsaSignRoundTrip) {
+  const std::string yaml = R"EOF(
+      provider_name: offload
+      typed_config:
+        "@type": type.googleapis.com/envoy.extensions.private_key_providers.offload.v3alpha.OffloadPrivateKeyMethodConfig
+        pool_size: 1
+        private_key: { "filename": "{{ test_rundir }}/contrib/offload/private_key_providers/test/test_data/ecdsa-p256.pem" }
+)EOF";
+
+  Ssl::PrivateKeyMethodProviderSharedPtr provider = createWithConfig(yaml);
+  ASSERT_NE(nullptr, provider);
+  ASSERT_TRUE(provider->isAvailable());
+  testSignRoundTrip(provider, "ecdsa-p256.pem", SSL_SIGN_ECDSA_SECP256R1_SHA256);
+}
+
+TEST_F(OffloadConfigTest, CreateUnsupportedKeyType) {
+  const std::string yaml = R"EOF(
+      provider_name: offload
+      typed_config:
+        "@type": type.googleapis.com/envoy.extensions.private_key_providers.offload.v3alpha.OffloadPrivateKeyMethodConfig
+        pool_size: 1
+        private_key: { "filename": "{{ test_rundir }}/contrib/offload/private_key_providers/test/test_data/ed25519.pem" }
+)EOF";
+
+  Ssl::PrivateKeyMethodProviderSharedPtr provider = createWithConfig(yaml);
+  EXPECT_NE(nullptr, provider);
+  EXPECT_EQ(provider->isAvailable(), false);
+}
+
+TEST_F(OffloadConfigTest, CreateMissingKey) {
+  const std::string yaml = R"EOF(
+      provider_name: offload
+      typed_config:
+        "@type": type.googleapis.com/envoy.extensions.private_key_providers.offload.v3alpha.OffloadPrivateKeyMethodConfig
+        pool_size: 1
+        private_key: { "filename": "{{ test_rundir }}/contrib/offload/private_key_providers/test/test_data/missing.pem" }
+)EOF";
+
+  EXPECT_THROW(createWithConfig(yaml), EnvoyException);
+}
+
+} // namespace Offload
+} // namespace PrivateKeyMethodProvider
+} // namespace Extensions
+} // namespace Envoy
@@ -79,6 +79,12 @@ public:
   virtual SysCallSizeResult pwrite(os_fd_t fd, const void* buffer, size_t length,
                                    off_t offset) const PURE;
 
+  /**
+   * @see man 2 pwritev
+   */
+  virtual SysCallSizeResult pwritev(os_fd_t fd, const iovec* iov, int num_iov,
+                                    off_t offset) const PURE;
+
   /**
    * @see man 2 pread
    */
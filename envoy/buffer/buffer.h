@@ -575,6 +575,26 @@ public:
    * @return the number of streams reset
    */
   virtual uint64_t resetAccountsGivenPressure(float pressure) PURE;
+
+  /**
+   * Installs the hook the factory invokes to request that the owning dispatcher
+   * call settleAccountUpdates() at the end of the current dispatcher iteration.
+   * The dispatcher clears the hook with an empty function on destruction since
+   * the factory may outlive it. Factories that update account bookkeeping
+   * synchronously can ignore this.
+   *
+   * @param hook supplies the settlement request hook, or an empty function to
+   *   disable batching.
+   */
+  virtual void setAccountSettlementHook(std::function<void()> /*hook*/) {}
+
+  /**
+   * Settles any account bookkeeping the factory deferred during the current
+   * dispatcher iteration. Invoked by the owning dispatcher at the end of an
+   * iteration in which the factory requested settlement through the installed
+   * hook, and internally before tracked accounts are read.
+   */
+  virtual void settleAccountUpdates() {}
 };
 
 using WatermarkFactoryPtr = std::unique_ptr<WatermarkFactory>;
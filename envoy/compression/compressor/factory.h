@@ -2,6 +2,8 @@
 
 #include "envoy/compression/compressor/compressor.h"
 
+#include "absl/strings/string_view.h"
+
 namespace Envoy {
 namespace Compression {
 namespace Compressor {
@@ -11,6 +13,18 @@ public:
   virtual ~CompressorFactory() = default;
 
   virtual CompressorPtr createCompressor() PURE;
+
+  /**
+   * Creates a compressor primed with a shared compression dictionary, e.g. for RFC 9842 style
+   * dictionary-compressed responses. The dictionary is copied by the compressor if needed, so the
+   * caller only has to keep it alive for the duration of this call.
+   * @param dictionary the raw dictionary payload.
+   * @return a compressor using the dictionary, or nullptr if the compression library does not
+   *         support per-stream dictionaries.
+   */
+  virtual CompressorPtr createCompressorWithDictionary(absl::string_view /*dictionary*/) {
+    return nullptr;
+  }
   virtual const std::string& statsPrefix() const PURE;
   virtual const std::string& contentEncoding() const PURE;
 };
@@ -81,6 +81,22 @@ public:
    */
   virtual ProtobufTypes::MessagePtr decodeResource(const ProtobufWkt::Any& resource) PURE;
 
+  /**
+   * Decode an opaque resource onto an arena instead of the heap, so that all resources of one
+   * discovery response can share a single block-allocated region which is released wholesale. The
+   * returned message is owned by the arena and must not be deleted by the caller. Decoders which
+   * do not support arena allocation may keep the default implementation; callers fall back to
+   * decodeResource() when nullptr is returned.
+   * @param resource some opaque resource (ProtobufWkt::Any).
+   * @param arena the arena on which to allocate the decoded message.
+   * @return Protobuf::Message* arena-owned decoded message, or nullptr if arena decoding is not
+   *         supported by this decoder.
+   */
+  virtual Protobuf::Message* decodeResourceWithArena(const ProtobufWkt::Any& /*resource*/,
+                                                     Protobuf::Arena& /*arena*/) {
+    return nullptr;
+  }
+
   /**
    * @param resource some opaque resource (Protobuf::Message).
    * @return std::String the resource name in a Protobuf::Message returned by decodeResource(), e.g.
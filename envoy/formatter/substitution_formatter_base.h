@@ -61,6 +61,27 @@ public:
   virtual ProtobufWkt::Value
   formatValueWithContext(const FormatterContext& context,
                          const StreamInfo::StreamInfo& stream_info) const PURE;
+
+  /**
+   * Format the value with the given context and stream info and append it to an output buffer.
+   * The default implementation appends the result of formatWithContext(). Providers that can
+   * serialize their value directly should override this to avoid the intermediate std::string.
+   * @param context supplies the formatter context.
+   * @param stream_info supplies the stream info.
+   * @param output supplies the buffer to append the formatted value to.
+   * @return bool whether a value was appended. If false, nothing was appended and the caller
+   *         decides how to represent the unset value.
+   */
+  virtual bool formatWithContextTo(const FormatterContext& context,
+                                   const StreamInfo::StreamInfo& stream_info,
+                                   std::string& output) const {
+    const auto value = formatWithContext(context, stream_info);
+    if (!value.has_value()) {
+      return false;
+    }
+    output.append(*value);
+    return true;
+  }
 };
 
 template <class FormatterContext>
@@ -183,6 +204,24 @@ public:
    * @return ProtobufWkt::Value containing a single value extracted from the given stream info.
    */
   virtual ProtobufWkt::Value formatValue(const StreamInfo::StreamInfo& stream_info) const PURE;
+
+  /**
+   * Format the value with the given stream info and append it to an output buffer. The default
+   * implementation appends the result of format(). Providers that can serialize their value
+   * directly should override this to avoid the intermediate std::string.
+   * @param stream_info supplies the stream info.
+   * @param output supplies the buffer to append the formatted value to.
+   * @return bool whether a value was appended. If false, nothing was appended and the caller
+   *         decides how to represent the unset value.
+   */
+  virtual bool formatTo(const StreamInfo::StreamInfo& stream_info, std::string& output) const {
+    const auto value = format(stream_info);
+    if (!value.has_value()) {
+      return false;
+    }
+    output.append(*value);
+    return true;
+  }
 };
 
 using StreamInfoFormatterProvider = FormatterProviderBase<StreamInfoOnlyFormatterContext>;
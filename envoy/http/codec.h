@@ -535,6 +535,10 @@ struct Http1Settings {
   // If false, only methods from a hard-coded list of known methods are accepted.
   // Only implemented in BalsaParser. http-parser only accepts known methods.
   bool allow_custom_methods_{false};
+
+  // If true, request header maps created by the codec carve their per-header list nodes out of a
+  // single arena owned by the map, freed wholesale when the stream goes away.
+  bool use_arena_header_maps_{false};
 };
 
 /**
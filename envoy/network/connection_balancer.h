@@ -1,5 +1,6 @@
 #pragma once
 
+#include "envoy/common/time.h"
 #include "envoy/network/listen_socket.h"
 
 namespace Envoy {
@@ -35,6 +36,16 @@ public:
 
   virtual void onAcceptWorker(Network::ConnectionSocketPtr&& socket,
                               bool hand_off_restored_destination_connections, bool rebalanced) PURE;
+
+  /**
+   * @return the duration since the handler's worker event loop last showed signs of life, sampled
+   *         against now. Load-aware balancer implementations use this to steer accepts away from
+   *         workers that are saturated by expensive connections. Implementations must be safe to
+   *         call from other worker threads. The default reports a fully responsive loop.
+   */
+  virtual MonotonicTime::duration timeSinceLastLoopActivity(MonotonicTime) const {
+    return MonotonicTime::duration::zero();
+  }
 };
 
 /**
@@ -64,6 +64,26 @@ public:
   virtual ConfigConstSharedPtr createConfig(const Protobuf::Message& rc,
                                             Server::Configuration::ServerFactoryContext& context,
                                             bool validate_clusters_default) const PURE;
+
+  /**
+   * Create a config object based on a route configuration, additionally supplying the config
+   * object which was created from the previous route configuration. Implementations may use the
+   * previous config to share unchanged state with the new config instead of rebuilding it. The
+   * default implementation ignores the previous config.
+   * @param rc supplies the RouteConfiguration.
+   * @param context supplies the context of the server factory.
+   * @param validate_clusters_default specifies whether the clusters that the route
+   *    table refers to will be validated by the cluster manager.
+   * @param previous_config supplies the config created from the previous route configuration,
+   *    or the null config if no route configuration has been applied yet.
+   * @throw EnvoyException if the new config can't be applied.
+   */
+  virtual ConfigConstSharedPtr createConfig(const Protobuf::Message& rc,
+                                            Server::Configuration::ServerFactoryContext& context,
+                                            bool validate_clusters_default,
+                                            const ConfigConstSharedPtr& /*previous_config*/) const {
+    return createConfig(rc, context, validate_clusters_default);
+  }
 };
 
 } // namespace Rds
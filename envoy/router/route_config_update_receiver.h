@@ -34,13 +34,14 @@ public:
   /**
    * Called on updates via VHDS.
    * @param added_vhosts supplies VirtualHosts that have been added.
-   * @param added_resource_ids set of resources IDs (names + aliases) added.
+   * @param added_resource_ids set of resources IDs (names + aliases) added, consumed by the
+   *        receiver.
    * @param removed_resources supplies names of VirtualHosts that have been removed.
    * @param version_info supplies RouteConfiguration version.
    * @return bool whether RouteConfiguration has been updated.
    */
   virtual bool onVhdsUpdate(const VirtualHostRefVector& added_vhosts,
-                            const std::set<std::string>& added_resource_ids,
+                            std::set<std::string>&& added_resource_ids,
                             const Protobuf::RepeatedPtrField<std::string>& removed_resources,
                             const std::string& version_info) PURE;
 
@@ -209,6 +209,14 @@ public:
    * @return a factory which can be used to create TLS context provider instances.
    */
   virtual TlsCertificateSelectorFactory tlsCertificateSelectorFactory() const PURE;
+
+  /**
+   * @return a hash covering the fully resolved content of this configuration, or nullopt if the
+   *         implementation cannot provide one. Two configurations returning the same value must
+   *         produce interchangeable server contexts; the context manager uses this to share one
+   *         compiled context across identical filter chains instead of building a copy per chain.
+   */
+  virtual absl::optional<uint64_t> contentHash() const PURE;
 };
 
 using ServerContextConfigPtr = std::unique_ptr<ServerContextConfig>;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <string>
 
 #include "envoy/stats/tag.h"
@@ -7,6 +8,7 @@
 #include "source/common/common/assert.h"
 #include "source/common/common/non_copyable.h"
 
+#include "absl/base/optimization.h"
 #include "absl/strings/string_view.h"
 
 namespace Envoy {
@@ -62,6 +64,61 @@ private:
 
 using PrimitiveGaugeReference = std::reference_wrapper<PrimitiveGauge>;
 
+/**
+ * Primitive gauge sharded over a small set of cache-line padded cells so that writers on
+ * different threads do not serialize on a single atomic. Intended for hot gauges, such as per-host
+ * active request counts, that every worker updates on the request path. Threads are assigned to
+ * cells round-robin on first use; a balanced inc()/dec() pair issued from different threads may
+ * transiently leave individual cells "negative", but since the cells wrap modulo 2^64 the summed
+ * value() remains correct. value() reads every cell and is therefore slightly more expensive than
+ * PrimitiveGauge::value(); readers that only compare values, such as load balancers, tolerate the
+ * relaxed snapshot.
+ */
+class PrimitiveShardedGauge : NonCopyable {
+public:
+  PrimitiveShardedGauge() = default;
+
+  uint64_t value() const {
+    uint64_t sum = 0;
+    for (const Cell& cell : cells_) {
+      sum += cell.value_.load(std::memory_order_relaxed);
+    }
+    return sum;
+  }
+
+  void add(uint64_t amount) { localCell().value_.fetch_add(amount, std::memory_order_relaxed); }
+  void dec() { sub(1); }
+  void inc() { add(1); }
+  void sub(uint64_t amount) { localCell().value_.fetch_sub(amount, std::memory_order_relaxed); }
+
+  // Sets the summed value by clearing all cells. Not atomic with respect to concurrent add()/sub()
+  // calls; intended for externally synchronized writers such as tests.
+  void set(uint64_t value) {
+    for (size_t i = 1; i < NumCells; i++) {
+      cells_[i].value_.store(0, std::memory_order_relaxed);
+    }
+    cells_[0].value_.store(value, std::memory_order_relaxed);
+  }
+
+private:
+  // Few enough cells to keep the per-object overhead bounded while still spreading the hottest
+  // writers across cache lines.
+  static constexpr size_t NumCells = 4;
+
+  struct alignas(ABSL_CACHELINE_SIZE) Cell {
+    std::atomic<uint64_t> value_{0};
+  };
+
+  Cell& localCell() {
+    static std::atomic<uint32_t> next_cell{0};
+    static thread_local uint32_t cell_index =
+        next_cell.fetch_add(1, std::memory_order_relaxed) % NumCells;
+    return cells_[cell_index];
+  }
+
+  std::array<Cell, NumCells> cells_;
+};
+
 class PrimitiveMetricMetadata {
 public:
   // Mirror some of the API for Stats::Metric for use in templates that
@@ -100,6 +157,9 @@ private:
 class PrimitiveGaugeSnapshot : public PrimitiveMetricMetadata {
 public:
   PrimitiveGaugeSnapshot(PrimitiveGauge& gauge) : value_(gauge.value()) {}
+  // Some gauges, e.g. PrimitiveShardedGauge, have no single underlying atomic to reference and
+  // are snapshotted directly from a sampled value.
+  explicit PrimitiveGaugeSnapshot(uint64_t value) : value_(value) {}
 
   uint64_t value() const { return value_; }
 
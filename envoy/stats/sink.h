@@ -94,6 +94,21 @@ public:
  */
 class Sink {
 public:
+  /**
+   * Describes how periodic flushes are delivered to a sink.
+   */
+  enum class FlushMode {
+    // The sink receives every metric on every flush.
+    Full,
+    // The sink receives only metrics whose value changed since the previous
+    // flush, plus a periodic full flush so downstream collectors can recover
+    // dropped or aged-out series. Counters are considered changed when their
+    // latched delta is nonzero; gauges and text readouts when their value
+    // differs from the one previously flushed; histograms when they recorded
+    // samples since the last flush.
+    Delta,
+  };
+
   virtual ~Sink() = default;
 
   /**
@@ -102,6 +117,13 @@ public:
    */
   virtual void flush(MetricSnapshot& snapshot) PURE;
 
+  /**
+   * @return the delivery mode for periodic flushes. Defaults to Full; sinks
+   * whose export volume is dominated by series that rarely change between
+   * intervals may opt into Delta.
+   */
+  virtual FlushMode flushMode() const { return FlushMode::Full; }
+
   /**
    * Flush a single histogram sample. Note: this call is called synchronously as a part of recording
    * the metric, so implementations must be thread-safe.
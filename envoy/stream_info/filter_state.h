@@ -7,10 +7,14 @@
 #include "envoy/config/typed_config.h"
 
 #include "source/common/common/fmt.h"
+#include "source/common/common/macros.h"
 #include "source/common/common/utility.h"
 #include "source/common/protobuf/protobuf.h"
 
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
 #include "absl/types/optional.h"
 
 namespace Envoy {
@@ -20,6 +24,45 @@ class FilterState;
 
 using FilterStateSharedPtr = std::shared_ptr<FilterState>;
 
+/**
+ * Process-wide registry that assigns each typed filter state key a dense index into the flat
+ * array that FilterState implementations use to serve typed lookups without hashing the data
+ * name. Indexes are assigned the first time a key is seen, which is expected to happen at
+ * configuration time when typed keys are resolved from static initializers or filter
+ * constructors.
+ */
+class FilterStateTypedKeyRegistry {
+public:
+  static FilterStateTypedKeyRegistry& instance() {
+    MUTABLE_CONSTRUCT_ON_FIRST_USE(FilterStateTypedKeyRegistry);
+  }
+
+  /**
+   * @return the index for name, assigning the next free index the first time name is seen.
+   */
+  uint32_t index(absl::string_view name) {
+    absl::MutexLock lock(&mutex_);
+    return indexes_.try_emplace(std::string(name), static_cast<uint32_t>(indexes_.size()))
+        .first->second;
+  }
+
+  /**
+   * @return the index for name if name has been registered as a typed key, nullopt otherwise.
+   */
+  absl::optional<uint32_t> find(absl::string_view name) const {
+    absl::MutexLock lock(&mutex_);
+    const auto it = indexes_.find(name);
+    if (it == indexes_.end()) {
+      return absl::nullopt;
+    }
+    return it->second;
+  }
+
+private:
+  mutable absl::Mutex mutex_;
+  absl::flat_hash_map<std::string, uint32_t> indexes_ ABSL_GUARDED_BY(mutex_);
+};
+
 // Objects stored in the filter state can optionally be shared between the
 // upstream and downstream filter state. Note that sharing happens at the
 // connection level and in some cases may significantly reduce performance by
@@ -141,6 +184,33 @@ public:
     std::string name_;
   };
 
+  /**
+   * Handle for a typed filter state key: the data name plus a small dense index into the flat
+   * array that implementations use to serve typed lookups without hashing the name. The
+   * canonical instance for a tag type is obtained via typedKey() so the index is resolved once
+   * per process rather than per lookup.
+   */
+  class TypedKey {
+  public:
+    explicit TypedKey(absl::string_view name)
+        : name_(name), index_(FilterStateTypedKeyRegistry::instance().index(name)) {}
+
+    absl::string_view name() const { return name_; }
+    uint32_t index() const { return index_; }
+
+  private:
+    const std::string name_;
+    const uint32_t index_;
+  };
+
+  /**
+   * @return the process-wide typed key for the tag type T. T must provide a static key() method
+   * returning the data name, which is the convention filter state objects already follow.
+   */
+  template <typename T> static const TypedKey& typedKey() {
+    CONSTRUCT_ON_FIRST_USE(TypedKey, T::key());
+  }
+
   using Objects = std::vector<FilterObject>;
   using ObjectsPtr = std::unique_ptr<Objects>;
 
@@ -165,6 +235,18 @@ public:
           LifeSpan life_span = LifeSpan::FilterChain,
           StreamSharingMayImpactPooling stream_sharing = StreamSharingMayImpactPooling::None) PURE;
 
+  /**
+   * Typed-key variant of setData(). The default implementation forwards to the string-keyed
+   * path; implementations may additionally index the object by key so that typed lookups do not
+   * hash the data name.
+   */
+  virtual void
+  setData(const TypedKey& key, std::shared_ptr<Object> data, StateType state_type,
+          LifeSpan life_span = LifeSpan::FilterChain,
+          StreamSharingMayImpactPooling stream_sharing = StreamSharingMayImpactPooling::None) {
+    setData(key.name(), std::move(data), state_type, life_span, stream_sharing);
+  }
+
   /**
    * @param data_name the name of the data being looked up (mutable/readonly).
    * @return a typed pointer to the stored data or nullptr if the data does not exist or the data
@@ -174,12 +256,30 @@ public:
     return dynamic_cast<const T*>(getDataReadOnlyGeneric(data_name));
   }
 
+  /**
+   * Typed-key variant of getDataReadOnly() using the typed key of T, so that implementations
+   * that index typed keys can serve the lookup without hashing the data name.
+   * @return a typed pointer to the stored data or nullptr if the data does not exist or the data
+   * type does not match the expected type.
+   */
+  template <typename T> const T* getDataReadOnly() const {
+    return dynamic_cast<const T*>(getDataReadOnlyGeneric(typedKey<T>()));
+  }
+
   /**
    * @param data_name the name of the data being looked up (mutable/readonly).
    * @return a const pointer to the stored data or nullptr if the data does not exist.
    */
   virtual const Object* getDataReadOnlyGeneric(absl::string_view data_name) const PURE;
 
+  /**
+   * Typed-key variant of getDataReadOnlyGeneric(). The default implementation forwards to the
+   * string-keyed path.
+   */
+  virtual const Object* getDataReadOnlyGeneric(const TypedKey& key) const {
+    return getDataReadOnlyGeneric(key.name());
+  }
+
   /**
    * @param data_name the name of the data being looked up (mutable/readonly).
    * @return a typed pointer to the stored data or nullptr if the data does not exist or the data
@@ -189,18 +289,44 @@ public:
     return dynamic_cast<T*>(getDataMutableGeneric(data_name));
   }
 
+  /**
+   * Typed-key variant of getDataMutable() using the typed key of T, so that implementations
+   * that index typed keys can serve the lookup without hashing the data name.
+   * @return a typed pointer to the stored data or nullptr if the data does not exist or the data
+   * type does not match the expected type.
+   */
+  template <typename T> T* getDataMutable() {
+    return dynamic_cast<T*>(getDataMutableGeneric(typedKey<T>()));
+  }
+
   /**
    * @param data_name the name of the data being looked up (mutable/readonly).
    * @return a pointer to the stored data or nullptr if the data does not exist.
    */
   virtual Object* getDataMutableGeneric(absl::string_view data_name) PURE;
 
+  /**
+   * Typed-key variant of getDataMutableGeneric(). The default implementation forwards to the
+   * string-keyed path.
+   */
+  virtual Object* getDataMutableGeneric(const TypedKey& key) {
+    return getDataMutableGeneric(key.name());
+  }
+
   /**
    * @param data_name the name of the data being looked up (mutable/readonly).
    * @return a shared pointer to the stored data or nullptr if the data does not exist.
    */
   virtual std::shared_ptr<Object> getDataSharedMutableGeneric(absl::string_view data_name) PURE;
 
+  /**
+   * Typed-key variant of getDataSharedMutableGeneric(). The default implementation forwards to
+   * the string-keyed path.
+   */
+  virtual std::shared_ptr<Object> getDataSharedMutableGeneric(const TypedKey& key) {
+    return getDataSharedMutableGeneric(key.name());
+  }
+
   /**
    * @param data_name the name of the data being probed.
    * @return Whether data of the type and name specified exists in the
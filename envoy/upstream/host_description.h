@@ -36,23 +36,34 @@ using MetadataConstSharedPtr = std::shared_ptr<const envoy::config::core::v3::Me
   COUNTER(rq_success)                                                                              \
   COUNTER(rq_timeout)                                                                              \
   COUNTER(rq_total)                                                                                \
-  GAUGE(cx_active)                                                                                 \
-  GAUGE(rq_active)
+  GAUGE(cx_active)
 
 /**
  * All per host stats defined. @see stats_macros.h
+ *
+ * These are intentionally eager primitive atomics rather than store-backed or lazily
+ * materialized stats: the whole block is a few machine words per host, the counters are latched
+ * (swapped to zero) by LoadStatsReporter so they cannot be recreated on demand without losing
+ * deltas, and they are only surfaced externally through the opt-in per-endpoint stats config.
  */
 struct HostStats {
   ALL_HOST_STATS(GENERATE_PRIMITIVE_COUNTER_STRUCT, GENERATE_PRIMITIVE_GAUGE_STRUCT);
 
+  // Active requests are tracked outside of the macro block with a sharded gauge: every worker
+  // updates this gauge on request start/finish, and hot hosts would otherwise serialize workers
+  // on a single atomic.
+  Stats::PrimitiveShardedGauge rq_active_;
+
   // Provide access to name,counter pairs.
   std::vector<std::pair<absl::string_view, Stats::PrimitiveCounterReference>> counters() {
     return {ALL_HOST_STATS(PRIMITIVE_COUNTER_NAME_AND_REFERENCE, IGNORE_PRIMITIVE_GAUGE)};
   }
 
-  // Provide access to name,gauge pairs.
-  std::vector<std::pair<absl::string_view, Stats::PrimitiveGaugeReference>> gauges() {
-    return {ALL_HOST_STATS(IGNORE_PRIMITIVE_COUNTER, PRIMITIVE_GAUGE_NAME_AND_REFERENCE)};
+  // Provide access to name,value pairs, sorted by name. Values are snapshotted rather than
+  // referenced because the sharded rq_active_ gauge has no single underlying atomic.
+  std::vector<std::pair<absl::string_view, uint64_t>> gauges() {
+    return {ALL_HOST_STATS(IGNORE_PRIMITIVE_COUNTER, PRIMITIVE_GAUGE_NAME_AND_VALUE)
+                {"rq_active", rq_active_.value()}};
   }
 };
 
@@ -188,6 +199,22 @@ public:
    */
   virtual SharedConstAddressVector addressListOrNull() const PURE;
 
+  /**
+   * @return the address of the most recent successful connection attempt to this host, or
+   *         nullptr if none has been recorded. Only populated for hosts with multiple
+   *         addresses, where it is used to try the known-good address first instead of
+   *         re-racing address families on every connection.
+   */
+  virtual Network::Address::InstanceConstSharedPtr lastSuccessfulAddress() const PURE;
+
+  /**
+   * Records the address which most recently completed a successful connection attempt.
+   * Const for the same reason as stats(): connection establishment only holds const
+   * references to the host but needs to record outcomes.
+   */
+  virtual void
+  setLastSuccessfulAddress(Network::Address::InstanceConstSharedPtr address) const PURE;
+
   /**
    * @return host specific stats.
    */
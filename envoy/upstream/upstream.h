@@ -194,10 +194,10 @@ public:
       const envoy::config::core::v3::Metadata* metadata) const PURE;
 
   /**
-   * @return host specific gauges.
+   * @return host specific gauge names and current values. Values are snapshots rather than
+   *         references because the active request gauge is sharded across several atomics.
    */
-  virtual std::vector<std::pair<absl::string_view, Stats::PrimitiveGaugeReference>>
-  gauges() const PURE;
+  virtual std::vector<std::pair<absl::string_view, uint64_t>> gauges() const PURE;
 
   /**
    * Atomically clear a health flag for a host. Flags are specified in HealthFlags.
@@ -704,6 +704,7 @@ public:
   COUNTER(lb_subsets_created)                                                                      \
   COUNTER(lb_subsets_fallback)                                                                     \
   COUNTER(lb_subsets_fallback_panic)                                                               \
+  COUNTER(lb_subsets_match_cache_hit)                                                              \
   COUNTER(lb_subsets_removed)                                                                      \
   COUNTER(lb_subsets_selected)                                                                     \
   COUNTER(lb_zone_cluster_too_small)                                                               \
@@ -31,16 +31,17 @@ namespace AccessLog {
 
 ComparisonFilter::ComparisonFilter(const envoy::config::accesslog::v3::ComparisonFilter& config,
                                    Runtime::Loader& runtime)
-    : config_(config), runtime_(runtime) {}
+    : op_(config.op()), default_value_(config.value().default_value()),
+      runtime_key_(config.value().runtime_key()), runtime_(runtime) {}
 
 bool ComparisonFilter::compareAgainstValue(uint64_t lhs) const {
-  uint64_t value = config_.value().default_value();
+  uint64_t value = default_value_;
 
-  if (!config_.value().runtime_key().empty()) {
-    value = runtime_.snapshot().getInteger(config_.value().runtime_key(), value);
+  if (!runtime_key_.empty()) {
+    value = runtime_.snapshot().getInteger(runtime_key_, value);
   }
 
-  switch (config_.op()) {
+  switch (op_) {
     PANIC_ON_PROTO_ENUM_SENTINEL_VALUES;
   case envoy::config::accesslog::v3::ComparisonFilter::GE:
     return lhs >= value;
@@ -128,7 +129,9 @@ bool DurationFilter::evaluate(const Formatter::HttpFormatterContext&,
 RuntimeFilter::RuntimeFilter(const envoy::config::accesslog::v3::RuntimeFilter& config,
                              Runtime::Loader& runtime, Random::RandomGenerator& random)
     : runtime_(runtime), random_(random), runtime_key_(config.runtime_key()),
-      percent_(config.percent_sampled()),
+      percent_numerator_(config.percent_sampled().numerator()),
+      percent_denominator_(ProtobufPercentHelper::fractionalPercentDenominatorToInt(
+          config.percent_sampled().denominator())),
       use_independent_randomness_(config.use_independent_randomness()) {}
 
 bool RuntimeFilter::evaluate(const Formatter::HttpFormatterContext&,
@@ -144,15 +147,12 @@ bool RuntimeFilter::evaluate(const Formatter::HttpFormatterContext&,
     if (!rid_to_integer.has_value()) {
       random_value = random_.random();
     } else {
-      random_value =
-          rid_to_integer.value() %
-          ProtobufPercentHelper::fractionalPercentDenominatorToInt(percent_.denominator());
+      random_value = rid_to_integer.value() % percent_denominator_;
     }
   }
 
-  return runtime_.snapshot().featureEnabled(
-      runtime_key_, percent_.numerator(), random_value,
-      ProtobufPercentHelper::fractionalPercentDenominatorToInt(percent_.denominator()));
+  return runtime_.snapshot().featureEnabled(runtime_key_, percent_numerator_, random_value,
+                                            percent_denominator_);
 }
 
 OperatorFilter::OperatorFilter(
@@ -10,7 +10,6 @@
 #include "envoy/config/accesslog/v3/accesslog.pb.h"
 #include "envoy/config/typed_config.h"
 #include "envoy/runtime/runtime.h"
-#include "envoy/type/v3/percent.pb.h"
 
 #include "source/common/common/matchers.h"
 #include "source/common/common/utility.h"
@@ -47,7 +46,11 @@ protected:
 
   bool compareAgainstValue(uint64_t lhs) const;
 
-  envoy::config::accesslog::v3::ComparisonFilter config_;
+  // The comparison op and default value are fixed at configuration time; only the runtime
+  // override of the value, when a runtime key is configured, is resolved per evaluation.
+  const envoy::config::accesslog::v3::ComparisonFilter::Op op_;
+  const uint64_t default_value_;
+  const std::string runtime_key_;
   Runtime::Loader& runtime_;
 };
 
@@ -156,7 +159,9 @@ private:
   Runtime::Loader& runtime_;
   Random::RandomGenerator& random_;
   const std::string runtime_key_;
-  const envoy::type::v3::FractionalPercent percent_;
+  const uint32_t percent_numerator_;
+  // Integer form of percent_sampled().denominator(), converted once at configuration time.
+  const uint64_t percent_denominator_;
   const bool use_independent_randomness_;
 };
 
@@ -85,8 +85,9 @@ AccessLogFileImpl::~AccessLogFileImpl() {
 
   // Flush any remaining data. If file was not opened for some reason, skip flushing part.
   if (file_->isOpen()) {
-    if (flush_buffer_.length() > 0) {
-      doWrite(flush_buffer_);
+    moveStagingBuffersTo(about_to_write_buffer_);
+    if (about_to_write_buffer_.length() > 0) {
+      doWrite(about_to_write_buffer_);
     }
     const Api::IoCallBoolResult result = file_->close();
     ASSERT(result.return_value_, fmt::format("unable to close file '{}': {}", file_->path(),
@@ -123,6 +124,26 @@ void AccessLogFileImpl::doWrite(Buffer::Instance& buffer) {
   buffer.drain(buffer.length());
 }
 
+AccessLogFileImpl::StagingBuffer& AccessLogFileImpl::stagingBuffer() {
+  // Thread ids are cached thread locally so looking them up is cheap enough for the write path.
+  // Worker thread ids are typically sequential so a simple modulo spreads them evenly.
+  const uint64_t thread_id = static_cast<uint64_t>(thread_factory_.currentThreadId().getId());
+  return staging_buffers_[thread_id % NumStagingBuffers];
+}
+
+void AccessLogFileImpl::moveStagingBuffersTo(Buffer::Instance& destination) {
+  for (StagingBuffer& staging : staging_buffers_) {
+    Thread::LockGuard lock(staging.lock_);
+    const uint64_t length = staging.buffer_.length();
+    if (length > 0) {
+      // pending_bytes_ is updated under the per-cell lock, together with the buffer, so that it
+      // always equals the sum of the staged bytes and never transiently under- or over-counts.
+      pending_bytes_.fetch_sub(length, std::memory_order_relaxed);
+      destination.move(staging.buffer_);
+    }
+  }
+}
+
 void AccessLogFileImpl::flushThreadFunc() {
 
   // Transfer the action from `reopen_file_` to this variable so that `reopen_file_` is only
@@ -136,13 +157,14 @@ void AccessLogFileImpl::flushThreadFunc() {
     {
       Thread::LockGuard write_lock(write_lock_);
 
-      // flush_event_ can be woken up either by large enough flush_buffer or by timer.
-      // In case it was timer, flush_buffer_ can be empty.
+      // flush_event_ can be woken up either by a writer crossing the flush watermark or by timer.
+      // In case it was timer, the staging buffers can be empty.
       //
       // Note: do not stop waiting when only `do_reopen` is true. In this case, we tried to
       // reopen and failed. We don't want to retry this in a tight loop, so wait for the next
       // event (timer or flush).
-      while (flush_buffer_.length() == 0 && !flush_thread_exit_ && !reopen_file_) {
+      while (pending_bytes_.load(std::memory_order_acquire) == 0 && !flush_thread_exit_ &&
+             !reopen_file_) {
         // CondVar::wait() does not throw, so it's safe to pass the mutex rather than the guard.
         flush_event_.wait(write_lock_);
       }
@@ -152,8 +174,7 @@ void AccessLogFileImpl::flushThreadFunc() {
       }
 
       flush_lock = std::unique_lock<Thread::BasicLockable>(flush_lock_);
-      about_to_write_buffer_.move(flush_buffer_);
-      ASSERT(flush_buffer_.length() == 0);
+      moveStagingBuffersTo(about_to_write_buffer_);
 
       if (reopen_file_) {
         do_reopen = true;
@@ -185,35 +206,47 @@ void AccessLogFileImpl::flush() {
   {
     Thread::LockGuard write_lock(write_lock_);
 
-    // flush_lock_ must be held while checking this or else it is
-    // possible that flushThreadFunc() has already moved data from
-    // flush_buffer_ to about_to_write_buffer_, has unlocked write_lock_,
+    // flush_lock_ must be held while swapping the staging buffers or else it is
+    // possible that flushThreadFunc() has already moved staged data
+    // to about_to_write_buffer_, has unlocked write_lock_,
     // but has not yet completed doWrite(). This would allow flush() to
     // return before the pending data has actually been written to disk.
     flush_buffer_lock = std::unique_lock<Thread::BasicLockable>(flush_lock_);
 
-    if (flush_buffer_.length() == 0) {
+    moveStagingBuffersTo(about_to_write_buffer_);
+    if (about_to_write_buffer_.length() == 0) {
       return;
     }
-
-    about_to_write_buffer_.move(flush_buffer_);
-    ASSERT(flush_buffer_.length() == 0);
   }
 
   doWrite(about_to_write_buffer_);
 }
 
 void AccessLogFileImpl::write(absl::string_view data) {
-  Thread::LockGuard lock(write_lock_);
-
-  if (flush_thread_ == nullptr) {
-    createFlushStructures();
+  StagingBuffer& staging = stagingBuffer();
+  uint64_t pending;
+  {
+    Thread::LockGuard lock(staging.lock_);
+    staging.buffer_.add(data.data(), data.size());
+    pending = pending_bytes_.fetch_add(data.length(), std::memory_order_release) + data.length();
   }
 
   stats_.write_buffered_.inc();
   stats_.write_total_buffered_.add(data.length());
-  flush_buffer_.add(data.data(), data.size());
-  if (flush_buffer_.length() > MIN_FLUSH_SIZE) {
+
+  // The flush thread is created after the first chunk is staged so that its initial pending
+  // check picks the chunk up without an explicit wakeup.
+  if (!flush_thread_created_.load(std::memory_order_acquire)) {
+    Thread::LockGuard lock(write_lock_);
+    if (flush_thread_ == nullptr) {
+      createFlushStructures();
+    }
+  }
+
+  // Writers below the watermark stage their data and return without touching write_lock_; the
+  // flush thread picks the data up on the next timer tick.
+  if (pending > MIN_FLUSH_SIZE) {
+    Thread::LockGuard lock(write_lock_);
     flush_event_.notifyOne();
   }
 }
@@ -221,6 +254,7 @@ void AccessLogFileImpl::write(absl::string_view data) {
 void AccessLogFileImpl::createFlushStructures() {
   flush_thread_ = thread_factory_.createThread([this]() -> void { flushThreadFunc(); },
                                                Thread::Options{"AccessLogFlush"});
+  flush_thread_created_.store(true, std::memory_order_release);
 }
 
 } // namespace AccessLog
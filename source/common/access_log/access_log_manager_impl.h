@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <string>
 
 #include "envoy/access_log/access_log.h"
@@ -83,19 +85,34 @@ public:
   void flush() override;
 
 private:
+  // One staging cell for buffered log data. Each writing thread is mapped to a single cell by
+  // thread id so that writers on different workers do not contend on a shared lock, and so that
+  // data written by one thread is always flushed in write order.
+  struct StagingBuffer {
+    Thread::MutexBasicLockable lock_;
+    Buffer::OwnedImpl buffer_ ABSL_GUARDED_BY(lock_);
+  };
+
   void doWrite(Buffer::Instance& buffer);
   void flushThreadFunc();
   void createFlushStructures();
+  StagingBuffer& stagingBuffer();
+  void moveStagingBuffersTo(Buffer::Instance& destination);
 
   // Minimum size before the flush thread will be told to flush.
   static const uint64_t MIN_FLUSH_SIZE = 1024 * 64;
 
+  // Number of staging buffers to spread writing threads across. Collisions only cost some lock
+  // sharing, so this does not need to match the worker count.
+  static constexpr size_t NumStagingBuffers = 8;
+
   Filesystem::FilePtr file_;
 
   // These locks are always acquired in the following order if multiple locks are held:
   //    1) write_lock_
   //    2) flush_lock_
-  //    3) file_lock_
+  //    3) StagingBuffer::lock_
+  //    4) file_lock_
   Thread::BasicLockable& file_lock_;      // This lock is used only by the flush thread when writing
                                           // to disk. This is used to make sure that file blocks do
                                           // not get interleaved by multiple processes writing to
@@ -106,25 +123,29 @@ private:
                                           // and all other data used during flushing and file
                                           // re-opening.
   Thread::MutexBasicLockable
-      write_lock_; // The lock is used when filling the flush buffer. It allows
-                   // multiple threads to write to the same file at relatively
-                   // high performance. It is always local to the process.
+      write_lock_; // This lock protects the flush thread control state (exit/reopen flags and the
+                   // flush condvar). It is no longer on the write() hot path; writers only take it
+                   // to wake the flush thread.
   Thread::ThreadPtr flush_thread_;
   Thread::CondVar flush_event_;
+  std::atomic<bool> flush_thread_created_{false};
   bool flush_thread_exit_ ABSL_GUARDED_BY(write_lock_){false};
   bool reopen_file_ ABSL_GUARDED_BY(write_lock_){false};
-  Buffer::OwnedImpl
-      flush_buffer_ ABSL_GUARDED_BY(write_lock_); // This buffer is used by multiple threads. It
-                                                  // gets filled and then flushed either when max
-                                                  // size is reached or when a timer fires.
+  std::array<StagingBuffer, NumStagingBuffers>
+      staging_buffers_; // Filled by writing threads under the per-cell lock and swapped wholesale
+                        // into about_to_write_buffer_ by the flush thread either when the staged
+                        // size crosses MIN_FLUSH_SIZE or when a timer fires.
+  std::atomic<uint64_t> pending_bytes_{0}; // Total bytes currently staged across all staging
+                                           // buffers. Lets writers and the flush thread check for
+                                           // pending data without taking every staging lock.
   // TODO(jmarantz): this should be ABSL_GUARDED_BY(flush_lock_) but the analysis cannot poke
   // through the std::make_unique assignment. I do not believe it's possible to annotate this
   // properly now due to limitations in the clang thread annotation analysis.
   Buffer::OwnedImpl about_to_write_buffer_; // This buffer is used only by the flush thread. Data
-                                            // is moved from flush_buffer_ under lock, and then
-                                            // the lock is released so that flush_buffer_ can
-                                            // continue to fill. This buffer is then used for the
-                                            // final write to disk.
+                                            // is moved out of the staging buffers under their
+                                            // locks, and then the locks are released so that the
+                                            // staging buffers can continue to fill. This buffer is
+                                            // then used for the final write to disk.
   Event::TimerPtr flush_timer_;
   Thread::ThreadFactory& thread_factory_;
   const std::chrono::milliseconds flush_interval_msec_; // Time interval buffer gets flushed no
@@ -59,6 +59,12 @@ SysCallSizeResult OsSysCallsImpl::pwrite(os_fd_t fd, const void* buffer, size_t
   return {rc, rc != -1 ? 0 : errno};
 }
 
+SysCallSizeResult OsSysCallsImpl::pwritev(os_fd_t fd, const iovec* iov, int num_iov,
+                                          off_t offset) const {
+  const ssize_t rc = ::pwritev(fd, iov, num_iov, offset);
+  return {rc, rc != -1 ? 0 : errno};
+}
+
 SysCallSizeResult OsSysCallsImpl::pread(os_fd_t fd, void* buffer, size_t length,
                                         off_t offset) const {
   const ssize_t rc = ::pread(fd, buffer, length, offset);
@@ -22,6 +22,8 @@ public:
   SysCallSizeResult readv(os_fd_t fd, const iovec* iov, int num_iov) override;
   SysCallSizeResult pwrite(os_fd_t fd, const void* buffer, size_t length,
                            off_t offset) const override;
+  SysCallSizeResult pwritev(os_fd_t fd, const iovec* iov, int num_iov,
+                            off_t offset) const override;
   SysCallSizeResult pread(os_fd_t fd, void* buffer, size_t length, off_t offset) const override;
   SysCallSizeResult send(os_fd_t socket, void* buffer, size_t length, int flags) override;
   SysCallSizeResult recv(os_fd_t socket, void* buffer, size_t length, int flags) override;
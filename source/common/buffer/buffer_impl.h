@@ -14,6 +14,7 @@
 #include "source/common/common/utility.h"
 #include "source/common/event/libevent.h"
 
+#include "absl/container/inlined_vector.h"
 #include "absl/functional/any_invocable.h"
 
 namespace Envoy {
@@ -57,7 +58,9 @@ public:
    * @param account the account to charge.
    */
   Slice(uint64_t min_capacity, const BufferMemoryAccountSharedPtr& account)
-      : capacity_(sliceSize(min_capacity)), storage_(new uint8_t[capacity_]),
+      : capacity_(sliceSize(min_capacity)),
+        storage_(capacity_ == default_slice_size_ ? acquirePooledStorage()
+                                                  : StoragePtr{new uint8_t[capacity_]}),
         base_(storage_.get()) {
     if (account) {
       account->charge(capacity_);
@@ -142,6 +145,11 @@ public:
     if (releasor_) {
       releasor_();
     }
+    // Recycle default sized backing stores through the per-thread pool so the drain side of the
+    // read/write cycle does not round-trip the global allocator.
+    if (storage_ != nullptr && capacity_ == default_slice_size_) {
+      releasePooledStorage(std::move(storage_));
+    }
   }
 
   /**
@@ -385,9 +393,50 @@ public:
    */
   static inline SizedStorage newStorage(uint64_t min_capacity) {
     const uint64_t slice_size = sliceSize(min_capacity);
+    if (slice_size == default_slice_size_) {
+      return {acquirePooledStorage(), static_cast<size_t>(slice_size)};
+    }
     return {StoragePtr{new uint8_t[slice_size]}, static_cast<size_t>(slice_size)};
   }
 
+  // Upper bound for the per-thread pool of default sized backing stores (1MiB of slack per
+  // thread at the default slice size). Beyond this, drained storage goes back to the allocator.
+  static constexpr uint32_t storage_pool_max_ = 64;
+  using StorageFreeList = absl::InlinedVector<StoragePtr, 8>;
+
+  /**
+   * @return the calling thread's free list of default sized backing stores. Callers on hot paths
+   * may cache the reference to avoid repeated thread local resolution.
+   */
+  static StorageFreeList& storagePool() {
+    static thread_local StorageFreeList pool;
+    return pool;
+  }
+
+  /**
+   * @return a default sized backing store, reusing a pooled one when available.
+   */
+  static StoragePtr acquirePooledStorage() {
+    StorageFreeList& pool = storagePool();
+    if (pool.empty()) {
+      return StoragePtr{new uint8_t[default_slice_size_]};
+    }
+    StoragePtr storage = std::move(pool.back());
+    pool.pop_back();
+    return storage;
+  }
+
+  /**
+   * Return a default sized backing store to the calling thread's pool, or free it if the pool
+   * is full.
+   */
+  static void releasePooledStorage(StoragePtr&& storage) {
+    StorageFreeList& pool = storagePool();
+    if (pool.size() < storage_pool_max_) {
+      pool.push_back(std::move(storage));
+    }
+  }
+
 protected:
   /** Length of the byte array that base_ points to. This is also the offset in bytes from the start
    * of the slice to the end of the Reservable section. */
@@ -783,14 +832,12 @@ private:
 
   struct OwnedImplReservationSlicesOwnerMultiple : public OwnedImplReservationSlicesOwner {
   public:
-    static constexpr uint32_t free_list_max_ = Buffer::Reservation::MAX_SLICES_;
-
-    OwnedImplReservationSlicesOwnerMultiple() : free_list_ref_(free_list_) {}
+    OwnedImplReservationSlicesOwnerMultiple() : free_list_ref_(Slice::storagePool()) {}
     ~OwnedImplReservationSlicesOwnerMultiple() override {
       for (auto r = owned_storages_.rbegin(); r != owned_storages_.rend(); r++) {
         if (r->mem_ != nullptr) {
           ASSERT(r->len_ == Slice::default_slice_size_);
-          if (free_list_ref_.size() < free_list_max_) {
+          if (free_list_ref_.size() < Slice::storage_pool_max_) {
             free_list_ref_.push_back(std::move(r->mem_));
           }
         }
@@ -819,13 +866,9 @@ private:
 
   private:
     // Thread local resolving introduces additional overhead. Initialize this reference once when
-    // constructing the owner to reduce thread local resolving to improve performance.
-    absl::InlinedVector<Slice::StoragePtr, free_list_max_>& free_list_ref_;
-
-    // Simple thread local cache to reduce unnecessary memory allocation and release. This cache
-    // is currently only used for multiple slices reservation because of the additional overhead
-    // that thread local resolving would introduce.
-    static thread_local absl::InlinedVector<Slice::StoragePtr, free_list_max_> free_list_;
+    // constructing the owner to reduce thread local resolving to improve performance. The pool
+    // is shared with the slice destructor and single slice reservations via Slice::storagePool().
+    Slice::StorageFreeList& free_list_ref_;
   };
 
   struct OwnedImplReservationSlicesOwnerSingle : public OwnedImplReservationSlicesOwner {
@@ -143,7 +143,12 @@ void WatermarkBuffer::checkLowWatermark() {
 }
 
 void WatermarkBuffer::checkHighAndOverflowWatermarks() {
-  if (high_watermark_ == 0 || OwnedImpl::length() <= high_watermark_) {
+  if (high_watermark_ == 0) {
+    return;
+  }
+  // This is called after every mutation, so compute the length once for both checks.
+  const uint64_t length = OwnedImpl::length();
+  if (length <= high_watermark_) {
     return;
   }
 
@@ -155,7 +160,7 @@ void WatermarkBuffer::checkHighAndOverflowWatermarks() {
   // Check if overflow watermark is enabled, wasn't previously triggered,
   // and the buffer size is above the threshold
   if (overflow_watermark_ != 0 && !above_overflow_watermark_called_ &&
-      OwnedImpl::length() > overflow_watermark_) {
+      length > overflow_watermark_) {
     above_overflow_watermark_called_ = true;
     above_overflow_watermark_();
   }
@@ -201,9 +206,39 @@ void WatermarkBufferFactory::unregisterAccount(const BufferMemoryAccountSharedPt
   }
 }
 
+void WatermarkBufferFactory::setAccountSettlementHook(std::function<void()> hook) {
+  settlement_hook_ = std::move(hook);
+}
+
+void WatermarkBufferFactory::settleAccountUpdates() {
+  // Settling moves accounts between class buckets but never changes balances,
+  // so no account can re-queue itself during this pass.
+  for (auto& account : pending_account_settlements_) {
+    static_cast<BufferMemoryAccountImpl&>(*account).settleClassUpdate();
+  }
+  pending_account_settlements_.clear();
+}
+
+bool WatermarkBufferFactory::deferAccountClassUpdate(const BufferMemoryAccountSharedPtr& account) {
+  if (!settlement_hook_) {
+    return false;
+  }
+  if (pending_account_settlements_.empty()) {
+    // First deferred update this iteration; ask the dispatcher for a settlement
+    // pass at the end of the iteration.
+    settlement_hook_();
+  }
+  pending_account_settlements_.push_back(account);
+  return true;
+}
+
 uint64_t WatermarkBufferFactory::resetAccountsGivenPressure(float pressure) {
   ASSERT(pressure >= 0.0 && pressure <= 1.0, "Provided pressure is out of range [0, 1].");
 
+  // Make sure bucket membership reflects any balance changes accumulated during
+  // this iteration before deciding which streams to reset.
+  settleAccountUpdates();
+
   // Compute buckets to clear
   const uint32_t buckets_to_clear = std::min<uint32_t>(
       std::floor(pressure * BufferMemoryAccountImpl::NUM_MEMORY_CLASSES_) + 1, 8);
@@ -287,13 +322,25 @@ void BufferMemoryAccountImpl::updateAccountClass() {
 void BufferMemoryAccountImpl::credit(uint64_t amount) {
   ASSERT(buffer_memory_allocated_ >= amount);
   buffer_memory_allocated_ -= amount;
-  updateAccountClass();
+  noteBalanceUpdate();
 }
 
 void BufferMemoryAccountImpl::charge(uint64_t amount) {
   // Check overflow
   ASSERT(std::numeric_limits<uint64_t>::max() - buffer_memory_allocated_ >= amount);
   buffer_memory_allocated_ += amount;
+  noteBalanceUpdate();
+}
+
+void BufferMemoryAccountImpl::noteBalanceUpdate() {
+  if (pending_class_update_) {
+    // Already queued to settle at the end of this dispatcher iteration.
+    return;
+  }
+  if (shared_this_ != nullptr && factory_->deferAccountClassUpdate(shared_this_)) {
+    pending_class_update_ = true;
+    return;
+  }
   updateAccountClass();
 }
 
@@ -129,6 +129,13 @@ public:
   // *WatermarkBufferFactory* for details on the memory classes.
   static constexpr uint32_t NUM_MEMORY_CLASSES_ = 8;
 
+  // Called by the factory during a settlement pass to apply a class update that
+  // was deferred by charge() or credit().
+  void settleClassUpdate() {
+    pending_class_update_ = false;
+    updateAccountClass();
+  }
+
 private:
   BufferMemoryAccountImpl(WatermarkBufferFactory* factory, Http::StreamResetHandler& reset_handler)
       : factory_(factory), reset_handler_(reset_handler) {}
@@ -139,10 +146,17 @@ private:
   // Returned class index, if present, is in the range [0, NUM_MEMORY_CLASSES_).
   absl::optional<uint32_t> balanceToClassIndex();
   void updateAccountClass();
+  // Invoked after every balance change. Either updates the account class
+  // immediately, or queues this account with the factory to settle once at the
+  // end of the dispatcher iteration.
+  void noteBalanceUpdate();
 
   uint64_t buffer_memory_allocated_ = 0;
   // Current bucket index where the account is being tracked in.
   absl::optional<uint32_t> current_bucket_idx_{};
+  // True while this account is queued with the factory for a deferred class
+  // update. Avoids queueing the account more than once per settlement pass.
+  bool pending_class_update_ = false;
 
   WatermarkBufferFactory* factory_ = nullptr;
 
@@ -201,6 +215,8 @@ public:
 
   BufferMemoryAccountSharedPtr createAccount(Http::StreamResetHandler& reset_handler) override;
   uint64_t resetAccountsGivenPressure(float pressure) override;
+  void setAccountSettlementHook(std::function<void()> hook) override;
+  void settleAccountUpdates() override;
 
   // Called by BufferMemoryAccountImpls created by the factory on account class
   // updated.
@@ -208,6 +224,12 @@ public:
                           absl::optional<uint32_t> current_class,
                           absl::optional<uint32_t> new_class);
 
+  // Called by BufferMemoryAccountImpls to queue a class update to settle at the
+  // end of the current dispatcher iteration rather than applying it inline.
+  // Returns false if no settlement hook is installed, in which case the account
+  // must update its class synchronously.
+  bool deferAccountClassUpdate(const BufferMemoryAccountSharedPtr& account);
+
   uint32_t bitshift() const { return bitshift_; }
 
   // Unregister a buffer memory account.
@@ -222,6 +244,14 @@ protected:
   // How much to bit shift right balances to test whether the account should be
   // tracked in *size_class_account_sets_*.
   const uint32_t bitshift_;
+
+private:
+  // Hook used to ask the owning dispatcher to run settleAccountUpdates() at the
+  // end of the current iteration. Empty when batched accounting is disabled.
+  std::function<void()> settlement_hook_;
+  // Accounts with a deferred class update. Each account appears at most once;
+  // the shared_ptr keeps queued accounts alive until the settlement pass runs.
+  std::vector<BufferMemoryAccountSharedPtr> pending_account_settlements_;
 };
 
 } // namespace Buffer
@@ -77,10 +77,11 @@ CompiledGoogleReMatcher::CompiledGoogleReMatcher(
     const envoy::type::matcher::v3::RegexMatcher& config, absl::Status& creation_status)
     : CompiledGoogleReMatcher(config.regex(), creation_status,
                               !config.google_re2().has_max_program_size()) {
-  const uint32_t regex_program_size = static_cast<uint32_t>(regex_.ProgramSize());
-
   // Check if the deprecated field max_program_size is set first, and follow the old logic if so.
+  // ProgramSize() walks the compiled program, so only pay for it when the field is present; the
+  // runtime based checks in the delegated constructor already computed it for the common case.
   if (config.google_re2().has_max_program_size()) {
+    const uint32_t regex_program_size = static_cast<uint32_t>(regex_.ProgramSize());
     const uint32_t max_program_size =
         PROTOBUF_GET_WRAPPED_OR_DEFAULT(config.google_re2(), max_program_size, 100);
     if (regex_program_size > max_program_size) {
@@ -110,6 +110,12 @@ std::string DateFormatter::fromTime(SystemTime time) const {
   const auto& formatted = iter->second;
   ASSERT(specifiers_.size() == formatted.offsets.size());
 
+  // Formats without subseconds specifiers are fully determined by the epoch second; return the
+  // cached string without walking the specifiers.
+  if (!has_subseconds_) {
+    return formatted.formatted;
+  }
+
   // Copy the current cached formatted format string, then replace its subseconds specifier
   // (when it has non-zero width) by correcting its position using prepared subseconds offsets.
   std::string formatted_str = formatted.formatted;
@@ -199,6 +205,7 @@ void DateFormatter::parse(absl::string_view format_string) {
     ASSERT(format.size() >= prefix_length + matched.size());
     ASSERT(specifier != Specifier::SpecifierType::String);
     specifiers_.emplace_back(Specifier(specifier, width));
+    has_subseconds_ = has_subseconds_ || specifiers_.back().subsecondsSpecifier();
     format = format.substr(prefix_length + matched.size());
   }
 
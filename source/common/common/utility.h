@@ -165,6 +165,10 @@ private:
 
   // This holds all specifiers found in a given format string.
   std::vector<Specifier> specifiers_;
+
+  // True if any of the specifiers is a subseconds specifier. Formats without subseconds are
+  // fully determined by the epoch second and can be served straight from the cache.
+  bool has_subseconds_{};
 };
 
 /**
@@ -9,9 +9,19 @@ namespace Compressor {
 
 ZstdCompressorImplBase::ZstdCompressorImplBase(uint32_t compression_level, bool enable_checksum,
                                                uint32_t strategy, uint32_t chunk_size)
-    : Common::Base(chunk_size), cctx_(ZSTD_createCCtx(), &ZSTD_freeCCtx),
-      compression_level_(compression_level) {
-  size_t result;
+    : ZstdCompressorImplBase(CCtxPtr{ZSTD_createCCtx(), &ZSTD_freeCCtx}, compression_level,
+                             enable_checksum, strategy, chunk_size) {}
+
+ZstdCompressorImplBase::ZstdCompressorImplBase(CCtxPtr cctx, uint32_t compression_level,
+                                               bool enable_checksum, uint32_t strategy,
+                                               uint32_t chunk_size)
+    : Common::Base(chunk_size), cctx_(std::move(cctx)), compression_level_(compression_level) {
+  // A recycled context may still reference the session and parameters (including a dictionary)
+  // of a previous stream; reset both before applying ours. The reset keeps the context's
+  // internal workspace allocations, which is the point of reusing it.
+  size_t result = ZSTD_CCtx_reset(cctx_.get(), ZSTD_reset_session_and_parameters);
+  RELEASE_ASSERT(!ZSTD_isError(result), "");
+
   result = ZSTD_CCtx_setParameter(cctx_.get(), ZSTD_c_checksumFlag, enable_checksum);
   RELEASE_ASSERT(!ZSTD_isError(result), "");
 
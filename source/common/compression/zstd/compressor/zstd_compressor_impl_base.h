@@ -9,6 +9,8 @@ namespace Compression {
 namespace Zstd {
 namespace Compressor {
 
+using CCtxPtr = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>;
+
 /**
  * Implementation of compressor's interface.
  */
@@ -19,6 +21,12 @@ public:
   ZstdCompressorImplBase(uint32_t compression_level, bool enable_checksum, uint32_t strategy,
                          uint32_t chunk_size);
 
+  // Builds the compressor on top of an existing context, e.g. one recycled from a pool. The
+  // context is reset before any parameters are applied, so it may carry state from a previous
+  // stream.
+  ZstdCompressorImplBase(CCtxPtr cctx, uint32_t compression_level, bool enable_checksum,
+                         uint32_t strategy, uint32_t chunk_size);
+
   // Compression::Compressor::Compressor
   void compress(Buffer::Instance& buffer, Envoy::Compression::Compressor::State state) override;
 
@@ -33,7 +41,7 @@ protected:
 
   virtual void compressPostprocess(Buffer::Instance& accumulation_buffer) PURE;
 
-  std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> cctx_;
+  CCtxPtr cctx_;
   const uint32_t compression_level_;
 };
 
@@ -5,12 +5,25 @@
 #include "envoy/service/discovery/v3/discovery.pb.h"
 
 #include "source/common/protobuf/utility.h"
+#include "source/common/runtime/runtime_features.h"
 
 #include "xds/core/v3/collection_entry.pb.h"
 
 namespace Envoy {
 namespace Config {
 
+/**
+ * Creates the arena shared by all resources decoded from one discovery response, so that the
+ * decoded messages are block-allocated together and released wholesale once the update has been
+ * processed (and no subscriber holds on to a resource). Returns nullptr when arena decoding is
+ * disabled via runtime, in which case resources are decoded onto the heap as before.
+ */
+inline std::shared_ptr<Protobuf::Arena> maybeCreateResourceDecodingArena() {
+  return Runtime::runtimeFeatureEnabled("envoy.reloadable_features.xds_arena_resource_decoding")
+             ? std::make_shared<Protobuf::Arena>()
+             : nullptr;
+}
+
 namespace {
 
 std::vector<std::string>
@@ -29,51 +42,56 @@ class DecodedResourceImpl : public DecodedResource {
 public:
   static absl::StatusOr<DecodedResourceImplPtr>
   fromResource(OpaqueResourceDecoder& resource_decoder, const ProtobufWkt::Any& resource,
-               const std::string& version) {
+               const std::string& version,
+               const std::shared_ptr<Protobuf::Arena>& arena = nullptr) {
     if (resource.Is<envoy::service::discovery::v3::Resource>()) {
       envoy::service::discovery::v3::Resource r;
       RETURN_IF_NOT_OK(MessageUtil::unpackTo(resource, r));
 
       r.set_version(version);
 
-      return std::make_unique<DecodedResourceImpl>(resource_decoder, r);
+      return std::make_unique<DecodedResourceImpl>(resource_decoder, r, arena);
     }
 
     return std::unique_ptr<DecodedResourceImpl>(new DecodedResourceImpl(
         resource_decoder, absl::nullopt, Protobuf::RepeatedPtrField<std::string>(), resource, true,
-        version, absl::nullopt, absl::nullopt));
+        version, absl::nullopt, absl::nullopt, arena));
   }
 
   static DecodedResourceImplPtr
   fromResource(OpaqueResourceDecoder& resource_decoder,
-               const envoy::service::discovery::v3::Resource& resource) {
-    return std::make_unique<DecodedResourceImpl>(resource_decoder, resource);
+               const envoy::service::discovery::v3::Resource& resource,
+               const std::shared_ptr<Protobuf::Arena>& arena = nullptr) {
+    return std::make_unique<DecodedResourceImpl>(resource_decoder, resource, arena);
   }
 
   DecodedResourceImpl(OpaqueResourceDecoder& resource_decoder,
-                      const envoy::service::discovery::v3::Resource& resource)
+                      const envoy::service::discovery::v3::Resource& resource,
+                      const std::shared_ptr<Protobuf::Arena>& arena = nullptr)
       : DecodedResourceImpl(
             resource_decoder, resource.name(), resource.aliases(), resource.resource(),
             resource.has_resource(), resource.version(),
             resource.has_ttl() ? absl::make_optional(std::chrono::milliseconds(
                                      DurationUtil::durationToMilliseconds(resource.ttl())))
                                : absl::nullopt,
-            resource.has_metadata() ? absl::make_optional(resource.metadata()) : absl::nullopt) {}
+            resource.has_metadata() ? absl::make_optional(resource.metadata()) : absl::nullopt,
+            arena) {}
   DecodedResourceImpl(OpaqueResourceDecoder& resource_decoder,
                       const xds::core::v3::CollectionEntry::InlineEntry& inline_entry)
       : DecodedResourceImpl(resource_decoder, inline_entry.name(),
                             Protobuf::RepeatedPtrField<std::string>(), inline_entry.resource(),
-                            true, inline_entry.version(), absl::nullopt, absl::nullopt) {}
+                            true, inline_entry.version(), absl::nullopt, absl::nullopt, nullptr) {}
   DecodedResourceImpl(ProtobufTypes::MessagePtr resource, const std::string& name,
                       const std::vector<std::string>& aliases, const std::string& version)
-      : resource_(std::move(resource)), has_resource_(true), name_(name), aliases_(aliases),
-        version_(version), ttl_(absl::nullopt), metadata_(absl::nullopt) {}
+      : resource_(std::move(resource)), resource_view_(resource_.get()), has_resource_(true),
+        name_(name), aliases_(aliases), version_(version), ttl_(absl::nullopt),
+        metadata_(absl::nullopt) {}
 
   // Config::DecodedResource
   const std::string& name() const override { return name_; }
   const std::vector<std::string>& aliases() const override { return aliases_; }
   const std::string& version() const override { return version_; };
-  const Protobuf::Message& resource() const override { return *resource_; };
+  const Protobuf::Message& resource() const override { return *resource_view_; };
   bool hasResource() const override { return has_resource_; }
   absl::optional<std::chrono::milliseconds> ttl() const override { return ttl_; }
   const OptRef<const envoy::config::core::v3::Metadata> metadata() const override {
@@ -85,15 +103,31 @@ private:
                       const Protobuf::RepeatedPtrField<std::string>& aliases,
                       const ProtobufWkt::Any& resource, bool has_resource,
                       const std::string& version, absl::optional<std::chrono::milliseconds> ttl,
-                      const absl::optional<envoy::config::core::v3::Metadata>& metadata)
-      : resource_(resource_decoder.decodeResource(resource)), has_resource_(has_resource),
-        name_(name ? *name : resource_decoder.resourceName(*resource_)),
-        aliases_(repeatedPtrFieldToVector(aliases)), version_(version), ttl_(ttl),
-        metadata_(metadata) {}
+                      const absl::optional<envoy::config::core::v3::Metadata>& metadata,
+                      const std::shared_ptr<Protobuf::Arena>& arena)
+      : has_resource_(has_resource), aliases_(repeatedPtrFieldToVector(aliases)),
+        version_(version), ttl_(ttl), metadata_(metadata) {
+    if (arena != nullptr) {
+      resource_view_ = resource_decoder.decodeResourceWithArena(resource, *arena);
+    }
+    if (resource_view_ != nullptr) {
+      arena_ = arena;
+    } else {
+      // Either no arena was supplied or the decoder does not support arena allocation.
+      resource_ = resource_decoder.decodeResource(resource);
+      resource_view_ = resource_.get();
+    }
+    name_ = name ? *name : resource_decoder.resourceName(*resource_view_);
+  }
 
-  const ProtobufTypes::MessagePtr resource_;
+  // When the resource was decoded onto an arena shared by all resources of one discovery
+  // response, keeps that arena (and thus the decoded message) alive for as long as this resource
+  // is referenced; resource_ is then null.
+  std::shared_ptr<Protobuf::Arena> arena_;
+  ProtobufTypes::MessagePtr resource_;
+  const Protobuf::Message* resource_view_{nullptr};
   const bool has_resource_;
-  const std::string name_;
+  std::string name_;
   const std::vector<std::string> aliases_;
   const std::string version_;
   // Per resource TTL.
@@ -108,12 +142,12 @@ struct DecodedResourcesWrapper {
   DecodedResourcesWrapper() = default;
   static absl::StatusOr<std::unique_ptr<DecodedResourcesWrapper>>
   create(OpaqueResourceDecoder& resource_decoder,
-         const Protobuf::RepeatedPtrField<ProtobufWkt::Any>& resources,
-         const std::string& version) {
+         const Protobuf::RepeatedPtrField<ProtobufWkt::Any>& resources, const std::string& version,
+         const std::shared_ptr<Protobuf::Arena>& arena = nullptr) {
     std::unique_ptr<DecodedResourcesWrapper> ret = std::make_unique<DecodedResourcesWrapper>();
     for (const auto& resource : resources) {
       absl::StatusOr<DecodedResourceImplPtr> resource_or_error =
-          DecodedResourceImpl::fromResource(resource_decoder, resource, version);
+          DecodedResourceImpl::fromResource(resource_decoder, resource, version, arena);
       RETURN_IF_NOT_OK_REF(resource_or_error.status());
       ret->pushBack(std::move(resource_or_error.value()));
     }
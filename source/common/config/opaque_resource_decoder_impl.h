@@ -24,6 +24,17 @@ public:
     return typed_message;
   }
 
+  Protobuf::Message* decodeResourceWithArena(const ProtobufWkt::Any& resource,
+                                             Protobuf::Arena& arena) override {
+    auto* typed_message = Protobuf::Arena::Create<Current>(&arena);
+    // If the Any is a synthetic empty message (e.g. because the resource field was not set in
+    // Resource, this might be empty, so we shouldn't decode.
+    if (!resource.type_url().empty()) {
+      MessageUtil::anyConvertAndValidate<Current>(resource, *typed_message, validation_visitor_);
+    }
+    return typed_message;
+  }
+
   std::string resourceName(const Protobuf::Message& resource) override {
     return MessageUtil::getStringField(resource, name_field_);
   }
@@ -166,10 +166,13 @@ TagNameValues::TagNameValues() {
   // listener_manager.(worker_<id>.)*
   // server.(worker_<id>.)*
   // thread_local_cluster_manager.(worker_<id>.)*
+  // The leading alternation prevents deriving a prefix token for this extractor, so it would
+  // otherwise run against every stat name; the ".worker_" substring prefilter lets the common
+  // case skip the regex entirely.
   addRe2(
       WORKER_ID,
       R"(^(?:listener\.(?:<ADDRESS>|<TAG_VALUE>)|server|listener_manager|thread_local_cluster_manager)\.worker_((\d+)\.))",
-      "");
+      ".worker_");
 
   // listener.(<address|stat_prefix>.)*, but specifically excluding "admin"
   addRe2(LISTENER_ADDRESS, R"(^listener\.((<ADDRESS>|<TAG_VALUE>)\.))", "", "admin");
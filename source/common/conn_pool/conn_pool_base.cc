@@ -10,6 +10,11 @@
 namespace Envoy {
 namespace ConnectionPool {
 namespace {
+// Smoothing factor for the EWMAs feeding adaptive preconnect. Weighting each new sample
+// at a quarter tracks a traffic ramp within a handful of requests while damping one-off
+// outliers such as a single slow handshake.
+constexpr double kPreconnectEwmaAlpha = 0.25;
+
 [[maybe_unused]] ssize_t connectingCapacity(const std::list<ActiveClientPtr>& connecting_clients) {
   ssize_t ret = 0;
   for (const auto& client : connecting_clients) {
@@ -103,7 +108,41 @@ bool ConnPoolImplBase::shouldCreateNewConnection(float global_preconnect_ratio)
 }
 
 float ConnPoolImplBase::perUpstreamPreconnectRatio() const {
-  return host_->cluster().perUpstreamPreconnectRatio();
+  const float configured_ratio = host_->cluster().perUpstreamPreconnectRatio();
+  if (configured_ratio <= 1.0 ||
+      !Runtime::runtimeFeatureEnabled(
+          "envoy.reloadable_features.conn_pool_adaptive_preconnect")) {
+    return configured_ratio;
+  }
+  if (stream_interarrival_ms_ewma_ == 0 || connect_latency_ms_ewma_ == 0) {
+    // Not enough samples yet to predict demand, so preconnect at the configured ratio.
+    return configured_ratio;
+  }
+  // By Little's law, the number of streams expected to arrive while a new connection
+  // performs its handshake is the stream arrival rate times the establishment latency.
+  // Provision for exactly that many anticipated streams on top of the current load,
+  // with the configured ratio as an upper bound so a traffic spike can never preconnect
+  // more aggressively than configured.
+  const double anticipated_streams = connect_latency_ms_ewma_ / stream_interarrival_ms_ewma_;
+  const double current_streams = pending_streams_.size() + num_active_streams_ + 1;
+  return static_cast<float>(
+      std::min<double>(configured_ratio, 1.0 + anticipated_streams / current_streams));
+}
+
+void ConnPoolImplBase::recordStreamArrival() {
+  const MonotonicTime now = dispatcher_.timeSource().monotonicTime();
+  if (last_stream_arrival_ != MonotonicTime()) {
+    // Clamp to a small floor so that bursts arriving within the same event loop
+    // iteration keep the EWMA strictly positive (zero means "no sample yet").
+    const double interarrival_ms = std::max(
+        std::chrono::duration<double, std::milli>(now - last_stream_arrival_).count(), 0.01);
+    stream_interarrival_ms_ewma_ =
+        stream_interarrival_ms_ewma_ == 0
+            ? interarrival_ms
+            : (1 - kPreconnectEwmaAlpha) * stream_interarrival_ms_ewma_ +
+                  kPreconnectEwmaAlpha * interarrival_ms;
+  }
+  last_stream_arrival_ = now;
 }
 
 ConnPoolImplBase::ConnectionResult ConnPoolImplBase::tryCreateNewConnections() {
@@ -260,6 +299,9 @@ ConnectionPool::Cancellable* ConnPoolImplBase::newStreamImpl(AttachContext& cont
   ASSERT(static_cast<ssize_t>(connecting_stream_capacity_) ==
          connectingCapacity(connecting_clients_) +
              connectingCapacity(early_data_clients_)); // O(n) debug check.
+
+  recordStreamArrival();
+
   if (!ready_clients_.empty()) {
     ActiveClient& client = *ready_clients_.front();
     ENVOY_CONN_LOG(debug, "using existing fully connected connection", client);
@@ -575,6 +617,14 @@ void ConnPoolImplBase::onConnectionEvent(ActiveClient& client, absl::string_view
     ASSERT(connecting_stream_capacity_ >= client.currentUnusedCapacity());
     connecting_stream_capacity_ -= client.currentUnusedCapacity();
     client.has_handshake_completed_ = true;
+    // Fold the handshake latency into the adaptive preconnect model before the
+    // timespan is handed off to the stats sink. Sub-millisecond handshakes are
+    // rounded up so the EWMA stays strictly positive (zero means "no sample yet").
+    const double connect_ms = std::max<double>(client.conn_connect_ms_->elapsed().count(), 1.0);
+    connect_latency_ms_ewma_ = connect_latency_ms_ewma_ == 0
+                                   ? connect_ms
+                                   : (1 - kPreconnectEwmaAlpha) * connect_latency_ms_ewma_ +
+                                         kPreconnectEwmaAlpha * connect_ms;
     client.conn_connect_ms_->complete();
     client.conn_connect_ms_.reset();
     if (client.state() == ActiveClient::State::Connecting ||
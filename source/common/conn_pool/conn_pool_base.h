@@ -343,6 +343,15 @@ protected:
   // connection preconnect.
   bool shouldCreateNewConnection(float global_preconnect_ratio) const;
 
+  // Returns the preconnect ratio to use for local (per-pool) preconnecting.
+  //
+  // If the cluster configures a per-upstream preconnect ratio greater than one, the
+  // configured value is treated as an upper bound and the effective ratio is derived
+  // from the observed stream arrival rate and connection establishment latency: by
+  // Little's law, arrival rate times establishment latency is the number of streams
+  // expected to show up while a new connection performs its handshake, so the pool
+  // only holds spare capacity it is actually likely to use. Until both signals have
+  // been sampled the configured ratio is used as-is.
   float perUpstreamPreconnectRatio() const;
 
   ConnectionPool::Cancellable*
@@ -396,8 +405,18 @@ private:
   // Prerequisite: the given clients shouldn't be idle.
   void drainClients(std::list<ActiveClientPtr>& clients);
 
+  // Folds the current time into the stream inter-arrival EWMA. Called once per
+  // newStreamImpl() to feed the adaptive preconnect model.
+  void recordStreamArrival();
+
   std::list<PendingStreamPtr> pending_streams_;
 
+  // State for the adaptive preconnect model, see perUpstreamPreconnectRatio().
+  // Both EWMAs are in milliseconds; zero means no sample has been recorded yet.
+  MonotonicTime last_stream_arrival_{};
+  double stream_interarrival_ms_ewma_{0};
+  double connect_latency_ms_ewma_{0};
+
   // The number of streams currently attached to clients.
   uint32_t num_active_streams_{0};
 
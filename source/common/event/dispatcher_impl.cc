@@ -60,7 +60,9 @@ DispatcherImpl::DispatcherImpl(const std::string& name, Api::Api& api,
                      watermark_factory != nullptr
                          ? watermark_factory
                          : std::make_shared<Buffer::WatermarkBufferFactory>(
-                               api.bootstrap().overload_manager().buffer_factory_config())) {}
+                               api.bootstrap().overload_manager().buffer_factory_config())) {
+  deferred_delete_batch_size_ = api.bootstrap().dispatcher_deferred_delete_batch_size();
+}
 
 DispatcherImpl::DispatcherImpl(const std::string& name, Thread::ThreadFactory& thread_factory,
                                TimeSource& time_source, Filesystem::Instance& file_system,
@@ -86,11 +88,25 @@ DispatcherImpl::DispatcherImpl(const std::string& name, Thread::ThreadFactory& t
     base_scheduler_.registerOnPrepareCallback(
         std::bind(&DispatcherImpl::updateApproximateMonotonicTime, this));
   }
+  if (Runtime::runtimeFeatureEnabled("envoy.reloadable_features.batch_buffer_account_updates")) {
+    account_settlement_cb_ = base_scheduler_.createSchedulableCallback(
+        [this]() -> void { buffer_factory_->settleAccountUpdates(); });
+    buffer_factory_->setAccountSettlementHook([this]() -> void {
+      if (!account_settlement_cb_->enabled()) {
+        account_settlement_cb_->scheduleCallbackCurrentIteration();
+      }
+    });
+  }
 }
 
 DispatcherImpl::~DispatcherImpl() {
   ENVOY_LOG(debug, "destroying dispatcher {}", name_);
   FatalErrorHandler::removeFatalErrorHandler(*this);
+  if (account_settlement_cb_ != nullptr) {
+    // The buffer factory may outlive this dispatcher; drop the hook so it falls
+    // back to synchronous account updates.
+    buffer_factory_->setAccountSettlementHook(nullptr);
+  }
   // TODO(lambdai): Resolve https://github.com/envoyproxy/envoy/issues/15072 and enable
   // ASSERT(deletable_in_dispatcher_thread_.empty())
 }
@@ -117,35 +133,56 @@ void DispatcherImpl::initializeStats(Stats::Scope& scope,
 
 void DispatcherImpl::clearDeferredDeleteList() {
   ASSERT(isThreadSafe());
-  std::vector<DeferredDeletablePtr>* to_delete = current_to_delete_;
-
-  size_t num_to_delete = to_delete->size();
-  if (deferred_deleting_ || !num_to_delete) {
+  if (deferred_deleting_) {
     return;
   }
 
-  ENVOY_LOG(trace, "clearing deferred deletion list (size={})", num_to_delete);
-
-  // Swap the current deletion vector so that if we do deferred delete while we are deleting, we
-  // use the other vector. We will get another callback to delete that vector.
-  if (current_to_delete_ == &to_delete_1_) {
-    current_to_delete_ = &to_delete_2_;
-  } else {
-    current_to_delete_ = &to_delete_1_;
+  // Unless a budgeted drain is already in progress, swap the current deletion vector so that if
+  // we do deferred delete while we are deleting, we use the other vector. We will get another
+  // callback to delete that vector.
+  if (draining_to_delete_ == nullptr) {
+    if (current_to_delete_->empty()) {
+      return;
+    }
+    draining_to_delete_ = current_to_delete_;
+    next_to_delete_index_ = 0;
+    if (current_to_delete_ == &to_delete_1_) {
+      current_to_delete_ = &to_delete_2_;
+    } else {
+      current_to_delete_ = &to_delete_1_;
+    }
+    ENVOY_LOG(trace, "clearing deferred deletion list (size={})", draining_to_delete_->size());
   }
 
   touchWatchdog();
   deferred_deleting_ = true;
 
   // Calling clear() on the vector does not specify which order destructors run in. We want to
-  // destroy in FIFO order so just do it manually. This required 2 passes over the vector which is
-  // not optimal but can be cleaned up later if needed.
-  for (size_t i = 0; i < num_to_delete; i++) {
-    (*to_delete)[i].reset();
+  // destroy in FIFO order so just do it manually. When a batch size is configured, destroy at
+  // most that many objects and repost, so a connection-storm teardown cannot block the event
+  // loop for a full drain.
+  const size_t stop_index =
+      deferred_delete_batch_size_ == 0
+          ? draining_to_delete_->size()
+          : std::min(draining_to_delete_->size(), next_to_delete_index_ + deferred_delete_batch_size_);
+  for (; next_to_delete_index_ < stop_index; next_to_delete_index_++) {
+    (*draining_to_delete_)[next_to_delete_index_].reset();
   }
 
-  to_delete->clear();
   deferred_deleting_ = false;
+
+  if (next_to_delete_index_ == draining_to_delete_->size()) {
+    draining_to_delete_->clear();
+    draining_to_delete_ = nullptr;
+    // Objects deferred while this drain was in progress may have armed the callback for an
+    // iteration that this pass already consumed; re-arm so they are not stranded.
+    if (!current_to_delete_->empty()) {
+      deferred_delete_cb_->scheduleCallbackNextIteration();
+    }
+  } else {
+    // Let I/O events interleave before destroying the next batch.
+    deferred_delete_cb_->scheduleCallbackNextIteration();
+  }
 }
 
 Network::ServerConnectionPtr
@@ -18,6 +18,7 @@
 #include "source/common/common/thread.h"
 #include "source/common/event/libevent.h"
 #include "source/common/event/libevent_scheduler.h"
+#include "source/common/event/loop_liveness_registry.h"
 #include "source/common/signal/fatal_error_handler.h"
 
 #include "absl/container/inlined_vector.h"
@@ -62,6 +63,9 @@ public:
   TimeSource& timeSource() override { return time_source_; }
   void initializeStats(Stats::Scope& scope, const absl::optional<std::string>& prefix) override;
   void clearDeferredDeleteList() override;
+  void setDeferredDeleteBatchSizeForTest(uint32_t batch_size) {
+    deferred_delete_batch_size_ = batch_size;
+  }
   Network::ServerConnectionPtr
   createServerConnection(Network::ConnectionSocketPtr&& socket,
                          Network::TransportSocketPtr&& transport_socket,
@@ -106,21 +110,31 @@ private:
   public:
     WatchdogRegistration(const Server::WatchDogSharedPtr& watchdog, Scheduler& scheduler,
                          std::chrono::milliseconds timer_interval, Dispatcher& dispatcher)
-        : watchdog_(watchdog), timer_interval_(timer_interval) {
+        : watchdog_(watchdog), timer_interval_(timer_interval), dispatcher_(dispatcher),
+          liveness_slot_(LoopLivenessRegistry::instance().add(
+              dispatcher.name(), dispatcher.approximateMonotonicTime())) {
       touch_timer_ = scheduler.createTimer(
           [this]() -> void {
-            watchdog_->touch();
+            touchWatchdog();
             touch_timer_->enableTimer(timer_interval_);
           },
           dispatcher);
       touch_timer_->enableTimer(timer_interval_);
     }
 
-    void touchWatchdog() { watchdog_->touch(); }
+    void touchWatchdog() {
+      watchdog_->touch();
+      // Touches happen at least once per loop iteration while the loop is responsive, so the
+      // recorded liveness timestamps age only when this loop is saturated or stalled. The worker
+      // saturation resource monitor turns that age into overload pressure.
+      liveness_slot_->record(dispatcher_.approximateMonotonicTime());
+    }
 
   private:
     Server::WatchDogSharedPtr watchdog_;
     const std::chrono::milliseconds timer_interval_;
+    Dispatcher& dispatcher_;
+    LoopLivenessRegistry::SlotPtr liveness_slot_;
     TimerPtr touch_timer_;
   };
   using WatchdogRegistrationPtr = std::unique_ptr<WatchdogRegistration>;
@@ -160,6 +174,11 @@ private:
 
   SchedulableCallbackPtr deferred_delete_cb_;
 
+  // Runs the buffer factory's deferred account settlement at the end of an
+  // iteration in which the factory requested one. Only created when batched
+  // buffer account updates are enabled.
+  SchedulableCallbackPtr account_settlement_cb_;
+
   SchedulableCallbackPtr post_cb_;
   Thread::MutexBasicLockable post_lock_;
   std::list<PostCb> post_callbacks_ ABSL_GUARDED_BY(post_lock_);
@@ -167,6 +186,13 @@ private:
   std::vector<DeferredDeletablePtr> to_delete_1_;
   std::vector<DeferredDeletablePtr> to_delete_2_;
   std::vector<DeferredDeletablePtr>* current_to_delete_;
+  // Non-null while a budgeted drain of the inactive vector is in progress;
+  // next_to_delete_index_ is the resume position within it.
+  std::vector<DeferredDeletablePtr>* draining_to_delete_{nullptr};
+  size_t next_to_delete_index_{0};
+  // Maximum objects destroyed per clearDeferredDeleteList() pass; 0 means unlimited. Populated
+  // from bootstrap dispatcher_deferred_delete_batch_size when constructed through the Api path.
+  uint32_t deferred_delete_batch_size_{0};
 
   absl::InlinedVector<const ScopeTrackedObject*, ExpectedMaxTrackedObjectStackDepth>
       tracked_object_stack_;
@@ -0,0 +1,65 @@
+#include "source/common/event/loop_liveness_registry.h"
+
+#include <algorithm>
+
+#include "source/common/common/macros.h"
+
+namespace Envoy {
+namespace Event {
+
+LoopLivenessRegistry::Slot::~Slot() { registry_.remove(*this); }
+
+LoopLivenessRegistry& LoopLivenessRegistry::instance() {
+  MUTABLE_CONSTRUCT_ON_FIRST_USE(LoopLivenessRegistry);
+}
+
+LoopLivenessRegistry::SlotPtr LoopLivenessRegistry::add(absl::string_view name,
+                                                        MonotonicTime now) {
+  SlotPtr slot{new Slot(*this, name)};
+  slot->record(now);
+  absl::MutexLock lock(&mutex_);
+  slots_.push_back(slot.get());
+  return slot;
+}
+
+absl::optional<MonotonicTime::duration>
+LoopLivenessRegistry::maxTimeSinceLastActivity(MonotonicTime now) const {
+  absl::MutexLock lock(&mutex_);
+  if (slots_.empty()) {
+    return absl::nullopt;
+  }
+  MonotonicTime::duration max_delay = MonotonicTime::duration::zero();
+  for (const Slot* slot : slots_) {
+    const MonotonicTime last_activity{
+        MonotonicTime::duration(slot->last_activity_.load(std::memory_order_relaxed))};
+    // A loop may record activity after the caller sampled its notion of now; treat such slots as
+    // fully caught up rather than reporting a negative delay.
+    max_delay = std::max(max_delay, std::max(now - last_activity, MonotonicTime::duration::zero()));
+  }
+  return max_delay;
+}
+
+absl::optional<MonotonicTime::duration>
+LoopLivenessRegistry::timeSinceLastActivity(absl::string_view name, MonotonicTime now) const {
+  absl::MutexLock lock(&mutex_);
+  absl::optional<MonotonicTime::duration> delay;
+  for (const Slot* slot : slots_) {
+    if (slot->name_ != name) {
+      continue;
+    }
+    const MonotonicTime last_activity{
+        MonotonicTime::duration(slot->last_activity_.load(std::memory_order_relaxed))};
+    const MonotonicTime::duration slot_delay =
+        std::max(now - last_activity, MonotonicTime::duration::zero());
+    delay = std::max(delay.value_or(MonotonicTime::duration::zero()), slot_delay);
+  }
+  return delay;
+}
+
+void LoopLivenessRegistry::remove(Slot& slot) {
+  absl::MutexLock lock(&mutex_);
+  slots_.erase(std::remove(slots_.begin(), slots_.end(), &slot), slots_.end());
+}
+
+} // namespace Event
+} // namespace Envoy
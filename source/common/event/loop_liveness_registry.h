@@ -0,0 +1,89 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "envoy/common/time.h"
+
+#include "absl/base/thread_annotations.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/types/optional.h"
+
+namespace Envoy {
+namespace Event {
+
+/**
+ * Process-wide registry of the last time each watchdog-registered dispatcher's event loop showed
+ * signs of life. A dispatcher records a timestamp into its slot whenever it touches its watchdog,
+ * which happens at least once per event loop iteration while the loop is responsive, so the
+ * recorded timestamps age only while a loop is saturated or stalled. The worker saturation
+ * resource monitor reads the registry from the main thread to derive a graduated event-loop delay
+ * signal for the overload manager.
+ *
+ * Recording is a single relaxed atomic store, making it cheap enough for the touch path of every
+ * dispatcher.
+ */
+class LoopLivenessRegistry {
+public:
+  /**
+   * Membership handle held by a dispatcher; deregisters itself on destruction.
+   */
+  class Slot {
+  public:
+    ~Slot();
+
+    /**
+     * Records that the owning event loop was responsive at time now.
+     */
+    void record(MonotonicTime now) {
+      last_activity_.store(now.time_since_epoch().count(), std::memory_order_relaxed);
+    }
+
+  private:
+    friend class LoopLivenessRegistry;
+    Slot(LoopLivenessRegistry& registry, absl::string_view name)
+        : registry_(registry), name_(name) {}
+
+    LoopLivenessRegistry& registry_;
+    const std::string name_;
+    std::atomic<MonotonicTime::duration::rep> last_activity_{};
+  };
+  using SlotPtr = std::unique_ptr<Slot>;
+
+  /**
+   * @return the process-wide registry.
+   */
+  static LoopLivenessRegistry& instance();
+
+  /**
+   * Registers an event loop under the owning dispatcher's name, with its last activity
+   * initialized to now.
+   */
+  SlotPtr add(absl::string_view name, MonotonicTime now);
+
+  /**
+   * @return the longest duration since any registered loop recorded activity, or nullopt when no
+   * loops are registered. Timestamps recorded after the caller sampled now are reported as zero.
+   */
+  absl::optional<MonotonicTime::duration> maxTimeSinceLastActivity(MonotonicTime now) const;
+
+  /**
+   * @return the duration since the loop registered under name recorded activity, or nullopt when
+   * no such loop is registered. Timestamps recorded after the caller sampled now are reported as
+   * zero.
+   */
+  absl::optional<MonotonicTime::duration> timeSinceLastActivity(absl::string_view name,
+                                                                MonotonicTime now) const;
+
+private:
+  void remove(Slot& slot);
+
+  mutable absl::Mutex mutex_;
+  std::vector<Slot*> slots_ ABSL_GUARDED_BY(mutex_);
+};
+
+} // namespace Event
+} // namespace Envoy
@@ -33,8 +33,7 @@ namespace Event {
 class ScaledRangeTimerManagerImpl::RangeTimerImpl final : public Timer {
 public:
   RangeTimerImpl(ScaledTimerMinimum minimum, TimerCb callback, ScaledRangeTimerManagerImpl& manager)
-      : minimum_(minimum), manager_(manager), callback_(std::move(callback)),
-        min_duration_timer_(manager.dispatcher_.createTimer([this] { onMinTimerComplete(); })) {}
+      : minimum_(minimum), manager_(manager), callback_(std::move(callback)) {}
 
   ~RangeTimerImpl() override { disableTimer(); }
 
@@ -43,7 +42,9 @@ public:
       Dispatch(RangeTimerImpl& timer) : timer_(timer) {}
       RangeTimerImpl& timer_;
       void operator()(const Inactive&) {}
-      void operator()(const WaitingForMin&) { timer_.min_duration_timer_->disableTimer(); }
+      void operator()(const WaitingForMin& waiting) {
+        timer_.manager_.removeTimer(waiting.handle_);
+      }
       void operator()(ScalingMax& active) { timer_.manager_.removeTimer(active.handle_); }
     };
     absl::visit(Dispatch(*this), state_);
@@ -61,11 +62,11 @@ public:
     if (min_ms <= std::chrono::milliseconds::zero()) {
       // If the duration spread (max - min) is zero, skip over the waiting-for-min and straight to
       // the scaling-max state.
-      auto handle = manager_.activateTimer(max_ms, *this);
+      auto handle = manager_.activateTimer(max_ms, Queue::Purpose::ScalingMax, *this);
       state_.emplace<ScalingMax>(handle);
     } else {
-      state_.emplace<WaitingForMin>(max_ms - min_ms);
-      min_duration_timer_->enableTimer(std::min(max_ms, min_ms));
+      auto handle = manager_.activateTimer(min_ms, Queue::Purpose::WaitForMin, *this);
+      state_.emplace<WaitingForMin>(max_ms - min_ms, handle);
     }
   }
 
@@ -90,16 +91,39 @@ public:
     }
   }
 
+  /**
+   * This is called by the manager when the min duration expires, on the dispatcher for the
+   * manager. It registers with the manager so the duration can be scaled, unless the duration is
+   * zero in which case it just triggers the callback right away.
+   */
+  void onMinTimerComplete() {
+    ASSERT(manager_.dispatcher_.isThreadSafe());
+    ENVOY_LOG_MISC(trace, "min timer complete for {}", static_cast<void*>(this));
+    ASSERT(absl::holds_alternative<WaitingForMin>(state_));
+    const WaitingForMin& waiting = absl::get<WaitingForMin>(state_);
+
+    if (waiting.scalable_duration_ < std::chrono::milliseconds::zero()) {
+      trigger();
+    } else {
+      state_.emplace<ScalingMax>(
+          manager_.activateTimer(waiting.scalable_duration_, Queue::Purpose::ScalingMax, *this));
+    }
+  }
+
 private:
   struct Inactive {};
 
   struct WaitingForMin {
-    WaitingForMin(std::chrono::milliseconds scalable_duration)
-        : scalable_duration_(scalable_duration) {}
+    WaitingForMin(std::chrono::milliseconds scalable_duration,
+                  ScaledRangeTimerManagerImpl::ScalingTimerHandle handle)
+        : scalable_duration_(scalable_duration), handle_(handle) {}
 
     // The amount of time between this enabled timer's max and min, which should
     // be scaled by the current scale factor.
     const std::chrono::milliseconds scalable_duration_;
+
+    // A handle that can be used to disable the timer.
+    ScaledRangeTimerManagerImpl::ScalingTimerHandle handle_;
   };
 
   struct ScalingMax {
@@ -109,29 +133,9 @@ private:
     ScaledRangeTimerManagerImpl::ScalingTimerHandle handle_;
   };
 
-  /**
-   * This is called when the min timer expires, on the dispatcher for the manager. It registers with
-   * the manager so the duration can be scaled, unless the duration is zero in which case it just
-   * triggers the callback right away.
-   */
-  void onMinTimerComplete() {
-    ASSERT(manager_.dispatcher_.isThreadSafe());
-    ENVOY_LOG_MISC(trace, "min timer complete for {}", static_cast<void*>(this));
-    ASSERT(absl::holds_alternative<WaitingForMin>(state_));
-    const WaitingForMin& waiting = absl::get<WaitingForMin>(state_);
-
-    // This
-    if (waiting.scalable_duration_ < std::chrono::milliseconds::zero()) {
-      trigger();
-    } else {
-      state_.emplace<ScalingMax>(manager_.activateTimer(waiting.scalable_duration_, *this));
-    }
-  }
-
   const ScaledTimerMinimum minimum_;
   ScaledRangeTimerManagerImpl& manager_;
   const TimerCb callback_;
-  const TimerPtr min_duration_timer_;
 
   absl::variant<Inactive, WaitingForMin, ScalingMax> state_;
   const ScopeTrackedObject* scope_;
@@ -147,6 +151,7 @@ ScaledRangeTimerManagerImpl::ScaledRangeTimerManagerImpl(
 ScaledRangeTimerManagerImpl::~ScaledRangeTimerManagerImpl() {
   // Scaled timers created by the manager shouldn't outlive it. This is
   // necessary but not sufficient to guarantee that.
+  ASSERT(min_queues_.empty());
   ASSERT(queues_.empty());
 }
 
@@ -174,10 +179,10 @@ void ScaledRangeTimerManagerImpl::setScaleFactor(UnitFloat scale_factor) {
 ScaledRangeTimerManagerImpl::Queue::Item::Item(RangeTimerImpl& timer, MonotonicTime active_time)
     : timer_(timer), active_time_(active_time) {}
 
-ScaledRangeTimerManagerImpl::Queue::Queue(std::chrono::milliseconds duration,
+ScaledRangeTimerManagerImpl::Queue::Queue(std::chrono::milliseconds duration, Purpose purpose,
                                           ScaledRangeTimerManagerImpl& manager,
                                           Dispatcher& dispatcher)
-    : duration_(duration),
+    : duration_(duration), purpose_(purpose),
       timer_(dispatcher.createTimer([this, &manager] { manager.onQueueTimerFired(*this); })) {}
 
 ScaledRangeTimerManagerImpl::ScalingTimerHandle::ScalingTimerHandle(Queue& queue,
@@ -193,21 +198,21 @@ MonotonicTime ScaledRangeTimerManagerImpl::computeTriggerTime(const Queue::Item&
 
 ScaledRangeTimerManagerImpl::ScalingTimerHandle
 ScaledRangeTimerManagerImpl::activateTimer(std::chrono::milliseconds duration,
-                                           RangeTimerImpl& range_timer) {
+                                           Queue::Purpose purpose, RangeTimerImpl& range_timer) {
   // Ensure this is being called on the same dispatcher.
   ASSERT(dispatcher_.isThreadSafe());
 
-  // Find the matching queue for the (max - min) duration of the range timer; if there isn't one,
-  // create it.
-  auto it = queues_.find(duration);
-  if (it == queues_.end()) {
-    auto queue = std::make_unique<Queue>(duration, *this, dispatcher_);
-    it = queues_.emplace(std::move(queue)).first;
+  // Find the matching queue for the duration of the range timer; if there isn't one, create it.
+  QueueSet& queue_set = queueSetFor(purpose);
+  auto it = queue_set.find(duration);
+  if (it == queue_set.end()) {
+    auto queue = std::make_unique<Queue>(duration, purpose, *this, dispatcher_);
+    it = queue_set.emplace(std::move(queue)).first;
   }
   Queue& queue = **it;
 
-  // Put the timer at the back of the queue. Since the timer has the same maximum duration as all
-  // the other timers in the queue, and since the activation times are monotonic, the queue stays in
+  // Put the timer at the back of the queue. Since the timer has the same duration as all the
+  // other timers in the queue, and since the activation times are monotonic, the queue stays in
   // sorted order.
   queue.range_timers_.emplace_back(range_timer, dispatcher_.approximateMonotonicTime());
   if (queue.range_timers_.size() == 1) {
@@ -228,7 +233,7 @@ void ScaledRangeTimerManagerImpl::removeTimer(ScalingTimerHandle handle) {
     // Skip erasing the queue if we're in the middle of processing timers for the queue. The
     // queue will be erased in `onQueueTimerFired` after the queue entries have been processed.
     if (!handle.queue_.processing_timers_) {
-      queues_.erase(handle.queue_);
+      queueSetFor(handle.queue_.purpose_).erase(handle.queue_);
     }
     return;
   }
@@ -243,7 +248,7 @@ void ScaledRangeTimerManagerImpl::removeTimer(ScalingTimerHandle handle) {
 void ScaledRangeTimerManagerImpl::resetQueueTimer(Queue& queue, MonotonicTime now) {
   ASSERT(!queue.range_timers_.empty());
   const MonotonicTime trigger_time =
-      computeTriggerTime(queue.range_timers_.front(), queue.duration_, scale_factor_);
+      computeTriggerTime(queue.range_timers_.front(), queue.duration_, scaleFactorFor(queue));
   if (trigger_time < now) {
     queue.timer_->enableTimer(std::chrono::milliseconds::zero());
   } else {
@@ -257,24 +262,40 @@ void ScaledRangeTimerManagerImpl::onQueueTimerFired(Queue& queue) {
   ASSERT(!timers.empty());
   const MonotonicTime now = dispatcher_.approximateMonotonicTime();
 
-  // Pop and trigger timers until the one at the front isn't supposed to have expired yet (given the
-  // current scale factor).
+  // Pop and expire timers until the one at the front isn't supposed to have expired yet (given the
+  // current scale factor). Timers whose min duration elapsed move on to the scaling-max state;
+  // timers whose scaled max elapsed are triggered.
   queue.processing_timers_ = true;
   while (!timers.empty() &&
-         computeTriggerTime(timers.front(), queue.duration_, scale_factor_) <= now) {
+         computeTriggerTime(timers.front(), queue.duration_, scaleFactorFor(queue)) <= now) {
     auto item = std::move(queue.range_timers_.front());
     queue.range_timers_.pop_front();
-    item.timer_.trigger();
+    if (queue.purpose_ == Queue::Purpose::WaitForMin) {
+      item.timer_.onMinTimerComplete();
+    } else {
+      item.timer_.trigger();
+    }
   }
   queue.processing_timers_ = false;
 
   if (queue.range_timers_.empty()) {
     // Maintain the invariant that queues are never empty.
-    queues_.erase(queue);
+    queueSetFor(queue.purpose_).erase(queue);
   } else {
     resetQueueTimer(queue, now);
   }
 }
 
+ScaledRangeTimerManagerImpl::QueueSet&
+ScaledRangeTimerManagerImpl::queueSetFor(Queue::Purpose purpose) {
+  return purpose == Queue::Purpose::WaitForMin ? min_queues_ : queues_;
+}
+
+UnitFloat ScaledRangeTimerManagerImpl::scaleFactorFor(const Queue& queue) const {
+  // The min duration of a timer is a lower bound that holds regardless of the scale factor; only
+  // the (max - min) portion is scaled.
+  return queue.purpose_ == Queue::Purpose::ScalingMax ? scale_factor_ : UnitFloat::max();
+}
+
 } // namespace Event
 } // namespace Envoy
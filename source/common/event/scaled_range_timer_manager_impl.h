@@ -14,12 +14,14 @@ namespace Event {
 
 /**
  * Implementation class for ScaledRangeTimerManager. Internally, this uses a set of queues to track
- * timers. When an enabled timer reaches its min duration, it adds a tracker object to the queue
- * corresponding to the duration (max - min). Each queue tracks timers of only a single duration,
- * and uses a real Timer object to schedule the expiration of the first timer in the queue. The
- * expectation is that the number of (max - min) values used to enable timers is small, so the
- * number of queues is tightly bounded. The queue-based implementation depends on that expectation
- * for efficient operation.
+ * timers. When a timer is enabled, it is added to the queue corresponding to its min duration;
+ * when the min duration expires, it moves to the queue corresponding to the duration (max - min).
+ * Each queue tracks timers of only a single duration, and uses a real Timer object to schedule
+ * the expiration of the first timer in the queue, so a large number of scaled timers (such as
+ * per-connection idle timeouts) share a handful of underlying dispatcher timers and expire as a
+ * batch. The expectation is that the number of distinct durations used to enable timers is small,
+ * so the number of queues is tightly bounded. The queue-based implementation depends on that
+ * expectation for efficient operation.
  */
 class ScaledRangeTimerManagerImpl : public ScaledRangeTimerManager {
 public:
@@ -36,25 +38,34 @@ public:
 private:
   class RangeTimerImpl;
 
-  // A queue object that maintains a list of timers with the same (max - min) values.
+  // A queue object that maintains a list of timers with the same duration. A queue either tracks
+  // timers waiting for their fixed min duration to elapse, or timers in the scaling-max state
+  // whose (max - min) duration is subject to the scale factor.
   struct Queue {
+    enum class Purpose { WaitForMin, ScalingMax };
+
     struct Item {
       Item(RangeTimerImpl& timer, MonotonicTime active_time);
       // The timer owned by the caller being kept in the queue.
       RangeTimerImpl& timer_;
-      // The time at which the timer became active (when its min duration expired).
+      // The time at which the timer was added to the queue.
       MonotonicTime active_time_;
     };
 
     // Typedef for convenience.
     using Iterator = std::list<Item>::iterator;
 
-    Queue(std::chrono::milliseconds duration, ScaledRangeTimerManagerImpl& manager,
-          Dispatcher& dispatcher);
+    Queue(std::chrono::milliseconds duration, Purpose purpose,
+          ScaledRangeTimerManagerImpl& manager, Dispatcher& dispatcher);
 
-    // The (max - min) value for all timers in range_timers_.
+    // The shared duration for all timers in range_timers_: the min value for WaitForMin queues
+    // and the (max - min) value for ScalingMax queues.
     const std::chrono::milliseconds duration_;
 
+    // Whether the timers in this queue are waiting for their min duration or scaling their
+    // (max - min) duration. Only the latter is affected by the scale factor.
+    const Purpose purpose_;
+
     // The list of active timers in this queue. This is implemented as a
     // std::list so that the iterators held in ScalingTimerHandle instances are
     // not invalidated by removal or insertion of other timers. The timers in
@@ -114,7 +125,10 @@ private:
                                           std::chrono::milliseconds duration,
                                           UnitFloat scale_factor);
 
-  ScalingTimerHandle activateTimer(std::chrono::milliseconds duration, RangeTimerImpl& timer);
+  using QueueSet = absl::flat_hash_set<std::unique_ptr<Queue>, Hash, Eq>;
+
+  ScalingTimerHandle activateTimer(std::chrono::milliseconds duration, Queue::Purpose purpose,
+                                   RangeTimerImpl& timer);
 
   void removeTimer(ScalingTimerHandle handle);
 
@@ -122,10 +136,18 @@ private:
 
   void onQueueTimerFired(Queue& queue);
 
+  QueueSet& queueSetFor(Queue::Purpose purpose);
+
+  // The effective scale factor for a queue; min-duration queues are not scaled.
+  UnitFloat scaleFactorFor(const Queue& queue) const;
+
   Dispatcher& dispatcher_;
   const ScaledTimerTypeMapConstSharedPtr timer_minimums_;
   UnitFloat scale_factor_;
-  absl::flat_hash_set<std::unique_ptr<Queue>, Hash, Eq> queues_;
+  // Queues of timers waiting for their min duration, keyed by that duration.
+  QueueSet min_queues_;
+  // Queues of timers in the scaling-max state, keyed by their (max - min) duration.
+  QueueSet queues_;
 };
 
 } // namespace Event
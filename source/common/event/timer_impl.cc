@@ -3,14 +3,39 @@
 #include <chrono>
 
 #include "source/common/common/assert.h"
+#include "source/common/runtime/runtime_features.h"
 
 #include "event2/event.h"
 
 namespace Envoy {
 namespace Event {
 
-TimerImpl::TimerImpl(Libevent::BasePtr& libevent, TimerCb cb, Dispatcher& dispatcher)
-    : cb_(cb), dispatcher_(dispatcher) {
+const timeval* CommonTimeoutCache::get(const std::chrono::milliseconds d) {
+  if (d.count() <= 0) {
+    return nullptr;
+  }
+  const uint64_t key = static_cast<uint64_t>(d.count());
+  auto it = entries_.find(key);
+  if (it != entries_.end()) {
+    return &it->second;
+  }
+  if (entries_.size() >= MaxEntries) {
+    return nullptr;
+  }
+  timeval duration_tv;
+  TimerUtils::durationToTimeval(d, duration_tv);
+  const timeval* common_tv = event_base_init_common_timeout(libevent_.get(), &duration_tv);
+  if (common_tv == nullptr) {
+    return nullptr;
+  }
+  return &entries_.emplace(key, *common_tv).first->second;
+}
+
+TimerImpl::TimerImpl(Libevent::BasePtr& libevent, TimerCb cb, Dispatcher& dispatcher,
+                     CommonTimeoutCache& common_timeouts)
+    : cb_(cb), dispatcher_(dispatcher), common_timeouts_(common_timeouts),
+      use_common_timeouts_(
+          Runtime::runtimeFeatureEnabled("envoy.reloadable_features.timer_common_timeouts")) {
   ASSERT(cb_);
   evtimer_assign(
       &raw_event_, libevent.get(),
@@ -33,6 +58,15 @@ void TimerImpl::disableTimer() {
 }
 
 void TimerImpl::enableTimer(const std::chrono::milliseconds d, const ScopeTrackedObject* object) {
+  // Millisecond granularity timers are armed through libevent's common timeout lists whenever
+  // possible so that arming and canceling them is O(1) instead of a min-heap operation.
+  // High-resolution timers (see enableHRTimer()) always use the min-heap.
+  if (use_common_timeouts_) {
+    if (const timeval* common_tv = common_timeouts_.get(d); common_tv != nullptr) {
+      internalEnableTimer(*common_tv, object);
+      return;
+    }
+  }
   timeval tv;
   TimerUtils::durationToTimeval(d, tv);
   internalEnableTimer(tv, object);
@@ -9,6 +9,8 @@
 #include "source/common/event/event_impl_base.h"
 #include "source/common/event/libevent.h"
 
+#include "absl/container/node_hash_map.h"
+
 namespace Envoy {
 namespace Event {
 
@@ -49,12 +51,45 @@ public:
   }
 };
 
+/**
+ * Cache of libevent "common timeout" representations keyed by duration.
+ *
+ * Events added with a common timeout timeval are kept by libevent in a per-duration doubly-linked
+ * list with O(1) insertion and removal, with a single representative entry in the timer min-heap
+ * per distinct duration. Envoy arms very large numbers of timers drawn from a small set of
+ * distinct durations (request timeouts, idle timeouts, retry timers), which makes the
+ * per-duration lists a much better fit than the min-heap. One cache exists per event loop and
+ * lookups are not thread safe.
+ */
+class CommonTimeoutCache {
+public:
+  explicit CommonTimeoutCache(Libevent::BasePtr& libevent) : libevent_(libevent) {}
+
+  /**
+   * @param d the timer duration at millisecond granularity.
+   * @return the common timeout representation of the duration, or nullptr if the duration is not
+   * eligible (non-positive, or the cache already holds the maximum number of distinct durations).
+   * The returned pointer remains valid for the lifetime of the cache.
+   */
+  const timeval* get(std::chrono::milliseconds d);
+
+private:
+  // Each distinct common timeout costs one representative entry in the libevent timer heap and a
+  // slot in a linear scan inside libevent, so only a bounded set of durations is promoted. Timers
+  // with other durations simply stay in the min-heap.
+  static constexpr size_t MaxEntries = 32;
+
+  Libevent::BasePtr& libevent_;
+  absl::node_hash_map<uint64_t, timeval> entries_;
+};
+
 /**
  * libevent implementation of Timer.
  */
 class TimerImpl : public Timer, ImplBase {
 public:
-  TimerImpl(Libevent::BasePtr& libevent, TimerCb cb, Event::Dispatcher& dispatcher);
+  TimerImpl(Libevent::BasePtr& libevent, TimerCb cb, Event::Dispatcher& dispatcher,
+            CommonTimeoutCache& common_timeouts);
 
   // Timer
   void disableTimer() override;
@@ -68,6 +103,10 @@ private:
   void internalEnableTimer(const timeval& tv, const ScopeTrackedObject* scope);
   TimerCb cb_;
   Dispatcher& dispatcher_;
+  CommonTimeoutCache& common_timeouts_;
+  // Snapshot of the runtime guard at timer creation; enableTimer() is too hot for a per-call
+  // runtime lookup.
+  const bool use_common_timeouts_;
   // This has to be atomic for alarms which are handled out of thread, for
   // example if the DispatcherImpl::post is called by two threads, they race to
   // both set this to null.
@@ -469,6 +469,17 @@ ProtobufWkt::Value CommonDurationFormatter::formatValue(const StreamInfo::Stream
   return ValueUtil::numberValue(duration.value());
 }
 
+bool CommonDurationFormatter::formatTo(const StreamInfo::StreamInfo& info,
+                                       std::string& output) const {
+  auto duration = getDurationCount(info);
+  if (!duration.has_value()) {
+    return false;
+  }
+  const auto formatted = fmt::format_int(duration.value());
+  output.append(formatted.data(), formatted.size());
+  return true;
+}
+
 // A SystemTime formatter that extracts the startTime from StreamInfo. Must be provided
 // an access log command that starts with `START_TIME`.
 StartTimeFormatter::StartTimeFormatter(absl::string_view format)
@@ -572,6 +583,10 @@ absl::optional<std::string> EnvironmentFormatter::format(const StreamInfo::Strea
 ProtobufWkt::Value EnvironmentFormatter::formatValue(const StreamInfo::StreamInfo&) const {
   return str_;
 }
+bool EnvironmentFormatter::formatTo(const StreamInfo::StreamInfo&, std::string& output) const {
+  output.append(str_.string_value());
+  return true;
+}
 
 // StreamInfo std::string formatter provider.
 class StreamInfoStringFormatterProvider : public StreamInfoFormatterProvider {
@@ -617,6 +632,15 @@ public:
 
     return ValueUtil::numberValue(millis.value());
   }
+  bool formatTo(const StreamInfo::StreamInfo& stream_info, std::string& output) const override {
+    const auto millis = extractMillis(stream_info);
+    if (!millis) {
+      return false;
+    }
+    const auto formatted = fmt::format_int(millis.value());
+    output.append(formatted.data(), formatted.size());
+    return true;
+  }
 
 private:
   absl::optional<int64_t> extractMillis(const StreamInfo::StreamInfo& stream_info) const {
@@ -644,6 +668,11 @@ public:
   ProtobufWkt::Value formatValue(const StreamInfo::StreamInfo& stream_info) const override {
     return ValueUtil::numberValue(field_extractor_(stream_info));
   }
+  bool formatTo(const StreamInfo::StreamInfo& stream_info, std::string& output) const override {
+    const auto formatted = fmt::format_int(field_extractor_(stream_info));
+    output.append(formatted.data(), formatted.size());
+    return true;
+  }
 
 private:
   FieldExtractor field_extractor_;
@@ -699,6 +728,22 @@ public:
 
     return ValueUtil::stringValue(toString(*address));
   }
+  bool formatTo(const StreamInfo::StreamInfo& stream_info, std::string& output) const override {
+    Network::Address::InstanceConstSharedPtr address = field_extractor_(stream_info);
+    if (!address) {
+      return false;
+    }
+
+    if (extraction_type_ == StreamInfoAddressFieldExtractionType::WithPort) {
+      // The full address string is cached on the address instance so it can be appended
+      // without creating a temporary string.
+      const absl::string_view address_view = address->asStringView();
+      output.append(address_view.data(), address_view.size());
+    } else {
+      output.append(toString(*address));
+    }
+    return true;
+  }
 
 private:
   std::string toString(const Network::Address::Instance& address) const {
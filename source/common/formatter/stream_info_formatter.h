@@ -127,6 +127,7 @@ public:
   // StreamInfoFormatterProvider
   absl::optional<std::string> format(const StreamInfo::StreamInfo&) const override;
   ProtobufWkt::Value formatValue(const StreamInfo::StreamInfo&) const override;
+  bool formatTo(const StreamInfo::StreamInfo&, std::string& output) const override;
 
   static const absl::flat_hash_map<absl::string_view, TimePointGetter> KnownTimePointGetters;
 
@@ -237,6 +238,7 @@ public:
   // StreamInfoFormatterProvider
   absl::optional<std::string> format(const StreamInfo::StreamInfo&) const override;
   ProtobufWkt::Value formatValue(const StreamInfo::StreamInfo&) const override;
+  bool formatTo(const StreamInfo::StreamInfo&, std::string& output) const override;
 
 private:
   ProtobufWkt::Value str_;
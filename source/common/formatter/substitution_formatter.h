@@ -42,6 +42,11 @@ public:
                                             const StreamInfo::StreamInfo&) const override {
     return str_;
   }
+  bool formatWithContextTo(const FormatterContext&, const StreamInfo::StreamInfo&,
+                           std::string& output) const override {
+    output.append(str_.string_value());
+    return true;
+  }
 
 private:
   ProtobufWkt::Value str_;
@@ -53,21 +58,29 @@ private:
 template <class FormatterContext>
 class PlainNumberFormatterBase : public FormatterProviderBase<FormatterContext> {
 public:
-  PlainNumberFormatterBase(double num) { num_.set_number_value(num); }
+  PlainNumberFormatterBase(double num) {
+    num_.set_number_value(num);
+    str_ = absl::StrFormat("%g", num);
+  }
 
   // FormatterProviderBase
   absl::optional<std::string> formatWithContext(const FormatterContext&,
                                                 const StreamInfo::StreamInfo&) const override {
-    std::string str = absl::StrFormat("%g", num_.number_value());
-    return str;
+    return str_;
   }
   ProtobufWkt::Value formatValueWithContext(const FormatterContext&,
                                             const StreamInfo::StreamInfo&) const override {
     return num_;
   }
+  bool formatWithContextTo(const FormatterContext&, const StreamInfo::StreamInfo&,
+                           std::string& output) const override {
+    output.append(str_);
+    return true;
+  }
 
 private:
   ProtobufWkt::Value num_;
+  std::string str_;
 };
 
 /**
@@ -90,6 +103,10 @@ public:
                          const StreamInfo::StreamInfo& stream_info) const override {
     return formatter_->formatValue(stream_info);
   }
+  bool formatWithContextTo(const FormatterContext&, const StreamInfo::StreamInfo& stream_info,
+                           std::string& output) const override {
+    return formatter_->formatTo(stream_info, output);
+  }
 
 protected:
   StreamInfoFormatterProviderPtr formatter_;
@@ -231,9 +248,12 @@ public:
     std::string log_line;
     log_line.reserve(256);
 
+    // Providers append directly to the log line so that per-provider temporary strings are
+    // only created by providers that have no formatWithContextTo() override.
     for (const auto& provider : providers_) {
-      const auto bit = provider->formatWithContext(context, stream_info);
-      log_line += bit.value_or(empty_value_string_);
+      if (!provider->formatWithContextTo(context, stream_info, log_line)) {
+        log_line += empty_value_string_;
+      }
     }
 
     return log_line;
@@ -180,9 +180,10 @@ Buffer::InstancePtr Common::serializeToGrpcFrame(const Protobuf::Message& messag
   const uint32_t nsize = htonl(size);
   safeMemcpyUnsafeDst(current, &nsize);
   current += sizeof(uint32_t);
-  Protobuf::io::ArrayOutputStream stream(current, size, -1);
-  Protobuf::io::CodedOutputStream codec_stream(&stream);
-  message.SerializeWithCachedSizes(&codec_stream);
+  // The destination is a single flat slice, so use the array serialization fast path rather than
+  // going through a coded stream adapter.
+  const uint8_t* end = message.SerializeWithCachedSizesToArray(current);
+  ASSERT(end == current + size);
   reservation.commit(alloc_size);
   return body;
 }
@@ -193,9 +194,8 @@ Buffer::InstancePtr Common::serializeMessage(const Protobuf::Message& message) {
   auto reservation = body->reserveSingleSlice(size);
   ASSERT(reservation.slice().len_ >= size);
   uint8_t* current = reinterpret_cast<uint8_t*>(reservation.slice().mem_);
-  Protobuf::io::ArrayOutputStream stream(current, size, -1);
-  Protobuf::io::CodedOutputStream codec_stream(&stream);
-  message.SerializeWithCachedSizes(&codec_stream);
+  const uint8_t* end = message.SerializeWithCachedSizesToArray(current);
+  ASSERT(end == current + size);
   reservation.commit(size);
   return body;
 }
@@ -15,8 +15,7 @@ namespace Internal {
  * Forward declarations for helper functions.
  */
 void sendMessageUntyped(RawAsyncStream* stream, const Protobuf::Message& request, bool end_stream);
-ProtobufTypes::MessagePtr parseMessageUntyped(ProtobufTypes::MessagePtr&& message,
-                                              Buffer::InstancePtr&& response);
+bool parseMessageUntyped(Protobuf::Message& message, Buffer::InstancePtr&& response);
 RawAsyncStream* startUntyped(RawAsyncClient* client,
                              const Protobuf::MethodDescriptor& service_method,
                              RawAsyncStreamCallbacks& callbacks,
@@ -76,10 +75,8 @@ public:
 
 private:
   void onSuccessRaw(Buffer::InstancePtr&& response, Tracing::Span& span) override {
-    auto message = ResponsePtr<Response>(dynamic_cast<Response*>(
-        Internal::parseMessageUntyped(std::make_unique<Response>(), std::move(response))
-            .release()));
-    if (!message) {
+    auto message = std::make_unique<Response>();
+    if (!Internal::parseMessageUntyped(*message, std::move(response))) {
       onFailure(Status::WellKnownGrpcStatus::Internal, "", span);
       return;
     }
@@ -97,10 +94,8 @@ public:
 
 private:
   bool onReceiveMessageRaw(Buffer::InstancePtr&& response) override {
-    auto message = ResponsePtr<Response>(dynamic_cast<Response*>(
-        Internal::parseMessageUntyped(std::make_unique<Response>(), std::move(response))
-            .release()));
-    if (!message) {
+    auto message = std::make_unique<Response>();
+    if (!Internal::parseMessageUntyped(*message, std::move(response))) {
       return false;
     }
     onReceiveMessage(std::move(message));
@@ -104,9 +104,8 @@ createRetryPolicy(AsyncClientImpl& parent, const AsyncClient::StreamOptions& opt
     creation_status = policy_or_error.status();
     return policy_or_error.status().ok() ? std::move(policy_or_error.value()) : nullptr;
   }
-  if (options.parsed_retry_policy == nullptr) {
-    return std::make_unique<Router::RetryPolicyImpl>();
-  }
+  // Streams with no per-request policy share the client's default policy instead of each
+  // allocating an identical default-constructed one.
   return nullptr;
 }
 
@@ -126,7 +125,10 @@ AsyncStreamImpl::AsyncStreamImpl(AsyncClientImpl& parent, AsyncClient::StreamCal
       retry_policy_(createRetryPolicy(parent, options, parent_.factory_context_, creation_status)),
       route_(std::make_shared<NullRouteImpl>(
           parent_.cluster_->name(),
-          retry_policy_ != nullptr ? *retry_policy_ : *options.parsed_retry_policy,
+          retry_policy_ != nullptr
+              ? *retry_policy_
+              : (options.parsed_retry_policy != nullptr ? *options.parsed_retry_policy
+                                                        : parent.default_retry_policy_),
           parent_.factory_context_.regexEngine(), options.timeout, options.hash_policy)),
       account_(options.account_), buffer_limit_(options.buffer_limit_), send_xff_(options.send_xff),
       send_internal_(options.send_internal) {
@@ -86,6 +86,9 @@ private:
   std::list<std::unique_ptr<AsyncStreamImpl>> active_streams_;
   Runtime::Loader& runtime_;
   const LocalReply::LocalReplyPtr local_reply_;
+  // Referenced by the null routes of all streams started without a retry policy in their
+  // options, saving a default policy allocation per request.
+  const Router::RetryPolicyImpl default_retry_policy_;
 
   friend class AsyncStreamImpl;
   friend class AsyncRequestSharedImpl;
@@ -68,6 +68,9 @@ const absl::string_view ConnectionManagerImpl::MaxRequestsPerIoCycle =
 // Don't attempt to intelligently delay close: https://github.com/envoyproxy/envoy/issues/30010
 const absl::string_view ConnectionManagerImpl::OptionallyDelayClose =
     "http1.optionally_delay_close";
+// Runtime key for the per-mille fraction of streams that record per-filter timing checkpoints.
+const absl::string_view ConnectionManagerImpl::FilterChainTimingPermilleKey =
+    "http.filter_chain_timing_permille";
 
 bool requestWasConnect(const RequestHeaderMapSharedPtr& headers, Protocol protocol) {
   if (!headers) {
@@ -98,6 +101,10 @@ ConnectionManagerImpl::generateListenerStats(const std::string& prefix, Stats::S
   return {CONN_MAN_LISTENER_STATS(POOL_COUNTER_PREFIX(scope, prefix))};
 }
 
+namespace {
+constexpr absl::string_view kRouteFactoryName = "envoy.route_config_update_requester.default";
+} // namespace
+
 ConnectionManagerImpl::ConnectionManagerImpl(ConnectionManagerConfigSharedPtr config,
                                              const Network::DrainDecision& drain_close,
                                              Random::RandomGenerator& random_generator,
@@ -129,7 +136,10 @@ ConnectionManagerImpl::ConnectionManagerImpl(ConnectionManagerConfigSharedPtr co
       max_requests_during_dispatch_(
           runtime_.snapshot().getInteger(ConnectionManagerImpl::MaxRequestsPerIoCycle, UINT32_MAX)),
       allow_upstream_half_close_(Runtime::runtimeFeatureEnabled(
-          "envoy.reloadable_features.allow_multiplexed_upstream_half_close")) {
+          "envoy.reloadable_features.allow_multiplexed_upstream_half_close")),
+      route_config_update_requester_factory_(
+          Envoy::Config::Utility::getFactoryByName<RouteConfigUpdateRequesterFactory>(
+              kRouteFactoryName)) {
   ENVOY_LOG_ONCE_IF(
       trace, accept_new_http_stream_ == nullptr,
       "LoadShedPoint envoy.load_shed_points.http_connection_manager_decode_headers is not "
@@ -387,7 +397,10 @@ RequestDecoderHandlePtr ConnectionManagerImpl::newStreamHandle(ResponseEncoder&
 RequestDecoder& ConnectionManagerImpl::newStream(ResponseEncoder& response_encoder,
                                                  bool is_internally_created) {
   TRACE_EVENT("core", "ConnectionManagerImpl::newStream");
-  if (connection_idle_timer_) {
+  // The idle timer is armed iff there are no streams: it starts armed, is re-armed when the last
+  // stream completes in doDeferredStreamDestroy(), and is disarmed here on the first stream. On
+  // multiplexed connections further streams can skip the redundant disable.
+  if (connection_idle_timer_ && streams_.empty()) {
     connection_idle_timer_->disableTimer();
   }
 
@@ -793,10 +806,6 @@ absl::optional<uint64_t> ConnectionManagerImpl::HttpStreamIdProviderImpl::toInte
       *parent_.request_headers_);
 }
 
-namespace {
-constexpr absl::string_view kRouteFactoryName = "envoy.route_config_update_requester.default";
-} // namespace
-
 ConnectionManagerImpl::ActiveStream::ActiveStream(ConnectionManagerImpl& connection_manager,
                                                   uint32_t buffer_limit,
                                                   Buffer::BufferMemoryAccountSharedPtr account)
@@ -832,12 +841,20 @@ ConnectionManagerImpl::ActiveStream::ActiveStream(ConnectionManagerImpl& connect
   filter_manager_.streamInfo().setStreamIdProvider(
       std::make_shared<HttpStreamIdProviderImpl>(*this));
 
+  // stream_id_ is already random, so it doubles as the stable sampling value; the default of zero
+  // means unsampled streams pay only a null check per filter callback.
+  if (connection_manager_.runtime_.snapshot().featureEnabled(
+          ConnectionManagerImpl::FilterChainTimingPermilleKey, 0, stream_id_, 1000)) {
+    filter_manager_.enableFilterChainTiming();
+  }
+
   filter_manager_.streamInfo().setShouldSchemeMatchUpstream(
       connection_manager.config_->shouldSchemeMatchUpstream());
 
   // TODO(chaoqin-li1123): can this be moved to the on demand filter?
-  auto factory = Envoy::Config::Utility::getFactoryByName<RouteConfigUpdateRequesterFactory>(
-      kRouteFactoryName);
+  // The factory registry does not change at runtime; use the lookup cached by the connection
+  // manager rather than resolving the factory by name for every stream.
+  auto* factory = connection_manager_.route_config_update_requester_factory_;
   if (connection_manager_.config_->isRoutable() &&
       connection_manager.config_->routeConfigProvider() != nullptr && factory) {
     route_config_update_requester_ = factory->createRouteConfigUpdateRequester(
@@ -1571,17 +1588,23 @@ void ConnectionManagerImpl::ActiveStream::snapScopedRouteConfig() {
 void ConnectionManagerImpl::ActiveStream::refreshCachedRoute() { refreshCachedRoute(nullptr); }
 
 void ConnectionManagerImpl::ActiveStream::refreshDurationTimeout() {
-  if (!filter_manager_.streamInfo().route() ||
-      !filter_manager_.streamInfo().route()->routeEntry() || !request_headers_) {
+  // streamInfo().route() returns the shared pointer by value, so take one copy here instead of
+  // paying a refcount round-trip for each check; this runs on every route refresh.
+  const Router::RouteConstSharedPtr stream_route = filter_manager_.streamInfo().route();
+  if (stream_route == nullptr || stream_route->routeEntry() == nullptr || !request_headers_) {
     return;
   }
-  const auto& route = filter_manager_.streamInfo().route()->routeEntry();
+  const auto* route = stream_route->routeEntry();
 
-  auto grpc_timeout = Grpc::Common::getGrpcTimeout(*request_headers_);
+  // Only parse the grpc-timeout header if the route actually honors it.
+  absl::optional<std::chrono::milliseconds> grpc_timeout;
+  if (route->grpcTimeoutHeaderMax()) {
+    grpc_timeout = Grpc::Common::getGrpcTimeout(*request_headers_);
+  }
   std::chrono::milliseconds timeout;
   bool disable_timer = false;
 
-  if (!grpc_timeout || !route->grpcTimeoutHeaderMax()) {
+  if (!grpc_timeout) {
     // Either there is no grpc-timeout header or special timeouts for it are not
     // configured. Use stream duration.
     if (route->maxStreamDuration()) {
@@ -129,6 +129,10 @@ public:
   static const absl::string_view MaxRequestsPerIoCycle;
   static const absl::string_view OptionallyDelayClose;
 
+  // Per-mille fraction of streams sampled for per-filter timing checkpoints; see
+  // Http::FilterChainTimingRecorder.
+  static const absl::string_view FilterChainTimingPermilleKey;
+
 private:
   struct ActiveStream;
   class MobileConnectionManagerImpl;
@@ -665,6 +669,9 @@ private:
   // request was incomplete at response completion, the stream is reset.
 
   const bool allow_upstream_half_close_{};
+  // Resolved once at construction; each ActiveStream would otherwise look this factory up in the
+  // registry by name.
+  RouteConfigUpdateRequesterFactory* const route_config_update_requester_factory_;
 };
 
 } // namespace Http
@@ -0,0 +1,48 @@
+#include "source/common/http/filter_chain_timing.h"
+
+#include <chrono>
+
+#include "absl/strings/str_cat.h"
+
+namespace Envoy {
+namespace Http {
+
+namespace {
+
+absl::string_view eventName(FilterChainTimingRecorder::Event event) {
+  switch (event) {
+  case FilterChainTimingRecorder::Event::DecodeHeaders:
+    return "decode-headers";
+  case FilterChainTimingRecorder::Event::DecodeData:
+    return "decode-data";
+  case FilterChainTimingRecorder::Event::DecodeTrailers:
+    return "decode-trailers";
+  case FilterChainTimingRecorder::Event::EncodeHeaders:
+    return "encode-headers";
+  case FilterChainTimingRecorder::Event::EncodeData:
+    return "encode-data";
+  case FilterChainTimingRecorder::Event::EncodeTrailers:
+    return "encode-trailers";
+  }
+  return "unknown";
+}
+
+} // namespace
+
+absl::optional<std::string> FilterChainTimingRecorder::serializeAsString() const {
+  std::string out;
+  for (size_t i = 0; i < count_; i++) {
+    const Checkpoint& checkpoint = checkpoints_[i];
+    const auto since_start =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(checkpoint.time - start_);
+    absl::StrAppend(&out, i == 0 ? "" : ",", eventName(checkpoint.event), ":",
+                    checkpoint.filter_name, "=", since_start.count(), "ns");
+  }
+  if (dropped_ > 0) {
+    absl::StrAppend(&out, ",dropped=", dropped_);
+  }
+  return out;
+}
+
+} // namespace Http
+} // namespace Envoy
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <array>
+
+#include "envoy/common/time.h"
+#include "envoy/stream_info/filter_state.h"
+
+#include "source/common/common/macros.h"
+
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+
+namespace Envoy {
+namespace Http {
+
+/**
+ * A fixed-size per-stream checkpoint recorder used to attribute stream latency to individual
+ * filters without running a full tracer. When a stream is sampled (see the
+ * "http.filter_chain_timing_permille" runtime key) the filter manager records a checkpoint each
+ * time a filter callback returns, so the delta between consecutive checkpoints approximates the
+ * time spent in the filter named by the later checkpoint. The recorder is shared with the stream's
+ * filter state and can be dumped with the %FILTER_STATE(envoy.http.filter_chain_timing)% access
+ * log command.
+ */
+class FilterChainTimingRecorder : public StreamInfo::FilterState::Object {
+public:
+  enum class Event : uint8_t {
+    DecodeHeaders,
+    DecodeData,
+    DecodeTrailers,
+    EncodeHeaders,
+    EncodeData,
+    EncodeTrailers,
+  };
+
+  // Bounds the per-stream memory cost; checkpoints past the limit are dropped and counted so the
+  // dump makes truncation visible.
+  static constexpr size_t MaxCheckpoints = 64;
+
+  static const std::string& key() {
+    CONSTRUCT_ON_FIRST_USE(std::string, "envoy.http.filter_chain_timing");
+  }
+
+  explicit FilterChainTimingRecorder(TimeSource& time_source)
+      : time_source_(time_source), start_(time_source.monotonicTime()) {}
+
+  /**
+   * Records one checkpoint: a monotonic clock read plus a few stores.
+   * @param filter_name the filter's config name. Only the view is stored; the name must outlive
+   *        the stream's filter chain, which holds for filter config names.
+   * @param event the filter callback that just returned.
+   */
+  void record(absl::string_view filter_name, Event event) {
+    if (count_ == MaxCheckpoints) {
+      dropped_++;
+      return;
+    }
+    checkpoints_[count_++] = {filter_name, time_source_.monotonicTime(), event};
+  }
+
+  absl::optional<std::string> serializeAsString() const override;
+
+private:
+  struct Checkpoint {
+    absl::string_view filter_name;
+    MonotonicTime time;
+    Event event;
+  };
+
+  TimeSource& time_source_;
+  const MonotonicTime start_;
+  std::array<Checkpoint, MaxCheckpoints> checkpoints_;
+  size_t count_{0};
+  uint64_t dropped_{0};
+};
+
+} // namespace Http
+} // namespace Envoy
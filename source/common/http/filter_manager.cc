@@ -531,6 +531,14 @@ void FilterManager::maybeContinueDecoding(
   }
 }
 
+void FilterManager::enableFilterChainTiming() {
+  auto recorder = std::make_shared<FilterChainTimingRecorder>(dispatcher_.timeSource());
+  filter_chain_timing_ = recorder.get();
+  streamInfo().filterState()->setData(FilterChainTimingRecorder::key(), std::move(recorder),
+                                      StreamInfo::FilterState::StateType::ReadOnly,
+                                      StreamInfo::FilterState::LifeSpan::FilterChain);
+}
+
 void FilterManager::decodeHeaders(ActiveStreamDecoderFilter* filter, RequestHeaderMap& headers,
                                   bool end_stream) {
   // Headers filter iteration should always start with the next filter if available.
@@ -550,6 +558,8 @@ void FilterManager::decodeHeaders(ActiveStreamDecoderFilter* filter, RequestHead
       state_.filter_call_state_ |= FilterCallState::EndOfStream;
     }
     FilterHeadersStatus status = (*entry)->decodeHeaders(headers, (*entry)->end_stream_);
+    recordFilterTiming((*entry)->filter_context_.config_name,
+                       FilterChainTimingRecorder::Event::DecodeHeaders);
     state_.filter_call_state_ &= ~FilterCallState::DecodeHeaders;
     if ((*entry)->end_stream_) {
       state_.filter_call_state_ &= ~FilterCallState::EndOfStream;
@@ -654,9 +664,12 @@ void FilterManager::decodeData(ActiveStreamDecoderFilter* filter, Buffer::Instan
          (*entry)->end_stream_);
 
   for (; entry != decoder_filters_.end(); entry++) {
-    ENVOY_EXECUTION_SCOPE(trackedStream(), &(*entry)->filter_context_);
+    // The entry is stable for the whole iteration, so dereference it once here instead of
+    // re-walking the list node and unique_ptr around each opaque filter callback below.
+    ActiveStreamDecoderFilter& current_filter = **entry;
+    ENVOY_EXECUTION_SCOPE(trackedStream(), &current_filter.filter_context_);
     // If the filter pointed by entry has stopped for all frame types, return now.
-    if (handleDataIfStopAll(**entry, data, state_.decoder_filters_streaming_)) {
+    if (handleDataIfStopAll(current_filter, data, state_.decoder_filters_streaming_)) {
       return;
     }
     // If end_stream_ is marked for a filter, the data is not for this filter and filters after.
@@ -689,7 +702,7 @@ void FilterManager::decodeData(ActiveStreamDecoderFilter* filter, Buffer::Instan
     // If a filter is already marked as end_stream_ when decodeData() is called, bails out the
     // whole function. If just skip the filter, the codes after the loop will be called with
     // wrong data. For encodeData, the response_encoder->encode() will be called.
-    if ((*entry)->end_stream_) {
+    if (current_filter.end_stream_) {
       return;
     }
     ASSERT(!(state_.filter_call_state_ & FilterCallState::DecodeData));
@@ -704,21 +717,23 @@ void FilterManager::decodeData(ActiveStreamDecoderFilter* filter, Buffer::Instan
     recordLatestDataFilter(entry, state_.latest_data_decoding_filter_, decoder_filters_);
 
     state_.filter_call_state_ |= FilterCallState::DecodeData;
-    (*entry)->end_stream_ = end_stream && !filter_manager_callbacks_.requestTrailers();
-    FilterDataStatus status = (*entry)->handle_->decodeData(data, (*entry)->end_stream_);
-    if ((*entry)->end_stream_) {
-      (*entry)->handle_->decodeComplete();
+    current_filter.end_stream_ = end_stream && !filter_manager_callbacks_.requestTrailers();
+    FilterDataStatus status = current_filter.handle_->decodeData(data, current_filter.end_stream_);
+    recordFilterTiming(current_filter.filter_context_.config_name,
+                       FilterChainTimingRecorder::Event::DecodeData);
+    if (current_filter.end_stream_) {
+      current_filter.handle_->decodeComplete();
     }
     state_.filter_call_state_ &= ~FilterCallState::DecodeData;
     if (end_stream) {
       state_.filter_call_state_ &= ~FilterCallState::EndOfStream;
     }
     ENVOY_STREAM_LOG(trace, "decode data called: filter={} status={}", *this,
-                     (*entry)->filter_context_.config_name, static_cast<uint64_t>(status));
+                     current_filter.filter_context_.config_name, static_cast<uint64_t>(status));
     if (state_.decoder_filter_chain_aborted_) {
       executeLocalReplyIfPrepared();
       ENVOY_STREAM_LOG(trace, "decodeData filter iteration aborted due to local reply: filter={}",
-                       *this, (*entry)->filter_context_.config_name);
+                       *this, current_filter.filter_context_.config_name);
       return;
     }
 
@@ -738,7 +753,8 @@ void FilterManager::decodeData(ActiveStreamDecoderFilter* filter, Buffer::Instan
     // below.
     terminal_filter_decoded_end_stream = end_stream && std::next(entry) == decoder_filters_.end();
 
-    if (!(*entry)->commonHandleAfterDataCallback(status, data, state_.decoder_filters_streaming_) &&
+    if (!current_filter.commonHandleAfterDataCallback(status, data,
+                                                      state_.decoder_filters_streaming_) &&
         std::next(entry) != decoder_filters_.end()) {
       // Stop iteration IFF this is not the last filter. If it is the last filter, continue with
       // processing since we need to handle the case where a terminal filter wants to buffer, but
@@ -813,6 +829,8 @@ void FilterManager::decodeTrailers(ActiveStreamDecoderFilter* filter, RequestTra
     ASSERT(!(state_.filter_call_state_ & FilterCallState::DecodeTrailers));
     state_.filter_call_state_ |= FilterCallState::DecodeTrailers;
     FilterTrailersStatus status = (*entry)->handle_->decodeTrailers(trailers);
+    recordFilterTiming((*entry)->filter_context_.config_name,
+                       FilterChainTimingRecorder::Event::DecodeTrailers);
     (*entry)->handle_->decodeComplete();
     (*entry)->end_stream_ = true;
     state_.filter_call_state_ &= ~FilterCallState::DecodeTrailers;
@@ -1235,6 +1253,8 @@ void FilterManager::encodeHeaders(ActiveStreamEncoderFilter* filter, ResponseHea
       state_.filter_call_state_ |= FilterCallState::EndOfStream;
     }
     FilterHeadersStatus status = (*entry)->handle_->encodeHeaders(headers, (*entry)->end_stream_);
+    recordFilterTiming((*entry)->filter_context_.config_name,
+                       FilterChainTimingRecorder::Event::EncodeHeaders);
     if (state_.encoder_filter_chain_aborted_) {
       ENVOY_STREAM_LOG(trace,
                        "encodeHeaders filter iteration aborted due to local reply: filter={}",
@@ -1401,14 +1421,16 @@ void FilterManager::encodeData(ActiveStreamEncoderFilter* filter, Buffer::Instan
 
   const bool trailers_exists_at_start = filter_manager_callbacks_.responseTrailers().has_value();
   for (; entry != encoder_filters_.end(); entry++) {
-    ENVOY_EXECUTION_SCOPE(trackedStream(), &(*entry)->filter_context_);
+    // As in decodeData() above, dereference the stable entry once per iteration.
+    ActiveStreamEncoderFilter& current_filter = **entry;
+    ENVOY_EXECUTION_SCOPE(trackedStream(), &current_filter.filter_context_);
     // If the filter pointed by entry has stopped for all frame type, return now.
-    if (handleDataIfStopAll(**entry, data, state_.encoder_filters_streaming_)) {
+    if (handleDataIfStopAll(current_filter, data, state_.encoder_filters_streaming_)) {
       return;
     }
     // If end_stream_ is marked for a filter, the data is not for this filter and filters after.
     // For details, please see the comment in the ActiveStream::decodeData() function.
-    if ((*entry)->end_stream_) {
+    if (current_filter.end_stream_) {
       return;
     }
     ASSERT(!(state_.filter_call_state_ & FilterCallState::EncodeData));
@@ -1423,29 +1445,32 @@ void FilterManager::encodeData(ActiveStreamEncoderFilter* filter, Buffer::Instan
 
     recordLatestDataFilter(entry, state_.latest_data_encoding_filter_, encoder_filters_);
 
-    (*entry)->end_stream_ = end_stream && !filter_manager_callbacks_.responseTrailers();
-    FilterDataStatus status = (*entry)->handle_->encodeData(data, (*entry)->end_stream_);
+    current_filter.end_stream_ = end_stream && !filter_manager_callbacks_.responseTrailers();
+    FilterDataStatus status = current_filter.handle_->encodeData(data, current_filter.end_stream_);
+    recordFilterTiming(current_filter.filter_context_.config_name,
+                       FilterChainTimingRecorder::Event::EncodeData);
     if (state_.encoder_filter_chain_aborted_) {
       ENVOY_STREAM_LOG(trace, "encodeData filter iteration aborted due to local reply: filter={}",
-                       *this, (*entry)->filter_context_.config_name);
+                       *this, current_filter.filter_context_.config_name);
       status = FilterDataStatus::StopIterationNoBuffer;
     }
-    if ((*entry)->end_stream_) {
-      (*entry)->handle_->encodeComplete();
+    if (current_filter.end_stream_) {
+      current_filter.handle_->encodeComplete();
     }
     state_.filter_call_state_ &= ~FilterCallState::EncodeData;
     if (end_stream) {
       state_.filter_call_state_ &= ~FilterCallState::EndOfStream;
     }
     ENVOY_STREAM_LOG(trace, "encode data called: filter={} status={}", *this,
-                     (*entry)->filter_context_.config_name, static_cast<uint64_t>(status));
+                     current_filter.filter_context_.config_name, static_cast<uint64_t>(status));
 
     if (!trailers_exists_at_start && filter_manager_callbacks_.responseTrailers() &&
         trailers_added_entry == encoder_filters_.end()) {
       trailers_added_entry = entry;
     }
 
-    if (!(*entry)->commonHandleAfterDataCallback(status, data, state_.encoder_filters_streaming_)) {
+    if (!current_filter.commonHandleAfterDataCallback(status, data,
+                                                      state_.encoder_filters_streaming_)) {
       return;
     }
   }
@@ -1480,6 +1505,8 @@ void FilterManager::encodeTrailers(ActiveStreamEncoderFilter* filter,
     ASSERT(!(state_.filter_call_state_ & FilterCallState::EncodeTrailers));
     state_.filter_call_state_ |= FilterCallState::EncodeTrailers;
     FilterTrailersStatus status = (*entry)->handle_->encodeTrailers(trailers);
+    recordFilterTiming((*entry)->filter_context_.config_name,
+                       FilterChainTimingRecorder::Event::EncodeTrailers);
     (*entry)->handle_->encodeComplete();
     (*entry)->end_stream_ = true;
     state_.filter_call_state_ &= ~FilterCallState::EncodeTrailers;
@@ -18,6 +18,7 @@
 #include "source/common/common/linked_object.h"
 #include "source/common/common/logger.h"
 #include "source/common/grpc/common.h"
+#include "source/common/http/filter_chain_timing.h"
 #include "source/common/http/header_utility.h"
 #include "source/common/http/headers.h"
 #include "source/common/http/matching/data_impl.h"
@@ -705,6 +706,10 @@ public:
 
   std::list<AccessLog::InstanceSharedPtr> accessLogHandlers() { return access_log_handlers_; }
 
+  // Starts recording per-filter timing checkpoints for this stream. The recorder is shared with
+  // the stream's filter state so access loggers can dump it; see FilterChainTimingRecorder.
+  void enableFilterChainTiming();
+
   void onStreamComplete() {
     for (auto filter : filters_) {
       filter->onStreamComplete();
@@ -1024,6 +1029,14 @@ private:
 
   bool stopDecoderFilterChain() { return state_.decoder_filter_chain_aborted_; }
 
+  // Records a checkpoint when a filter callback returns; a branch and no work unless this stream
+  // was sampled for filter chain timing.
+  void recordFilterTiming(absl::string_view filter_name, FilterChainTimingRecorder::Event event) {
+    if (filter_chain_timing_ != nullptr) {
+      filter_chain_timing_->record(filter_name, event);
+    }
+  }
+
   bool isTerminalDecoderFilter(const ActiveStreamDecoderFilter& filter) const;
 
   FilterManagerCallbacks& filter_manager_callbacks_;
@@ -1035,6 +1048,10 @@ private:
   Buffer::BufferMemoryAccountSharedPtr account_;
   const bool proxy_100_continue_;
 
+  // Set when this stream was sampled for filter chain timing; the object is owned by the stream's
+  // filter state.
+  FilterChainTimingRecorder* filter_chain_timing_{nullptr};
+
   std::list<ActiveStreamDecoderFilterPtr> decoder_filters_;
   std::list<ActiveStreamEncoderFilterPtr> encoder_filters_;
   std::list<StreamFilterBase*> filters_;
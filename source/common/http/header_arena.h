@@ -0,0 +1,102 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "source/common/common/assert.h"
+
+#include "absl/container/inlined_vector.h"
+
+namespace Envoy {
+namespace Http {
+
+/**
+ * A simple bump-pointer arena used to back the per-header allocations of a header map.
+ * Allocations are served from a chain of slabs and are never individually freed; all memory is
+ * released wholesale when the arena (and thus the owning header map) is destroyed. This trades a
+ * small amount of slack space for removing a malloc/free pair per header entry on the decode
+ * path.
+ */
+class HeaderArena {
+public:
+  // Sized so a request with a typical number of headers fits in the first slab.
+  static constexpr size_t DefaultSlabSize = 4096;
+
+  /**
+   * Allocate `size` bytes with the given alignment. Alignment must be a power of two and no
+   * larger than alignof(std::max_align_t). Oversized requests get a dedicated slab.
+   */
+  void* allocate(size_t size, size_t alignment) {
+    ASSERT((alignment & (alignment - 1)) == 0);
+    ASSERT(alignment <= alignof(std::max_align_t));
+    const uintptr_t current = reinterpret_cast<uintptr_t>(next_);
+    const uintptr_t aligned = (current + alignment - 1) & ~(alignment - 1);
+    const size_t needed = (aligned - current) + size;
+    if (needed > remaining_) {
+      return allocateSlow(size, alignment);
+    }
+    next_ += needed;
+    remaining_ -= needed;
+    return reinterpret_cast<void*>(aligned);
+  }
+
+private:
+  void* allocateSlow(size_t size, size_t alignment) {
+    const size_t slab_size = std::max(DefaultSlabSize, size + alignment);
+    slabs_.push_back(std::unique_ptr<uint8_t[]>(new uint8_t[slab_size]));
+    next_ = slabs_.back().get();
+    remaining_ = slab_size;
+    return allocate(size, alignment);
+  }
+
+  absl::InlinedVector<std::unique_ptr<uint8_t[]>, 2> slabs_;
+  uint8_t* next_{nullptr};
+  size_t remaining_{0};
+};
+
+/**
+ * Standard library compatible allocator that draws from an optional HeaderArena. With a null
+ * arena it degrades to the global heap, so containers parameterized on this allocator behave
+ * identically to their default-allocator form unless an arena is attached. Deallocation is a
+ * no-op in arena mode; memory is reclaimed when the arena dies.
+ */
+template <class T> class HeaderArenaAllocator {
+public:
+  using value_type = T;
+
+  explicit HeaderArenaAllocator(HeaderArena* arena = nullptr) : arena_(arena) {}
+  template <class U>
+  HeaderArenaAllocator(const HeaderArenaAllocator<U>& other) : arena_(other.arena()) {}
+
+  T* allocate(size_t n) {
+    if (arena_ != nullptr) {
+      return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+    }
+    return static_cast<T*>(::operator new(n * sizeof(T)));
+  }
+
+  void deallocate(T* p, size_t) {
+    if (arena_ == nullptr) {
+      ::operator delete(p);
+    }
+  }
+
+  HeaderArena* arena() const { return arena_; }
+
+private:
+  HeaderArena* arena_;
+};
+
+template <class T, class U>
+bool operator==(const HeaderArenaAllocator<T>& lhs, const HeaderArenaAllocator<U>& rhs) {
+  return lhs.arena() == rhs.arena();
+}
+template <class T, class U>
+bool operator!=(const HeaderArenaAllocator<T>& lhs, const HeaderArenaAllocator<U>& rhs) {
+  return !(lhs == rhs);
+}
+
+} // namespace Http
+} // namespace Envoy
@@ -14,6 +14,7 @@
 #include "source/common/common/compiled_string_map.h"
 #include "source/common/common/non_copyable.h"
 #include "source/common/common/utility.h"
+#include "source/common/http/header_arena.h"
 #include "source/common/http/headers.h"
 #include "source/common/runtime/runtime_features.h"
 
@@ -55,8 +56,9 @@ public:
 class HeaderMapImpl : NonCopyable {
 public:
   HeaderMapImpl(const uint32_t max_headers_kb = UINT32_MAX,
-                const uint32_t max_headers_count = UINT32_MAX)
-      : max_headers_kb_(max_headers_kb), max_headers_count_(max_headers_count) {}
+                const uint32_t max_headers_count = UINT32_MAX, const bool arena_backed = false)
+      : arena_(arena_backed ? std::make_unique<HeaderArena>() : nullptr), headers_(arena_.get()),
+        max_headers_kb_(max_headers_kb), max_headers_count_(max_headers_count) {}
   virtual ~HeaderMapImpl() = default;
 
   // The following "constructors" call virtual functions during construction and must use the
@@ -129,9 +131,12 @@ protected:
 
     HeaderString key_;
     HeaderString value_;
-    std::list<HeaderEntryImpl>::iterator entry_;
+    std::list<HeaderEntryImpl, HeaderArenaAllocator<HeaderEntryImpl>>::iterator entry_;
   };
-  using HeaderNode = std::list<HeaderEntryImpl>::iterator;
+  // The entry list optionally draws its nodes from a HeaderArena owned by the map; with no arena
+  // attached the allocator is equivalent to the default one.
+  using HeaderEntryList = std::list<HeaderEntryImpl, HeaderArenaAllocator<HeaderEntryImpl>>;
+  using HeaderNode = HeaderEntryList::iterator;
 
   /**
    * This is the static lookup table that is used to determine whether a header is one of the O(1)
@@ -210,7 +215,9 @@ protected:
     using HeaderNodeVector = absl::InlinedVector<HeaderNode, 1>;
     using HeaderLazyMap = absl::flat_hash_map<absl::string_view, HeaderNodeVector>;
 
-    HeaderList() : pseudo_headers_end_(headers_.end()) {}
+    explicit HeaderList(HeaderArena* arena = nullptr)
+        : headers_(HeaderArenaAllocator<HeaderEntryImpl>(arena)),
+          pseudo_headers_end_(headers_.end()) {}
 
     template <class Key> bool isPseudoHeader(const Key& key) {
       return !key.getStringView().empty() && key.getStringView()[0] == ':';
@@ -300,12 +307,12 @@ protected:
      */
     size_t remove(absl::string_view key);
 
-    std::list<HeaderEntryImpl>::iterator begin() { return headers_.begin(); }
-    std::list<HeaderEntryImpl>::iterator end() { return headers_.end(); }
-    std::list<HeaderEntryImpl>::const_iterator begin() const { return headers_.begin(); }
-    std::list<HeaderEntryImpl>::const_iterator end() const { return headers_.end(); }
-    std::list<HeaderEntryImpl>::const_reverse_iterator rbegin() const { return headers_.rbegin(); }
-    std::list<HeaderEntryImpl>::const_reverse_iterator rend() const { return headers_.rend(); }
+    HeaderEntryList::iterator begin() { return headers_.begin(); }
+    HeaderEntryList::iterator end() { return headers_.end(); }
+    HeaderEntryList::const_iterator begin() const { return headers_.begin(); }
+    HeaderEntryList::const_iterator end() const { return headers_.end(); }
+    HeaderEntryList::const_reverse_iterator rbegin() const { return headers_.rbegin(); }
+    HeaderEntryList::const_reverse_iterator rend() const { return headers_.rend(); }
     HeaderLazyMap::iterator mapFind(absl::string_view key) { return lazy_map_.find(key); }
     HeaderLazyMap::iterator mapEnd() { return lazy_map_.end(); }
     size_t size() const { return headers_.size(); }
@@ -317,7 +324,7 @@ protected:
     }
 
   private:
-    std::list<HeaderEntryImpl> headers_;
+    HeaderEntryList headers_;
     HeaderNode pseudo_headers_end_;
     HeaderLazyMap lazy_map_;
   };
@@ -340,6 +347,9 @@ protected:
   virtual void clearInline() PURE;
   virtual HeaderEntryImpl** inlineHeaders() PURE;
 
+  // Declared before headers_ so the list (and its nodes) is destroyed before the arena backing
+  // them. Null unless the map was created in arena-backed mode.
+  std::unique_ptr<HeaderArena> arena_;
   HeaderList headers_;
   // TODO(mattklein123): The formatter does not currently get copied when a header map gets
   // copied. This may be problematic in certain cases like request shadowing. This is omitted
@@ -365,8 +375,8 @@ protected:
 template <class Interface> class TypedHeaderMapImpl : public HeaderMapImpl, public Interface {
 public:
   TypedHeaderMapImpl(const uint32_t max_headers_kb = UINT32_MAX,
-                     const uint32_t max_headers_count = UINT32_MAX)
-      : HeaderMapImpl(max_headers_kb, max_headers_count) {}
+                     const uint32_t max_headers_count = UINT32_MAX, const bool arena_backed = false)
+      : HeaderMapImpl(max_headers_kb, max_headers_count, arena_backed) {}
   void setFormatter(StatefulHeaderKeyFormatterPtr&& formatter) {
     formatter_ = std::move(formatter);
   }
@@ -492,9 +502,9 @@ class RequestHeaderMapImpl final : public TypedHeaderMapImpl<RequestHeaderMap>,
 public:
   static std::unique_ptr<RequestHeaderMapImpl>
   create(const uint32_t max_headers_kb = UINT32_MAX,
-         const uint32_t max_headers_count = UINT32_MAX) {
-    return std::unique_ptr<RequestHeaderMapImpl>(
-        new (inlineHeadersSize()) RequestHeaderMapImpl(max_headers_kb, max_headers_count));
+         const uint32_t max_headers_count = UINT32_MAX, const bool arena_backed = false) {
+    return std::unique_ptr<RequestHeaderMapImpl>(new (inlineHeadersSize()) RequestHeaderMapImpl(
+        max_headers_kb, max_headers_count, arena_backed));
   }
 
   INLINE_REQ_STRING_HEADERS(DEFINE_INLINE_HEADER_STRING_FUNCS)
@@ -522,8 +532,9 @@ private:
   using HeaderHandles = ConstSingleton<HeaderHandleValues>;
 
   RequestHeaderMapImpl(const uint32_t max_headers_kb = UINT32_MAX,
-                       const uint32_t max_headers_count = UINT32_MAX)
-      : TypedHeaderMapImpl<RequestHeaderMap>(max_headers_kb, max_headers_count) {
+                       const uint32_t max_headers_count = UINT32_MAX,
+                       const bool arena_backed = false)
+      : TypedHeaderMapImpl<RequestHeaderMap>(max_headers_kb, max_headers_count, arena_backed) {
     clearInline();
   }
 
@@ -149,11 +149,7 @@ bool HeaderUtility::headerNameIsValid(absl::string_view header_key) {
   // However the HTTP/2 codec will NOT convert these to lowercase when serializing the
   // header map, thus producing an invalid request.
   // TODO(yanavlasov): make validation in HTTP/2 case stricter.
-  bool is_valid = true;
-  for (auto iter = header_key.begin(); iter != header_key.end() && is_valid; ++iter) {
-    is_valid &= testCharInTable(kGenericHeaderNameCharTable, *iter);
-  }
-  return is_valid;
+  return kGenericHeaderNameBulkValidator.allCharsInTable(header_key);
 }
 
 bool HeaderUtility::headerNameContainsUnderscore(const absl::string_view header_name) {
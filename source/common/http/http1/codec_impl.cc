@@ -1,6 +1,7 @@
 #include "source/common/http/http1/codec_impl.h"
 
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <string>
 
@@ -144,25 +145,62 @@ void StreamEncoderImpl::encodeHeadersBase(const RequestOrResponseHeaderMap& head
 
   const Http::HeaderValues& header_values = Http::Headers::get();
   bool saw_content_length = false;
-  headers.iterate(
-      [this, &header_values, formatter](const HeaderEntry& header) -> HeaderMap::Iterate {
-        absl::string_view key_to_use = header.key().getStringView();
-        uint32_t key_size_to_use = header.key().size();
-        // Translate :authority -> host so that upper layers do not need to deal with this.
-        if (key_size_to_use > 1 && key_to_use[0] == ':' && key_to_use[1] == 'a') {
-          key_to_use = absl::string_view(header_values.HostLegacy.get());
-          key_size_to_use = header_values.HostLegacy.get().size();
-        }
 
-        // Skip all headers starting with ':' that make it here.
-        if (key_to_use[0] == ':') {
-          return HeaderMap::Iterate::Continue;
-        }
+  // Encode the whole header block into a single pre-sized slice instead of copying each header
+  // into the output buffer individually. The reservation is sized from the header map's tracked
+  // byte size plus the per-header ": " and CRLF separators and the block-terminating CRLF, with
+  // room for the content-length or transfer-encoding header this codec may append below. Headers
+  // that are skipped or shortened during iteration just leave part of the reservation
+  // uncommitted.
+  constexpr uint64_t per_header_overhead = COLON_SPACE.size() + CRLF.size();
+  const uint64_t appended_header_room = header_values.TransferEncoding.get().size() +
+                                        header_values.TransferEncodingValues.Chunked.size() +
+                                        per_header_overhead;
+  Buffer::ReservationSingleSlice reservation = connection_.buffer().reserveSingleSlice(
+      headers.byteSize() + per_header_overhead * headers.size() + appended_header_room +
+      CRLF.size());
+  char* const begin = static_cast<char*>(reservation.slice().mem_);
+  char* const end = begin + reservation.length();
+  char* pos = begin;
+  const auto append = [&pos, end](absl::string_view fragment) {
+    // The reservation is sized for the header map contents; this only fires if a header key
+    // formatter returns a key longer than the one it was given.
+    RELEASE_ASSERT(fragment.size() <= static_cast<uint64_t>(end - pos),
+                   "header block exceeded reserved slice");
+    memcpy(pos, fragment.data(), fragment.size()); // NOLINT(safe-memcpy)
+    pos += fragment.size();
+  };
+  const auto append_formatted_header = [&append, formatter](absl::string_view key,
+                                                            absl::string_view value) {
+    if (formatter.has_value()) {
+      append(formatter->format(key));
+    } else {
+      append(key);
+    }
+    append(COLON_SPACE);
+    append(value);
+    append(CRLF);
+  };
+
+  headers.iterate([&header_values,
+                   &append_formatted_header](const HeaderEntry& header) -> HeaderMap::Iterate {
+    absl::string_view key_to_use = header.key().getStringView();
+    uint32_t key_size_to_use = header.key().size();
+    // Translate :authority -> host so that upper layers do not need to deal with this.
+    if (key_size_to_use > 1 && key_to_use[0] == ':' && key_to_use[1] == 'a') {
+      key_to_use = absl::string_view(header_values.HostLegacy.get());
+      key_size_to_use = header_values.HostLegacy.get().size();
+    }
+
+    // Skip all headers starting with ':' that make it here.
+    if (key_to_use[0] == ':') {
+      return HeaderMap::Iterate::Continue;
+    }
 
-        encodeFormattedHeader(key_to_use, header.value().getStringView(), formatter);
+    append_formatted_header(key_to_use, header.value().getStringView());
 
-        return HeaderMap::Iterate::Continue;
-      });
+    return HeaderMap::Iterate::Continue;
+  });
 
   if (headers.ContentLength()) {
     saw_content_length = true;
@@ -201,7 +239,7 @@ void StreamEncoderImpl::encodeHeadersBase(const RequestOrResponseHeaderMap& head
       // body, per https://tools.ietf.org/html/rfc7230#section-3.3.2
       if (!status || (*status >= 200 && *status != 204)) {
         if (!bodiless_request) {
-          encodeFormattedHeader(header_values.ContentLength.get(), "0", formatter);
+          append_formatted_header(header_values.ContentLength.get(), "0");
         }
       }
       chunk_encoding_ = false;
@@ -211,8 +249,8 @@ void StreamEncoderImpl::encodeHeadersBase(const RequestOrResponseHeaderMap& head
       // For responses to connect requests, do not send the chunked encoding header:
       // https://tools.ietf.org/html/rfc7231#section-4.3.6.
       if (!is_response_to_connect_request_) {
-        encodeFormattedHeader(header_values.TransferEncoding.get(),
-                              header_values.TransferEncodingValues.Chunked, formatter);
+        append_formatted_header(header_values.TransferEncoding.get(),
+                                header_values.TransferEncodingValues.Chunked);
       }
       // We do not apply chunk encoding for HTTP upgrades, including CONNECT style upgrades.
       // If there is a body in a response on the upgrade path, the chunks will be
@@ -226,7 +264,12 @@ void StreamEncoderImpl::encodeHeadersBase(const RequestOrResponseHeaderMap& head
     }
   }
 
-  connection_.buffer().add(CRLF);
+  // The final CRLF terminating the header block is not counted as header bytes, matching the
+  // accounting of the incremental encoding path this replaced.
+  const uint64_t header_bytes = pos - begin;
+  append(CRLF);
+  reservation.commit(pos - begin);
+  bytes_meter_->addHeaderBytesSent(header_bytes);
 
   if (end_stream) {
     endEncode();
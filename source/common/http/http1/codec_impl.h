@@ -544,7 +544,8 @@ private:
   void allocHeaders(StatefulHeaderKeyFormatterPtr&& formatter) override {
     ASSERT(nullptr == absl::get<RequestHeaderMapPtr>(headers_or_trailers_));
     ASSERT(!processing_trailers_);
-    auto headers = RequestHeaderMapImpl::create(max_headers_kb_, max_headers_count_);
+    auto headers = RequestHeaderMapImpl::create(max_headers_kb_, max_headers_count_,
+                                                codec_settings_.use_arena_header_maps_);
     headers->setFormatter(std::move(formatter));
     headers_or_trailers_.emplace<RequestHeaderMapPtr>(std::move(headers));
   }
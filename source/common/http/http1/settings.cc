@@ -40,6 +40,7 @@ Http1Settings parseHttp1Settings(const envoy::config::core::v3::Http1ProtocolOpt
   }
 
   ret.allow_custom_methods_ = config.allow_custom_methods();
+  ret.use_arena_header_maps_ = config.use_arena_backed_header_maps();
 
   return ret;
 }
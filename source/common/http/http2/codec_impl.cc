@@ -354,9 +354,11 @@ void ConnectionImpl::StreamImpl::encodeMetadata(const MetadataMapVector& metadat
   parent_.updateActiveStreamsOnEncode(*this);
   ASSERT(parent_.allow_metadata_);
   NewMetadataEncoder& metadata_encoder = getMetadataEncoder();
-  auto sources_vec = metadata_encoder.createSources(metadata_map_vector);
-  for (auto& source : sources_vec) {
-    parent_.adapter_->SubmitMetadata(stream_id_, 16 * 1024, std::move(source));
+  // Each source is submitted as soon as it is encoded; collecting them into a vector first would
+  // just add an allocation per encodeMetadata() call.
+  for (const auto& metadata_map : metadata_map_vector) {
+    parent_.adapter_->SubmitMetadata(stream_id_, 16 * 1024,
+                                     metadata_encoder.createSource(*metadata_map));
   }
 
   if (parent_.sendPendingFramesAndHandleError()) {
@@ -684,7 +686,7 @@ bool ConnectionImpl::StreamDataFrameSource::Send(absl::string_view frame_header,
 
   stream_.parent_.stats_.pending_send_bytes_.sub(payload_length);
   output.move(*stream_.pending_send_data_, payload_length);
-  stream_.parent_.connection_.write(output, false);
+  stream_.parent_.writeOutboundFragment(output);
   return true;
 }
 
@@ -1407,16 +1409,25 @@ ssize_t ConnectionImpl::onSend(const uint8_t* data, size_t length) {
   addOutboundFrameFragment(buffer, data, length);
 
   // While the buffer is transient the fragment it contains will be moved into the
-  // write_buffer_ of the underlying connection_ by the write method below.
+  // write_buffer_ of the underlying connection_ (possibly via the coalescing buffer owned by the
+  // outermost sendPendingFrames() call, which drains into the connection in the same scope).
   // This creates lifetime dependency between the write_buffer_ of the underlying connection
   // and the codec object. Specifically the write_buffer_ MUST be either fully drained or
   // deleted before the codec object is deleted. This is presently guaranteed by the
   // destruction order of the Network::ConnectionImpl object where write_buffer_ is
   // destroyed before the filter_manager_ which owns the codec through Http::ConnectionManagerImpl.
-  connection_.write(buffer, false);
+  writeOutboundFragment(buffer);
   return length;
 }
 
+void ConnectionImpl::writeOutboundFragment(Buffer::Instance& output) {
+  if (coalescing_write_buffer_ != nullptr) {
+    coalescing_write_buffer_->move(output);
+    return;
+  }
+  connection_.write(output, false);
+}
+
 Status ConnectionImpl::onStreamClose(StreamImpl* stream, uint32_t error_code) {
   if (stream) {
     const int32_t stream_id = stream->stream_id_;
@@ -1576,6 +1587,27 @@ Status ConnectionImpl::sendPendingFrames() {
     return okStatus();
   }
 
+  if (coalescing_write_buffer_ != nullptr) {
+    // Nested send (e.g. for deferred resets): fragments keep accumulating into the outermost
+    // send's buffer and are flushed when it completes.
+    return sendPendingFramesInternal();
+  }
+
+  // Serializing the pending frames produces one visitor callback per frame or fragment, each of
+  // which used to issue its own connection write (and with it a full pass through the network
+  // filter chain). Accumulate the fragments for the duration of the send and hand them to the
+  // connection in one write covering all streams that had frames pending.
+  Buffer::OwnedImpl coalesced_fragments;
+  coalescing_write_buffer_ = &coalesced_fragments;
+  const Status status = sendPendingFramesInternal();
+  coalescing_write_buffer_ = nullptr;
+  if (coalesced_fragments.length() > 0) {
+    connection_.write(coalesced_fragments, false);
+  }
+  return status;
+}
+
+Status ConnectionImpl::sendPendingFramesInternal() {
   const int rc = adapter_->Send();
   if (rc != 0) {
     ASSERT(rc == ERR_CALLBACK_FAILURE);
@@ -1776,7 +1808,7 @@ bool ConnectionImpl::Http2Visitor::SendDataFrame(Http2StreamId stream_id,
 
   connection_->stats_.pending_send_bytes_.sub(payload_length);
   output.move(*stream->pending_send_data_, payload_length);
-  connection_->connection_.write(output, false);
+  connection_->writeOutboundFragment(output);
   return true;
 }
 
@@ -679,6 +679,13 @@ protected:
    * Return true if the disconnect callback has been scheduled.
    */
   bool sendPendingFramesAndHandleError();
+
+  /**
+   * Write a serialized frame fragment to the connection, or accumulate it in the coalescing
+   * buffer when one is active so that all fragments produced by one send are written to the
+   * connection at once. See sendPendingFrames().
+   */
+  void writeOutboundFragment(Buffer::Instance& output);
   void sendSettings(const envoy::config::core::v3::Http2ProtocolOptions& http2_options,
                     bool disable_push);
   void sendSettingsHelper(const envoy::config::core::v3::Http2ProtocolOptions& http2_options,
@@ -804,6 +811,16 @@ private:
   bool slowContainsStreamId(int32_t stream_id) const;
   virtual StreamResetReason getMessagingErrorResetReason() const PURE;
 
+  // Serializes pending frames via the codec adapter and flushes the resulting fragments to the
+  // connection in a single write. Called by sendPendingFrames() which owns the coalescing buffer
+  // for the outermost send.
+  Status sendPendingFramesInternal();
+
+  // When non-null, writeOutboundFragment() accumulates serialized frame fragments here instead of
+  // writing each one to the connection. Points at a buffer on the stack of the outermost
+  // sendPendingFrames() call, which performs the single connection write once the send completes.
+  Buffer::OwnedImpl* coalescing_write_buffer_{};
+
   // Tracks the current slice we're processing in the dispatch loop.
   const Buffer::RawSlice* current_slice_ = nullptr;
   // Streams that are pending deferred reset. Using an ordered map provides determinism in the rare
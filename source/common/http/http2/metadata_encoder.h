@@ -37,9 +37,16 @@ public:
    */
   MetadataSourceVector createSources(const MetadataMapVector& metadata_map_vector);
 
-private:
+  /**
+   * Creates a wire format HTTP/2 header block from a single metadata map. Callers that submit
+   * each source as it is created can use this directly and skip the source vector that
+   * createSources() returns.
+   * @param metadata_map supplies the metadata map to encode.
+   * @return the payload source for the map.
+   */
   std::unique_ptr<http2::adapter::MetadataSource> createSource(const MetadataMap& metadata_map);
 
+private:
   spdy::HpackEncoder deflater_;
 };
 
@@ -11,8 +11,10 @@ const std::chrono::seconds DefaultExpirationTime{1};
 const int MaxConsecutiveBrokenCount = 17;
 } // namespace
 
-Http3StatusTrackerImpl::Http3StatusTrackerImpl(Event::Dispatcher& dispatcher)
-    : expiration_timer_(dispatcher.createTimer([this]() -> void { onExpirationTimeout(); })) {}
+Http3StatusTrackerImpl::Http3StatusTrackerImpl(Event::Dispatcher& dispatcher,
+                                               StateChangedCallback state_changed_callback)
+    : expiration_timer_(dispatcher.createTimer([this]() -> void { onExpirationTimeout(); })),
+      state_changed_callback_(std::move(state_changed_callback)) {}
 
 bool Http3StatusTrackerImpl::isHttp3Broken() const { return state_ == State::Broken; }
 
@@ -23,6 +25,7 @@ bool Http3StatusTrackerImpl::hasHttp3FailedRecently() const {
 }
 
 void Http3StatusTrackerImpl::markHttp3Broken() {
+  const State previous_state = state_;
   state_ = State::Broken;
   if (!expiration_timer_->enabled()) {
     std::chrono::seconds expiration_in_sec =
@@ -33,23 +36,43 @@ void Http3StatusTrackerImpl::markHttp3Broken() {
       ++consecutive_broken_count_;
     }
   }
+  if (previous_state != state_) {
+    onStateChanged();
+  }
 }
 
 void Http3StatusTrackerImpl::markHttp3Confirmed() {
+  const State previous_state = state_;
   state_ = State::Confirmed;
   consecutive_broken_count_ = 0;
   if (expiration_timer_->enabled()) {
     expiration_timer_->disableTimer();
   }
+  if (previous_state != state_) {
+    onStateChanged();
+  }
 }
 
-void Http3StatusTrackerImpl::markHttp3FailedRecently() { state_ = State::FailedRecently; }
+void Http3StatusTrackerImpl::markHttp3FailedRecently() {
+  const State previous_state = state_;
+  state_ = State::FailedRecently;
+  if (previous_state != state_) {
+    onStateChanged();
+  }
+}
 
 void Http3StatusTrackerImpl::onExpirationTimeout() {
   if (state_ != State::Broken) {
     return;
   }
   state_ = State::FailedRecently;
+  onStateChanged();
+}
+
+void Http3StatusTrackerImpl::onStateChanged() {
+  if (state_changed_callback_ != nullptr) {
+    state_changed_callback_();
+  }
 }
 
 } // namespace Http
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 
 #include "envoy/event/dispatcher.h"
@@ -13,7 +14,12 @@ namespace Http {
 // subject to exponential backoff.
 class Http3StatusTrackerImpl : public HttpServerPropertiesCache::Http3StatusTracker {
 public:
-  explicit Http3StatusTrackerImpl(Event::Dispatcher& dispatcher);
+  // Called each time the tracked status changes, e.g. to flush the new status
+  // to persistent storage.
+  using StateChangedCallback = std::function<void()>;
+
+  explicit Http3StatusTrackerImpl(Event::Dispatcher& dispatcher,
+                                  StateChangedCallback state_changed_callback = nullptr);
 
   // Returns true if HTTP/3 is broken.
   bool isHttp3Broken() const override;
@@ -39,11 +45,16 @@ private:
   // Called when the expiration timer fires.
   void onExpirationTimeout();
 
+  // Invokes the state changed callback, if any.
+  void onStateChanged();
+
   State state_{State::Pending};
   // The number of consecutive times HTTP/3 has been marked broken.
   int consecutive_broken_count_{};
   // The timer which tracks when HTTP/3 broken status should expire
   Event::TimerPtr expiration_timer_;
+  // Invoked whenever state_ changes, if set.
+  StateChangedCallback state_changed_callback_;
 };
 
 } // namespace Http
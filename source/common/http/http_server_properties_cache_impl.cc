@@ -57,7 +57,20 @@ std::string HttpServerPropertiesCacheImpl::originDataToStringForCache(const Orig
               .count());
     }
   }
-  absl::StrAppend(&value, "|", data.srtt.count(), "|", data.concurrent_streams);
+  Http3StatusValue h3_status = data.h3_status;
+  if (data.h3_status_tracker != nullptr) {
+    if (data.h3_status_tracker->isHttp3Broken()) {
+      h3_status = Http3StatusValue::Broken;
+    } else if (data.h3_status_tracker->hasHttp3FailedRecently()) {
+      h3_status = Http3StatusValue::FailedRecently;
+    } else if (data.h3_status_tracker->isHttp3Confirmed()) {
+      h3_status = Http3StatusValue::Confirmed;
+    } else {
+      h3_status = Http3StatusValue::Pending;
+    }
+  }
+  absl::StrAppend(&value, "|", data.srtt.count(), "|", data.concurrent_streams, "|",
+                  static_cast<uint32_t>(h3_status));
   return value;
 }
 
@@ -65,7 +78,8 @@ absl::optional<HttpServerPropertiesCacheImpl::OriginData>
 HttpServerPropertiesCacheImpl::originDataFromString(absl::string_view origin_data_string,
                                                     TimeSource& time_source, bool from_cache) {
   const std::vector<absl::string_view> parts = absl::StrSplit(origin_data_string, '|');
-  if (parts.size() != 3) {
+  // Entries written before the HTTP/3 status was persisted have 3 fields.
+  if (parts.size() != 3 && parts.size() != 4) {
     return {};
   }
 
@@ -84,6 +98,15 @@ HttpServerPropertiesCacheImpl::originDataFromString(absl::string_view origin_dat
   }
   data.concurrent_streams = concurrency;
 
+  if (parts.size() == 4) {
+    uint32_t h3_status;
+    if (!absl::SimpleAtoi(parts[3], &h3_status) ||
+        h3_status > static_cast<uint32_t>(Http3StatusValue::Confirmed)) {
+      return {};
+    }
+    data.h3_status = static_cast<Http3StatusValue>(h3_status);
+  }
+
   return data;
 }
 
@@ -134,7 +157,19 @@ HttpServerPropertiesCacheImpl::HttpServerPropertiesCacheImpl(
         if (origin_data->protocols.has_value()) {
           protocols = *origin_data->protocols;
         }
-        OriginDataWithOptRef data(protocols, origin_data->srtt, nullptr,
+        Http3StatusTrackerPtr tracker;
+        if (origin_data->h3_status != Http3StatusValue::Pending) {
+          tracker = createHttp3StatusTracker(*origin);
+          if (origin_data->h3_status == Http3StatusValue::Confirmed) {
+            tracker->markHttp3Confirmed();
+          } else {
+            // A persisted broken status is downgraded to failed recently: the
+            // expiration of the broken period does not survive a restart, but
+            // the next attempt should not wait on HTTP/3 alone either.
+            tracker->markHttp3FailedRecently();
+          }
+        }
+        OriginDataWithOptRef data(protocols, origin_data->srtt, std::move(tracker),
                                   origin_data->concurrent_streams);
         setPropertiesImpl(*origin, data);
       } else {
@@ -285,17 +320,37 @@ HttpServerPropertiesCacheImpl::getOrCreateHttp3StatusTracker(const Origin& origi
   auto entry_it = protocols_.find(origin);
   if (entry_it != protocols_.end()) {
     if (entry_it->second.h3_status_tracker == nullptr) {
-      entry_it->second.h3_status_tracker = std::make_unique<Http3StatusTrackerImpl>(dispatcher_);
+      entry_it->second.h3_status_tracker = createHttp3StatusTracker(origin);
     }
     return *entry_it->second.h3_status_tracker;
   }
 
   OriginDataWithOptRef data;
-  data.h3_status_tracker = std::make_unique<Http3StatusTrackerImpl>(dispatcher_);
+  data.h3_status_tracker = createHttp3StatusTracker(origin);
   auto it = setPropertiesImpl(origin, data);
   return *it->second.h3_status_tracker;
 }
 
+Http3StatusTrackerPtr
+HttpServerPropertiesCacheImpl::createHttp3StatusTracker(const Origin& origin) {
+  // The callback writes status changes through to the key value store so that
+  // HTTP/3 brokenness survives a restart.
+  return std::make_unique<Http3StatusTrackerImpl>(
+      dispatcher_, [this, origin]() { onHttp3StatusChanged(origin); });
+}
+
+void HttpServerPropertiesCacheImpl::onHttp3StatusChanged(const Origin& origin) {
+  if (!key_value_store_) {
+    return;
+  }
+  auto entry_it = protocols_.find(origin);
+  if (entry_it == protocols_.end()) {
+    return;
+  }
+  key_value_store_->addOrUpdate(originToString(origin),
+                                originDataToStringForCache(entry_it->second), absl::nullopt);
+}
+
 void HttpServerPropertiesCacheImpl::resetBrokenness() {
   for (auto& protocol : protocols_) {
     if (protocol.second.h3_status_tracker && protocol.second.h3_status_tracker->isHttp3Broken()) {
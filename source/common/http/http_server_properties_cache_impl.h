@@ -34,6 +34,14 @@ public:
                                 std::unique_ptr<KeyValueStore>&& store, size_t max_entries);
   ~HttpServerPropertiesCacheImpl() override;
 
+  // The HTTP/3 status of an origin as serialized to the key value store.
+  enum class Http3StatusValue : uint8_t {
+    Pending = 0,
+    FailedRecently = 1,
+    Broken = 2,
+    Confirmed = 3,
+  };
+
   // Captures the data tracked per origin;,
   struct OriginData {
     OriginData() = default;
@@ -50,6 +58,10 @@ public:
     Http3StatusTrackerPtr h3_status_tracker;
     // The number of concurrent streams expected to be allowed.
     uint32_t concurrent_streams;
+    // The HTTP/3 status parsed from the key value store. Only used while
+    // loading entries from the cache; at runtime h3_status_tracker is
+    // authoritative.
+    Http3StatusValue h3_status{Http3StatusValue::Pending};
   };
 
   // Converts an Origin to a string which can be parsed by stringToOrigin.
@@ -64,7 +76,9 @@ public:
   // This function also does not do standards-required normalization. Entries requiring
   // normalization will simply not be read from cache.
   // The string format is:
-  // protocols|rtt
+  // protocols|rtt|concurrent_streams|h3_status
+  // where h3_status is absent for entries written before the HTTP/3 status was
+  // persisted.
   static std::string originDataToStringForCache(const OriginData& data);
   // Parse an origin data into structured data, or absl::nullopt
   // if it is empty or invalid.
@@ -143,6 +157,13 @@ private:
   // If `origin` matches a canonical suffix then updates canonical_alt_svc_map_ accordingly.
   void maybeSetCanonicalOrigin(const Origin& origin);
 
+  // Creates an HTTP/3 status tracker which flushes status changes for `origin`
+  // through to the key value store.
+  Http3StatusTrackerPtr createHttp3StatusTracker(const Origin& origin);
+
+  // Writes the current origin data for `origin` to the key value store, if any.
+  void onHttp3StatusChanged(const Origin& origin);
+
   // The key value store, if flushing to persistent storage.
   std::unique_ptr<KeyValueStore> key_value_store_;
 
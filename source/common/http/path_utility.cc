@@ -49,7 +49,11 @@ bool PathUtil::canonicalPath(RequestHeaderMap& headers) {
   if (!query_suffix.empty()) {
     normalized_path.insert(normalized_path.end(), query_suffix.begin(), query_suffix.end());
   }
-  headers.setPath(normalized_path);
+  // Most paths are already in canonical form; skip rewriting the header when normalization was a
+  // no-op.
+  if (normalized_path != original_path) {
+    headers.setPath(normalized_path);
+  }
   return true;
 }
 
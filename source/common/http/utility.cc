@@ -742,7 +742,18 @@ void Utility::encodeLocalReply(const bool& is_reset, PreparedLocalReplyPtr prepa
   prepared_local_reply->encode_headers_(std::move(response_headers), bodyless_response);
   // encode_headers() may have changed the referenced is_reset so we need to test it
   if (!bodyless_response && !is_reset) {
-    Buffer::OwnedImpl buffer(prepared_local_reply->response_body_);
+    // Hand the body to the buffer as an externally owned fragment instead of copying it; large
+    // direct response and local reply bodies would otherwise pay a full copy per response. The
+    // fragment owns the string and frees itself once the buffer has drained.
+    auto* body = new std::string(std::move(prepared_local_reply->response_body_));
+    auto* fragment = new Buffer::BufferFragmentImpl(
+        body->data(), body->size(),
+        [body](const void*, size_t, const Buffer::BufferFragmentImpl* self) {
+          delete body;
+          delete self;
+        });
+    Buffer::OwnedImpl buffer;
+    buffer.addBufferFragment(*fragment);
     prepared_local_reply->encode_data_(buffer, true);
   }
 }
@@ -1165,7 +1176,6 @@ void Utility::transformUpgradeResponseFromH3toH1(ResponseHeaderMap& headers,
 
 std::string Utility::PercentEncoding::encode(absl::string_view value,
                                              absl::string_view reserved_chars) {
-  absl::flat_hash_set<char> reserved_char_set{reserved_chars.begin(), reserved_chars.end()};
   for (size_t i = 0; i < value.size(); ++i) {
     const char& ch = value[i];
     // The escaping characters are defined in
@@ -1173,16 +1183,17 @@ std::string Utility::PercentEncoding::encode(absl::string_view value,
     //
     // We do checking for each char in the string. If the current char is included in the defined
     // escaping characters, we jump to "the slow path" (append the char [encoded or not encoded]
-    // to the returned string one by one) started from the current index.
-    if (ch < ' ' || ch >= '~' || reserved_char_set.find(ch) != reserved_char_set.end()) {
-      return PercentEncoding::encode(value, i, reserved_char_set);
+    // to the returned string one by one) started from the current index. The reserved set is
+    // small, so scanning it directly beats materializing a hash set per call.
+    if (ch < ' ' || ch >= '~' || reserved_chars.find(ch) != absl::string_view::npos) {
+      return PercentEncoding::encode(value, i, reserved_chars);
     }
   }
   return std::string(value);
 }
 
 std::string Utility::PercentEncoding::encode(absl::string_view value, const size_t index,
-                                             const absl::flat_hash_set<char>& reserved_char_set) {
+                                             absl::string_view reserved_chars) {
   std::string encoded;
   if (index > 0) {
     absl::StrAppend(&encoded, value.substr(0, index));
@@ -1190,7 +1201,7 @@ std::string Utility::PercentEncoding::encode(absl::string_view value, const size
 
   for (size_t i = index; i < value.size(); ++i) {
     const char& ch = value[i];
-    if (ch < ' ' || ch >= '~' || reserved_char_set.find(ch) != reserved_char_set.end()) {
+    if (ch < ' ' || ch >= '~' || reserved_chars.find(ch) != absl::string_view::npos) {
       // For consistency, URI producers should use uppercase hexadecimal digits for all
       // percent-encodings. https://tools.ietf.org/html/rfc3986#section-2.1.
       absl::StrAppend(&encoded, fmt::format("%{:02X}", static_cast<const unsigned char&>(ch)));
@@ -180,7 +180,7 @@ public:
 private:
   // Encodes string view to its percent encoded representation, with start index.
   static std::string encode(absl::string_view value, const size_t index,
-                            const absl::flat_hash_set<char>& reserved_char_set);
+                            absl::string_view reserved_chars);
 };
 
 /**
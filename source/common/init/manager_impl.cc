@@ -54,12 +54,17 @@ void ManagerImpl::initialize(const Watcher& watcher) {
     state_ = State::Initializing;
 
     // Attempt to initialize each target. If a target is unavailable, treat it as though it
-    // completed immediately.
+    // completed immediately. Note that targets initialize concurrently: this loop only kicks each
+    // one off, and readiness is signaled asynchronously through watcher_.
     for (const auto& target_handle : target_handles_) {
       if (!target_handle->initialize(watcher_)) {
         onTargetReady(target_handle->name());
       }
     }
+    // The handles are only needed to kick off initialization; targets added while initializing are
+    // invoked directly in add(). Release them now rather than holding the per-target allocations
+    // for the lifetime of the manager.
+    target_handles_.clear();
   }
 }
 
@@ -77,10 +82,11 @@ void ManagerImpl::onTargetReady(absl::string_view target_name) {
   ASSERT(count_ != 0,
          fmt::format("{} called back by target after initialization complete", target_name));
 
-  // Decrease target_name count by 1.
-  ASSERT(target_names_count_.find(target_name) != target_names_count_.end());
-  if (--target_names_count_[target_name] == 0) {
-    target_names_count_.erase(target_name);
+  // Decrease target_name count by 1, with a single hash lookup for the decrement and erase.
+  const auto it = target_names_count_.find(target_name);
+  ASSERT(it != target_names_count_.end());
+  if (--it->second == 0) {
+    target_names_count_.erase(it);
   }
 
   // If there are no uninitialized targets remaining when called back by a target, that means it was
@@ -47,17 +47,17 @@ public:
 
   // Value factory.
   template <typename T> static FieldSharedPtr createValue(T value) {
-    return FieldSharedPtr{new Field(value)}; // NOLINT(modernize-make-shared)
+    return FieldSharedPtr{new Field(std::move(value))}; // NOLINT(modernize-make-shared)
   }
 
   absl::Status append(FieldSharedPtr field_ptr) {
     RETURN_IF_NOT_OK(checkType(Type::Array));
-    value_.array_value_.push_back(field_ptr);
+    value_.array_value_.push_back(std::move(field_ptr));
     return absl::OkStatus();
   }
   absl::Status insert(const std::string& key, FieldSharedPtr field_ptr) {
     RETURN_IF_NOT_OK(checkType(Type::Object));
-    value_.object_value_[key] = field_ptr;
+    value_.object_value_[key] = std::move(field_ptr);
     return absl::OkStatus();
   }
 
@@ -129,7 +129,9 @@ private:
   };
 
   explicit Field(Type type) : type_(type) {}
-  explicit Field(const std::string& value) : type_(Type::String) { value_.string_value_ = value; }
+  explicit Field(std::string value) : type_(Type::String) {
+    value_.string_value_ = std::move(value);
+  }
   explicit Field(int64_t value) : type_(Type::Integer) { value_.integer_value_ = value; }
   explicit Field(double value) : type_(Type::Double) { value_.double_value_ = value; }
   explicit Field(bool value) : type_(Type::Boolean) { value_.boolean_value_ = value; }
@@ -202,7 +204,10 @@ public:
     return handleValueEvent(Field::createValue(value));
   }
   bool null() override { return handleValueEvent(Field::createNull()); }
-  bool string(std::string& value) override { return handleValueEvent(Field::createValue(value)); }
+  bool string(std::string& value) override {
+    // The SAX interface passes a mutable reference so the handler can take the string over.
+    return handleValueEvent(Field::createValue(std::move(value)));
+  }
   bool binary(binary_t&) override { return false; }
   bool parse_error(std::size_t at, const std::string& token,
                    const nlohmann::detail::exception& ex) override {
@@ -655,7 +660,7 @@ bool ObjectHandler::end_object() {
 
 bool ObjectHandler::key(std::string& val) {
   if (state_ == State::ExpectKeyOrEndObject) {
-    key_ = val;
+    key_ = std::move(val);
     state_ = State::ExpectValueOrStartObjectArray;
     return true;
   }
@@ -712,10 +717,10 @@ bool ObjectHandler::handleValueEvent(FieldSharedPtr ptr) {
   switch (state_) {
   case State::ExpectValueOrStartObjectArray:
     state_ = State::ExpectKeyOrEndObject;
-    THROW_IF_NOT_OK(stack_.top()->insert(key_, ptr));
+    THROW_IF_NOT_OK(stack_.top()->insert(key_, std::move(ptr)));
     return true;
   case State::ExpectArrayValueOrEndArray:
-    THROW_IF_NOT_OK(stack_.top()->append(ptr));
+    THROW_IF_NOT_OK(stack_.top()->append(std::move(ptr)));
     return true;
   default:
     return true;
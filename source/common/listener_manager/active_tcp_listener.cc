@@ -24,7 +24,7 @@ ActiveTcpListener::ActiveTcpListener(Network::TcpConnectionHandler& parent,
           parent.createListener(std::move(socket), *this, runtime, random, config, overload_state),
           config),
       tcp_conn_handler_(parent), connection_balancer_(connection_balancer),
-      listen_address_(listen_address) {
+      listen_address_(listen_address), worker_name_(parent.dispatcher().name()) {
   connection_balancer_.registerHandler(*this);
 }
 
@@ -36,7 +36,7 @@ ActiveTcpListener::ActiveTcpListener(Network::TcpConnectionHandler& parent,
                                      Runtime::Loader&)
     : OwnedActiveStreamListenerBase(parent, parent.dispatcher(), std::move(listener), config),
       tcp_conn_handler_(parent), connection_balancer_(connection_balancer),
-      listen_address_(listen_address) {
+      listen_address_(listen_address), worker_name_(parent.dispatcher().name()) {
   connection_balancer_.registerHandler(*this);
 }
 
@@ -5,6 +5,7 @@
 #include "envoy/stream_info/stream_info.h"
 
 #include "source/common/common/linked_object.h"
+#include "source/common/event/loop_liveness_registry.h"
 #include "source/common/listener_manager/active_stream_listener_base.h"
 #include "source/common/listener_manager/active_tcp_socket.h"
 #include "source/server/active_listener_base.h"
@@ -75,6 +76,11 @@ public:
   void post(Network::ConnectionSocketPtr&& socket) override;
   void onAcceptWorker(Network::ConnectionSocketPtr&& socket,
                       bool hand_off_restored_destination_connections, bool rebalanced) override;
+  MonotonicTime::duration timeSinceLastLoopActivity(MonotonicTime now) const override {
+    return Event::LoopLivenessRegistry::instance()
+        .timeSinceLastActivity(worker_name_, now)
+        .value_or(MonotonicTime::duration::zero());
+  }
 
   void newActiveConnection(const Network::FilterChain& filter_chain,
                            Network::ServerConnectionPtr server_conn_ptr,
@@ -96,6 +102,9 @@ public:
   // when rebalancing. The accepted socket can't be used to get the listening address, since
   // the accepted socket's remote address can be another address than the listening address.
   Network::Address::InstanceConstSharedPtr listen_address_;
+  // The name of the worker dispatcher this listener runs on, used to look up the worker's
+  // event-loop liveness when a load-aware balancer asks for it from another thread.
+  const std::string worker_name_;
 };
 
 using ActiveTcpListenerOptRef = absl::optional<std::reference_wrapper<ActiveTcpListener>>;
@@ -129,8 +129,21 @@ absl::Status FilterChainManagerImpl::addFilterChains(
     FilterChainFactoryBuilder& filter_chain_factory_builder,
     FilterChainFactoryContextCreator& context_creator) {
   Cleanup cleanup([this]() { origin_ = absl::nullopt; });
-  absl::node_hash_map<envoy::config::listener::v3::FilterChainMatch, std::string, MessageUtil,
-                      MessageUtil>
+  // Duplicate match detection only needs to live for this call and the match protos outlive it in
+  // filter_chain_span, so key by pointer instead of copying every FilterChainMatch.
+  struct FilterChainMatchPtrHash {
+    size_t operator()(const envoy::config::listener::v3::FilterChainMatch* match) const {
+      return MessageUtil()(*match);
+    }
+  };
+  struct FilterChainMatchPtrEq {
+    bool operator()(const envoy::config::listener::v3::FilterChainMatch* lhs,
+                    const envoy::config::listener::v3::FilterChainMatch* rhs) const {
+      return MessageUtil()(*lhs, *rhs);
+    }
+  };
+  absl::flat_hash_map<const envoy::config::listener::v3::FilterChainMatch*, absl::string_view,
+                      FilterChainMatchPtrHash, FilterChainMatchPtrEq>
       filter_chains;
   uint32_t new_filter_chain_size = 0;
   FilterChainsByName filter_chains_by_name;
@@ -144,7 +157,7 @@ absl::Status FilterChainManagerImpl::addFilterChains(
           absl::StrJoin(addresses_, ",", Network::AddressStrFormatter()), filter_chain->name()));
     }
     if (!filter_chain_matcher) {
-      const auto& matching_iter = filter_chains.find(filter_chain_match);
+      const auto& matching_iter = filter_chains.find(&filter_chain_match);
       if (matching_iter != filter_chains.end()) {
         std::string error_msg =
             fmt::format("error adding listener '{}': filter chain '{}' has "
@@ -159,7 +172,7 @@ absl::Status FilterChainManagerImpl::addFilterChains(
 
         return absl::InvalidArgumentError(error_msg);
       }
-      filter_chains.insert({filter_chain_match, filter_chain->name()});
+      filter_chains.insert({&filter_chain_match, filter_chain->name()});
     }
 
     // Reuse created filter chain if possible.
@@ -580,7 +593,9 @@ const Network::FilterChain* FilterChainManagerImpl::findFilterChainForDestinatio
 const Network::FilterChain* FilterChainManagerImpl::findFilterChainForServerName(
     const ServerNamesMap& server_names_map, const Network::ConnectionSocket& socket) const {
   ASSERT(absl::AsciiStrToLower(socket.requestedServerName()) == socket.requestedServerName());
-  const std::string server_name(socket.requestedServerName());
+  // The maps support heterogeneous lookup, so match on string views to avoid allocating
+  // temporaries on every accept.
+  const absl::string_view server_name = socket.requestedServerName();
 
   // Match on exact server name, i.e. "www.example.com" for "www.example.com".
   const auto server_name_exact_match = server_names_map.find(server_name);
@@ -590,8 +605,8 @@ const Network::FilterChain* FilterChainManagerImpl::findFilterChainForServerName
 
   // Match on all wildcard domains, i.e. ".example.com" and ".com" for "www.example.com".
   size_t pos = server_name.find('.', 1);
-  while (pos < server_name.size() - 1 && pos != std::string::npos) {
-    const std::string wildcard = server_name.substr(pos);
+  while (pos < server_name.size() - 1 && pos != absl::string_view::npos) {
+    const absl::string_view wildcard = server_name.substr(pos);
     const auto server_name_wildcard_match = server_names_map.find(wildcard);
     if (server_name_wildcard_match != server_names_map.end()) {
       return findFilterChainForTransportProtocol(server_name_wildcard_match->second, socket);
@@ -611,10 +626,9 @@ const Network::FilterChain* FilterChainManagerImpl::findFilterChainForServerName
 const Network::FilterChain* FilterChainManagerImpl::findFilterChainForTransportProtocol(
     const TransportProtocolsMap& transport_protocols_map,
     const Network::ConnectionSocket& socket) const {
-  const std::string transport_protocol(socket.detectedTransportProtocol());
-
   // Match on exact transport protocol, e.g. "tls".
-  const auto transport_protocol_match = transport_protocols_map.find(transport_protocol);
+  const auto transport_protocol_match =
+      transport_protocols_map.find(socket.detectedTransportProtocol());
   if (transport_protocol_match != transport_protocols_map.end()) {
     return findFilterChainForApplicationProtocols(transport_protocol_match->second, socket);
   }
@@ -32,13 +32,13 @@ protected:
                   absl::optional<OnMatch<DataType>> on_no_match, absl::Status& creation_status)
       : MapMatcher<DataType>(std::move(data_input), std::move(on_no_match), creation_status) {}
 
-  absl::optional<OnMatch<DataType>> doMatch(const std::string& data) override {
+  const OnMatch<DataType>* doMatch(const std::string& data) override {
     const auto itr = children_.find(data);
     if (itr != children_.end()) {
-      return itr->second;
+      return &itr->second;
     }
 
-    return absl::nullopt;
+    return nullptr;
   }
 
 private:
@@ -31,8 +31,8 @@ public:
       return {MatchState::MatchComplete, on_no_match_};
     }
 
-    const auto result = doMatch(absl::get<std::string>(input.data_));
-    if (result) {
+    const OnMatch<DataType>* result = doMatch(absl::get<std::string>(input.data_));
+    if (result != nullptr) {
       if (result->matcher_) {
         return result->matcher_->match(data);
       } else {
@@ -65,9 +65,11 @@ protected:
   const absl::optional<OnMatch<DataType>> on_no_match_;
 
   // The inner match method. Attempts to match against the resulting data string. If the match
-  // result was determined, the OnMatch will be returned. If a match result was determined to be no
-  // match, {} will be returned.
-  virtual absl::optional<OnMatch<DataType>> doMatch(const std::string& data) PURE;
+  // result was determined, a pointer to the OnMatch owned by this matcher will be returned. If a
+  // match result was determined to be no match, nullptr will be returned. Returning a pointer
+  // avoids copying the OnMatch (and bumping its shared pointer reference counts) on every node
+  // visited during tree traversal.
+  virtual const OnMatch<DataType>* doMatch(const std::string& data) PURE;
 };
 
 } // namespace Matcher
@@ -30,13 +30,10 @@ protected:
                    absl::optional<OnMatch<DataType>> on_no_match, absl::Status& creation_status)
       : MapMatcher<DataType>(std::move(data_input), std::move(on_no_match), creation_status) {}
 
-  absl::optional<OnMatch<DataType>> doMatch(const std::string& data) override {
-    const auto result = children_.findLongestPrefix(data);
-    if (result) {
-      return *result;
-    }
-
-    return absl::nullopt;
+  const OnMatch<DataType>* doMatch(const std::string& data) override {
+    // The trie retains ownership of the shared pointer, so the raw pointer stays valid for the
+    // lifetime of this matcher.
+    return children_.findLongestPrefix(data).get();
   }
 
 private:
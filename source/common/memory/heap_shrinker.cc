@@ -15,8 +15,20 @@ HeapShrinker::HeapShrinker(Event::Dispatcher& dispatcher, Server::OverloadManage
                            Stats::Scope& stats) {
   const auto action_name = Server::OverloadActionNames::get().ShrinkHeap;
   if (overload_manager.registerForAction(
-          action_name, dispatcher,
-          [this](Server::OverloadActionState state) { active_ = state.isSaturated(); })) {
+          action_name, dispatcher, [this](Server::OverloadActionState state) {
+            const bool active = state.isSaturated();
+            if (active == active_) {
+              return;
+            }
+            active_ = active;
+            // Run the release cadence only while the action is saturated instead of waking up
+            // every interval just to check the flag.
+            if (active_) {
+              timer_->enableTimer(kTimerInterval);
+            } else {
+              timer_->disableTimer();
+            }
+          })) {
     Envoy::Stats::StatNameManagedStorage stat_name(
         absl::StrCat("overload.", action_name, ".shrink_count"), stats.symbolTable());
     shrink_counter_ = &stats.counterFromStatName(stat_name.statName());
@@ -24,7 +36,6 @@ HeapShrinker::HeapShrinker(Event::Dispatcher& dispatcher, Server::OverloadManage
       shrinkHeap();
       timer_->enableTimer(kTimerInterval);
     });
-    timer_->enableTimer(kTimerInterval);
   }
 }
 
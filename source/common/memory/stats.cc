@@ -84,7 +84,9 @@ uint64_t Stats::totalPageHeapUnmapped() {
 
 uint64_t Stats::totalPhysicalBytes() {
 #if defined(TCMALLOC)
-  return tcmalloc::MallocExtension::GetProperties()["generic.physical_memory_used"].value;
+  // Read the single property directly; GetProperties() materializes a map of every tcmalloc
+  // property and this accessor runs on every heap shrink check.
+  return tcmalloc::MallocExtension::GetNumericProperty("generic.physical_memory_used").value_or(0);
 #elif defined(GPERFTOOLS_TCMALLOC)
   size_t value = 0;
   MallocExtension::instance()->GetNumericProperty("generic.total_physical_bytes", &value);
@@ -539,6 +539,9 @@ void ConnectionImpl::write(Buffer::Instance& data, bool end_stream, bool through
     // doWriteReady into thinking the socket is connected. On macOS, the underlying write may fail
     // with a connection error if a call to write(2) occurs before the connection is completed.
     if (!connecting_) {
+      // The injected activation is coalesced by the file event: however many times write() runs
+      // within one dispatcher iteration, a single write event fires afterwards and everything
+      // buffered above is flushed to the transport socket with one doWrite() call.
       ioHandle().activateFileEvents(Event::FileReadyType::Write);
     }
   }
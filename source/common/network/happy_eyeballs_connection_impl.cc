@@ -3,6 +3,7 @@
 #include "envoy/network/address.h"
 
 #include "source/common/network/connection_impl.h"
+#include "source/common/runtime/runtime_features.h"
 
 namespace Envoy {
 namespace Network {
@@ -18,7 +19,7 @@ HappyEyeballsConnectionProvider::HappyEyeballsConnectionProvider(
     const absl::optional<envoy::config::cluster::v3::UpstreamConnectionOptions::HappyEyeballsConfig>
         happy_eyeballs_config)
     : dispatcher_(dispatcher),
-      address_list_(sortAddressesWithConfig(address_list, happy_eyeballs_config)),
+      address_list_(buildAddressList(address_list, happy_eyeballs_config, host)),
       upstream_local_address_selector_(upstream_local_address_selector),
       socket_factory_(socket_factory), transport_socket_options_(transport_socket_options),
       host_(host), options_(options) {}
@@ -51,6 +52,18 @@ size_t HappyEyeballsConnectionProvider::nextConnection() { return next_address_;
 
 size_t HappyEyeballsConnectionProvider::totalConnections() { return address_list_.size(); }
 
+void HappyEyeballsConnectionProvider::onConnectionSuccess(ClientConnection& connection) {
+  // There is nothing to learn from hosts with a single address.
+  if (host_ == nullptr || address_list_.size() < 2) {
+    return;
+  }
+  const Address::InstanceConstSharedPtr& remote_address =
+      connection.connectionInfoProvider().remoteAddress();
+  if (remote_address != nullptr) {
+    host_->setLastSuccessfulAddress(remote_address);
+  }
+}
+
 namespace {
 bool hasMatchingAddressFamily(const Address::InstanceConstSharedPtr& a,
                               const Address::InstanceConstSharedPtr& b) {
@@ -162,5 +175,36 @@ HappyEyeballsConnectionProvider::sortAddressesWithConfig(
   return address_list;
 }
 
+std::vector<Address::InstanceConstSharedPtr>
+HappyEyeballsConnectionProvider::prioritizeLastSuccessfulAddress(
+    const std::vector<Address::InstanceConstSharedPtr>& in,
+    const Address::InstanceConstSharedPtr& last_successful_address) {
+  if (last_successful_address == nullptr) {
+    return in;
+  }
+  std::vector<Address::InstanceConstSharedPtr> address_list = in;
+  auto it = std::find_if(address_list.begin(), address_list.end(),
+                         [&](const auto& val) { return *val == *last_successful_address; });
+  if (it != address_list.end() && it != address_list.begin()) {
+    std::rotate(address_list.begin(), it, it + 1);
+  }
+  return address_list;
+}
+
+std::vector<Address::InstanceConstSharedPtr> HappyEyeballsConnectionProvider::buildAddressList(
+    const std::vector<Address::InstanceConstSharedPtr>& address_list,
+    const absl::optional<envoy::config::cluster::v3::UpstreamConnectionOptions::HappyEyeballsConfig>
+        happy_eyeballs_config,
+    const Upstream::HostDescriptionConstSharedPtr& host) {
+  std::vector<Address::InstanceConstSharedPtr> sorted =
+      sortAddressesWithConfig(address_list, happy_eyeballs_config);
+  if (host != nullptr &&
+      Runtime::runtimeFeatureEnabled(
+          "envoy.reloadable_features.happy_eyeballs_prefer_last_successful_address")) {
+    return prioritizeLastSuccessfulAddress(sorted, host->lastSuccessfulAddress());
+  }
+  return sorted;
+}
+
 } // namespace Network
 } // namespace Envoy
@@ -32,6 +32,7 @@ public:
   ClientConnectionPtr createNextConnection(const uint64_t id) override;
   size_t nextConnection() override;
   size_t totalConnections() override;
+  void onConnectionSuccess(ClientConnection& connection) override;
   // Returns a new vector containing the contents of |address_list| sorted
   // with address families interleaved, as per Section 4 of RFC 8305, Happy
   // Eyeballs v2. It is assumed that the list must already be sorted as per
@@ -44,8 +45,25 @@ public:
       const absl::optional<
           envoy::config::cluster::v3::UpstreamConnectionOptions::HappyEyeballsConfig>
           happy_eyeballs_config);
+  // Returns a new vector containing the contents of |address_list| with the
+  // entry matching |last_successful_address| moved to the front, preserving
+  // the relative order of the remaining addresses. Returns the input unchanged
+  // if |last_successful_address| is nullptr or not present in the list.
+  static std::vector<Address::InstanceConstSharedPtr> prioritizeLastSuccessfulAddress(
+      const std::vector<Address::InstanceConstSharedPtr>& address_list,
+      const Address::InstanceConstSharedPtr& last_successful_address);
 
 private:
+  // Sorts |address_list| per the happy eyeballs config and then, if the host
+  // has a recorded last successful address, moves it to the front so repeat
+  // connections try the known-good address first.
+  static std::vector<Address::InstanceConstSharedPtr> buildAddressList(
+      const std::vector<Address::InstanceConstSharedPtr>& address_list,
+      const absl::optional<
+          envoy::config::cluster::v3::UpstreamConnectionOptions::HappyEyeballsConfig>
+          happy_eyeballs_config,
+      const Upstream::HostDescriptionConstSharedPtr& host);
+
   Event::Dispatcher& dispatcher_;
   // List of addresses to attempt to connect to.
   const std::vector<Address::InstanceConstSharedPtr> address_list_;
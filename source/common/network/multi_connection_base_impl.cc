@@ -458,6 +458,7 @@ void MultiConnectionBaseImpl::onEvent(ConnectionEvent event, ConnectionCallbacks
   case ConnectionEvent::Connected: {
     ENVOY_CONN_LOG_EVENT(debug, "multi_connection_cx_ok", "connection={}", *this,
                          connection_provider_->nextConnection());
+    connection_provider_->onConnectionSuccess(wrapper->connection());
     break;
   }
   case ConnectionEvent::LocalClose:
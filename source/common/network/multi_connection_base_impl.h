@@ -47,6 +47,13 @@ public:
    *
    */
   virtual size_t totalConnections() PURE;
+
+  /**
+   * Called with the winning connection once an attempt succeeds. Providers may
+   * use this to record the outcome and bias future attempt ordering. No-op by
+   * default.
+   */
+  virtual void onConnectionSuccess(ClientConnection&) {}
 };
 
 using ConnectionProviderPtr = std::unique_ptr<ConnectionProvider>;
@@ -10,7 +10,11 @@
 #include "source/common/network/io_socket_handle_impl.h"
 #include "source/common/network/win32_socket_handle_impl.h"
 
+#include "source/common/protobuf/utility.h"
+
 #if defined(__linux__) && !defined(__ANDROID_API__)
+#include "source/common/io/io_uring_impl.h"
+#include "source/common/io/io_uring_worker_factory_impl.h"
 #include "source/common/network/io_uring_socket_handle_impl.h"
 #endif
 
@@ -47,7 +51,8 @@ IoHandlePtr SocketInterfaceImpl::makePlatformSpecificSocket(
 IoHandlePtr SocketInterfaceImpl::makeSocket(int socket_fd, bool socket_v6only,
                                             absl::optional<int> domain,
                                             const SocketCreationOptions& options) const {
-  return makePlatformSpecificSocket(socket_fd, socket_v6only, domain, options);
+  return makePlatformSpecificSocket(socket_fd, socket_v6only, domain, options,
+                                    io_uring_worker_factory_.get());
 }
 
 IoHandlePtr SocketInterfaceImpl::socket(Socket::Type socket_type, Address::Type addr_type,
@@ -143,10 +148,31 @@ bool SocketInterfaceImpl::ipFamilySupported(int domain) {
   return SOCKET_VALID(result.return_value_);
 }
 
-Server::BootstrapExtensionPtr
-SocketInterfaceImpl::createBootstrapExtension(const Protobuf::Message&,
-                                              Server::Configuration::ServerFactoryContext&) {
-  return std::make_unique<SocketInterfaceExtension>(*this);
+Server::BootstrapExtensionPtr SocketInterfaceImpl::createBootstrapExtension(
+    const Protobuf::Message& config, Server::Configuration::ServerFactoryContext& context) {
+  const auto& message = MessageUtil::downcastAndValidate<
+      const envoy::extensions::network::socket_interface::v3::DefaultSocketInterface&>(
+      config, context.messageValidationVisitor());
+#if defined(__linux__) && !defined(__ANDROID_API__)
+  if (message.has_io_uring_options()) {
+    if (Io::isIoUringSupported()) {
+      const auto& io_uring_options = message.io_uring_options();
+      io_uring_worker_factory_ = std::make_unique<Io::IoUringWorkerFactoryImpl>(
+          PROTOBUF_GET_WRAPPED_OR_DEFAULT(io_uring_options, io_uring_size, 1000),
+          io_uring_options.enable_submission_queue_polling(),
+          PROTOBUF_GET_WRAPPED_OR_DEFAULT(io_uring_options, read_buffer_size, 8192),
+          PROTOBUF_GET_WRAPPED_OR_DEFAULT(io_uring_options, write_timeout_ms, 1000),
+          context.threadLocal());
+    } else {
+      ENVOY_LOG_MISC(warn, "io_uring socket I/O was configured but is not supported by the "
+                           "running kernel; using the default socket implementation");
+    }
+  }
+#else
+  UNREFERENCED_PARAMETER(message);
+#endif
+  return std::make_unique<DefaultSocketInterfaceExtension>(*this,
+                                                           io_uring_worker_factory_.get());
 }
 
 ProtobufTypes::MessagePtr SocketInterfaceImpl::createEmptyConfigProto() {
@@ -35,6 +35,32 @@ public:
 protected:
   virtual IoHandlePtr makeSocket(int socket_fd, bool socket_v6only, absl::optional<int> domain,
                                  const SocketCreationOptions& options) const;
+
+private:
+  // Non-null iff io_uring was requested in bootstrap and is supported by the running kernel.
+  // Created by createBootstrapExtension(); per worker rings are initialized when the extension
+  // is notified that the server (and thus the worker TLS) is ready.
+  std::unique_ptr<Io::IoUringWorkerFactory> io_uring_worker_factory_;
+};
+
+// Bootstrap extension for the default socket interface; wires per worker io_uring initialization
+// when configured.
+class DefaultSocketInterfaceExtension : public SocketInterfaceExtension {
+public:
+  DefaultSocketInterfaceExtension(SocketInterface& sock_interface,
+                                  Io::IoUringWorkerFactory* io_uring_worker_factory)
+      : SocketInterfaceExtension(sock_interface),
+        io_uring_worker_factory_(io_uring_worker_factory) {}
+
+  // Server::BootstrapExtension
+  void onServerInitialized() override {
+    if (io_uring_worker_factory_ != nullptr) {
+      io_uring_worker_factory_->onWorkerThreadInitialized();
+    }
+  }
+
+private:
+  Io::IoUringWorkerFactory* io_uring_worker_factory_;
 };
 
 DECLARE_FACTORY(SocketInterfaceImpl);
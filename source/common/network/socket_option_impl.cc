@@ -26,8 +26,10 @@ bool SocketOptionImpl::setOption(Socket& socket,
       return true;
     }
 
+    // optname_ was already validated above, so go straight to the socket rather than through
+    // setSocketOption() which would re-check it; this runs per option for every accepted socket.
     const Api::SysCallIntResult result =
-        SocketOptionImpl::setSocketOption(socket, optname_, value_.data(), value_.size());
+        socket.setSocketOption(optname_.level(), optname_.option(), value_.data(), value_.size());
     if (result.return_value_ != 0) {
       ENVOY_LOG(warn, "Setting {} option on socket failed: {}", optname_.name(),
                 errorDetails(result.errno_));
@@ -13,6 +13,7 @@
 #include "source/common/event/file_event_impl.h"
 #include "source/common/network/address_impl.h"
 #include "source/common/network/io_socket_handle_impl.h"
+#include "source/common/runtime/runtime_features.h"
 #include "source/common/runtime/runtime_keys.h"
 
 namespace Envoy {
@@ -127,6 +128,8 @@ TcpListenerImpl::TcpListenerImpl(Event::Dispatcher& dispatcher, Random::RandomGe
                                  Server::ThreadLocalOverloadStateOptRef overload_state)
     : BaseListenerImpl(dispatcher, std::move(socket)), cb_(cb), random_(random), runtime_(runtime),
       bind_to_port_(bind_to_port), reject_fraction_(0.0),
+      defer_accepts_at_full_reject_(Runtime::runtimeFeatureEnabled(
+          "envoy.reloadable_features.tcp_listener_defer_accepts_when_rejecting_all")),
       ignore_global_conn_limit_(ignore_global_conn_limit),
       bypass_overload_manager_(bypass_overload_manager),
       max_connections_to_accept_per_socket_event_(max_connections_to_accept_per_socket_event),
@@ -148,7 +151,10 @@ TcpListenerImpl::TcpListenerImpl(Event::Dispatcher& dispatcher, Random::RandomGe
 
 void TcpListenerImpl::enable() {
   if (bind_to_port_) {
-    socket_->ioHandle().enableFileEvents(Event::FileReadyType::Read);
+    enabled_ = true;
+    if (!acceptsDeferred()) {
+      socket_->ioHandle().enableFileEvents(Event::FileReadyType::Read);
+    }
   } else {
     ENVOY_LOG_MISC(debug, "The listener cannot be enabled since it's not bind to port.");
   }
@@ -156,14 +162,33 @@ void TcpListenerImpl::enable() {
 
 void TcpListenerImpl::disable() {
   if (bind_to_port_) {
+    enabled_ = false;
     socket_->ioHandle().enableFileEvents(0);
   } else {
     ENVOY_LOG_MISC(debug, "The listener cannot be disable since it's not bind to port.");
   }
 }
 
+bool TcpListenerImpl::acceptsDeferred() const {
+  return defer_accepts_at_full_reject_ && reject_fraction_ == UnitFloat::max();
+}
+
 void TcpListenerImpl::setRejectFraction(const UnitFloat reject_fraction) {
+  const bool was_deferring = acceptsDeferred();
   reject_fraction_ = reject_fraction;
+  if (!bind_to_port_) {
+    return;
+  }
+  const bool now_deferring = acceptsDeferred();
+  if (now_deferring && !was_deferring) {
+    // Rejecting every incoming connection with an accept/close pair costs a syscall pair and an
+    // RST per connection while overloaded. Stop reading from the listen socket instead: pending
+    // connections stay in the kernel accept queue and, once it fills, the kernel drops new SYNs
+    // without any work on this thread.
+    socket_->ioHandle().enableFileEvents(0);
+  } else if (was_deferring && !now_deferring && enabled_) {
+    socket_->ioHandle().enableFileEvents(Event::FileReadyType::Read);
+  }
 }
 
 void TcpListenerImpl::configureLoadShedPoints(
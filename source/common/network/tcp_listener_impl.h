@@ -42,10 +42,19 @@ private:
   // rejected/closed. If the accepted socket is to be admitted, false is returned.
   bool rejectCxOverGlobalLimit() const;
 
+  // Returns true if the listener is rejecting all incoming connections and should therefore stop
+  // reading from the listen socket, leaving pending connections in the kernel accept queue where
+  // the kernel sheds them cheaply, instead of paying for an accept/close pair per connection.
+  bool acceptsDeferred() const;
+
   Random::RandomGenerator& random_;
   Runtime::Loader& runtime_;
   bool bind_to_port_;
   UnitFloat reject_fraction_;
+  // Tracks enable()/disable() calls so that clearing a saturated reject fraction does not turn
+  // read events back on for a listener that was disabled for other reasons.
+  bool enabled_{true};
+  const bool defer_accepts_at_full_reject_;
   const bool ignore_global_conn_limit_;
   const bool bypass_overload_manager_;
   const uint32_t max_connections_to_accept_per_socket_event_;
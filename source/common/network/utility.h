@@ -58,7 +58,10 @@ public:
 };
 
 static const uint64_t DEFAULT_UDP_MAX_DATAGRAM_SIZE = 1500;
-static const uint64_t NUM_DATAGRAMS_PER_RECEIVE = 16;
+// Number of datagrams read per recvmmsg() call (and the sizing factor of the receive buffer for
+// GRO reads). Reading 32 datagrams per syscall amortizes the syscall and dispatch overhead across
+// a busy socket's burst while keeping the per-read buffer reservation modest (32 x 1500B).
+static const uint64_t NUM_DATAGRAMS_PER_RECEIVE = 32;
 static const uint64_t MAX_NUM_PACKETS_PER_EVENT_LOOP = 6000;
 
 /**
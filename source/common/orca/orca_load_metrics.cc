@@ -72,8 +72,96 @@ void scanOrcaLoadReport(const LrsReportMetricNames& metric_names,
   }
 }
 
+void scanOrcaLoadReportMetricsMap(const Protobuf::Map<std::string, double>& metrics_map,
+                                  const LoadReportMetricSelector& selector,
+                                  OnLoadReportMetricFn on_load_report_metric) {
+  if (selector.wildcard_) {
+    // Strip the trailing "*" from the configured name to rebuild per-entry metric names.
+    const absl::string_view prefix =
+        absl::string_view(selector.name_).substr(0, selector.name_.size() - 1);
+    for (const auto& [key, value] : metrics_map) {
+      on_load_report_metric(absl::StrCat(prefix, key), value);
+    }
+    return;
+  }
+  const auto metric_it = metrics_map.find(selector.key_);
+  if (metric_it != metrics_map.end()) {
+    on_load_report_metric(selector.name_, metric_it->second);
+  }
+}
+
+void scanOrcaLoadReport(const LoadReportMetricSelectors& selectors,
+                        const xds::data::orca::v3::OrcaLoadReport& report,
+                        OnLoadReportMetricFn on_load_report_metric) {
+  for (const LoadReportMetricSelector& selector : selectors) {
+    switch (selector.type_) {
+    case LoadReportMetricSelector::Type::ApplicationUtilization:
+      on_load_report_metric(selector.name_, report.application_utilization());
+      break;
+    case LoadReportMetricSelector::Type::CpuUtilization:
+      on_load_report_metric(selector.name_, report.cpu_utilization());
+      break;
+    case LoadReportMetricSelector::Type::MemUtilization:
+      on_load_report_metric(selector.name_, report.mem_utilization());
+      break;
+    case LoadReportMetricSelector::Type::Eps:
+      on_load_report_metric(selector.name_, report.eps());
+      break;
+    case LoadReportMetricSelector::Type::RpsFractional:
+      on_load_report_metric(selector.name_, report.rps_fractional());
+      break;
+    case LoadReportMetricSelector::Type::NamedMetric:
+      scanOrcaLoadReportMetricsMap(report.named_metrics(), selector, on_load_report_metric);
+      break;
+    case LoadReportMetricSelector::Type::Utilization:
+      scanOrcaLoadReportMetricsMap(report.utilization(), selector, on_load_report_metric);
+      break;
+    case LoadReportMetricSelector::Type::RequestCost:
+      scanOrcaLoadReportMetricsMap(report.request_cost(), selector, on_load_report_metric);
+      break;
+    case LoadReportMetricSelector::Type::Unknown:
+      break;
+    }
+  }
+}
+
 } // namespace
 
+LoadReportMetricSelectors parseLoadReportMetricNames(const LrsReportMetricNames& metric_names) {
+  LoadReportMetricSelectors selectors;
+  selectors.reserve(metric_names.size());
+  for (const std::string& metric_name : metric_names) {
+    LoadReportMetricSelector selector;
+    selector.name_ = metric_name;
+    if (metric_name == kApplicationUtilizationField) {
+      selector.type_ = LoadReportMetricSelector::Type::ApplicationUtilization;
+    } else if (metric_name == kCpuUtilizationField) {
+      selector.type_ = LoadReportMetricSelector::Type::CpuUtilization;
+    } else if (metric_name == kMemUtilizationField) {
+      selector.type_ = LoadReportMetricSelector::Type::MemUtilization;
+    } else if (metric_name == kEpsField) {
+      selector.type_ = LoadReportMetricSelector::Type::Eps;
+    } else if (metric_name == kRpsFractionalField) {
+      selector.type_ = LoadReportMetricSelector::Type::RpsFractional;
+    } else if (absl::StartsWith(metric_name, kNamedMetricsFieldPrefix)) {
+      selector.type_ = LoadReportMetricSelector::Type::NamedMetric;
+      selector.key_ = metric_name.substr(kNamedMetricsFieldPrefix.size());
+    } else if (absl::StartsWith(metric_name, kUtilizationFieldPrefix)) {
+      selector.type_ = LoadReportMetricSelector::Type::Utilization;
+      selector.key_ = metric_name.substr(kUtilizationFieldPrefix.size());
+    } else if (absl::StartsWith(metric_name, kRequestCostFieldPrefix)) {
+      selector.type_ = LoadReportMetricSelector::Type::RequestCost;
+      selector.key_ = metric_name.substr(kRequestCostFieldPrefix.size());
+    }
+    if (selector.key_ == "*") {
+      selector.wildcard_ = true;
+      selector.key_.clear();
+    }
+    selectors.push_back(std::move(selector));
+  }
+  return selectors;
+}
+
 void addOrcaLoadReportToLoadMetricStats(const LrsReportMetricNames& metric_names,
                                         const xds::data::orca::v3::OrcaLoadReport& report,
                                         Upstream::LoadMetricStats& stats) {
@@ -93,5 +181,15 @@ double getMaxUtilization(const LrsReportMetricNames& metric_names,
   return max_utilization;
 }
 
+double getMaxUtilization(const LoadReportMetricSelectors& selectors,
+                         const xds::data::orca::v3::OrcaLoadReport& report) {
+  double max_utilization = 0;
+  scanOrcaLoadReport(selectors, report,
+                     [&max_utilization](absl::string_view, double metric_value) {
+                       max_utilization = std::max<double>(max_utilization, metric_value);
+                     });
+  return max_utilization;
+}
+
 } // namespace Orca
 } // namespace Envoy
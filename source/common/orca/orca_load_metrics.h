@@ -10,6 +10,37 @@ namespace Orca {
 // List of metric names to report to the LRS.
 typedef std::vector<std::string> LrsReportMetricNames;
 
+// A configured metric name parsed into its dispatch type, so that scanning a load report does not
+// re-match the metric name strings for every report. Build once with parseLoadReportMetricNames()
+// and reuse for each report.
+struct LoadReportMetricSelector {
+  enum class Type {
+    ApplicationUtilization,
+    CpuUtilization,
+    MemUtilization,
+    Eps,
+    RpsFractional,
+    NamedMetric,
+    Utilization,
+    RequestCost,
+    // Metric names that match no known field are ignored, matching the behavior of the
+    // name-based scan.
+    Unknown,
+  };
+
+  Type type_{Type::Unknown};
+  // The configured metric name, e.g. "named_metrics.foo".
+  std::string name_;
+  // Lookup key for the map-backed types, e.g. "foo"; empty for scalar fields and wildcards.
+  std::string key_;
+  // True when a map-backed selector is a "<prefix>.*" wildcard that reports every entry.
+  bool wildcard_{false};
+};
+using LoadReportMetricSelectors = std::vector<LoadReportMetricSelector>;
+
+// Parses `metric_names` into selectors usable by the overloads below.
+LoadReportMetricSelectors parseLoadReportMetricNames(const LrsReportMetricNames& metric_names);
+
 // Adds metrics with `metric_names` from the `report` to the `stats`.
 void addOrcaLoadReportToLoadMetricStats(const LrsReportMetricNames& metric_names,
                                         const xds::data::orca::v3::OrcaLoadReport& report,
@@ -19,5 +50,10 @@ void addOrcaLoadReportToLoadMetricStats(const LrsReportMetricNames& metric_names
 double getMaxUtilization(const LrsReportMetricNames& metric_names,
                          const xds::data::orca::v3::OrcaLoadReport& report);
 
+// As above, but driven by pre-parsed selectors; preferred on paths that scan a report per
+// response or per probe.
+double getMaxUtilization(const LoadReportMetricSelectors& selectors,
+                         const xds::data::orca::v3::OrcaLoadReport& report);
+
 } // namespace Orca
 } // namespace Envoy
@@ -16,6 +16,7 @@
 #include "source/common/protobuf/visitor.h"
 #include "source/common/runtime/runtime_features.h"
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/strings/match.h"
 #include "udpa/annotations/sensitive.pb.h"
 #include "udpa/annotations/status.pb.h"
@@ -281,6 +282,18 @@ public:
       : validation_visitor_(validation_visitor), runtime_(runtime) {}
 
   void onField(const Protobuf::Message& message, const Protobuf::FieldDescriptor& field) override {
+    // Whether a field can produce a deprecation or work-in-progress warning is a property of the
+    // field descriptor, not the message instance. Memoize it so that large repeated lists (which
+    // visit the same handful of descriptors once per element) skip all reflection work on fields
+    // that can never warn.
+    const auto cache_itr = field_inspection_cache_.try_emplace(&field, false);
+    if (cache_itr.second) {
+      cache_itr.first->second = fieldNeedsInspection(field);
+    }
+    if (!cache_itr.first->second) {
+      return;
+    }
+
     Protobuf::ReflectableMessage reflectable_message = createReflectableMessage(message);
     const Protobuf::Reflection* reflection = reflectable_message->GetReflection();
     absl::string_view filename = filenameFromPath(field.file()->name());
@@ -363,8 +376,27 @@ public:
   }
 
 private:
+  // Returns true if the field could ever produce a warning: it is deprecated, marked
+  // work-in-progress, or is a non-repeated enum whose type has at least one deprecated value.
+  static bool fieldNeedsInspection(const Protobuf::FieldDescriptor& field) {
+    if (field.options().deprecated() ||
+        field.options().GetExtension(xds::annotations::v3::field_status).work_in_progress()) {
+      return true;
+    }
+    if (!field.is_repeated() && field.cpp_type() == Protobuf::FieldDescriptor::CPPTYPE_ENUM) {
+      const Protobuf::EnumDescriptor* enum_descriptor = field.enum_type();
+      for (int i = 0; i < enum_descriptor->value_count(); ++i) {
+        if (enum_descriptor->value(i)->options().deprecated()) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
   ProtobufMessage::ValidationVisitor& validation_visitor_;
   Runtime::Loader* runtime_;
+  absl::flat_hash_map<const Protobuf::FieldDescriptor*, bool> field_inspection_cache_;
 };
 
 } // namespace
@@ -417,6 +449,47 @@ void MessageUtil::validateDurationFields(const Protobuf::Message& message, bool
 
 namespace {
 
+// Runs the unexpected field and duration checks in a single pass over the message tree.
+class UnexpectedFieldAndDurationProtoVisitor : public ProtobufMessage::ConstProtoVisitor {
+public:
+  UnexpectedFieldAndDurationProtoVisitor(ProtobufMessage::ValidationVisitor& validation_visitor,
+                                         Runtime::Loader* runtime)
+      : unexpected_field_visitor_(validation_visitor, runtime) {}
+
+  void onField(const Protobuf::Message& message, const Protobuf::FieldDescriptor& field) override {
+    unexpected_field_visitor_.onField(message, field);
+  }
+
+  absl::Status onMessage(const Protobuf::Message& message,
+                         absl::Span<const Protobuf::Message* const> parents,
+                         bool was_any_or_top_level) override {
+    RETURN_IF_NOT_OK(unexpected_field_visitor_.onMessage(message, parents, was_any_or_top_level));
+    return duration_field_visitor_.onMessage(message, parents, was_any_or_top_level);
+  }
+
+private:
+  UnexpectedFieldProtoVisitor unexpected_field_visitor_;
+  DurationFieldProtoVisitor duration_field_visitor_;
+};
+
+} // namespace
+
+void MessageUtil::checkUnexpectedAndDurationFields(
+    const Protobuf::Message& message, ProtobufMessage::ValidationVisitor& validation_visitor,
+    bool recurse_into_any) {
+  if (!Runtime::runtimeFeatureEnabled("envoy.reloadable_features.strict_duration_validation")) {
+    checkForUnexpectedFields(message, validation_visitor, recurse_into_any);
+    return;
+  }
+  Runtime::Loader* runtime = validation_visitor.runtime().has_value()
+                                 ? &validation_visitor.runtime().value().get()
+                                 : nullptr;
+  UnexpectedFieldAndDurationProtoVisitor visitor(validation_visitor, runtime);
+  THROW_IF_NOT_OK(ProtobufMessage::traverseMessage(visitor, message, recurse_into_any));
+}
+
+namespace {
+
 class PgvCheckVisitor : public ProtobufMessage::ConstProtoVisitor {
 public:
   absl::Status onMessage(const Protobuf::Message& message,
@@ -917,7 +990,8 @@ void MessageUtil::loadFromFile(const std::string& path, Protobuf::Message& messa
                                Api::Api& api) {
   auto file_or_error = api.fileSystem().fileReadToEnd(path);
   THROW_IF_NOT_OK_REF(file_or_error.status());
-  const std::string contents = file_or_error.value();
+  // Move rather than copy; config files can be tens of megabytes.
+  const std::string contents = std::move(file_or_error.value());
   // If the filename ends with .pb, attempt to parse it as a binary proto.
   if (absl::EndsWithIgnoreCase(path, FileExtensions::get().ProtoBinary)) {
     // Attempt to parse the binary format.
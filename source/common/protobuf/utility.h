@@ -302,6 +302,19 @@ public:
   static void validateDurationFields(const Protobuf::Message& message,
                                      bool recurse_into_any = false);
 
+  /**
+   * Performs the unexpected field and duration field checks in a single traversal of the
+   * message tree, instead of one walk per check.
+   * @param message message to validate.
+   * @param validation_visitor the validation visitor to use.
+   * @param recurse_into_any whether to recurse into Any messages during unexpected checking.
+   * @throw EnvoyException if either check fails.
+   */
+  static void
+  checkUnexpectedAndDurationFields(const Protobuf::Message& message,
+                                   ProtobufMessage::ValidationVisitor& validation_visitor,
+                                   bool recurse_into_any = false);
+
   /**
    * Perform a PGV check on the entire message tree, recursing into Any messages as needed.
    */
@@ -321,19 +334,16 @@ public:
   static void validate(const MessageType& message,
                        ProtobufMessage::ValidationVisitor& validation_visitor,
                        bool recurse_into_any = false) {
-    // TODO(adisuissa): There are multiple recursive traversals done by the
-    // calls in this function. This can be refactored into a single recursive
-    // traversal that invokes the various validators.
-
-    // Log warnings or throw errors if deprecated fields or unknown fields are in use.
+    // Log warnings or throw errors if deprecated fields or unknown fields are in use, and throw
+    // an exception if the config has an invalid Duration field. The duration check is needed
+    // because Envoy validates the duration in a strict way that is not supported by PGV. Both
+    // checks share a single traversal of the message tree.
     if (!validation_visitor.skipValidation()) {
-      checkForUnexpectedFields(message, validation_visitor, recurse_into_any);
+      checkUnexpectedAndDurationFields(message, validation_visitor, recurse_into_any);
+    } else {
+      validateDurationFields(message, recurse_into_any);
     }
 
-    // Throw an exception if the config has an invalid Duration field. This is needed
-    // because Envoy validates the duration in a strict way that is not supported by PGV.
-    validateDurationFields(message, recurse_into_any);
-
     // TODO(mattklein123): This will recurse the message twice, once above and once for PGV. When
     // we move to always recursing, satisfying the TODO below, we should merge into a single
     // recursion for performance reasons.
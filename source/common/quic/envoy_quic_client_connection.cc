@@ -4,14 +4,34 @@
 
 #include "envoy/config/core/v3/base.pb.h"
 
+#include "source/common/api/os_sys_calls_impl.h"
 #include "source/common/network/socket_option_factory.h"
 #include "source/common/network/udp_packet_writer_handler_impl.h"
 #include "source/common/quic/envoy_quic_utils.h"
+#include "source/common/quic/udp_gso_batch_writer.h"
 #include "source/common/runtime/runtime_features.h"
 
 namespace Envoy {
 namespace Quic {
 
+namespace {
+
+// Creates the packet writer for a client connection socket. When the kernel supports UDP GSO, use
+// QUICHE's GSO batch writer so that bursts of packets to the peer are segmented by the kernel and
+// leave in a single sendmsg(); otherwise fall back to one sendmsg() per packet.
+std::unique_ptr<quic::QuicPacketWriter> createPacketWriter(Network::IoHandle& io_handle) {
+#if UDP_GSO_BATCH_WRITER_COMPILETIME_SUPPORT
+  if (Runtime::runtimeFeatureEnabled("envoy.reloadable_features.quic_client_udp_gso") &&
+      Api::OsSysCallsSingleton::get().supportsUdpGso()) {
+    return std::make_unique<quic::QuicGsoBatchWriter>(io_handle.fdDoNotUse());
+  }
+#endif
+  return std::make_unique<EnvoyQuicPacketWriter>(
+      std::make_unique<Network::UdpDefaultWriter>(io_handle));
+}
+
+} // namespace
+
 // Used to defer deleting connection socket to avoid deleting IoHandle in a read loop.
 class DeferredDeletableSocket : public Event::DeferredDeletable {
 public:
@@ -42,12 +62,10 @@ EnvoyQuicClientConnection::EnvoyQuicClientConnection(
     quic::QuicAlarmFactory& alarm_factory, const quic::ParsedQuicVersionVector& supported_versions,
     Event::Dispatcher& dispatcher, Network::ConnectionSocketPtr&& connection_socket,
     quic::ConnectionIdGeneratorInterface& generator, const bool prefer_gro)
-    : EnvoyQuicClientConnection(
-          server_connection_id, helper, alarm_factory,
-          new EnvoyQuicPacketWriter(
-              std::make_unique<Network::UdpDefaultWriter>(connection_socket->ioHandle())),
-          /*owns_writer=*/true, supported_versions, dispatcher, std::move(connection_socket),
-          generator, prefer_gro) {}
+    : EnvoyQuicClientConnection(server_connection_id, helper, alarm_factory,
+                                createPacketWriter(connection_socket->ioHandle()).release(),
+                                /*owns_writer=*/true, supported_versions, dispatcher,
+                                std::move(connection_socket), generator, prefer_gro) {}
 
 EnvoyQuicClientConnection::EnvoyQuicClientConnection(
     const quic::QuicConnectionId& server_connection_id, quic::QuicConnectionHelperInterface& helper,
@@ -139,8 +157,7 @@ void EnvoyQuicClientConnection::setUpConnectionSocket(Network::ConnectionSocket&
 
 void EnvoyQuicClientConnection::switchConnectionSocket(
     Network::ConnectionSocketPtr&& connection_socket) {
-  auto writer = std::make_unique<EnvoyQuicPacketWriter>(
-      std::make_unique<Network::UdpDefaultWriter>(connection_socket->ioHandle()));
+  auto writer = createPacketWriter(connection_socket->ioHandle());
   quic::QuicSocketAddress self_address = envoyIpAddressToQuicSocketAddress(
       connection_socket->connectionInfoProvider().localAddress()->ip());
   quic::QuicSocketAddress peer_address = envoyIpAddressToQuicSocketAddress(
@@ -187,8 +204,7 @@ void EnvoyQuicClientConnection::probeWithNewPort(const quic::QuicSocketAddress&
                                   : quicAddressToEnvoyAddressInstance(peer_addr),
       new_local_address, connectionSocket()->options(), prefer_gro_);
   setUpConnectionSocket(*probing_socket, delegate_);
-  auto writer = std::make_unique<EnvoyQuicPacketWriter>(
-      std::make_unique<Network::UdpDefaultWriter>(probing_socket->ioHandle()));
+  auto writer = createPacketWriter(probing_socket->ioHandle());
   quic::QuicSocketAddress self_address = envoyIpAddressToQuicSocketAddress(
       probing_socket->connectionInfoProvider().localAddress()->ip());
 
@@ -287,7 +303,7 @@ void EnvoyQuicClientConnection::setNumPtosForPortMigration(uint32_t num_ptos_for
 
 EnvoyQuicClientConnection::EnvoyQuicPathValidationContext::EnvoyQuicPathValidationContext(
     const quic::QuicSocketAddress& self_address, const quic::QuicSocketAddress& peer_address,
-    std::unique_ptr<EnvoyQuicPacketWriter> writer,
+    std::unique_ptr<quic::QuicPacketWriter> writer,
     std::unique_ptr<Network::ConnectionSocket> probing_socket)
     : QuicPathValidationContext(self_address, peer_address), writer_(std::move(writer)),
       socket_(std::move(probing_socket)) {}
@@ -299,7 +315,7 @@ quic::QuicPacketWriter* EnvoyQuicClientConnection::EnvoyQuicPathValidationContex
   return writer_.get();
 }
 
-EnvoyQuicPacketWriter* EnvoyQuicClientConnection::EnvoyQuicPathValidationContext::releaseWriter() {
+quic::QuicPacketWriter* EnvoyQuicClientConnection::EnvoyQuicPathValidationContext::releaseWriter() {
   return writer_.release();
 }
 
@@ -32,21 +32,21 @@ public:
   public:
     EnvoyQuicPathValidationContext(const quic::QuicSocketAddress& self_address,
                                    const quic::QuicSocketAddress& peer_address,
-                                   std::unique_ptr<EnvoyQuicPacketWriter> writer,
+                                   std::unique_ptr<quic::QuicPacketWriter> writer,
                                    std::unique_ptr<Network::ConnectionSocket> probing_socket);
 
     ~EnvoyQuicPathValidationContext() override;
 
     quic::QuicPacketWriter* WriterToUse() override;
 
-    EnvoyQuicPacketWriter* releaseWriter();
+    quic::QuicPacketWriter* releaseWriter();
 
     Network::ConnectionSocket& probingSocket();
 
     std::unique_ptr<Network::ConnectionSocket> releaseSocket();
 
   private:
-    std::unique_ptr<EnvoyQuicPacketWriter> writer_;
+    std::unique_ptr<quic::QuicPacketWriter> writer_;
     Network::ConnectionSocketPtr socket_;
   };
 
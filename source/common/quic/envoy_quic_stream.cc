@@ -26,7 +26,24 @@ void EnvoyQuicStream::encodeData(Buffer::Instance& data, bool end_stream) {
 #ifdef ENVOY_ENABLE_HTTP_DATAGRAMS
   if (http_datagram_handler_) {
     IncrementalBytesSentTracker tracker(quic_stream_, *mutableBytesMeter(), false);
-    if (!http_datagram_handler_->encodeCapsuleFragment(data.toString(), end_stream)) {
+    // The capsule parser ingests fragments incrementally, so feed it one slice at a time rather
+    // than flattening the buffer into a single string.
+    const Buffer::RawSliceVector raw_slices = data.getRawSlices();
+    bool encoded = true;
+    if (raw_slices.empty()) {
+      encoded = http_datagram_handler_->encodeCapsuleFragment(absl::string_view(), end_stream);
+    } else {
+      for (size_t i = 0; i < raw_slices.size(); ++i) {
+        const bool last_slice = (i == raw_slices.size() - 1);
+        encoded = http_datagram_handler_->encodeCapsuleFragment(
+            absl::string_view(static_cast<const char*>(raw_slices[i].mem_), raw_slices[i].len_),
+            last_slice && end_stream);
+        if (!encoded) {
+          break;
+        }
+      }
+    }
+    if (!encoded) {
       quic_stream_.Reset(quic::QUIC_BAD_APPLICATION_PAYLOAD);
       return;
     }
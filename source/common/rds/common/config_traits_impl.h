@@ -19,6 +19,9 @@ public:
     return std::make_shared<const NullConfigImpl>();
   }
 
+  // Bring in the previous-config-aware overload which simply ignores the previous config.
+  using ConfigTraits::createConfig;
+
   ConfigConstSharedPtr createConfig(const Protobuf::Message& rc,
                                     Server::Configuration::ServerFactoryContext& context,
                                     bool validate_clusters_default) const override {
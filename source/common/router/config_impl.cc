@@ -1172,27 +1172,23 @@ std::unique_ptr<HedgePolicyImpl> RouteEntryImplBase::buildHedgePolicy(
   return nullptr;
 }
 
-absl::StatusOr<std::unique_ptr<RetryPolicyImpl>> RouteEntryImplBase::buildRetryPolicy(
-    RetryPolicyConstOptRef vhost_retry_policy,
+absl::StatusOr<std::shared_ptr<const RetryPolicyImpl>> RouteEntryImplBase::buildRetryPolicy(
+    const std::shared_ptr<const RetryPolicyImpl>& vhost_retry_policy,
     const envoy::config::route::v3::RouteAction& route_config,
     ProtobufMessage::ValidationVisitor& validation_visitor,
     Server::Configuration::ServerFactoryContext& factory_context) const {
-  Upstream::RetryExtensionFactoryContextImpl retry_factory_context(
-      factory_context.singletonManager());
   // Route specific policy wins, if available.
   if (route_config.has_retry_policy()) {
+    Upstream::RetryExtensionFactoryContextImpl retry_factory_context(
+        factory_context.singletonManager());
     return RetryPolicyImpl::create(route_config.retry_policy(), validation_visitor,
                                    retry_factory_context, factory_context);
   }
 
-  // If not, we fallback to the virtual host policy if there is one.
-  if (vhost_retry_policy.has_value()) {
-    return RetryPolicyImpl::create(*vhost_retry_policy, validation_visitor, retry_factory_context,
-                                   factory_context);
-  }
-
-  // Otherwise, an empty policy will do.
-  return nullptr;
+  // If not, we fallback to the virtual host policy if there is one. The virtual host policy is
+  // parsed once and shared by all routes that inherit it. This may be nullptr, in which case an
+  // empty policy will do.
+  return vhost_retry_policy;
 }
 
 absl::StatusOr<std::unique_ptr<InternalRedirectPolicyImpl>>
@@ -1839,8 +1835,12 @@ CommonVirtualHostImpl::CommonVirtualHostImpl(
 
   // Retry and Hedge policies must be set before routes, since they may use them.
   if (virtual_host.has_retry_policy()) {
-    retry_policy_ = std::make_unique<envoy::config::route::v3::RetryPolicy>();
-    retry_policy_->CopyFrom(virtual_host.retry_policy());
+    Upstream::RetryExtensionFactoryContextImpl retry_factory_context(
+        factory_context.singletonManager());
+    auto retry_policy_or_error = RetryPolicyImpl::create(virtual_host.retry_policy(), validator,
+                                                         retry_factory_context, factory_context);
+    SET_AND_RETURN_IF_NOT_OK(retry_policy_or_error.status(), creation_status);
+    retry_policy_ = std::move(retry_policy_or_error.value());
   }
   if (virtual_host.has_hedge_policy()) {
     hedge_policy_ = std::make_unique<envoy::config::route::v3::HedgePolicy>();
@@ -1961,6 +1961,60 @@ CommonVirtualHostImpl::create(const envoy::config::route::v3::VirtualHost& virtu
   return ret;
 }
 
+std::unique_ptr<const PathRouteIndex>
+PathRouteIndex::create(absl::Span<const RouteEntryImplBaseConstSharedPtr> routes) {
+  if (routes.empty()) {
+    return nullptr;
+  }
+  for (const auto& route : routes) {
+    const PathMatchType type = route->matchType();
+    if ((type != PathMatchType::Exact && type != PathMatchType::Prefix) ||
+        !route->isPathOnlyRouteMatch()) {
+      return nullptr;
+    }
+  }
+
+  std::unique_ptr<PathRouteIndex> index(new PathRouteIndex());
+  // Record the first route in config order for each distinct exact path and prefix; later
+  // duplicates are unreachable under first-match-wins.
+  absl::flat_hash_map<absl::string_view, Candidate> prefixes;
+  for (uint32_t i = 0; i < routes.size(); ++i) {
+    const RouteEntryImplBase& route = *routes[i];
+    if (route.matchType() == PathMatchType::Exact) {
+      index->exact_routes_.try_emplace(route.matcher(), Candidate{&route, i});
+    } else {
+      prefixes.try_emplace(route.matcher(), Candidate{&route, i});
+    }
+  }
+  // Insert prefixes shortest first so that each trie entry can inherit the earliest route of the
+  // longest shorter prefix it extends; a path matches exactly the config prefixes that are
+  // prefixes of it, and those are all nested, so the inherited minimum is the first match.
+  std::vector<std::pair<absl::string_view, Candidate>> ordered(prefixes.begin(), prefixes.end());
+  std::sort(ordered.begin(), ordered.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.first.size() < rhs.first.size(); });
+  for (auto& [prefix, candidate] : ordered) {
+    const CandidateConstSharedPtr parent = index->prefix_trie_.findLongestPrefix(prefix);
+    if (parent != nullptr && parent->index_ < candidate.index_) {
+      candidate = *parent;
+    }
+    index->prefix_trie_.add(prefix, std::make_shared<const Candidate>(candidate));
+  }
+  return index;
+}
+
+const RouteEntryImplBase* PathRouteIndex::find(absl::string_view path) const {
+  const Candidate* best = nullptr;
+  const auto exact = exact_routes_.find(path);
+  if (exact != exact_routes_.end()) {
+    best = &exact->second;
+  }
+  const CandidateConstSharedPtr prefix = prefix_trie_.findLongestPrefix(path);
+  if (prefix != nullptr && (best == nullptr || prefix->index_ < best->index_)) {
+    best = prefix.get();
+  }
+  return best != nullptr ? best->route_ : nullptr;
+}
+
 VirtualHostImpl::VirtualHostImpl(
     const envoy::config::route::v3::VirtualHost& virtual_host,
     const CommonConfigSharedPtr& global_route_config,
@@ -2010,6 +2064,7 @@ VirtualHostImpl::VirtualHostImpl(
       SET_AND_RETURN_IF_NOT_OK(route_or_error.status(), creation_status);
       routes_.emplace_back(route_or_error.value());
     }
+    path_route_index_ = PathRouteIndex::create(routes_);
   }
 }
 
@@ -2100,7 +2155,19 @@ RouteConstSharedPtr VirtualHostImpl::getRouteFromEntries(const RouteCallback& cb
     return nullptr;
   }
 
-  // Check for a route that matches the request.
+  // Check for a route that matches the request. When the route list was compiled into a path
+  // index, resolve the first matching route with a single lookup instead of a linear scan. The
+  // index only selects among routes whose criteria are path-only, so the candidate's matches()
+  // call cannot disagree with the index; it re-validates the path and resolves weighted clusters.
+  if (path_route_index_ != nullptr && cb == nullptr && headers.Path() != nullptr) {
+    absl::string_view path = headers.getPathValue();
+    if (shared_virtual_host_->globalRouteConfig().ignorePathParametersInPathMatching()) {
+      path = path.substr(0, path.find_first_of(';'));
+    }
+    const RouteEntryImplBase* route =
+        path_route_index_->find(Http::PathUtil::removeQueryAndFragment(path));
+    return route != nullptr ? route->matches(headers, stream_info, random_value) : nullptr;
+  }
   return getRouteFromRoutes(cb, headers, stream_info, random_value, routes_);
 }
 
@@ -2129,11 +2196,12 @@ absl::StatusOr<std::unique_ptr<RouteMatcher>>
 RouteMatcher::create(const envoy::config::route::v3::RouteConfiguration& route_config,
                      const CommonConfigSharedPtr& global_route_config,
                      Server::Configuration::ServerFactoryContext& factory_context,
-                     ProtobufMessage::ValidationVisitor& validator, bool validate_clusters) {
+                     ProtobufMessage::ValidationVisitor& validator, bool validate_clusters,
+                     const RouteMatcher* previous_matcher) {
   absl::Status creation_status = absl::OkStatus();
-  auto ret = std::unique_ptr<RouteMatcher>{new RouteMatcher(route_config, global_route_config,
-                                                            factory_context, validator,
-                                                            validate_clusters, creation_status)};
+  auto ret = std::unique_ptr<RouteMatcher>{
+      new RouteMatcher(route_config, global_route_config, factory_context, validator,
+                       validate_clusters, previous_matcher, creation_status)};
   RETURN_IF_NOT_OK(creation_status);
   return ret;
 }
@@ -2141,19 +2209,39 @@ RouteMatcher::RouteMatcher(const envoy::config::route::v3::RouteConfiguration& r
                            const CommonConfigSharedPtr& global_route_config,
                            Server::Configuration::ServerFactoryContext& factory_context,
                            ProtobufMessage::ValidationVisitor& validator, bool validate_clusters,
-                           absl::Status& creation_status)
-    : vhost_scope_(factory_context.scope().scopeFromStatName(
-          factory_context.routerContext().virtualClusterStatNames().vhost_)),
+                           const RouteMatcher* previous_matcher, absl::Status& creation_status)
+    : vhost_scope_(previous_matcher != nullptr
+                       ? previous_matcher->vhost_scope_
+                       : factory_context.scope().scopeFromStatName(
+                             factory_context.routerContext().virtualClusterStatNames().vhost_)),
       ignore_port_in_host_matching_(route_config.ignore_port_in_host_matching()) {
   absl::optional<Upstream::ClusterManager::ClusterInfoMaps> validation_clusters;
   if (validate_clusters) {
     validation_clusters = factory_context.clusterManager().clusters();
   }
+  const bool track_vhost_hashes = Runtime::runtimeFeatureEnabled(
+      "envoy.reloadable_features.rds_reuse_unchanged_virtual_hosts");
   for (const auto& virtual_host_config : route_config.virtual_hosts()) {
-    VirtualHostSharedPtr virtual_host = std::make_shared<VirtualHostImpl>(
-        virtual_host_config, global_route_config, factory_context, *vhost_scope_, validator,
-        validation_clusters, creation_status);
-    SET_AND_RETURN_IF_NOT_OK(creation_status, creation_status);
+    VirtualHostSharedPtr virtual_host;
+    uint64_t vhost_hash = 0;
+    if (track_vhost_hashes) {
+      vhost_hash = MessageUtil::hash(virtual_host_config);
+      if (previous_matcher != nullptr) {
+        auto reusable = previous_matcher->virtual_hosts_by_hash_.find(vhost_hash);
+        if (reusable != previous_matcher->virtual_hosts_by_hash_.end()) {
+          virtual_host = reusable->second;
+        }
+      }
+    }
+    if (virtual_host == nullptr) {
+      virtual_host = std::make_shared<VirtualHostImpl>(virtual_host_config, global_route_config,
+                                                       factory_context, *vhost_scope_, validator,
+                                                       validation_clusters, creation_status);
+      SET_AND_RETURN_IF_NOT_OK(creation_status, creation_status);
+    }
+    if (track_vhost_hashes) {
+      virtual_hosts_by_hash_.emplace(vhost_hash, virtual_host);
+    }
     for (const std::string& domain_name : virtual_host_config.domains()) {
       const Http::LowerCaseString lower_case_domain_name(domain_name);
       absl::string_view domain = lower_case_domain_name;
@@ -2363,10 +2451,12 @@ create(const envoy::config::route::v3::RouteConfiguration& config,
 absl::StatusOr<std::shared_ptr<ConfigImpl>>
 ConfigImpl::create(const envoy::config::route::v3::RouteConfiguration& config,
                    Server::Configuration::ServerFactoryContext& factory_context,
-                   ProtobufMessage::ValidationVisitor& validator, bool validate_clusters_default) {
+                   ProtobufMessage::ValidationVisitor& validator, bool validate_clusters_default,
+                   const ConfigImpl* previous_config) {
   absl::Status creation_status = absl::OkStatus();
-  auto ret = std::shared_ptr<ConfigImpl>(new ConfigImpl(
-      config, factory_context, validator, validate_clusters_default, creation_status));
+  auto ret = std::shared_ptr<ConfigImpl>(new ConfigImpl(config, factory_context, validator,
+                                                        validate_clusters_default, previous_config,
+                                                        creation_status));
   RETURN_IF_NOT_OK(creation_status);
   return ret;
 }
@@ -2374,23 +2464,69 @@ ConfigImpl::create(const envoy::config::route::v3::RouteConfiguration& config,
 ConfigImpl::ConfigImpl(const envoy::config::route::v3::RouteConfiguration& config,
                        Server::Configuration::ServerFactoryContext& factory_context,
                        ProtobufMessage::ValidationVisitor& validator,
-                       bool validate_clusters_default, absl::Status& creation_status) {
-  auto config_or_error = CommonConfigImpl::create(config, factory_context, validator);
-  SET_AND_RETURN_IF_NOT_OK(config_or_error.status(), creation_status);
-  shared_config_ = std::move(config_or_error.value());
+                       bool validate_clusters_default, const ConfigImpl* previous_config,
+                       absl::Status& creation_status) {
+  const bool validate_clusters =
+      PROTOBUF_GET_WRAPPED_OR_DEFAULT(config, validate_clusters, validate_clusters_default);
+  if (Runtime::runtimeFeatureEnabled(
+          "envoy.reloadable_features.rds_reuse_unchanged_virtual_hosts")) {
+    envoy::config::route::v3::RouteConfiguration config_without_vhosts = config;
+    config_without_vhosts.clear_virtual_hosts();
+    config_without_vhosts_hash_ = MessageUtil::hash(config_without_vhosts);
+  }
+
+  // When only the virtual hosts changed relative to the previous version of this config, the
+  // shared top-level config can be carried over as is, and the route matcher can share the
+  // unchanged virtual hosts with its predecessor. Skipped when cluster validation is requested
+  // as reused virtual hosts would not be re-validated against the current cluster set.
+  const RouteMatcher* previous_matcher = nullptr;
+  if (previous_config != nullptr && !validate_clusters &&
+      config_without_vhosts_hash_.has_value() &&
+      previous_config->config_without_vhosts_hash_ == config_without_vhosts_hash_) {
+    shared_config_ = previous_config->shared_config_;
+    previous_matcher = previous_config->route_matcher_.get();
+  } else {
+    auto config_or_error = CommonConfigImpl::create(config, factory_context, validator);
+    SET_AND_RETURN_IF_NOT_OK(config_or_error.status(), creation_status);
+    shared_config_ = std::move(config_or_error.value());
+  }
 
-  auto matcher_or_error = RouteMatcher::create(
-      config, shared_config_, factory_context, validator,
-      PROTOBUF_GET_WRAPPED_OR_DEFAULT(config, validate_clusters, validate_clusters_default));
+  auto matcher_or_error = RouteMatcher::create(config, shared_config_, factory_context, validator,
+                                               validate_clusters, previous_matcher);
   SET_AND_RETURN_IF_NOT_OK(matcher_or_error.status(), creation_status);
   route_matcher_ = std::move(matcher_or_error.value());
+
+  const uint32_t cache_entries = config.per_worker_route_match_cache_entries();
+  if (cache_entries > 0) {
+    route_cache_tls_ =
+        ThreadLocal::TypedSlot<RouteMatchCache>::makeUnique(factory_context.threadLocal());
+    route_cache_tls_->set([cache_entries](Event::Dispatcher&) {
+      return std::make_shared<RouteMatchCache>(cache_entries);
+    });
+  }
 }
 
 RouteConstSharedPtr ConfigImpl::route(const RouteCallback& cb,
                                       const Http::RequestHeaderMap& headers,
                                       const StreamInfo::StreamInfo& stream_info,
                                       uint64_t random_value) const {
-  return route_matcher_->route(cb, headers, stream_info, random_value);
+  // The cache is bypassed for callback-driven resolution (e.g. internal redirects), which can
+  // legitimately return a different route than a plain lookup for the same key.
+  if (route_cache_tls_ == nullptr || cb != nullptr) {
+    return route_matcher_->route(cb, headers, stream_info, random_value);
+  }
+  OptRef<RouteMatchCache> cache = route_cache_tls_->get();
+  if (!cache.has_value()) {
+    return route_matcher_->route(cb, headers, stream_info, random_value);
+  }
+  if (RouteConstSharedPtr cached = cache->find(headers); cached != nullptr) {
+    return cached;
+  }
+  RouteConstSharedPtr route = route_matcher_->route(cb, headers, stream_info, random_value);
+  if (route != nullptr) {
+    cache->insert(headers, route);
+  }
+  return route;
 }
 
 const envoy::config::core::v3::Metadata& NullConfigImpl::metadata() const {
@@ -18,11 +18,13 @@
 #include "envoy/router/router.h"
 #include "envoy/runtime/runtime.h"
 #include "envoy/server/filter_config.h"
+#include "envoy/thread_local/thread_local.h"
 #include "envoy/type/v3/percent.pb.h"
 #include "envoy/upstream/cluster_manager.h"
 
 #include "source/common/common/matchers.h"
 #include "source/common/common/packed_struct.h"
+#include "source/common/common/trie_lookup_table.h"
 #include "source/common/config/datasource.h"
 #include "source/common/config/metadata.h"
 #include "source/common/http/hash_policy.h"
@@ -31,10 +33,12 @@
 #include "source/common/router/config_utility.h"
 #include "source/common/router/header_parser.h"
 #include "source/common/router/metadatamatchcriteria_impl.h"
+#include "source/common/router/route_match_cache.h"
 #include "source/common/router/router_ratelimit.h"
 #include "source/common/router/tls_context_match_criteria_impl.h"
 #include "source/common/stats/symbol_table.h"
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/container/node_hash_map.h"
 #include "absl/types/optional.h"
 
@@ -242,11 +246,11 @@ private:
 };
 using CorsPolicyImpl = CorsPolicyImplBase<envoy::config::route::v3::CorsPolicy>;
 
-using RetryPolicyConstOptRef = const OptRef<const envoy::config::route::v3::RetryPolicy>;
 using HedgePolicyConstOptRef = const OptRef<const envoy::config::route::v3::HedgePolicy>;
 
 class ConfigImpl;
 class CommonConfigImpl;
+class RetryPolicyImpl;
 using CommonConfigSharedPtr = std::shared_ptr<CommonConfigImpl>;
 
 /**
@@ -292,12 +296,10 @@ public:
   bool includeAttemptCountInResponse() const override { return include_attempt_count_in_response_; }
   bool includeIsTimeoutRetryHeader() const override { return include_is_timeout_retry_header_; }
   const std::vector<ShadowPolicyPtr>& shadowPolicies() const { return shadow_policies_; }
-  RetryPolicyConstOptRef retryPolicy() const {
-    if (retry_policy_ != nullptr) {
-      return *retry_policy_;
-    }
-    return absl::nullopt;
-  }
+  // The parsed virtual host retry policy. It is built once here and shared by every route in
+  // this virtual host that does not configure its own policy, rather than each such route
+  // building an identical copy. May be nullptr when the virtual host has no retry policy.
+  const std::shared_ptr<const RetryPolicyImpl>& retryPolicy() const { return retry_policy_; }
   HedgePolicyConstOptRef hedgePolicy() const {
     if (hedge_policy_ != nullptr) {
       return *hedge_policy_;
@@ -371,7 +373,7 @@ private:
   HeaderParserPtr request_headers_parser_;
   HeaderParserPtr response_headers_parser_;
   std::unique_ptr<PerFilterConfigs> per_filter_configs_;
-  std::unique_ptr<envoy::config::route::v3::RetryPolicy> retry_policy_;
+  std::shared_ptr<const RetryPolicyImpl> retry_policy_;
   std::unique_ptr<envoy::config::route::v3::HedgePolicy> hedge_policy_;
   std::unique_ptr<const CatchAllVirtualCluster> virtual_cluster_catch_all_;
   RouteMetadataPackPtr metadata_;
@@ -382,6 +384,49 @@ private:
   const bool include_is_timeout_retry_header_ : 1;
 };
 
+/**
+ * Index over a virtual host's route list that answers "first route in config order whose path
+ * matcher matches this path" in O(path length) instead of scanning every route. The index is only
+ * buildable when every route in the list is a case sensitive exact or prefix path match with no
+ * other match criteria (see RouteEntryImplBase::isPathOnlyRouteMatch()); selection then depends
+ * solely on the request path, so first-match-wins semantics are preserved by comparing the config
+ * position of the best exact hit and the best prefix hit.
+ */
+class PathRouteIndex {
+public:
+  /**
+   * @return an index over the given routes, or nullptr when the route list cannot be indexed
+   *         without changing match semantics.
+   */
+  static std::unique_ptr<const PathRouteIndex>
+  create(absl::Span<const RouteEntryImplBaseConstSharedPtr> routes);
+
+  /**
+   * @param path the request path with query, fragment and (when configured) path parameters
+   *        already removed, exactly as it would be presented to the routes' path matchers.
+   * @return the first route in config order whose path matcher matches the path, or nullptr when
+   *         no indexed route matches.
+   */
+  const RouteEntryImplBase* find(absl::string_view path) const;
+
+private:
+  struct Candidate {
+    const RouteEntryImplBase* route_{};
+    // Position of the route in the virtual host's route list; used to arbitrate between exact and
+    // prefix hits while preserving first-match-wins.
+    uint32_t index_{};
+  };
+  using CandidateConstSharedPtr = std::shared_ptr<const Candidate>;
+
+  PathRouteIndex() = default;
+
+  absl::flat_hash_map<std::string, Candidate> exact_routes_;
+  // Each trie entry holds the earliest route among the entry's own prefix and every shorter
+  // config prefix it extends, so a single longest-prefix walk yields the first matching prefix
+  // route in config order.
+  TrieLookupTable<CandidateConstSharedPtr> prefix_trie_;
+};
+
 /**
  * Virtual host that holds a collection of routes.
  */
@@ -414,6 +459,9 @@ private:
   SslRequirements ssl_requirements_;
 
   std::vector<RouteEntryImplBaseConstSharedPtr> routes_;
+  // Compiled path index over routes_; non-null only when every route is a path-only exact or
+  // prefix match. Declared after routes_ as it points into them.
+  std::unique_ptr<const PathRouteIndex> path_route_index_;
   Matcher::MatchTreeSharedPtr<Http::HttpMatchingData> matcher_;
 };
 
@@ -677,6 +725,16 @@ public:
   absl::Status
   validateClusters(const Upstream::ClusterManager::ClusterInfoMaps& cluster_info_maps) const;
 
+  // Returns true when route selection depends exclusively on the request path: a case sensitive
+  // path matcher with no header, query parameter, gRPC, runtime fraction, dynamic metadata or TLS
+  // context criteria. Such routes can be matched through a compiled path index instead of being
+  // evaluated one by one.
+  bool isPathOnlyRouteMatch() const {
+    return case_sensitive_ && runtime_ == nullptr && !match_grpc_ && config_headers_.empty() &&
+           config_query_parameters_.empty() && tls_context_match_criteria_ == nullptr &&
+           dynamic_metadata_.empty();
+  }
+
   // Router::RouteEntry
   const std::string& clusterName() const override;
   const std::string getRequestHostValue(const Http::RequestHeaderMap& headers) const override;
@@ -1169,8 +1227,8 @@ private:
   buildHedgePolicy(HedgePolicyConstOptRef vhost_hedge_policy,
                    const envoy::config::route::v3::RouteAction& route_config) const;
 
-  absl::StatusOr<std::unique_ptr<RetryPolicyImpl>>
-  buildRetryPolicy(RetryPolicyConstOptRef vhost_retry_policy,
+  absl::StatusOr<std::shared_ptr<const RetryPolicyImpl>>
+  buildRetryPolicy(const std::shared_ptr<const RetryPolicyImpl>& vhost_retry_policy,
                    const envoy::config::route::v3::RouteAction& route_config,
                    ProtobufMessage::ValidationVisitor& validation_visitor,
                    Server::Configuration::ServerFactoryContext& factory_context) const;
@@ -1226,7 +1284,7 @@ private:
   std::unique_ptr<const RuntimeData> runtime_;
   std::unique_ptr<const ::Envoy::Http::Utility::RedirectConfig> redirect_config_;
   std::unique_ptr<const HedgePolicyImpl> hedge_policy_;
-  std::unique_ptr<const RetryPolicyImpl> retry_policy_;
+  std::shared_ptr<const RetryPolicyImpl> retry_policy_;
   std::unique_ptr<const InternalRedirectPolicyImpl> internal_redirect_policy_;
   std::unique_ptr<const RateLimitPolicyImpl> rate_limit_policy_;
   std::vector<ShadowPolicyPtr> shadow_policies_;
@@ -1535,11 +1593,16 @@ DECLARE_FACTORY(RouteListMatchActionFactory);
  */
 class RouteMatcher {
 public:
+  // If non-null, ``previous_matcher`` supplies the matcher built for the previous version of
+  // this route configuration; virtual hosts whose configuration is unchanged are shared with it
+  // instead of being rebuilt. The caller must guarantee that the previous matcher was built
+  // against the same global route configuration as this one.
   static absl::StatusOr<std::unique_ptr<RouteMatcher>>
   create(const envoy::config::route::v3::RouteConfiguration& config,
          const CommonConfigSharedPtr& global_route_config,
          Server::Configuration::ServerFactoryContext& factory_context,
-         ProtobufMessage::ValidationVisitor& validator, bool validate_clusters);
+         ProtobufMessage::ValidationVisitor& validator, bool validate_clusters,
+         const RouteMatcher* previous_matcher = nullptr);
 
   RouteConstSharedPtr route(const RouteCallback& cb, const Http::RequestHeaderMap& headers,
                             const StreamInfo::StreamInfo& stream_info, uint64_t random_value) const;
@@ -1551,7 +1614,7 @@ private:
                const CommonConfigSharedPtr& global_route_config,
                Server::Configuration::ServerFactoryContext& factory_context,
                ProtobufMessage::ValidationVisitor& validator, bool validate_clusters,
-               absl::Status& creation_status);
+               const RouteMatcher* previous_matcher, absl::Status& creation_status);
 
   using WildcardVirtualHosts =
       std::map<int64_t, absl::node_hash_map<std::string, VirtualHostSharedPtr>, std::greater<>>;
@@ -1576,6 +1639,10 @@ private:
   WildcardVirtualHosts wildcard_virtual_host_prefixes_;
 
   VirtualHostSharedPtr default_virtual_host_;
+  // Virtual hosts keyed by the hash of their configuration fragment, so that the matcher built
+  // for the next version of the route configuration can share unchanged virtual hosts. Only
+  // populated when the rds_reuse_unchanged_virtual_hosts runtime flag is enabled.
+  absl::flat_hash_map<uint64_t, VirtualHostSharedPtr> virtual_hosts_by_hash_;
   const bool ignore_port_in_host_matching_{false};
 };
 
@@ -1656,10 +1723,16 @@ private:
  */
 class ConfigImpl : public Config {
 public:
+  // If non-null, ``previous_config`` supplies the config built from the previous version of the
+  // same RDS resource. When the two versions differ only in their virtual hosts and cluster
+  // validation is off, the shared top-level config and any unchanged VirtualHostImpl objects are
+  // reused in the new snapshot instead of being rebuilt. Gated by the
+  // rds_reuse_unchanged_virtual_hosts runtime flag.
   static absl::StatusOr<std::shared_ptr<ConfigImpl>>
   create(const envoy::config::route::v3::RouteConfiguration& config,
          Server::Configuration::ServerFactoryContext& factory_context,
-         ProtobufMessage::ValidationVisitor& validator, bool validate_clusters_default);
+         ProtobufMessage::ValidationVisitor& validator, bool validate_clusters_default,
+         const ConfigImpl* previous_config = nullptr);
 
   bool virtualHostExists(const Http::RequestHeaderMap& headers) const {
     return route_matcher_->findVirtualHost(headers) != nullptr;
@@ -1702,11 +1775,18 @@ protected:
   ConfigImpl(const envoy::config::route::v3::RouteConfiguration& config,
              Server::Configuration::ServerFactoryContext& factory_context,
              ProtobufMessage::ValidationVisitor& validator, bool validate_clusters_default,
-             absl::Status& creation_status);
+             const ConfigImpl* previous_config, absl::Status& creation_status);
 
 private:
   CommonConfigSharedPtr shared_config_;
+  // Hash of the route configuration with the virtual hosts cleared out. Only computed when the
+  // rds_reuse_unchanged_virtual_hosts runtime flag is enabled; used to decide whether virtual
+  // hosts may be shared with the config built for the next version of the same resource.
+  absl::optional<uint64_t> config_without_vhosts_hash_;
   std::unique_ptr<RouteMatcher> route_matcher_;
+  // Per-worker route match result cache; null unless enabled on the RouteConfiguration. The slot
+  // (and every worker's cache) is destroyed together with this config on an RDS swap.
+  ThreadLocal::TypedSlotPtr<RouteMatchCache> route_cache_tls_;
 };
 
 /**
@@ -48,12 +48,20 @@ parseHttpHeaderFormatter(const envoy::config::core::v3::HeaderValue& header_valu
   return Envoy::Formatter::FormatterImpl::create(final_header_value, true);
 }
 
+// A value without any '%' cannot contain a substitution command (commands are %-delimited), so
+// the configured string is already the final header value and the formatter never needs to run.
+// Values containing '%' are conservatively treated as dynamic.
+bool isConstantValue(absl::string_view value) {
+  return value.find('%') == absl::string_view::npos;
+}
+
 } // namespace
 
 HeadersToAddEntry::HeadersToAddEntry(const HeaderValueOption& header_value_option,
                                      absl::Status& creation_status)
     : original_value_(header_value_option.header().value()),
-      add_if_empty_(header_value_option.keep_empty_value()) {
+      add_if_empty_(header_value_option.keep_empty_value()),
+      constant_value_(isConstantValue(original_value_)) {
 
   if (header_value_option.has_append()) {
     // 'append' is set and ensure the 'append_action' value is equal to the default value.
@@ -78,7 +86,8 @@ HeadersToAddEntry::HeadersToAddEntry(const HeaderValueOption& header_value_optio
 HeadersToAddEntry::HeadersToAddEntry(const HeaderValue& header_value,
                                      HeaderAppendAction append_action,
                                      absl::Status& creation_status)
-    : original_value_(header_value.value()), append_action_(append_action) {
+    : original_value_(header_value.value()), constant_value_(isConstantValue(original_value_)),
+      append_action_(append_action) {
   auto formatter_or_error = parseHttpHeaderFormatter(header_value);
   SET_AND_RETURN_IF_NOT_OK(formatter_or_error.status(), creation_status);
   formatter_ = std::move(formatter_or_error.value());
@@ -169,10 +178,12 @@ void HeaderParser::evaluateHeaders(Http::HeaderMap& headers,
   std::string value_buffer;
   for (const auto& [key, entry] : headers_to_add_) {
     absl::string_view value;
-    if (stream_info != nullptr) {
+    if (stream_info != nullptr && !entry->constant_value_) {
       value_buffer = entry->formatter_->formatWithContext(context, *stream_info);
       value = value_buffer;
     } else {
+      // Constant values are final at configuration time, so the formatter is skipped and no
+      // per-request copy of the value is made.
       value = entry->original_value_;
     }
     if (!value.empty() || entry->add_if_empty_) {
@@ -215,7 +226,9 @@ Http::HeaderTransforms HeaderParser::getHeaderTransforms(const StreamInfo::Strea
 
   for (const auto& [key, entry] : headers_to_add_) {
     if (do_formatting) {
-      const std::string value = entry->formatter_->formatWithContext({}, stream_info);
+      const std::string value = entry->constant_value_
+                                    ? entry->original_value_
+                                    : entry->formatter_->formatWithContext({}, stream_info);
       if (!value.empty() || entry->add_if_empty_) {
         switch (entry->append_action_) {
         case HeaderValueOption::APPEND_IF_EXISTS_OR_ADD:
@@ -41,6 +41,9 @@ struct HeadersToAddEntry {
 
   std::string original_value_;
   bool add_if_empty_ = false;
+  // True if the configured value contains no substitution commands, in which case
+  // original_value_ is the final value and the formatter does not need to run per request.
+  bool constant_value_ = false;
 
   Formatter::FormatterPtr formatter_;
   HeaderAppendAction append_action_;
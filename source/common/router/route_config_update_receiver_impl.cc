@@ -50,6 +50,20 @@ ConfigTraitsImpl::createConfig(const Protobuf::Message& rc,
       std::shared_ptr<ConfigImpl>);
 }
 
+Rds::ConfigConstSharedPtr
+ConfigTraitsImpl::createConfig(const Protobuf::Message& rc,
+                               Server::Configuration::ServerFactoryContext& factory_context,
+                               bool validate_clusters_default,
+                               const Rds::ConfigConstSharedPtr& previous_config) const {
+  ASSERT(dynamic_cast<const envoy::config::route::v3::RouteConfiguration*>(&rc));
+  // The previous config is the null config until the first RDS update is applied.
+  const ConfigImpl* previous = dynamic_cast<const ConfigImpl*>(previous_config.get());
+  return THROW_OR_RETURN_VALUE(
+      ConfigImpl::create(static_cast<const envoy::config::route::v3::RouteConfiguration&>(rc),
+                         factory_context, validator_, validate_clusters_default, previous),
+      std::shared_ptr<ConfigImpl>);
+}
+
 bool RouteConfigUpdateReceiverImpl::onRdsUpdate(const Protobuf::Message& rc,
                                                 const std::string& version_info) {
   uint64_t new_hash = base_.getHash(rc);
@@ -86,7 +100,7 @@ bool RouteConfigUpdateReceiverImpl::onRdsUpdate(const Protobuf::Message& rc,
 }
 
 bool RouteConfigUpdateReceiverImpl::onVhdsUpdate(
-    const VirtualHostRefVector& added_vhosts, const std::set<std::string>& added_resource_ids,
+    const VirtualHostRefVector& added_vhosts, std::set<std::string>&& added_resource_ids,
     const Protobuf::RepeatedPtrField<std::string>& removed_resources,
     const std::string& version_info) {
   std::unique_ptr<VirtualHostMap> vhosts_after_this_update;
@@ -110,7 +124,7 @@ bool RouteConfigUpdateReceiverImpl::onVhdsUpdate(
   base_.updateConfig(std::move(route_config_after_this_update));
   // No exception, route_config_after_this_update is valid, can update the state.
   vhds_virtual_hosts_ = std::move(vhosts_after_this_update);
-  resource_ids_in_last_update_ = added_resource_ids;
+  resource_ids_in_last_update_ = std::move(added_resource_ids);
   base_.onUpdateCommon(version_info);
 
   return removed || updated || !resource_ids_in_last_update_.empty();
@@ -123,7 +137,7 @@ bool RouteConfigUpdateReceiverImpl::removeVhosts(
     auto found = vhosts.find(vhost_name);
     if (found != vhosts.end()) {
       vhosts_removed = true;
-      vhosts.erase(vhost_name);
+      vhosts.erase(found);
     }
   }
   return vhosts_removed;
@@ -133,11 +147,7 @@ bool RouteConfigUpdateReceiverImpl::updateVhosts(VirtualHostMap& vhosts,
                                                  const VirtualHostRefVector& added_vhosts) {
   bool vhosts_added = false;
   for (const auto& vhost : added_vhosts) {
-    auto found = vhosts.find(vhost.get().name());
-    if (found != vhosts.end()) {
-      vhosts.erase(found);
-    }
-    vhosts.emplace(vhost.get().name(), vhost.get());
+    vhosts.insert_or_assign(vhost.get().name(), vhost.get());
     vhosts_added = true;
   }
   return vhosts_added;
@@ -26,6 +26,11 @@ public:
   Rds::ConfigConstSharedPtr createConfig(const Protobuf::Message& rc,
                                          Server::Configuration::ServerFactoryContext& context,
                                          bool validate_clusters_default) const override;
+  Rds::ConfigConstSharedPtr createConfig(const Protobuf::Message& rc,
+                                         Server::Configuration::ServerFactoryContext& context,
+                                         bool validate_clusters_default,
+                                         const Rds::ConfigConstSharedPtr& previous_config)
+      const override;
 
 private:
   ProtobufMessage::ValidationVisitor& validator_;
@@ -48,7 +53,7 @@ public:
   // Router::RouteConfigUpdateReceiver
   bool onRdsUpdate(const Protobuf::Message& rc, const std::string& version_info) override;
   bool onVhdsUpdate(const VirtualHostRefVector& added_vhosts,
-                    const std::set<std::string>& added_resource_ids,
+                    std::set<std::string>&& added_resource_ids,
                     const Protobuf::RepeatedPtrField<std::string>& removed_resources,
                     const std::string& version_info) override;
   uint64_t configHash() const override { return base_.configHash(); }
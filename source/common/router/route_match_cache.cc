@@ -0,0 +1,43 @@
+#include "source/common/router/route_match_cache.h"
+
+#include "absl/strings/str_cat.h"
+
+namespace Envoy {
+namespace Router {
+
+std::string RouteMatchCache::makeKey(const Http::RequestHeaderMap& headers) {
+  // The query (and fragment) cannot influence a host/path/method keyed table, so strip it to
+  // improve the hit rate on hot routes called with varying query parameters.
+  absl::string_view path = headers.getPathValue();
+  path = path.substr(0, path.find('?'));
+  // '\n' cannot appear in any of the components so it is an unambiguous separator.
+  return absl::StrCat(headers.getHostValue(), "\n", headers.getMethodValue(), "\n", path);
+}
+
+RouteConstSharedPtr RouteMatchCache::find(const Http::RequestHeaderMap& headers) {
+  const auto it = entries_.find(makeKey(headers));
+  if (it == entries_.end()) {
+    return nullptr;
+  }
+  lru_.splice(lru_.begin(), lru_, it->second);
+  return it->second->second;
+}
+
+void RouteMatchCache::insert(const Http::RequestHeaderMap& headers, RouteConstSharedPtr route) {
+  std::string key = makeKey(headers);
+  const auto it = entries_.find(key);
+  if (it != entries_.end()) {
+    it->second->second = std::move(route);
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return;
+  }
+  if (lru_.size() >= max_entries_) {
+    entries_.erase(lru_.back().first);
+    lru_.pop_back();
+  }
+  lru_.emplace_front(std::move(key), std::move(route));
+  entries_[lru_.front().first] = lru_.begin();
+}
+
+} // namespace Router
+} // namespace Envoy
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <list>
+#include <string>
+
+#include "envoy/http/header_map.h"
+#include "envoy/router/router.h"
+#include "envoy/thread_local/thread_local_object.h"
+
+#include "absl/container/flat_hash_map.h"
+
+namespace Envoy {
+namespace Router {
+
+/**
+ * Per-worker LRU cache of route match results, keyed on (authority, method, path without query).
+ * One instance lives in a thread local slot owned by a ConfigImpl, so a config update (e.g. an
+ * RDS swap) destroys the slot and with it every cached entry; no explicit invalidation protocol
+ * is needed.
+ *
+ * Correctness relies on the operator only enabling the cache for route tables whose selection
+ * depends exclusively on the key components; see the documentation on
+ * RouteConfiguration.per_worker_route_match_cache_entries.
+ */
+class RouteMatchCache : public ThreadLocal::ThreadLocalObject {
+public:
+  explicit RouteMatchCache(uint32_t max_entries) : max_entries_(max_entries) {}
+
+  /**
+   * @return the cached route for the request's (authority, method, path) or nullptr on miss.
+   *         A hit moves the entry to the front of the LRU list.
+   */
+  RouteConstSharedPtr find(const Http::RequestHeaderMap& headers);
+
+  /**
+   * Store a match result, evicting the least recently used entry when full.
+   */
+  void insert(const Http::RequestHeaderMap& headers, RouteConstSharedPtr route);
+
+private:
+  static std::string makeKey(const Http::RequestHeaderMap& headers);
+
+  using LruList = std::list<std::pair<std::string, RouteConstSharedPtr>>;
+
+  const uint32_t max_entries_;
+  LruList lru_;
+  // Values point into lru_; the key string_view references the string stored in the list node,
+  // which is stable under list splicing.
+  absl::flat_hash_map<absl::string_view, LruList::iterator> entries_;
+};
+
+} // namespace Router
+} // namespace Envoy
@@ -899,13 +899,34 @@ Http::FilterDataStatus Filter::decodeData(Buffer::Instance& data, bool end_strea
     }
   }
 
-  for (auto* shadow_stream : shadow_streams_) {
+  if (shadow_streams_.size() == 1) {
+    auto* shadow_stream = *shadow_streams_.begin();
     if (end_stream) {
       shadow_stream->removeDestructorCallback();
       shadow_stream->removeWatermarkCallbacks();
     }
     Buffer::OwnedImpl copy(data);
     shadow_stream->sendData(copy, end_stream);
+  } else if (!shadow_streams_.empty()) {
+    // When mirroring to multiple clusters, capture the chunk once and fan the same bytes out to
+    // every shadow stream through refcounted fragments, so N-way mirroring costs one copy
+    // instead of N.
+    auto shared_data = std::make_shared<std::string>(data.toString());
+    for (auto* shadow_stream : shadow_streams_) {
+      if (end_stream) {
+        shadow_stream->removeDestructorCallback();
+        shadow_stream->removeWatermarkCallbacks();
+      }
+      Buffer::OwnedImpl copy;
+      if (!shared_data->empty()) {
+        copy.addBufferFragment(*new Buffer::BufferFragmentImpl(
+            shared_data->data(), shared_data->size(),
+            [shared_data](const void*, size_t, const Buffer::BufferFragmentImpl* fragment) {
+              delete fragment;
+            }));
+      }
+      shadow_stream->sendData(copy, end_stream);
+    }
   }
   if (end_stream) {
     shadow_streams_.clear();
@@ -5,6 +5,9 @@
 
 #include "source/common/protobuf/utility.h"
 
+#include "absl/container/inlined_vector.h"
+#include "absl/strings/str_split.h"
+
 namespace Envoy {
 namespace Router {
 
@@ -21,7 +24,8 @@ bool ScopeKey::operator==(const ScopeKey& other) const {
 HeaderValueExtractorImpl::HeaderValueExtractorImpl(
     ScopedRoutes::ScopeKeyBuilder::FragmentBuilder&& config)
     : FragmentBuilderBase(std::move(config)),
-      header_value_extractor_config_(config_.header_value_extractor()) {
+      header_value_extractor_config_(config_.header_value_extractor()),
+      header_name_(header_value_extractor_config_.name()) {
   ASSERT(config_.type_case() ==
              ScopedRoutes::ScopeKeyBuilder::FragmentBuilder::kHeaderValueExtractor,
          "header_value_extractor is not set.");
@@ -42,16 +46,17 @@ HeaderValueExtractorImpl::HeaderValueExtractorImpl(
 
 std::unique_ptr<ScopeKeyFragmentBase>
 HeaderValueExtractorImpl::computeFragment(const Http::HeaderMap& headers) const {
-  const auto header_entry =
-      headers.get(Envoy::Http::LowerCaseString(header_value_extractor_config_.name()));
+  const auto header_entry = headers.get(header_name_);
   if (header_entry.empty()) {
     return nullptr;
   }
 
   // This is an implicitly untrusted header, so per the API documentation only the first
-  // value is used.
-  std::vector<absl::string_view> elements{header_entry[0]->value().getStringView()};
-  if (header_value_extractor_config_.element_separator().length() > 0) {
+  // value is used. An inlined vector keeps the typical small element counts off the heap.
+  absl::InlinedVector<absl::string_view, 4> elements;
+  if (header_value_extractor_config_.element_separator().empty()) {
+    elements.push_back(header_entry[0]->value().getStringView());
+  } else {
     elements = absl::StrSplit(header_entry[0]->value().getStringView(),
                               header_value_extractor_config_.element_separator());
   }
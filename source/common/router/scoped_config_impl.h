@@ -50,6 +50,8 @@ public:
 private:
   const ScopedRoutes::ScopeKeyBuilder::FragmentBuilder::HeaderValueExtractor&
       header_value_extractor_config_;
+  // Lower-cased once at construction; computeFragment() runs per request.
+  const Http::LowerCaseString header_name_;
 };
 
 /**
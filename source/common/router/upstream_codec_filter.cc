@@ -95,11 +95,14 @@ Http::FilterHeadersStatus UpstreamCodecFilter::decodeHeaders(Http::RequestHeader
 
 // This is the last stop in the filter chain: take the data and ship it to the codec.
 Http::FilterDataStatus UpstreamCodecFilter::decodeData(Buffer::Instance& data, bool end_stream) {
-  ASSERT(!callbacks_->upstreamCallbacks()->pausedForConnect());
+  // This runs for every body chunk, so fetch the upstream callbacks once.
+  const OptRef<Http::UpstreamStreamFilterCallbacks> upstream_callbacks =
+      callbacks_->upstreamCallbacks();
+  ASSERT(!upstream_callbacks->pausedForConnect());
   ENVOY_STREAM_LOG(trace, "proxying {} bytes", *callbacks_, data.length());
-  callbacks_->upstreamCallbacks()->upstreamStreamInfo().addBytesSent(data.length());
+  upstream_callbacks->upstreamStreamInfo().addBytesSent(data.length());
   // TODO(alyssawilk) test intermediate filters calling continue.
-  callbacks_->upstreamCallbacks()->upstream()->encodeData(data, end_stream);
+  upstream_callbacks->upstream()->encodeData(data, end_stream);
   if (end_stream) {
     upstreamTiming().onLastUpstreamTxByteSent(callbacks_->dispatcher().timeSource());
   }
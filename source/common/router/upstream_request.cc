@@ -118,10 +118,11 @@ UpstreamRequest::UpstreamRequest(RouterFilterInterface& parent,
 
   if (span_ != nullptr) {
     span_->injectContext(trace_context, upstream_context);
-  } else {
+  } else if (parent.attemptCount() == 1) {
     // No independent child span for current upstream request then inject the parent span's tracing
     // context into the request headers.
-    // The injectContext() of the parent span may be called repeatedly when the request is retried.
+    // Retries reuse the same downstream header map and the parent span's context does not change,
+    // so the headers written for the first attempt are still valid and re-injection is skipped.
     parent_.callbacks()->activeSpan().injectContext(trace_context, upstream_context);
   }
 
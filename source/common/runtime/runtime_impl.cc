@@ -105,9 +105,17 @@ bool SnapshotImpl::deprecatedFeatureEnabled(absl::string_view key, bool default_
 }
 
 bool SnapshotImpl::runtimeFeatureEnabled(absl::string_view key) const {
-  // If the value is not explicitly set as a runtime boolean, the default value is based on
-  // the underlying value.
-  return getBoolean(key, Runtime::runtimeFeatureEnabled(key));
+  // If the value is explicitly set as a runtime boolean, use it without resolving the default:
+  // the previous form computed the default eagerly, paying the feature flag registry lookup and
+  // flag read on every call even when an override made the result moot.
+  if (!values_.empty()) {
+    const auto entry = values_.find(key);
+    if (entry != values_.end() && entry->second.bool_value_.has_value()) {
+      return entry->second.bool_value_.value();
+    }
+  }
+  // Not explicitly set, so the default value is based on the underlying feature flag.
+  return Runtime::runtimeFeatureEnabled(key);
 }
 
 bool SnapshotImpl::featureEnabled(absl::string_view key, uint64_t default_value,
@@ -261,7 +261,7 @@ bool StatName::startsWith(StatName prefix) const {
 
 std::vector<absl::string_view> SymbolTable::decodeStrings(StatName stat_name) const {
   std::vector<absl::string_view> strings;
-  Thread::LockGuard lock(lock_);
+  absl::ReaderMutexLock lock(&lock_);
   Encoding::decodeTokens(
       stat_name,
       [this, &strings](Symbol symbol)
@@ -312,10 +312,20 @@ void SymbolTable::addTokensToEncoding(const absl::string_view name, Encoding& en
   std::vector<Symbol> symbols;
   symbols.reserve(tokens.size());
 
+  // Fast path: if every token has been seen before we only need to bump
+  // ref-counts, which happens atomically under the lock's shared mode, so
+  // concurrent encodes of existing names don't serialize on the table mutex.
+  if (!recent_lookups_tracking_.load(std::memory_order_relaxed) &&
+      tryAddExistingTokens(tokens, symbols)) {
+    fast_path_lookups_.fetch_add(1, std::memory_order_relaxed);
+    encoding.addSymbols(symbols);
+    return;
+  }
+
   // Now take the lock and populate the Symbol objects, which involves bumping
   // ref-counts in this.
   {
-    Thread::LockGuard lock(lock_);
+    absl::MutexLock lock(&lock_);
     recent_lookups_.lookup(name);
     for (auto& token : tokens) {
       // TODO(jmarantz): consider using StatNameDynamicStorage for tokens with
@@ -330,8 +340,35 @@ void SymbolTable::addTokensToEncoding(const absl::string_view name, Encoding& en
   encoding.addSymbols(symbols);
 }
 
+bool SymbolTable::tryAddExistingTokens(const std::vector<absl::string_view>& tokens,
+                                       std::vector<Symbol>& symbols) {
+  absl::ReaderMutexLock lock(&lock_);
+  // Re-check the tracking flag under the lock: it is only written with the
+  // exclusive lock held, so this cannot race with recent-lookup tracking being
+  // enabled, and every lookup is recorded once it is.
+  if (recent_lookups_tracking_.load(std::memory_order_relaxed)) {
+    return false;
+  }
+  // First check that every token is present; no entry can be inserted or
+  // erased while the shared lock is held, so the found entries stay valid for
+  // the ref-count bumps below and a miss needs no unwinding.
+  absl::InlinedVector<SharedSymbol*, 8> found;
+  for (absl::string_view token : tokens) {
+    auto encode_find = encode_map_.find(token);
+    if (encode_find == encode_map_.end()) {
+      return false;
+    }
+    found.push_back(&encode_find->second);
+  }
+  for (SharedSymbol* shared_symbol : found) {
+    shared_symbol->ref_count_.fetch_add(1, std::memory_order_relaxed);
+    symbols.push_back(shared_symbol->symbol_);
+  }
+  return true;
+}
+
 uint64_t SymbolTable::numSymbols() const {
-  Thread::LockGuard lock(lock_);
+  absl::MutexLock lock(&lock_);
   ASSERT(encode_map_.size() == decode_map_.size());
   return encode_map_.size();
 }
@@ -344,7 +381,9 @@ void SymbolTable::incRefCount(const StatName& stat_name) {
   // Before taking the lock, decode the array of symbols from the SymbolTable::Storage.
   const SymbolVec symbols = Encoding::decodeSymbols(stat_name);
 
-  Thread::LockGuard lock(lock_);
+  // Shared mode suffices: the caller already holds a reference to every symbol
+  // in stat_name, so none can be erased, and the bumps are atomic.
+  absl::ReaderMutexLock lock(&lock_);
   for (Symbol symbol : symbols) {
     auto decode_search = decode_map_.find(symbol);
 
@@ -366,7 +405,7 @@ void SymbolTable::free(const StatName& stat_name) {
   // Before taking the lock, decode the array of symbols from the SymbolTable::Storage.
   const SymbolVec symbols = Encoding::decodeSymbols(stat_name);
 
-  Thread::LockGuard lock(lock_);
+  absl::MutexLock lock(&lock_);
   for (Symbol symbol : symbols) {
     auto decode_search = decode_map_.find(symbol);
     ASSERT(decode_search != decode_map_.end());
@@ -395,11 +434,12 @@ uint64_t SymbolTable::getRecentLookups(const RecentLookupsFn& iter) const {
   // We don't want to hold lock_ while calling the iterator, but we need it to
   // access recent_lookups_, so we buffer in name_count_map.
   {
-    Thread::LockGuard lock(lock_);
+    absl::MutexLock lock(&lock_);
     recent_lookups_.forEach(
         [&name_count_map](absl::string_view str, uint64_t count)
             ABSL_NO_THREAD_SAFETY_ANALYSIS { name_count_map[std::string(str)] += count; });
     total += recent_lookups_.total();
+    total += fast_path_lookups_.load(std::memory_order_relaxed);
   }
 
   // Now we have the collated name-count map data: we need to vectorize and
@@ -445,17 +485,19 @@ DynamicSpans SymbolTable::getDynamicSpans(StatName stat_name) const {
 }
 
 void SymbolTable::setRecentLookupCapacity(uint64_t capacity) {
-  Thread::LockGuard lock(lock_);
+  absl::MutexLock lock(&lock_);
   recent_lookups_.setCapacity(capacity);
+  recent_lookups_tracking_.store(capacity != 0, std::memory_order_relaxed);
 }
 
 void SymbolTable::clearRecentLookups() {
-  Thread::LockGuard lock(lock_);
+  absl::MutexLock lock(&lock_);
   recent_lookups_.clear();
+  fast_path_lookups_.store(0, std::memory_order_relaxed);
 }
 
 uint64_t SymbolTable::recentLookupCapacity() const {
-  Thread::LockGuard lock(lock_);
+  absl::MutexLock lock(&lock_);
   return recent_lookups_.capacity();
 }
 
@@ -492,7 +534,7 @@ Symbol SymbolTable::toSymbol(absl::string_view sv) {
 }
 
 absl::string_view SymbolTable::fromSymbol(const Symbol symbol) const
-    ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_) {
+    ABSL_SHARED_LOCKS_REQUIRED(lock_) {
   auto search = decode_map_.find(symbol);
   RELEASE_ASSERT(search != decode_map_.end(), "no such symbol");
   return search->second->toStringView();
@@ -513,12 +555,12 @@ bool SymbolTable::lessThan(const StatName& a, const StatName& b) const {
   // Proactively take the table lock in anticipation that we'll need to
   // convert at least one symbol to a string_view, and it's easier not to
   // bother to lazily take the lock.
-  Thread::LockGuard lock(lock_);
+  absl::ReaderMutexLock lock(&lock_);
   return lessThanLockHeld(a, b);
 }
 
 bool SymbolTable::lessThanLockHeld(const StatName& a, const StatName& b) const
-    ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_) {
+    ABSL_SHARED_LOCKS_REQUIRED(lock_) {
   Encoding::TokenIter a_iter(a), b_iter(b);
   while (true) {
     Encoding::TokenIter::TokenType a_type = a_iter.next();
@@ -548,7 +590,7 @@ bool SymbolTable::lessThanLockHeld(const StatName& a, const StatName& b) const
 
 #ifndef ENVOY_CONFIG_COVERAGE
 void SymbolTable::debugPrint() const {
-  Thread::LockGuard lock(lock_);
+  absl::MutexLock lock(&lock_);
   std::vector<Symbol> symbols;
   for (const auto& p : decode_map_) {
     symbols.push_back(p.first);
@@ -557,7 +599,8 @@ void SymbolTable::debugPrint() const {
   for (Symbol symbol : symbols) {
     const InlineString& token = *decode_map_.find(symbol)->second;
     const SharedSymbol& shared_symbol = encode_map_.find(token.toStringView())->second;
-    ENVOY_LOG_MISC(info, "{}: '{}' ({})", symbol, token.toStringView(), shared_symbol.ref_count_);
+    ENVOY_LOG_MISC(info, "{}: '{}' ({})", symbol, token.toStringView(),
+                   shared_symbol.ref_count_.load(std::memory_order_relaxed));
   }
 }
 #endif
@@ -571,6 +614,69 @@ SymbolTable::StoragePtr SymbolTable::encode(absl::string_view name) {
   return mem_block.release();
 }
 
+std::vector<SymbolTable::StoragePtr>
+SymbolTable::encodeBulk(absl::Span<const absl::string_view> names) {
+  // Tokenize every name up front, so the table lock is taken at most once for
+  // the symbol lookups of the whole batch.
+  std::vector<absl::string_view> trimmed;
+  trimmed.reserve(names.size());
+  std::vector<absl::string_view> tokens;
+  std::vector<size_t> tokens_per_name;
+  tokens_per_name.reserve(names.size());
+  for (absl::string_view name : names) {
+    name = StringUtil::removeTrailingCharacters(name, '.');
+    trimmed.push_back(name);
+    size_t num_tokens = 0;
+    if (!name.empty()) {
+      for (absl::string_view token : absl::StrSplit(name, '.')) {
+        tokens.push_back(token);
+        ++num_tokens;
+      }
+    }
+    tokens_per_name.push_back(num_tokens);
+  }
+
+  // Symbolize the flattened token list: shared-mode fast path first, falling
+  // back to a single exclusive critical section if any token is new.
+  std::vector<Symbol> symbols;
+  symbols.reserve(tokens.size());
+  if (recent_lookups_tracking_.load(std::memory_order_relaxed) ||
+      !tryAddExistingTokens(tokens, symbols)) {
+    symbols.clear();
+    absl::MutexLock lock(&lock_);
+    size_t token_index = 0;
+    for (size_t i = 0; i < trimmed.size(); ++i) {
+      if (tokens_per_name[i] == 0) {
+        continue;
+      }
+      recent_lookups_.lookup(trimmed[i]);
+      for (size_t t = 0; t < tokens_per_name[i]; ++t) {
+        symbols.push_back(toSymbol(tokens[token_index++]));
+      }
+    }
+  } else {
+    const size_t non_empty =
+        std::count_if(tokens_per_name.begin(), tokens_per_name.end(),
+                      [](size_t num_tokens) { return num_tokens != 0; });
+    fast_path_lookups_.fetch_add(non_empty, std::memory_order_relaxed);
+  }
+
+  // Build the per-name backing stores from the runs of symbols.
+  std::vector<StoragePtr> result;
+  result.reserve(names.size());
+  size_t symbol_index = 0;
+  for (size_t num_tokens : tokens_per_name) {
+    Encoding encoding;
+    encoding.addSymbols(SymbolVec(symbols.begin() + symbol_index,
+                                  symbols.begin() + symbol_index + num_tokens));
+    symbol_index += num_tokens;
+    MemBlockBuilder<uint8_t> mem_block(Encoding::totalSizeBytes(encoding.bytesRequired()));
+    encoding.moveToMemBlock(mem_block);
+    result.push_back(mem_block.release());
+  }
+  return result;
+}
+
 StatNameStorage::StatNameStorage(absl::string_view name, SymbolTable& table)
     : StatNameStorageBase(table.encode(name)) {}
 
@@ -647,6 +753,17 @@ StatName StatNamePool::add(StatName name) {
 
 StatName StatNamePool::add(absl::string_view str) { return StatName(addReturningStorage(str)); }
 
+std::vector<StatName> StatNamePool::addBulk(absl::Span<const absl::string_view> names) {
+  std::vector<StatName> stat_names;
+  stat_names.reserve(names.size());
+  storage_vector_.reserve(storage_vector_.size() + names.size());
+  for (SymbolTable::StoragePtr& storage : symbol_table_.encodeBulk(names)) {
+    storage_vector_.emplace_back(std::move(storage));
+    stat_names.push_back(storage_vector_.back().statName());
+  }
+  return stat_names;
+}
+
 StatName StatNameDynamicPool::add(absl::string_view str) {
   storage_vector_.push_back(Stats::StatNameDynamicStorage(str, symbol_table_));
   return StatName(storage_vector_.back().bytes());
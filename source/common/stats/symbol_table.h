@@ -1,16 +1,15 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <stack>
 #include <string>
 #include <vector>
 
 #include "source/common/common/assert.h"
-#include "source/common/common/lock_guard.h"
 #include "source/common/common/mem_block_builder.h"
 #include "source/common/common/non_copyable.h"
-#include "source/common/common/thread.h"
 #include "source/common/common/utility.h"
 #include "source/common/stats/recent_lookups.h"
 
@@ -19,6 +18,8 @@
 #include "absl/container/inlined_vector.h"
 #include "absl/strings/str_join.h"
 #include "absl/strings/str_split.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/types/span.h"
 
 namespace Envoy {
 namespace Stats {
@@ -348,8 +349,9 @@ public:
   template <class Obj, class Iter, class GetStatName>
   void sortByStatNames(Iter begin, Iter end, GetStatName get_stat_name) const {
     // Grab the lock once before sorting begins, so we don't have to re-take
-    // it on every comparison.
-    Thread::LockGuard lock(lock_);
+    // it on every comparison. Shared mode suffices as comparisons only read
+    // the decode map.
+    absl::ReaderMutexLock lock(&lock_);
     StatNameCompare<GetStatName, Obj> compare(*this, get_stat_name);
     std::sort(begin, end, compare);
   }
@@ -360,6 +362,7 @@ private:
   friend class StatNameDeathTest;
   friend class StatNameDynamicStorage;
   friend class StatNameList;
+  friend class StatNamePool;
   friend class StatNameStorage;
 
   /**
@@ -374,6 +377,18 @@ private:
   StoragePtr encode(absl::string_view name);
   StoragePtr makeDynamicStorage(absl::string_view name);
 
+  /**
+   * Encodes a batch of names, taking the symbol-table lock at most once for
+   * the whole batch rather than once per name. This is significantly cheaper
+   * than per-name encode() calls when creating many stat names at once, e.g.
+   * the per-cluster stats instantiated during an xDS update.
+   *
+   * @param names the names to encode.
+   * @return the encoded backing store for each name, in order, transferring
+   *         ownership to the caller, who is responsible for calling free().
+   */
+  std::vector<StoragePtr> encodeBulk(absl::Span<const absl::string_view> names);
+
   /**
    * Since SymbolTable does manual reference counting, a client of SymbolTable
    * must manually call free(symbol_vec) when it is freeing the backing store
@@ -397,13 +412,36 @@ private:
 
   struct SharedSymbol {
     SharedSymbol(Symbol symbol) : symbol_(symbol) {}
+    // Move construction is needed as flat_hash_map relocates values on rehash;
+    // rehashes only occur under the exclusive lock, so a plain value copy of
+    // the atomic is safe.
+    SharedSymbol(SharedSymbol&& src) noexcept
+        : symbol_(src.symbol_), ref_count_(src.ref_count_.load(std::memory_order_relaxed)) {}
 
     Symbol symbol_;
-    uint32_t ref_count_{1};
+    // Incremented atomically under the shared lock by the encode fast path;
+    // all other mutations occur under the exclusive lock.
+    std::atomic<uint32_t> ref_count_{1};
   };
 
-  // This must be held during both encode() and free().
-  mutable Thread::MutexBasicLockable lock_;
+  /**
+   * Looks up the symbols for tokens that are already in the table, bumping
+   * their reference counts. The table lock is held in shared mode, so
+   * concurrent encodes of previously seen names do not serialize on it; new
+   * tokens can only be inserted (and stale ones erased) under the exclusive
+   * lock, which keeps the looked-up entries stable for the ref-count bumps.
+   *
+   * @param tokens the string segments to symbolize.
+   * @param symbols output vector the symbols are appended to on success.
+   * @return true if every token was found; false, with no side effects, if
+   *         any token is not yet in the table.
+   */
+  bool tryAddExistingTokens(const std::vector<absl::string_view>& tokens,
+                            std::vector<Symbol>& symbols) ABSL_LOCKS_EXCLUDED(lock_);
+
+  // This must be held during both encode() and free(); the encode fast path
+  // for already-known tokens takes it in shared mode only.
+  mutable absl::Mutex lock_;
 
   /**
    * Decodes a uint8_t array into an array of period-delimited strings. Note
@@ -434,7 +472,7 @@ private:
    * @param symbol the individual symbol to be decoded.
    * @return absl::string_view the decoded string.
    */
-  absl::string_view fromSymbol(Symbol symbol) const ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  absl::string_view fromSymbol(Symbol symbol) const ABSL_SHARED_LOCKS_REQUIRED(lock_);
 
   /**
    * Stages a new symbol for use. To be called after a successful insertion.
@@ -451,7 +489,7 @@ private:
   void addTokensToEncoding(absl::string_view name, Encoding& encoding);
 
   Symbol monotonicCounter() {
-    Thread::LockGuard lock(lock_);
+    absl::MutexLock lock(&lock_);
     return monotonic_counter_;
   }
 
@@ -475,6 +513,17 @@ private:
   // using an Envoy::IntervalSet.
   std::stack<Symbol> pool_ ABSL_GUARDED_BY(lock_);
   RecentLookups recent_lookups_ ABSL_GUARDED_BY(lock_);
+
+  // Mirrors whether recent_lookups_ has a nonzero capacity, so the encode
+  // fast path can skip lookup tracking checks without taking the lock. When
+  // tracking is enabled all encodes take the slow path so every name is
+  // recorded.
+  std::atomic<bool> recent_lookups_tracking_{false};
+
+  // Counts encode() calls that were resolved entirely by the fast path, which
+  // bypasses recent_lookups_; added to its total in getRecentLookups() so the
+  // admin lookup count stays accurate.
+  std::atomic<uint64_t> fast_path_lookups_{0};
 };
 
 // Base class for holding the backing-storing for a StatName. The two derived
@@ -526,6 +575,11 @@ public:
   // absl::flat_hash_map value.
   StatNameStorage(StatNameStorage&& src) noexcept : StatNameStorageBase(std::move(src)) {}
 
+  // Takes over backing storage that was already encoded (and ref-counted),
+  // e.g. by SymbolTable::encodeBulk().
+  explicit StatNameStorage(SymbolTable::StoragePtr&& bytes)
+      : StatNameStorageBase(std::move(bytes)) {}
+
   // Obtains new backing storage for an already existing StatName. Used to
   // record a computed StatName held in a temp into a more persistent data
   // structure.
@@ -754,6 +808,17 @@ public:
    */
   StatName add(absl::string_view name);
 
+  /**
+   * Adds a batch of names to the pool in a single symbol-table operation,
+   * taking the table lock at most once for the whole batch. Prefer this over
+   * repeated add() calls when creating many names at once, e.g. per-cluster
+   * stat names.
+   *
+   * @param names the names to add to the container.
+   * @return the StatNames held in the container for these names, in order.
+   */
+  std::vector<StatName> addBulk(absl::Span<const absl::string_view> names);
+
   /**
    * Adds the StatName to the pool preserving the representation.
    * This avoids stringifying if we already have a StatName object
@@ -125,7 +125,6 @@ std::string TagProducerImpl::produceTags(absl::string_view metric_name, TagVecto
   // TODO(jmarantz): Skip the creation of string-based tags, creating a StatNameTagVector instead.
   IntervalSetImpl<size_t> remove_characters;
   TagExtractionContext tag_extraction_context(metric_name);
-  std::vector<absl::string_view> tokens;
   absl::flat_hash_set<absl::string_view> dup_set;
   forEachExtractorMatching(metric_name, [&remove_characters, &tags, &tag_extraction_context,
                                          &dup_set](const TagExtractorPtr& tag_extractor) {
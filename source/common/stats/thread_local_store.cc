@@ -232,10 +232,10 @@ void ThreadLocalStoreImpl::mergeHistograms(PostMergeCb merge_complete_cb) {
     merge_in_progress_ = true;
     tls_cache_->runOnAllThreads(
         [](OptRef<TlsCache> tls_cache) {
-          for (const auto& id_hist : tls_cache->tls_histogram_cache_) {
-            const TlsHistogramSharedPtr& tls_hist = id_hist.second;
-            tls_hist->beginMerge();
-          }
+          // A single epoch bump swaps the collection buffer of every histogram on this worker;
+          // running it on the worker guarantees no in-flight write to the now-inactive buffers
+          // once the completion below runs on the main thread.
+          tls_cache->histogram_epoch_->fetch_add(1, std::memory_order_acq_rel);
         },
         [this, merge_complete_cb]() -> void { mergeInternal(merge_complete_cb); });
   } else {
@@ -776,18 +776,25 @@ Histogram& ThreadLocalStoreImpl::tlsHistogram(ParentHistogramImpl& parent, uint6
   // See comments in counterFromStatName() which explains the logic here.
 
   TlsHistogramSharedPtr* tls_histogram = nullptr;
+  HistogramEpochSharedPtr epoch;
   if (!shutting_down_ && tls_cache_) {
-    tls_histogram = &(tlsCache().tls_histogram_cache_[id]);
+    TlsCache& tls_cache = tlsCache();
+    tls_histogram = &(tls_cache.tls_histogram_cache_[id]);
     if (*tls_histogram != nullptr) {
       return **tls_histogram;
     }
+    epoch = tls_cache.histogram_epoch_;
+  } else {
+    // Histograms created outside a TLS cache (e.g. during shutdown) never see a merge-driven
+    // swap; give them a private epoch so they keep collecting into buffer 0.
+    epoch = std::make_shared<std::atomic<uint64_t>>(0);
   }
 
   StatNameTagHelper tag_helper(*this, parent.statName(), absl::nullopt);
 
   TlsHistogramSharedPtr hist_tls_ptr(
       new ThreadLocalHistogramImpl(parent.statName(), parent.unit(), tag_helper.tagExtractedName(),
-                                   tag_helper.statNameTags(), symbolTable()));
+                                   tag_helper.statNameTags(), std::move(epoch), symbolTable()));
 
   parent.addTlsHistogram(hist_tls_ptr);
 
@@ -801,9 +808,11 @@ Histogram& ThreadLocalStoreImpl::tlsHistogram(ParentHistogramImpl& parent, uint6
 ThreadLocalHistogramImpl::ThreadLocalHistogramImpl(StatName name, Histogram::Unit unit,
                                                    StatName tag_extracted_name,
                                                    const StatNameTagVector& stat_name_tags,
+                                                   HistogramEpochSharedPtr epoch,
                                                    SymbolTable& symbol_table)
     : HistogramImplHelper(name, tag_extracted_name, stat_name_tags, symbol_table), unit_(unit),
-      used_(false), created_thread_id_(std::this_thread::get_id()), symbol_table_(symbol_table) {
+      epoch_(std::move(epoch)), used_(false), created_thread_id_(std::this_thread::get_id()),
+      symbol_table_(symbol_table) {
   histograms_[0] = hist_alloc();
   histograms_[1] = hist_alloc();
 }
@@ -816,7 +825,7 @@ ThreadLocalHistogramImpl::~ThreadLocalHistogramImpl() {
 
 void ThreadLocalHistogramImpl::recordValue(uint64_t value) {
   ASSERT(std::this_thread::get_id() == created_thread_id_);
-  hist_insert_intscale(histograms_[current_active_], value, 0, 1);
+  hist_insert_intscale(histograms_[currentIndex()], value, 0, 1);
   used_ = true;
 }
 
@@ -26,29 +26,26 @@
 namespace Envoy {
 namespace Stats {
 
+// Epoch counter shared by every TLS histogram on a worker; its low bit selects which of the two
+// per-histogram buffers collects new values. Bumping it once per merge cycle swaps all of a
+// worker's histograms in O(1) rather than walking the histogram cache.
+using HistogramEpochSharedPtr = std::shared_ptr<std::atomic<uint64_t>>;
+
 /**
  * A histogram that is stored in TLS and used to record values per thread. This holds two
  * histograms, one to collect the values and other as backup that is used for merge process. The
- * swap happens during the merge process.
+ * swap happens during the merge process by incrementing the worker-wide epoch, so starting a
+ * merge does no per-histogram work on the data path.
  */
 class ThreadLocalHistogramImpl : public HistogramImplHelper {
 public:
   ThreadLocalHistogramImpl(StatName name, Histogram::Unit unit, StatName tag_extracted_name,
-                           const StatNameTagVector& stat_name_tags, SymbolTable& symbol_table);
+                           const StatNameTagVector& stat_name_tags,
+                           HistogramEpochSharedPtr epoch, SymbolTable& symbol_table);
   ~ThreadLocalHistogramImpl() override;
 
   void merge(histogram_t* target);
 
-  /**
-   * Called in the beginning of merge process. Swaps the histogram used for collection so that we do
-   * not have to lock the histogram in high throughput TLS writes.
-   */
-  void beginMerge() {
-    // This switches the current_active_ between 1 and 0.
-    ASSERT(std::this_thread::get_id() == created_thread_id_);
-    current_active_ = otherHistogramIndex();
-  }
-
   // Stats::Histogram
   Histogram::Unit unit() const override {
     // If at some point ThreadLocalHistogramImpl will hold a pointer to its parent we can just
@@ -64,8 +61,12 @@ public:
 
 private:
   Histogram::Unit unit_;
-  uint64_t otherHistogramIndex() const { return 1 - current_active_; }
-  uint64_t current_active_{0};
+  // Index of the histogram currently collecting values. The relaxed load is sufficient on the
+  // owning worker thread; the merge path on the main thread is ordered against the epoch bump by
+  // the cross-thread post that starts the merge.
+  uint64_t currentIndex() const { return epoch_->load(std::memory_order_relaxed) & 1; }
+  uint64_t otherHistogramIndex() const { return 1 - currentIndex(); }
+  const HistogramEpochSharedPtr epoch_;
   histogram_t* histograms_[2];
   std::atomic<bool> used_;
   std::thread::id created_thread_id_;
@@ -459,6 +460,12 @@ private:
 
     // Maps from histogram ID (monotonically increasing) to a TLS histogram.
     absl::flat_hash_map<uint64_t, TlsHistogramSharedPtr> tls_histogram_cache_;
+
+    // Epoch shared with every histogram in tls_histogram_cache_; bumped once on this worker at
+    // the start of each merge cycle to swap all of its histograms' collection buffers. Held by
+    // shared_ptr as TLS histograms are also referenced by their parents and can outlive the
+    // cache during shutdown.
+    HistogramEpochSharedPtr histogram_epoch_{std::make_shared<std::atomic<uint64_t>>(0)};
   };
 
   using ScopeImplSharedPtr = std::shared_ptr<ScopeImpl>;
@@ -75,7 +75,18 @@ void FilterStateImpl::setData(absl::string_view data_name, std::shared_ptr<Objec
   filter_object->data_ = data;
   filter_object->state_type_ = state_type;
   filter_object->stream_sharing_ = stream_sharing;
+  FilterStateImpl::FilterObject* raw_object = filter_object.get();
   data_storage_[data_name] = std::move(filter_object);
+
+  // If the name has a registered typed key, index the object for hash-free typed lookups. This
+  // also refreshes the index on overwrites, where the map entry above replaces the old object.
+  const absl::optional<uint32_t> index = FilterStateTypedKeyRegistry::instance().find(data_name);
+  if (index.has_value()) {
+    if (typed_data_storage_.size() <= *index) {
+      typed_data_storage_.resize(*index + 1);
+    }
+    typed_data_storage_[*index] = raw_object;
+  }
 }
 
 bool FilterStateImpl::hasDataWithName(absl::string_view data_name) const {
@@ -97,10 +108,31 @@ FilterStateImpl::getDataReadOnlyGeneric(absl::string_view data_name) const {
   return current->data_.get();
 }
 
+const FilterState::Object*
+FilterStateImpl::getDataReadOnlyGeneric(const FilterState::TypedKey& key) const {
+  if (key.index() < typed_data_storage_.size() && typed_data_storage_[key.index()] != nullptr) {
+    return typed_data_storage_[key.index()]->data_.get();
+  }
+  // An object stored before the typed key was first resolved is only present in the hashed
+  // storage; check it before recursing so the typed path never sees less than the string path.
+  const auto it = data_storage_.find(key.name());
+  if (it != data_storage_.end()) {
+    return it->second->data_.get();
+  }
+  if (parent_) {
+    return parent_->getDataReadOnlyGeneric(key);
+  }
+  return nullptr;
+}
+
 FilterState::Object* FilterStateImpl::getDataMutableGeneric(absl::string_view data_name) {
   return getDataSharedMutableGeneric(data_name).get();
 }
 
+FilterState::Object* FilterStateImpl::getDataMutableGeneric(const FilterState::TypedKey& key) {
+  return getDataSharedMutableGeneric(key).get();
+}
+
 std::shared_ptr<FilterState::Object>
 FilterStateImpl::getDataSharedMutableGeneric(absl::string_view data_name) {
   const auto& it = data_storage_.find(data_name);
@@ -122,6 +154,33 @@ FilterStateImpl::getDataSharedMutableGeneric(absl::string_view data_name) {
   return current->data_;
 }
 
+std::shared_ptr<FilterState::Object>
+FilterStateImpl::getDataSharedMutableGeneric(const FilterState::TypedKey& key) {
+  FilterStateImpl::FilterObject* current = nullptr;
+  if (key.index() < typed_data_storage_.size() && typed_data_storage_[key.index()] != nullptr) {
+    current = typed_data_storage_[key.index()];
+  } else {
+    // An object stored before the typed key was first resolved is only present in the hashed
+    // storage; check it before recursing so the typed path never sees less than the string path.
+    const auto& it = data_storage_.find(key.name());
+    if (it == data_storage_.end()) {
+      if (parent_) {
+        return parent_->getDataSharedMutableGeneric(key);
+      }
+      return nullptr;
+    }
+    current = it->second.get();
+  }
+
+  if (current->state_type_ == FilterState::StateType::ReadOnly) {
+    IS_ENVOY_BUG("FilterStateAccessViolation: FilterState accessed immutable data as mutable.");
+    // To reduce the chances of a crash, allow the mutation in this case instead of returning a
+    // nullptr.
+  }
+
+  return current->data_;
+}
+
 bool FilterStateImpl::hasDataAtOrAboveLifeSpan(FilterState::LifeSpan life_span) const {
   if (life_span > life_span_) {
     return parent_ && parent_->hasDataAtOrAboveLifeSpan(life_span);
@@ -33,14 +33,20 @@ public:
   }
 
   // FilterState
+  // Bring in the typed-key setData() overload, which forwards to the string-keyed override
+  // below and would otherwise be hidden by it.
+  using FilterState::setData;
   void setData(
       absl::string_view data_name, std::shared_ptr<Object> data, FilterState::StateType state_type,
       FilterState::LifeSpan life_span = FilterState::LifeSpan::FilterChain,
       StreamSharingMayImpactPooling stream_sharing = StreamSharingMayImpactPooling::None) override;
   bool hasDataWithName(absl::string_view) const override;
   const Object* getDataReadOnlyGeneric(absl::string_view data_name) const override;
+  const Object* getDataReadOnlyGeneric(const TypedKey& key) const override;
   Object* getDataMutableGeneric(absl::string_view data_name) override;
+  Object* getDataMutableGeneric(const TypedKey& key) override;
   std::shared_ptr<Object> getDataSharedMutableGeneric(absl::string_view data_name) override;
+  std::shared_ptr<Object> getDataSharedMutableGeneric(const TypedKey& key) override;
   bool hasDataAtOrAboveLifeSpan(FilterState::LifeSpan life_span) const override;
   FilterState::ObjectsPtr objectsSharedWithUpstreamConnection() const override;
 
@@ -55,6 +61,10 @@ private:
   FilterStateSharedPtr parent_;
   const FilterState::LifeSpan life_span_;
   absl::flat_hash_map<std::string, std::unique_ptr<FilterObject>> data_storage_;
+  // Non-owning index over data_storage_ entries whose name has a registered typed key, addressed
+  // by TypedKey::index(). The pointees are owned by data_storage_ and are refreshed whenever
+  // setData() stores or overwrites an object.
+  std::vector<FilterObject*> typed_data_storage_;
 };
 
 } // namespace StreamInfo
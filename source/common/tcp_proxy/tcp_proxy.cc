@@ -811,6 +811,12 @@ void Filter::onDownstreamEvent(Network::ConnectionEvent event) {
     Tcp::ConnectionPool::ConnectionDataPtr conn_data(upstream_->onDownstreamEvent(event));
     if (conn_data != nullptr &&
         conn_data->connection().state() != Network::Connection::State::Closed) {
+      if (idle_timer_ != nullptr) {
+        ASSERT(idle_timeout_);
+        // The lazily armed deadline may predate the most recent activity; give the drainer a
+        // full idle timeout from the start of the drain.
+        idle_timer_->enableTimer(idle_timeout_.value());
+      }
       config_->drainManager().add(config_->sharedConfig(), std::move(conn_data),
                                   std::move(upstream_callbacks_), std::move(idle_timer_),
                                   idle_timeout_, read_callbacks_->upstreamHost());
@@ -929,6 +935,18 @@ void Filter::onUpstreamConnection() {
 }
 
 void Filter::onIdleTimeout() {
+  if (activity_since_idle_timer_armed_) {
+    // There has been activity since the timer was armed (see resetIdleTimer()); push the
+    // deadline out to one idle timeout past the most recent activity.
+    activity_since_idle_timer_armed_ = false;
+    ASSERT(idle_timeout_);
+    const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+        last_activity_time_ + idle_timeout_.value() -
+        read_callbacks_->connection().dispatcher().approximateMonotonicTime());
+    idle_timer_->enableTimer(std::max(remaining, std::chrono::milliseconds(0)));
+    return;
+  }
+
   ENVOY_CONN_LOG(debug, "Session timed out", read_callbacks_->connection());
   config_->stats().idle_timeout_.inc();
 
@@ -981,7 +999,15 @@ void Filter::disableAccessLogFlushTimer() {
 void Filter::resetIdleTimer() {
   if (idle_timer_ != nullptr) {
     ASSERT(idle_timeout_);
-    idle_timer_->enableTimer(idle_timeout_.value());
+    if (idle_timer_->enabled()) {
+      // Hot path: record the activity and let onIdleTimeout() push the armed deadline out past
+      // it, rather than re-arming the timer on every proxied read and write.
+      last_activity_time_ = read_callbacks_->connection().dispatcher().approximateMonotonicTime();
+      activity_since_idle_timer_armed_ = true;
+    } else {
+      idle_timer_->enableTimer(idle_timeout_.value());
+      activity_since_idle_timer_armed_ = false;
+    }
   }
 }
 
@@ -658,6 +658,11 @@ protected:
   Network::TransportSocketOptionsConstSharedPtr transport_socket_options_;
   Network::Socket::OptionsSharedPtr upstream_options_;
   absl::optional<std::chrono::milliseconds> idle_timeout_;
+  // The idle timer is armed lazily: data events only record the most recent activity here, and
+  // onIdleTimeout() pushes the armed deadline out past it, so the hot forwarding path does not
+  // re-arm the timer on every proxied read and write. See resetIdleTimer().
+  MonotonicTime last_activity_time_;
+  bool activity_since_idle_timer_armed_{};
   uint32_t connect_attempts_{};
   bool connecting_{};
   bool downstream_closed_{};
@@ -0,0 +1,128 @@
+#include "source/common/thread/stack_capture.h"
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <csignal>
+#include <cstring>
+#endif
+
+#include "source/common/common/fmt.h"
+
+#ifdef __linux__
+#include "absl/debugging/stacktrace.h"
+#include "absl/debugging/symbolize.h"
+#include "absl/time/clock.h"
+#endif
+
+namespace Envoy {
+namespace Thread {
+
+#ifdef __linux__
+namespace {
+
+// The signal used to interrupt the target thread. SIGURG is ignored by default, is not handled by
+// the fatal signal machinery in source/common/signal, and unlike SIGPROF does not collide with
+// the CPU profiler used by the watchdog profile action.
+constexpr int CaptureSignal = SIGURG;
+
+constexpr int MaxStackDepth = 64;
+
+// Capture state shared between the requesting thread and the signal handler. `capture_target_tid`
+// makes the handler ignore stray SIGURG deliveries (e.g. raised by TCP out-of-band data) as well
+// as late deliveries from a request that already timed out; `capture_done` is the
+// handler-to-requester completion signal.
+std::atomic<bool> capture_in_progress{false};
+std::atomic<int64_t> capture_target_tid{0};
+std::atomic<int> capture_stack_depth{0};
+void* capture_stack_frames[MaxStackDepth];
+
+void captureSignalHandler(int, siginfo_t*, void*) {
+  if (!capture_in_progress.load(std::memory_order_acquire) ||
+      syscall(SYS_gettid) != capture_target_tid.load(std::memory_order_acquire)) {
+    return;
+  }
+  // Skip count of 2 drops this handler and the signal trampoline.
+  capture_stack_depth.store(absl::GetStackTrace(capture_stack_frames, MaxStackDepth,
+                                                /* skip_count= */ 2),
+                            std::memory_order_release);
+}
+
+bool installCaptureHandler() {
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  sigemptyset(&action.sa_mask);
+  action.sa_sigaction = captureSignalHandler;
+  // SA_RESTART keeps restartable syscalls in the target thread from failing with EINTR when the
+  // capture signal interrupts them.
+  action.sa_flags = SA_SIGINFO | SA_RESTART;
+  return sigaction(CaptureSignal, &action, nullptr) == 0;
+}
+
+} // namespace
+
+absl::optional<std::string> captureThreadStack(const ThreadId& tid, absl::Duration timeout) {
+  // The handler is installed lazily so that processes which never request a capture keep the
+  // default (ignored) disposition for the signal.
+  static const bool handler_installed = installCaptureHandler();
+  if (!handler_installed) {
+    return absl::nullopt;
+  }
+
+  bool expected = false;
+  if (!capture_in_progress.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+    // Another capture is already in flight.
+    return absl::nullopt;
+  }
+  capture_stack_depth.store(0, std::memory_order_release);
+  capture_target_tid.store(tid.getId(), std::memory_order_release);
+
+  if (syscall(SYS_tgkill, getpid(), static_cast<pid_t>(tid.getId()), CaptureSignal) != 0) {
+    capture_target_tid.store(0, std::memory_order_release);
+    capture_in_progress.store(false, std::memory_order_release);
+    return absl::nullopt;
+  }
+
+  const absl::Time deadline = absl::Now() + timeout;
+  while (capture_stack_depth.load(std::memory_order_acquire) == 0) {
+    if (absl::Now() >= deadline) {
+      // A late handler invocation will see a mismatched target tid and do nothing.
+      capture_target_tid.store(0, std::memory_order_release);
+      capture_in_progress.store(false, std::memory_order_release);
+      return absl::nullopt;
+    }
+    absl::SleepFor(absl::Milliseconds(1));
+  }
+
+  const int depth = capture_stack_depth.load(std::memory_order_acquire);
+  std::string out;
+  for (int i = 0; i < depth; ++i) {
+    char symbol[1024];
+    if (absl::Symbolize(capture_stack_frames[i], symbol, sizeof(symbol))) {
+      out += fmt::format("#{}: {} [{}]\n", i, symbol, capture_stack_frames[i]);
+    } else {
+      out += fmt::format("#{}: [{}]\n", i, capture_stack_frames[i]);
+    }
+  }
+  if (!out.empty() && out.back() == '\n') {
+    out.pop_back();
+  }
+  capture_target_tid.store(0, std::memory_order_release);
+  capture_in_progress.store(false, std::memory_order_release);
+  return out;
+}
+
+#else
+
+absl::optional<std::string> captureThreadStack(const ThreadId& /*tid*/,
+                                               absl::Duration /*timeout*/) {
+  // Directing a signal at a specific thread by ThreadId is only implemented on Linux.
+  return absl::nullopt;
+}
+
+#endif
+
+} // namespace Thread
+} // namespace Envoy
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <string>
+
+#include "envoy/thread/thread.h"
+
+#include "absl/time/time.h"
+#include "absl/types/optional.h"
+
+namespace Envoy {
+namespace Thread {
+
+/**
+ * Attempts to capture and symbolize the call stack of another thread in this process, identified
+ * by its ThreadId. The target thread is interrupted with a signal whose handler records the raw
+ * stack; symbolization happens on the calling thread. The caller blocks for at most `timeout`
+ * waiting for the handler to run, which may never happen if the target thread is blocked in an
+ * uninterruptible state.
+ *
+ * Only one capture may be in flight at a time; concurrent calls fail. Directing a signal at a
+ * specific thread by ThreadId is currently only implemented on Linux; other platforms return
+ * nullopt.
+ *
+ * @param tid the thread whose stack should be captured.
+ * @param timeout how long to wait for the target thread to run the capture handler.
+ * @return the symbolized stack, one "#<n>: <symbol> [<address>]" line per frame (the same format
+ * used by BackwardsTrace, so tools/stack_decode.py applies), or nullopt if the capture could not
+ * be performed or timed out.
+ */
+absl::optional<std::string> captureThreadStack(const ThreadId& tid, absl::Duration timeout);
+
+} // namespace Thread
+} // namespace Envoy
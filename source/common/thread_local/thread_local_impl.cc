@@ -137,14 +137,18 @@ void InstanceImpl::SlotImpl::set(InitializeCb cb) {
   ASSERT_IS_MAIN_OR_TEST_THREAD();
   ASSERT(!parent_.shutdown_);
 
+  // The initialize callback is shared across workers; each worker needs its own wrapper lambda
+  // anyway to capture its dispatcher.
+  auto cb_shared = std::make_shared<InitializeCb>(std::move(cb));
   for (Event::Dispatcher& dispatcher : parent_.registered_threads_) {
     // See the header file comments for still_alive_guard_ for why we capture index_.
-    dispatcher.post(wrapCallback(
-        [index = index_, cb, &dispatcher]() -> void { setThreadLocal(index, cb(dispatcher)); }));
+    dispatcher.post(wrapCallback([index = index_, cb_shared, &dispatcher]() -> void {
+      setThreadLocal(index, (*cb_shared)(dispatcher));
+    }));
   }
 
   // Handle main thread.
-  setThreadLocal(index_, cb(*parent_.main_thread_dispatcher_));
+  setThreadLocal(index_, (*cb_shared)(*parent_.main_thread_dispatcher_));
 }
 
 void InstanceImpl::registerThread(Event::Dispatcher& dispatcher, bool main_thread) {
@@ -192,12 +196,16 @@ void InstanceImpl::runOnAllThreads(std::function<void()> cb) {
   ASSERT_IS_MAIN_OR_TEST_THREAD();
   ASSERT(!shutdown_);
 
+  // Share a single copy of the callback across workers rather than copying its capture chain
+  // into every worker's post queue. This mirrors the cb_guard approach in the completion
+  // callback overload below.
+  auto cb_shared = std::make_shared<std::function<void()>>(std::move(cb));
   for (Event::Dispatcher& dispatcher : registered_threads_) {
-    dispatcher.post(cb);
+    dispatcher.post([cb_shared]() -> void { (*cb_shared)(); });
   }
 
   // Handle main thread.
-  cb();
+  (*cb_shared)();
 }
 
 void InstanceImpl::runOnAllThreads(std::function<void()> cb,
@@ -80,6 +80,12 @@ protected:
   Singleton::Manager& singleton_manager_;
   Server::ServerLifecycleNotifier& lifecycle_notifier_;
 
+  // Whether the validation context is delivered dynamically through SDS rather than fixed by the
+  // configuration proto.
+  bool validationContextIsDynamic() const {
+    return certificate_validation_context_provider_ != nullptr;
+  }
+
 private:
   static unsigned tlsVersionFromProto(
       const envoy::extensions::transport_sockets::tls::v3::TlsParameters::TlsProtocol& version,
@@ -313,22 +313,28 @@ ContextImpl::ContextImpl(Stats::Scope& scope, const Envoy::Ssl::ContextConfig& c
   SET_AND_RETURN_IF_NOT_OK(creation_status, creation_status);
 
 #if BORINGSSL_API_VERSION >= 21
-  // Register stat names based on lists reported by BoringSSL.
-  std::vector<const char*> list(SSL_get_all_cipher_names(nullptr, 0));
-  SSL_get_all_cipher_names(list.data(), list.size());
-  stat_name_set_->rememberBuiltins(list);
-
-  list.resize(SSL_get_all_curve_names(nullptr, 0));
-  SSL_get_all_curve_names(list.data(), list.size());
-  stat_name_set_->rememberBuiltins(list);
-
-  list.resize(SSL_get_all_signature_algorithm_names(nullptr, 0));
-  SSL_get_all_signature_algorithm_names(list.data(), list.size());
-  stat_name_set_->rememberBuiltins(list);
-
-  list.resize(SSL_get_all_version_names(nullptr, 0));
-  SSL_get_all_version_names(list.data(), list.size());
-  stat_name_set_->rememberBuiltins(list);
+  // Register stat names based on lists reported by BoringSSL. The lists are process constants,
+  // so query them once rather than on every context construction: contexts are rebuilt for each
+  // certificate rotation, and with frequent SDS rotations across many contexts the repeated
+  // queries add up.
+  static const std::vector<const char*>& builtin_names = []() -> const std::vector<const char*>& {
+    auto* names = new std::vector<const char*>(SSL_get_all_cipher_names(nullptr, 0));
+    SSL_get_all_cipher_names(names->data(), names->size());
+
+    size_t offset = names->size();
+    names->resize(offset + SSL_get_all_curve_names(nullptr, 0));
+    SSL_get_all_curve_names(names->data() + offset, names->size() - offset);
+
+    offset = names->size();
+    names->resize(offset + SSL_get_all_signature_algorithm_names(nullptr, 0));
+    SSL_get_all_signature_algorithm_names(names->data() + offset, names->size() - offset);
+
+    offset = names->size();
+    names->resize(offset + SSL_get_all_version_names(nullptr, 0));
+    SSL_get_all_version_names(names->data() + offset, names->size() - offset);
+    return *names;
+  }();
+  stat_name_set_->rememberBuiltins(builtin_names);
 #else
   // Use the SSL library to iterate over the configured ciphers.
   //
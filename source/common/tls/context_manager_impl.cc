@@ -9,9 +9,12 @@
 
 #include "source/common/common/assert.h"
 #include "source/common/config/utility.h"
+#include "source/common/runtime/runtime_features.h"
 #include "source/common/tls/client_context_impl.h"
 #include "source/common/tls/context_impl.h"
 
+#include "absl/strings/str_join.h"
+
 namespace Envoy {
 namespace Extensions {
 namespace TransportSockets {
@@ -30,7 +33,7 @@ ContextManagerImpl::createSslClientContext(Stats::Scope& scope,
   auto context_or_error = ClientContextImpl::create(scope, config, factory_context_);
   RETURN_IF_NOT_OK(context_or_error.status());
   Envoy::Ssl::ClientContextSharedPtr context = std::move(context_or_error.value());
-  contexts_.insert(context);
+  ++contexts_[context];
   return context;
 }
 
@@ -42,6 +45,27 @@ absl::StatusOr<Envoy::Ssl::ServerContextSharedPtr> ContextManagerImpl::createSsl
     return nullptr;
   }
 
+  // Building a server context compiles certificates and chains, which is expensive when many SNI
+  // filter chains share the same configuration. Share one context across callers whose resolved
+  // configuration content, server names and stats scope are identical. Callers supplying an
+  // additional init function are excluded since it may capture per-caller state.
+  absl::optional<ServerContextCacheKey> cache_key;
+  if (additional_init == nullptr &&
+      Runtime::runtimeFeatureEnabled("envoy.reloadable_features.tls_server_context_dedup")) {
+    const absl::optional<uint64_t> content_hash = config.contentHash();
+    if (content_hash.has_value()) {
+      cache_key.emplace(&scope, absl::StrJoin(server_names, ","), *content_hash);
+      auto cache_it = server_context_cache_.find(*cache_key);
+      if (cache_it != server_context_cache_.end()) {
+        if (Envoy::Ssl::ServerContextSharedPtr cached = cache_it->second.lock()) {
+          ++contexts_[cached];
+          return cached;
+        }
+        server_context_cache_.erase(cache_it);
+      }
+    }
+  }
+
   auto factory = Envoy::Config::Utility::getFactoryByName<ServerContextFactory>(
       "envoy.ssl.server_context_factory.default");
   if (!factory) {
@@ -52,13 +76,20 @@ absl::StatusOr<Envoy::Ssl::ServerContextSharedPtr> ContextManagerImpl::createSsl
       factory->createServerContext(scope, config, server_names, factory_context_,
                                    std::move(additional_init));
   RETURN_IF_NOT_OK(context_or_error.status());
-  contexts_.insert(*context_or_error);
+  ++contexts_[*context_or_error];
+  if (cache_key.has_value()) {
+    if (server_context_cache_.size() > 2 * contexts_.size() + 16) {
+      absl::erase_if(server_context_cache_,
+                     [](const auto& entry) { return entry.second.expired(); });
+    }
+    server_context_cache_[*cache_key] = *context_or_error;
+  }
   return *context_or_error;
 }
 
 absl::optional<uint32_t> ContextManagerImpl::daysUntilFirstCertExpires() const {
   absl::optional<uint32_t> ret = absl::make_optional(std::numeric_limits<uint32_t>::max());
-  for (const auto& context : contexts_) {
+  for (const auto& [context, ref_count] : contexts_) {
     if (context) {
       const absl::optional<uint32_t> tmp = context->daysUntilFirstCertExpires();
       if (!tmp.has_value()) {
@@ -72,7 +103,7 @@ absl::optional<uint32_t> ContextManagerImpl::daysUntilFirstCertExpires() const {
 
 absl::optional<uint64_t> ContextManagerImpl::secondsUntilFirstOcspResponseExpires() const {
   absl::optional<uint64_t> ret;
-  for (const auto& context : contexts_) {
+  for (const auto& [context, ref_count] : contexts_) {
     if (context) {
       auto next_expiration = context->secondsUntilFirstOcspResponseExpires();
       if (next_expiration) {
@@ -85,7 +116,7 @@ absl::optional<uint64_t> ContextManagerImpl::secondsUntilFirstOcspResponseExpire
 }
 
 void ContextManagerImpl::iterateContexts(std::function<void(const Envoy::Ssl::Context&)> callback) {
-  for (const auto& context : contexts_) {
+  for (const auto& [context, ref_count] : contexts_) {
     if (context) {
       callback(*context);
     }
@@ -94,10 +125,15 @@ void ContextManagerImpl::iterateContexts(std::function<void(const Envoy::Ssl::Co
 
 void ContextManagerImpl::removeContext(const Envoy::Ssl::ContextSharedPtr& old_context) {
   if (old_context != nullptr) {
-    auto erased = contexts_.erase(old_context);
-    // The contexts is expected to be added before is removed.
-    // And the prod ssl factory implementation guarantees any context is removed exactly once.
-    ASSERT(erased == 1);
+    auto it = contexts_.find(old_context);
+    // The context is expected to be added before it is removed.
+    // And the prod ssl factory implementation guarantees any context is removed exactly once
+    // per createSsl*Context() call which returned it, so the reference count reaches zero when
+    // the last owner of a shared context goes away.
+    ASSERT(it != contexts_.end());
+    if (it != contexts_.end() && --it->second == 0) {
+      contexts_.erase(it);
+    }
   }
 }
 
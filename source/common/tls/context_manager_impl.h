@@ -12,6 +12,8 @@
 
 #include "source/common/tls/private_key/private_key_manager_impl.h"
 
+#include "absl/container/flat_hash_map.h"
+
 namespace Envoy {
 namespace Extensions {
 namespace TransportSockets {
@@ -45,8 +47,20 @@ public:
   void removeContext(const Envoy::Ssl::ContextSharedPtr& old_context) override;
 
 private:
+  // Key under which server contexts may be shared: the stats scope, the server names the context
+  // is built for, and the content hash of the fully resolved configuration.
+  using ServerContextCacheKey = std::tuple<const Stats::Scope*, std::string, uint64_t>;
+
   Server::Configuration::CommonFactoryContext& factory_context_;
-  absl::flat_hash_set<Envoy::Ssl::ContextSharedPtr> contexts_;
+  // Tracked contexts with the number of createSsl*Context() calls that returned each one. An
+  // entry is dropped once removeContext() has been called a matching number of times, which
+  // allows a deduplicated context to be handed out to, and removed by, multiple owners.
+  absl::flat_hash_map<Envoy::Ssl::ContextSharedPtr, uint64_t> contexts_;
+  // Live server contexts by content, used to share one compiled context across identical filter
+  // chains instead of building a copy per chain. Entries hold weak references so the cache never
+  // extends a context's lifetime; expired entries are shed lazily.
+  absl::flat_hash_map<ServerContextCacheKey, std::weak_ptr<Envoy::Ssl::ServerContext>>
+      server_context_cache_;
   PrivateKeyMethodManagerImpl private_key_method_manager_{};
 };
 
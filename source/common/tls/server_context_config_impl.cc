@@ -7,6 +7,7 @@
 
 #include "source/common/common/assert.h"
 #include "source/common/common/empty_string.h"
+#include "source/common/common/hash.h"
 #include "source/common/config/datasource.h"
 #include "source/common/network/cidr_range.h"
 #include "source/common/protobuf/message_validator_impl.h"
@@ -122,6 +123,7 @@ ServerContextConfigImpl::ServerContextConfigImpl(
       ocsp_staple_policy_(ocspStaplePolicyFromProto(config.ocsp_staple_policy())),
       session_ticket_keys_provider_(
           getTlsSessionTicketKeysConfigProvider(factory_context, config, creation_status)),
+      static_config_hash_(HashUtil::xxHash64Value(for_quic, MessageUtil::hash(config))),
       disable_stateless_session_resumption_(getStatelessSessionResumptionDisabled(config)),
       disable_stateful_session_resumption_(config.disable_stateful_session_resumption()),
       full_scan_certs_on_sni_mismatch_(
@@ -251,6 +253,47 @@ Ssl::ServerContextConfig::OcspStaplePolicy ServerContextConfigImpl::ocspStaplePo
   PANIC_DUE_TO_CORRUPT_ENUM;
 }
 
+absl::optional<uint64_t> ServerContextConfigImpl::contentHash() const {
+  // Private key providers are stateful per-config extension points, so contexts built around
+  // them are never interchangeable.
+  for (const auto& tls_certificate : tlsCertificates()) {
+    if (tls_certificate.get().privateKeyMethod() != nullptr) {
+      return absl::nullopt;
+    }
+  }
+  // A validation context delivered through SDS is not pinned by the static proto hash and has
+  // too many matcher fields to enumerate reliably, so such configs are never shared.
+  if (validationContextIsDynamic()) {
+    return absl::nullopt;
+  }
+  // The proto hash covers every statically configured field. TLS certificates and session
+  // ticket keys may be resolved through SDS after construction, so fold their current contents
+  // in explicitly. Chaining through the seed makes both ordering and element count significant.
+  uint64_t hash = static_config_hash_;
+  for (const auto& tls_certificate_ref : tlsCertificates()) {
+    const auto& tls_certificate = tls_certificate_ref.get();
+    hash = HashUtil::xxHash64(tls_certificate.certificateChain(), hash);
+    hash = HashUtil::xxHash64(tls_certificate.privateKey(), hash);
+    hash = HashUtil::xxHash64(tls_certificate.pkcs12(), hash);
+    hash = HashUtil::xxHash64(tls_certificate.password(), hash);
+    const std::vector<uint8_t>& ocsp_staple = tls_certificate.ocspStaple();
+    hash = HashUtil::xxHash64(
+        absl::string_view(reinterpret_cast<const char*>(ocsp_staple.data()), ocsp_staple.size()),
+        hash);
+  }
+  for (const auto& key : session_ticket_keys_) {
+    hash = HashUtil::xxHash64(
+        absl::string_view(reinterpret_cast<const char*>(key.name_.data()), key.name_.size()), hash);
+    hash = HashUtil::xxHash64(absl::string_view(reinterpret_cast<const char*>(key.hmac_key_.data()),
+                                                key.hmac_key_.size()),
+                              hash);
+    hash = HashUtil::xxHash64(
+        absl::string_view(reinterpret_cast<const char*>(key.aes_key_.data()), key.aes_key_.size()),
+        hash);
+  }
+  return hash;
+}
+
 Ssl::TlsCertificateSelectorFactory ServerContextConfigImpl::tlsCertificateSelectorFactory() const {
   if (!tls_certificate_selector_factory_) {
     IS_ENVOY_BUG("No envoy.tls.certificate_selectors registered");
@@ -44,6 +44,7 @@ public:
   bool preferClientCiphers() const override { return prefer_client_ciphers_; }
 
   Ssl::TlsCertificateSelectorFactory tlsCertificateSelectorFactory() const override;
+  absl::optional<uint64_t> contentHash() const override;
 
 private:
   ServerContextConfigImpl(
@@ -72,6 +73,9 @@ private:
           policy);
 
   Ssl::TlsCertificateSelectorFactory tls_certificate_selector_factory_;
+  // Hash of the configuration proto, which pins every statically configured field; see
+  // contentHash() for how dynamically resolved secrets are folded in.
+  const uint64_t static_config_hash_;
   absl::optional<std::chrono::seconds> session_timeout_;
   const bool disable_stateless_session_resumption_;
   const bool disable_stateful_session_resumption_;
@@ -13,6 +13,7 @@
 #include "envoy/admin/v3/certs.pb.h"
 #include "envoy/common/exception.h"
 #include "envoy/common/platform.h"
+#include "envoy/singleton/manager.h"
 #include "envoy/ssl/ssl_socket_extended_info.h"
 #include "envoy/stats/scope.h"
 #include "envoy/type/matcher/v3/string.pb.h"
@@ -32,6 +33,7 @@
 
 #include "absl/container/node_hash_set.h"
 #include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
 #include "cert_validator/cert_validator.h"
 #include "openssl/evp.h"
@@ -45,6 +47,8 @@ namespace Extensions {
 namespace TransportSockets {
 namespace Tls {
 
+SINGLETON_MANAGER_REGISTRATION(tls_server_session_cache);
+
 Ssl::CurveNIDVector getClientCurveNIDSupported(CBS& cbs) {
   Ssl::CurveNIDVector cnsv{};
   while (CBS_len(&cbs) > 0) {
@@ -121,6 +125,17 @@ ServerContextImpl::ServerContextImpl(Stats::Scope& scope,
   absl::StatusOr<SessionContextID> id_or_error = generateHashForSessionContextId(server_names);
   SET_AND_RETURN_IF_NOT_OK(id_or_error.status(), creation_status);
   const SessionContextID& session_id = *id_or_error;
+  session_context_id_ = session_id;
+
+  // When stateful resumption is enabled, use the process-wide session cache instead of the
+  // per-SSL_CTX internal one; see the session callback registration below.
+  if (!config.capabilities().handles_session_resumption &&
+      !config.disableStatefulSessionResumption() &&
+      Runtime::runtimeFeatureEnabled("envoy.reloadable_features.tls_shared_session_cache")) {
+    session_cache_ = factory_context.singletonManager().getTyped<ServerSessionCache>(
+        SINGLETON_MANAGER_REGISTERED_NAME(tls_server_session_cache),
+        [] { return std::make_shared<ServerSessionCache>(); });
+  }
 
   // First, configure the base context for ClientHello interception.
   // TODO(htuch): replace with SSL_IDENTITY when we have this as a means to do multi-cert in
@@ -191,6 +206,36 @@ ServerContextImpl::ServerContextImpl(Stats::Scope& scope,
         SSL_CTX_set_session_id_context(ctx.ssl_ctx_.get(), session_id.data(), session_id.size());
     RELEASE_ASSERT(rc == 1, Utility::getLastCryptoError().value_or(""));
 
+    if (session_cache_ != nullptr) {
+      // Replace the per-SSL_CTX internal session cache with the process-wide one so that a
+      // session established on one worker can be resumed on any other, and so that sessions
+      // survive context replacement on certificate rotation.
+      SSL_CTX_set_session_cache_mode(ctx.ssl_ctx_.get(),
+                                     SSL_SESS_CACHE_SERVER | SSL_SESS_CACHE_NO_INTERNAL);
+      SSL_CTX_sess_set_new_cb(ctx.ssl_ctx_.get(), [](SSL* ssl, SSL_SESSION* session) -> int {
+        ContextImpl* context_impl =
+            static_cast<ContextImpl*>(SSL_CTX_get_app_data(SSL_get_SSL_CTX(ssl)));
+        ServerContextImpl* server_context_impl = dynamic_cast<ServerContextImpl*>(context_impl);
+        RELEASE_ASSERT(server_context_impl != nullptr, ""); // for Coverity
+        return server_context_impl->newSessionCallback(session);
+      });
+      SSL_CTX_sess_set_get_cb(ctx.ssl_ctx_.get(),
+                              [](SSL* ssl, const uint8_t* id, int id_len, int* copy) -> SSL_SESSION* {
+                                ContextImpl* context_impl = static_cast<ContextImpl*>(
+                                    SSL_CTX_get_app_data(SSL_get_SSL_CTX(ssl)));
+                                ServerContextImpl* server_context_impl =
+                                    dynamic_cast<ServerContextImpl*>(context_impl);
+                                RELEASE_ASSERT(server_context_impl != nullptr, ""); // for Coverity
+                                return server_context_impl->getSessionCallback(id, id_len, copy);
+                              });
+      SSL_CTX_sess_set_remove_cb(ctx.ssl_ctx_.get(), [](SSL_CTX* ssl_ctx, SSL_SESSION* session) {
+        ContextImpl* context_impl = static_cast<ContextImpl*>(SSL_CTX_get_app_data(ssl_ctx));
+        ServerContextImpl* server_context_impl = dynamic_cast<ServerContextImpl*>(context_impl);
+        RELEASE_ASSERT(server_context_impl != nullptr, ""); // for Coverity
+        server_context_impl->removeSessionCallback(session);
+      });
+    }
+
     auto& ocsp_resp_bytes = tls_certificates[i].get().ocspStaple();
     if (ocsp_resp_bytes.empty()) {
       if (ctx.is_must_staple_) {
@@ -322,6 +367,47 @@ ServerContextImpl::generateHashForSessionContextId(const std::vector<std::string
   return session_id;
 }
 
+std::string ServerContextImpl::sessionCacheKey(absl::string_view session_id) const {
+  return absl::StrCat(
+      absl::string_view(reinterpret_cast<const char*>(session_context_id_.data()),
+                        session_context_id_.size()),
+      session_id);
+}
+
+int ServerContextImpl::newSessionCallback(SSL_SESSION* session) {
+  // TLS 1.3 resumes via tickets; only TLS 1.2 and earlier sessions are looked up by ID.
+  if (SSL_SESSION_get_protocol_version(session) >= TLS1_3_VERSION) {
+    return 0;
+  }
+  unsigned int id_len;
+  const uint8_t* id = SSL_SESSION_get_id(session, &id_len);
+  if (id_len == 0) {
+    return 0;
+  }
+  session_cache_->store(
+      sessionCacheKey(absl::string_view(reinterpret_cast<const char*>(id), id_len)),
+      bssl::UniquePtr<SSL_SESSION>(session));
+  return 1; // We took ownership of the reference.
+}
+
+SSL_SESSION* ServerContextImpl::getSessionCallback(const uint8_t* id, int id_len, int* copy) {
+  // The reference returned by the cache is handed to the library as-is, so no extra copy.
+  *copy = 0;
+  return session_cache_
+      ->find(sessionCacheKey(absl::string_view(reinterpret_cast<const char*>(id), id_len)))
+      .release();
+}
+
+void ServerContextImpl::removeSessionCallback(SSL_SESSION* session) {
+  unsigned int id_len;
+  const uint8_t* id = SSL_SESSION_get_id(session, &id_len);
+  if (id_len == 0) {
+    return;
+  }
+  session_cache_->remove(
+      sessionCacheKey(absl::string_view(reinterpret_cast<const char*>(id), id_len)));
+}
+
 int ServerContextImpl::sessionTicketProcess(SSL*, uint8_t* key_name, uint8_t* iv,
                                             EVP_CIPHER_CTX* ctx, HMAC_CTX* hmac_ctx, int encrypt) {
   const EVP_MD* hmac = EVP_sha256();
@@ -25,6 +25,7 @@
 #include "source/common/tls/context_manager_impl.h"
 #include "source/common/tls/default_tls_certificate_selector.h"
 #include "source/common/tls/ocsp/ocsp.h"
+#include "source/common/tls/server_session_cache.h"
 #include "source/common/tls/stats.h"
 
 #include "absl/synchronization/mutex.h"
@@ -83,12 +84,22 @@ private:
   int sessionTicketProcess(SSL* ssl, uint8_t* key_name, uint8_t* iv, EVP_CIPHER_CTX* ctx,
                            HMAC_CTX* hmac_ctx, int encrypt);
 
+  // Session callbacks backing the cross-worker session cache. These run on worker threads.
+  int newSessionCallback(SSL_SESSION* session);
+  SSL_SESSION* getSessionCallback(const uint8_t* id, int id_len, int* copy);
+  void removeSessionCallback(SSL_SESSION* session);
+  // Cache key for a session ID, prefixed with the session ID context so that contexts with
+  // different certificate sets never serve each other's sessions.
+  std::string sessionCacheKey(absl::string_view session_id) const;
+
   absl::StatusOr<SessionContextID>
   generateHashForSessionContextId(const std::vector<std::string>& server_names);
 
   Ssl::TlsCertificateSelectorPtr tls_certificate_selector_;
   const std::vector<Envoy::Ssl::ServerContextConfig::SessionTicketKey> session_ticket_keys_;
   const Ssl::ServerContextConfig::OcspStaplePolicy ocsp_staple_policy_;
+  SessionContextID session_context_id_{};
+  ServerSessionCacheSharedPtr session_cache_;
 };
 
 class ServerContextFactoryImpl : public ServerContextFactory {
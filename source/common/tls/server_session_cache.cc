@@ -0,0 +1,76 @@
+#include "source/common/tls/server_session_cache.h"
+
+#include <ctime>
+
+#include "source/common/common/hash.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace TransportSockets {
+namespace Tls {
+
+bool ServerSessionCache::expired(const SSL_SESSION* session) {
+  // BoringSSL stamps sessions with the wall clock, so the expiry check has to use the same
+  // clock. The library re-validates the timeout during the resumption handshake in any case;
+  // this only keeps dead entries from occupying cache space.
+  return SSL_SESSION_get_time(session) + SSL_SESSION_get_timeout(session) <
+         static_cast<uint64_t>(time(nullptr));
+}
+
+ServerSessionCache::Shard& ServerSessionCache::shardFor(absl::string_view key) {
+  return shards_[HashUtil::xxHash64(key) % ShardCount];
+}
+
+void ServerSessionCache::store(std::string key, bssl::UniquePtr<SSL_SESSION> session) {
+  Shard& shard = shardFor(key);
+  absl::MutexLock lock(&shard.mutex_);
+
+  auto it = shard.sessions_.find(key);
+  if (it != shard.sessions_.end()) {
+    it->second = std::move(session);
+    return;
+  }
+
+  while (shard.sessions_.size() >= MaxSessionsPerShard && !shard.insertion_order_.empty()) {
+    shard.sessions_.erase(shard.insertion_order_.front());
+    shard.insertion_order_.pop_front();
+  }
+
+  shard.insertion_order_.push_back(key);
+  shard.sessions_.emplace(std::move(key), std::move(session));
+}
+
+bssl::UniquePtr<SSL_SESSION> ServerSessionCache::find(absl::string_view key) {
+  Shard& shard = shardFor(key);
+  absl::MutexLock lock(&shard.mutex_);
+
+  auto it = shard.sessions_.find(key);
+  if (it == shard.sessions_.end()) {
+    return nullptr;
+  }
+  if (expired(it->second.get())) {
+    shard.sessions_.erase(it);
+    return nullptr;
+  }
+  return bssl::UpRef(it->second);
+}
+
+void ServerSessionCache::remove(absl::string_view key) {
+  Shard& shard = shardFor(key);
+  absl::MutexLock lock(&shard.mutex_);
+  shard.sessions_.erase(key);
+}
+
+size_t ServerSessionCache::sessionCount() {
+  size_t count = 0;
+  for (Shard& shard : shards_) {
+    absl::MutexLock lock(&shard.mutex_);
+    count += shard.sessions_.size();
+  }
+  return count;
+}
+
+} // namespace Tls
+} // namespace TransportSockets
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <array>
+#include <deque>
+#include <memory>
+#include <string>
+
+#include "envoy/singleton/instance.h"
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+#include "openssl/ssl.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace TransportSockets {
+namespace Tls {
+
+/**
+ * Process-wide cache for server TLS sessions resumed by session ID, shared by all worker threads
+ * via the singleton manager. Plugging this into the SSL_CTX session callbacks instead of the
+ * per-context internal cache keeps sessions usable no matter which worker accepts the reconnect
+ * and lets them survive context replacement on certificate rotation. The cache is sharded to
+ * keep lock contention between workers low.
+ */
+class ServerSessionCache : public Singleton::Instance {
+public:
+  static constexpr size_t ShardCount = 16;
+  // Matches the total bound of BoringSSL's default internal cache
+  // (SSL_SESSION_CACHE_MAX_SIZE_DEFAULT is 1024 * 20 sessions).
+  static constexpr size_t MaxSessionsPerShard = 1280;
+
+  /**
+   * Store a session under the given key, taking ownership of the reference. Replaces any
+   * existing entry. Once a shard is full the oldest entries are evicted first.
+   */
+  void store(std::string key, bssl::UniquePtr<SSL_SESSION> session);
+
+  /**
+   * @return a new reference to the cached session, or nullptr if the key is unknown or the
+   * session has expired. Expired entries are dropped.
+   */
+  bssl::UniquePtr<SSL_SESSION> find(absl::string_view key);
+
+  /**
+   * Drop the entry for the given key, e.g. when the library invalidates a session.
+   */
+  void remove(absl::string_view key);
+
+  /**
+   * @return the number of cached sessions across all shards, for tests and debugging.
+   */
+  size_t sessionCount();
+
+private:
+  struct Shard {
+    absl::Mutex mutex_;
+    absl::flat_hash_map<std::string, bssl::UniquePtr<SSL_SESSION>> sessions_
+        ABSL_GUARDED_BY(mutex_);
+    // Insertion order for eviction once the shard is full. Keys of entries that were replaced or
+    // removed may linger here; eviction of such a key is either a no-op or, if the key was
+    // re-added in the meantime, drops a live entry early, which is harmless for a cache.
+    std::deque<std::string> insertion_order_ ABSL_GUARDED_BY(mutex_);
+  };
+
+  static bool expired(const SSL_SESSION* session);
+  Shard& shardFor(absl::string_view key);
+
+  std::array<Shard, ShardCount> shards_;
+};
+
+using ServerSessionCacheSharedPtr = std::shared_ptr<ServerSessionCache>;
+
+} // namespace Tls
+} // namespace TransportSockets
+} // namespace Extensions
+} // namespace Envoy
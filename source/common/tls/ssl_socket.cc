@@ -83,6 +83,9 @@ void SslSocket::setTransportSocketCallbacks(Network::TransportSocketCallbacks& c
   SSL_set_ex_data(rawSsl(), ContextImpl::sslSocketIndex(), static_cast<void*>(callbacks_));
 }
 
+// Decrypted bytes land directly in the reservation slice passed in, which is
+// committed into the read buffer without further copies; the only remaining
+// copy on the read path is internal to BoringSSL's record processing.
 SslSocket::ReadResult SslSocket::sslReadIntoSlice(Buffer::RawSlice& slice) {
   ReadResult result;
   uint8_t* mem = static_cast<uint8_t*>(slice.mem_);
@@ -276,9 +279,15 @@ Network::IoResult SslSocket::doWrite(Buffer::Instance& write_buffer, bool end_st
 
     // SSL_write() requires that if a previous call returns SSL_ERROR_WANT_WRITE, we need to call
     // it again with the same parameters. This is done by tracking last write size, but not write
-    // data, since linearize() will return the same undrained data anyway.
+    // data, since both branches below resolve to the same undrained data on retry.
     ASSERT(bytes_to_write <= write_buffer.length());
-    int rc = SSL_write(rawSsl(), write_buffer.linearize(bytes_to_write), bytes_to_write);
+    // When the first slice already holds the whole chunk, encrypt directly from it rather than
+    // paying linearize()'s copy of the fragmented slices into one. The fallback keeps record
+    // sizes large when the buffer is fragmented into small slices.
+    const Buffer::RawSlice front_slice = write_buffer.frontSlice();
+    const void* data = front_slice.len_ >= bytes_to_write ? front_slice.mem_
+                                                          : write_buffer.linearize(bytes_to_write);
+    int rc = SSL_write(rawSsl(), data, bytes_to_write);
     ENVOY_CONN_LOG(trace, "ssl write returns: {}", callbacks_->connection(), rc);
     if (rc > 0) {
       ASSERT(rc == static_cast<int>(bytes_to_write));
@@ -43,6 +43,13 @@ struct SslSocketFactoryStats {
 
 enum class InitialState { Client, Server };
 
+// TODO: evaluate migrating established connections to kernel TLS (TLS_TX/TLS_RX)
+// after the handshake so payload crypto can use sendfile-style zero-copy and NIC
+// offload. This is blocked on BoringSSL exposing the record-layer keys: unlike
+// OpenSSL 3's built-in kTLS support, BoringSSL has no public API to export the
+// negotiated traffic keys, IVs and sequence numbers that setsockopt(SOL_TLS)
+// requires, and SSL_export_keying_material() derives distinct keys by design.
+// Revisit if the bundled BoringSSL grows such an API.
 class SslSocket : public Network::TransportSocket,
                   public Envoy::Ssl::PrivateKeyConnectionCallbacks,
                   public Ssl::HandshakeCallbacks,
@@ -109,6 +109,11 @@ bool isBlockingAdsCluster(const envoy::config::bootstrap::v3::Bootstrap& bootstr
   return blocking_ads_cluster;
 }
 
+// Interval between background initializations of lazy clusters once the server is up. Trickling
+// the warm-up spreads the DNS resolution and TLS context setup cost of a large number of lazy
+// clusters over time instead of paying it all at once.
+constexpr std::chrono::milliseconds LazyClusterWarmingInterval{100};
+
 } // namespace
 
 void ClusterManagerInitHelper::addCluster(ClusterManagerCluster& cm_cluster) {
@@ -405,12 +410,29 @@ ClusterManagerImpl::initialize(const envoy::config::bootstrap::v3::Bootstrap& bo
     }
   }
 
+  // Clusters opting into lazy initialization are retained as raw config and created on first
+  // use (or by the background warmer) instead of being loaded here. Clusters Envoy itself needs
+  // to come up are always initialized eagerly: the ADS cluster and the local cluster.
+  auto retain_lazy_cluster = [this](const envoy::config::cluster::v3::Cluster& cluster,
+                                    bool required_for_ads) -> bool {
+    if (!cluster.lazy_init() || required_for_ads ||
+        (local_cluster_name_.has_value() && cluster.name() == *local_cluster_name_)) {
+      return false;
+    }
+    ENVOY_LOG(debug, "cm lazy init: retaining cluster {} until first use", cluster.name());
+    lazy_static_clusters_.emplace(cluster.name(), cluster);
+    return true;
+  };
+
   bool has_ads_cluster = false;
   // Load all the primary clusters.
   for (const auto& cluster : bootstrap.static_resources().clusters()) {
     if (is_primary_cluster(cluster)) {
       const bool required_for_ads = isBlockingAdsCluster(bootstrap, cluster.name());
       has_ads_cluster |= required_for_ads;
+      if (retain_lazy_cluster(cluster, required_for_ads)) {
+        continue;
+      }
       // TODO(abeyad): Consider passing a lambda for a "post-cluster-init" callback, which would
       // include a conditional ads_mux_->start() call, if other uses cases for "post-cluster-init"
       // functionality pops up.
@@ -517,6 +539,9 @@ ClusterManagerImpl::initialize(const envoy::config::bootstrap::v3::Bootstrap& bo
             cluster.eds_cluster_config().eds_config().config_source_specifier_case())) {
       const bool required_for_ads = isBlockingAdsCluster(bootstrap, cluster.name());
       has_ads_cluster |= required_for_ads;
+      if (retain_lazy_cluster(cluster, required_for_ads)) {
+        continue;
+      }
       auto status_or_cluster =
           loadCluster(cluster, MessageUtil::hash(cluster), "", /*added_via_api=*/false,
                       required_for_ads, active_clusters_);
@@ -526,7 +551,8 @@ ClusterManagerImpl::initialize(const envoy::config::bootstrap::v3::Bootstrap& bo
     }
   }
 
-  cm_stats_.cluster_added_.add(bootstrap.static_resources().clusters().size());
+  cm_stats_.cluster_added_.add(bootstrap.static_resources().clusters().size() -
+                               lazy_static_clusters_.size());
   updateClusterCounts();
 
   absl::optional<ThreadLocalClusterManagerImpl::LocalClusterParams> local_cluster_params;
@@ -580,6 +606,14 @@ ClusterManagerImpl::initialize(const envoy::config::bootstrap::v3::Bootstrap& bo
     // initializing, so we must start ADS here.
     ads_mux_->start();
   }
+
+  // Start the background warmer for lazy clusters so that clusters which are never routed to
+  // still become available eventually. Clusters touched by on-demand discovery in the meantime
+  // are simply removed from the queue.
+  if (!lazy_static_clusters_.empty()) {
+    lazy_cluster_warmer_timer_ = dispatcher_.createTimer([this] { warmNextLazyCluster(); });
+    lazy_cluster_warmer_timer_->enableTimer(LazyClusterWarmingInterval);
+  }
   return absl::OkStatus();
 }
 
@@ -716,7 +750,18 @@ void ClusterManagerImpl::onClusterInit(ClusterManagerCluster& cm_cluster) {
   // This is used by cluster types such as EDS clusters to drain the connection pools of removed
   // hosts.
   cluster_data->second->member_update_cb_ = cluster.prioritySet().addMemberUpdateCb(
-      [&cluster, this](const HostVector&, const HostVector& hosts_removed) -> absl::Status {
+      [&cluster, &cm_cluster, &cluster_entry = *cluster_data->second,
+       this](const HostVector&, const HostVector& hosts_removed) -> absl::Status {
+        // Flush any membership updates buffered by the priority update callback below before
+        // draining connection pools, so that workers apply the new membership first.
+        if (!cluster_entry.pending_update_params_.per_priority_update_params_.empty()) {
+          cm_stats_.cluster_updated_.inc();
+          ThreadLocalClusterUpdateParams params;
+          params.per_priority_update_params_.swap(
+              cluster_entry.pending_update_params_.per_priority_update_params_);
+          postThreadLocalClusterUpdate(cm_cluster, std::move(params));
+        }
+
         if (cluster.info()->lbConfig().close_connections_on_host_set_change()) {
           for (const auto& host_set : cluster.prioritySet().hostSetsPerPriority()) {
             // This will drain all tcp and http connection pools.
@@ -739,8 +784,8 @@ void ClusterManagerImpl::onClusterInit(ClusterManagerCluster& cm_cluster) {
   // This is used by cluster types such as EDS clusters to update the cluster
   // without draining the cluster.
   cluster_data->second->priority_update_cb_ = cluster.prioritySet().addPriorityUpdateCb(
-      [&cm_cluster, this](uint32_t priority, const HostVector& hosts_added,
-                          const HostVector& hosts_removed) {
+      [&cm_cluster, &cluster_entry = *cluster_data->second,
+       this](uint32_t priority, const HostVector& hosts_added, const HostVector& hosts_removed) {
         // This fires when a cluster is about to have an updated member set. We need to send this
         // out to all of the thread local configurations.
 
@@ -768,11 +813,13 @@ void ClusterManagerImpl::onClusterInit(ClusterManagerCluster& cm_cluster) {
           scheduled = scheduleUpdate(cm_cluster, priority, is_mergeable, merge_timeout);
         }
 
-        // If an update was not scheduled for later, deliver it immediately.
+        // If an update was not scheduled for later, buffer it for the member update callback
+        // registered above. That callback runs once per priority set update, even when a
+        // batched update spans several priorities, so a large multi-priority EDS assignment
+        // is published to the workers as one cross-thread post instead of one per priority.
         if (!scheduled) {
-          cm_stats_.cluster_updated_.inc();
-          postThreadLocalClusterUpdate(
-              cm_cluster, ThreadLocalClusterUpdateParams(priority, hosts_added, hosts_removed));
+          cluster_entry.pending_update_params_.per_priority_update_params_.emplace_back(
+              priority, hosts_added, hosts_removed);
         }
         return absl::OkStatus();
       });
@@ -944,6 +991,62 @@ bool ClusterManagerImpl::addOrUpdateCluster(const envoy::config::cluster::v3::Cl
   return true;
 }
 
+bool ClusterManagerImpl::maybeInitializeLazyCluster(const std::string& name) {
+  const auto it = lazy_static_clusters_.find(name);
+  if (it == lazy_static_clusters_.end()) {
+    return false;
+  }
+  const envoy::config::cluster::v3::Cluster config = std::move(it->second);
+  lazy_static_clusters_.erase(it);
+  // `name` may reference the map entry just erased, so use the retained config from here on.
+  const std::string& cluster_name = config.name();
+
+  ENVOY_LOG(info, "cm lazy init: initializing cluster {} on first use", cluster_name);
+  auto status_or_cluster =
+      loadCluster(config, MessageUtil::hash(config), "", /*added_via_api=*/false,
+                  /*required_for_ads=*/false, warming_clusters_);
+  if (!status_or_cluster.status().ok()) {
+    // The config was accepted at startup but creating the cluster failed (e.g. a certificate
+    // could not be loaded). Surface the error and report the cluster as absent so that pending
+    // discoveries time out instead of hanging.
+    ENVOY_LOG(error, "cm lazy init: failed to initialize cluster {}: {}", cluster_name,
+              status_or_cluster.status().message());
+    updateClusterCounts();
+    return false;
+  }
+  cm_stats_.cluster_added_.inc();
+
+  auto& cluster_entry = warming_clusters_.at(cluster_name);
+  cluster_entry->cluster_->info()->configUpdateStats().warming_state_.set(1);
+  if (init_helper_.state() != ClusterManagerInitHelper::State::AllClustersInitialized) {
+    // A discovery request can arrive while the server is still initializing; fold the cluster
+    // into the regular init flow in that case.
+    init_helper_.addCluster(*cluster_entry);
+  } else {
+    cluster_entry->cluster_->initialize([this, cluster_name] {
+      ENVOY_LOG(debug, "cm lazy init: warming cluster {} complete", cluster_name);
+      auto state_changed_cluster_entry = warming_clusters_.find(cluster_name);
+      state_changed_cluster_entry->second->cluster_->info()->configUpdateStats().warming_state_.set(
+          0);
+      onClusterInit(*state_changed_cluster_entry->second);
+    });
+  }
+  updateClusterCounts();
+  return true;
+}
+
+void ClusterManagerImpl::warmNextLazyCluster() {
+  if (!lazy_static_clusters_.empty()) {
+    // Copy the name: maybeInitializeLazyCluster() erases the map entry it refers to.
+    const std::string name = lazy_static_clusters_.begin()->first;
+    ENVOY_LOG(debug, "cm lazy init: background warming cluster {}", name);
+    maybeInitializeLazyCluster(name);
+  }
+  if (!lazy_static_clusters_.empty()) {
+    lazy_cluster_warmer_timer_->enableTimer(LazyClusterWarmingInterval);
+  }
+}
+
 void ClusterManagerImpl::clusterWarmingToActive(const std::string& cluster_name) {
   auto warming_it = warming_clusters_.find(cluster_name);
   ASSERT(warming_it != warming_clusters_.end());
@@ -979,6 +1082,7 @@ bool ClusterManagerImpl::removeCluster(const std::string& cluster_name, const bo
         ++cb_it;
         (*curr_cb_it)->onClusterRemoval(cluster_name);
       }
+      cluster_manager->invalidateClusterLookupMemo();
       cluster_manager->thread_local_clusters_.erase(cluster_name);
       cluster_manager->thread_local_deferred_clusters_.erase(cluster_name);
       cluster_manager->local_stats_.clusters_inflated_.set(
@@ -1123,14 +1227,21 @@ void ClusterManagerImpl::updateClusterCounts() {
     }
   }
   cm_stats_.active_clusters_.set(active_clusters_.size());
+  cm_stats_.lazy_clusters_.set(lazy_static_clusters_.size());
   cm_stats_.warming_clusters_.set(warming_clusters_.size());
 }
 
 ThreadLocalCluster* ClusterManagerImpl::getThreadLocalCluster(absl::string_view cluster) {
   ThreadLocalClusterManagerImpl& cluster_manager = *tls_;
 
+  if (cluster_manager.last_looked_up_cluster_ != nullptr &&
+      cluster_manager.last_looked_up_cluster_name_ == cluster) {
+    return cluster_manager.last_looked_up_cluster_;
+  }
   auto entry = cluster_manager.thread_local_clusters_.find(cluster);
   if (entry != cluster_manager.thread_local_clusters_.end()) {
+    cluster_manager.last_looked_up_cluster_ = entry->second.get();
+    cluster_manager.last_looked_up_cluster_name_.assign(cluster.data(), cluster.size());
     return entry->second.get();
   } else {
     return cluster_manager.initializeClusterInlineIfExists(cluster);
@@ -1380,6 +1491,7 @@ void ClusterManagerImpl::postThreadLocalClusterUpdate(ClusterManagerCluster& cm_
 
         new_cluster = new ThreadLocalClusterManagerImpl::ClusterEntry(*cluster_manager, info,
                                                                       load_balancer_factory);
+        cluster_manager->invalidateClusterLookupMemo();
         cluster_manager->thread_local_clusters_[info->name()].reset(new_cluster);
         cluster_manager->local_stats_.clusters_inflated_.set(
             cluster_manager->thread_local_clusters_.size());
@@ -1741,6 +1853,20 @@ ClusterManagerImpl::requestOnDemandClusterDiscovery(OdCdsApiSharedPtr odcds, std
       // it means that it was other worker thread that requested the discovery.
       return;
     }
+    if (maybeInitializeLazyCluster(name)) {
+      ENVOY_LOG(debug,
+                "cm odcds: cluster {} is a lazy static cluster, warming it locally instead of "
+                "discovering it",
+                name);
+      // Warming has started and the cluster lifecycle callbacks will notify the workers, so no
+      // discovery round trip is needed. The expiration timer still bounds how long the worker
+      // callbacks are retained in case initialization stalls.
+      auto timer = dispatcher_.createTimer([this, name] { notifyExpiredDiscovery(name); });
+      timer->enableTimer(timeout);
+      pending_cluster_creations_.insert(
+          {std::move(name), ClusterCreation{std::move(odcds), std::move(timer)}});
+      return;
+    }
     // Start the discovery. If the cluster gets discovered, cluster manager will warm it up and
     // invoke the cluster lifecycle callbacks, that will in turn invoke our callback.
     odcds->updateOnDemand(name);
@@ -1884,6 +2010,7 @@ ClusterManagerImpl::ThreadLocalClusterManagerImpl::~ThreadLocalClusterManagerImp
   host_http_conn_pool_map_.clear();
   host_tcp_conn_pool_map_.clear();
   ASSERT(host_tcp_conn_map_.empty());
+  invalidateClusterLookupMemo();
   for (auto& cluster : thread_local_clusters_) {
     if (&cluster.second->prioritySet() != local_priority_set_) {
       cluster.second.reset();
@@ -216,6 +216,7 @@ private:
   COUNTER(update_merge_cancelled)                                                                  \
   COUNTER(update_out_of_merge_window)                                                              \
   GAUGE(active_clusters, NeverImport)                                                              \
+  GAUGE(lazy_clusters, NeverImport)                                                                \
   GAUGE(warming_clusters, NeverImport)
 
 /**
@@ -721,11 +722,26 @@ private:
     }
 #endif
 
+    // Forgets the last successful cluster lookup. Must be called whenever an
+    // entry in `thread_local_clusters_` is destroyed or replaced, as the memo
+    // holds a raw pointer into the map's values.
+    void invalidateClusterLookupMemo() {
+      last_looked_up_cluster_ = nullptr;
+      last_looked_up_cluster_name_.clear();
+    }
+
     ClusterManagerImpl& parent_;
     Event::Dispatcher& thread_local_dispatcher_;
     // Known clusters will exclusively exist in either `thread_local_clusters_`
     // or `thread_local_deferred_clusters_`.
     absl::flat_hash_map<std::string, ClusterEntryPtr> thread_local_clusters_;
+    // One-entry memo for getThreadLocalCluster(): worker traffic commonly
+    // touches the same cluster repeatedly, so remembering the last successful
+    // lookup reduces the per-request cost to a string comparison. Entries are
+    // heap allocated so map rehashing does not move them; only destruction or
+    // replacement of an entry invalidates the memo.
+    ClusterEntry* last_looked_up_cluster_{nullptr};
+    std::string last_looked_up_cluster_name_;
     // Maps from a given cluster name to the CIO for that cluster.
     ClusterInitializationMap thread_local_deferred_clusters_;
 
@@ -788,6 +804,11 @@ private:
     // Optional thread aware LB depending on the LB type. Not all clusters have one.
     ThreadAwareLoadBalancerPtr thread_aware_lb_;
     SystemTime last_updated_;
+    // Per-priority membership updates buffered by the priority update callback and flushed by
+    // the member update callback, which runs once per priority set update even when a batched
+    // update (e.g. an EDS assignment) spans several priorities. This lets a multi-priority
+    // update ride a single cross-thread post instead of one per priority.
+    ThreadLocalClusterUpdateParams pending_update_params_;
     Common::CallbackHandlePtr member_update_cb_;
     Common::CallbackHandlePtr priority_update_cb_;
     // Keep smaller fields near the end to reduce padding
@@ -887,6 +908,16 @@ private:
 
   void notifyClusterDiscoveryStatus(absl::string_view name, ClusterDiscoveryStatus status);
 
+  /**
+   * Creates and starts warming a lazy static cluster if one with the given name is awaiting
+   * first use. Once warming completes the regular cluster lifecycle callbacks notify the
+   * worker threads, exactly as for a cluster added via CDS.
+   *
+   * @param name the cluster name to look up among the retained lazy cluster configs.
+   * @return true if a lazy cluster with this name existed and warming was started.
+   */
+  bool maybeInitializeLazyCluster(const std::string& name);
+
 protected:
   ClusterMap active_clusters_;
   ClusterInitializationMap cluster_initialization_map_;
@@ -905,6 +936,11 @@ private:
 
   bool deferralIsSupportedForCluster(const ClusterInfoConstSharedPtr& info) const;
 
+  // Initializes the next retained lazy static cluster and re-arms the warmer timer if any
+  // remain. This trickles background warming so that a large number of lazy clusters does not
+  // resolve DNS and load TLS contexts all at once.
+  void warmNextLazyCluster();
+
   Server::Instance& server_;
   ClusterManagerFactory& factory_;
   Runtime::Loader& runtime_;
@@ -950,6 +986,11 @@ private:
   std::unique_ptr<Config::SubscriptionFactoryImpl> subscription_factory_;
   ClusterSet primary_clusters_;
 
+  // Configs of bootstrap clusters with lazy_init set, keyed by name. Entries are removed as the
+  // clusters are initialized on first use or by the background warmer.
+  absl::flat_hash_map<std::string, envoy::config::cluster::v3::Cluster> lazy_static_clusters_;
+  Event::TimerPtr lazy_cluster_warmer_timer_;
+
   std::unique_ptr<Config::XdsResourcesDelegate> xds_resources_delegate_;
   std::unique_ptr<Config::XdsConfigTracker> xds_config_tracker_;
 
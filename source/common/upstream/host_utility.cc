@@ -226,12 +226,11 @@ void HostUtility::forEachHostMetric(
           auto gauges = host->gauges();
 
           // Add synthetic "healthy" gauge.
-          Stats::PrimitiveGauge healthy_gauge;
-          healthy_gauge.set((host->coarseHealth() == Host::Health::Healthy) ? 1 : 0);
-          gauges.emplace_back(absl::string_view("healthy"), healthy_gauge);
+          gauges.emplace_back(absl::string_view("healthy"),
+                              (host->coarseHealth() == Host::Health::Healthy) ? 1 : 0);
 
-          for (auto& [metric_name, primitive] : gauges) {
-            Stats::PrimitiveGaugeSnapshot metric(primitive.get());
+          for (auto& [metric_name, value] : gauges) {
+            Stats::PrimitiveGaugeSnapshot metric(value);
             set_metric_metadata(metric_name, metric);
             gauge_cb(std::move(metric));
           }
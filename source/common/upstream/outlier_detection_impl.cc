@@ -745,19 +745,60 @@ void DetectorImpl::processSuccessRateEjections(
 }
 
 void DetectorImpl::onIntervalTimer() {
-  MonotonicTime now = time_source_.monotonicTime();
-
-  for (auto host : host_monitors_) {
-    checkHostForUneject(host.first, host.second, now);
+  ASSERT(sweep_hosts_.empty());
+  sweep_time_ = time_source_.monotonicTime();
+  sweep_index_ = 0;
+  sweep_hosts_.reserve(host_monitors_.size());
+  for (const auto& host : host_monitors_) {
+    sweep_hosts_.push_back(host.first);
+  }
+  continueIntervalSweep();
+}
+
+void DetectorImpl::continueIntervalSweep() {
+  // With very large clusters, visiting every monitor in a single dispatcher iteration can stall
+  // the main thread for long enough to delay config updates. A non-zero runtime budget bounds how
+  // many hosts are visited per iteration and the sweep is resumed via post(), letting other main
+  // thread work interleave. The interval timer is only re-armed once the sweep completes, so
+  // sweeps never overlap.
+  const uint64_t sweep_budget = runtime_.snapshot().getInteger(MaxSweepHostsPerIterationRuntime, 0);
+  const size_t end = sweep_budget == 0
+                         ? sweep_hosts_.size()
+                         : std::min(sweep_hosts_.size(), sweep_index_ + sweep_budget);
+  for (; sweep_index_ < end; sweep_index_++) {
+    // Hosts may have been removed from the cluster since the sweep started; skip those.
+    const auto monitor = host_monitors_.find(sweep_hosts_[sweep_index_]);
+    if (monitor == host_monitors_.end()) {
+      continue;
+    }
+    checkHostForUneject(monitor->first, monitor->second, sweep_time_);
 
     // Need to update the writer bucket to keep the data valid.
-    host.second->updateCurrentSuccessRateBucket();
+    monitor->second->updateCurrentSuccessRateBucket();
     // Refresh host success rate stat for the /clusters endpoint. If there is a new valid value, it
     // will get updated in processSuccessRateEjections().
-    host.second->successRate(DetectorHostMonitor::SuccessRateMonitorType::LocalOrigin, -1);
-    host.second->successRate(DetectorHostMonitor::SuccessRateMonitorType::ExternalOrigin, -1);
+    monitor->second->successRate(DetectorHostMonitor::SuccessRateMonitorType::LocalOrigin, -1);
+    monitor->second->successRate(DetectorHostMonitor::SuccessRateMonitorType::ExternalOrigin, -1);
   }
 
+  if (sweep_index_ < sweep_hosts_.size()) {
+    // The cluster owns the only strong reference to the detector, so the resumption must not keep
+    // it alive or touch it after the cluster is destroyed.
+    std::weak_ptr<DetectorImpl> weak_this = shared_from_this();
+    dispatcher_.post([weak_this]() -> void {
+      if (std::shared_ptr<DetectorImpl> shared_this = weak_this.lock()) {
+        shared_this->continueIntervalSweep();
+      }
+    });
+    return;
+  }
+
+  completeIntervalSweep();
+}
+
+void DetectorImpl::completeIntervalSweep() {
+  sweep_hosts_.clear();
+
   processSuccessRateEjections(DetectorHostMonitor::SuccessRateMonitorType::ExternalOrigin);
   processSuccessRateEjections(DetectorHostMonitor::SuccessRateMonitorType::LocalOrigin);
 
@@ -767,7 +808,7 @@ void DetectorImpl::onIntervalTimer() {
       auto& monitor = host.second;
       // Node is healthy and was not ejected since the last check.
       if (monitor->lastUnejectionTime().has_value() &&
-          ((now - monitor->lastUnejectionTime().value()) >=
+          ((sweep_time_ - monitor->lastUnejectionTime().value()) >=
            std::chrono::milliseconds(
                runtime_.snapshot().getInteger(IntervalMsRuntime, config_.intervalMs())))) {
         if (monitor->ejectTimeBackoff() != 0) {
@@ -277,6 +277,8 @@ constexpr absl::string_view FailurePercentageThresholdRuntime =
     "outlier_detection.failure_percentage_threshold";
 constexpr absl::string_view MaxEjectionTimeJitterMsRuntime =
     "outlier_detection.max_ejection_time_jitter_ms";
+constexpr absl::string_view MaxSweepHostsPerIterationRuntime =
+    "outlier_detection.max_hosts_per_sweep_iteration";
 
 /**
  * Configuration for the outlier detection.
@@ -436,6 +438,8 @@ private:
   void notifyMainThreadConsecutiveError(HostSharedPtr host,
                                         envoy::data::cluster::v3::OutlierEjectionType type);
   void onIntervalTimer();
+  void continueIntervalSweep();
+  void completeIntervalSweep();
   void runCallbacks(HostSharedPtr host);
   bool enforceEjection(envoy::data::cluster::v3::OutlierEjectionType type);
   void updateEnforcedEjectionStats(envoy::data::cluster::v3::OutlierEjectionType type);
@@ -468,6 +472,11 @@ private:
   Event::TimerPtr interval_timer_;
   std::list<ChangeStateCb> callbacks_;
   absl::node_hash_map<HostSharedPtr, DetectorHostMonitorImpl*> host_monitors_;
+  // State for an in-progress interval sweep. The host list is snapshotted when the interval timer
+  // fires; a non-empty list means a sweep is being resumed across dispatcher iterations.
+  std::vector<HostSharedPtr> sweep_hosts_;
+  size_t sweep_index_{0};
+  MonotonicTime sweep_time_;
   EventLoggerSharedPtr event_logger_;
   Common::CallbackHandlePtr member_update_cb_;
   Random::RandomGenerator& random_generator_;
@@ -123,52 +123,66 @@ private:
         return max_retry_resource_.canCreate();
       }
       clearRemainingGauge();
-      return count() < max();
+      return count() < budgetMax();
     }
     void inc() override {
-      max_retry_resource_.inc();
-      clearRemainingGauge();
-    }
-    void dec() override {
-      max_retry_resource_.dec();
-      clearRemainingGauge();
+      if (useRetryBudget()) {
+        // Only the count matters while the budget is in use: the nested resource's gauge updates
+        // would write max_retries-based values to shared gauges only for clearRemainingGauge() to
+        // zero them again, keeping those cache lines bouncing between workers. The gauges are
+        // refreshed by the next inc()/dec() if the budget is toggled off.
+        max_retry_resource_.BasicResourceLimitImpl::inc();
+        clearRemainingGauge();
+      } else {
+        max_retry_resource_.inc();
+      }
     }
+    void dec() override { decBy(1); }
     void decBy(uint64_t amount) override {
-      max_retry_resource_.decBy(amount);
-      clearRemainingGauge();
+      if (useRetryBudget()) {
+        max_retry_resource_.BasicResourceLimitImpl::decBy(amount);
+        clearRemainingGauge();
+      } else {
+        max_retry_resource_.decBy(amount);
+      }
     }
     uint64_t max() override {
       if (!useRetryBudget()) {
         return max_retry_resource_.max();
       }
+      clearRemainingGauge();
+      return budgetMax();
+    }
+    uint64_t count() const override { return max_retry_resource_.count(); }
 
+  private:
+    bool useRetryBudget() const {
+      return runtime_.snapshot().get(budget_percent_key_).has_value() ||
+             runtime_.snapshot().get(min_retry_concurrency_key_).has_value() || budget_percent_ ||
+             min_retry_concurrency_;
+    }
+
+    // The effective limit while the retry budget is in use; only called on that path.
+    uint64_t budgetMax() const {
       const uint64_t current_active = requests_.count() + pending_requests_.count();
       const double budget_percent = runtime_.snapshot().getDouble(
           budget_percent_key_, budget_percent_ ? *budget_percent_ : 20.0);
       const uint32_t min_retry_concurrency = runtime_.snapshot().getInteger(
           min_retry_concurrency_key_, min_retry_concurrency_ ? *min_retry_concurrency_ : 3);
 
-      clearRemainingGauge();
-
       // We enforce that the retry concurrency is never allowed to go below the
       // min_retry_concurrency, even if the configured percent of the current active requests
       // yields a value that is smaller.
       return std::max<uint64_t>(budget_percent / 100.0 * current_active, min_retry_concurrency);
     }
-    uint64_t count() const override { return max_retry_resource_.count(); }
-
-  private:
-    bool useRetryBudget() const {
-      return runtime_.snapshot().get(budget_percent_key_).has_value() ||
-             runtime_.snapshot().get(min_retry_concurrency_key_).has_value() || budget_percent_ ||
-             min_retry_concurrency_;
-    }
 
     // If the retry budget is in use, the stats tracking remaining retries do not make sense since
     // they would dependent on other resources that can change without a call to this object.
-    // Therefore, the gauge should just be reset to 0.
+    // Therefore, the gauge should just be reset to 0. Only called on the budget path, and only
+    // written when not already 0: this runs on every retry admission check, and an unconditional
+    // set() would keep the gauge's cache line contended across workers for no value change.
     void clearRemainingGauge() {
-      if (useRetryBudget()) {
+      if (remaining_.value() != 0) {
         remaining_.set(0);
       }
     }
@@ -226,6 +226,15 @@ public:
                                 const envoy::config::core::v3::Metadata* metadata) const override;
   absl::optional<MonotonicTime> lastHcPassTime() const override { return last_hc_pass_time_; }
 
+  Network::Address::InstanceConstSharedPtr lastSuccessfulAddress() const override {
+    absl::MutexLock lock(&last_successful_address_lock_);
+    return last_successful_address_;
+  }
+  void setLastSuccessfulAddress(Network::Address::InstanceConstSharedPtr address) const override {
+    absl::MutexLock lock(&last_successful_address_lock_);
+    last_successful_address_ = std::move(address);
+  }
+
   void setHealthChecker(HealthCheckHostMonitorPtr&& health_checker) override {
     health_checker_ = std::move(health_checker);
   }
@@ -273,6 +282,11 @@ private:
       socket_factory_ ABSL_GUARDED_BY(metadata_mutex_);
   const MonotonicTime creation_time_;
   absl::optional<MonotonicTime> last_hc_pass_time_;
+  mutable absl::Mutex last_successful_address_lock_;
+  // The address of the most recent successful connection attempt, used to order
+  // Happy Eyeballs attempts for hosts with multiple addresses.
+  mutable Network::Address::InstanceConstSharedPtr
+      last_successful_address_ ABSL_GUARDED_BY(last_successful_address_lock_);
 };
 
 /**
@@ -354,8 +368,7 @@ public:
       Network::TransportSocketOptionsConstSharedPtr transport_socket_options,
       const envoy::config::core::v3::Metadata* metadata) const override;
 
-  std::vector<std::pair<absl::string_view, Stats::PrimitiveGaugeReference>>
-  gauges() const override {
+  std::vector<std::pair<absl::string_view, uint64_t>> gauges() const override {
     return stats().gauges();
   }
   void healthFlagClear(HealthFlag flag) override { health_flags_ &= ~enumToInt(flag); }
@@ -56,6 +56,32 @@ public:
    * @param entry supplies the access log to send.
    */
   virtual void log(TcpLogProto&& entry) PURE;
+
+  /**
+   * Start an HTTP log entry in place inside the pending batch message. The returned entry is
+   * owned by the logger and its storage is recycled across flushed batches, so filling it in
+   * place avoids building and moving a temporary proto per log.
+   * @return HttpLogProto* the entry to fill, or nullptr if the logger cannot accept more
+   *         entries. A non-null entry must be committed with finishHttpLogEntry() before the
+   *         next log operation on this logger.
+   */
+  virtual HttpLogProto* startHttpLogEntry() PURE;
+
+  /**
+   * Commit the entry returned by startHttpLogEntry(). May flush the batch.
+   */
+  virtual void finishHttpLogEntry() PURE;
+
+  /**
+   * Start a TCP log entry in place inside the pending batch message. See startHttpLogEntry().
+   * @return TcpLogProto* the entry to fill. Must be committed with finishTcpLogEntry().
+   */
+  virtual TcpLogProto* startTcpLogEntry() PURE;
+
+  /**
+   * Commit the entry returned by startTcpLogEntry(). May flush the batch.
+   */
+  virtual void finishTcpLogEntry() PURE;
 };
 
 /**
@@ -140,6 +166,39 @@ public:
     }
   }
 
+  HttpLogProto* startHttpLogEntry() override {
+    // Checking the buffer limit before the entry is built means a dropped entry is never built
+    // at all; the flush inside canLogMore() only sends previously committed entries.
+    if (!canLogMore()) {
+      return nullptr;
+    }
+    in_progress_http_entry_ = addInPlaceHttpEntry();
+    return in_progress_http_entry_;
+  }
+
+  void finishHttpLogEntry() override {
+    ASSERT(in_progress_http_entry_ != nullptr);
+    approximate_message_size_bytes_ += in_progress_http_entry_->ByteSizeLong();
+    in_progress_http_entry_ = nullptr;
+    if (approximate_message_size_bytes_ >= max_buffer_size_bytes_) {
+      flush();
+    }
+  }
+
+  TcpLogProto* startTcpLogEntry() override {
+    in_progress_tcp_entry_ = addInPlaceTcpEntry();
+    return in_progress_tcp_entry_;
+  }
+
+  void finishTcpLogEntry() override {
+    ASSERT(in_progress_tcp_entry_ != nullptr);
+    approximate_message_size_bytes_ += in_progress_tcp_entry_->ByteSizeLong();
+    in_progress_tcp_entry_ = nullptr;
+    if (approximate_message_size_bytes_ >= max_buffer_size_bytes_) {
+      flush();
+    }
+  }
+
 protected:
   std::unique_ptr<GrpcAccessLogClient<LogRequest, LogResponse>> client_;
   LogRequest message_;
@@ -149,6 +208,11 @@ private:
   virtual void initMessage() PURE;
   virtual void addEntry(HttpLogProto&& entry) PURE;
   virtual void addEntry(TcpLogProto&& entry) PURE;
+  // Add a default-initialized entry in place to the batch message and return it. Cleared entries
+  // are recycled by the underlying repeated field, so steady-state batches reuse the storage of
+  // earlier batches instead of allocating every field again.
+  virtual HttpLogProto* addInPlaceHttpEntry() PURE;
+  virtual TcpLogProto* addInPlaceTcpEntry() PURE;
   virtual void clearMessage() { message_.Clear(); }
 
   void flush() {
@@ -206,6 +270,8 @@ private:
   const Event::TimerPtr flush_timer_;
   const uint64_t max_buffer_size_bytes_;
   uint64_t approximate_message_size_bytes_ = 0;
+  HttpLogProto* in_progress_http_entry_ = nullptr;
+  TcpLogProto* in_progress_tcp_entry_ = nullptr;
   std::unique_ptr<GrpcAccessLoggerStats> stats_ = nullptr;
 };
 
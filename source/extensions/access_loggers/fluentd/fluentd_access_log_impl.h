@@ -29,7 +29,7 @@ class Entry {
 public:
   Entry(const Entry&) = delete;
   Entry& operator=(const Entry&) = delete;
-  Entry(uint64_t time, std::vector<uint8_t>&& record) : time_(time), record_(record) {}
+  Entry(uint64_t time, std::vector<uint8_t>&& record) : time_(time), record_(std::move(record)) {}
 
   const uint64_t time_;
   const std::vector<uint8_t> record_;
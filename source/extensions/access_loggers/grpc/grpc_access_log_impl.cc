@@ -38,6 +38,14 @@ void GrpcAccessLoggerImpl::addEntry(envoy::data::accesslog::v3::TCPAccessLogEntr
   message_.mutable_tcp_logs()->mutable_log_entry()->Add(std::move(entry));
 }
 
+envoy::data::accesslog::v3::HTTPAccessLogEntry* GrpcAccessLoggerImpl::addInPlaceHttpEntry() {
+  return message_.mutable_http_logs()->mutable_log_entry()->Add();
+}
+
+envoy::data::accesslog::v3::TCPAccessLogEntry* GrpcAccessLoggerImpl::addInPlaceTcpEntry() {
+  return message_.mutable_tcp_logs()->mutable_log_entry()->Add();
+}
+
 bool GrpcAccessLoggerImpl::isEmpty() {
   return !message_.has_http_logs() && !message_.has_tcp_logs();
 }
@@ -32,6 +32,8 @@ private:
   // Extensions::AccessLoggers::GrpcCommon::GrpcAccessLogger
   void addEntry(envoy::data::accesslog::v3::HTTPAccessLogEntry&& entry) override;
   void addEntry(envoy::data::accesslog::v3::TCPAccessLogEntry&& entry) override;
+  envoy::data::accesslog::v3::HTTPAccessLogEntry* addInPlaceHttpEntry() override;
+  envoy::data::accesslog::v3::TCPAccessLogEntry* addInPlaceTcpEntry() override;
   bool isEmpty() override;
   void initMessage() override;
 
@@ -54,7 +54,14 @@ void HttpGrpcAccessLog::emitLog(const Formatter::HttpFormatterContext& context,
                                 const StreamInfo::StreamInfo& stream_info) {
   // Common log properties.
   // TODO(mattklein123): Populate sample_rate field.
-  envoy::data::accesslog::v3::HTTPAccessLogEntry log_entry;
+  GrpcCommon::GrpcAccessLogger& logger = *tls_slot_->getTyped<ThreadLocalLogger>().logger_;
+  auto* in_place_entry = logger.startHttpLogEntry();
+  if (in_place_entry == nullptr) {
+    // The logger is over its buffer limit; the entry would have been dropped after being built, so
+    // skip building it entirely.
+    return;
+  }
+  envoy::data::accesslog::v3::HTTPAccessLogEntry& log_entry = *in_place_entry;
 
   const auto& request_headers = context.requestHeaders();
 
@@ -181,7 +188,7 @@ void HttpGrpcAccessLog::emitLog(const Formatter::HttpFormatterContext& context,
     response_properties->set_upstream_header_bytes_received(bytes_meter->headerBytesReceived());
   }
 
-  tls_slot_->getTyped<ThreadLocalLogger>().logger_->log(std::move(log_entry));
+  logger.finishHttpLogEntry();
 }
 
 } // namespace HttpGrpc
@@ -35,7 +35,8 @@ TcpGrpcAccessLog::TcpGrpcAccessLog(AccessLog::FilterPtr&& filter,
 void TcpGrpcAccessLog::emitLog(const Formatter::HttpFormatterContext& context,
                                const StreamInfo::StreamInfo& stream_info) {
   // Common log properties.
-  envoy::data::accesslog::v3::TCPAccessLogEntry log_entry;
+  GrpcCommon::GrpcAccessLogger& logger = *tls_slot_->getTyped<ThreadLocalLogger>().logger_;
+  envoy::data::accesslog::v3::TCPAccessLogEntry& log_entry = *logger.startTcpLogEntry();
   GrpcCommon::Utility::extractCommonAccessLogProperties(
       *log_entry.mutable_common_properties(), context.requestHeaders(), stream_info,
       config_->common_config(), context.accessLogType());
@@ -46,7 +47,7 @@ void TcpGrpcAccessLog::emitLog(const Formatter::HttpFormatterContext& context,
   connection_properties.set_sent_bytes(stream_info.bytesSent());
 
   // request_properties->set_request_body_bytes(stream_info.bytesReceived());
-  tls_slot_->getTyped<ThreadLocalLogger>().logger_->log(std::move(log_entry));
+  logger.finishTcpLogEntry();
 }
 
 } // namespace TcpGrpc
@@ -80,7 +80,13 @@ AccessLog::AccessLog(
 
 void AccessLog::emitLog(const Formatter::HttpFormatterContext& log_context,
                         const StreamInfo::StreamInfo& stream_info) {
-  opentelemetry::proto::logs::v1::LogRecord log_entry;
+  GrpcAccessLogger& logger = *tls_slot_->getTyped<ThreadLocalLogger>().logger_;
+  auto* in_place_entry = logger.startHttpLogEntry();
+  if (in_place_entry == nullptr) {
+    // The logger is over its buffer limit and would drop the entry, so skip building it.
+    return;
+  }
+  opentelemetry::proto::logs::v1::LogRecord& log_entry = *in_place_entry;
   log_entry.set_time_unix_nano(std::chrono::duration_cast<std::chrono::nanoseconds>(
                                    stream_info.startTime().time_since_epoch())
                                    .count());
@@ -109,7 +115,7 @@ void AccessLog::emitLog(const Formatter::HttpFormatterContext& log_context,
     *log_entry.mutable_span_id() = absl::HexStringToBytes(span_id_hex);
   }
 
-  tls_slot_->getTyped<ThreadLocalLogger>().logger_->log(std::move(log_entry));
+  logger.finishHttpLogEntry();
 }
 
 } // namespace OpenTelemetry
@@ -93,6 +93,11 @@ void GrpcAccessLoggerImpl::addEntry(opentelemetry::proto::logs::v1::LogRecord&&
   root_->mutable_log_records()->Add(std::move(entry));
 }
 
+opentelemetry::proto::logs::v1::LogRecord* GrpcAccessLoggerImpl::addInPlaceHttpEntry() {
+  batched_log_entries_++;
+  return root_->mutable_log_records()->Add();
+}
+
 bool GrpcAccessLoggerImpl::isEmpty() { return root_->log_records().empty(); }
 
 // The message is already initialized in the c'tor, and only the logs are cleared.
@@ -89,6 +89,10 @@ private:
   void addEntry(opentelemetry::proto::logs::v1::LogRecord&& entry) override;
   // Non used addEntry method (the above is used for both TCP and HTTP).
   void addEntry(ProtobufWkt::Empty&& entry) override { (void)entry; };
+  opentelemetry::proto::logs::v1::LogRecord* addInPlaceHttpEntry() override;
+  // Non used in-place entry method (the above is used for both TCP and HTTP). Returns a scratch
+  // entry that is never added to the message.
+  ProtobufWkt::Empty* addInPlaceTcpEntry() override { return &unused_tcp_entry_; };
   bool isEmpty() override;
   void initMessage() override;
   void clearMessage() override;
@@ -106,6 +110,7 @@ private:
   absl::flat_hash_map<OTelLogRequestCallbacks*, std::unique_ptr<OTelLogRequestCallbacks>>
       callbacks_;
   uint32_t batched_log_entries_ = 0;
+  ProtobufWkt::Empty unused_tcp_entry_;
 };
 
 class GrpcAccessLoggerCacheImpl
@@ -140,7 +140,7 @@ void AggregateClusterLoadBalancer::onClusterRemoval(const std::string& cluster_n
 absl::optional<uint32_t> AggregateClusterLoadBalancer::LoadBalancerImpl::hostToLinearizedPriority(
     const Upstream::HostDescription& host) const {
   auto it = priority_context_.cluster_and_priority_to_linearized_priority_.find(
-      std::make_pair(host.cluster().name(), host.priority()));
+      ClusterAndPriorityViewKey(host.cluster().name(), host.priority()));
 
   if (it != priority_context_.cluster_and_priority_to_linearized_priority_.end()) {
     return it->second;
@@ -21,8 +21,38 @@ namespace Aggregate {
 using PriorityToClusterVector = std::vector<std::pair<uint32_t, Upstream::ThreadLocalCluster*>>;
 
 // Maps pair(host_cluster_name, host_priority) to the linearized priority of the Aggregate cluster.
+// The hash and equality functors are transparent so that the per-pick lookup can be keyed by a
+// view of the host's cluster name instead of copying it into a temporary std::string key.
+using ClusterAndPriorityOwningKey = std::pair<std::string, uint32_t>;
+using ClusterAndPriorityViewKey = std::pair<absl::string_view, uint32_t>;
+
+struct ClusterAndPriorityHash {
+  using is_transparent = void; // NOLINT(readability-identifier-naming)
+
+  uint64_t operator()(const ClusterAndPriorityOwningKey& key) const {
+    return absl::Hash<ClusterAndPriorityViewKey>()({key.first, key.second});
+  }
+  uint64_t operator()(const ClusterAndPriorityViewKey& key) const {
+    return absl::Hash<ClusterAndPriorityViewKey>()(key);
+  }
+};
+
+struct ClusterAndPriorityEq {
+  using is_transparent = void; // NOLINT(readability-identifier-naming)
+
+  bool operator()(const ClusterAndPriorityOwningKey& left,
+                  const ClusterAndPriorityOwningKey& right) const {
+    return left == right;
+  }
+  bool operator()(const ClusterAndPriorityOwningKey& left,
+                  const ClusterAndPriorityViewKey& right) const {
+    return left.first == right.first && left.second == right.second;
+  }
+};
+
 using ClusterAndPriorityToLinearizedPriorityMap =
-    absl::flat_hash_map<std::pair<std::string, uint32_t>, uint32_t>;
+    absl::flat_hash_map<ClusterAndPriorityOwningKey, uint32_t, ClusterAndPriorityHash,
+                        ClusterAndPriorityEq>;
 
 struct PriorityContext {
   Upstream::PrioritySetImpl priority_set_;
@@ -111,6 +111,12 @@ public:
   SharedConstAddressVector addressListOrNull() const override {
     return logical_host_->addressListOrNull();
   }
+  Network::Address::InstanceConstSharedPtr lastSuccessfulAddress() const override {
+    return logical_host_->lastSuccessfulAddress();
+  }
+  void setLastSuccessfulAddress(Network::Address::InstanceConstSharedPtr address) const override {
+    logical_host_->setLastSuccessfulAddress(std::move(address));
+  }
   const envoy::config::core::v3::Locality& locality() const override {
     return logical_host_->locality();
   }
@@ -1,6 +1,7 @@
 #include "source/extensions/clusters/dynamic_forward_proxy/cluster.h"
 
 #include <algorithm>
+#include <vector>
 
 #include "envoy/config/cluster/v3/cluster.pb.h"
 #include "envoy/extensions/clusters/dynamic_forward_proxy/v3/cluster.pb.h"
@@ -128,20 +129,32 @@ bool Cluster::touch(const std::string& cluster_name) {
 
 void Cluster::checkIdleSubCluster() {
   ASSERT(main_thread_dispatcher_.isThreadSafe());
+  std::vector<std::string> idle_clusters;
   {
-    // TODO: try read lock first.
+    // Scan under the reader lock so that workers creating or touching sub clusters are not
+    // blocked by a sweep that, in the common case, removes nothing. checkIdle() only loads the
+    // atomic last used time.
+    absl::ReaderMutexLock lock{&cluster_map_lock_};
+    for (const auto& [cluster_name, cluster_info] : cluster_map_) {
+      if (cluster_info->checkIdle()) {
+        idle_clusters.push_back(cluster_name);
+      }
+    }
+  }
+  if (!idle_clusters.empty()) {
     absl::WriterMutexLock lock{&cluster_map_lock_};
-    for (auto it = cluster_map_.cbegin(); it != cluster_map_.cend();) {
-      if (it->second->checkIdle()) {
-        auto cluster_name = it->first;
-        ENVOY_LOG(debug, "cluster='{}' removing from cluster_map & cluster manager", cluster_name);
-        cluster_map_.erase(it++);
-        cm_.removeCluster(cluster_name,
-                          Runtime::runtimeFeatureEnabled(
-                              "envoy.reloadable_features.avoid_dfp_cluster_removal_on_cds_update"));
-      } else {
-        ++it;
+    for (const std::string& cluster_name : idle_clusters) {
+      // A sub cluster may have been touched or replaced between the scan and acquiring the
+      // writer lock, so recheck before removing it.
+      const auto it = cluster_map_.find(cluster_name);
+      if (it == cluster_map_.end() || !it->second->checkIdle()) {
+        continue;
       }
+      ENVOY_LOG(debug, "cluster='{}' removing from cluster_map & cluster manager", cluster_name);
+      cluster_map_.erase(it);
+      cm_.removeCluster(cluster_name,
+                        Runtime::runtimeFeatureEnabled(
+                            "envoy.reloadable_features.avoid_dfp_cluster_removal_on_cds_update"));
     }
   }
   idle_timer_->enableTimer(sub_cluster_ttl_);
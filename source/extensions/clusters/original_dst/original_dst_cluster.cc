@@ -82,15 +82,9 @@ HostConstSharedPtr OriginalDstCluster::LoadBalancer::chooseHost(LoadBalancerCont
             std::unique_ptr<HostImpl>)));
         ENVOY_LOG(debug, "Created host {} {}.", *host, host->address()->asString());
 
-        // Tell the cluster about the new host
-        // lambda cannot capture a member by value.
-        std::weak_ptr<OriginalDstClusterHandle> post_parent = parent_;
-        parent_->cluster_->dispatcher_.post([post_parent, host]() mutable {
-          // The main cluster may have disappeared while this post was queued.
-          if (std::shared_ptr<OriginalDstClusterHandle> parent = post_parent.lock()) {
-            parent->cluster_->addHost(host);
-          }
-        });
+        // Tell the cluster about the new host. Hosts created in the same dispatch interval on
+        // any worker are drained with a single main thread post.
+        parent_->cluster_->queueNewHost(host, parent_);
         return host;
       } else {
         ENVOY_LOG(debug, "Failed to create host for {}.", dst_addr.asString());
@@ -216,33 +210,67 @@ OriginalDstCluster::OriginalDstCluster(const envoy::config::cluster::v3::Cluster
   cleanup_timer_->enableTimer(cleanup_interval_ms_);
 }
 
-void OriginalDstCluster::addHost(HostSharedPtr& host) {
-  std::string address = host->address()->asString();
+void OriginalDstCluster::queueNewHost(HostSharedPtr host,
+                                      const OriginalDstClusterHandleSharedPtr& handle) {
+  bool post_drain = false;
+  {
+    absl::MutexLock lock(&pending_hosts_lock_);
+    post_drain = pending_hosts_.empty();
+    pending_hosts_.push_back(std::move(host));
+  }
+  if (post_drain) {
+    // lambda cannot capture a member by value.
+    std::weak_ptr<OriginalDstClusterHandle> post_parent = handle;
+    dispatcher_.post([post_parent]() {
+      // The main cluster may have disappeared while this post was queued.
+      if (std::shared_ptr<OriginalDstClusterHandle> parent = post_parent.lock()) {
+        parent->cluster_->addPendingHosts();
+      }
+    });
+  }
+}
+
+void OriginalDstCluster::addPendingHosts() {
+  HostVector hosts_to_add;
+  {
+    absl::MutexLock lock(&pending_hosts_lock_);
+    // `pending_hosts_` may have grown since the post that scheduled this drain, and hosts queued
+    // after the swap below will schedule a new post: the transition from empty to non-empty is
+    // what triggers a post.
+    hosts_to_add.swap(pending_hosts_);
+  }
+  if (hosts_to_add.empty()) {
+    return;
+  }
+
   HostMultiMapSharedPtr new_host_map = std::make_shared<HostMultiMap>(*getCurrentHostMap());
-  auto it = new_host_map->find(address);
-  if (it != new_host_map->end()) {
-    // If the entry already exists, that means the worker that posted this host
-    // had a stale host map. Because the host is potentially in that worker's
-    // connection pools, we save the host in the host map hosts_ list and the
-    // cluster priority set. Subsequently, the entire hosts_ list and the
-    // primary host are removed collectively, once no longer in use.
-    it->second->hosts_.push_back(host);
-  } else {
-    // The first worker that creates a host for the address defines the primary
-    // host structure.
-    new_host_map->emplace(address, std::make_shared<HostsForAddress>(host));
+  for (const HostSharedPtr& host : hosts_to_add) {
+    std::string address = host->address()->asString();
+    auto it = new_host_map->find(address);
+    if (it != new_host_map->end()) {
+      // If the entry already exists, that means the worker that posted this host
+      // had a stale host map. Because the host is potentially in that worker's
+      // connection pools, we save the host in the host map hosts_ list and the
+      // cluster priority set. Subsequently, the entire hosts_ list and the
+      // primary host are removed collectively, once no longer in use.
+      it->second->hosts_.push_back(host);
+    } else {
+      // The first worker that creates a host for the address defines the primary
+      // host structure.
+      new_host_map->emplace(address, std::make_shared<HostsForAddress>(host));
+    }
+    ENVOY_LOG(debug, "addPendingHosts() adding {} {}.", *host, address);
   }
-  ENVOY_LOG(debug, "addHost() adding {} {}.", *host, address);
   setHostMap(new_host_map);
 
   // Given the current config, only EDS clusters support multiple priorities.
   ASSERT(priority_set_.hostSetsPerPriority().size() == 1);
   const auto& first_host_set = priority_set_.getOrCreateHostSet(0);
   HostVectorSharedPtr all_hosts(new HostVector(first_host_set.hosts()));
-  all_hosts->emplace_back(host);
+  all_hosts->insert(all_hosts->end(), hosts_to_add.begin(), hosts_to_add.end());
   priority_set_.updateHosts(
       0, HostSetImpl::partitionHosts(all_hosts, HostsPerLocalityImpl::empty()), {},
-      {std::move(host)}, {}, random_.random(), absl::nullopt, absl::nullopt);
+      std::move(hosts_to_add), {}, random_.random(), absl::nullopt, absl::nullopt);
 }
 
 void OriginalDstCluster::cleanup() {
@@ -168,7 +168,12 @@ private:
     host_map_ = new_host_map;
   }
 
-  void addHost(HostSharedPtr&);
+  // Called from workers to hand a newly created host to the main thread. Posts a drain callback
+  // only when the pending list was empty, so a burst of new downstream addresses results in a
+  // single post and a single host map rebuild instead of one per host.
+  void queueNewHost(HostSharedPtr host, const OriginalDstClusterHandleSharedPtr& handle);
+  // Main thread only: drains the pending host list and publishes an updated host map.
+  void addPendingHosts();
   void cleanup();
 
   // ClusterImplBase
@@ -180,6 +185,8 @@ private:
 
   absl::Mutex host_map_lock_;
   HostMultiMapConstSharedPtr host_map_ ABSL_GUARDED_BY(host_map_lock_);
+  absl::Mutex pending_hosts_lock_;
+  std::vector<HostSharedPtr> pending_hosts_ ABSL_GUARDED_BY(pending_hosts_lock_);
   absl::optional<Http::LowerCaseString> http_header_name_;
   absl::optional<Config::MetadataKey> metadata_key_;
   absl::optional<uint32_t> port_override_;
@@ -237,6 +237,9 @@ private:
     bool enableRedirection() const override { return false; }
     uint32_t maxBufferSizeBeforeFlush() const override { return 0; }
     std::chrono::milliseconds bufferFlushTimeoutInMs() const override { return buffer_timeout_; }
+    absl::optional<std::chrono::milliseconds> bufferFlushLatencyBudget() const override {
+      return absl::nullopt;
+    }
     uint32_t maxUpstreamUnknownConnections() const override { return 0; }
     bool enableCommandStats() const override { return true; }
     bool connectionRateLimitEnabled() const override { return false; }
@@ -1,10 +1,13 @@
 #include "source/extensions/common/async_files/async_file_context_thread_pool.h"
 
 #include <fcntl.h>
+#include <limits.h>
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "source/common/buffer/buffer_impl.h"
 #include "source/extensions/common/async_files/async_file_action.h"
@@ -124,12 +127,9 @@ public:
     if (bytes_read.return_value_ == -1) {
       return statusAfterFileError(bytes_read);
     }
-    if (static_cast<size_t>(bytes_read.return_value_) != length_) {
-      result =
-          std::make_unique<Buffer::OwnedImpl>(reservation.slice().mem_, bytes_read.return_value_);
-    } else {
-      reservation.commit(bytes_read.return_value_);
-    }
+    // A short read just commits fewer bytes than were reserved; copying the data into a
+    // right-sized buffer would double the memory traffic for a transient over-allocation.
+    reservation.commit(bytes_read.return_value_);
     return result;
   }
 
@@ -150,18 +150,32 @@ public:
   absl::StatusOr<size_t> executeImpl() override {
     ASSERT(fileDescriptor() != -1);
     auto slices = contents_.getRawSlices();
+    std::vector<iovec> iov(slices.size());
+    for (size_t i = 0; i < slices.size(); i++) {
+      iov[i].iov_base = slices[i].mem_;
+      iov[i].iov_len = slices[i].len_;
+    }
+    const size_t total_bytes = contents_.length();
     size_t total_bytes_written = 0;
-    for (const auto& slice : slices) {
-      size_t slice_bytes_written = 0;
-      while (slice_bytes_written < slice.len_) {
-        auto bytes_just_written =
-            posix().pwrite(fileDescriptor(), static_cast<char*>(slice.mem_) + slice_bytes_written,
-                           slice.len_ - slice_bytes_written, offset_ + total_bytes_written);
-        if (bytes_just_written.return_value_ == -1) {
-          return statusAfterFileError(bytes_just_written);
-        }
-        slice_bytes_written += bytes_just_written.return_value_;
-        total_bytes_written += bytes_just_written.return_value_;
+    size_t first_iov = 0;
+    // Write all slices with one syscall per pwritev, retrying only on partial writes.
+    while (total_bytes_written < total_bytes) {
+      const int num_iov = static_cast<int>(std::min<size_t>(iov.size() - first_iov, IOV_MAX));
+      auto bytes_just_written = posix().pwritev(fileDescriptor(), iov.data() + first_iov, num_iov,
+                                                offset_ + total_bytes_written);
+      if (bytes_just_written.return_value_ == -1) {
+        return statusAfterFileError(bytes_just_written);
+      }
+      total_bytes_written += bytes_just_written.return_value_;
+      // Skip past the fully written iovecs and trim the leading partially written one, if any.
+      size_t remaining = bytes_just_written.return_value_;
+      while (first_iov < iov.size() && remaining >= iov[first_iov].iov_len) {
+        remaining -= iov[first_iov].iov_len;
+        first_iov++;
+      }
+      if (remaining > 0) {
+        iov[first_iov].iov_base = static_cast<char*>(iov[first_iov].iov_base) + remaining;
+        iov[first_iov].iov_len -= remaining;
       }
     }
     return total_bytes_written;
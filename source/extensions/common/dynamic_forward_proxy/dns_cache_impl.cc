@@ -519,9 +519,22 @@ void DnsCacheImpl::finishResolve(const std::string& host,
   if (status == Network::DnsResolver::ResolutionStatus::Completed) {
     primary_host_info->failure_backoff_strategy_->reset(
         std::chrono::duration_cast<std::chrono::milliseconds>(dns_ttl).count());
-    primary_host_info->refresh_timer_->enableTimer(dns_ttl);
-    ENVOY_LOG(debug, "DNS refresh rate reset for host '{}', refresh rate {} ms", host,
-              dns_ttl.count() * 1000);
+    if (from_cache && primary_host_info->host_info_->isStale()) {
+      // An entry loaded from the persistent cache may already be past its TTL. Serve it while
+      // revalidating in the background: schedule the refresh at a random point within the
+      // minimum refresh interval instead of waiting out another full TTL, with the splay
+      // spreading the queries so a large warm cache does not hammer the resolver on startup.
+      const std::chrono::milliseconds splay(random_generator_.random() %
+                                            min_refresh_interval_.count());
+      primary_host_info->refresh_timer_->enableTimer(splay);
+      stats_.cache_load_stale_.inc();
+      ENVOY_LOG(debug, "loaded stale DNS entry for host '{}', refreshing in {} ms", host,
+                splay.count());
+    } else {
+      primary_host_info->refresh_timer_->enableTimer(dns_ttl);
+      ENVOY_LOG(debug, "DNS refresh rate reset for host '{}', refresh rate {} ms", host,
+                dns_ttl.count() * 1000);
+    }
   } else {
     const uint64_t refresh_interval = primary_host_info->failure_backoff_strategy_->nextBackOffMs();
     primary_host_info->refresh_timer_->enableTimer(std::chrono::milliseconds(refresh_interval));
@@ -87,11 +87,11 @@ TapConfigBaseImpl::TapConfigBaseImpl(const envoy::config::tap::v3::TapConfig& pr
     }
     // TODO(mattklein123): Graceful failure, error message, and test if someone specifies an
     // admin stream output with the wrong format.
-    // TODO(davidpeet8): Simple change to enable PROTO_BINARY_LENGTH_DELIMITED format -
-    // functionality already implemented for kBufferedAdmin
-    RELEASE_ASSERT(sink_format_ == ProtoOutputSink::JSON_BODY_AS_BYTES ||
-                       sink_format_ == ProtoOutputSink::JSON_BODY_AS_STRING,
-                   "streaming admin output only supports JSON formats");
+    RELEASE_ASSERT(
+        sink_format_ == ProtoOutputSink::JSON_BODY_AS_BYTES ||
+            sink_format_ == ProtoOutputSink::JSON_BODY_AS_STRING ||
+            sink_format_ == ProtoOutputSink::PROTO_BINARY_LENGTH_DELIMITED,
+        "streaming admin output only supports JSON or length delimited proto binary formats");
     sink_to_use_ = admin_streamer;
     break;
   case ProtoOutputSink::OutputSinkTypeCase::kFilePerTap:
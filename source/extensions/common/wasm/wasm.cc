@@ -51,14 +51,27 @@ private:
   std::unique_ptr<Config::DataFetcher::RemoteDataFetcher> fetcher_;
 };
 
+// Retains a strong reference to a base VM after the configuration that created it drains.
+// proxy_wasm::createWasm() de-duplicates live base VMs by vm_key but only holds weak
+// references, so without retention a config reload that briefly drops the last strong
+// reference recompiles the module from scratch.
+struct BaseVmCacheEntry {
+  WasmHandleSharedPtr handle;
+  MonotonicTime use_time;
+};
+
 const std::string INLINE_STRING = "<inline>";
 const int CODE_CACHE_SECONDS_NEGATIVE_CACHING = 10;
 const int CODE_CACHE_SECONDS_CACHING_TTL = 24 * 3600; // 24 hours.
+const int VM_CACHE_SECONDS_CACHING_TTL = 10 * 60;     // 10 minutes.
 MonotonicTime::duration cache_time_offset_for_testing{};
 
 std::mutex code_cache_mutex;
 absl::flat_hash_map<std::string, CodeCacheEntry>* code_cache = nullptr;
 
+std::mutex vm_cache_mutex;
+absl::flat_hash_map<std::string, BaseVmCacheEntry>* vm_cache = nullptr;
+
 // Downcast WasmBase to the actual Wasm.
 inline Wasm* getWasm(WasmHandleSharedPtr& base_wasm_handle) {
   return static_cast<Wasm*>(base_wasm_handle->wasm().get());
@@ -231,10 +244,19 @@ void Wasm::onStatsUpdate(const PluginSharedPtr& plugin, Envoy::Stats::MetricSnap
 }
 
 void clearCodeCacheForTesting() {
-  std::lock_guard<std::mutex> guard(code_cache_mutex);
-  if (code_cache) {
-    delete code_cache;
-    code_cache = nullptr;
+  {
+    std::lock_guard<std::mutex> guard(code_cache_mutex);
+    if (code_cache) {
+      delete code_cache;
+      code_cache = nullptr;
+    }
+  }
+  {
+    std::lock_guard<std::mutex> guard(vm_cache_mutex);
+    if (vm_cache) {
+      delete vm_cache;
+      vm_cache = nullptr;
+    }
   }
   getCreateStatsHandler().resetStatsForTesting();
 }
@@ -397,6 +419,25 @@ bool createWasm(const PluginSharedPtr& plugin, const Stats::ScopeSharedPtr& scop
       cb(nullptr);
       return false;
     }
+    if (Runtime::runtimeFeatureEnabled("envoy.reloadable_features.wasm_retain_base_vms")) {
+      auto now = dispatcher.timeSource().monotonicTime() + cache_time_offset_for_testing;
+      std::lock_guard<std::mutex> guard(vm_cache_mutex);
+      if (!vm_cache) {
+        vm_cache = new std::remove_reference<decltype(*vm_cache)>::type;
+      }
+      // Remove entries older than VM_CACHE_SECONDS_CACHING_TTL except for our target.
+      for (auto it = vm_cache->begin(); it != vm_cache->end();) {
+        if (now - it->second.use_time > std::chrono::seconds(VM_CACHE_SECONDS_CACHING_TTL) &&
+            it->first != vm_key) {
+          vm_cache->erase(it++);
+        } else {
+          ++it;
+        }
+      }
+      auto& e = (*vm_cache)[vm_key];
+      e.handle = std::static_pointer_cast<WasmHandle>(wasm);
+      e.use_time = now;
+    }
     cb(std::static_pointer_cast<WasmHandle>(wasm));
     return true;
   };
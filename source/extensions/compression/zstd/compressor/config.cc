@@ -12,7 +12,9 @@ ZstdCompressorFactory::ZstdCompressorFactory(
     : compression_level_(
           PROTOBUF_GET_WRAPPED_OR_DEFAULT(zstd, compression_level, ZSTD_CLEVEL_DEFAULT)),
       enable_checksum_(zstd.enable_checksum()), strategy_(zstd.strategy()),
-      chunk_size_(PROTOBUF_GET_WRAPPED_OR_DEFAULT(zstd, chunk_size, ZSTD_CStreamOutSize())) {
+      chunk_size_(PROTOBUF_GET_WRAPPED_OR_DEFAULT(zstd, chunk_size, ZSTD_CStreamOutSize())),
+      cctx_pool_slot_(ThreadLocal::TypedSlot<ZstdCCtxPool>::makeUnique(tls)) {
+  cctx_pool_slot_->set([](Event::Dispatcher&) { return std::make_shared<ZstdCCtxPool>(); });
   if (zstd.has_dictionary()) {
     Protobuf::RepeatedPtrField<envoy::config::core::v3::DataSource> dictionaries;
     dictionaries.Add()->CopyFrom(zstd.dictionary());
@@ -26,7 +28,15 @@ ZstdCompressorFactory::ZstdCompressorFactory(
 
 Envoy::Compression::Compressor::CompressorPtr ZstdCompressorFactory::createCompressor() {
   return std::make_unique<ZstdCompressorImpl>(compression_level_, enable_checksum_, strategy_,
-                                              cdict_manager_, chunk_size_);
+                                              cdict_manager_, chunk_size_,
+                                              cctx_pool_slot_->get().ptr());
+}
+
+Envoy::Compression::Compressor::CompressorPtr
+ZstdCompressorFactory::createCompressorWithDictionary(absl::string_view dictionary) {
+  return std::make_unique<ZstdCompressorImpl>(compression_level_, enable_checksum_, strategy_,
+                                              cdict_manager_, chunk_size_,
+                                              cctx_pool_slot_->get().ptr(), dictionary);
 }
 
 Envoy::Compression::Compressor::CompressorFactoryPtr
@@ -31,6 +31,8 @@ public:
 
   // Envoy::Compression::Compressor::CompressorFactory
   Envoy::Compression::Compressor::CompressorPtr createCompressor() override;
+  Envoy::Compression::Compressor::CompressorPtr
+  createCompressorWithDictionary(absl::string_view dictionary) override;
   const std::string& statsPrefix() const override { return zstdStatsPrefix(); }
   const std::string& contentEncoding() const override {
     return Http::CustomHeaders::get().ContentEncodingValues.Zstd;
@@ -42,6 +44,7 @@ private:
   const uint32_t strategy_;
   const uint32_t chunk_size_;
   ZstdCDictManagerPtr cdict_manager_{nullptr};
+  ThreadLocal::TypedSlotPtr<ZstdCCtxPool> cctx_pool_slot_;
 };
 
 class ZstdCompressorLibraryFactory
@@ -6,21 +6,54 @@ namespace Compression {
 namespace Zstd {
 namespace Compressor {
 
+CCtxPtr ZstdCCtxPool::take() {
+  if (parked_.empty()) {
+    return {ZSTD_createCCtx(), &ZSTD_freeCCtx};
+  }
+  CCtxPtr cctx = std::move(parked_.back());
+  parked_.pop_back();
+  return cctx;
+}
+
+void ZstdCCtxPool::park(CCtxPtr cctx) {
+  if (parked_.size() >= MaxParkedContexts) {
+    return;
+  }
+  parked_.push_back(std::move(cctx));
+}
+
 ZstdCompressorImpl::ZstdCompressorImpl(uint32_t compression_level, bool enable_checksum,
                                        uint32_t strategy, const ZstdCDictManagerPtr& cdict_manager,
-                                       uint32_t chunk_size)
-    : ZstdCompressorImplBase(compression_level, enable_checksum, strategy, chunk_size),
-      cdict_manager_(cdict_manager) {
+                                       uint32_t chunk_size, ZstdCCtxPool* cctx_pool,
+                                       absl::string_view dictionary)
+    : ZstdCompressorImplBase(cctx_pool != nullptr
+                                 ? cctx_pool->take()
+                                 : CCtxPtr{ZSTD_createCCtx(), &ZSTD_freeCCtx},
+                             compression_level, enable_checksum, strategy, chunk_size),
+      cdict_manager_(cdict_manager), cctx_pool_(cctx_pool) {
   size_t result;
   if (cdict_manager_) {
     ZSTD_CDict* cdict = cdict_manager_->getFirstDictionary();
     result = ZSTD_CCtx_refCDict(cctx_.get(), cdict);
   } else {
     result = ZSTD_CCtx_setParameter(cctx_.get(), ZSTD_c_compressionLevel, compression_level_);
+    if (!dictionary.empty()) {
+      RELEASE_ASSERT(!ZSTD_isError(result), "");
+      // Loaded by copy (the default), so the caller does not need to keep the payload alive.
+      result = ZSTD_CCtx_loadDictionary(cctx_.get(), dictionary.data(), dictionary.size());
+    }
   }
   RELEASE_ASSERT(!ZSTD_isError(result), "");
 }
 
+ZstdCompressorImpl::~ZstdCompressorImpl() {
+  // The base class ctor resets a recycled context before use, so it is safe to park one that
+  // was destroyed mid-frame.
+  if (cctx_pool_ != nullptr && cctx_ != nullptr) {
+    cctx_pool_->park(std::move(cctx_));
+  }
+}
+
 void ZstdCompressorImpl::compressPreprocess(Buffer::Instance&,
                                             Envoy::Compression::Compressor::State) {}
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "envoy/compression/compressor/compressor.h"
+#include "envoy/thread_local/thread_local_object.h"
 
 #include "source/common/compression/zstd/common/base.h"
 #include "source/common/compression/zstd/compressor/zstd_compressor_impl_base.h"
@@ -15,14 +16,38 @@ namespace Compressor {
 using ZstdCDictManager =
     Common::DictionaryManager<ZSTD_CDict, ZSTD_freeCDict, ZSTD_getDictID_fromCDict>;
 using ZstdCDictManagerPtr = std::unique_ptr<ZstdCDictManager>;
+using Envoy::Compression::Zstd::Compressor::CCtxPtr;
+
+/**
+ * Per-worker pool of compression contexts. Reusing a context across streams keeps its internal
+ * workspace and window allocations warm instead of re-growing them on every response, which
+ * dominates the compression cost for small bodies.
+ */
+class ZstdCCtxPool : public ThreadLocal::ThreadLocalObject {
+public:
+  // Returns a parked context, or a freshly allocated one when the pool is empty.
+  CCtxPtr take();
+  // Parks a context for reuse unless the pool is already full.
+  void park(CCtxPtr cctx);
+
+  static constexpr size_t MaxParkedContexts = 16;
+
+private:
+  std::vector<CCtxPtr> parked_;
+};
 
 /**
  * Implementation of compressor's interface.
  */
 class ZstdCompressorImpl : public Envoy::Compression::Zstd::Compressor::ZstdCompressorImplBase {
 public:
+  // When `dictionary` is non-empty it is loaded into the compression context by copy and used
+  // for all frames produced by this compressor. It takes effect only if no dictionaries are
+  // configured through `cdict_manager`.
   ZstdCompressorImpl(uint32_t compression_level, bool enable_checksum, uint32_t strategy,
-                     const ZstdCDictManagerPtr& cdict_manager, uint32_t chunk_size);
+                     const ZstdCDictManagerPtr& cdict_manager, uint32_t chunk_size,
+                     ZstdCCtxPool* cctx_pool = nullptr, absl::string_view dictionary = {});
+  ~ZstdCompressorImpl() override;
 
 private:
   void compressPreprocess(Buffer::Instance& buffer,
@@ -34,6 +59,7 @@ private:
   void compressPostprocess(Buffer::Instance& accumulation_buffer) override;
 
   const ZstdCDictManagerPtr& cdict_manager_;
+  ZstdCCtxPool* const cctx_pool_;
 };
 
 } // namespace Compressor
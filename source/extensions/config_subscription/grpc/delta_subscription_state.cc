@@ -190,6 +190,9 @@ bool DeltaSubscriptionState::isHeartbeatResponse(
 void DeltaSubscriptionState::handleGoodResponse(
     envoy::service::discovery::v3::DeltaDiscoveryResponse& message) {
   absl::flat_hash_set<std::string> names_added_removed;
+  // Names of the heartbeat resources in this response, so the partition below doesn't repeat the
+  // per-resource state lookups done here. Names are unique within a response (enforced below).
+  absl::flat_hash_set<std::string> heartbeat_resources;
   // TODO(adisuissa): remove the non_heartbeat_resources structure once
   // "envoy.reloadable_features.xds_prevent_resource_copy" is deprecated.
   Protobuf::RepeatedPtrField<envoy::service::discovery::v3::Resource> non_heartbeat_resources;
@@ -199,6 +202,7 @@ void DeltaSubscriptionState::handleGoodResponse(
           fmt::format("duplicate name {} found among added/updated resources", resource.name()));
     }
     if (isHeartbeatResponse(resource)) {
+      heartbeat_resources.insert(resource.name());
       continue;
     }
     if (!Runtime::runtimeFeatureEnabled("envoy.reloadable_features.xds_prevent_resource_copy")) {
@@ -231,7 +235,7 @@ void DeltaSubscriptionState::handleGoodResponse(
     auto last_non_heartbeat = std::stable_partition(
         message.mutable_resources()->begin(), message.mutable_resources()->end(),
         [&](const envoy::service::discovery::v3::Resource& resource) {
-          return !isHeartbeatResponse(resource);
+          return !heartbeat_resources.contains(resource.name());
         });
 
     non_heartbeat_resources_span = absl::MakeConstSpan(
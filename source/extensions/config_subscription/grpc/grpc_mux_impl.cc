@@ -10,7 +10,7 @@
 #include "source/extensions/config_subscription/grpc/xds_source_id.h"
 
 #include "absl/container/btree_map.h"
-#include "absl/container/node_hash_set.h"
+#include "absl/container/flat_hash_set.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 
@@ -175,12 +175,13 @@ void GrpcMuxImpl::sendDiscoveryRequest(absl::string_view type_url) {
   auto& request = api_state.request_;
   request.mutable_resource_names()->Clear();
 
-  // Maintain a set to avoid dupes.
-  absl::node_hash_set<std::string> resources;
+  // Maintain a set to avoid dupes. Views into the watched names are sufficient here since the
+  // watches outlive request construction, and they avoid copying every resource name (there can
+  // be thousands for EDS) on each request.
+  absl::flat_hash_set<absl::string_view> resources;
   for (const auto* watch : api_state.watches_) {
     for (const std::string& resource : watch->resources_) {
-      if (!resources.contains(resource)) {
-        resources.emplace(resource);
+      if (resources.insert(resource).second) {
         request.add_resource_names(resource);
       }
     }
@@ -198,8 +199,8 @@ void GrpcMuxImpl::sendDiscoveryRequest(absl::string_view type_url) {
   first_stream_request_ = false;
 
   // clear error_detail after the request is sent if it exists.
-  if (apiStateFor(type_url).request_.has_error_detail()) {
-    apiStateFor(type_url).request_.clear_error_detail();
+  if (request.has_error_detail()) {
+    request.clear_error_detail();
   }
 }
 
@@ -233,6 +234,7 @@ void GrpcMuxImpl::loadConfigFromDelegate(const std::string& type_url,
     }
 
     std::vector<DecodedResourcePtr> decoded_resources;
+    decoded_resources.reserve(resources.size());
     OpaqueResourceDecoder& resource_decoder = *api_state.watches_.front()->resource_decoder_;
     std::string version_info;
     for (const auto& resource : resources) {
@@ -407,6 +409,7 @@ void GrpcMuxImpl::onDiscoveryResponse(
   TRY_ASSERT_MAIN_THREAD {
     std::vector<DecodedResourcePtr> resources;
     OpaqueResourceDecoder& resource_decoder = *api_state.watches_.front()->resource_decoder_;
+    const std::shared_ptr<Protobuf::Arena> decode_arena = maybeCreateResourceDecodingArena();
 
     for (const auto& resource : message->resources()) {
       // TODO(snowp): Check the underlying type when the resource is a Resource.
@@ -417,9 +420,11 @@ void GrpcMuxImpl::onDiscoveryResponse(
                         resource.type_url(), type_url, message->DebugString()));
       }
 
-      auto decoded_resource = THROW_OR_RETURN_VALUE(
-          DecodedResourceImpl::fromResource(resource_decoder, resource, message->version_info()),
-          DecodedResourceImplPtr);
+      auto decoded_resource =
+          THROW_OR_RETURN_VALUE(DecodedResourceImpl::fromResource(resource_decoder, resource,
+                                                                  message->version_info(),
+                                                                  decode_arena),
+                                DecodedResourceImplPtr);
 
       if (!isHeartbeatResource(type_url, *decoded_resource)) {
         resources.emplace_back(std::move(decoded_resource));
@@ -467,6 +472,7 @@ void GrpcMuxImpl::processDiscoveryResources(const std::vector<DecodedResourcePtr
   // for test determinism.
   absl::btree_map<std::string, DecodedResourceRef> resource_ref_map;
   std::vector<DecodedResourceRef> all_resource_refs;
+  all_resource_refs.reserve(resources.size());
 
   const auto scoped_ttl_update = api_state.ttl_.scopedTtlUpdate();
 
@@ -506,6 +512,7 @@ void GrpcMuxImpl::processDiscoveryResources(const std::vector<DecodedResourcePtr
       continue;
     }
     std::vector<DecodedResourceRef> found_resources;
+    found_resources.reserve(watch->resources_.size());
     for (const auto& watched_resource_name : watch->resources_) {
       // Look for a singleton subscription.
       auto it = resource_ref_map.find(watched_resource_name);
@@ -634,13 +641,16 @@ void GrpcMuxImpl::expiryCallback(absl::string_view type_url,
 GrpcMuxImpl::ApiState& GrpcMuxImpl::apiStateFor(absl::string_view type_url) {
   auto itr = api_state_.find(type_url);
   if (itr == api_state_.end()) {
-    api_state_.emplace(
-        type_url, std::make_unique<ApiState>(dispatcher_, [this, type_url](const auto& expired) {
-          expiryCallback(type_url, expired);
-        }));
+    itr = api_state_
+              .emplace(type_url,
+                       std::make_unique<ApiState>(dispatcher_,
+                                                  [this, type_url](const auto& expired) {
+                                                    expiryCallback(type_url, expired);
+                                                  }))
+              .first;
   }
 
-  return *api_state_.find(type_url)->second;
+  return *itr->second;
 }
 
 void GrpcMuxImpl::drainRequests() {
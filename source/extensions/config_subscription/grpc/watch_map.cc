@@ -207,10 +207,13 @@ void WatchMap::onConfigUpdate(const Protobuf::RepeatedPtrField<ProtobufWkt::Any>
 
   std::vector<DecodedResourcePtr> decoded_resources;
   decoded_resources.reserve(resources.size());
+  const std::shared_ptr<Protobuf::Arena> decode_arena = maybeCreateResourceDecodingArena();
   for (const auto& r : resources) {
-    decoded_resources.emplace_back(THROW_OR_RETURN_VALUE(
-        DecodedResourceImpl::fromResource((*watches_.begin())->resource_decoder_, r, version_info),
-        DecodedResourceImplPtr));
+    decoded_resources.emplace_back(
+        THROW_OR_RETURN_VALUE(DecodedResourceImpl::fromResource(
+                                  (*watches_.begin())->resource_decoder_, r, version_info,
+                                  decode_arena),
+                              DecodedResourceImplPtr));
   }
 
   onConfigUpdate(decoded_resources, version_info);
@@ -46,6 +46,7 @@ void SotwSubscriptionState::markStreamFresh(bool) {
 void SotwSubscriptionState::handleGoodResponse(
     envoy::service::discovery::v3::DiscoveryResponse& message) {
   std::vector<DecodedResourcePtr> non_heartbeat_resources;
+  const std::shared_ptr<Protobuf::Arena> decode_arena = maybeCreateResourceDecodingArena();
 
   {
     const auto scoped_update = ttl_.scopedTtlUpdate();
@@ -58,9 +59,11 @@ void SotwSubscriptionState::handleGoodResponse(
                                          message.DebugString()));
       }
 
-      auto decoded_resource = THROW_OR_RETURN_VALUE(
-          DecodedResourceImpl::fromResource(*resource_decoder_, any, message.version_info()),
-          DecodedResourceImplPtr);
+      auto decoded_resource =
+          THROW_OR_RETURN_VALUE(DecodedResourceImpl::fromResource(*resource_decoder_, any,
+                                                                  message.version_info(),
+                                                                  decode_arena),
+                                DecodedResourceImplPtr);
       setResourceTtl(*decoded_resource);
       if (isHeartbeatResource(*decoded_resource, message.version_info())) {
         continue;
@@ -12,6 +12,11 @@
 // this restriction and hopefully provide a wider compatibility guarantee. Until then, Envoy
 // checks the hash of the ABI header files to ensure that the dynamic modules are built against the
 // same version of the ABI.
+//
+// Since each call across the module boundary has a fixed cost, accessors added to this ABI should
+// be designed to amortize crossings: HTTP header access should snapshot or mutate all headers in a
+// single call rather than one call per header, and body access should expose views over the
+// underlying buffer slices instead of copying the data out.
 
 #ifdef __cplusplus
 extern "C" {
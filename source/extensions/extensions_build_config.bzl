@@ -249,6 +249,7 @@ EXTENSIONS = {
     "envoy.resource_monitors.injected_resource":        "//source/extensions/resource_monitors/injected_resource:config",
     "envoy.resource_monitors.global_downstream_max_connections":   "//source/extensions/resource_monitors/downstream_connections:config",
     "envoy.resource_monitors.cpu_utilization":          "//source/extensions/resource_monitors/cpu_utilization:config",
+    "envoy.resource_monitors.worker_saturation":        "//source/extensions/resource_monitors/worker_saturation:config",
 
     #
     # Stat sinks
@@ -329,6 +330,7 @@ EXTENSIONS = {
     # CacheFilter plugins
     #
     "envoy.extensions.http.cache.file_system_http_cache": "//source/extensions/http/cache/file_system_http_cache:config",
+    "envoy.extensions.http.cache.sharded_lru":          "//source/extensions/http/cache/sharded_lru_http_cache:config",
     "envoy.extensions.http.cache.simple":               "//source/extensions/http/cache/simple_http_cache:config",
 
     #
@@ -464,6 +466,12 @@ EXTENSIONS = {
     # getaddrinfo DNS resolver extension can be used when the system resolver is desired (e.g., Android)
     "envoy.network.dns_resolver.getaddrinfo":          "//source/extensions/network/dns_resolver/getaddrinfo:config",
 
+    #
+    # Connection balancing
+    #
+
+    "envoy.network.connection_balance.load_aware":     "//source/extensions/network/connection_balance/load_aware:config",
+
     #
     # Custom matchers
     #
@@ -128,8 +128,14 @@ SINGLETON_MANAGER_REGISTRATION(expression_builder);
 
 BuilderInstanceSharedPtr getBuilder(Server::Configuration::CommonFactoryContext& context) {
   return context.singletonManager().getTyped<BuilderInstance>(
-      SINGLETON_MANAGER_REGISTERED_NAME(expression_builder),
-      [] { return std::make_shared<BuilderInstance>(createBuilder(nullptr)); });
+      SINGLETON_MANAGER_REGISTERED_NAME(expression_builder), [] {
+        // Constant sub-expressions are folded when expressions are created (on the main thread),
+        // so evaluation on the request path does not recompute them. The folded constants live in
+        // an arena owned by the singleton, alongside the builder.
+        auto constant_arena = std::make_unique<Protobuf::Arena>();
+        auto builder = createBuilder(constant_arena.get());
+        return std::make_shared<BuilderInstance>(std::move(builder), std::move(constant_arena));
+      });
 }
 
 ExpressionPtr createExpression(Builder& builder, const google::api::expr::v1alpha1::Expr& expr) {
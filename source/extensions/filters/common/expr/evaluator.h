@@ -76,9 +76,14 @@ ActivationPtr createActivation(const ::Envoy::LocalInfo::LocalInfo* local_info,
 class BuilderInstance : public Singleton::Instance {
 public:
   explicit BuilderInstance(BuilderPtr builder) : builder_(std::move(builder)) {}
+  BuilderInstance(BuilderPtr builder, std::unique_ptr<Protobuf::Arena> constant_arena)
+      : constant_arena_(std::move(constant_arena)), builder_(std::move(builder)) {}
   Builder& builder() { return *builder_; }
 
 private:
+  // Holds constants folded at expression creation time. Declared before the builder so it
+  // outlives the builder and any expressions created from it.
+  std::unique_ptr<Protobuf::Arena> constant_arena_;
   BuilderPtr builder_;
 };
 
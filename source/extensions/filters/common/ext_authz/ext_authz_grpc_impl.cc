@@ -106,7 +106,7 @@ void GrpcClientImpl::check(RequestCallbacks& callbacks,
 void GrpcClientImpl::onSuccess(std::unique_ptr<envoy::service::auth::v3::CheckResponse>&& response,
                                Tracing::Span& span) {
   ENVOY_LOG(trace, "Received CheckResponse: {}", response->DebugString());
-  ResponsePtr authz_response = std::make_unique<Response>(Response{});
+  ResponsePtr authz_response = std::make_unique<Response>();
   if (response->status().code() == Grpc::Status::WellKnownGrpcStatus::Ok) {
     span.setTag(TracingConstants::get().TraceStatus, TracingConstants::get().TraceOk);
     authz_response->status = CheckStatus::OK;
@@ -127,16 +127,18 @@ void GrpcClientImpl::onSuccess(std::unique_ptr<envoy::service::auth::v3::CheckRe
       if (status_code > 0) {
         authz_response->status_code = static_cast<Http::Code>(status_code);
       }
-      authz_response->body = response->denied_response().body();
+      // The check response is owned by this callback, so the body can be moved out of it.
+      authz_response->body = std::move(*response->mutable_denied_response()->mutable_body());
     }
   }
 
   // OkHttpResponse.dynamic_metadata is deprecated. Until OkHttpResponse.dynamic_metadata is
   // removed, it overrides dynamic_metadata field of the outer check response.
   if (response->has_ok_response() && response->ok_response().has_dynamic_metadata()) {
-    authz_response->dynamic_metadata = response->ok_response().dynamic_metadata();
+    authz_response->dynamic_metadata =
+        std::move(*response->mutable_ok_response()->mutable_dynamic_metadata());
   } else {
-    authz_response->dynamic_metadata = response->dynamic_metadata();
+    authz_response->dynamic_metadata = std::move(*response->mutable_dynamic_metadata());
   }
 
   callbacks_->onComplete(std::move(authz_response));
@@ -148,10 +150,10 @@ void GrpcClientImpl::onFailure(Grpc::Status::GrpcStatus status, const std::strin
   ENVOY_LOG(trace, "CheckRequest call failed with status: {}",
             Grpc::Utility::grpcStatusToString(status));
   ASSERT(status != Grpc::Status::WellKnownGrpcStatus::Ok);
-  Response response{};
-  response.status = CheckStatus::Error;
-  response.status_code = Http::Code::Forbidden;
-  callbacks_->onComplete(std::make_unique<Response>(response));
+  ResponsePtr response = std::make_unique<Response>();
+  response->status = CheckStatus::Error;
+  response->status_code = Http::Code::Forbidden;
+  callbacks_->onComplete(std::move(response));
   callbacks_ = nullptr;
 }
 
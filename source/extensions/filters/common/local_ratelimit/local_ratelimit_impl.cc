@@ -264,6 +264,15 @@ void LocalRateLimiterImpl::onFillTimer() {
 LocalRateLimiterImpl::Result LocalRateLimiterImpl::requestAllowed(
     absl::Span<const RateLimit::LocalDescriptor> request_descriptors) const {
 
+  // Fast path for limiters that only have the default token bucket (e.g. listener or
+  // connection level limiters): don't hash the request descriptors at all.
+  if (descriptors_.empty()) {
+    const double share_factor =
+        share_provider_ != nullptr ? share_provider_->getTokensShareFactor() : 1.0;
+    const bool allowed = default_token_bucket_->consume(share_factor);
+    return {allowed, makeOptRefFromPtr<TokenBucketContext>(default_token_bucket_.get())};
+  }
+
   // In most cases the request descriptors has only few elements. We use a inlined vector to
   // avoid heap allocation.
   absl::InlinedVector<RateLimitTokenBucket*, 8> matched_descriptors;
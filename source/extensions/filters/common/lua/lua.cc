@@ -14,8 +14,44 @@ namespace Filters {
 namespace Common {
 namespace Lua {
 
-Coroutine::Coroutine(const std::pair<lua_State*, lua_State*>& new_thread_state)
-    : coroutine_state_(new_thread_state, false) {}
+CoroutinePool::~CoroutinePool() {
+  for (int ref : parked_refs_) {
+    luaL_unref(state_, LUA_REGISTRYINDEX, ref);
+  }
+}
+
+lua_State* CoroutinePool::take() {
+  if (parked_refs_.empty()) {
+    return nullptr;
+  }
+  const int ref = parked_refs_.back();
+  parked_refs_.pop_back();
+  lua_rawgeti(state_, LUA_REGISTRYINDEX, ref);
+  luaL_unref(state_, LUA_REGISTRYINDEX, ref);
+  lua_State* coroutine = lua_tothread(state_, -1);
+  ASSERT(coroutine != nullptr);
+  return coroutine;
+}
+
+void CoroutinePool::park(LuaRef<lua_State>& coroutine) {
+  if (parked_refs_.size() >= MaxParkedCoroutines) {
+    return;
+  }
+  coroutine.pushStack();
+  parked_refs_.push_back(luaL_ref(state_, LUA_REGISTRYINDEX));
+}
+
+Coroutine::Coroutine(const std::pair<lua_State*, lua_State*>& new_thread_state, CoroutinePool* pool)
+    : coroutine_state_(new_thread_state, false), pool_(pool) {}
+
+Coroutine::~Coroutine() {
+  // Only a coroutine that never started or ran to completion without error can be restarted from
+  // C, so only those are parked for reuse; yielded or errored threads are left to the GC.
+  if (pool_ != nullptr && state_ != State::Yielded && !errored_) {
+    lua_settop(coroutine_state_.get(), 0);
+    pool_->park(coroutine_state_);
+  }
+}
 
 void Coroutine::start(int function_ref, int num_args, const std::function<void()>& yield_callback) {
   ASSERT(state_ == State::NotStarted);
@@ -43,6 +79,7 @@ void Coroutine::resume(int num_args, const std::function<void()>& yield_callback
     yield_callback();
   } else {
     state_ = State::Finished;
+    errored_ = true;
     const char* error = lua_tostring(coroutine_state_.get(), -1);
     if (!error) {
       error = "unspecified lua error";
@@ -59,12 +96,30 @@ ThreadLocalState::ThreadLocalState(const std::string& code, ThreadLocal::SlotAll
   RELEASE_ASSERT(state.get() != nullptr, "unable to create new Lua state object");
   luaL_openlibs(state.get());
 
-  if (0 != luaL_dostring(state.get(), code.c_str())) {
+  if (0 != luaL_loadstring(state.get(), code.c_str())) {
+    throw LuaException(fmt::format("script load error: {}", lua_tostring(state.get(), -1)));
+  }
+
+  // Dump the compiled chunk so the per-worker states below load bytecode instead of each
+  // re-parsing the source. Debug information, including the chunk name used in script error
+  // messages, is preserved in the dump.
+  std::string bytecode;
+  lua_dump(
+      state.get(),
+      [](lua_State*, const void* data, size_t size, void* out) -> int {
+        static_cast<std::string*>(out)->append(static_cast<const char*>(data), size);
+        return 0;
+      },
+      &bytecode);
+
+  // Run the chunk to surface errors thrown at script load time.
+  if (0 != lua_pcall(state.get(), 0, 0, 0)) {
     throw LuaException(fmt::format("script load error: {}", lua_tostring(state.get(), -1)));
   }
 
   // Now initialize on all threads.
-  tls_slot_->set([code](Event::Dispatcher&) { return std::make_shared<LuaThreadLocal>(code); });
+  tls_slot_->set(
+      [bytecode](Event::Dispatcher&) { return std::make_shared<LuaThreadLocal>(bytecode); });
 }
 
 int ThreadLocalState::getGlobalRef(uint64_t slot) {
@@ -93,16 +148,23 @@ uint64_t ThreadLocalState::registerGlobal(const std::string& global,
 }
 
 CoroutinePtr ThreadLocalState::createCoroutine() {
-  lua_State* state = tlsState().get();
-  return std::make_unique<Coroutine>(std::make_pair(lua_newthread(state), state));
+  LuaThreadLocal& tls = **tls_slot_;
+  lua_State* state = tls.state_.get();
+  lua_State* coroutine = tls.coroutine_pool_.take();
+  if (coroutine == nullptr) {
+    coroutine = lua_newthread(state);
+  }
+  return std::make_unique<Coroutine>(std::make_pair(coroutine, state), &tls.coroutine_pool_);
 }
 
-ThreadLocalState::LuaThreadLocal::LuaThreadLocal(const std::string& code)
-    : state_(luaL_newstate()) {
+ThreadLocalState::LuaThreadLocal::LuaThreadLocal(const std::string& bytecode)
+    : state_(luaL_newstate()), coroutine_pool_(state_.get()) {
 
   RELEASE_ASSERT(state_.get() != nullptr, "unable to create new Lua state object");
   luaL_openlibs(state_.get());
-  int rc = luaL_dostring(state_.get(), code.c_str());
+  int rc = luaL_loadbuffer(state_.get(), bytecode.data(), bytecode.size(), "<script>");
+  ASSERT(rc == 0);
+  rc = lua_pcall(state_.get(), 0, 0, 0);
   ASSERT(rc == 0);
 }
 
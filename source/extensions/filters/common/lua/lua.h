@@ -343,6 +343,39 @@ public:
   }
 };
 
+/**
+ * A pool of coroutine threads parked for reuse. Every worker owns its own pool as part of its
+ * thread local state, so there is no locking. Handing out a parked thread avoids paying
+ * lua_newthread plus the eventual GC of the thread for every stream.
+ */
+class CoroutinePool {
+public:
+  explicit CoroutinePool(lua_State* state) : state_(state) {}
+  ~CoroutinePool();
+
+  /**
+   * Take a previously parked coroutine thread. If one is available it is left on the stack of the
+   * main state, ready to be referenced by a Coroutine.
+   * @return the parked thread, or nullptr if the pool is empty.
+   */
+  lua_State* take();
+
+  /**
+   * Park a coroutine thread for later reuse. The caller must have reset the thread's stack and
+   * verified that it can be restarted. Threads offered beyond the pool's capacity are not parked
+   * and are reclaimed by the GC as before.
+   * @param coroutine supplies a reference to the thread being parked.
+   */
+  void park(LuaRef<lua_State>& coroutine);
+
+private:
+  // Bounds how many idle threads a worker retains after a burst of concurrent streams.
+  static constexpr size_t MaxParkedCoroutines = 32;
+
+  lua_State* state_;
+  std::vector<int> parked_refs_;
+};
+
 /**
  * This is a wrapper for a Lua coroutine. Lua intermixes coroutine and "thread." Lua does not have
  * real threads, only cooperatively scheduled coroutines.
@@ -351,7 +384,14 @@ class Coroutine : Logger::Loggable<Logger::Id::lua> {
 public:
   enum class State { NotStarted, Yielded, Finished };
 
-  Coroutine(const std::pair<lua_State*, lua_State*>& new_thread_state);
+  /**
+   * @param new_thread_state supplies the coroutine thread and the main state it belongs to.
+   * @param pool supplies an optional pool the thread is parked into on destruction when it can be
+   *        restarted (it never started or it finished without error or yielding).
+   */
+  Coroutine(const std::pair<lua_State*, lua_State*>& new_thread_state,
+            CoroutinePool* pool = nullptr);
+  ~Coroutine();
   lua_State* luaState() { return coroutine_state_.get(); }
   State state() { return state_; }
 
@@ -376,6 +416,8 @@ public:
 private:
   LuaRef<lua_State> coroutine_state_;
   State state_{State::NotStarted};
+  CoroutinePool* pool_;
+  bool errored_{};
 };
 
 using CoroutinePtr = std::unique_ptr<Coroutine>;
@@ -436,10 +478,12 @@ public:
 
 private:
   struct LuaThreadLocal : public ThreadLocal::ThreadLocalObject {
-    LuaThreadLocal(const std::string& code);
+    LuaThreadLocal(const std::string& bytecode);
 
     CSmartPtr<lua_State, lua_close> state_;
     std::vector<int> global_slots_;
+    // Declared after state_ so the pool unrefs its parked threads before the state is closed.
+    CoroutinePool coroutine_pool_;
   };
 
   CSmartPtr<lua_State, lua_close>& tlsState() { return (*tls_slot_)->state_; }
@@ -19,11 +19,21 @@ namespace Filters {
 namespace Common {
 namespace RateLimit {
 
+namespace {
+
+// A client is created per filter stack today, so resolve the method descriptor once per process
+// instead of taking the generated pool lookup in every constructor.
+const Protobuf::MethodDescriptor& shouldRateLimitMethod() {
+  static const auto* method = Protobuf::DescriptorPool::generated_pool()->FindMethodByName(
+      "envoy.service.ratelimit.v3.RateLimitService.ShouldRateLimit");
+  return *method;
+}
+
+} // namespace
+
 GrpcClientImpl::GrpcClientImpl(const Grpc::RawAsyncClientSharedPtr& async_client,
                                const absl::optional<std::chrono::milliseconds>& timeout)
-    : async_client_(async_client), timeout_(timeout),
-      service_method_(*Protobuf::DescriptorPool::generated_pool()->FindMethodByName(
-          "envoy.service.ratelimit.v3.RateLimitService.ShouldRateLimit")) {}
+    : async_client_(async_client), timeout_(timeout), service_method_(shouldRateLimitMethod()) {}
 
 GrpcClientImpl::~GrpcClientImpl() { ASSERT(!callbacks_); }
 
@@ -39,9 +49,11 @@ void GrpcClientImpl::createRequest(envoy::service::ratelimit::v3::RateLimitReque
                                    uint32_t hits_addend) {
   request.set_domain(domain);
   request.set_hits_addend(hits_addend);
+  request.mutable_descriptors()->Reserve(descriptors.size());
   for (const Envoy::RateLimit::Descriptor& descriptor : descriptors) {
     envoy::extensions::common::ratelimit::v3::RateLimitDescriptor* new_descriptor =
         request.add_descriptors();
+    new_descriptor->mutable_entries()->Reserve(descriptor.entries_.size());
     for (const Envoy::RateLimit::DescriptorEntry& entry : descriptor.entries_) {
       envoy::extensions::common::ratelimit::v3::RateLimitDescriptor::Entry* new_entry =
           new_descriptor->add_entries();
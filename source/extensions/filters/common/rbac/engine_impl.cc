@@ -1,5 +1,7 @@
 #include "source/extensions/filters/common/rbac/engine_impl.h"
 
+#include <algorithm>
+
 #include "envoy/config/rbac/v3/rbac.pb.h"
 #include "envoy/config/rbac/v3/rbac.pb.validate.h"
 
@@ -53,10 +55,16 @@ RoleBasedAccessControlEngineImpl::RoleBasedAccessControlEngineImpl(
     }
   }
 
+  policies_.reserve(rules.policies().size());
   for (const auto& policy : rules.policies()) {
-    policies_.emplace(policy.first, std::make_unique<PolicyMatcher>(policy.second, builder_.get(),
-                                                                    validation_visitor, context));
+    policies_.emplace_back(policy.first, std::make_unique<PolicyMatcher>(
+                                             policy.second, builder_.get(), validation_visitor,
+                                             context));
   }
+  // Proto map iteration order is not deterministic; sort by policy name to preserve the
+  // evaluation order the std::map previously provided.
+  std::sort(policies_.begin(), policies_.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
 }
 
 bool RoleBasedAccessControlEngineImpl::handleAction(const Network::Connection& connection,
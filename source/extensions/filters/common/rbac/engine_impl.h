@@ -86,7 +86,9 @@ private:
   const envoy::config::rbac::v3::RBAC::Action action_;
   const EnforcementMode mode_;
 
-  std::map<std::string, std::unique_ptr<PolicyMatcher>> policies_;
+  // Policies sorted by name, evaluated in order per request. A flat vector keeps the per-request
+  // scan over contiguous memory instead of chasing map nodes.
+  std::vector<std::pair<std::string, std::unique_ptr<PolicyMatcher>>> policies_;
 
   Protobuf::Arena constant_arena_;
   Expr::BuilderPtr builder_;
@@ -51,7 +51,7 @@ GradientController::GradientController(GradientControllerConfig config,
       stats_(generateStats(scope_, stats_prefix)), random_(random), time_source_(time_source),
       deferred_limit_value_(0), num_rq_outstanding_(0),
       concurrency_limit_(config_.minConcurrency()),
-      latency_sample_hist_(hist_fast_alloc(), hist_free) {
+      merged_sample_hist_(hist_fast_alloc(), hist_free) {
   min_rtt_calc_timer_ = dispatcher_.createTimer([this]() -> void { enterMinRTTSamplingWindow(); });
 
   sample_reset_timer_ = dispatcher_.createTimer([this]() -> void {
@@ -75,6 +75,22 @@ GradientController::GradientController(GradientControllerConfig config,
   stats_.concurrency_limit_.set(concurrency_limit_.load());
 }
 
+GradientController::LatencySampleShard& GradientController::localLatencyShard() {
+  static std::atomic<uint32_t> next_shard{0};
+  static thread_local uint32_t shard_index =
+      next_shard.fetch_add(1, std::memory_order_relaxed) % NumLatencySampleShards;
+  return latency_sample_shards_[shard_index];
+}
+
+uint64_t GradientController::latencySampleCount() {
+  uint64_t count = 0;
+  for (LatencySampleShard& shard : latency_sample_shards_) {
+    absl::MutexLock shard_lock(&shard.mtx);
+    count += hist_sample_count(shard.hist.get());
+  }
+  return count;
+}
+
 GradientControllerStats GradientController::generateStats(Stats::Scope& scope,
                                                           const std::string& stats_prefix) {
   return {ALL_GRADIENT_CONTROLLER_STATS(POOL_COUNTER_PREFIX(scope, stats_prefix),
@@ -102,7 +118,10 @@ void GradientController::enterMinRTTSamplingWindow() {
 
   // Throw away any latency samples from before the recalculation window as it may not represent
   // the minRTT.
-  hist_clear(latency_sample_hist_.get());
+  for (LatencySampleShard& shard : latency_sample_shards_) {
+    absl::MutexLock shard_lock(&shard.mtx);
+    hist_clear(shard.hist.get());
+  }
 
   min_rtt_epoch_ = time_source_.monotonicTime();
 }
@@ -111,7 +130,7 @@ void GradientController::updateMinRTT() {
   // Only update minRTT when it is in minRTT sampling window and
   // number of samples is greater than or equal to the minRTTAggregateRequestCount.
   if (!inMinRTTSamplingWindow() ||
-      hist_sample_count(latency_sample_hist_.get()) < config_.minRTTAggregateRequestCount()) {
+      latencySampleCount() < config_.minRTTAggregateRequestCount()) {
     return;
   }
 
@@ -141,7 +160,7 @@ void GradientController::resetSampleWindow() {
   // The sampling window must not be reset while sampling for the new minRTT value.
   ASSERT(!inMinRTTSamplingWindow());
 
-  if (hist_sample_count(latency_sample_hist_.get()) == 0) {
+  if (latencySampleCount() == 0) {
     return;
   }
 
@@ -152,10 +171,18 @@ void GradientController::resetSampleWindow() {
 }
 
 std::chrono::microseconds GradientController::processLatencySamplesAndClear() {
+  // Merge the per-shard histograms so the quantile is computed over every sample recorded in the
+  // closing window.
+  hist_clear(merged_sample_hist_.get());
+  for (LatencySampleShard& shard : latency_sample_shards_) {
+    absl::MutexLock shard_lock(&shard.mtx);
+    histogram_t* shard_hist = shard.hist.get();
+    hist_accumulate(merged_sample_hist_.get(), &shard_hist, 1);
+    hist_clear(shard_hist);
+  }
   const std::array<double, 1> quantile{config_.sampleAggregatePercentile()};
   std::array<double, 1> calculated_quantile;
-  hist_approx_quantile(latency_sample_hist_.get(), quantile.data(), 1, calculated_quantile.data());
-  hist_clear(latency_sample_hist_.get());
+  hist_approx_quantile(merged_sample_hist_.get(), quantile.data(), 1, calculated_quantile.data());
   return std::chrono::microseconds(static_cast<int>(calculated_quantile[0]));
 }
 
@@ -214,8 +241,15 @@ void GradientController::recordLatencySample(MonotonicTime rq_send_time) {
                                                             rq_send_time);
   synchronizer_.syncPoint("pre_hist_insert");
   {
+    LatencySampleShard& shard = localLatencyShard();
+    absl::MutexLock ml(&shard.mtx);
+    hist_insert(shard.hist.get(), rq_latency.count(), 1);
+  }
+  // In the steady state the sample mutation mutex is not needed to record a sample; it is only
+  // taken during the minRTT sampling window to check whether enough samples have accumulated to
+  // finish the recalculation.
+  if (inMinRTTSamplingWindow()) {
     absl::MutexLock ml(&sample_mutation_mtx_);
-    hist_insert(latency_sample_hist_.get(), rq_latency.count(), 1);
     updateMinRTT();
   }
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <chrono>
 #include <vector>
 
@@ -228,8 +229,23 @@ public:
   uint32_t concurrencyLimit() const override { return concurrency_limit_.load(); }
 
 private:
+  // A shard of the latency sample histogram. Workers are assigned to shards round-robin on first
+  // use so that recording a sample contends only with the other threads sharing its shard rather
+  // than serializing all workers on one mutex.
+  struct LatencySampleShard {
+    absl::Mutex mtx;
+    std::unique_ptr<histogram_t, decltype(&hist_free)> hist
+        ABSL_GUARDED_BY(mtx){hist_fast_alloc(), hist_free};
+  };
+
+  // Few enough shards to keep the merge on window close cheap while still spreading workers
+  // across mutexes.
+  static constexpr size_t NumLatencySampleShards = 4;
+
   static GradientControllerStats generateStats(Stats::Scope& scope,
                                                const std::string& stats_prefix);
+  LatencySampleShard& localLatencyShard();
+  uint64_t latencySampleCount();
   void updateMinRTT() ABSL_EXCLUSIVE_LOCKS_REQUIRED(sample_mutation_mtx_);
   std::chrono::microseconds processLatencySamplesAndClear()
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(sample_mutation_mtx_);
@@ -248,9 +264,10 @@ private:
   Random::RandomGenerator& random_;
   TimeSource& time_source_;
 
-  // Protects data related to latency sampling and RTT values. In addition to protecting the latency
-  // sample histogram, the mutex ensures that the minRTT calculation window and the sample window
-  // (where the new concurrency limit is determined) do not overlap.
+  // Protects data related to RTT values. In addition to protecting the merged latency sample
+  // histogram, the mutex ensures that the minRTT calculation window and the sample window
+  // (where the new concurrency limit is determined) do not overlap. The individual latency sample
+  // shards are protected by their own mutexes.
   absl::Mutex sample_mutation_mtx_;
 
   // Stores the value of the concurrency limit prior to entering the minRTT update window. If this
@@ -273,10 +290,14 @@ private:
   // make the forwarding decision without locking.
   std::atomic<uint32_t> concurrency_limit_;
 
-  // Stores all sampled latencies and provides percentile estimations when using the sampled data to
-  // calculate a new concurrency limit.
+  // Stores all sampled latencies, sharded so that workers recording samples do not serialize on a
+  // single mutex.
+  std::array<LatencySampleShard, NumLatencySampleShards> latency_sample_shards_;
+
+  // Scratch histogram into which the shards are merged to provide percentile estimations when
+  // using the sampled data to calculate a new concurrency limit.
   std::unique_ptr<histogram_t, decltype(&hist_free)>
-      latency_sample_hist_ ABSL_GUARDED_BY(sample_mutation_mtx_);
+      merged_sample_hist_ ABSL_GUARDED_BY(sample_mutation_mtx_);
 
   // Tracks the number of consecutive times that the concurrency limit is set to the minimum. This
   // is used to determine whether the controller should trigger an additional minRTT measurement
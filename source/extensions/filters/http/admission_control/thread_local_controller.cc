@@ -22,22 +22,26 @@ uint32_t ThreadLocalControllerImpl::averageRps() const {
     return 0;
   }
   using std::chrono::seconds;
-  seconds secs =
-      std::max(sampling_window_, std::chrono::duration_cast<seconds>(ageOfOldestSample()));
+  seconds secs = std::max(sampling_window_, std::chrono::duration_cast<seconds>(ageOfOldestSample(
+                                                time_source_.monotonicTime())));
   return global_data_.requests / secs.count();
 }
 
 void ThreadLocalControllerImpl::maybeUpdateHistoricalData() {
+  // Sample the clock once per update; the purge loop would otherwise query the time source again
+  // for every stale entry it examines, and the clock read dominates the cost of recording.
+  const MonotonicTime now = time_source_.monotonicTime();
+
   // Purge stale samples.
-  while (!historical_data_.empty() && ageOfOldestSample() >= sampling_window_) {
+  while (!historical_data_.empty() && ageOfOldestSample(now) >= sampling_window_) {
     removeOldestSample();
   }
 
   // It's possible we purged stale samples from the history and are left with nothing, so it's
   // necessary to add an empty entry. We will also need to roll over into a new entry in the
   // historical data if we've exceeded the time specified by the granularity.
-  if (historical_data_.empty() || ageOfNewestSample() >= defaultHistoryGranularity) {
-    historical_data_.emplace_back(time_source_.monotonicTime(), RequestData());
+  if (historical_data_.empty() || ageOfNewestSample(now) >= defaultHistoryGranularity) {
+    historical_data_.emplace_back(now, RequestData());
   }
 }
 
@@ -79,20 +79,20 @@ private:
   // Potentially remove any stale samples and record sample aggregates to the historical data.
   void maybeUpdateHistoricalData();
 
-  // Returns the age of the oldest sample in the historical data.
-  std::chrono::microseconds ageOfOldestSample() const {
+  // Returns the age of the oldest sample in the historical data, relative to the given time. The
+  // caller samples the clock once and reuses it; querying the time source is the most expensive
+  // part of recording a request.
+  std::chrono::microseconds ageOfOldestSample(MonotonicTime now) const {
     ASSERT(!historical_data_.empty());
-    using namespace std::chrono;
-    return duration_cast<microseconds>(time_source_.monotonicTime() -
-                                       historical_data_.front().first);
+    return std::chrono::duration_cast<std::chrono::microseconds>(now -
+                                                                 historical_data_.front().first);
   }
 
-  // Returns the age of the newest sample in the historical data.
-  std::chrono::microseconds ageOfNewestSample() const {
+  // Returns the age of the newest sample in the historical data, relative to the given time.
+  std::chrono::microseconds ageOfNewestSample(MonotonicTime now) const {
     ASSERT(!historical_data_.empty());
-    using namespace std::chrono;
-    return duration_cast<microseconds>(time_source_.monotonicTime() -
-                                       historical_data_.back().first);
+    return std::chrono::duration_cast<std::chrono::microseconds>(now -
+                                                                 historical_data_.back().first);
   }
 
   // Removes the oldest sample in the historical data and reconciles the global data.
@@ -110,20 +110,22 @@ void Filter::onMatchCallback(const Matcher::Action& action) {
   if (wrapper.filter_to_inject_.has_value()) {
     stats_.filter_delegation_success_.inc();
 
+    // Capturing the action name by reference is safe since the visit below runs synchronously,
+    // and avoids copying the string into each of the three alternatives.
     auto createDelegatedFilterFn = Overloaded{
-        [this, action_name](Http::StreamDecoderFilterSharedPtr filter) {
+        [this, &action_name](Http::StreamDecoderFilterSharedPtr filter) {
           delegated_filter_ = std::make_shared<StreamFilterWrapper>(std::move(filter));
-          updateFilterState(decoder_callbacks_, std::string(decoder_callbacks_->filterConfigName()),
+          updateFilterState(decoder_callbacks_, decoder_callbacks_->filterConfigName(),
                             action_name);
         },
-        [this, action_name](Http::StreamEncoderFilterSharedPtr filter) {
+        [this, &action_name](Http::StreamEncoderFilterSharedPtr filter) {
           delegated_filter_ = std::make_shared<StreamFilterWrapper>(std::move(filter));
-          updateFilterState(encoder_callbacks_, std::string(encoder_callbacks_->filterConfigName()),
+          updateFilterState(encoder_callbacks_, encoder_callbacks_->filterConfigName(),
                             action_name);
         },
-        [this, action_name](Http::StreamFilterSharedPtr filter) {
+        [this, &action_name](Http::StreamFilterSharedPtr filter) {
           delegated_filter_ = std::move(filter);
-          updateFilterState(decoder_callbacks_, std::string(decoder_callbacks_->filterConfigName()),
+          updateFilterState(decoder_callbacks_, decoder_callbacks_->filterConfigName(),
                             action_name);
         }};
     absl::visit(createDelegatedFilterFn, std::move(wrapper.filter_to_inject_.value()));
@@ -141,7 +143,7 @@ void Filter::onMatchCallback(const Matcher::Action& action) {
 }
 
 void Filter::updateFilterState(Http::StreamFilterCallbacks* callback,
-                               const std::string& filter_name, const std::string& action_name) {
+                               absl::string_view filter_name, const std::string& action_name) {
   if (isUpstream()) {
     return;
   }
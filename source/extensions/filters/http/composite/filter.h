@@ -32,8 +32,8 @@ struct FilterStats {
 
 class MatchedActionInfo : public StreamInfo::FilterState::Object {
 public:
-  MatchedActionInfo(const std::string& filter, const std::string& action) {
-    actions_[filter] = action;
+  MatchedActionInfo(absl::string_view filter, absl::string_view action) {
+    actions_[filter] = std::string(action);
   }
 
   ProtobufTypes::MessagePtr serializeAsProto() const override { return buildProtoStruct(); }
@@ -42,8 +42,8 @@ public:
     return Json::Factory::loadFromProtobufStruct(*buildProtoStruct())->asJsonString();
   }
 
-  void setFilterAction(const std::string& filter, const std::string& action) {
-    actions_[filter] = action;
+  void setFilterAction(absl::string_view filter, absl::string_view action) {
+    actions_[filter] = std::string(action);
   }
 
 private:
@@ -115,7 +115,7 @@ public:
 private:
   friend FactoryCallbacksWrapper;
 
-  void updateFilterState(Http::StreamFilterCallbacks* callback, const std::string& filter_name,
+  void updateFilterState(Http::StreamFilterCallbacks* callback, absl::string_view filter_name,
                          const std::string& action_name);
 
   Event::Dispatcher& dispatcher_;
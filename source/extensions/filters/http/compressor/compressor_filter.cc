@@ -1,8 +1,14 @@
 #include "source/extensions/filters/http/compressor/compressor_filter.h"
 
 #include "source/common/buffer/buffer_impl.h"
+#include "source/common/common/base64.h"
+#include "source/common/common/empty_string.h"
+#include "source/common/crypto/utility.h"
 #include "source/common/http/header_map_impl.h"
 #include "source/common/http/utility.h"
+#include "source/common/protobuf/utility.h"
+
+#include "absl/strings/match.h"
 
 namespace Envoy {
 namespace Extensions {
@@ -30,6 +36,58 @@ Http::RegisterCustomInlineHeader<Http::CustomInlineHeaderRegistry::Type::Respons
 // Default minimum length of an upstream response that allows compression.
 const uint64_t DefaultMinimumContentLength = 30;
 
+// Default per-stream limit of uncompressed bytes queued for the compression pool before
+// watermark backpressure is signaled.
+const uint64_t DefaultAsyncHighWatermarkBytes = 1024 * 1024;
+
+// Default byte budget of the shared dictionary store.
+const uint64_t DefaultDictionaryStoreBytes = 16 * 1024 * 1024;
+
+// Length of the raw SHA-256 digest clients send in Available-Dictionary.
+constexpr size_t DictionaryDigestSize = 32;
+
+const Http::LowerCaseString& availableDictionaryHeader() {
+  CONSTRUCT_ON_FIRST_USE(Http::LowerCaseString, "available-dictionary");
+}
+
+const Http::LowerCaseString& useAsDictionaryHeader() {
+  CONSTRUCT_ON_FIRST_USE(Http::LowerCaseString, "use-as-dictionary");
+}
+
+// RFC 9842 content coding used when compressing against a shared dictionary, keyed by the
+// library's regular content coding. Empty if there is no dictionary coding for the library.
+absl::string_view dictionaryContentCoding(absl::string_view content_encoding) {
+  if (content_encoding == Http::CustomHeaders::get().ContentEncodingValues.Zstd) {
+    return "dcz";
+  }
+  if (content_encoding == Http::CustomHeaders::get().ContentEncodingValues.Brotli) {
+    return "dcb";
+  }
+  return "";
+}
+
+// Parses the structured-field byte sequence value of Available-Dictionary, e.g.
+// ":pZGm1Av...aTZg=:", and returns the raw digest, or an empty string if the value is malformed
+// or is not a SHA-256 digest.
+std::string parseAvailableDictionary(absl::string_view value) {
+  value = StringUtil::trim(value);
+  if (value.size() < 2 || value.front() != ':' || value.back() != ':') {
+    return EMPTY_STRING;
+  }
+  std::string digest = Base64::decode(value.substr(1, value.size() - 2));
+  return digest.size() == DictionaryDigestSize ? digest : EMPTY_STRING;
+}
+
+// Builds the header bytes a dictionary-compressed payload starts with. Per RFC 9842 a "dcb"
+// payload opens with the magic bytes 0xff 'D' 'C' 'B' followed by the dictionary digest, while
+// "dcz" embeds the digest in a 32-byte zstd skippable frame ahead of the compressed frames.
+std::string buildDictionaryOutputPrefix(absl::string_view coding, const std::string& digest) {
+  std::string prefix = coding == "dcb" ? std::string("\xff\x44\x43\x42", 4)
+                                       : std::string("\x5e\x2a\x4d\x18\x20\x00\x00\x00", 8);
+  prefix.append(digest);
+  return prefix;
+}
+
 // Default content types will be used if any is provided by the user.
 const std::vector<std::string>& defaultContentEncoding() {
   CONSTRUCT_ON_FIRST_USE(std::vector<std::string>, {"text/html",
@@ -73,6 +131,97 @@ void compressAndUpdateStats(const Compression::Compressor::CompressorPtr& compre
 
 } // namespace
 
+CompressionThreadPool::CompressionThreadPool(Thread::ThreadFactory& thread_factory,
+                                             uint32_t num_threads) {
+  threads_.reserve(num_threads);
+  for (uint32_t i = 0; i < num_threads; i++) {
+    threads_.push_back(
+        thread_factory.createThread([this]() { workerLoop(); }, Thread::Options{"compression"}));
+  }
+}
+
+CompressionThreadPool::~CompressionThreadPool() {
+  {
+    absl::MutexLock lock(&mutex_);
+    shutdown_ = true;
+  }
+  for (const Thread::ThreadPtr& thread : threads_) {
+    thread->join();
+  }
+}
+
+void CompressionThreadPool::post(std::function<void()> work) {
+  absl::MutexLock lock(&mutex_);
+  work_queue_.push_back(std::move(work));
+}
+
+void CompressionThreadPool::workerLoop() {
+  while (true) {
+    std::function<void()> work;
+    {
+      absl::MutexLock lock(&mutex_);
+      mutex_.Await(absl::Condition(this, &CompressionThreadPool::hasPendingWork));
+      if (work_queue_.empty()) {
+        // Shut down and drained.
+        return;
+      }
+      work = std::move(work_queue_.front());
+      work_queue_.pop_front();
+    }
+    work();
+  }
+}
+
+void CompressorFilter::AsyncCompressionState::enqueue(Buffer::Instance& data, bool finish,
+                                                      bool end_stream) {
+  auto chunk = std::make_unique<AsyncChunk>();
+  chunk->data.move(data);
+  chunk->uncompressed_bytes = chunk->data.length();
+  chunk->finish = finish;
+  chunk->end_stream = end_stream;
+  pending_bytes_ += chunk->uncompressed_bytes;
+
+  bool need_post;
+  {
+    absl::MutexLock lock(&mutex_);
+    chunks_.push_back(std::move(chunk));
+    need_post = !draining_;
+    draining_ = true;
+  }
+  if (need_post) {
+    pool_.post([self = shared_from_this()]() { self->drain(); });
+  }
+}
+
+void CompressorFilter::AsyncCompressionState::drain() {
+  while (true) {
+    AsyncChunkPtr chunk;
+    {
+      absl::MutexLock lock(&mutex_);
+      if (chunks_.empty()) {
+        draining_ = false;
+        return;
+      }
+      chunk = std::move(chunks_.front());
+      chunks_.pop_front();
+    }
+    compressor_->compress(chunk->data, chunk->finish
+                                           ? Envoy::Compression::Compressor::State::Finish
+                                           : Envoy::Compression::Compressor::State::Flush);
+    dispatcher_.post([self = shared_from_this(),
+                      result = std::shared_ptr<AsyncChunk>(chunk.release())]() {
+      self->onChunkCompressed(*result);
+    });
+  }
+}
+
+void CompressorFilter::AsyncCompressionState::onChunkCompressed(AsyncChunk& chunk) {
+  pending_bytes_ -= chunk.uncompressed_bytes;
+  if (filter_ != nullptr) {
+    filter_->onAsyncChunkCompressed(chunk);
+  }
+}
+
 CompressorFilterConfig::DirectionConfig::DirectionConfig(
     const envoy::extensions::filters::http::compressor::v3::Compressor::CommonDirectionConfig&
         proto_config,
@@ -86,7 +235,8 @@ CompressorFilterConfig::DirectionConfig::DirectionConfig(
 CompressorFilterConfig::CompressorFilterConfig(
     const envoy::extensions::filters::http::compressor::v3::Compressor& proto_config,
     const std::string& stats_prefix, Stats::Scope& scope, Runtime::Loader& runtime,
-    Compression::Compressor::CompressorFactoryPtr compressor_factory)
+    Compression::Compressor::CompressorFactoryPtr compressor_factory,
+    Thread::ThreadFactory* thread_factory)
     : common_stats_prefix_(fmt::format("{}compressor.{}.{}", stats_prefix,
                                        proto_config.compressor_library().name(),
                                        compressor_factory->statsPrefix())),
@@ -94,7 +244,26 @@ CompressorFilterConfig::CompressorFilterConfig(
       response_direction_config_(proto_config, common_stats_prefix_, scope, runtime),
       content_encoding_(compressor_factory->contentEncoding()),
       compressor_factory_(std::move(compressor_factory)),
-      choose_first_(proto_config.choose_first()) {}
+      choose_first_(proto_config.choose_first()) {
+  if (proto_config.has_response_direction_config() &&
+      proto_config.response_direction_config().has_async_compression() &&
+      thread_factory != nullptr) {
+    const auto& async_config = proto_config.response_direction_config().async_compression();
+    compression_pool_ = std::make_unique<CompressionThreadPool>(
+        *thread_factory, PROTOBUF_GET_WRAPPED_OR_DEFAULT(async_config, threads, 1));
+    async_high_watermark_bytes_ = PROTOBUF_GET_WRAPPED_OR_DEFAULT(async_config, high_watermark_bytes,
+                                                                  DefaultAsyncHighWatermarkBytes);
+  }
+  if (proto_config.has_shared_dictionary()) {
+    const auto& dictionary_config = proto_config.shared_dictionary();
+    dictionary_store_ = std::make_shared<DictionaryStore>(PROTOBUF_GET_WRAPPED_OR_DEFAULT(
+        dictionary_config, max_store_bytes, DefaultDictionaryStoreBytes));
+    dictionary_resources_.reserve(dictionary_config.resources().size());
+    for (const auto& resource : dictionary_config.resources()) {
+      dictionary_resources_.push_back({resource.path_prefix(), resource.match()});
+    }
+  }
+}
 
 StringUtil::CaseUnorderedSet CompressorFilterConfig::DirectionConfig::contentTypeSet(
     const Protobuf::RepeatedPtrField<std::string>& types) {
@@ -163,6 +332,11 @@ Envoy::Compression::Compressor::CompressorPtr CompressorFilterConfig::makeCompre
   return compressor_factory_->createCompressor();
 }
 
+Envoy::Compression::Compressor::CompressorPtr
+CompressorFilterConfig::makeDictionaryCompressor(const std::string& dictionary) {
+  return compressor_factory_->createCompressorWithDictionary(dictionary);
+}
+
 CompressorFilter::CompressorFilter(const CompressorFilterConfigSharedPtr config)
     : config_(std::move(config)) {}
 
@@ -201,6 +375,26 @@ Http::FilterHeadersStatus CompressorFilter::decodeHeaders(Http::RequestHeaderMap
     accept_encoding_ = std::make_unique<std::string>(accept_encoding->value().getStringView());
   }
 
+  if (config_->dictionaryStore() != nullptr) {
+    // Remember whether the request addresses a configured dictionary resource so the response
+    // can be advertised and captured.
+    const absl::string_view path = headers.getPathValue();
+    for (const auto& resource : config_->dictionaryResources()) {
+      if (absl::StartsWith(path, resource.path_prefix_)) {
+        dictionary_match_ = &resource.match_;
+        break;
+      }
+    }
+    const auto available_dictionary = headers.get(availableDictionaryHeader());
+    if (!available_dictionary.empty()) {
+      negotiated_dictionary_digest_ =
+          parseAvailableDictionary(available_dictionary[0]->value().getStringView());
+      if (!negotiated_dictionary_digest_.empty()) {
+        negotiated_dictionary_ = config_->dictionaryStore()->find(negotiated_dictionary_digest_);
+      }
+    }
+  }
+
   const auto& response_config = config_->responseDirectionConfig();
   const auto* per_route_config =
       Http::Utility::resolveMostSpecificPerFilterConfig<CompressorPerRouteFilterConfig>(
@@ -278,6 +472,14 @@ Http::FilterHeadersStatus CompressorFilter::encodeHeaders(Http::ResponseHeaderMa
       Http::Utility::resolveMostSpecificPerFilterConfig<CompressorPerRouteFilterConfig>(
           decoder_callbacks_);
 
+  // Advertise and capture responses to configured dictionary resources. The identity payload is
+  // captured before any compression applied below, since that is what clients store.
+  if (dictionary_match_ != nullptr && !end_stream && headers.getStatusValue() == "200" &&
+      !headers.getInline(response_content_encoding_handle.handle())) {
+    headers.addCopy(useAsDictionaryHeader(), absl::StrCat("match=\"", *dictionary_match_, "\""));
+    capturing_dictionary_ = true;
+  }
+
   // This is used to decide whether stats for accept-encoding header should be touched.
   const bool isEnabledAndContentLengthBigEnough =
       compressionEnabled(config, per_route_config) && config.isMinimumContentLength(headers);
@@ -286,14 +488,22 @@ Http::FilterHeadersStatus CompressorFilter::encodeHeaders(Http::ResponseHeaderMa
       isEnabledAndContentLengthBigEnough && !Http::Utility::isUpgrade(headers) &&
       config.isContentTypeAllowed(headers) && !hasCacheControlNoTransform(headers) &&
       isEtagAllowed(headers) && !headers.getInline(response_content_encoding_handle.handle());
-  if (!end_stream && isAcceptEncodingAllowed(isEnabledAndContentLengthBigEnough, headers) &&
-      isCompressible && isTransferEncodingAllowed(headers)) {
+  if (!end_stream && isCompressible && isTransferEncodingAllowed(headers) &&
+      maybeStartDictionaryCompression(headers)) {
+    config.stats().compressed_.inc();
+  } else if (!end_stream && isAcceptEncodingAllowed(isEnabledAndContentLengthBigEnough, headers) &&
+             isCompressible && isTransferEncodingAllowed(headers)) {
     sanitizeEtagHeader(headers);
     headers.removeContentLength();
     headers.setInline(response_content_encoding_handle.handle(), config_->contentEncoding());
     config.stats().compressed_.inc();
     // Finally instantiate the compressor.
     response_compressor_ = config_->makeCompressor();
+    if (config_->asyncPool() != nullptr) {
+      async_state_ = std::make_shared<AsyncCompressionState>(std::move(response_compressor_),
+                                                             *config_->asyncPool(),
+                                                             encoder_callbacks_->dispatcher(), *this);
+    }
   } else {
     config.stats().not_compressed_.inc();
   }
@@ -308,15 +518,118 @@ Http::FilterHeadersStatus CompressorFilter::encodeHeaders(Http::ResponseHeaderMa
   return Http::FilterHeadersStatus::Continue;
 }
 
+bool CompressorFilter::maybeStartDictionaryCompression(Http::ResponseHeaderMap& headers) {
+  if (negotiated_dictionary_ == nullptr || accept_encoding_ == nullptr) {
+    return false;
+  }
+  const absl::string_view coding = dictionaryContentCoding(config_->contentEncoding());
+  if (coding.empty() || !acceptsEncoding(coding)) {
+    return false;
+  }
+  auto compressor = config_->makeDictionaryCompressor(*negotiated_dictionary_);
+  if (compressor == nullptr) {
+    // The compressor library does not support per-stream dictionaries.
+    return false;
+  }
+  sanitizeEtagHeader(headers);
+  headers.removeContentLength();
+  headers.setInline(response_content_encoding_handle.handle(), coding);
+  // Responses negotiated against a dictionary additionally vary on it; insertVaryHeader()
+  // appends accept-encoding later.
+  const Http::HeaderEntry* vary = headers.getInline(vary_handle.handle());
+  if (vary == nullptr) {
+    headers.setInline(vary_handle.handle(), availableDictionaryHeader().get());
+  } else if (!StringUtil::findToken(vary->value().getStringView(), ",",
+                                    availableDictionaryHeader().get(), true)) {
+    headers.setInline(vary_handle.handle(), absl::StrCat(vary->value().getStringView(), ", ",
+                                                         availableDictionaryHeader().get()));
+  }
+  response_compressor_ = std::move(compressor);
+  dictionary_output_prefix_ = buildDictionaryOutputPrefix(coding, negotiated_dictionary_digest_);
+  config_->responseDirectionConfig().responseStats().shared_dictionary_used_.inc();
+  return true;
+}
+
+bool CompressorFilter::acceptsEncoding(absl::string_view coding) const {
+  for (const auto& token : StringUtil::splitToken(*accept_encoding_, ",", false /* keep_empty */)) {
+    const absl::string_view name = StringUtil::trim(StringUtil::cropRight(token, ";"));
+    if (!absl::EqualsIgnoreCase(name, coding)) {
+      continue;
+    }
+    float q_value = 1.0;
+    const auto params = StringUtil::cropLeft(token, ";");
+    if (params != token) {
+      const auto value = StringUtil::cropLeft(params, "=");
+      if (value != params &&
+          absl::EqualsIgnoreCase("q", StringUtil::trim(StringUtil::cropRight(params, "=")))) {
+        if (!absl::SimpleAtof(StringUtil::trim(value), &q_value)) {
+          continue;
+        }
+      }
+    }
+    return q_value > 0;
+  }
+  return false;
+}
+
+void CompressorFilter::captureDictionaryData(const Buffer::Instance& data, bool end_stream) {
+  DictionaryStore* store = config_->dictionaryStore();
+  if (dictionary_capture_.length() + data.length() > store->maxBytes()) {
+    // Too large to ever be served from the store.
+    capturing_dictionary_ = false;
+    dictionary_capture_.drain(dictionary_capture_.length());
+    return;
+  }
+  dictionary_capture_.add(data);
+  if (end_stream) {
+    const std::vector<uint8_t> digest =
+        Common::Crypto::UtilitySingleton::get().getSha256Digest(dictionary_capture_);
+    store->insert(std::string(digest.begin(), digest.end()), dictionary_capture_.toString());
+    dictionary_capture_.drain(dictionary_capture_.length());
+    capturing_dictionary_ = false;
+    config_->responseDirectionConfig().responseStats().shared_dictionary_stored_.inc();
+  }
+}
+
 Http::FilterDataStatus CompressorFilter::encodeData(Buffer::Instance& data, bool end_stream) {
+  if (capturing_dictionary_) {
+    captureDictionaryData(data, end_stream);
+  }
+  if (async_state_ != nullptr) {
+    config_->responseDirectionConfig().stats().total_uncompressed_bytes_.add(data.length());
+    async_state_->enqueue(data, /*finish=*/end_stream, /*end_stream=*/end_stream);
+    updateAsyncWatermark();
+    // The chunk was moved to the pool's queue; its compressed form is injected into the filter
+    // chain when it comes back.
+    return Http::FilterDataStatus::StopIterationNoBuffer;
+  }
   if (response_compressor_ != nullptr) {
     compressAndUpdateStats(response_compressor_, config_->responseDirectionConfig().stats(), data,
                            end_stream);
+    if (!dictionary_output_prefix_.empty()) {
+      // The first chunk of a dictionary-compressed payload is preceded by the header bytes
+      // identifying the dictionary.
+      data.prepend(dictionary_output_prefix_);
+      dictionary_output_prefix_.clear();
+    }
   }
   return Http::FilterDataStatus::Continue;
 }
 
 Http::FilterTrailersStatus CompressorFilter::encodeTrailers(Http::ResponseTrailerMap&) {
+  if (capturing_dictionary_) {
+    Buffer::OwnedImpl empty_buffer;
+    // Trailers end the stream, so the captured dictionary payload is complete.
+    captureDictionaryData(empty_buffer, true);
+  }
+  if (async_state_ != nullptr) {
+    // Let the compression library finish the stream off-thread and hold the trailers back until
+    // the final output has been injected before them.
+    Buffer::OwnedImpl empty_buffer;
+    async_state_->enqueue(empty_buffer, /*finish=*/true, /*end_stream=*/false);
+    trailers_pending_ = true;
+    return Http::FilterTrailersStatus::StopIteration;
+  }
   if (response_compressor_ != nullptr) {
     Buffer::OwnedImpl empty_buffer;
     // The presence of trailers means the stream is ended, but encodeData()
@@ -324,11 +637,44 @@ Http::FilterTrailersStatus CompressorFilter::encodeTrailers(Http::ResponseTraile
     // that the stream is ended.
     compressAndUpdateStats(response_compressor_, config_->responseDirectionConfig().stats(),
                            empty_buffer, true);
+    if (!dictionary_output_prefix_.empty()) {
+      empty_buffer.prepend(dictionary_output_prefix_);
+      dictionary_output_prefix_.clear();
+    }
     encoder_callbacks_->addEncodedData(empty_buffer, true);
   }
   return Http::FilterTrailersStatus::Continue;
 }
 
+void CompressorFilter::onDestroy() {
+  if (async_state_ != nullptr) {
+    async_state_->detach();
+    async_state_.reset();
+  }
+}
+
+void CompressorFilter::onAsyncChunkCompressed(AsyncChunk& chunk) {
+  config_->responseDirectionConfig().stats().total_compressed_bytes_.add(chunk.data.length());
+  updateAsyncWatermark();
+  encoder_callbacks_->injectEncodedDataToFilterChain(chunk.data, chunk.end_stream);
+  if (trailers_pending_ && chunk.finish) {
+    trailers_pending_ = false;
+    encoder_callbacks_->continueEncoding();
+  }
+}
+
+void CompressorFilter::updateAsyncWatermark() {
+  const uint64_t high_watermark = config_->asyncHighWatermarkBytes();
+  const uint64_t pending_bytes = async_state_->pendingBytes();
+  if (!above_async_watermark_ && pending_bytes > high_watermark) {
+    above_async_watermark_ = true;
+    encoder_callbacks_->onEncoderFilterAboveWriteBufferHighWatermark();
+  } else if (above_async_watermark_ && pending_bytes <= high_watermark / 2) {
+    above_async_watermark_ = false;
+    encoder_callbacks_->onEncoderFilterBelowWriteBufferLowWatermark();
+  }
+}
+
 bool CompressorFilter::hasCacheControlNoTransform(Http::ResponseHeaderMap& headers) const {
   const Http::HeaderEntry* cache_control = headers.getInline(cache_control_handle.handle());
   if (cache_control) {
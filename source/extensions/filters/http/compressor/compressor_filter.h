@@ -1,13 +1,20 @@
 #pragma once
 
+#include <deque>
+
 #include "envoy/compression/compressor/factory.h"
+#include "envoy/event/dispatcher.h"
 #include "envoy/extensions/filters/http/compressor/v3/compressor.pb.h"
 #include "envoy/stats/stats_macros.h"
+#include "envoy/thread/thread.h"
 
+#include "source/common/buffer/buffer_impl.h"
 #include "source/common/protobuf/protobuf.h"
 #include "source/common/runtime/runtime_protos.h"
 #include "source/extensions/filters/http/common/pass_through_filter.h"
+#include "source/extensions/filters/http/compressor/dictionary_store.h"
 
+#include "absl/synchronization/mutex.h"
 #include "absl/types/optional.h"
 
 namespace Envoy {
@@ -39,6 +46,10 @@ namespace Compressor {
  *
  * "header_gzip" is specific to the gzip filter and is deprecated since it duplicates
  * "header_compressor_used".
+ *
+ * "shared_dictionary_used" is a number of responses compressed against a negotiated shared
+ * dictionary (RFC 9842), "shared_dictionary_stored" is a number of responses captured into the
+ * dictionary store.
  */
 #define RESPONSE_COMPRESSOR_STATS(COUNTER)                                                         \
   COUNTER(no_accept_header)                                                                        \
@@ -47,7 +58,9 @@ namespace Compressor {
   COUNTER(header_compressor_overshadowed)                                                          \
   COUNTER(header_wildcard)                                                                         \
   COUNTER(header_not_valid)                                                                        \
-  COUNTER(not_compressed_etag)
+  COUNTER(not_compressed_etag)                                                                     \
+  COUNTER(shared_dictionary_used)                                                                  \
+  COUNTER(shared_dictionary_stored)
 
 /**
  * Struct definitions for compressor stats. @see stats_macros.h
@@ -59,6 +72,30 @@ struct ResponseCompressorStats {
   RESPONSE_COMPRESSOR_STATS(GENERATE_COUNTER_STRUCT)
 };
 
+/**
+ * A small pool of threads dedicated to compression work. Work for a single stream is posted as
+ * one drain task at a time, so stateful compressors never see chunks out of order or
+ * concurrently. On destruction the pool finishes any queued work before joining its threads.
+ */
+class CompressionThreadPool {
+public:
+  CompressionThreadPool(Thread::ThreadFactory& thread_factory, uint32_t num_threads);
+  ~CompressionThreadPool();
+
+  void post(std::function<void()> work);
+
+private:
+  void workerLoop();
+  bool hasPendingWork() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+    return shutdown_ || !work_queue_.empty();
+  }
+
+  absl::Mutex mutex_;
+  std::deque<std::function<void()>> work_queue_ ABSL_GUARDED_BY(mutex_);
+  bool shutdown_ ABSL_GUARDED_BY(mutex_){};
+  std::vector<Thread::ThreadPtr> threads_;
+};
+
 /**
  * Configuration for the compressor filter.
  */
@@ -142,14 +179,32 @@ public:
   CompressorFilterConfig(
       const envoy::extensions::filters::http::compressor::v3::Compressor& proto_config,
       const std::string& stats_prefix, Stats::Scope& scope, Runtime::Loader& runtime,
-      Envoy::Compression::Compressor::CompressorFactoryPtr compressor_factory);
+      Envoy::Compression::Compressor::CompressorFactoryPtr compressor_factory,
+      Thread::ThreadFactory* thread_factory = nullptr);
+
+  // A response designated to serve as a shared compression dictionary.
+  struct DictionaryResource {
+    std::string path_prefix_;
+    std::string match_;
+  };
 
   Envoy::Compression::Compressor::CompressorPtr makeCompressor();
+  // Returns nullptr if the compressor library does not support per-stream dictionaries.
+  Envoy::Compression::Compressor::CompressorPtr
+  makeDictionaryCompressor(const std::string& dictionary);
 
   const std::string contentEncoding() const { return content_encoding_; };
   bool chooseFirst() const { return choose_first_; };
   const RequestDirectionConfig& requestDirectionConfig() { return request_direction_config_; }
   const ResponseDirectionConfig& responseDirectionConfig() { return response_direction_config_; }
+  // Non-null iff response compression is offloaded to a thread pool.
+  CompressionThreadPool* asyncPool() const { return compression_pool_.get(); }
+  uint64_t asyncHighWatermarkBytes() const { return async_high_watermark_bytes_; }
+  // Non-null iff shared dictionary negotiation is configured.
+  DictionaryStore* dictionaryStore() const { return dictionary_store_.get(); }
+  const std::vector<DictionaryResource>& dictionaryResources() const {
+    return dictionary_resources_;
+  }
 
 private:
   const std::string common_stats_prefix_;
@@ -159,6 +214,10 @@ private:
   const std::string content_encoding_;
   const Envoy::Compression::Compressor::CompressorFactoryPtr compressor_factory_;
   const bool choose_first_;
+  std::unique_ptr<CompressionThreadPool> compression_pool_;
+  uint64_t async_high_watermark_bytes_{};
+  DictionaryStoreSharedPtr dictionary_store_;
+  std::vector<DictionaryResource> dictionary_resources_;
 };
 using CompressorFilterConfigSharedPtr = std::shared_ptr<CompressorFilterConfig>;
 
@@ -197,7 +256,66 @@ public:
   Http::FilterDataStatus encodeData(Buffer::Instance& buffer, bool end_stream) override;
   Http::FilterTrailersStatus encodeTrailers(Http::ResponseTrailerMap&) override;
 
+  // Http::StreamFilterBase
+  void onDestroy() override;
+
 private:
+  // A body chunk handed to the compression pool and its result on the way back.
+  struct AsyncChunk {
+    Buffer::OwnedImpl data;
+    uint64_t uncompressed_bytes{};
+    // Tells the compression library that the stream is ended.
+    bool finish{};
+    // Whether the compressed output ends the encoded stream when injected.
+    bool end_stream{};
+  };
+  using AsyncChunkPtr = std::unique_ptr<AsyncChunk>;
+
+  // Per-stream state shared between the filter and the compression pool. The filter enqueues
+  // uncompressed chunks on the worker thread; pool threads compress them in order and post the
+  // results back to the worker dispatcher. The state outlives the filter when work is still in
+  // flight at stream destruction, so late results are dropped after detach().
+  class AsyncCompressionState : public std::enable_shared_from_this<AsyncCompressionState> {
+  public:
+    AsyncCompressionState(Envoy::Compression::Compressor::CompressorPtr compressor,
+                          CompressionThreadPool& pool, Event::Dispatcher& dispatcher,
+                          CompressorFilter& filter)
+        : compressor_(std::move(compressor)), pool_(pool), dispatcher_(dispatcher),
+          filter_(&filter) {}
+
+    // All three methods below run on the stream's worker thread.
+    void enqueue(Buffer::Instance& data, bool finish, bool end_stream);
+    void detach() { filter_ = nullptr; }
+    uint64_t pendingBytes() const { return pending_bytes_; }
+
+  private:
+    void drain();                            // Runs on a pool thread.
+    void onChunkCompressed(AsyncChunk& chunk); // Runs on the worker thread.
+
+    // Only touched by the single in-flight drain task, never concurrently.
+    const Envoy::Compression::Compressor::CompressorPtr compressor_;
+    CompressionThreadPool& pool_;
+    Event::Dispatcher& dispatcher_;
+    CompressorFilter* filter_;
+    uint64_t pending_bytes_{};
+    absl::Mutex mutex_;
+    std::deque<AsyncChunkPtr> chunks_ ABSL_GUARDED_BY(mutex_);
+    bool draining_ ABSL_GUARDED_BY(mutex_){};
+  };
+
+  void onAsyncChunkCompressed(AsyncChunk& chunk);
+  void updateAsyncWatermark();
+
+  // Engages RFC 9842 dictionary compression if the request negotiated a stored dictionary and
+  // the compressor library supports it. Returns true if the response will be compressed against
+  // the dictionary.
+  bool maybeStartDictionaryCompression(Http::ResponseHeaderMap& headers);
+  // Copies the identity response body into the dictionary store capture and finalizes the store
+  // entry once the body is complete.
+  void captureDictionaryData(const Buffer::Instance& data, bool end_stream);
+  bool acceptsEncoding(absl::string_view coding) const;
+
+
   bool compressionEnabled(const CompressorFilterConfig::ResponseDirectionConfig& config,
                           const CompressorPerRouteFilterConfig* per_route_config) const;
   bool removeAcceptEncodingHeader(const CompressorFilterConfig::ResponseDirectionConfig& config,
@@ -235,6 +353,17 @@ private:
   Envoy::Compression::Compressor::CompressorPtr request_compressor_;
   const CompressorFilterConfigSharedPtr config_;
   std::unique_ptr<std::string> accept_encoding_;
+  std::shared_ptr<AsyncCompressionState> async_state_;
+  bool above_async_watermark_{};
+  bool trailers_pending_{};
+  // Shared dictionary negotiation state. The match pattern points into the filter config.
+  const std::string* dictionary_match_{};
+  std::string negotiated_dictionary_digest_;
+  std::shared_ptr<const std::string> negotiated_dictionary_;
+  // Header bytes identifying the dictionary, emitted ahead of the first compressed chunk.
+  std::string dictionary_output_prefix_;
+  Buffer::OwnedImpl dictionary_capture_;
+  bool capturing_dictionary_{};
 };
 
 } // namespace Compressor
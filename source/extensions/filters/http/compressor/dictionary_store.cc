@@ -0,0 +1,36 @@
+#include "source/extensions/filters/http/compressor/dictionary_store.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace HttpFilters {
+namespace Compressor {
+
+void DictionaryStore::insert(std::string digest, std::string payload) {
+  if (payload.size() > max_bytes_) {
+    return;
+  }
+  absl::MutexLock lock(&mutex_);
+  if (entries_.contains(digest)) {
+    return;
+  }
+  while (!insertion_order_.empty() && stored_bytes_ + payload.size() > max_bytes_) {
+    const auto it = entries_.find(insertion_order_.front());
+    stored_bytes_ -= it->second->size();
+    entries_.erase(it);
+    insertion_order_.pop_front();
+  }
+  stored_bytes_ += payload.size();
+  insertion_order_.push_back(digest);
+  entries_.emplace(std::move(digest), std::make_shared<const std::string>(std::move(payload)));
+}
+
+std::shared_ptr<const std::string> DictionaryStore::find(absl::string_view digest) const {
+  absl::MutexLock lock(&mutex_);
+  const auto it = entries_.find(digest);
+  return it != entries_.end() ? it->second : nullptr;
+}
+
+} // namespace Compressor
+} // namespace HttpFilters
+} // namespace Extensions
+} // namespace Envoy
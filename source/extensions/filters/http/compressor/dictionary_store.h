@@ -0,0 +1,54 @@
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <string>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace HttpFilters {
+namespace Compressor {
+
+/**
+ * In-memory store of response payloads advertised as shared compression dictionaries
+ * (RFC 9842). Entries are keyed by the raw SHA-256 digest of the dictionary payload, which is
+ * what clients echo back in the Available-Dictionary request header. The store is shared by all
+ * workers; once the byte budget is exceeded insertions evict the oldest entries.
+ */
+class DictionaryStore {
+public:
+  explicit DictionaryStore(uint64_t max_bytes) : max_bytes_(max_bytes) {}
+
+  uint64_t maxBytes() const { return max_bytes_; }
+
+  /**
+   * Stores a dictionary payload under the raw SHA-256 digest of its content. Payloads larger
+   * than the store budget and digests already present are ignored.
+   */
+  void insert(std::string digest, std::string payload);
+
+  /**
+   * @return the payload stored under the given raw digest, or nullptr if there is none.
+   */
+  std::shared_ptr<const std::string> find(absl::string_view digest) const;
+
+private:
+  const uint64_t max_bytes_;
+  mutable absl::Mutex mutex_;
+  uint64_t stored_bytes_ ABSL_GUARDED_BY(mutex_){};
+  // Digests in insertion order, used for eviction.
+  std::deque<std::string> insertion_order_ ABSL_GUARDED_BY(mutex_);
+  absl::flat_hash_map<std::string, std::shared_ptr<const std::string>>
+      entries_ ABSL_GUARDED_BY(mutex_);
+};
+
+using DictionaryStoreSharedPtr = std::shared_ptr<DictionaryStore>;
+
+} // namespace Compressor
+} // namespace HttpFilters
+} // namespace Extensions
+} // namespace Envoy
@@ -25,6 +25,9 @@ using MetadataProto = ::envoy::config::core::v3::Metadata;
 using Filters::Common::MutationRules::CheckOperation;
 using Filters::Common::MutationRules::CheckResult;
 
+constexpr uint64_t DefaultDecisionCacheTtlMs = 10000;
+constexpr uint32_t DefaultDecisionCacheMaxEntries = 1024;
+
 void fillMetadataContext(const std::vector<const MetadataProto*>& source_metadata,
                          const std::vector<std::string>& metadata_context_namespaces,
                          const std::vector<std::string>& typed_metadata_context_namespaces,
@@ -160,6 +163,21 @@ FilterConfig::FilterConfig(const envoy::extensions::filters::http::ext_authz::v3
     disallowed_headers_matcher_ = Filters::Common::ExtAuthz::CheckRequestUtils::toRequestMatchers(
         config.disallowed_headers(), false, factory_context);
   }
+
+  if (config.has_decision_cache()) {
+    decision_cache_headers_.reserve(config.decision_cache().headers().size());
+    for (const auto& header : config.decision_cache().headers()) {
+      decision_cache_headers_.emplace_back(header);
+    }
+    decision_cache_ttl_ = std::chrono::milliseconds(
+        PROTOBUF_GET_MS_OR_DEFAULT(config.decision_cache(), ttl, DefaultDecisionCacheTtlMs));
+    decision_cache_max_entries_ = PROTOBUF_GET_WRAPPED_OR_DEFAULT(
+        config.decision_cache(), max_entries, DefaultDecisionCacheMaxEntries);
+    decision_cache_slot_ =
+        ThreadLocal::TypedSlot<DecisionCache>::makeUnique(factory_context.threadLocal());
+    decision_cache_slot_->set(
+        [](Event::Dispatcher&) { return std::make_shared<DecisionCache>(); });
+  }
 }
 
 void FilterConfigPerRoute::merge(const FilterConfigPerRoute& other) {
@@ -279,6 +297,23 @@ Http::FilterHeadersStatus Filter::decodeHeaders(Http::RequestHeaderMap& headers,
   }
 
   request_headers_ = &headers;
+
+  if (config_->decisionCacheEnabled()) {
+    decision_cache_key_ = decisionCacheKey(headers);
+    if (!decision_cache_key_.empty()) {
+      if (config_->decisionCache().lookup(
+              decision_cache_key_,
+              decoder_callbacks_->dispatcher().timeSource().monotonicTime())) {
+        ENVOY_STREAM_LOG(trace, "ext_authz filter is allowing the request from the decision cache",
+                         *decoder_callbacks_);
+        stats_.decision_cache_hit_.inc();
+        skip_check_ = true;
+        return Http::FilterHeadersStatus::Continue;
+      }
+      stats_.decision_cache_miss_.inc();
+    }
+  }
+
   const auto check_settings = per_route_flags.check_settings_;
   buffer_data_ = (config_->withRequestBody() || check_settings.has_with_request_body()) &&
                  !check_settings.disable_request_body_buffering() &&
@@ -499,6 +534,14 @@ void Filter::onComplete(Filters::Common::ExtAuthz::ResponsePtr&& response) {
 
   switch (response->status) {
   case CheckStatus::OK: {
+    // Only plain allows without any request/response mutations or dynamic metadata are stored in
+    // the decision cache, since mutations would be lost when a later request is served from it.
+    if (!decision_cache_key_.empty() && isCacheableDecision(*response)) {
+      const MonotonicTime now = decoder_callbacks_->dispatcher().timeSource().monotonicTime();
+      config_->decisionCache().store(decision_cache_key_, now + config_->decisionCacheTtl(), now,
+                                     config_->decisionCacheMaxEntries());
+    }
+
     // Any changes to request headers or query parameters can affect how the request is going to be
     // routed. If we are changing the headers we also need to clear the route
     // cache.
@@ -895,6 +938,39 @@ Filter::PerRouteFlags Filter::getPerRouteFlags(const Router::RouteConstSharedPtr
       envoy::extensions::filters::http::ext_authz::v3::CheckSettings() /*check_settings_*/};
 }
 
+std::string Filter::decisionCacheKey(const Http::RequestHeaderMap& headers) const {
+  bool has_configured_header = false;
+  // The key is the concatenation of the matched route name and the full values of the configured
+  // headers, so two requests share a cached decision only when every input the authorization
+  // decision was keyed on is identical. Absent headers contribute an empty segment to keep the key
+  // unambiguous.
+  const Router::RouteConstSharedPtr route = decoder_callbacks_->route();
+  std::string key = route != nullptr ? route->routeName() : EMPTY_STRING;
+  for (const auto& header : config_->decisionCacheHeaders()) {
+    key.push_back('\n');
+    const auto values = headers.get(header);
+    for (size_t i = 0; i < values.size(); ++i) {
+      if (i > 0) {
+        key.push_back(',');
+      }
+      absl::StrAppend(&key, values[i]->value().getStringView());
+      has_configured_header = true;
+    }
+  }
+  // Requests carrying none of the configured headers are never cached or served from the cache.
+  return has_configured_header ? key : EMPTY_STRING;
+}
+
+bool Filter::isCacheableDecision(const Filters::Common::ExtAuthz::Response& response) {
+  return response.headers_to_set.empty() && response.headers_to_add.empty() &&
+         response.headers_to_append.empty() && response.headers_to_remove.empty() &&
+         response.response_headers_to_add.empty() && response.response_headers_to_set.empty() &&
+         response.response_headers_to_add_if_absent.empty() &&
+         response.response_headers_to_overwrite_if_exists.empty() &&
+         response.query_parameters_to_set.empty() && response.query_parameters_to_remove.empty() &&
+         response.dynamic_metadata.fields().empty();
+}
+
 } // namespace ExtAuthz
 } // namespace HttpFilters
 } // namespace Extensions
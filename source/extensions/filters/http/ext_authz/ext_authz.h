@@ -1,16 +1,19 @@
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "envoy/common/time.h"
 #include "envoy/extensions/filters/http/ext_authz/v3/ext_authz.pb.h"
 #include "envoy/http/filter.h"
 #include "envoy/runtime/runtime.h"
 #include "envoy/service/auth/v3/external_auth.pb.h"
 #include "envoy/stats/scope.h"
 #include "envoy/stats/stats_macros.h"
+#include "envoy/thread_local/thread_local.h"
 #include "envoy/upstream/cluster_manager.h"
 
 #include "source/common/common/assert.h"
@@ -26,6 +29,8 @@
 #include "source/extensions/filters/common/ext_authz/ext_authz_http_impl.h"
 #include "source/extensions/filters/common/mutation_rules/mutation_rules.h"
 
+#include "absl/container/flat_hash_map.h"
+
 namespace Envoy {
 namespace Extensions {
 namespace HttpFilters {
@@ -43,7 +48,9 @@ namespace ExtAuthz {
   COUNTER(failure_mode_allowed)                                                                    \
   COUNTER(invalid)                                                                                 \
   COUNTER(ignored_dynamic_metadata)                                                                \
-  COUNTER(filter_state_name_collision)
+  COUNTER(filter_state_name_collision)                                                             \
+  COUNTER(decision_cache_hit)                                                                      \
+  COUNTER(decision_cache_miss)
 
 /**
  * Wrapper struct for ext_authz filter stats. @see stats_macros.h
@@ -91,6 +98,55 @@ private:
   Upstream::HostDescriptionConstSharedPtr upstream_host_;
 };
 
+/**
+ * Per-worker store of recently allowed check decisions, keyed by the values of the configured
+ * request headers plus the name of the matched route. Entries expire after the configured TTL and
+ * are evicted lazily on lookup and insertion. Full keys are stored rather than their hashes so a
+ * crafted credential cannot collide with a cached approval.
+ */
+class DecisionCache : public ThreadLocal::ThreadLocalObject {
+public:
+  /**
+   * @return whether an unexpired allowed decision exists for the key. Expired entries found along
+   * the way are removed.
+   */
+  bool lookup(const std::string& key, MonotonicTime now) {
+    auto entry = entries_.find(key);
+    if (entry == entries_.end()) {
+      return false;
+    }
+    if (entry->second <= now) {
+      entries_.erase(entry);
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * Stores an allowed decision valid until the given expiry. When the cache is full, expired
+   * entries are evicted first; if it remains full the decision is not stored.
+   */
+  void store(const std::string& key, MonotonicTime expiry, MonotonicTime now,
+             uint32_t max_entries) {
+    if (entries_.size() >= max_entries && !entries_.contains(key)) {
+      for (auto it = entries_.begin(); it != entries_.end();) {
+        if (it->second <= now) {
+          entries_.erase(it++);
+        } else {
+          ++it;
+        }
+      }
+      if (entries_.size() >= max_entries) {
+        return;
+      }
+    }
+    entries_[key] = expiry;
+  }
+
+private:
+  absl::flat_hash_map<std::string, MonotonicTime> entries_;
+};
+
 /**
  * Configuration for the External Authorization (ext_authz) filter.
  */
@@ -193,6 +249,18 @@ public:
     return disallowed_headers_matcher_;
   }
 
+  bool decisionCacheEnabled() const { return decision_cache_slot_ != nullptr; }
+
+  const std::vector<Http::LowerCaseString>& decisionCacheHeaders() const {
+    return decision_cache_headers_;
+  }
+
+  std::chrono::milliseconds decisionCacheTtl() const { return decision_cache_ttl_; }
+
+  uint32_t decisionCacheMaxEntries() const { return decision_cache_max_entries_; }
+
+  DecisionCache& decisionCache() { return **decision_cache_slot_; }
+
 private:
   static Http::Code toErrorCode(uint64_t status) {
     const auto code = static_cast<Http::Code>(status);
@@ -258,6 +326,12 @@ private:
   Filters::Common::ExtAuthz::MatcherSharedPtr allowed_headers_matcher_;
   Filters::Common::ExtAuthz::MatcherSharedPtr disallowed_headers_matcher_;
 
+  std::vector<Http::LowerCaseString> decision_cache_headers_;
+  std::chrono::milliseconds decision_cache_ttl_{};
+  uint32_t decision_cache_max_entries_{};
+  // Null when the decision cache is not configured.
+  ThreadLocal::TypedSlotPtr<DecisionCache> decision_cache_slot_;
+
 public:
   // TODO(nezdolik): deprecate cluster scope stats counters in favor of filter scope stats
   // (ExtAuthzFilterStats stats_).
@@ -378,6 +452,13 @@ private:
   };
   PerRouteFlags getPerRouteFlags(const Router::RouteConstSharedPtr& route) const;
 
+  // Builds the decision cache key for the request, or an empty string when the request carries none
+  // of the configured headers and must not be cached.
+  std::string decisionCacheKey(const Http::RequestHeaderMap& headers) const;
+
+  // @return whether the response is a plain allow that is safe to serve from the decision cache.
+  static bool isCacheableDecision(const Filters::Common::ExtAuthz::Response& response);
+
   // State of this filter's communication with the external authorization service.
   // The filter has either not started calling the external service, in the middle of calling
   // it or has completed.
@@ -413,6 +494,9 @@ private:
   bool initiating_call_{};
   bool buffer_data_{};
   bool skip_check_{false};
+  // Non-empty when the decision cache is enabled and the request is eligible for caching; reused
+  // to store the decision when the check completes.
+  std::string decision_cache_key_;
   envoy::service::auth::v3::CheckRequest check_request_{};
 };
 
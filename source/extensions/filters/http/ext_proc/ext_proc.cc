@@ -1038,10 +1038,19 @@ void Filter::onNewTimeout(const ProtobufWkt::Duration& override_message_timeout)
 }
 
 void Filter::addDynamicMetadata(const ProcessorState& state, ProcessingRequest& req) {
+  if (state.untypedForwardingMetadataNamespaces().empty() &&
+      state.typedForwardingMetadataNamespaces().empty()) {
+    // No forwarding namespaces are configured; skip building a metadata context
+    // rather than attaching an empty one to every message on the stream.
+    return;
+  }
+
   // get the callbacks from the ProcessorState. This will be the appropriate
   // callbacks for the current state of the filter
   auto* cb = state.callbacks();
-  envoy::config::core::v3::Metadata forwarding_metadata;
+  // Build the context directly into the request to avoid copying the matched
+  // metadata a second time, once per message sent on the stream.
+  envoy::config::core::v3::Metadata& forwarding_metadata = *req.mutable_metadata_context();
 
   // If metadata_context_namespaces is specified, pass matching filter metadata to the ext_proc
   // service. If metadata key is set in both the connection and request metadata then the value
@@ -1083,8 +1092,6 @@ void Filter::addDynamicMetadata(const ProcessorState& state, ProcessingRequest&
       }
     }
   }
-
-  *req.mutable_metadata_context() = forwarding_metadata;
 }
 
 void Filter::addAttributes(ProcessorState& state, ProcessingRequest& req) {
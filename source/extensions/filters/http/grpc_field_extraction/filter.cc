@@ -109,10 +109,9 @@ Envoy::Http::FilterHeadersStatus Filter::decodeHeaders(Envoy::Http::RequestHeade
   }
 
   extractor_ = extractor;
-  auto cord_message_data_factory = std::make_unique<CreateMessageDataFunc>(
-      []() { return std::make_unique<Protobuf::field_extraction::CordMessageData>(); });
   request_msg_converter_ = std::make_unique<MessageConverter>(
-      std::move(cord_message_data_factory), decoder_callbacks_->decoderBufferLimit());
+      []() { return std::make_unique<Protobuf::field_extraction::CordMessageData>(); },
+      decoder_callbacks_->decoderBufferLimit());
 
   return Envoy::Http::FilterHeadersStatus::StopIteration;
 }
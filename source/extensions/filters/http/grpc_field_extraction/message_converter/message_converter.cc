@@ -18,8 +18,7 @@ namespace {
 using Envoy::Protobuf::io::ZeroCopyInputStream;
 } // namespace
 
-MessageConverter::MessageConverter(std::unique_ptr<CreateMessageDataFunc> factory,
-                                   uint32_t buffer_limit)
+MessageConverter::MessageConverter(CreateMessageDataFunc factory, uint32_t buffer_limit)
     : factory_(std::move(factory)), buffer_limit_(buffer_limit),
       parsed_bytes_usage_(std::make_shared<uint64_t>(0)) {}
 
@@ -34,7 +33,7 @@ absl::StatusOr<StreamMessagePtr> MessageConverter::accumulateMessage(Envoy::Buff
     return absl::FailedPreconditionError("Rejected because internal buffer limits are exceeded.");
   }
 
-  absl::StatusOr<ParsedGrpcMessage> parsed_output = parseGrpcMessage(*factory_, parsing_buffer_);
+  absl::StatusOr<ParsedGrpcMessage> parsed_output = parseGrpcMessage(factory_, parsing_buffer_);
   if (!parsed_output.ok()) {
     return parsed_output.status();
   }
@@ -36,10 +36,10 @@ namespace GrpcFieldExtraction {
 
 class MessageConverter {
 public:
-  explicit MessageConverter(std::unique_ptr<CreateMessageDataFunc> factory)
+  explicit MessageConverter(CreateMessageDataFunc factory)
       : MessageConverter(std::move(factory), std::numeric_limits<uint32_t>::max()) {}
 
-  MessageConverter(std::unique_ptr<CreateMessageDataFunc> factory, uint32_t buffer_limit);
+  MessageConverter(CreateMessageDataFunc factory, uint32_t buffer_limit);
 
   // MessageConverter is neither copyable nor movable.
   MessageConverter(const MessageConverter&) = delete;
@@ -88,7 +88,7 @@ public:
   [[nodiscard]] uint64_t bytesBuffered() const;
 
 private:
-  std::unique_ptr<CreateMessageDataFunc> factory_;
+  CreateMessageDataFunc factory_;
   // Internal buffer to move data to before parsing. Useful to wait until
   // Envoy passes us enough gRPC frame data.
   Envoy::Buffer::OwnedImpl parsing_buffer_;
@@ -319,6 +319,14 @@ Status JsonTranscoderConfig::createMethodInfo(const Protobuf::MethodDescriptor*
                 descriptor->full_name()};
   }
 
+  // Cache the per-method type information and outgoing path up front so that per-request
+  // transcoder creation only has to copy them.
+  method_info->request_type_ = type_helper_->Info()->GetTypeByTypeUrl(
+      Grpc::Common::typeUrl(descriptor->input_type()->full_name()));
+  method_info->response_type_url_ = Grpc::Common::typeUrl(descriptor->output_type()->full_name());
+  method_info->grpc_path_ =
+      absl::StrCat("/", descriptor->service()->full_name(), "/", descriptor->name());
+
   return {};
 }
 
@@ -400,11 +408,9 @@ absl::Status JsonTranscoderConfig::createTranscoder(
         method_info->descriptor_->client_streaming(), true);
   }
 
-  const auto response_type_url =
-      Grpc::Common::typeUrl(method_info->descriptor_->output_type()->full_name());
   ResponseToJsonTranslatorPtr response_translator{new ResponseToJsonTranslator(
-      type_helper_->Resolver(), response_type_url, method_info->descriptor_->server_streaming(),
-      &response_input, response_translate_options_)};
+      type_helper_->Resolver(), method_info->response_type_url_,
+      method_info->descriptor_->server_streaming(), &response_input, response_translate_options_)};
 
   transcoder = std::make_unique<TranscoderImpl>(std::move(request_translator),
                                                 std::move(json_request_translator),
@@ -415,10 +421,9 @@ absl::Status JsonTranscoderConfig::createTranscoder(
 absl::Status
 JsonTranscoderConfig::methodToRequestInfo(const MethodInfoSharedPtr& method_info,
                                           google::grpc::transcoding::RequestInfo* info) const {
-  const std::string& request_type_full_name = method_info->descriptor_->input_type()->full_name();
-  auto request_type_url = Grpc::Common::typeUrl(request_type_full_name);
-  info->message_type = type_helper_->Info()->GetTypeByTypeUrl(request_type_url);
+  info->message_type = method_info->request_type_;
   if (info->message_type == nullptr) {
+    const std::string& request_type_full_name = method_info->descriptor_->input_type()->full_name();
     ENVOY_LOG(debug, "Cannot resolve input-type: {}", request_type_full_name);
     return {StatusCode::kNotFound, "Could not resolve type: " + request_type_full_name};
   }
@@ -548,8 +553,7 @@ Http::FilterHeadersStatus JsonTranscoderFilter::decodeHeaders(Http::RequestHeade
   headers.setReferenceContentType(Http::Headers::get().ContentTypeValues.Grpc);
   headers.setEnvoyOriginalPath(headers.getPathValue());
   headers.addReferenceKey(Http::Headers::get().EnvoyOriginalMethod, headers.getMethodValue());
-  headers.setPath("/" + method_->descriptor_->service()->full_name() + "/" +
-                  method_->descriptor_->name());
+  headers.setPath(method_->grpc_path_);
   headers.setReferenceMethod(Http::Headers::get().MethodValues.Post);
   headers.setReferenceTE(Http::Headers::get().TEValues.Trailers);
 
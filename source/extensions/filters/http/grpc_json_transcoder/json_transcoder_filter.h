@@ -31,6 +31,11 @@ struct MethodInfo {
   std::vector<const ProtobufWkt::Field*> response_body_field_path;
   bool request_type_is_http_body_ = false;
   bool response_type_is_http_body_ = false;
+  // Resolved once at config load so per-request transcoder creation does not need to walk the
+  // type information again or rebuild the type URL and gRPC path strings.
+  const ProtobufWkt::Type* request_type_ = nullptr;
+  std::string response_type_url_;
+  std::string grpc_path_;
 };
 using MethodInfoSharedPtr = std::shared_ptr<MethodInfo>;
 
@@ -220,7 +220,7 @@ void HeaderToMetadataFilter::applyKeyValue(std::string&& value, const Rule& rule
   }
   if (!value.empty()) {
     const auto& nspace = decideNamespace(keyval.metadata_namespace());
-    addMetadata(np, nspace, keyval.key(), value, keyval.type(), keyval.encode());
+    addMetadata(np, nspace, keyval.key(), std::move(value), keyval.type(), keyval.encode());
   } else {
     ENVOY_LOG(debug, "value is empty, not adding metadata");
   }
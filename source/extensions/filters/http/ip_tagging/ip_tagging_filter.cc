@@ -49,7 +49,7 @@ IpTaggingFilterConfig::IpTaggingFilterConfig(
       }
     }
 
-    tag_data.emplace_back(ip_tag.ip_tag_name(), cidr_set);
+    tag_data.emplace_back(ip_tag.ip_tag_name(), std::move(cidr_set));
     stat_name_set_->rememberBuiltin(absl::StrCat(ip_tag.ip_tag_name(), ".hit"));
   }
   trie_ = std::make_unique<Network::LcTrie::LcTrie<std::string>>(tag_data);
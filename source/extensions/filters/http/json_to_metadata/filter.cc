@@ -166,12 +166,12 @@ bool FilterConfig::responseContentTypeAllowed(absl::string_view content_type) co
           response_allow_content_types_regex_->match(content_type));
 }
 
-void Filter::applyKeyValue(const std::string& value, const KeyValuePair& keyval,
-                           StructMap& struct_map, Http::StreamFilterCallbacks& filter_callback) {
+void Filter::applyKeyValue(std::string value, const KeyValuePair& keyval, StructMap& struct_map,
+                           Http::StreamFilterCallbacks& filter_callback) {
   ASSERT(!value.empty());
 
   ProtobufWkt::Value val;
-  val.set_string_value(value);
+  val.set_string_value(std::move(value));
   applyKeyValue(std::move(val), keyval, struct_map, filter_callback);
 }
 
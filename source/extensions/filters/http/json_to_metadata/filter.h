@@ -135,7 +135,7 @@ private:
   bool addMetadata(const std::string& meta_namespace, const std::string& key,
                    ProtobufWkt::Value val, const bool preserve_existing_metadata_value,
                    StructMap& struct_map, Http::StreamFilterCallbacks& filter_callback);
-  void applyKeyValue(const std::string& value, const KeyValuePair& keyval, StructMap& struct_map,
+  void applyKeyValue(std::string value, const KeyValuePair& keyval, StructMap& struct_map,
                      Http::StreamFilterCallbacks& filter_callback);
   void applyKeyValue(double value, const KeyValuePair& keyval, StructMap& struct_map,
                      Http::StreamFilterCallbacks& filter_callback);
@@ -222,6 +222,22 @@ void AuthenticatorImpl::startVerify() {
     return;
   }
 
+  // The JWT cache is held per provider, so on the issuer path the lookup can only happen once the
+  // provider has been resolved from the parsed token. A hit means this exact token already passed
+  // signature verification against this provider's JWKS; the claim checks below are still applied
+  // since they depend on the current time and the requirement being verified.
+  if (!provider_) {
+    ::google::jwt_verify::Jwt* cached_jwt = jwks_data_->getJwtCache().lookup(curr_token_->token());
+    if (cached_jwt != nullptr) {
+      jwks_cache_.stats().jwt_cache_hit_.inc();
+      jwt_ = cached_jwt;
+      owned_jwt_.reset();
+      use_jwt_cache = true;
+    } else {
+      jwks_cache_.stats().jwt_cache_miss_.inc();
+    }
+  }
+
   // Default is 60 seconds
   uint64_t clock_skew_seconds = ::google::jwt_verify::kClockSkewInSecond;
   if (jwks_data_->getJwtProvider().clock_skew_seconds() > 0) {
@@ -415,7 +431,7 @@ void AuthenticatorImpl::handleGoodJwt(bool cache_hit) {
       setPayloadMetadata(jwt_->payload_pb_);
     }
   }
-  if (provider_ && !cache_hit) {
+  if (!cache_hit) {
     // move the ownership of "owned_jwt_" into the function.
     jwks_data_->getJwtCache().insert(curr_token_->token(), std::move(owned_jwt_));
   }
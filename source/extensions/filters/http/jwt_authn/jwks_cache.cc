@@ -78,8 +78,14 @@ public:
 
     bool enable_jwt_cache = jwt_provider_.has_jwt_cache_config();
     const auto& config = jwt_provider_.jwt_cache_config();
-    tls_.set([enable_jwt_cache, config](Envoy::Event::Dispatcher& dispatcher) {
-      return std::make_shared<ThreadLocalCache>(enable_jwt_cache, config, dispatcher.timeSource());
+    // Evict cached JWTs with the same clock skew tolerance the authenticator applies when
+    // verifying time constraints.
+    const uint64_t clock_skew_seconds = jwt_provider_.clock_skew_seconds() > 0
+                                            ? jwt_provider_.clock_skew_seconds()
+                                            : ::google::jwt_verify::kClockSkewInSecond;
+    tls_.set([enable_jwt_cache, config, clock_skew_seconds](Envoy::Event::Dispatcher& dispatcher) {
+      return std::make_shared<ThreadLocalCache>(enable_jwt_cache, config, clock_skew_seconds,
+                                                dispatcher.timeSource());
     });
 
     const auto inline_jwks =
@@ -159,8 +165,9 @@ private:
   struct ThreadLocalCache : public ThreadLocal::ThreadLocalObject {
     ThreadLocalCache(bool enable_jwt_cache,
                      const envoy::extensions::filters::http::jwt_authn::v3::JwtCacheConfig& config,
-                     TimeSource& time_source)
-        : jwt_cache_(JwtCache::create(enable_jwt_cache, config, time_source)) {}
+                     uint64_t clock_skew_seconds, TimeSource& time_source)
+        : jwt_cache_(JwtCache::create(enable_jwt_cache, config, clock_skew_seconds, time_source)) {
+    }
 
     // The jwks object.
     JwksConstSharedPtr jwks_;
@@ -19,8 +19,9 @@ constexpr int kMaxJwtSizeForCache = 4 * 1024; // 4KiB
 
 class JwtCacheImpl : public JwtCache {
 public:
-  JwtCacheImpl(bool enable_cache, const JwtCacheConfig& config, TimeSource& time_source)
-      : time_source_(time_source) {
+  JwtCacheImpl(bool enable_cache, const JwtCacheConfig& config, uint64_t clock_skew_seconds,
+               TimeSource& time_source)
+      : clock_skew_seconds_(clock_skew_seconds), time_source_(time_source) {
     if (enable_cache) {
       // if cache_size is 0, it is not specified in the config, use default
       auto cache_size =
@@ -45,7 +46,8 @@ public:
     if (lookup.found()) {
       ::google::jwt_verify::Jwt* const found_jwt = lookup.value();
       ASSERT(found_jwt != nullptr);
-      if (found_jwt->verifyTimeConstraint(DateUtil::nowToSeconds(time_source_)) !=
+      if (found_jwt->verifyTimeConstraint(DateUtil::nowToSeconds(time_source_),
+                                          clock_skew_seconds_) !=
           ::google::jwt_verify::Status::JwtExpired) {
         return found_jwt;
       } else {
@@ -64,13 +66,14 @@ public:
 
 private:
   std::unique_ptr<SimpleLRUCache<std::string, ::google::jwt_verify::Jwt>> jwt_lru_cache_;
+  const uint64_t clock_skew_seconds_;
   TimeSource& time_source_;
 };
 } // namespace
 
 JwtCachePtr JwtCache::create(bool enable_cache, const JwtCacheConfig& config,
-                             TimeSource& time_source) {
-  return std::make_unique<JwtCacheImpl>(enable_cache, config, time_source);
+                             uint64_t clock_skew_seconds, TimeSource& time_source) {
+  return std::make_unique<JwtCacheImpl>(enable_cache, config, clock_skew_seconds, time_source);
 }
 
 } // namespace JwtAuthn
@@ -35,9 +35,11 @@ public:
   virtual void insert(const std::string& token,
                       std::unique_ptr<::google::jwt_verify::Jwt>&& jwt) PURE;
 
-  // JwtCache factory function.
+  // JwtCache factory function. `clock_skew_seconds` is the provider's clock skew tolerance; a
+  // cached JWT is evicted only once it is expired beyond that skew, matching the time constraint
+  // check applied by the authenticator.
   static JwtCachePtr create(bool enable_cache, const JwtCacheConfig& config,
-                            TimeSource& time_source);
+                            uint64_t clock_skew_seconds, TimeSource& time_source);
 };
 
 } // namespace JwtAuthn
@@ -45,7 +45,6 @@ namespace HttpFilters {
 namespace ProtoMessageExtraction {
 namespace {
 
-using ::Envoy::Extensions::HttpFilters::GrpcFieldExtraction::CreateMessageDataFunc;
 using ::Envoy::Extensions::HttpFilters::GrpcFieldExtraction::MessageConverter;
 using ::Envoy::Extensions::HttpFilters::GrpcFieldExtraction::StreamMessage;
 using ::Envoy::Grpc::Status;
@@ -146,11 +145,9 @@ Envoy::Http::FilterHeadersStatus Filter::decodeHeaders(Envoy::Http::RequestHeade
 
   // Cast away const for necessary modifications in a controlled context.
   extractor_ = const_cast<Extractor*>(extractor);
-  auto cord_message_data_factory = std::make_unique<CreateMessageDataFunc>(
-      []() { return std::make_unique<Protobuf::field_extraction::CordMessageData>(); });
-
   request_msg_converter_ = std::make_unique<MessageConverter>(
-      std::move(cord_message_data_factory), decoder_callbacks_->decoderBufferLimit());
+      []() { return std::make_unique<Protobuf::field_extraction::CordMessageData>(); },
+      decoder_callbacks_->decoderBufferLimit());
 
   return Envoy::Http::FilterHeadersStatus::StopIteration;
 }
@@ -263,11 +260,9 @@ Envoy::Http::FilterHeadersStatus Filter::encodeHeaders(Envoy::Http::ResponseHead
   }
 
   // Create response_msg_converter to convert response body.
-  auto cord_message_data_factory = std::make_unique<CreateMessageDataFunc>(
-      []() { return std::make_unique<Protobuf::field_extraction::CordMessageData>(); });
-
   response_msg_converter_ = std::make_unique<MessageConverter>(
-      std::move(cord_message_data_factory), encoder_callbacks_->encoderBufferLimit());
+      []() { return std::make_unique<Protobuf::field_extraction::CordMessageData>(); },
+      encoder_callbacks_->encoderBufferLimit());
 
   return Http::FilterHeadersStatus::StopIteration;
 }
@@ -53,14 +53,15 @@ Http::FilterHeadersStatus RateLimitQuotaFilter::decodeHeaders(Http::RequestHeade
 
   callbacks_->streamInfo().setDynamicMetadata(kBucketMetadataNamespace, bucket_log);
 
-  if (quota_buckets_.find(bucket_id) == quota_buckets_.end()) {
+  auto bucket_it = quota_buckets_.find(bucket_id);
+  if (bucket_it == quota_buckets_.end()) {
     // For first matched request, create a new bucket in the cache and sent the report to RLQS
     // server immediately.
-    createNewBucket(bucket_id_proto, match_action, bucket_id);
-    return sendImmediateReport(bucket_id, match_action);
+    Bucket& new_bucket = createNewBucket(bucket_id_proto, match_action, bucket_id);
+    return sendImmediateReport(bucket_id, new_bucket, match_action);
   }
 
-  return processCachedBucket(bucket_id, match_action);
+  return processCachedBucket(bucket_id, *bucket_it->second, match_action);
 }
 
 void RateLimitQuotaFilter::createMatcher() {
@@ -120,8 +121,9 @@ void RateLimitQuotaFilter::onDestroy() {
   // TODO(tyxia) TLS resource are not cleaned here.
 }
 
-void RateLimitQuotaFilter::createNewBucket(const BucketId& bucket_id,
-                                           const RateLimitOnMatchAction& match_action, size_t id) {
+Bucket& RateLimitQuotaFilter::createNewBucket(const BucketId& bucket_id,
+                                              const RateLimitOnMatchAction& match_action,
+                                              size_t id) {
   // Create new bucket and store it into quota cache.
   std::unique_ptr<Bucket> new_bucket = std::make_unique<Bucket>();
 
@@ -160,13 +162,15 @@ void RateLimitQuotaFilter::createNewBucket(const BucketId& bucket_id,
   }
 
   new_bucket->quota_usage = quota_usage;
+  Bucket& bucket_ref = *new_bucket;
   quota_buckets_[id] = std::move(new_bucket);
+  return bucket_ref;
 }
 
 // This function should not update QuotaUsage as that will have been handled
 // when constructing the Report before this function is called.
 Http::FilterHeadersStatus
-RateLimitQuotaFilter::sendImmediateReport(const size_t bucket_id,
+RateLimitQuotaFilter::sendImmediateReport(const size_t bucket_id, Bucket& bucket,
                                           const RateLimitOnMatchAction& match_action) {
   const auto& bucket_settings = match_action.bucketSettings();
 
@@ -206,26 +210,18 @@ RateLimitQuotaFilter::sendImmediateReport(const size_t bucket_id,
   // The rate limit strategy for the first matched request(i.e., its request header is matched with
   // bucket_matchers for the first time) should be already set based on no assignment behavior in
   // `createNewBucket` when the bucket is initially created.
-  ASSERT(quota_buckets_.find(bucket_id) != quota_buckets_.end());
   // If not given a default blanket rule, the first matched request is allowed.
-  if (!quota_buckets_[bucket_id]->default_action.has_quota_assignment_action() ||
-      !quota_buckets_[bucket_id]
-           ->default_action.quota_assignment_action()
-           .has_rate_limit_strategy() ||
-      !quota_buckets_[bucket_id]
-           ->default_action.quota_assignment_action()
-           .rate_limit_strategy()
-           .has_blanket_rule()) {
+  if (!bucket.default_action.has_quota_assignment_action() ||
+      !bucket.default_action.quota_assignment_action().has_rate_limit_strategy() ||
+      !bucket.default_action.quota_assignment_action().rate_limit_strategy().has_blanket_rule()) {
     ENVOY_LOG(trace, "Without a default blanket rule configured, the first matched "
                      "request with hashed bucket_id {} is allowed through.");
     ENVOY_LOG(debug, "Default action for bucket_id {} does not contain a blanket action: {}",
-              bucket_id, quota_buckets_[bucket_id]->default_action.DebugString());
+              bucket_id, bucket.default_action.DebugString());
     return sendAllowResponse();
   }
-  auto blanket_rule = quota_buckets_[bucket_id]
-                          ->default_action.quota_assignment_action()
-                          .rate_limit_strategy()
-                          .blanket_rule();
+  auto blanket_rule =
+      bucket.default_action.quota_assignment_action().rate_limit_strategy().blanket_rule();
   if (blanket_rule == RateLimitStrategy::DENY_ALL) {
     // For the request that is rejected due to DENY_ALL
     // no_assignment_behavior, immediate report is still sent to RLQS server
@@ -247,7 +243,7 @@ RateLimitQuotaFilter::sendImmediateReport(const size_t bucket_id,
 }
 
 Http::FilterHeadersStatus
-RateLimitQuotaFilter::setUsageAndResponseFromAction(const BucketAction& action,
+RateLimitQuotaFilter::setUsageAndResponseFromAction(const BucketAction& action, Bucket& bucket,
                                                     const size_t bucket_id) {
   if (!action.has_quota_assignment_action() ||
       !action.quota_assignment_action().has_rate_limit_strategy()) {
@@ -255,7 +251,7 @@ RateLimitQuotaFilter::setUsageAndResponseFromAction(const BucketAction& action,
               "Selected bucket action defaulting to ALLOW_ALL as it does not "
               "have an assignment for bucket_id {}",
               bucket_id);
-    return sendAllowResponse(&quota_buckets_[bucket_id]->quota_usage);
+    return sendAllowResponse(&bucket.quota_usage);
   }
 
   // TODO(tyxia) Currently, blanket rule and token bucket strategies are
@@ -267,13 +263,13 @@ RateLimitQuotaFilter::setUsageAndResponseFromAction(const BucketAction& action,
     ENVOY_LOG(trace, "Request with hashed bucket_id {} is {} by the selected blanket rule.",
               bucket_id, allow ? "allowed" : "denied");
     if (allow) {
-      return sendAllowResponse(&quota_buckets_[bucket_id]->quota_usage);
+      return sendAllowResponse(&bucket.quota_usage);
     }
-    return sendDenyResponse(&quota_buckets_[bucket_id]->quota_usage);
+    return sendDenyResponse(&bucket.quota_usage);
   }
 
   if (rate_limit_strategy.has_token_bucket()) {
-    auto token_bucket = quota_buckets_[bucket_id]->token_bucket_limiter.get();
+    auto token_bucket = bucket.token_bucket_limiter.get();
     ASSERT(token_bucket);
 
     // Try to consume 1 token from the bucket.
@@ -287,7 +283,7 @@ RateLimitQuotaFilter::setUsageAndResponseFromAction(const BucketAction& action,
                 "Allowing request as token bucket is not empty for bucket_id "
                 "{}. Initial assignment: {}.",
                 bucket_id, rate_limit_strategy.token_bucket().ShortDebugString());
-      return sendAllowResponse(&quota_buckets_[bucket_id]->quota_usage);
+      return sendAllowResponse(&bucket.quota_usage);
     }
     // Request is throttled.
     ENVOY_LOG(trace,
@@ -298,14 +294,14 @@ RateLimitQuotaFilter::setUsageAndResponseFromAction(const BucketAction& action,
               "Denying request as token bucket is exhausted for bucket_id {}. "
               "Initial assignment: {}.",
               bucket_id, rate_limit_strategy.token_bucket().ShortDebugString());
-    return sendDenyResponse(&quota_buckets_[bucket_id]->quota_usage);
+    return sendDenyResponse(&bucket.quota_usage);
   }
 
   ENVOY_LOG(error,
             "Failing open as selected bucket action for bucket_id {} contains "
             "an unsupported rate limit strategy: {}",
             bucket_id, rate_limit_strategy.DebugString());
-  return sendAllowResponse(&quota_buckets_[bucket_id]->quota_usage);
+  return sendAllowResponse(&bucket.quota_usage);
 }
 
 bool isCachedActionExpired(TimeSource& time_source, const Bucket& bucket) {
@@ -322,39 +318,36 @@ bool isCachedActionExpired(TimeSource& time_source, const Bucket& bucket) {
 }
 
 Http::FilterHeadersStatus
-RateLimitQuotaFilter::processCachedBucket(size_t bucket_id,
+RateLimitQuotaFilter::processCachedBucket(size_t bucket_id, Bucket& cached_bucket,
                                           const RateLimitOnMatchAction& match_action) {
-  auto* cached_bucket = quota_buckets_[bucket_id].get();
-
   // If no cached action, use the default action.
-  if (!cached_bucket->cached_action.has_value()) {
-    return setUsageAndResponseFromAction(cached_bucket->default_action, bucket_id);
+  if (!cached_bucket.cached_action.has_value()) {
+    return setUsageAndResponseFromAction(cached_bucket.default_action, cached_bucket, bucket_id);
   }
 
   // If expired, remove the expired action & fallback.
-  if (isCachedActionExpired(time_source_, *cached_bucket)) {
-    Http::FilterHeadersStatus ret_status = processExpiredBucket(bucket_id, match_action);
-    cached_bucket->cached_action = std::nullopt;
+  if (isCachedActionExpired(time_source_, cached_bucket)) {
+    Http::FilterHeadersStatus ret_status =
+        processExpiredBucket(bucket_id, cached_bucket, match_action);
+    cached_bucket.cached_action = std::nullopt;
     return ret_status;
   }
 
   // If not expired, use the cached action.
-  return setUsageAndResponseFromAction(*cached_bucket->cached_action, bucket_id);
+  return setUsageAndResponseFromAction(*cached_bucket.cached_action, cached_bucket, bucket_id);
 }
 
 // Note: does not remove the expired entity from the cache.
 Http::FilterHeadersStatus
-RateLimitQuotaFilter::processExpiredBucket(size_t bucket_id,
+RateLimitQuotaFilter::processExpiredBucket(size_t bucket_id, Bucket& cached_bucket,
                                            const RateLimitOnMatchAction& match_action) {
-  auto* cached_bucket = quota_buckets_[bucket_id].get();
-
   if (!match_action.bucketSettings().has_expired_assignment_behavior() ||
       !match_action.bucketSettings().expired_assignment_behavior().has_fallback_rate_limit()) {
     ENVOY_LOG(debug,
               "Selecting default action for bucket_id as expiration "
               "fallback assignment doesn't have a configured override {}",
               match_action.bucketSettings().expired_assignment_behavior().DebugString());
-    return setUsageAndResponseFromAction(cached_bucket->default_action, bucket_id);
+    return setUsageAndResponseFromAction(cached_bucket.default_action, cached_bucket, bucket_id);
   }
 
   const RateLimitStrategy& fallback_rate_limit =
@@ -365,14 +358,14 @@ RateLimitQuotaFilter::processExpiredBucket(size_t bucket_id,
               "Exipred action falling back to configured DENY_ALL for "
               "bucket_id {}",
               bucket_id);
-    return sendDenyResponse(&cached_bucket->quota_usage);
+    return sendDenyResponse(&cached_bucket.quota_usage);
   }
 
   ENVOY_LOG(debug,
             "Exipred action falling back to ALLOW_ALL for bucket_id {} with "
             "fallback action {}",
             bucket_id, fallback_rate_limit.DebugString());
-  return sendAllowResponse(&cached_bucket->quota_usage);
+  return sendAllowResponse(&cached_bucket.quota_usage);
 }
 
 } // namespace RateLimitQuota
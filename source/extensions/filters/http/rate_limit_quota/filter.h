@@ -86,17 +86,17 @@ public:
 private:
   // Create the matcher factory and matcher.
   void createMatcher();
-  // Create a new bucket and add it to the quota bucket cache.
-  void createNewBucket(const BucketId& bucket_id, const RateLimitOnMatchAction& match_action,
-                       size_t id);
+  // Create a new bucket, add it to the quota bucket cache and return a reference to it.
+  Bucket& createNewBucket(const BucketId& bucket_id, const RateLimitOnMatchAction& match_action,
+                          size_t id);
   // Send the report to RLQS server immediately.
-  Http::FilterHeadersStatus sendImmediateReport(const size_t bucket_id,
+  Http::FilterHeadersStatus sendImmediateReport(const size_t bucket_id, Bucket& bucket,
                                                 const RateLimitOnMatchAction& match_action);
 
   Http::FilterHeadersStatus setUsageAndResponseFromAction(const BucketAction& action,
-                                                          size_t bucket_id);
+                                                          Bucket& bucket, size_t bucket_id);
 
-  Http::FilterHeadersStatus processCachedBucket(size_t bucket_id,
+  Http::FilterHeadersStatus processCachedBucket(size_t bucket_id, Bucket& cached_bucket,
                                                 const RateLimitOnMatchAction& match_action);
   // TODO(tyxia) Build the customized response based on `DenyResponseSettings`.
   // Send a deny response and update quota usage if provided.
@@ -118,7 +118,7 @@ private:
   // Get the FilterHeadersStatus to return when a selected bucket has an expired
   // assignment. Note: this does not actually remove the expired entity from the
   // cache.
-  Http::FilterHeadersStatus processExpiredBucket(size_t bucket_id,
+  Http::FilterHeadersStatus processExpiredBucket(size_t bucket_id, Bucket& cached_bucket,
                                                  const RateLimitOnMatchAction& match_action);
 
   FilterConfigConstSharedPtr config_;
@@ -23,7 +23,11 @@ Config::Config(Stats::Scope& scope)
 
 const absl::string_view Filter::HTTP2_CONNECTION_PREFACE = "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n";
 
-Filter::Filter(const ConfigSharedPtr config) : config_(config), no_op_callbacks_() {
+Filter::Filter(const ConfigSharedPtr config) : config_(config), no_op_callbacks_() {}
+
+// The parser is created lazily in parseHttpHeader(): connections that are skipped in onAccept or
+// that present the HTTP/2 connection preface never need one.
+void Filter::createParser() {
   // Filter for only Request Message types with NoOp Parser callbacks.
   if (Runtime::runtimeFeatureEnabled("envoy.reloadable_features.http_inspector_use_balsa_parser")) {
     // Set both allow_custom_methods and enable_trailers to true with BalsaParser.
@@ -86,6 +90,10 @@ ParseState Filter::parseHttpHeader(absl::string_view data) {
       return ParseState::Error;
     }
 
+    if (parser_ == nullptr) {
+      createParser();
+    }
+
     absl::string_view new_data = data.substr(nread_);
     const size_t pos = new_data.find_first_of('\n');
     if (pos != absl::string_view::npos) {
@@ -115,6 +115,7 @@ private:
 
   void done(bool success);
   ParseState parseHttpHeader(absl::string_view data);
+  void createParser();
 
   const absl::flat_hash_set<std::string>& httpProtocols() const;
   const absl::flat_hash_set<std::string>& http1xMethods() const;
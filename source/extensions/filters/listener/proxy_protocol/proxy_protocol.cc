@@ -30,6 +30,8 @@
 #include "source/common/runtime/runtime_features.h"
 #include "source/extensions/common/proxy_protocol/proxy_protocol_header.h"
 
+#include "absl/container/inlined_vector.h"
+
 using envoy::config::core::v3::ProxyProtocolConfig;
 using envoy::config::core::v3::ProxyProtocolPassThroughTLVs;
 using Envoy::Extensions::Common::ProxyProtocol::PROXY_PROTO_V1_SIGNATURE;
@@ -255,7 +257,7 @@ ReadOrParseState Filter::parseBuffer(Network::ListenerFilterBuffer& buffer) {
           Network::ProxyProtocolFilterState::key(),
           std::make_unique<Network::ProxyProtocolFilterState>(Network::ProxyProtocolData{
               socket.connectionInfoProvider().remoteAddress(),
-              socket.connectionInfoProvider().localAddress(), parsed_tlvs_}),
+              socket.connectionInfoProvider().localAddress(), std::move(parsed_tlvs_)}),
           StreamInfo::FilterState::StateType::Mutable,
           StreamInfo::FilterState::LifeSpan::Connection);
     } else {
@@ -272,7 +274,7 @@ ReadOrParseState Filter::parseBuffer(Network::ListenerFilterBuffer& buffer) {
           Network::ProxyProtocolFilterState::key(),
           std::make_unique<Network::ProxyProtocolFilterState>(Network::ProxyProtocolData{
               proxy_protocol_header_.value().remote_address_,
-              proxy_protocol_header_.value().local_address_, parsed_tlvs_}),
+              proxy_protocol_header_.value().local_address_, std::move(parsed_tlvs_)}),
           StreamInfo::FilterState::StateType::Mutable,
           StreamInfo::FilterState::LifeSpan::Connection);
     }
@@ -447,9 +449,7 @@ bool Filter::parseV2Header(const char* buf) {
 }
 
 bool Filter::parseV1Header(const char* buf, size_t len) {
-  std::string proxy_line;
-  proxy_line.assign(buf, len);
-  const auto trimmed_proxy_line = StringUtil::rtrim(proxy_line);
+  const auto trimmed_proxy_line = StringUtil::rtrim(absl::string_view(buf, len));
 
   // Parse proxy protocol line with format: PROXY TCP4/TCP6/UNKNOWN SOURCE_ADDRESS
   // DESTINATION_ADDRESS SOURCE_PORT DESTINATION_PORT.
@@ -519,6 +519,10 @@ bool Filter::parseV1Header(const char* buf, size_t len) {
  *        See https://www.haproxy.org/download/2.1/doc/proxy-protocol.txt for details
  */
 bool Filter::parseTlvs(const uint8_t* buf, size_t len) {
+  // TLVs destined for dynamic metadata, collected in a single pass over the extension bytes. The
+  // values are views into the filter's pre-read buffer and are only valid during this call; they
+  // are copied when materialized into metadata by emitTlvMetadata() below.
+  absl::InlinedVector<std::pair<const KeyValuePair*, absl::string_view>, 4> needed_tlvs;
   size_t idx{0};
   while (idx < len) {
     const uint8_t tlv_type = buf[idx];
@@ -552,42 +556,7 @@ bool Filter::parseTlvs(const uint8_t* buf, size_t len) {
     absl::string_view tlv_value(reinterpret_cast<char const*>(buf + idx), tlv_value_length);
     auto key_value_pair = config_->isTlvTypeNeeded(tlv_type);
     if (nullptr != key_value_pair) {
-      std::string metadata_key = key_value_pair->metadata_namespace().empty()
-                                     ? "envoy.filters.listener.proxy_protocol"
-                                     : key_value_pair->metadata_namespace();
-      if (Runtime::runtimeFeatureEnabled(
-              "envoy.reloadable_features.use_typed_metadata_in_proxy_protocol_listener")) {
-        auto& typed_filter_metadata = (*cb_->dynamicMetadata().mutable_typed_filter_metadata());
-
-        const auto typed_proxy_filter_metadata = typed_filter_metadata.find(metadata_key);
-        envoy::data::core::v3::TlvsMetadata tlvs_metadata;
-        auto status = absl::OkStatus();
-        if (typed_proxy_filter_metadata != typed_filter_metadata.end()) {
-          status = MessageUtil::unpackTo(typed_proxy_filter_metadata->second, tlvs_metadata);
-        }
-        if (!status.ok()) {
-          ENVOY_LOG_PERIODIC(warn, std::chrono::seconds(1),
-                             "proxy_protocol: Failed to unpack typed metadata for TLV type ",
-                             tlv_type);
-        } else {
-          Protobuf::BytesValue tlv_byte_value;
-          tlv_byte_value.set_value(tlv_value.data(), tlv_value.size());
-          tlvs_metadata.mutable_typed_metadata()->insert(
-              {key_value_pair->key(), tlv_byte_value.value()});
-          ProtobufWkt::Any typed_metadata;
-          typed_metadata.PackFrom(tlvs_metadata);
-          cb_->setDynamicTypedMetadata(metadata_key, typed_metadata);
-        }
-      }
-      // Always populate untyped metadata for backwards compatibility.
-      ProtobufWkt::Value metadata_value;
-      // Sanitize any non utf8 characters.
-      auto sanitised_tlv_value = MessageUtil::sanitizeUtf8String(tlv_value);
-      metadata_value.set_string_value(sanitised_tlv_value.data(), sanitised_tlv_value.size());
-      ProtobufWkt::Struct metadata(
-          (*cb_->dynamicMetadata().mutable_filter_metadata())[metadata_key]);
-      metadata.mutable_fields()->insert({key_value_pair->key(), metadata_value});
-      cb_->setDynamicMetadata(metadata_key, metadata);
+      needed_tlvs.emplace_back(key_value_pair, tlv_value);
     } else {
       ENVOY_LOG(trace,
                 "proxy_protocol: Skip TLV of type {} since it's not needed for dynamic metadata",
@@ -603,9 +572,68 @@ bool Filter::parseTlvs(const uint8_t* buf, size_t len) {
     idx += tlv_value_length;
     ASSERT(idx <= len);
   }
+
+  if (!needed_tlvs.empty()) {
+    emitTlvMetadata(absl::MakeConstSpan(needed_tlvs));
+  }
   return true;
 }
 
+void Filter::emitTlvMetadata(
+    absl::Span<const std::pair<const KeyValuePair*, absl::string_view>> needed_tlvs) {
+  const bool use_typed_metadata = Runtime::runtimeFeatureEnabled(
+      "envoy.reloadable_features.use_typed_metadata_in_proxy_protocol_listener");
+
+  // Group values by destination namespace so that each namespace's typed Any is unpacked and
+  // repacked at most once and its untyped Struct is written back with a single call, rather than
+  // once per TLV.
+  absl::flat_hash_map<std::string, absl::InlinedVector<size_t, 4>> tlvs_by_namespace;
+  for (size_t i = 0; i < needed_tlvs.size(); i++) {
+    const KeyValuePair& rule = *needed_tlvs[i].first;
+    std::string metadata_key = rule.metadata_namespace().empty()
+                                   ? "envoy.filters.listener.proxy_protocol"
+                                   : rule.metadata_namespace();
+    tlvs_by_namespace[std::move(metadata_key)].push_back(i);
+  }
+
+  for (const auto& [metadata_key, indexes] : tlvs_by_namespace) {
+    if (use_typed_metadata) {
+      auto& typed_filter_metadata = (*cb_->dynamicMetadata().mutable_typed_filter_metadata());
+
+      const auto typed_proxy_filter_metadata = typed_filter_metadata.find(metadata_key);
+      envoy::data::core::v3::TlvsMetadata tlvs_metadata;
+      auto status = absl::OkStatus();
+      if (typed_proxy_filter_metadata != typed_filter_metadata.end()) {
+        status = MessageUtil::unpackTo(typed_proxy_filter_metadata->second, tlvs_metadata);
+      }
+      if (!status.ok()) {
+        ENVOY_LOG_PERIODIC(warn, std::chrono::seconds(1),
+                           "proxy_protocol: Failed to unpack typed metadata for namespace ",
+                           metadata_key);
+      } else {
+        for (const size_t index : indexes) {
+          const absl::string_view tlv_value = needed_tlvs[index].second;
+          tlvs_metadata.mutable_typed_metadata()->insert(
+              {needed_tlvs[index].first->key(), std::string(tlv_value)});
+        }
+        ProtobufWkt::Any typed_metadata;
+        typed_metadata.PackFrom(tlvs_metadata);
+        cb_->setDynamicTypedMetadata(metadata_key, typed_metadata);
+      }
+    }
+    // Always populate untyped metadata for backwards compatibility.
+    ProtobufWkt::Struct metadata((*cb_->dynamicMetadata().mutable_filter_metadata())[metadata_key]);
+    for (const size_t index : indexes) {
+      ProtobufWkt::Value metadata_value;
+      // Sanitize any non utf8 characters.
+      auto sanitised_tlv_value = MessageUtil::sanitizeUtf8String(needed_tlvs[index].second);
+      metadata_value.set_string_value(sanitised_tlv_value.data(), sanitised_tlv_value.size());
+      metadata.mutable_fields()->insert({needed_tlvs[index].first->key(), metadata_value});
+    }
+    cb_->setDynamicMetadata(metadata_key, metadata);
+  }
+}
+
 ReadOrParseState Filter::readExtensions(Network::ListenerFilterBuffer& buffer) {
   auto raw_slice = buffer.rawSlice();
   // waiting for more data if there is no enough data for extensions.
@@ -11,6 +11,7 @@
 #include "source/extensions/filters/listener//proxy_protocol/proxy_protocol_header.h"
 
 #include "absl/container/flat_hash_map.h"
+#include "absl/types/span.h"
 
 using Envoy::Extensions::Common::ProxyProtocol::PROXY_PROTO_V2_ADDR_LEN_UNIX;
 using Envoy::Extensions::Common::ProxyProtocol::PROXY_PROTO_V2_HEADER_LEN;
@@ -184,6 +185,15 @@ private:
   ReadOrParseState readProxyHeader(Network::ListenerFilterBuffer& buffer);
 
   bool parseTlvs(const uint8_t* buf, size_t len);
+
+  /**
+   * Materialize the TLVs collected by parseTlvs() into dynamic metadata, batching the writes per
+   * metadata namespace. The string views point into the filter's pre-read buffer and are copied
+   * here.
+   */
+  void emitTlvMetadata(
+      absl::Span<const std::pair<const KeyValuePair*, absl::string_view>> needed_tlvs);
+
   ReadOrParseState readExtensions(Network::ListenerFilterBuffer& buffer);
 
   /**
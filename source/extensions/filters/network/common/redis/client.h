@@ -7,6 +7,8 @@
 #include "source/extensions/filters/network/common/redis/codec_impl.h"
 #include "source/extensions/filters/network/common/redis/redis_command_stats.h"
 
+#include "absl/types/optional.h"
+
 namespace Envoy {
 namespace Extensions {
 namespace NetworkFilters {
@@ -155,6 +157,13 @@ public:
    */
   virtual std::chrono::milliseconds bufferFlushTimeoutInMs() const PURE;
 
+  /**
+   * @return when set, the per-command latency budget used to batch commands adaptively. The
+   * client delays each flush by at most the budget minus the measured upstream round trip time
+   * instead of using the fixed maxBufferSizeBeforeFlush()/bufferFlushTimeoutInMs() tuning.
+   */
+  virtual absl::optional<std::chrono::milliseconds> bufferFlushLatencyBudget() const PURE;
+
   /**
    * @return the maximum number of upstream connections to unknown hosts when enableRedirection() is
    * true.
@@ -26,6 +26,7 @@ ConfigImpl::ConfigImpl(
           config, buffer_flush_timeout,
           3)), // Default timeout is 3ms. If max_buffer_size_before_flush is zero, this is not used
                // as the buffer is flushed on each request immediately.
+      buffer_flush_latency_budget_(PROTOBUF_GET_OPTIONAL_MS(config, buffer_flush_latency_budget)),
       max_upstream_unknown_connections_(
           PROTOBUF_GET_WRAPPED_OR_DEFAULT(config, max_upstream_unknown_connections, 100)),
       enable_command_stats_(config.enable_command_stats()) {
@@ -107,9 +108,27 @@ void ClientImpl::flushBufferAndResetTimer() {
   if (flush_timer_->enabled()) {
     flush_timer_->disableTimer();
   }
+  // Sample the round trip time of one in-flight request at a time, measured from flush to first
+  // response. This deliberately includes our own queueing and write latency since that is what a
+  // caller experiences against the latency budget.
+  if (config_->bufferFlushLatencyBudget().has_value() && !rtt_sample_in_flight_ &&
+      !pending_requests_.empty()) {
+    rtt_sample_start_ = time_source_.monotonicTime();
+    rtt_sample_in_flight_ = true;
+  }
   connection_->write(encoder_buffer_, false);
 }
 
+std::chrono::milliseconds ClientImpl::adaptiveFlushDelay() const {
+  const std::chrono::milliseconds budget = config_->bufferFlushLatencyBudget().value();
+  if (!rtt_estimate_.has_value()) {
+    // With no round trip time sample yet, batching could blow the budget; flush immediately.
+    return std::chrono::milliseconds::zero();
+  }
+  const auto rtt = std::chrono::duration_cast<std::chrono::milliseconds>(*rtt_estimate_);
+  return std::max(budget - rtt, std::chrono::milliseconds::zero());
+}
+
 PoolRequest* ClientImpl::makeRequest(const RespValue& request, ClientCallbacks& callbacks) {
   ASSERT(connection_->state() == Network::Connection::State::Open);
 
@@ -128,8 +147,20 @@ PoolRequest* ClientImpl::makeRequest(const RespValue& request, ClientCallbacks&
   pending_requests_.emplace_back(*this, callbacks, command);
   encoder_->encode(request, encoder_buffer_);
 
-  // If buffer is full, flush. If the buffer was empty before the request, start the timer.
-  if (encoder_buffer_.length() >= config_->maxBufferSizeBeforeFlush()) {
+  if (config_->bufferFlushLatencyBudget().has_value()) {
+    // Adaptive batching: hold the buffer only as long as the latency budget allows after
+    // accounting for the measured upstream round trip time. maxBufferSizeBeforeFlush(), if set,
+    // still bounds the batch size.
+    const std::chrono::milliseconds delay = adaptiveFlushDelay();
+    if (delay == std::chrono::milliseconds::zero() ||
+        (config_->maxBufferSizeBeforeFlush() > 0 &&
+         encoder_buffer_.length() >= config_->maxBufferSizeBeforeFlush())) {
+      flushBufferAndResetTimer();
+    } else if (empty_buffer) {
+      flush_timer_->enableTimer(delay);
+    }
+  } else if (encoder_buffer_.length() >= config_->maxBufferSizeBeforeFlush()) {
+    // If buffer is full, flush. If the buffer was empty before the request, start the timer.
     flushBufferAndResetTimer();
   } else if (empty_buffer) {
     flush_timer_->enableTimer(std::chrono::milliseconds(config_->bufferFlushTimeoutInMs()));
@@ -214,6 +245,14 @@ void ClientImpl::onEvent(Network::ConnectionEvent event) {
 
 void ClientImpl::onRespValue(RespValuePtr&& value) {
   ASSERT(!pending_requests_.empty());
+  if (rtt_sample_in_flight_) {
+    const auto sample = std::chrono::duration_cast<std::chrono::microseconds>(
+        time_source_.monotonicTime() - rtt_sample_start_);
+    // Exponentially weighted moving average with a 1/4 weight on the new sample, so the estimate
+    // tracks upstream latency shifts without over-reacting to a single slow command.
+    rtt_estimate_ = rtt_estimate_.has_value() ? (*rtt_estimate_ * 3 + sample) / 4 : sample;
+    rtt_sample_in_flight_ = false;
+  }
   PendingRequest& request = pending_requests_.front();
   const bool canceled = request.canceled_;
 
@@ -49,6 +49,9 @@ public:
   std::chrono::milliseconds bufferFlushTimeoutInMs() const override {
     return buffer_flush_timeout_;
   }
+  absl::optional<std::chrono::milliseconds> bufferFlushLatencyBudget() const override {
+    return buffer_flush_latency_budget_;
+  }
   uint32_t maxUpstreamUnknownConnections() const override {
     return max_upstream_unknown_connections_;
   }
@@ -63,6 +66,7 @@ private:
   const bool enable_redirection_;
   const uint32_t max_buffer_size_before_flush_;
   const std::chrono::milliseconds buffer_flush_timeout_;
+  const absl::optional<std::chrono::milliseconds> buffer_flush_latency_budget_;
   const uint32_t max_upstream_unknown_connections_;
   const bool enable_command_stats_;
   ReadPolicy read_policy_;
@@ -127,6 +131,7 @@ private:
   void onConnectOrOpTimeout();
   void onData(Buffer::Instance& data);
   void putOutlierEvent(Upstream::Outlier::Result result);
+  std::chrono::milliseconds adaptiveFlushDelay() const;
 
   // DecoderCallbacks
   void onRespValue(RespValuePtr&& value) override;
@@ -147,6 +152,11 @@ private:
   bool connected_{};
   Event::TimerPtr flush_timer_;
   Envoy::TimeSource& time_source_;
+  // Moving average of the upstream round trip time, sampled one flush at a time. Only maintained
+  // when bufferFlushLatencyBudget() is configured; see adaptiveFlushDelay().
+  absl::optional<std::chrono::microseconds> rtt_estimate_;
+  MonotonicTime rtt_sample_start_;
+  bool rtt_sample_in_flight_{};
   const RedisCommandStatsSharedPtr redis_command_stats_;
   Stats::Scope& scope_;
   bool is_transaction_client_;
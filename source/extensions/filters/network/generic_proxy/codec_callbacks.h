@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "envoy/buffer/buffer.h"
 #include "envoy/common/optref.h"
 #include "envoy/network/connection.h"
@@ -58,6 +60,30 @@ public:
    */
   virtual void onDecodingSuccess(RequestCommonFramePtr common_frame) PURE;
 
+  /**
+   * Batch version of onDecodingSuccess() for codecs that decode multiple request header
+   * frames from a single read event. The default implementation dispatches the frames one
+   * by one. Implementations may override this to amortize per-frame work across the batch.
+   * @param header_frames request header frames from decoding, in receiving order.
+   */
+  virtual void onDecodingSuccess(std::vector<RequestHeaderFramePtr>&& header_frames) {
+    for (auto& header_frame : header_frames) {
+      onDecodingSuccess(std::move(header_frame));
+    }
+  }
+
+  /**
+   * Batch version of onDecodingSuccess() for codecs that decode multiple request common
+   * frames from a single read event. The default implementation dispatches the frames one
+   * by one. Implementations may override this to amortize per-frame work across the batch.
+   * @param common_frames request common frames from decoding, in receiving order.
+   */
+  virtual void onDecodingSuccess(std::vector<RequestCommonFramePtr>&& common_frames) {
+    for (auto& common_frame : common_frames) {
+      onDecodingSuccess(std::move(common_frame));
+    }
+  }
+
   /**
    * If request decoding failure then this method will be called.
    * @param reason the reason of decoding failure.
@@ -117,6 +143,30 @@ public:
    */
   virtual void onDecodingSuccess(ResponseCommonFramePtr common_frame) PURE;
 
+  /**
+   * Batch version of onDecodingSuccess() for codecs that decode multiple response header
+   * frames from a single read event. The default implementation dispatches the frames one
+   * by one. Implementations may override this to amortize per-frame work across the batch.
+   * @param header_frames response header frames from decoding, in receiving order.
+   */
+  virtual void onDecodingSuccess(std::vector<ResponseHeaderFramePtr>&& header_frames) {
+    for (auto& header_frame : header_frames) {
+      onDecodingSuccess(std::move(header_frame));
+    }
+  }
+
+  /**
+   * Batch version of onDecodingSuccess() for codecs that decode multiple response common
+   * frames from a single read event. The default implementation dispatches the frames one
+   * by one. Implementations may override this to amortize per-frame work across the batch.
+   * @param common_frames response common frames from decoding, in receiving order.
+   */
+  virtual void onDecodingSuccess(std::vector<ResponseCommonFramePtr>&& common_frames) {
+    for (auto& common_frame : common_frames) {
+      onDecodingSuccess(std::move(common_frame));
+    }
+  }
+
   /**
    * If response decoding failure then this method will be called.
    * @param reason the reason of decoding failure.
@@ -694,6 +694,27 @@ void Filter::onDecodingSuccess(RequestCommonFramePtr request_common_frame) {
   onDecodingFailure("unknown stream id");
 }
 
+void Filter::onDecodingSuccess(std::vector<RequestHeaderFramePtr>&& header_frames) {
+  for (auto& header_frame : header_frames) {
+    // A decoding failure or stream reset triggered by an earlier frame of the batch may
+    // have closed the connection. Drop the remaining frames in that case because the
+    // related streams could never be completed.
+    if (downstream_connection_closed_) {
+      return;
+    }
+    onDecodingSuccess(std::move(header_frame));
+  }
+}
+
+void Filter::onDecodingSuccess(std::vector<RequestCommonFramePtr>&& common_frames) {
+  for (auto& common_frame : common_frames) {
+    if (downstream_connection_closed_) {
+      return;
+    }
+    onDecodingSuccess(std::move(common_frame));
+  }
+}
+
 void Filter::onDecodingFailure(absl::string_view reason) {
   ENVOY_LOG(error, "generic proxy: request decoding failure: {}", reason);
   stats_helper_.onRequestDecodingError();
@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "envoy/config/core/v3/extension.pb.h"
 #include "envoy/extensions/filters/network/generic_proxy/v3/generic_proxy.pb.h"
@@ -382,6 +383,8 @@ public:
   void onDecodingSuccess(RequestHeaderFramePtr header_frame,
                          absl::optional<StartTime> start_time = {}) override;
   void onDecodingSuccess(RequestCommonFramePtr common_frame) override;
+  void onDecodingSuccess(std::vector<RequestHeaderFramePtr>&& header_frames) override;
+  void onDecodingSuccess(std::vector<RequestCommonFramePtr>&& common_frames) override;
   void onDecodingFailure(absl::string_view reason = {}) override;
   void writeToConnection(Buffer::Instance& buffer) override;
   OptRef<Network::Connection> connection() override;
@@ -10,12 +10,99 @@
 #include "source/common/common/fmt.h"
 #include "source/common/config/datasource.h"
 #include "source/common/config/utility.h"
+#include "source/common/protobuf/utility.h"
+#include "source/extensions/filters/network/common/redis/supported_commands.h"
+
+#include "absl/strings/ascii.h"
+#include "absl/strings/match.h"
 
 namespace Envoy {
 namespace Extensions {
 namespace NetworkFilters {
 namespace RedisProxy {
 
+namespace {
+bool isCacheableGet(const Common::Redis::RespValue& request) {
+  if (request.type() != Common::Redis::RespType::Array || request.asArray().size() != 2) {
+    return false;
+  }
+  const auto& args = request.asArray();
+  return args[0].type() == Common::Redis::RespType::BulkString &&
+         args[1].type() == Common::Redis::RespType::BulkString &&
+         absl::EqualsIgnoreCase(args[0].asString(), "get");
+}
+} // namespace
+
+Common::Redis::RespValuePtr LocalReadCache::lookup(const std::string& key) {
+  absl::MutexLock lock(&mutex_);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) {
+    return nullptr;
+  }
+  if (time_source_.monotonicTime() >= it->second.expires_at_) {
+    entries_.erase(it);
+    return nullptr;
+  }
+  return std::make_unique<Common::Redis::RespValue>(it->second.response_);
+}
+
+void LocalReadCache::store(const std::string& key, const Common::Redis::RespValue& response) {
+  if (response.type() != Common::Redis::RespType::BulkString &&
+      response.type() != Common::Redis::RespType::Null) {
+    return;
+  }
+  const MonotonicTime now = time_source_.monotonicTime();
+  absl::MutexLock lock(&mutex_);
+  if (entries_.size() >= max_entries_ && !entries_.contains(key)) {
+    // Make room: purge expired entries, falling back to evicting an arbitrary entry.
+    for (auto it = entries_.begin(); it != entries_.end();) {
+      if (now >= it->second.expires_at_) {
+        entries_.erase(it++);
+      } else {
+        ++it;
+      }
+    }
+    if (entries_.size() >= max_entries_) {
+      entries_.erase(entries_.begin());
+    }
+  }
+  entries_[key] = Entry{response, now + ttl_};
+}
+
+void LocalReadCache::onWriteCommand(const Common::Redis::RespValue& request) {
+  if (request.type() != Common::Redis::RespType::Array || request.asArray().size() < 2) {
+    return;
+  }
+  const auto& args = request.asArray();
+  if (args[0].type() != Common::Redis::RespType::BulkString &&
+      args[0].type() != Common::Redis::RespType::SimpleString) {
+    return;
+  }
+  const std::string command = absl::AsciiStrToLower(args[0].asString());
+  if (Common::Redis::SupportedCommands::isReadCommand(command)) {
+    return;
+  }
+  // MSET interleaves keys and values and the multi-key delete style commands name only keys;
+  // everything else names its key in the first argument. Invalidating an argument that is not
+  // actually a key is a harmless no-op, and keys written by commands whose keys the proxy cannot
+  // attribute (EVAL scripts for example) are bounded by the TTL.
+  size_t stride = 1;
+  size_t end = 2;
+  if (command == Common::Redis::SupportedCommands::mset()) {
+    stride = 2;
+    end = args.size();
+  } else if (Common::Redis::SupportedCommands::hashMultipleSumResultCommands().contains(command)) {
+    end = args.size();
+  }
+  absl::MutexLock lock(&mutex_);
+  for (size_t i = 1; i < end; i += stride) {
+    if (args[i].type() == Common::Redis::RespType::BulkString ||
+        args[i].type() == Common::Redis::RespType::SimpleString) {
+      entries_.erase(args[i].asString());
+    }
+  }
+}
+
 ProxyFilterConfig::ProxyFilterConfig(
     const envoy::extensions::filters::network::redis_proxy::v3::RedisProxy& config,
     Stats::Scope& scope, const Network::DrainDecision& drain_decision, Runtime::Loader& runtime,
@@ -30,7 +117,7 @@ ProxyFilterConfig::ProxyFilterConfig(
       external_auth_expiration_enabled_(external_auth_enabled_ &&
                                         config.external_auth_provider().enable_auth_expiration()),
       dns_cache_manager_(cache_manager_factory.get()), dns_cache_(getCache(config)),
-      time_source_(time_source) {
+      local_cache_(createLocalCache(config, time_source)), time_source_(time_source) {
 
   if (config.settings().enable_redirection() && !config.settings().has_dns_cache_config()) {
     ENVOY_LOG(warn, "redirections without DNS lookups enabled might cause client errors, set the "
@@ -67,6 +154,17 @@ Extensions::Common::DynamicForwardProxy::DnsCacheSharedPtr ProxyFilterConfig::ge
   return nullptr;
 }
 
+std::unique_ptr<LocalReadCache> ProxyFilterConfig::createLocalCache(
+    const envoy::extensions::filters::network::redis_proxy::v3::RedisProxy& config,
+    TimeSource& time_source) {
+  if (!config.has_local_cache()) {
+    return nullptr;
+  }
+  return std::make_unique<LocalReadCache>(
+      std::chrono::milliseconds(PROTOBUF_GET_MS_REQUIRED(config.local_cache(), ttl)),
+      PROTOBUF_GET_WRAPPED_OR_DEFAULT(config.local_cache(), max_entries, 1024), time_source);
+}
+
 ProxyStats ProxyFilterConfig::generateStats(const std::string& prefix, Stats::Scope& scope) {
   return {
       ALL_REDIS_PROXY_STATS(POOL_COUNTER_PREFIX(scope, prefix), POOL_GAUGE_PREFIX(scope, prefix))};
@@ -121,6 +219,24 @@ void ProxyFilter::onRespValue(Common::Redis::RespValuePtr&& value) {
 }
 
 void ProxyFilter::processRespValue(Common::Redis::RespValuePtr&& value, PendingRequest& request) {
+  // Commands inside a MULTI/EXEC transaction bypass the cache: their effects and visibility are
+  // deferred to EXEC, which the cache does not model.
+  if (config_->local_cache_ != nullptr && !transaction_.active_) {
+    if (isCacheableGet(*value)) {
+      const std::string& key = value->asArray()[1].asString();
+      Common::Redis::RespValuePtr cached = config_->local_cache_->lookup(key);
+      if (cached != nullptr) {
+        config_->stats_.downstream_rq_local_cache_hit_.inc();
+        request.onResponse(std::move(cached));
+        return;
+      }
+      config_->stats_.downstream_rq_local_cache_miss_.inc();
+      request.local_cache_key_ = key;
+    } else {
+      config_->local_cache_->onWriteCommand(*value);
+    }
+  }
+
   CommandSplitter::SplitRequestPtr split =
       splitter_.makeRequest(std::move(value), request, callbacks_->connection().dispatcher(),
                             callbacks_->connection().streamInfo());
@@ -273,6 +389,9 @@ bool ProxyFilter::checkPassword(const std::string& password) {
 
 void ProxyFilter::onResponse(PendingRequest& request, Common::Redis::RespValuePtr&& value) {
   ASSERT(!pending_requests_.empty());
+  if (!request.local_cache_key_.empty() && config_->local_cache_ != nullptr) {
+    config_->local_cache_->store(request.local_cache_key_, *value);
+  }
   request.pending_response_ = std::move(value);
   request.request_handle_ = nullptr;
 
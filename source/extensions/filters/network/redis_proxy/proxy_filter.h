@@ -18,6 +18,9 @@
 #include "source/extensions/filters/network/redis_proxy/command_splitter.h"
 #include "source/extensions/filters/network/redis_proxy/external_auth.h"
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+
 namespace Envoy {
 namespace Extensions {
 namespace NetworkFilters {
@@ -33,6 +36,8 @@ namespace RedisProxy {
   COUNTER(downstream_cx_total)                                                                     \
   COUNTER(downstream_cx_tx_bytes_total)                                                            \
   COUNTER(downstream_rq_total)                                                                     \
+  COUNTER(downstream_rq_local_cache_hit)                                                           \
+  COUNTER(downstream_rq_local_cache_miss)                                                          \
   GAUGE(downstream_cx_active, Accumulate)                                                          \
   GAUGE(downstream_cx_rx_bytes_buffered, Accumulate)                                               \
   GAUGE(downstream_cx_tx_bytes_buffered, Accumulate)                                               \
@@ -45,6 +50,48 @@ struct ProxyStats {
   ALL_REDIS_PROXY_STATS(GENERATE_COUNTER_STRUCT, GENERATE_GAUGE_STRUCT)
 };
 
+/**
+ * A TTL-bounded cache of GET responses shared by all downstream connections of a filter instance.
+ * Entries are invalidated when a write command for the key passes through this proxy and expire
+ * after the configured TTL to bound the staleness introduced by writers that do not. The upstream
+ * protocol is RESP2, so there is no server-push invalidation channel; the TTL is the consistency
+ * contract.
+ */
+class LocalReadCache {
+public:
+  LocalReadCache(std::chrono::milliseconds ttl, uint32_t max_entries, TimeSource& time_source)
+      : ttl_(ttl), max_entries_(max_entries), time_source_(time_source) {}
+
+  /**
+   * @return a copy of the cached response for the given GET key, or nullptr if there is no fresh
+   *         entry.
+   */
+  Common::Redis::RespValuePtr lookup(const std::string& key);
+
+  /**
+   * Store a GET response. Only bulk string and null responses are cached; errors and unexpected
+   * types are ignored.
+   */
+  void store(const std::string& key, const Common::Redis::RespValue& response);
+
+  /**
+   * Invalidate any keys written by the given request, if it is a write command.
+   */
+  void onWriteCommand(const Common::Redis::RespValue& request);
+
+private:
+  struct Entry {
+    Common::Redis::RespValue response_;
+    MonotonicTime expires_at_;
+  };
+
+  const std::chrono::milliseconds ttl_;
+  const uint32_t max_entries_;
+  TimeSource& time_source_;
+  absl::Mutex mutex_;
+  absl::flat_hash_map<std::string, Entry> entries_ ABSL_GUARDED_BY(mutex_);
+};
+
 /**
  * Configuration for the redis proxy filter.
  */
@@ -71,10 +118,16 @@ public:
   const Extensions::Common::DynamicForwardProxy::DnsCacheManagerSharedPtr dns_cache_manager_;
   const Extensions::Common::DynamicForwardProxy::DnsCacheSharedPtr dns_cache_{nullptr};
 
+  // Local GET response cache; nullptr unless configured.
+  const std::unique_ptr<LocalReadCache> local_cache_;
+
 private:
   static ProxyStats generateStats(const std::string& prefix, Stats::Scope& scope);
   Extensions::Common::DynamicForwardProxy::DnsCacheSharedPtr
   getCache(const envoy::extensions::filters::network::redis_proxy::v3::RedisProxy& config);
+  static std::unique_ptr<LocalReadCache> createLocalCache(
+      const envoy::extensions::filters::network::redis_proxy::v3::RedisProxy& config,
+      TimeSource& time_source);
   TimeSource& time_source_;
 };
 
@@ -143,6 +196,8 @@ private:
     Common::Redis::RespValuePtr pending_request_value_;
     Common::Redis::RespValuePtr pending_response_;
     CommandSplitter::SplitRequestPtr request_handle_;
+    // Set for GET requests that missed the local cache; the response fills the cache.
+    std::string local_cache_key_;
   };
 
   void onQuit(PendingRequest& request);
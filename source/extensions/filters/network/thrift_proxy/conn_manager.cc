@@ -212,7 +212,27 @@ DecoderEventHandler& ConnectionManager::newDecoderEventHandler() {
 }
 
 bool ConnectionManager::ResponseDecoder::passthroughEnabled() const {
-  return parent_.parent_.passthroughEnabled();
+  if (!parent_.parent_.config_->payloadPassthrough()) {
+    return false;
+  }
+
+  // The response is re-encoded with the downstream transport and protocol, so raw bytes can only
+  // be passed through when nothing needs to be transcoded. The request direction gets the
+  // equivalent check from the router (see UpstreamRequestInfo::passthrough_supported).
+  const TransportType downstream_transport = parent_.parent_.decoder_->transportType();
+  const ProtocolType downstream_protocol = parent_.parent_.decoder_->protocolType();
+  const bool transcode_free =
+      (downstream_transport == TransportType::Framed ||
+       downstream_transport == TransportType::Header) &&
+      (decoder_->transportType() == TransportType::Framed ||
+       decoder_->transportType() == TransportType::Header) &&
+      downstream_protocol == decoder_->protocolType() &&
+      downstream_protocol != ProtocolType::Twitter;
+  if (!transcode_free) {
+    return false;
+  }
+
+  return parent_.responsePassthroughSupported();
 }
 
 bool ConnectionManager::passthroughEnabled() const {
@@ -229,7 +249,7 @@ bool ConnectionManager::passthroughEnabled() const {
     return false;
   }
 
-  return (*rpcs_.begin())->passthroughSupported();
+  return (*rpcs_.begin())->requestPassthroughSupported();
 }
 
 bool ConnectionManager::headerKeysPreserveCase() const { return config_->headerKeysPreserveCase(); }
@@ -791,15 +811,24 @@ void ConnectionManager::ActiveRpc::finalizeRequest() {
   }
 }
 
-// TODO(kuochunghsu): passthroughSupported for decoder/encoder filters with more flexibility.
-// That is, supporting passthrough data for decoder filters if all  decoder filters agree,
-// and supporting passthrough data for encoder filters if all encoder filters agree.
+// Each direction is decided independently: the request payload is passed through when all
+// decoder filters agree (the router is a decoder filter, so this includes the upstream
+// transport/protocol compatibility check) and the response payload when all encoder filters
+// agree, so a filter that inspects one direction does not force a deep decode of the other.
 bool ConnectionManager::ActiveRpc::passthroughSupported() const {
+  return requestPassthroughSupported() && responsePassthroughSupported();
+}
+
+bool ConnectionManager::ActiveRpc::requestPassthroughSupported() const {
   for (auto& entry : decoder_filters_) {
     if (!entry->decoder_handle_->passthroughSupported()) {
       return false;
     }
   }
+  return true;
+}
+
+bool ConnectionManager::ActiveRpc::responsePassthroughSupported() const {
   for (auto& entry : encoder_filters_) {
     if (!entry->encoder_handle_->passthroughSupported()) {
       return false;
@@ -326,6 +326,8 @@ private:
     }
 
     bool passthroughSupported() const;
+    bool requestPassthroughSupported() const;
+    bool responsePassthroughSupported() const;
 
     void recordResponseAccessLog(const MessageMetadataSharedPtr& metadata);
     void recordResponseAccessLog(DirectResponse::ResponseType direct_response_type,
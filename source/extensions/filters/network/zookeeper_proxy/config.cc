@@ -38,6 +38,8 @@ Network::FilterFactoryCb ZooKeeperConfigFactory::createFilterFactoryFromProtoTyp
       PROTOBUF_GET_MS_OR_DEFAULT(proto_config, default_latency_threshold, 100));
   const LatencyThresholdOverrideList& latency_threshold_overrides =
       proto_config.latency_threshold_overrides();
+  const uint32_t response_latency_sample_period =
+      PROTOBUF_GET_WRAPPED_OR_DEFAULT(proto_config, response_latency_sample_period, 1);
 
   // Check duplicated opcodes in config.
   absl::flat_hash_set<LatencyThresholdOverride_Opcode> opcodes;
@@ -53,7 +55,7 @@ Network::FilterFactoryCb ZooKeeperConfigFactory::createFilterFactoryFromProtoTyp
       stat_prefix, max_packet_bytes, enable_per_opcode_request_bytes_metrics,
       enable_per_opcode_response_bytes_metrics, enable_per_opcode_decoder_error_metrics,
       enable_latency_threshold_metrics, default_latency_threshold, latency_threshold_overrides,
-      context.scope()));
+      response_latency_sample_period, context.scope()));
   auto& time_source = context.serverFactoryContext().mainThreadDispatcher().timeSource();
 
   return [filter_config, &time_source](Network::FilterManager& filter_manager) -> void {
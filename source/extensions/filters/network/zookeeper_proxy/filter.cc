@@ -26,7 +26,8 @@ ZooKeeperFilterConfig::ZooKeeperFilterConfig(
     const bool enable_per_opcode_response_bytes_metrics,
     const bool enable_per_opcode_decoder_error_metrics, const bool enable_latency_threshold_metrics,
     const std::chrono::milliseconds default_latency_threshold,
-    const LatencyThresholdOverrideList& latency_threshold_overrides, Stats::Scope& scope)
+    const LatencyThresholdOverrideList& latency_threshold_overrides,
+    const uint32_t response_latency_sample_period, Stats::Scope& scope)
     : scope_(scope), max_packet_bytes_(max_packet_bytes), stats_(generateStats(stat_prefix, scope)),
       stat_name_set_(scope.symbolTable().makeSet("Zookeeper")),
       stat_prefix_(stat_name_set_->add(stat_prefix)), auth_(stat_name_set_->add("auth")),
@@ -36,6 +37,7 @@ ZooKeeperFilterConfig::ZooKeeperFilterConfig(
       enable_per_opcode_request_bytes_metrics_(enable_per_opcode_request_bytes_metrics),
       enable_per_opcode_response_bytes_metrics_(enable_per_opcode_response_bytes_metrics),
       enable_per_opcode_decoder_error_metrics_(enable_per_opcode_decoder_error_metrics),
+      response_latency_sample_period_(response_latency_sample_period),
       enable_latency_threshold_metrics_(enable_latency_threshold_metrics),
       default_latency_threshold_(default_latency_threshold),
       latency_threshold_override_map_(parseLatencyThresholdOverrides(latency_threshold_overrides)) {
@@ -487,10 +489,12 @@ void ZooKeeperFilter::onConnectResponse(const int32_t proto_version, const int32
     break;
   }
 
-  Stats::Histogram& histogram = Stats::Utility::histogramFromElements(
-      config_->scope_, {config_->stat_prefix_, config_->connect_latency_},
-      Stats::Histogram::Unit::Milliseconds);
-  histogram.recordValue(latency.count());
+  if (shouldSampleLatency()) {
+    Stats::Histogram& histogram = Stats::Utility::histogramFromElements(
+        config_->scope_, {config_->stat_prefix_, config_->connect_latency_},
+        Stats::Histogram::Unit::Milliseconds);
+    histogram.recordValue(latency.count());
+  }
 
   setDynamicMetadata({{"opname", "connect_response"},
                       {"protocol_version", std::to_string(proto_version)},
@@ -521,10 +525,12 @@ void ZooKeeperFilter::onResponse(const OpCodes opcode, const int32_t xid, const
     }
   }
 
-  Stats::Histogram& histogram = Stats::Utility::histogramFromStatNames(
-      config_->scope_, {config_->stat_prefix_, opcode_latency},
-      Stats::Histogram::Unit::Milliseconds);
-  histogram.recordValue(latency.count());
+  if (shouldSampleLatency()) {
+    Stats::Histogram& histogram = Stats::Utility::histogramFromStatNames(
+        config_->scope_, {config_->stat_prefix_, opcode_latency},
+        Stats::Histogram::Unit::Milliseconds);
+    histogram.recordValue(latency.count());
+  }
 
   setDynamicMetadata({{"opname", opname},
                       {"xid", std::to_string(xid)},
@@ -532,6 +538,13 @@ void ZooKeeperFilter::onResponse(const OpCodes opcode, const int32_t xid, const
                       {"error", std::to_string(error)}});
 }
 
+bool ZooKeeperFilter::shouldSampleLatency() {
+  if (config_->response_latency_sample_period_ <= 1) {
+    return true;
+  }
+  return (responses_since_latency_sample_++ % config_->response_latency_sample_period_) == 0;
+}
+
 void ZooKeeperFilter::onWatchEvent(const int32_t event_type, const int32_t client_state,
                                    const std::string& path, const int64_t zxid,
                                    const int32_t error) {
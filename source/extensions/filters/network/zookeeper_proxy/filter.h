@@ -257,7 +257,7 @@ public:
                         const bool enable_latency_threshold_metrics,
                         const std::chrono::milliseconds default_latency_threshold,
                         const LatencyThresholdOverrideList& latency_threshold_overrides,
-                        Stats::Scope& scope);
+                        const uint32_t response_latency_sample_period, Stats::Scope& scope);
 
   const ZooKeeperProxyStats& stats() { return stats_; }
   uint32_t maxPacketBytes() const { return max_packet_bytes_; }
@@ -294,6 +294,9 @@ public:
   const bool enable_per_opcode_request_bytes_metrics_;
   const bool enable_per_opcode_response_bytes_metrics_;
   const bool enable_per_opcode_decoder_error_metrics_;
+  // Record latency histograms for one out of every N responses per connection. The response
+  // and fast/slow counters are always exact.
+  const uint32_t response_latency_sample_period_;
 
   ErrorBudgetResponseType errorBudgetDecision(const OpCodes opcode,
                                               const std::chrono::milliseconds latency) const;
@@ -410,9 +413,15 @@ public:
   void clearDynamicMetadata();
 
 private:
+  // @return whether the latency of the current response should be recorded, based on the
+  // configured sample period. The counter is per connection so every connection records
+  // its first response and then one of every N.
+  bool shouldSampleLatency();
+
   Network::ReadFilterCallbacks* read_callbacks_{};
   ZooKeeperFilterConfigSharedPtr config_;
   std::unique_ptr<Decoder> decoder_;
+  uint64_t responses_since_latency_sample_{};
 };
 
 } // namespace ZooKeeperProxy
@@ -4,6 +4,7 @@
 
 #include "source/common/buffer/buffer_impl.h"
 #include "source/common/network/socket_option_factory.h"
+#include "source/common/runtime/runtime_features.h"
 
 namespace Envoy {
 namespace Extensions {
@@ -167,17 +168,19 @@ Network::FilterStatus UdpProxyFilter::onReceiveError(Api::IoError::IoErrorCode)
 UdpProxyFilter::ClusterInfo*
 UdpProxyFilter::getClusterInfo(const Network::UdpRecvData::LocalPeerAddresses& addresses) {
   const std::string& route = config_->route(*addresses.local_, *addresses.peer_);
-  if (!cluster_infos_.contains(route)) {
+  const auto cluster_it = cluster_infos_.find(route);
+  if (cluster_it == cluster_infos_.end()) {
     config_->stats().downstream_sess_no_route_.inc();
     return nullptr;
   }
 
-  return cluster_infos_[route].get();
+  return cluster_it->second.get();
 }
 
 UdpProxyFilter::ClusterInfo* UdpProxyFilter::getClusterInfo(const std::string& cluster_name) {
-  if (cluster_infos_.contains(cluster_name)) {
-    return cluster_infos_[cluster_name].get();
+  auto cluster_it = cluster_infos_.find(cluster_name);
+  if (cluster_it != cluster_infos_.end()) {
+    return cluster_it->second.get();
   }
 
   if (!addOrUpdateCluster(cluster_name)) {
@@ -185,7 +188,9 @@ UdpProxyFilter::ClusterInfo* UdpProxyFilter::getClusterInfo(const std::string& c
     return nullptr;
   }
 
-  return cluster_infos_[cluster_name].get();
+  cluster_it = cluster_infos_.find(cluster_name);
+  ASSERT(cluster_it != cluster_infos_.end());
+  return cluster_it->second.get();
 }
 
 void UdpProxyFilter::removeSession(ActiveSession* session) {
@@ -319,10 +324,12 @@ UdpProxyFilter::ActiveSession::ActiveSession(UdpProxyFilter& filter,
     : filter_(filter), addresses_(std::move(addresses)), host_(host),
       session_id_(next_global_session_id_++),
       idle_timer_(filter_.read_callbacks_->udpListener().dispatcher().createTimer(
-          [this] { onIdleTimer(); })),
+          [this] { onIdleTimerFired(); })),
       udp_session_info_(StreamInfo::StreamInfoImpl(filter_.config_->timeSource(),
                                                    createDownstreamConnectionInfoProvider(),
-                                                   StreamInfo::FilterState::LifeSpan::Connection)) {
+                                                   StreamInfo::FilterState::LifeSpan::Connection)),
+      defer_idle_timer_rearm_(Runtime::runtimeFeatureEnabled(
+          "envoy.reloadable_features.udp_proxy_defer_idle_timer_rearm")) {
   udp_session_info_.setUpstreamInfo(std::make_shared<StreamInfo::UpstreamInfoImpl>());
   filter_.config_->stats().downstream_sess_total_.inc();
   filter_.config_->stats().downstream_sess_active_.inc();
@@ -702,7 +709,40 @@ void UdpProxyFilter::ActiveSession::resetIdleTimer() {
     return;
   }
 
-  idle_timer_->enableTimer(filter_.config_->sessionTimeout());
+  if (!defer_idle_timer_rearm_) {
+    idle_timer_->enableTimer(filter_.config_->sessionTimeout());
+    return;
+  }
+
+  // Re-arming the timer on every datagram is comparatively expensive at high packet rates, so
+  // only record the activity time here and let onIdleTimerFired() re-arm with the remaining time.
+  last_activity_time_ =
+      filter_.read_callbacks_->udpListener().dispatcher().approximateMonotonicTime();
+  if (idle_timer_->enabled()) {
+    idle_timer_rearm_pending_ = true;
+  } else {
+    idle_timer_rearm_pending_ = false;
+    idle_timer_->enableTimer(filter_.config_->sessionTimeout());
+  }
+}
+
+void UdpProxyFilter::ActiveSession::onIdleTimerFired() {
+  if (defer_idle_timer_rearm_ && idle_timer_rearm_pending_) {
+    idle_timer_rearm_pending_ = false;
+    const MonotonicTime now =
+        filter_.read_callbacks_->udpListener().dispatcher().approximateMonotonicTime();
+    const std::chrono::milliseconds timeout = filter_.config_->sessionTimeout();
+    const auto elapsed =
+        std::chrono::duration_cast<std::chrono::milliseconds>(now - last_activity_time_);
+    if (elapsed < timeout) {
+      // There was activity since the timer was armed, so the session is not idle yet; sleep for
+      // the remainder of the timeout period.
+      idle_timer_->enableTimer(timeout - elapsed);
+      return;
+    }
+  }
+
+  onIdleTimer();
 }
 
 void UdpProxyFilter::ActiveSession::processUpstreamDatagram(Network::UdpRecvData& recv_data) {
@@ -649,11 +649,10 @@ protected:
     Upstream::HostConstSharedPtr host_;
     ClusterInfo* cluster_{nullptr};
     uint64_t session_id_;
-    // TODO(mattklein123): Consider replacing an idle timer for each session with a last used
-    // time stamp and a periodic scan of all sessions to look for timeouts. This solution is simple,
-    // though it might not perform well for high volume traffic. Note that this is how TCP proxy
-    // idle timeouts work so we should consider unifying the implementation if we move to a time
-    // stamp and scan approach.
+    // To avoid re-arming the timer on every datagram, each datagram only records the activity
+    // time stamp (see resetIdleTimer()), and the timer callback re-arms itself with the remaining
+    // time if there was activity since it was armed. This means the timer normally fires once per
+    // idle timeout period per session rather than being reset at packet rate.
     const Event::TimerPtr idle_timer_;
     Event::TimerPtr access_log_flush_timer_;
 
@@ -667,10 +666,16 @@ protected:
     void onAccessLogFlushInterval();
     void rearmAccessLogFlushTimer();
     void disableAccessLogFlushTimer();
+    void onIdleTimerFired();
     bool setClusterInfo();
 
     bool cluster_connections_inc_{false};
     bool on_session_complete_called_{false};
+    // Tracks whether there was activity since the idle timer was last armed, so that
+    // onIdleTimerFired() knows to re-arm instead of expiring the session.
+    bool idle_timer_rearm_pending_{false};
+    MonotonicTime last_activity_time_{};
+    const bool defer_idle_timer_rearm_;
   };
 
   using ActiveSessionPtr = std::unique_ptr<ActiveSession>;
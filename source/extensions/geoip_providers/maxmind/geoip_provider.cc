@@ -149,20 +149,32 @@ void GeoipProvider::lookup(Geolocation::LookupRequest&& request,
                            Geolocation::LookupGeoHeadersCallback&& cb) const {
   auto& remote_address = request.remoteAddress();
   auto lookup_result = absl::flat_hash_map<std::string, std::string>{};
-  lookupInCityDb(remote_address, lookup_result);
-  lookupInAsnDb(remote_address, lookup_result);
-  lookupInAnonDb(remote_address, lookup_result);
+  // Snapshot all the database pointers under a single reader lock acquisition instead of locking
+  // once per database. The shared_ptr copies keep a database that is swapped out by a concurrent
+  // reload alive for the rest of this lookup.
+  MaxmindDbSharedPtr city_db_ptr;
+  MaxmindDbSharedPtr isp_db_ptr;
+  MaxmindDbSharedPtr anon_db_ptr;
+  {
+    absl::ReaderMutexLock lock(&mmdb_mutex_);
+    city_db_ptr = city_db_;
+    isp_db_ptr = isp_db_;
+    anon_db_ptr = anon_db_;
+  }
+  lookupInCityDb(remote_address, city_db_ptr, lookup_result);
+  lookupInAsnDb(remote_address, isp_db_ptr, lookup_result);
+  lookupInAnonDb(remote_address, anon_db_ptr, lookup_result);
   cb(std::move(lookup_result));
 }
 
 void GeoipProvider::lookupInCityDb(
     const Network::Address::InstanceConstSharedPtr& remote_address,
+    const MaxmindDbSharedPtr& city_db_ptr,
     absl::flat_hash_map<std::string, std::string>& lookup_result) const {
   if (config_->isLookupEnabledForHeader(config_->cityHeader()) ||
       config_->isLookupEnabledForHeader(config_->regionHeader()) ||
       config_->isLookupEnabledForHeader(config_->countryHeader())) {
     int mmdb_error;
-    auto city_db_ptr = getCityDb();
     // Used for testing.
     synchronizer_.syncPoint(std::string(CITY_DB_TYPE).append("_lookup_pre_complete"));
     if (!city_db_ptr) {
@@ -208,10 +220,10 @@ void GeoipProvider::lookupInCityDb(
 
 void GeoipProvider::lookupInAsnDb(
     const Network::Address::InstanceConstSharedPtr& remote_address,
+    const MaxmindDbSharedPtr& isp_db_ptr,
     absl::flat_hash_map<std::string, std::string>& lookup_result) const {
   if (config_->isLookupEnabledForHeader(config_->asnHeader())) {
     int mmdb_error;
-    auto isp_db_ptr = getIspDb();
     // Used for testing.
     synchronizer_.syncPoint(std::string(ISP_DB_TYPE).append("_lookup_pre_complete"));
     if (!isp_db_ptr) {
@@ -242,10 +254,10 @@ void GeoipProvider::lookupInAsnDb(
 
 void GeoipProvider::lookupInAnonDb(
     const Network::Address::InstanceConstSharedPtr& remote_address,
+    const MaxmindDbSharedPtr& anon_db_ptr,
     absl::flat_hash_map<std::string, std::string>& lookup_result) const {
   if (config_->isLookupEnabledForHeader(config_->anonHeader()) || config_->anonVpnHeader()) {
     int mmdb_error;
-    auto anon_db_ptr = getAnonDb();
     // Used for testing.
     synchronizer_.syncPoint(std::string(ANON_DB_TYPE).append("_lookup_pre_complete"));
     if (!anon_db_ptr) {
@@ -336,31 +348,16 @@ absl::Status GeoipProvider::mmdbReload(const MaxmindDbSharedPtr reloaded_db,
   return absl::OkStatus();
 }
 
-MaxmindDbSharedPtr GeoipProvider::getCityDb() const ABSL_LOCKS_EXCLUDED(mmdb_mutex_) {
-  absl::ReaderMutexLock lock(&mmdb_mutex_);
-  return city_db_;
-}
-
 void GeoipProvider::updateCityDb(MaxmindDbSharedPtr city_db) ABSL_LOCKS_EXCLUDED(mmdb_mutex_) {
   absl::MutexLock lock(&mmdb_mutex_);
   city_db_ = city_db;
 }
 
-MaxmindDbSharedPtr GeoipProvider::getIspDb() const ABSL_LOCKS_EXCLUDED(mmdb_mutex_) {
-  absl::ReaderMutexLock lock(&mmdb_mutex_);
-  return isp_db_;
-}
-
 void GeoipProvider::updateIspDb(MaxmindDbSharedPtr isp_db) ABSL_LOCKS_EXCLUDED(mmdb_mutex_) {
   absl::MutexLock lock(&mmdb_mutex_);
   isp_db_ = isp_db;
 }
 
-MaxmindDbSharedPtr GeoipProvider::getAnonDb() const ABSL_LOCKS_EXCLUDED(mmdb_mutex_) {
-  absl::ReaderMutexLock lock(&mmdb_mutex_);
-  return anon_db_;
-}
-
 void GeoipProvider::updateAnonDb(MaxmindDbSharedPtr anon_db) ABSL_LOCKS_EXCLUDED(mmdb_mutex_) {
   absl::MutexLock lock(&mmdb_mutex_);
   anon_db_ = anon_db;
@@ -5,12 +5,47 @@
 #include "envoy/data/core/v3/health_check_event.pb.h"
 #include "envoy/stats/scope.h"
 
+#include "source/common/common/macros.h"
 #include "source/common/network/utility.h"
+#include "source/common/protobuf/utility.h"
 #include "source/common/router/router.h"
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+
 namespace Envoy {
 namespace Upstream {
 
+namespace {
+
+// Runtime key gating cross-cluster sharing of active health check probe results. When enabled,
+// hosts that appear in multiple clusters with identical health check configurations are probed
+// by only one of them per interval; the other clusters consume the most recent probe result.
+constexpr absl::string_view SharedProbesRuntimeKey = "health_check.shared_probes";
+
+// The most recent active probe result for a (health check address, config hash) pair. `owner`
+// identifies the publishing session so that the probing session keeps probing rather than
+// consuming its own result; it is only ever compared, never dereferenced.
+struct SharedProbeResult {
+  const void* owner;
+  MonotonicTime time;
+  bool healthy;
+  bool degraded;
+  envoy::data::core::v3::HealthCheckFailureType failure_type;
+  bool retriable;
+};
+
+using SharedProbeKey = std::pair<std::string, uint64_t>;
+
+struct SharedProbeCache {
+  absl::Mutex mutex;
+  absl::flat_hash_map<SharedProbeKey, SharedProbeResult> results ABSL_GUARDED_BY(mutex);
+};
+
+SharedProbeCache& sharedProbeCache() { MUTABLE_CONSTRUCT_ON_FIRST_USE(SharedProbeCache); }
+
+} // namespace
+
 HealthCheckerImplBase::HealthCheckerImplBase(const Cluster& cluster,
                                              const envoy::config::core::v3::HealthCheck& config,
                                              Event::Dispatcher& dispatcher,
@@ -39,6 +74,7 @@ HealthCheckerImplBase::HealthCheckerImplBase(const Cluster& cluster,
           PROTOBUF_GET_MS_OR_DEFAULT(config, healthy_edge_interval, interval_.count())),
       transport_socket_options_(initTransportSocketOptions(config)),
       transport_socket_match_metadata_(initTransportSocketMatchMetadata(config)),
+      config_hash_(MessageUtil::hash(config)),
       member_update_cb_{cluster_.prioritySet().addMemberUpdateCb(
           [this](const HostVector& hosts_added, const HostVector& hosts_removed) -> absl::Status {
             onClusterMemberUpdate(hosts_added, hosts_removed);
@@ -242,7 +278,8 @@ HealthCheckerImplBase::ActiveHealthCheckSession::ActiveHealthCheckSession(
     : host_(host), parent_(parent),
       interval_timer_(parent.dispatcher_.createTimer([this]() -> void { onIntervalBase(); })),
       timeout_timer_(parent.dispatcher_.createTimer([this]() -> void { onTimeoutBase(); })),
-      time_source_(parent.dispatcher_.timeSource()) {
+      time_source_(parent.dispatcher_.timeSource()),
+      shared_probe_address_(host->healthCheckAddress()->asString()) {
 
   if (!host->healthFlagGet(Host::HealthFlag::FAILED_ACTIVE_HC)) {
     parent.incHealthy();
@@ -260,6 +297,17 @@ HealthCheckerImplBase::ActiveHealthCheckSession::~ActiveHealthCheckSession() {
 }
 
 void HealthCheckerImplBase::ActiveHealthCheckSession::onDeferredDeleteBase() {
+  {
+    // Drop our published probe result, if any, so matching sessions in other clusters fail the
+    // staleness check on their next interval and resume probing immediately.
+    auto& cache = sharedProbeCache();
+    absl::MutexLock lock(&cache.mutex);
+    const auto it = cache.results.find(SharedProbeKey(shared_probe_address_, parent_.config_hash_));
+    if (it != cache.results.end() && it->second.owner == this) {
+      cache.results.erase(it);
+    }
+  }
+
   HealthState state = HealthState::Unhealthy;
   // The session is about to be deferred deleted. Make sure all timers are gone and any
   // implementation specific state is destroyed.
@@ -281,6 +329,9 @@ void HealthCheckerImplBase::ActiveHealthCheckSession::onDeferredDeleteBase() {
 }
 
 void HealthCheckerImplBase::ActiveHealthCheckSession::handleSuccess(bool degraded) {
+  publishSharedResult(/*healthy=*/true, degraded, envoy::data::core::v3::ACTIVE,
+                      /*retriable=*/false);
+
   // If we are healthy, reset the # of unhealthy to zero.
   num_unhealthy_ = 0;
 
@@ -404,6 +455,10 @@ HealthTransition HealthCheckerImplBase::ActiveHealthCheckSession::setUnhealthy(
 
 void HealthCheckerImplBase::ActiveHealthCheckSession::handleFailure(
     envoy::data::core::v3::HealthCheckFailureType type, bool retriable) {
+  // Passive failures are cluster-local signals, not probe results, so they are not shared.
+  if (type != envoy::data::core::v3::PASSIVE) {
+    publishSharedResult(/*healthy=*/false, /*degraded=*/false, type, retriable);
+  }
   HealthTransition changed_state = setUnhealthy(type, retriable);
   // It's possible that the previous call caused this session to be deferred deleted.
   if (timeout_timer_ != nullptr) {
@@ -428,11 +483,54 @@ HealthCheckerImplBase::ActiveHealthCheckSession::clearPendingFlag(HealthTransiti
 }
 
 void HealthCheckerImplBase::ActiveHealthCheckSession::onIntervalBase() {
+  if (parent_.runtime_.snapshot().getBoolean(SharedProbesRuntimeKey, false) &&
+      tryConsumeSharedResult()) {
+    return;
+  }
   onInterval();
   timeout_timer_->enableTimer(parent_.timeout_);
   parent_.stats_.attempt_.inc();
 }
 
+bool HealthCheckerImplBase::ActiveHealthCheckSession::tryConsumeSharedResult() {
+  SharedProbeResult result;
+  {
+    auto& cache = sharedProbeCache();
+    absl::MutexLock lock(&cache.mutex);
+    const auto it = cache.results.find(SharedProbeKey(shared_probe_address_, parent_.config_hash_));
+    // A result published longer than an interval ago means its publisher has stopped probing
+    // (e.g. its cluster was removed); probe ourselves and take over publishing.
+    if (it == cache.results.end() || it->second.owner == this ||
+        time_source_.monotonicTime() - it->second.time > parent_.interval_) {
+      return false;
+    }
+    result = it->second;
+  }
+
+  parent_.stats_.shared_result_.inc();
+  applying_shared_result_ = true;
+  if (result.healthy) {
+    handleSuccess(result.degraded);
+  } else {
+    handleFailure(result.failure_type, result.retriable);
+  }
+  applying_shared_result_ = false;
+  return true;
+}
+
+void HealthCheckerImplBase::ActiveHealthCheckSession::publishSharedResult(
+    bool healthy, bool degraded, envoy::data::core::v3::HealthCheckFailureType type,
+    bool retriable) {
+  if (applying_shared_result_ ||
+      !parent_.runtime_.snapshot().getBoolean(SharedProbesRuntimeKey, false)) {
+    return;
+  }
+  auto& cache = sharedProbeCache();
+  absl::MutexLock lock(&cache.mutex);
+  cache.results[SharedProbeKey(shared_probe_address_, parent_.config_hash_)] =
+      SharedProbeResult{this, time_source_.monotonicTime(), healthy, degraded, type, retriable};
+}
+
 void HealthCheckerImplBase::ActiveHealthCheckSession::onTimeoutBase() {
   onTimeout();
   handleFailure(envoy::data::core::v3::NETWORK_TIMEOUT);
@@ -26,6 +26,7 @@ namespace Upstream {
   COUNTER(failure)                                                                                 \
   COUNTER(network_failure)                                                                         \
   COUNTER(passive_failure)                                                                         \
+  COUNTER(shared_result)                                                                           \
   COUNTER(success)                                                                                 \
   COUNTER(verify_cluster)                                                                          \
   GAUGE(degraded, Accumulate)                                                                      \
@@ -83,6 +84,13 @@ protected:
     void onTimeoutBase();
     virtual void onDeferredDelete() PURE;
     void onInitialInterval();
+    // Applies a probe result published by another session with the same health check address and
+    // health check configuration, if one is fresh enough. Returns whether a result was applied.
+    bool tryConsumeSharedResult();
+    // Publishes this session's probe result for consumption by matching sessions in other
+    // clusters. No-op unless probe sharing is runtime enabled.
+    void publishSharedResult(bool healthy, bool degraded,
+                             envoy::data::core::v3::HealthCheckFailureType type, bool retriable);
 
     HealthCheckerImplBase& parent_;
     Event::TimerPtr interval_timer_;
@@ -91,6 +99,9 @@ protected:
     uint32_t num_healthy_{};
     bool first_check_{true};
     TimeSource& time_source_;
+    const std::string shared_probe_address_;
+    // Set while a shared result is being applied so that it is not republished as our own.
+    bool applying_shared_result_{false};
   };
 
   using ActiveHealthCheckSessionPtr = std::unique_ptr<ActiveHealthCheckSession>;
@@ -161,6 +172,9 @@ private:
   absl::node_hash_map<HostSharedPtr, ActiveHealthCheckSessionPtr> active_sessions_;
   const std::shared_ptr<const Network::TransportSocketOptionsImpl> transport_socket_options_;
   const MetadataConstSharedPtr transport_socket_match_metadata_;
+  // Hash of the health check configuration. Probe results are only shared between health checkers
+  // that are configured identically and would thus issue identical probes.
+  const uint64_t config_hash_;
   const Common::CallbackHandlePtr member_update_cb_;
 };
 
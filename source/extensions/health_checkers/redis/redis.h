@@ -87,6 +87,9 @@ private:
     std::chrono::milliseconds bufferFlushTimeoutInMs() const override {
       return std::chrono::milliseconds(1);
     }
+    absl::optional<std::chrono::milliseconds> bufferFlushLatencyBudget() const override {
+      return absl::nullopt;
+    }
 
     uint32_t maxUpstreamUnknownConnections() const override { return 0; }
     bool enableCommandStats() const override { return false; }
@@ -82,7 +82,11 @@ void CacheShared::initStats() {
     }
     size_count_++;
     size_bytes_ += entry.size_bytes_.value_or(0);
+    lookup_index_.addFile(entry.name_);
   }
+  // Files written while the scan was in progress were added to the index by their
+  // writers; duplicates are harmless.
+  lookup_index_.markPopulated();
   stats_.size_count_.set(size_count_);
   stats_.size_bytes_.set(size_bytes_);
   needs_init_ = false;
@@ -153,6 +157,7 @@ void CacheShared::evict() {
       // gone - if there's a permissions issue, for example, then the cache might remain oversized
       // and the eviction thread will be churning, trying and failing to remove a file, which would
       // be worth logging a warning, versus if the file is already gone then there's no problem.
+      lookup_index_.removeFile(it->name_);
       trackFileRemoved(it->size_);
     }
     ++it;
@@ -36,8 +36,9 @@ void FileSystemHttpCache::writeVaryNodeToDisk(Event::Dispatcher& dispatcher, con
   std::string filename = absl::StrCat(cachePath(), generateFilename(key));
   async_file_manager_->createAnonymousFile(
       &dispatcher, cachePath(),
-      [headers, filename = std::move(filename), cleanup,
-       dispatcher = &dispatcher](absl::StatusOr<AsyncFileHandle> open_result) {
+      [headers, filename = std::move(filename), cleanup, dispatcher = &dispatcher,
+       shared = shared_,
+       name = generateFilename(key)](absl::StatusOr<AsyncFileHandle> open_result) {
         if (!open_result.ok()) {
           ENVOY_LOG(warn, "writing vary node, failed to createAnonymousFile: {}",
                     open_result.status());
@@ -53,17 +54,20 @@ void FileSystemHttpCache::writeVaryNodeToDisk(Event::Dispatcher& dispatcher, con
         size_t sz = buf2.length();
         auto queued = file_handle->write(
             dispatcher, buf2, 0,
-            [dispatcher, file_handle, cleanup, sz,
-             filename = std::move(filename)](absl::StatusOr<size_t> write_result) {
+            [dispatcher, file_handle, cleanup, sz, filename = std::move(filename), shared,
+             name](absl::StatusOr<size_t> write_result) {
               if (!write_result.ok() || write_result.value() != sz) {
                 ENVOY_LOG(warn, "writing vary node, failed to write: {}", write_result.status());
                 file_handle->close(nullptr, [](absl::Status) {}).IgnoreError();
                 return;
               }
               auto queued = file_handle->createHardLink(
-                  dispatcher, filename, [cleanup, file_handle](absl::Status link_result) {
+                  dispatcher, filename,
+                  [cleanup, file_handle, shared, name](absl::Status link_result) {
                     if (!link_result.ok()) {
                       ENVOY_LOG(warn, "writing vary node, failed to link: {}", link_result);
+                    } else {
+                      shared->lookup_index_.addFile(name);
                     }
                     file_handle->close(nullptr, [](absl::Status) {}).IgnoreError();
                   });
@@ -89,7 +93,10 @@ FileSystemHttpCache::FileSystemHttpCache(
 
 CacheShared::CacheShared(ConfigProto config, Stats::Scope& stats_scope)
     : config_(config), stat_names_(stats_scope.symbolTable()),
-      stats_(generateStats(stat_names_, stats_scope, cachePath())) {}
+      stats_(generateStats(stat_names_, stats_scope, cachePath())),
+      lookup_index_(config_.enable_in_memory_lookup_index()) {}
+
+LookupIndex& FileSystemHttpCache::lookupIndex() { return shared_->lookup_index_; }
 
 FileSystemHttpCache::~FileSystemHttpCache() { cache_eviction_thread_.removeCache(shared_); }
 
@@ -7,6 +7,7 @@
 #include "source/common/common/logger.h"
 #include "source/extensions/common/async_files/async_file_manager.h"
 #include "source/extensions/filters/http/cache/http_cache.h"
+#include "source/extensions/http/cache/file_system_http_cache/lookup_index.h"
 #include "source/extensions/http/cache/file_system_http_cache/stats.h"
 
 #include "absl/base/thread_annotations.h"
@@ -167,6 +168,13 @@ public:
     return async_file_manager_;
   }
 
+  /**
+   * Returns the in-memory index of cache file names. The index is inert unless
+   * ``enable_in_memory_lookup_index`` is set in the config.
+   * @return the lookup index for this cache instance.
+   */
+  LookupIndex& lookupIndex();
+
   /**
    * Updates stats to reflect that a file has been added to the cache.
    * @param file_size The size in bytes of the file that was added.
@@ -251,6 +259,10 @@ struct CacheShared {
   std::atomic<uint64_t> size_count_ = 0;
   std::atomic<uint64_t> size_bytes_ = 0;
   bool needs_init_ = true;
+  // Index of cache file names on disk, for resolving misses without file system
+  // operations. Populated by the eviction thread's initial scan; inert unless enabled
+  // in the config.
+  LookupIndex lookup_index_;
 
   /**
    * @return true if the eviction thread should do a pass over this cache.
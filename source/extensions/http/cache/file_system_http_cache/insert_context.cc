@@ -264,6 +264,7 @@ void FileInsertContext::commitCreateHardLink() {
         ENVOY_LOG(debug, "created cache file {}", cache_->generateFilename(key_));
         succeedCurrentAction();
         uint64_t file_size = header_block_.offsetToTrailers() + header_block_.trailerSize();
+        cache_->lookupIndex().addFile(cache_->generateFilename(key_));
         cache_->trackFileAdded(file_size);
         // By clearing cleanup before destructor, we prevent logging an error.
         cleanup_ = nullptr;
@@ -23,6 +23,12 @@ void FileLookupContext::getHeaders(LookupHeadersCallback&& cb) {
 }
 
 void FileLookupContext::tryOpenCacheFile() {
+  if (!cache_.lookupIndex().mayContain(cache_.generateFilename(key_))) {
+    // The index knows the file is absent; resolve the miss without touching the
+    // file system.
+    cache_.stats().index_fast_misses_.inc();
+    return doCacheMiss();
+  }
   cancel_action_in_flight_ = cache_.asyncFileManager()->openExistingFile(
       dispatcher(), filepath(), Common::AsyncFiles::AsyncFileManager::Mode::ReadOnly,
       [this](absl::StatusOr<AsyncFileHandle> open_result) {
@@ -117,7 +123,7 @@ void FileLookupContext::invalidateCacheEntry() {
   // if the filter was destroyed in the meantime. For the same reason, we must not capture 'this'.
   cache_.asyncFileManager()->stat(
       dispatcher(), filepath(),
-      [file = filepath(), cache = cache_.shared_from_this(),
+      [file = filepath(), name = cache_.generateFilename(key_), cache = cache_.shared_from_this(),
        dispatcher = dispatcher()](absl::StatusOr<struct stat> stat_result) {
         ASSERT(dispatcher->isThreadSafe());
         size_t file_size = 0;
@@ -125,8 +131,9 @@ void FileLookupContext::invalidateCacheEntry() {
           file_size = stat_result.value().st_size;
         }
         cache->asyncFileManager()->unlink(dispatcher, file,
-                                          [cache, file_size](absl::Status unlink_result) {
+                                          [cache, name, file_size](absl::Status unlink_result) {
                                             if (unlink_result.ok()) {
+                                              cache->lookupIndex().removeFile(name);
                                               cache->trackFileRemoved(file_size);
                                             }
                                           });
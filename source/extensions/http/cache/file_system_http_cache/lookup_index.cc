@@ -0,0 +1,45 @@
+#include "source/extensions/http/cache/file_system_http_cache/lookup_index.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace HttpFilters {
+namespace Cache {
+namespace FileSystemHttpCache {
+
+void LookupIndex::markPopulated() {
+  if (!enabled_) {
+    return;
+  }
+  absl::MutexLock lock(&mu_);
+  populated_ = true;
+}
+
+void LookupIndex::addFile(absl::string_view filename) {
+  if (!enabled_) {
+    return;
+  }
+  absl::MutexLock lock(&mu_);
+  filenames_.emplace(filename);
+}
+
+void LookupIndex::removeFile(absl::string_view filename) {
+  if (!enabled_) {
+    return;
+  }
+  absl::MutexLock lock(&mu_);
+  filenames_.erase(filename);
+}
+
+bool LookupIndex::mayContain(absl::string_view filename) const {
+  if (!enabled_) {
+    return true;
+  }
+  absl::MutexLock lock(&mu_);
+  return !populated_ || filenames_.contains(filename);
+}
+
+} // namespace FileSystemHttpCache
+} // namespace Cache
+} // namespace HttpFilters
+} // namespace Extensions
+} // namespace Envoy
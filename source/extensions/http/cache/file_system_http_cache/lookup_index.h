@@ -0,0 +1,71 @@
+#pragma once
+
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace HttpFilters {
+namespace Cache {
+namespace FileSystemHttpCache {
+
+/**
+ * An in-memory index of the cache file names currently present on disk, so that lookups
+ * for entries which are not in the cache can be resolved as misses without queueing any
+ * file system operations.
+ *
+ * The index only becomes authoritative once the eviction thread's initial directory scan
+ * has populated it; until then, and whenever the index is disabled, mayContain returns
+ * true for every name and lookups fall through to the file system as before.
+ *
+ * The index errs on the side of false positives - a name may still be present after its
+ * file has been removed (the subsequent open fails and is handled as a normal miss) -
+ * but a name must never be absent while its file exists, as that would hide a valid
+ * entry until restart. For that reason the index must only be enabled when no other
+ * process adds entries to the cache path.
+ */
+class LookupIndex {
+public:
+  explicit LookupIndex(bool enabled) : enabled_(enabled) {}
+
+  /**
+   * Marks the index as fully populated. Called by the eviction thread after the initial
+   * scan of the cache directory; before this, mayContain returns true unconditionally.
+   */
+  void markPopulated() ABSL_LOCKS_EXCLUDED(mu_);
+
+  /**
+   * Records that a cache file with the given name is now present on disk.
+   * @param filename the name of the cache file, without its path.
+   */
+  void addFile(absl::string_view filename) ABSL_LOCKS_EXCLUDED(mu_);
+
+  /**
+   * Records that the cache file with the given name has been removed from disk.
+   * @param filename the name of the cache file, without its path.
+   */
+  void removeFile(absl::string_view filename) ABSL_LOCKS_EXCLUDED(mu_);
+
+  /**
+   * @param filename the name of a cache file, without its path.
+   * @return false only if the index is enabled, populated, and the named file is known
+   *     to be absent; true in every other case.
+   */
+  bool mayContain(absl::string_view filename) const ABSL_LOCKS_EXCLUDED(mu_);
+
+private:
+  const bool enabled_;
+  mutable absl::Mutex mu_;
+  bool populated_ ABSL_GUARDED_BY(mu_){false};
+  absl::flat_hash_set<std::string> filenames_ ABSL_GUARDED_BY(mu_);
+};
+
+} // namespace FileSystemHttpCache
+} // namespace Cache
+} // namespace HttpFilters
+} // namespace Extensions
+} // namespace Envoy
@@ -25,6 +25,7 @@ namespace FileSystemHttpCache {
 
 #define ALL_CACHE_STATS(COUNTER, GAUGE, HISTOGRAM, TEXT_READOUT, STATNAME)                         \
   COUNTER(eviction_runs)                                                                           \
+  COUNTER(index_fast_misses)                                                                       \
   GAUGE(size_bytes, NeverImport)                                                                   \
   GAUGE(size_count, NeverImport)                                                                   \
   GAUGE(size_limit_bytes, NeverImport)                                                             \
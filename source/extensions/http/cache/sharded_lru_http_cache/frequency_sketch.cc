@@ -0,0 +1,81 @@
+#include "source/extensions/http/cache/sharded_lru_http_cache/frequency_sketch.h"
+
+#include <algorithm>
+
+namespace Envoy {
+namespace Extensions {
+namespace HttpFilters {
+namespace Cache {
+namespace ShardedLruHttpCache {
+
+namespace {
+
+constexpr uint32_t NumHashes = 4;
+constexpr uint64_t CounterMask = 0xf;
+
+// Odd multipliers used to derive independent hash functions from one key hash.
+constexpr uint64_t Seeds[NumHashes] = {0xc3a5c85c97cb3127, 0xb492b66fbe98f273, 0x9ae16a3b2f90404f,
+                                       0xcbf29ce484222325};
+
+uint64_t nextPowerOfTwo(uint64_t value) {
+  uint64_t result = 1;
+  while (result < value) {
+    result <<= 1;
+  }
+  return result;
+}
+
+uint64_t mix(uint64_t hash, uint64_t seed) {
+  uint64_t mixed = hash * seed;
+  return mixed ^ (mixed >> 32);
+}
+
+} // namespace
+
+FrequencySketch::FrequencySketch(uint64_t capacity)
+    // 16 counters per word; at least one word per expected key to keep collisions rare.
+    : table_(std::max<uint64_t>(nextPowerOfTwo(capacity) / 16, 8)),
+      sample_size_(std::max<uint64_t>(capacity * 10, 100)) {}
+
+std::pair<uint64_t, uint32_t> FrequencySketch::counterPosition(uint64_t key_hash,
+                                                               uint32_t i) const {
+  const uint64_t mixed = mix(key_hash, Seeds[i]);
+  const uint64_t word = (mixed >> 4) & (table_.size() - 1);
+  const uint32_t shift = (mixed & 0xf) * 4;
+  return {word, shift};
+}
+
+void FrequencySketch::record(uint64_t key_hash) {
+  for (uint32_t i = 0; i < NumHashes; i++) {
+    const auto [word, shift] = counterPosition(key_hash, i);
+    if (((table_[word] >> shift) & CounterMask) < CounterMask) {
+      table_[word] += uint64_t{1} << shift;
+    }
+  }
+  if (++recorded_ >= sample_size_) {
+    age();
+  }
+}
+
+uint32_t FrequencySketch::frequency(uint64_t key_hash) const {
+  uint32_t estimate = CounterMask;
+  for (uint32_t i = 0; i < NumHashes; i++) {
+    const auto [word, shift] = counterPosition(key_hash, i);
+    estimate = std::min<uint32_t>(estimate, (table_[word] >> shift) & CounterMask);
+  }
+  return estimate;
+}
+
+void FrequencySketch::age() {
+  for (uint64_t& word : table_) {
+    // Halve each 4-bit counter in place.
+    word = (word >> 1) & 0x7777777777777777;
+  }
+  recorded_ /= 2;
+}
+
+} // namespace ShardedLruHttpCache
+} // namespace Cache
+} // namespace HttpFilters
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Envoy {
+namespace Extensions {
+namespace HttpFilters {
+namespace Cache {
+namespace ShardedLruHttpCache {
+
+/**
+ * An approximate frequency counter used for TinyLFU cache admission. It is a count-min sketch of
+ * 4-bit saturating counters with periodic aging: once the number of recorded accesses reaches a
+ * multiple of the configured capacity every counter is halved, so frequencies reflect recent
+ * popularity rather than the whole history. Estimates can only over-count, never under-count.
+ *
+ * Not thread safe; each cache shard owns one and accesses it under the shard lock.
+ */
+class FrequencySketch {
+public:
+  // `capacity` is the expected number of distinct keys, typically the maximum number of cache
+  // entries. The table is sized to the next power of two counters per hash function.
+  explicit FrequencySketch(uint64_t capacity);
+
+  // Records an access to the key with the given hash.
+  void record(uint64_t key_hash);
+
+  // Returns the estimated access frequency of the key, saturated at 15.
+  uint32_t frequency(uint64_t key_hash) const;
+
+private:
+  // Index of the 4-bit counter for the `i`-th hash function, as (word, shift).
+  std::pair<uint64_t, uint32_t> counterPosition(uint64_t key_hash, uint32_t i) const;
+  void age();
+
+  // Each word packs sixteen 4-bit counters.
+  std::vector<uint64_t> table_;
+  uint64_t recorded_{};
+  const uint64_t sample_size_;
+};
+
+} // namespace ShardedLruHttpCache
+} // namespace Cache
+} // namespace HttpFilters
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,487 @@
+#include "source/extensions/http/cache/sharded_lru_http_cache/sharded_lru_http_cache.h"
+
+#include "envoy/extensions/http/cache/sharded_lru_http_cache/v3/config.pb.h"
+#include "envoy/registry/registry.h"
+
+#include "source/common/buffer/buffer_impl.h"
+#include "source/common/http/header_map_impl.h"
+#include "source/extensions/filters/http/cache/cache_entry_utils.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace HttpFilters {
+namespace Cache {
+namespace ShardedLruHttpCache {
+namespace {
+
+using ConfigProto = envoy::extensions::http::cache::sharded_lru_http_cache::v3::ShardedLruHttpCacheConfig;
+
+constexpr absl::string_view Name = "envoy.extensions.http.cache.sharded_lru";
+
+constexpr uint32_t DefaultShards = 16;
+constexpr uint64_t DefaultMaxCacheBytes = 256 * 1024 * 1024;
+// Approximate per-entry bookkeeping cost added to the accounted size.
+constexpr uint64_t EntryOverheadBytes = 128;
+// Assumed average entry size when sizing the admission sketch of a shard.
+constexpr uint64_t SketchBytesPerEntry = 4096;
+
+// Returns a Key with the vary header added to custom_fields.
+// It is an error to call this with headers that don't include vary.
+// Returns nullopt if the vary headers in the response are not
+// compatible with the VaryAllowList in the LookupRequest.
+absl::optional<Key> variedRequestKey(const LookupRequest& request,
+                                     const Http::ResponseHeaderMap& response_headers) {
+  absl::btree_set<absl::string_view> vary_header_values =
+      VaryHeaderUtils::getVaryValues(response_headers);
+  ASSERT(!vary_header_values.empty());
+  const absl::optional<std::string> vary_identifier = VaryHeaderUtils::createVaryIdentifier(
+      request.varyAllowList(), vary_header_values, request.requestHeaders());
+  if (!vary_identifier.has_value()) {
+    return absl::nullopt;
+  }
+  Key varied_request_key = request.key();
+  varied_request_key.add_custom_fields(vary_identifier.value());
+  return varied_request_key;
+}
+
+class ShardedLruLookupContext : public LookupContext {
+public:
+  ShardedLruLookupContext(Event::Dispatcher& dispatcher, ShardedLruHttpCache& cache,
+                          LookupRequest&& request)
+      : dispatcher_(dispatcher), cache_(cache), request_(std::move(request)) {}
+
+  void getHeaders(LookupHeadersCallback&& cb) override {
+    auto entry = cache_.lookup(request_);
+    body_ = std::move(entry.body_);
+    trailers_ = std::move(entry.trailers_);
+    const uint64_t body_size = body_ != nullptr ? body_->size() : 0;
+    LookupResult result = entry.response_headers_
+                              ? request_.makeLookupResult(std::move(entry.response_headers_),
+                                                          std::move(entry.metadata_), body_size)
+                              : LookupResult{};
+    bool end_stream = body_size == 0 && trailers_ == nullptr;
+    dispatcher_.post([result = std::move(result), cb = std::move(cb), end_stream,
+                      cancelled = cancelled_]() mutable {
+      if (!*cancelled) {
+        std::move(cb)(std::move(result), end_stream);
+      }
+    });
+  }
+
+  void getBody(const AdjustedByteRange& range, LookupBodyCallback&& cb) override {
+    ASSERT(body_ != nullptr && range.end() <= body_->length(),
+           "Attempt to read past end of body.");
+    // The body is shared with the cache and immutable, so it is served by reference instead of
+    // copying; the fragment's releasor drops the reference once the data has been written out.
+    auto result = std::make_unique<Buffer::OwnedImpl>();
+    auto* fragment = new Buffer::BufferFragmentImpl(
+        body_->data() + range.begin(), range.length(),
+        [body = body_](const void*, size_t, const Buffer::BufferFragmentImpl* self) {
+          delete self;
+        });
+    result->addBufferFragment(*fragment);
+    bool end_stream = trailers_ == nullptr && range.end() == body_->length();
+    dispatcher_.post([result = std::move(result), cb = std::move(cb), end_stream,
+                      cancelled = cancelled_]() mutable {
+      if (!*cancelled) {
+        std::move(cb)(std::move(result), end_stream);
+      }
+    });
+  }
+
+  // The cache must call cb with the cached trailers.
+  void getTrailers(LookupTrailersCallback&& cb) override {
+    ASSERT(trailers_);
+    dispatcher_.post(
+        [cb = std::move(cb), trailers = std::move(trailers_), cancelled = cancelled_]() mutable {
+          if (!*cancelled) {
+            std::move(cb)(std::move(trailers));
+          }
+        });
+  }
+
+  const LookupRequest& request() const { return request_; }
+  void onDestroy() override { *cancelled_ = true; }
+  Event::Dispatcher& dispatcher() const { return dispatcher_; }
+
+private:
+  Event::Dispatcher& dispatcher_;
+  std::shared_ptr<bool> cancelled_ = std::make_shared<bool>(false);
+  ShardedLruHttpCache& cache_;
+  const LookupRequest request_;
+  std::shared_ptr<const std::string> body_;
+  Http::ResponseTrailerMapPtr trailers_;
+};
+
+class ShardedLruInsertContext : public InsertContext {
+public:
+  ShardedLruInsertContext(ShardedLruLookupContext& lookup_context, ShardedLruHttpCache& cache)
+      : dispatcher_(lookup_context.dispatcher()), key_(lookup_context.request().key()),
+        request_headers_(lookup_context.request().requestHeaders()),
+        vary_allow_list_(lookup_context.request().varyAllowList()), cache_(cache) {}
+
+  void post(InsertCallback cb, bool result) {
+    dispatcher_.post([cb = std::move(cb), result = result, cancelled = cancelled_]() mutable {
+      if (!*cancelled) {
+        std::move(cb)(result);
+      }
+    });
+  }
+
+  void insertHeaders(const Http::ResponseHeaderMap& response_headers,
+                     const ResponseMetadata& metadata, InsertCallback insert_success,
+                     bool end_stream) override {
+    ASSERT(!committed_);
+    response_headers_ = Http::createHeaderMap<Http::ResponseHeaderMapImpl>(response_headers);
+    metadata_ = metadata;
+    if (end_stream) {
+      post(std::move(insert_success), commit());
+    } else {
+      post(std::move(insert_success), true);
+    }
+  }
+
+  void insertBody(const Buffer::Instance& chunk, InsertCallback ready_for_next_chunk,
+                  bool end_stream) override {
+    ASSERT(!committed_);
+    ASSERT(ready_for_next_chunk || end_stream);
+
+    body_.add(chunk);
+    if (end_stream) {
+      post(std::move(ready_for_next_chunk), commit());
+    } else {
+      post(std::move(ready_for_next_chunk), true);
+    }
+  }
+
+  void insertTrailers(const Http::ResponseTrailerMap& trailers,
+                      InsertCallback insert_complete) override {
+    ASSERT(!committed_);
+    trailers_ = Http::createHeaderMap<Http::ResponseTrailerMapImpl>(trailers);
+    post(std::move(insert_complete), commit());
+  }
+
+  void onDestroy() override { *cancelled_ = true; }
+
+private:
+  bool commit() {
+    committed_ = true;
+    auto body = std::make_shared<const std::string>(body_.toString());
+    if (VaryHeaderUtils::hasVary(*response_headers_)) {
+      return cache_.varyInsert(key_, std::move(response_headers_), std::move(metadata_),
+                               std::move(body), request_headers_, vary_allow_list_,
+                               std::move(trailers_));
+    } else {
+      return cache_.insert(key_, std::move(response_headers_), std::move(metadata_),
+                           std::move(body), std::move(trailers_));
+    }
+  }
+
+  Event::Dispatcher& dispatcher_;
+  std::shared_ptr<bool> cancelled_ = std::make_shared<bool>(false);
+  Key key_;
+  const Http::RequestHeaderMap& request_headers_;
+  const VaryAllowList& vary_allow_list_;
+  Http::ResponseHeaderMapPtr response_headers_;
+  ResponseMetadata metadata_;
+  ShardedLruHttpCache& cache_;
+  Buffer::OwnedImpl body_;
+  bool committed_ = false;
+  Http::ResponseTrailerMapPtr trailers_;
+};
+
+} // namespace
+
+ShardedLruHttpCache::ShardedLruHttpCache(uint32_t shard_count, uint64_t max_cache_bytes) {
+  shard_count = std::max<uint32_t>(shard_count, 1);
+  const uint64_t shard_bytes = std::max<uint64_t>(max_cache_bytes / shard_count, 1);
+  shards_.reserve(shard_count);
+  for (uint32_t i = 0; i < shard_count; i++) {
+    shards_.push_back(std::make_unique<Shard>(
+        shard_bytes, std::max<uint64_t>(shard_bytes / SketchBytesPerEntry, 1024)));
+  }
+}
+
+ShardedLruHttpCache::Shard& ShardedLruHttpCache::shardForKey(uint64_t key_hash) {
+  // Remix so that shard selection uses different bits than the in-shard hash table.
+  const uint64_t mixed = key_hash * 0x9e3779b97f4a7c15;
+  return *shards_[(mixed >> 32) % shards_.size()];
+}
+
+uint64_t ShardedLruHttpCache::entrySize(const Key& key, const CacheEntry& entry) {
+  uint64_t size = EntryOverheadBytes + key.ByteSizeLong();
+  if (entry.response_headers_ != nullptr) {
+    size += entry.response_headers_->byteSize();
+  }
+  if (entry.body_ != nullptr) {
+    size += entry.body_->size();
+  }
+  if (entry.trailers_ != nullptr) {
+    size += entry.trailers_->byteSize();
+  }
+  return size;
+}
+
+bool ShardedLruHttpCache::makeRoom(Shard& shard, uint64_t needed_bytes,
+                                   uint64_t incoming_key_hash) {
+  while (shard.used_bytes_ + needed_bytes > shard.max_bytes_) {
+    ASSERT(!shard.lru_.empty());
+    const Key& victim_key = shard.lru_.back();
+    // TinyLFU admission: keep the victim if it has been used more than the newcomer, since
+    // replacing a popular entry with a one-hit wonder only churns the cache.
+    if (shard.sketch_.frequency(incoming_key_hash) < shard.sketch_.frequency(keyHash(victim_key))) {
+      return false;
+    }
+    auto victim = shard.map_.find(victim_key);
+    ASSERT(victim != shard.map_.end());
+    shard.used_bytes_ -= victim->second.size_bytes_;
+    shard.map_.erase(victim);
+    shard.lru_.pop_back();
+  }
+  return true;
+}
+
+bool ShardedLruHttpCache::insertEntry(const Key& key, CacheEntry&& entry) {
+  const uint64_t key_hash = keyHash(key);
+  Shard& shard = shardForKey(key_hash);
+  entry.size_bytes_ = entrySize(key, entry);
+  if (entry.size_bytes_ > shard.max_bytes_) {
+    // Could never fit even an empty shard.
+    return false;
+  }
+  absl::MutexLock lock(&shard.mutex_);
+  // An insertion attempt counts as an access for admission purposes.
+  shard.sketch_.record(key_hash);
+  auto existing = shard.map_.find(key);
+  if (existing != shard.map_.end()) {
+    shard.used_bytes_ -= existing->second.size_bytes_;
+    shard.lru_.erase(existing->second.lru_position_);
+    shard.map_.erase(existing);
+  }
+  if (!makeRoom(shard, entry.size_bytes_, key_hash)) {
+    return false;
+  }
+  shard.used_bytes_ += entry.size_bytes_;
+  shard.lru_.push_front(key);
+  entry.lru_position_ = shard.lru_.begin();
+  shard.map_.emplace(key, std::move(entry));
+  return true;
+}
+
+ShardedLruHttpCache::Entry ShardedLruHttpCache::lookupEntry(const Key& key) {
+  const uint64_t key_hash = keyHash(key);
+  Shard& shard = shardForKey(key_hash);
+  absl::MutexLock lock(&shard.mutex_);
+  auto iter = shard.map_.find(key);
+  if (iter == shard.map_.end()) {
+    return Entry{};
+  }
+  shard.sketch_.record(key_hash);
+  shard.lru_.splice(shard.lru_.begin(), shard.lru_, iter->second.lru_position_);
+  ASSERT(iter->second.response_headers_ != nullptr);
+  Http::ResponseTrailerMapPtr trailers_map;
+  if (iter->second.trailers_ != nullptr) {
+    trailers_map = Http::createHeaderMap<Http::ResponseTrailerMapImpl>(*iter->second.trailers_);
+  }
+  return Entry{Http::createHeaderMap<Http::ResponseHeaderMapImpl>(*iter->second.response_headers_),
+               iter->second.metadata_, iter->second.body_, std::move(trailers_map)};
+}
+
+ShardedLruHttpCache::Entry ShardedLruHttpCache::lookup(const LookupRequest& request) {
+  Entry entry = lookupEntry(request.key());
+  if (!entry.response_headers_) {
+    return Entry{};
+  }
+  if (VaryHeaderUtils::hasVary(*entry.response_headers_)) {
+    // The base entry only flags that responses vary; the actual response lives under the varied
+    // key, possibly in a different shard. Shard locks are never held across the two steps.
+    absl::optional<Key> varied_key = variedRequestKey(request, *entry.response_headers_);
+    if (!varied_key.has_value()) {
+      return Entry{};
+    }
+    return lookupEntry(varied_key.value());
+  }
+  return entry;
+}
+
+bool ShardedLruHttpCache::insert(const Key& key, Http::ResponseHeaderMapPtr&& response_headers,
+                                 ResponseMetadata&& metadata,
+                                 std::shared_ptr<const std::string> body,
+                                 Http::ResponseTrailerMapPtr&& trailers) {
+  CacheEntry entry;
+  entry.response_headers_ = std::move(response_headers);
+  entry.metadata_ = std::move(metadata);
+  entry.body_ = std::move(body);
+  entry.trailers_ = std::move(trailers);
+  return insertEntry(key, std::move(entry));
+}
+
+bool ShardedLruHttpCache::varyInsert(const Key& request_key,
+                                     Http::ResponseHeaderMapPtr&& response_headers,
+                                     ResponseMetadata&& metadata,
+                                     std::shared_ptr<const std::string> body,
+                                     const Http::RequestHeaderMap& request_headers,
+                                     const VaryAllowList& vary_allow_list,
+                                     Http::ResponseTrailerMapPtr&& trailers) {
+  absl::btree_set<absl::string_view> vary_header_values =
+      VaryHeaderUtils::getVaryValues(*response_headers);
+  ASSERT(!vary_header_values.empty());
+
+  const absl::optional<std::string> vary_identifier =
+      VaryHeaderUtils::createVaryIdentifier(vary_allow_list, vary_header_values, request_headers);
+  if (!vary_identifier.has_value()) {
+    // Skip the insert if we are unable to create a vary key.
+    return false;
+  }
+  Key varied_request_key = request_key;
+  varied_request_key.add_custom_fields(vary_identifier.value());
+  if (!insert(varied_request_key, std::move(response_headers), std::move(metadata),
+              std::move(body), std::move(trailers))) {
+    return false;
+  }
+
+  // Add a flag entry under the unvaried key so lookups know to re-derive the varied key. Only
+  // inserted if absent, to avoid resetting its LRU position from the write path.
+  const uint64_t key_hash = keyHash(request_key);
+  Shard& shard = shardForKey(key_hash);
+  {
+    absl::MutexLock lock(&shard.mutex_);
+    if (shard.map_.contains(request_key)) {
+      return true;
+    }
+  }
+  Http::ResponseHeaderMapPtr vary_only_map =
+      Http::createHeaderMap<Http::ResponseHeaderMapImpl>({});
+  vary_only_map->setCopy(Http::CustomHeaders::get().Vary, absl::StrJoin(vary_header_values, ","));
+  CacheEntry flag_entry;
+  flag_entry.response_headers_ = std::move(vary_only_map);
+  return insertEntry(request_key, std::move(flag_entry));
+}
+
+LookupContextPtr ShardedLruHttpCache::makeLookupContext(LookupRequest&& request,
+                                                        Http::StreamFilterCallbacks& callbacks) {
+  return std::make_unique<ShardedLruLookupContext>(callbacks.dispatcher(), *this,
+                                                   std::move(request));
+}
+
+InsertContextPtr ShardedLruHttpCache::makeInsertContext(LookupContextPtr&& lookup_context,
+                                                        Http::StreamFilterCallbacks&) {
+  ASSERT(lookup_context != nullptr);
+  auto ret = std::make_unique<ShardedLruInsertContext>(
+      dynamic_cast<ShardedLruLookupContext&>(*lookup_context), *this);
+  lookup_context->onDestroy();
+  return ret;
+}
+
+void ShardedLruHttpCache::updateHeaders(const LookupContext& lookup_context,
+                                        const Http::ResponseHeaderMap& response_headers,
+                                        const ResponseMetadata& metadata,
+                                        UpdateHeadersCallback on_complete) {
+  const auto& typed_lookup_context = static_cast<const ShardedLruLookupContext&>(lookup_context);
+  auto post_complete = [on_complete = std::move(on_complete),
+                        &dispatcher = typed_lookup_context.dispatcher()](bool result) mutable {
+    dispatcher.post([on_complete = std::move(on_complete), result]() mutable {
+      std::move(on_complete)(result);
+    });
+  };
+
+  Key key = typed_lookup_context.request().key();
+  {
+    // If responses vary, the update applies to the varied entry.
+    Entry base = lookupEntry(key);
+    if (!base.response_headers_) {
+      std::move(post_complete)(false);
+      return;
+    }
+    if (VaryHeaderUtils::hasVary(*base.response_headers_)) {
+      absl::optional<Key> varied_key =
+          variedRequestKey(typed_lookup_context.request(), *base.response_headers_);
+      if (!varied_key.has_value()) {
+        std::move(post_complete)(false);
+        return;
+      }
+      key = std::move(varied_key).value();
+    }
+  }
+
+  const uint64_t key_hash = keyHash(key);
+  Shard& shard = shardForKey(key_hash);
+  absl::MutexLock lock(&shard.mutex_);
+  auto iter = shard.map_.find(key);
+  if (iter == shard.map_.end() || iter->second.response_headers_ == nullptr) {
+    std::move(post_complete)(false);
+    return;
+  }
+  CacheEntry& entry = iter->second;
+  applyHeaderUpdate(response_headers, *entry.response_headers_);
+  entry.metadata_ = metadata;
+  // Header updates may change the accounted size slightly; adjust without evicting.
+  const uint64_t new_size = entrySize(key, entry);
+  shard.used_bytes_ += new_size - entry.size_bytes_;
+  entry.size_bytes_ = new_size;
+  std::move(post_complete)(true);
+}
+
+CacheInfo ShardedLruHttpCache::cacheInfo() const {
+  CacheInfo cache_info;
+  cache_info.name_ = Name;
+  return cache_info;
+}
+
+namespace {
+
+// Caches are shared between filter configurations with identical settings, so a configuration
+// reload does not drop a warm cache.
+class CacheSingleton : public Singleton::Instance {
+public:
+  std::shared_ptr<ShardedLruHttpCache> get(const ConfigProto& config) {
+    absl::MutexLock lock(&mutex_);
+    auto& weak = caches_[config.SerializeAsString()];
+    std::shared_ptr<ShardedLruHttpCache> cache = weak.lock();
+    if (cache == nullptr) {
+      cache = std::make_shared<ShardedLruHttpCache>(
+          PROTOBUF_GET_WRAPPED_OR_DEFAULT(config, shards, DefaultShards),
+          PROTOBUF_GET_WRAPPED_OR_DEFAULT(config, max_cache_bytes, DefaultMaxCacheBytes));
+      weak = cache;
+    }
+    return cache;
+  }
+
+private:
+  absl::Mutex mutex_;
+  absl::flat_hash_map<std::string, std::weak_ptr<ShardedLruHttpCache>>
+      caches_ ABSL_GUARDED_BY(mutex_);
+};
+
+SINGLETON_MANAGER_REGISTRATION(sharded_lru_http_cache_singleton);
+
+class ShardedLruHttpCacheFactory : public HttpCacheFactory {
+public:
+  // From UntypedFactory
+  std::string name() const override { return std::string(Name); }
+  // From TypedFactory
+  ProtobufTypes::MessagePtr createEmptyConfigProto() override {
+    return std::make_unique<ConfigProto>();
+  }
+  // From HttpCacheFactory
+  std::shared_ptr<HttpCache>
+  getCache(const envoy::extensions::filters::http::cache::v3::CacheConfig& filter_config,
+           Server::Configuration::FactoryContext& context) override {
+    ConfigProto config;
+    THROW_IF_NOT_OK(MessageUtil::unpackTo(filter_config.typed_config(), config));
+    auto caches =
+        context.serverFactoryContext().singletonManager().getTyped<CacheSingleton>(
+            SINGLETON_MANAGER_REGISTERED_NAME(sharded_lru_http_cache_singleton),
+            [] { return std::make_shared<CacheSingleton>(); });
+    return caches->get(config);
+  }
+};
+
+static Registry::RegisterFactory<ShardedLruHttpCacheFactory, HttpCacheFactory> register_;
+
+} // namespace
+} // namespace ShardedLruHttpCache
+} // namespace Cache
+} // namespace HttpFilters
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "source/common/protobuf/utility.h"
+#include "source/extensions/filters/http/cache/http_cache.h"
+#include "source/extensions/http/cache/sharded_lru_http_cache/frequency_sketch.h"
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace HttpFilters {
+namespace Cache {
+namespace ShardedLruHttpCache {
+
+/**
+ * In-memory cache backend designed for production request rates. The key space is split across
+ * independently locked shards, each shard evicts in least-recently-used order within an equal
+ * slice of the byte budget, and admission on a full shard is frequency-based (TinyLFU): an
+ * insertion whose key is less popular than the eviction victim is rejected instead of churning
+ * the cache. Bodies are stored as reference-counted immutable strings so lookups serve them
+ * without copying.
+ */
+class ShardedLruHttpCache : public HttpCache, public Singleton::Instance {
+public:
+  ShardedLruHttpCache(uint32_t shard_count, uint64_t max_cache_bytes);
+
+  // A snapshot of a cached response handed to lookup contexts. Headers and trailers are copies;
+  // the body is shared with the cache and must be treated as immutable.
+  struct Entry {
+    Http::ResponseHeaderMapPtr response_headers_;
+    ResponseMetadata metadata_;
+    std::shared_ptr<const std::string> body_;
+    Http::ResponseTrailerMapPtr trailers_;
+  };
+
+  // HttpCache
+  LookupContextPtr makeLookupContext(LookupRequest&& request,
+                                     Http::StreamFilterCallbacks& callbacks) override;
+  InsertContextPtr makeInsertContext(LookupContextPtr&& lookup_context,
+                                     Http::StreamFilterCallbacks& callbacks) override;
+  void updateHeaders(const LookupContext& lookup_context,
+                     const Http::ResponseHeaderMap& response_headers,
+                     const ResponseMetadata& metadata, UpdateHeadersCallback on_complete) override;
+  CacheInfo cacheInfo() const override;
+
+  Entry lookup(const LookupRequest& request);
+  bool insert(const Key& key, Http::ResponseHeaderMapPtr&& response_headers,
+              ResponseMetadata&& metadata, std::shared_ptr<const std::string> body,
+              Http::ResponseTrailerMapPtr&& trailers);
+
+  // Inserts a response that has been varied on certain headers.
+  bool varyInsert(const Key& request_key, Http::ResponseHeaderMapPtr&& response_headers,
+                  ResponseMetadata&& metadata, std::shared_ptr<const std::string> body,
+                  const Http::RequestHeaderMap& request_headers,
+                  const VaryAllowList& vary_allow_list, Http::ResponseTrailerMapPtr&& trailers);
+
+private:
+  struct CacheEntry {
+    Http::ResponseHeaderMapPtr response_headers_;
+    ResponseMetadata metadata_;
+    std::shared_ptr<const std::string> body_;
+    Http::ResponseTrailerMapPtr trailers_;
+    uint64_t size_bytes_{};
+    // Position in the shard's LRU list, most recently used at the front.
+    std::list<Key>::iterator lru_position_;
+  };
+
+  struct Shard {
+    Shard(uint64_t max_bytes, uint64_t sketch_capacity)
+        : max_bytes_(max_bytes), sketch_(sketch_capacity) {}
+
+    absl::Mutex mutex_;
+    absl::flat_hash_map<Key, CacheEntry, MessageUtil, MessageUtil> map_ ABSL_GUARDED_BY(mutex_);
+    std::list<Key> lru_ ABSL_GUARDED_BY(mutex_);
+    uint64_t used_bytes_ ABSL_GUARDED_BY(mutex_){};
+    const uint64_t max_bytes_;
+    FrequencySketch sketch_ ABSL_GUARDED_BY(mutex_);
+  };
+
+  static uint64_t keyHash(const Key& key) { return MessageUtil{}(key); }
+  Shard& shardForKey(uint64_t key_hash);
+
+  // Copies the entry stored under `key`, bumping it in the LRU and recording the access in the
+  // admission sketch.
+  Entry lookupEntry(const Key& key);
+  // Inserts `entry` under `key`, evicting LRU victims as needed. Returns false if the entry does
+  // not fit the shard budget or loses the admission comparison against a victim.
+  bool insertEntry(const Key& key, CacheEntry&& entry);
+  // Evicts LRU victims until `needed_bytes` fit. Returns false if the incoming key is less
+  // popular than a victim, in which case nothing is evicted.
+  bool makeRoom(Shard& shard, uint64_t needed_bytes, uint64_t incoming_key_hash)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mutex_);
+
+  static uint64_t entrySize(const Key& key, const CacheEntry& entry);
+
+  std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+} // namespace ShardedLruHttpCache
+} // namespace Cache
+} // namespace HttpFilters
+} // namespace Extensions
+} // namespace Envoy
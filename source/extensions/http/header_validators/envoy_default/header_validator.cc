@@ -195,15 +195,23 @@ HeaderValidator::validateGenericHeaderName(const HeaderString& name) {
       config_.headers_with_underscores_action() == HeaderValidatorConfig::REJECT_REQUEST;
   bool is_valid = true;
   bool reject_due_to_underscore = false;
-  char c = '\0';
 
-  for (auto iter = key_string_view.begin();
-       iter != key_string_view.end() && is_valid && !reject_due_to_underscore; ++iter) {
-    c = *iter;
-    if (c != '_') {
-      is_valid &= testCharInTable(::Envoy::Http::kGenericHeaderNameCharTable, c);
-    } else {
-      reject_due_to_underscore = reject_header_names_with_underscores;
+  if (!reject_header_names_with_underscores) {
+    // The name character table permits underscores, so when they do not have to be singled out
+    // the whole name can go through the bulk scan shared with the codecs.
+    is_valid = ::Envoy::Http::kGenericHeaderNameBulkValidator.allCharsInTable(key_string_view);
+  } else {
+    // When underscores cause rejection the scan must stop at the first offending character so
+    // that a name containing both an invalid character and a later underscore is still reported
+    // as invalid rather than underscore-rejected.
+    for (auto iter = key_string_view.begin();
+         iter != key_string_view.end() && is_valid && !reject_due_to_underscore; ++iter) {
+      const char c = *iter;
+      if (c != '_') {
+        is_valid &= testCharInTable(::Envoy::Http::kGenericHeaderNameCharTable, c);
+      } else {
+        reject_due_to_underscore = true;
+      }
     }
   }
 
@@ -236,14 +244,9 @@ HeaderValidator::validateGenericHeaderValue(const HeaderString& value) {
   //
   // VCHAR          =  %x21-7E
   //                   ; visible (printing) characters
-  const auto& value_string_view = value.getStringView();
-  bool is_valid = true;
-
-  for (auto iter = value_string_view.begin(); iter != value_string_view.end() && is_valid; ++iter) {
-    is_valid &= testCharInTable(kGenericHeaderValueCharTable, *iter);
-  }
-
-  if (!is_valid) {
+  static constexpr ::Envoy::Http::CharTableBulkValidator bulk_validator{
+      kGenericHeaderValueCharTable};
+  if (!bulk_validator.allCharsInTable(value.getStringView())) {
     return {HeaderValueValidationResult::Action::Reject,
             UhvResponseCodeDetail::get().InvalidValueCharacters};
   }
@@ -15,7 +15,7 @@ void CookieBasedSessionStateFactory::SessionStateImpl::onUpdate(
   if (!upstream_address_.has_value() || host_address != upstream_address_.value()) {
     // Build proto message
     envoy::Cookie cookie;
-    cookie.set_address(std::string(host_address));
+    cookie.set_address(host_address.data(), host_address.size());
     if (factory_.ttl_ != std::chrono::seconds::zero()) {
       const auto expiry_time = std::chrono::duration_cast<std::chrono::seconds>(
           (time_source_.monotonicTime() + std::chrono::seconds(factory_.ttl_)).time_since_epoch());
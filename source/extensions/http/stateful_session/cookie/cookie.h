@@ -61,14 +61,15 @@ private:
     if (cookie_value.empty()) {
       return absl::nullopt;
     }
-    const std::string decoded_value = Envoy::Base64::decode(cookie_value);
+    std::string decoded_value = Envoy::Base64::decode(cookie_value);
     std::string address;
 
     // Try to interpret the cookie as proto payload.
     // Otherwise treat it as "old" style format, which is ip-address:port.
     envoy::Cookie cookie;
     if (cookie.ParseFromString(decoded_value)) {
-      address = cookie.address();
+      // Move the address out of the proto rather than copying it; this runs per request.
+      address = std::move(*cookie.mutable_address());
       if (address.empty()) {
         return absl::nullopt;
       }
@@ -86,7 +87,7 @@ private:
     } else {
       ENVOY_LOG_ONCE_MISC(
           warn, "Non-proto cookie format detected. This format will be rejected in the future.");
-      address = decoded_value;
+      address = std::move(decoded_value);
     }
 
     return address.empty() ? absl::nullopt : absl::make_optional(std::move(address));
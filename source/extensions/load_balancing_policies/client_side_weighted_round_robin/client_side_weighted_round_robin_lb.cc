@@ -70,7 +70,8 @@ ClientSideWeightedRoundRobinLoadBalancer::WorkerLocalLb::chooseHost(LoadBalancer
 
 ClientSideWeightedRoundRobinLoadBalancer::OrcaLoadReportHandler::OrcaLoadReportHandler(
     const ClientSideWeightedRoundRobinLbConfig& lb_config, TimeSource& time_source)
-    : metric_names_for_computing_utilization_(lb_config.metric_names_for_computing_utilization),
+    : metric_selectors_(
+          Orca::parseLoadReportMetricNames(lb_config.metric_names_for_computing_utilization)),
       error_utilization_penalty_(lb_config.error_utilization_penalty), time_source_(time_source) {}
 
 absl::Status ClientSideWeightedRoundRobinLoadBalancer::OrcaLoadReportHandler::onOrcaLoadReport(
@@ -179,16 +180,14 @@ ClientSideWeightedRoundRobinLoadBalancer::getClientSideWeightIfValidFromHost(
 
 double
 ClientSideWeightedRoundRobinLoadBalancer::OrcaLoadReportHandler::getUtilizationFromOrcaReport(
-    const OrcaLoadReportProto& orca_load_report,
-    const std::vector<std::string>& metric_names_for_computing_utilization) {
+    const OrcaLoadReportProto& orca_load_report, const Orca::LoadReportMetricSelectors& selectors) {
   // If application_utilization is valid, use it as the utilization metric.
   double utilization = orca_load_report.application_utilization();
   if (utilization > 0) {
     return utilization;
   }
   // Otherwise, find the most constrained utilization metric.
-  utilization =
-      Envoy::Orca::getMaxUtilization(metric_names_for_computing_utilization, orca_load_report);
+  utilization = Envoy::Orca::getMaxUtilization(selectors, orca_load_report);
   if (utilization > 0) {
     return utilization;
   }
@@ -198,16 +197,14 @@ ClientSideWeightedRoundRobinLoadBalancer::OrcaLoadReportHandler::getUtilizationF
 
 absl::StatusOr<uint32_t>
 ClientSideWeightedRoundRobinLoadBalancer::OrcaLoadReportHandler::calculateWeightFromOrcaReport(
-    const OrcaLoadReportProto& orca_load_report,
-    const std::vector<std::string>& metric_names_for_computing_utilization,
+    const OrcaLoadReportProto& orca_load_report, const Orca::LoadReportMetricSelectors& selectors,
     double error_utilization_penalty) {
   double qps = orca_load_report.rps_fractional();
   if (qps <= 0) {
     return absl::InvalidArgumentError("QPS must be positive");
   }
 
-  double utilization =
-      getUtilizationFromOrcaReport(orca_load_report, metric_names_for_computing_utilization);
+  double utilization = getUtilizationFromOrcaReport(orca_load_report, selectors);
   // If there are errors, then increase utilization to lower the weight.
   utilization += error_utilization_penalty * orca_load_report.eps() / qps;
 
@@ -229,7 +226,7 @@ absl::Status ClientSideWeightedRoundRobinLoadBalancer::OrcaLoadReportHandler::
     updateClientSideDataFromOrcaLoadReport(const OrcaLoadReportProto& orca_load_report,
                                            ClientSideHostLbPolicyData& client_side_data) {
   const absl::StatusOr<uint32_t> weight = calculateWeightFromOrcaReport(
-      orca_load_report, metric_names_for_computing_utilization_, error_utilization_penalty_);
+      orca_load_report, metric_selectors_, error_utilization_penalty_);
   if (!weight.ok()) {
     return weight.status();
   }
@@ -3,6 +3,7 @@
 #include "envoy/extensions/load_balancing_policies/client_side_weighted_round_robin/v3/client_side_weighted_round_robin.pb.h"
 #include "envoy/upstream/upstream.h"
 
+#include "source/common/orca/orca_load_metrics.h"
 #include "source/extensions/load_balancing_policies/common/load_balancer_impl.h"
 #include "source/extensions/load_balancing_policies/round_robin/round_robin_lb.h"
 
@@ -107,18 +108,16 @@ public:
     absl::Status onOrcaLoadReport(const OrcaLoadReportProto& orca_load_report,
                                   const HostDescription& host_description) override;
 
-    // Get utilization from `orca_load_report` using named metrics specified in
-    // `metric_names_for_computing_utilization`.
-    static double getUtilizationFromOrcaReport(
-        const OrcaLoadReportProto& orca_load_report,
-        const std::vector<std::string>& metric_names_for_computing_utilization);
+    // Get utilization from `orca_load_report` using the pre-parsed utilization metric selectors.
+    static double getUtilizationFromOrcaReport(const OrcaLoadReportProto& orca_load_report,
+                                               const Orca::LoadReportMetricSelectors& selectors);
 
     // Calculate client side weight from `orca_load_report` using `getUtilizationFromOrcaReport()`,
     // QPS, EPS and `error_utilization_penalty`.
-    static absl::StatusOr<uint32_t> calculateWeightFromOrcaReport(
-        const OrcaLoadReportProto& orca_load_report,
-        const std::vector<std::string>& metric_names_for_computing_utilization,
-        double error_utilization_penalty);
+    static absl::StatusOr<uint32_t>
+    calculateWeightFromOrcaReport(const OrcaLoadReportProto& orca_load_report,
+                                  const Orca::LoadReportMetricSelectors& selectors,
+                                  double error_utilization_penalty);
 
     // Update client side data from `orca_load_report`. Invoked from `onOrcaLoadReport` callback on
     // the worker thread.
@@ -126,7 +125,9 @@ public:
     updateClientSideDataFromOrcaLoadReport(const OrcaLoadReportProto& orca_load_report,
                                            ClientSideHostLbPolicyData& client_side_data);
 
-    const std::vector<std::string> metric_names_for_computing_utilization_;
+    // Utilization metric names from the config, parsed once so that each report is scanned
+    // without re-matching metric name strings.
+    const Orca::LoadReportMetricSelectors metric_selectors_;
     const double error_utilization_penalty_;
     TimeSource& time_source_;
   };
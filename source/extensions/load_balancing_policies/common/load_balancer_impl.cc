@@ -1,5 +1,6 @@
 #include "source/extensions/load_balancing_policies/common/load_balancer_impl.h"
 
+#include <algorithm>
 #include <atomic>
 #include <bitset>
 #include <cstdint>
@@ -450,6 +451,10 @@ ZoneAwareLoadBalancerBase::ZoneAwareLoadBalancerBase(
 void ZoneAwareLoadBalancerBase::regenerateLocalityRoutingStructures() {
   ASSERT(local_priority_set_);
   stats_.lb_recalculate_zone_structures_.inc();
+  // Capture the local cluster's availability here rather than re-deriving it from host counts on
+  // every pick; it only changes when the local or upstream host sets change, which is exactly when
+  // this method runs.
+  local_cluster_availability_percent_ = hostSetAvailabilityPercent(localHostSet());
   // resizePerPriorityState should ensure these stay in sync.
   ASSERT(per_priority_state_.size() == priority_set_.hostSetsPerPriority().size());
 
@@ -607,18 +612,18 @@ HostConstSharedPtr ZoneAwareLoadBalancerBase::chooseHost(LoadBalancerContext* co
 bool LoadBalancerBase::isHostSetInPanic(const HostSet& host_set) const {
   uint64_t global_panic_threshold = std::min<uint64_t>(
       100, runtime_.snapshot().getInteger(RuntimePanicThreshold, default_healthy_panic_percent_));
+  // If the % of healthy hosts in the cluster is less than our panic threshold, we use all hosts.
+  return hostSetAvailabilityPercent(host_set) < global_panic_threshold;
+}
+
+double LoadBalancerBase::hostSetAvailabilityPercent(const HostSet& host_set) {
   const auto host_count = host_set.hosts().size() - host_set.excludedHosts().size();
-  double healthy_percent =
+  const double healthy_percent =
       host_count == 0 ? 0.0 : 100.0 * host_set.healthyHosts().size() / host_count;
 
-  double degraded_percent =
+  const double degraded_percent =
       host_count == 0 ? 0.0 : 100.0 * host_set.degradedHosts().size() / host_count;
-  // If the % of healthy hosts in the cluster is less than our panic threshold, we use all hosts.
-  if ((healthy_percent + degraded_percent) < global_panic_threshold) {
-    return true;
-  }
-
-  return false;
+  return healthy_percent + degraded_percent;
 }
 
 absl::FixedArray<ZoneAwareLoadBalancerBase::LocalityPercentages>
@@ -706,19 +711,17 @@ uint32_t ZoneAwareLoadBalancerBase::tryChooseLocalLocalityHosts(const HostSet& h
   // additional capacity in localities.
   uint64_t threshold = random_.random() % state.residual_capacity_[number_of_localities - 1];
 
-  // This potentially can be optimized to be O(log(N)) where N is the number of localities.
-  // Linear scan should be faster for smaller N, in most of the scenarios N will be small.
+  // The capacities are accumulating, so the locality owning the sampled value is the first one
+  // whose cumulative capacity exceeds it, found with a binary search:
   //
   // Bucket 1: [0, state.residual_capacity_[0] - 1]
   // Bucket 2: [state.residual_capacity_[0], state.residual_capacity_[1] - 1]
   // ...
   // Bucket N: [state.residual_capacity_[N-2], state.residual_capacity_[N-1] - 1]
-  int i = 0;
-  while (threshold >= state.residual_capacity_[i]) {
-    i++;
-  }
-
-  return i;
+  const auto it = std::upper_bound(state.residual_capacity_.begin(),
+                                   state.residual_capacity_.end(), threshold);
+  ASSERT(it != state.residual_capacity_.end());
+  return static_cast<uint32_t>(std::distance(state.residual_capacity_.begin(), it));
 }
 
 absl::optional<ZoneAwareLoadBalancerBase::HostsSource>
@@ -791,7 +794,11 @@ ZoneAwareLoadBalancerBase::hostSourceToUse(LoadBalancerContext* context, uint64_
     return hosts_source;
   }
 
-  if (isHostSetInPanic(localHostSet())) {
+  // Check if the local Envoy cluster is in panic using the availability percent captured on the
+  // last update, so the pick path does not recompute it from host counts.
+  const uint64_t local_panic_threshold = std::min<uint64_t>(
+      100, runtime_.snapshot().getInteger(RuntimePanicThreshold, default_healthy_panic_percent_));
+  if (local_cluster_availability_percent_ < local_panic_threshold) {
     stats_.lb_local_cluster_not_ok_.inc();
     // If the local Envoy instances are in global panic, and we should not fail traffic, do
     // not do locality based routing.
@@ -905,19 +912,29 @@ void EdfLoadBalancerBase::recalculateHostsInSlowStart(const HostVector& hosts) {
 }
 
 void EdfLoadBalancerBase::refresh(uint32_t priority) {
-  const auto add_hosts_source = [this](HostsSource source, const HostVector& hosts) {
+  const auto& host_set = priority_set_.hostSetsPerPriority()[priority];
+
+  // Every hosts source refreshed below is a subset of the host set's full host list, so the
+  // per-source work that only depends on host state is hoisted out of the per-source loop: hosts
+  // need just one slow start scan per refresh, and if the full host list has uniform weights then
+  // so does every subset, which lets us skip the per-source weight scans entirely.
+  if (isSlowStartEnabled()) {
+    recalculateHostsInSlowStart(host_set->hosts());
+  }
+  const bool all_weights_equal = hostWeightsAreEqual(host_set->hosts());
+  const bool edf_skippable = !alwaysUseEdfScheduler() && noHostsAreInSlowStart();
+
+  const auto add_hosts_source = [this, all_weights_equal,
+                                 edf_skippable](HostsSource source, const HostVector& hosts) {
     // Nuke existing scheduler if it exists.
     auto& scheduler = scheduler_[source] = Scheduler{};
     refreshHostSource(source);
-    if (isSlowStartEnabled()) {
-      recalculateHostsInSlowStart(hosts);
-    }
 
     // Check if the original host weights are equal and no hosts are in slow start mode, in that
     // case EDF creation is skipped. When all original weights are equal and no hosts are in slow
     // start mode we can rely on unweighted host pick to do optimal round robin and least-loaded
     // host selection with lower memory and CPU overhead.
-    if (!alwaysUseEdfScheduler() && hostWeightsAreEqual(hosts) && noHostsAreInSlowStart()) {
+    if (edf_skippable && (all_weights_equal || hostWeightsAreEqual(hosts))) {
       // Skip edf creation.
       return;
     }
@@ -943,7 +960,6 @@ void EdfLoadBalancerBase::refresh(uint32_t priority) {
         [this](const Host& host) { return hostWeight(host); }, seed_));
   };
   // Populate EdfSchedulers for each valid HostsSource value for the host set at this priority.
-  const auto& host_set = priority_set_.hostSetsPerPriority()[priority];
   add_hosts_source(HostsSource(priority, HostsSource::SourceType::AllHosts), host_set->hosts());
   add_hosts_source(HostsSource(priority, HostsSource::SourceType::HealthyHosts),
                    host_set->healthyHosts());
@@ -132,6 +132,12 @@ protected:
    */
   bool isHostSetInPanic(const HostSet& host_set) const;
 
+  /**
+   * @return the percentage of hosts in the host set that are available (healthy or degraded),
+   * which panic decisions compare against the panic threshold.
+   */
+  static double hostSetAvailabilityPercent(const HostSet& host_set);
+
   /**
    * Method is called when all host sets are in panic mode.
    * In such state the load is distributed based on the number of hosts
@@ -433,6 +439,10 @@ private:
   using PerPriorityStatePtr = std::unique_ptr<PerPriorityState>;
   // Routing state broken out for each priority level in priority_set_.
   std::vector<PerPriorityStatePtr> per_priority_state_;
+  // Availability percent of the local host set, captured whenever the locality routing structures
+  // are regenerated so per-pick local panic checks avoid re-deriving it from host counts. Only
+  // consulted when locality routing is active, which guarantees it has been computed.
+  double local_cluster_availability_percent_{0.0};
   Common::CallbackHandlePtr priority_update_cb_;
   Common::CallbackHandlePtr local_priority_set_member_update_cb_handle_;
 
@@ -69,13 +69,45 @@ LegacyMaglevLbConfig::LegacyMaglevLbConfig(const ClusterProto& cluster) {
 
 TypedMaglevLbConfig::TypedMaglevLbConfig(const MaglevLbProto& lb_config) : lb_config_(lb_config) {}
 
+uint64_t
+MaglevLoadBalancer::tableFingerprint(const NormalizedHostWeightVector& normalized_host_weights,
+                                     double max_normalized_weight) const {
+  // Fold in everything the table build consumes: the hash key and normalized weight of each host
+  // (in build order) and the maximum normalized weight. Table size and the hashing mode are fixed
+  // per load balancer instance, and the table representation choice is a pure function of the
+  // host count, so neither needs to be part of the fingerprint.
+  uint64_t fingerprint = HashUtil::xxHash64Value(normalized_host_weights.size());
+  fingerprint = HashUtil::xxHash64Value(max_normalized_weight, fingerprint);
+  for (const auto& host_weight : normalized_host_weights) {
+    fingerprint = HashUtil::xxHash64(
+        ThreadAwareLoadBalancerBase::HashingLoadBalancer::hashKey(host_weight.first,
+                                                                  use_hostname_for_hashing_),
+        fingerprint);
+    fingerprint = HashUtil::xxHash64Value(host_weight.second, fingerprint);
+  }
+  return fingerprint;
+}
+
 ThreadAwareLoadBalancerBase::HashingLoadBalancerSharedPtr
 MaglevLoadBalancer::createLoadBalancer(const NormalizedHostWeightVector& normalized_host_weights,
                                        double /* min_normalized_weight */,
                                        double max_normalized_weight) {
-  HashingLoadBalancerSharedPtr maglev_lb =
-      MaglevFactory::createMaglevTable(normalized_host_weights, max_normalized_weight, table_size_,
-                                       use_hostname_for_hashing_, stats_);
+  // Rebuilding the table costs O(table size) with collision probing even when nothing relevant
+  // changed, and health/metadata-only membership updates commonly leave the hashing inputs
+  // untouched. Fingerprint the build inputs and reuse the previous (immutable, shared) table
+  // when they match, so steady-state churn that does not move table contents skips the rebuild.
+  const uint64_t fingerprint = tableFingerprint(normalized_host_weights, max_normalized_weight);
+  HashingLoadBalancerSharedPtr maglev_lb;
+  const auto cache_it = table_cache_.find(fingerprint);
+  if (cache_it != table_cache_.end()) {
+    maglev_lb = cache_it->second.lock();
+  }
+  if (maglev_lb == nullptr) {
+    maglev_lb = MaglevFactory::createMaglevTable(normalized_host_weights, max_normalized_weight,
+                                                 table_size_, use_hostname_for_hashing_, stats_);
+    absl::erase_if(table_cache_, [](const auto& entry) { return entry.second.expired(); });
+    table_cache_[fingerprint] = maglev_lb;
+  }
 
   if (hash_balance_factor_ == 0) {
     return maglev_lb;
@@ -12,6 +12,8 @@
 #include "source/common/common/bit_array.h"
 #include "source/extensions/load_balancing_policies/common/thread_aware_lb_impl.h"
 
+#include "absl/container/flat_hash_map.h"
+
 namespace Envoy {
 namespace Upstream {
 
@@ -192,17 +194,30 @@ public:
   uint64_t tableSize() const { return table_size_; }
 
 private:
+  friend class MaglevLoadBalancerTestPeer;
+
   // ThreadAwareLoadBalancerBase
   HashingLoadBalancerSharedPtr
   createLoadBalancer(const NormalizedHostWeightVector& normalized_host_weights,
                      double /* min_normalized_weight */, double max_normalized_weight) override;
   static MaglevLoadBalancerStats generateStats(Stats::Scope& scope);
 
+  /**
+   * Fingerprint of the inputs that determine the contents of a Maglev table. Two builds with the
+   * same fingerprint produce identical tables.
+   */
+  uint64_t tableFingerprint(const NormalizedHostWeightVector& normalized_host_weights,
+                            double max_normalized_weight) const;
+
   Stats::ScopeSharedPtr scope_;
   MaglevLoadBalancerStats stats_;
   const uint64_t table_size_;
   const bool use_hostname_for_hashing_;
   const uint32_t hash_balance_factor_;
+  // Previously built tables keyed by build-input fingerprint. Values are weak so a table is freed
+  // as soon as neither the factory state nor any worker references it; expired entries are pruned
+  // whenever a new table is built.
+  absl::flat_hash_map<uint64_t, std::weak_ptr<HashingLoadBalancer>> table_cache_;
 };
 
 } // namespace Upstream
@@ -8,6 +8,7 @@
 #include "envoy/runtime/runtime.h"
 
 #include "source/common/common/assert.h"
+#include "source/common/common/hash.h"
 #include "source/common/config/metadata.h"
 #include "source/common/config/well_known_names.h"
 #include "source/common/protobuf/utility.h"
@@ -19,6 +20,11 @@ namespace Upstream {
 
 namespace {
 
+// Bounds the number of distinct metadata match criteria whose subset lookups are cached per load
+// balancer. 0 (the default) disables the cache.
+constexpr absl::string_view MatchCacheMaxEntriesRuntime =
+    "upstream.subset_lb.match_cache_max_entries";
+
 /**
  * Iterates all the selectors and finds the first one that match_criteria contains all the keys
  * of the selector. Returns nullptr if no selector matches, otherwise returns sub match criteria
@@ -369,7 +375,7 @@ HostConstSharedPtr SubsetLoadBalancer::tryChooseHostFromContext(LoadBalancerCont
   }
 
   // Route has metadata match criteria defined, see if we have a matching subset.
-  LbSubsetEntryPtr entry = findSubset(match_criteria->metadataMatchCriteria());
+  LbSubsetEntryPtr entry = findSubsetCached(match_criteria->metadataMatchCriteria());
   if (entry == nullptr || !entry->active()) {
     // No matching subset or subset not active: use fallback policy.
     return nullptr;
@@ -419,6 +425,54 @@ SubsetLoadBalancer::LbSubsetEntryPtr SubsetLoadBalancer::findSubset(
   return nullptr;
 }
 
+// Consults the match cache before falling back to the trie walk in findSubset. The combined hash
+// covers each criterion's key and its pre-computed value hash, so a cache hit costs one hash and
+// one equality check regardless of how deep the matched entry sits in the subset hierarchy.
+SubsetLoadBalancer::LbSubsetEntryPtr SubsetLoadBalancer::findSubsetCached(
+    const std::vector<Router::MetadataMatchCriterionConstSharedPtr>& match_criteria) {
+  const uint64_t max_entries = runtime_.snapshot().getInteger(MatchCacheMaxEntriesRuntime, 0);
+  if (max_entries == 0) {
+    return findSubset(match_criteria);
+  }
+
+  uint64_t hash = 0;
+  for (const auto& criterion : match_criteria) {
+    hash = HashUtil::xxHash64(criterion->name(), hash);
+    hash = HashUtil::xxHash64Value(criterion->value().hash(), hash);
+  }
+
+  const auto cache_it = match_cache_.find(hash);
+  if (cache_it != match_cache_.end()) {
+    const MatchCacheEntry& cached = cache_it->second;
+    const bool criteria_equal =
+        cached.criteria_.size() == match_criteria.size() &&
+        std::equal(cached.criteria_.begin(), cached.criteria_.end(), match_criteria.begin(),
+                   [](const std::pair<std::string, HashedValue>& cached_criterion,
+                      const Router::MetadataMatchCriterionConstSharedPtr& criterion) {
+                     return cached_criterion.first == criterion->name() &&
+                            cached_criterion.second == criterion->value();
+                   });
+    if (criteria_equal) {
+      stats_.lb_subsets_match_cache_hit_.inc();
+      return cached.entry_;
+    }
+    // Distinct criteria collided on the combined hash; refresh the slot with the new criteria.
+    match_cache_.erase(cache_it);
+  }
+
+  LbSubsetEntryPtr entry = findSubset(match_criteria);
+  if (match_cache_.size() < max_entries) {
+    MatchCacheEntry cached;
+    cached.criteria_.reserve(match_criteria.size());
+    for (const auto& criterion : match_criteria) {
+      cached.criteria_.emplace_back(criterion->name(), criterion->value());
+    }
+    cached.entry_ = entry;
+    match_cache_.emplace(hash, std::move(cached));
+  }
+  return entry;
+}
+
 void SubsetLoadBalancer::updateFallbackSubset(uint32_t priority, const HostVector& all_hosts) {
   auto update_func = [priority, &all_hosts](LbSubsetPtr& subset, const HostPredicate& predicate,
                                             uint64_t seed) {
@@ -523,6 +577,9 @@ void SubsetLoadBalancer::processSubsets(uint32_t priority, const HostVector& all
 // Given the latest all hosts, update all subsets for this priority level, creating new subsets as
 // necessary.
 void SubsetLoadBalancer::update(uint32_t priority, const HostVector& all_hosts) {
+  // Host updates create, repopulate and purge subset entries, so any cached lookup results may be
+  // stale after this point.
+  match_cache_.clear();
   updateFallbackSubset(priority, all_hosts);
   processSubsets(priority, all_hosts);
 }
@@ -24,6 +24,7 @@
 #include "source/common/upstream/upstream_impl.h"
 #include "source/extensions/load_balancing_policies/subset/subset_lb_config.h"
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/container/node_hash_map.h"
 #include "absl/types/optional.h"
 
@@ -356,6 +357,8 @@ private:
 
   LbSubsetEntryPtr
   findSubset(const std::vector<Router::MetadataMatchCriterionConstSharedPtr>& matches);
+  LbSubsetEntryPtr
+  findSubsetCached(const std::vector<Router::MetadataMatchCriterionConstSharedPtr>& matches);
 
   LbSubsetEntryPtr findOrCreateLbSubsetEntry(LbSubsetMap& subsets, const SubsetMetadata& kvs,
                                              uint32_t idx);
@@ -395,8 +398,21 @@ private:
   LbSubsetEntryPtr fallback_subset_;
   LbSubsetEntryPtr panic_mode_subset_;
 
+  // Cached result of a subset lookup for one specific set of metadata match criteria. The criteria
+  // are stored alongside the resolved entry to guard against hash collisions; the entry may be
+  // nullptr for criteria that matched no subset.
+  struct MatchCacheEntry {
+    std::vector<std::pair<std::string, HashedValue>> criteria_;
+    LbSubsetEntryPtr entry_;
+  };
+
   // Forms a trie-like structure. Requires lexically sorted Host and Route metadata.
   LbSubsetMap subsets_;
+  // Maps the combined hash of a request's metadata match criteria to the subset entry resolved by
+  // walking subsets_, so that repeated picks with identical criteria cost a single hash lookup over
+  // the criteria's pre-computed value hashes. Cleared on every host update and capped by the
+  // `upstream.subset_lb.match_cache_max_entries` runtime key; empty when the cache is disabled.
+  absl::flat_hash_map<uint64_t, MatchCacheEntry> match_cache_;
   // Forms a trie-like structure of lexically sorted keys+fallback policy from subset
   // selectors configuration
   SubsetSelectorMapPtr selectors_;
@@ -0,0 +1,36 @@
+#include "source/extensions/network/connection_balance/load_aware/config.h"
+
+#include <chrono>
+
+#include "envoy/common/exception.h"
+#include "envoy/config/core/v3/extension.pb.h"
+
+#include "source/common/protobuf/utility.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace LoadAware {
+
+Network::ConnectionBalancerSharedPtr
+LoadAwareConnectionBalanceFactory::createConnectionBalancerFromProto(
+    const Protobuf::Message& config, Server::Configuration::FactoryContext& context) {
+  const auto& typed_config =
+      dynamic_cast<const envoy::config::core::v3::TypedExtensionConfig&>(config);
+  const auto balance_config = MessageUtil::anyConvertAndValidate<
+      envoy::extensions::network::connection_balance::load_aware::v3::LoadAwareConfig>(
+      typed_config.typed_config(), context.messageValidationVisitor());
+  const std::chrono::milliseconds delay_cost_reference(
+      DurationUtil::durationToMilliseconds(balance_config.delay_cost_reference()));
+  if (delay_cost_reference.count() == 0) {
+    throwEnvoyExceptionOrPanic(
+        "load aware connection balancer: delay_cost_reference must be at least 1ms");
+  }
+  return std::make_shared<LoadAwareConnectionBalancerImpl>(
+      delay_cost_reference, context.serverFactoryContext().timeSource());
+}
+
+REGISTER_FACTORY(LoadAwareConnectionBalanceFactory, Network::ConnectionBalanceFactory);
+
+} // namespace LoadAware
+} // namespace Extensions
+} // namespace Envoy
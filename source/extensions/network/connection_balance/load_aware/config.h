@@ -0,0 +1,32 @@
+#pragma once
+
+#include "envoy/extensions/network/connection_balance/load_aware/v3/load_aware.pb.h"
+#include "envoy/extensions/network/connection_balance/load_aware/v3/load_aware.pb.validate.h"
+#include "envoy/registry/registry.h"
+
+#include "source/common/network/connection_balancer_impl.h"
+#include "source/extensions/network/connection_balance/load_aware/load_aware_balancer.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace LoadAware {
+
+class LoadAwareConnectionBalanceFactory : public Network::ConnectionBalanceFactory {
+public:
+  Network::ConnectionBalancerSharedPtr
+  createConnectionBalancerFromProto(const Protobuf::Message& config,
+                                    Server::Configuration::FactoryContext& context) override;
+
+  ProtobufTypes::MessagePtr createEmptyConfigProto() override {
+    return std::make_unique<
+        envoy::extensions::network::connection_balance::load_aware::v3::LoadAwareConfig>();
+  }
+
+  std::string name() const override { return "envoy.network.connection_balance.load_aware"; }
+};
+
+DECLARE_FACTORY(LoadAwareConnectionBalanceFactory);
+
+} // namespace LoadAware
+} // namespace Extensions
+} // namespace Envoy
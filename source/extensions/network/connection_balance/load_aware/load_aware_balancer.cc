@@ -0,0 +1,52 @@
+#include "source/extensions/network/connection_balance/load_aware/load_aware_balancer.h"
+
+#include <algorithm>
+
+namespace Envoy {
+namespace Extensions {
+namespace LoadAware {
+
+LoadAwareConnectionBalancerImpl::LoadAwareConnectionBalancerImpl(
+    std::chrono::milliseconds delay_cost_reference, TimeSource& time_source)
+    : delay_cost_reference_(delay_cost_reference), time_source_(time_source) {}
+
+void LoadAwareConnectionBalancerImpl::registerHandler(Network::BalancedConnectionHandler& handler) {
+  absl::MutexLock lock(&lock_);
+  handlers_.push_back(&handler);
+}
+
+void LoadAwareConnectionBalancerImpl::unregisterHandler(
+    Network::BalancedConnectionHandler& handler) {
+  absl::MutexLock lock(&lock_);
+  handlers_.erase(std::find(handlers_.begin(), handlers_.end(), &handler));
+}
+
+Network::BalancedConnectionHandler&
+LoadAwareConnectionBalancerImpl::pickTargetHandler(Network::BalancedConnectionHandler&) {
+  const MonotonicTime now = time_source_.monotonicTime();
+  Network::BalancedConnectionHandler* best_handler = nullptr;
+  double best_score = 0;
+  {
+    absl::MutexLock lock(&lock_);
+    for (Network::BalancedConnectionHandler* handler : handlers_) {
+      // Scale the handler's connection count by how far its worker's event loop has fallen
+      // behind: a worker that is delay_cost_reference behind is charged double for each of its
+      // connections. The +1 keeps a stalled but empty worker comparable to busy responsive ones
+      // rather than always winning with a score of zero.
+      const std::chrono::duration<double> delay = handler->timeSinceLastLoopActivity(now);
+      const double score = (handler->numConnections() + 1) * (1.0 + delay / delay_cost_reference_);
+      if (best_handler == nullptr || score < best_score) {
+        best_handler = handler;
+        best_score = score;
+      }
+    }
+
+    best_handler->incNumConnections(); // NOLINT(clang-analyzer-core.CallAndMessage)
+  }
+
+  return *best_handler;
+}
+
+} // namespace LoadAware
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <chrono>
+#include <vector>
+
+#include "envoy/common/time.h"
+#include "envoy/network/connection_balancer.h"
+
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace LoadAware {
+
+/**
+ * Implementation of a connection balancer that weighs connections by worker load. Like the exact
+ * balancer a lock is held during balancing, but instead of comparing raw connection counts each
+ * handler's count is scaled by how far the owning worker's event loop has fallen behind, steering
+ * new accepts away from workers that are saturated by expensive long-lived connections. A worker
+ * whose event loop is delay_cost_reference behind is charged double for each of its connections.
+ */
+class LoadAwareConnectionBalancerImpl : public Network::ConnectionBalancer {
+public:
+  LoadAwareConnectionBalancerImpl(std::chrono::milliseconds delay_cost_reference,
+                                  TimeSource& time_source);
+
+  // Network::ConnectionBalancer
+  void registerHandler(Network::BalancedConnectionHandler& handler) override;
+  void unregisterHandler(Network::BalancedConnectionHandler& handler) override;
+  Network::BalancedConnectionHandler&
+  pickTargetHandler(Network::BalancedConnectionHandler& current_handler) override;
+
+private:
+  const std::chrono::duration<double> delay_cost_reference_;
+  TimeSource& time_source_;
+  absl::Mutex lock_;
+  std::vector<Network::BalancedConnectionHandler*> handlers_ ABSL_GUARDED_BY(lock_);
+};
+
+} // namespace LoadAware
+} // namespace Extensions
+} // namespace Envoy
@@ -14,6 +14,7 @@
 #include "source/common/api/os_sys_calls_impl.h"
 #include "source/common/common/assert.h"
 #include "source/common/common/fmt.h"
+#include "source/common/common/hash.h"
 #include "source/common/common/thread.h"
 #include "source/common/network/address_impl.h"
 #include "source/common/network/resolver_impl.h"
@@ -36,6 +37,8 @@ DnsResolverImpl::DnsResolverImpl(
       use_resolvers_as_fallback_(config.use_resolvers_as_fallback()),
       udp_max_queries_(
           static_cast<uint32_t>(PROTOBUF_GET_WRAPPED_OR_DEFAULT(config, udp_max_queries, 0))),
+      query_channels_(std::max<uint32_t>(
+          1, static_cast<uint32_t>(PROTOBUF_GET_WRAPPED_OR_DEFAULT(config, query_channels, 1)))),
       resolvers_csv_(resolvers_csv),
       filter_unroutable_families_(config.filter_unroutable_families()),
       scope_(root_scope.createScope("dns.cares.")), stats_(generateCaresDnsResolverStats(*scope_)) {
@@ -46,6 +49,9 @@ DnsResolverImpl::DnsResolverImpl(
 DnsResolverImpl::~DnsResolverImpl() {
   timer_->disableTimer();
   ares_destroy(channel_);
+  for (ares_channel extra : extra_channels_) {
+    ares_destroy(extra);
+  }
 }
 
 CaresDnsResolverStats DnsResolverImpl::generateCaresDnsResolverStats(Stats::Scope& scope) {
@@ -124,19 +130,33 @@ bool DnsResolverImpl::isCaresDefaultTheOnlyNameserver() {
   return has_only_default_nameserver;
 }
 
-void DnsResolverImpl::initializeChannel(ares_options* options, int optmask) {
-  dirty_channel_ = false;
-
+ares_channel DnsResolverImpl::initializeAresChannel(ares_options* options, int optmask) {
   options->sock_state_cb = [](void* arg, os_fd_t fd, int read, int write) {
     static_cast<DnsResolverImpl*>(arg)->onAresSocketStateChange(fd, read, write);
   };
   options->sock_state_cb_data = this;
-  ares_init_options(&channel_, options, optmask | ARES_OPT_SOCK_STATE_CB);
+  ares_channel channel;
+  ares_init_options(&channel, options, optmask | ARES_OPT_SOCK_STATE_CB);
+  return channel;
+}
+
+void DnsResolverImpl::initializeChannel(ares_options* options, int optmask) {
+  dirty_channel_ = false;
+
+  channel_ = initializeAresChannel(options, optmask);
+  // All channels are (re)created together; callers must have destroyed any previous channels.
+  if (extra_channels_.empty() && query_channels_ > 1) {
+    extra_channels_.resize(query_channels_ - 1);
+  }
+  for (ares_channel& extra : extra_channels_) {
+    extra = initializeAresChannel(options, optmask);
+  }
 
   if (resolvers_csv_.has_value()) {
     bool use_resolvers = true;
     // If the only name server available is c-ares' default then fallback to the user defined
-    // resolvers. Otherwise, use the resolvers provided by c-ares.
+    // resolvers. Otherwise, use the resolvers provided by c-ares. All channels are initialized
+    // from the same options and system state, so the decision applies to every channel.
     if (use_resolvers_as_fallback_ && !isCaresDefaultTheOnlyNameserver()) {
       use_resolvers = false;
     }
@@ -144,10 +164,22 @@ void DnsResolverImpl::initializeChannel(ares_options* options, int optmask) {
     if (use_resolvers) {
       int result = ares_set_servers_ports_csv(channel_, resolvers_csv_->c_str());
       RELEASE_ASSERT(result == ARES_SUCCESS, "");
+      for (ares_channel extra : extra_channels_) {
+        result = ares_set_servers_ports_csv(extra, resolvers_csv_->c_str());
+        RELEASE_ASSERT(result == ARES_SUCCESS, "");
+      }
     }
   }
 }
 
+ares_channel DnsResolverImpl::channelForHost(absl::string_view dns_name) {
+  if (extra_channels_.empty()) {
+    return channel_;
+  }
+  const uint64_t shard = HashUtil::xxHash64(dns_name) % (extra_channels_.size() + 1);
+  return shard == 0 ? channel_ : extra_channels_[shard - 1];
+}
+
 // Treat responses with `ARES_ENODATA` or `ARES_ENOTFOUND` status as DNS response with no records.
 // @see DnsResolverImpl::PendingResolution::onAresGetAddrInfoCallback for details.
 bool DnsResolverImpl::AddrInfoPendingResolution::isResponseWithNoRecords(int status) {
@@ -341,14 +373,26 @@ void DnsResolverImpl::PendingResolution::finishResolve() {
 }
 
 void DnsResolverImpl::updateAresTimer() {
-  // Update the timeout for events.
-  timeval timeout;
-  timeval* timeout_result = ares_timeout(channel_, nullptr, &timeout);
-  if (timeout_result != nullptr) {
-    const auto ms =
-        std::chrono::milliseconds(timeout_result->tv_sec * 1000 + timeout_result->tv_usec / 1000);
-    ENVOY_LOG(trace, "Setting DNS resolution timer for {} milliseconds", ms.count());
-    timer_->enableTimer(ms);
+  // Update the timeout for events, using the soonest timeout across all channels.
+  absl::optional<std::chrono::milliseconds> ms;
+  const auto consider_channel = [&ms](ares_channel channel) {
+    timeval timeout;
+    timeval* timeout_result = ares_timeout(channel, nullptr, &timeout);
+    if (timeout_result != nullptr) {
+      const std::chrono::milliseconds channel_ms(timeout_result->tv_sec * 1000 +
+                                                 timeout_result->tv_usec / 1000);
+      if (!ms.has_value() || channel_ms < *ms) {
+        ms = channel_ms;
+      }
+    }
+  };
+  consider_channel(channel_);
+  for (ares_channel extra : extra_channels_) {
+    consider_channel(extra);
+  }
+  if (ms.has_value()) {
+    ENVOY_LOG(trace, "Setting DNS resolution timer for {} milliseconds", ms->count());
+    timer_->enableTimer(*ms);
   } else {
     timer_->disableTimer();
   }
@@ -357,7 +401,12 @@ void DnsResolverImpl::updateAresTimer() {
 void DnsResolverImpl::onEventCallback(os_fd_t fd, uint32_t events) {
   const ares_socket_t read_fd = events & Event::FileReadyType::Read ? fd : ARES_SOCKET_BAD;
   const ares_socket_t write_fd = events & Event::FileReadyType::Write ? fd : ARES_SOCKET_BAD;
+  // Sockets are not tracked per channel: c-ares ignores an fd it does not own (aside from
+  // processing that channel's timeouts), so the event can be handed to every channel.
   ares_process_fd(channel_, read_fd, write_fd);
+  for (ares_channel extra : extra_channels_) {
+    ares_process_fd(extra, read_fd, write_fd);
+  }
   updateAresTimer();
 }
 
@@ -397,12 +446,15 @@ ActiveDnsQuery* DnsResolverImpl::resolve(const std::string& dns_name,
   // @see DnsResolverImpl::PendingResolution::onAresGetAddrInfoCallback for why this is done.
   if (dirty_channel_) {
     ares_destroy(channel_);
+    for (ares_channel extra : extra_channels_) {
+      ares_destroy(extra);
+    }
     AresOptions options = defaultAresOptions();
     initializeChannel(&options.options_, options.optmask_);
   }
 
   auto pending_resolution = std::make_unique<AddrInfoPendingResolution>(
-      *this, callback, dispatcher_, channel_, dns_name, dns_lookup_family);
+      *this, callback, dispatcher_, channelForHost(dns_name), dns_name, dns_lookup_family);
   pending_resolution->startResolution();
   if (pending_resolution->completed_) {
     // Resolution does not need asynchronous behavior or network events. For
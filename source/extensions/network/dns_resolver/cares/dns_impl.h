@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "envoy/common/platform.h"
 #include "envoy/event/dispatcher.h"
@@ -15,6 +16,7 @@
 #include "source/common/network/dns_resolver/dns_factory_util.h"
 
 #include "absl/container/node_hash_map.h"
+#include "absl/strings/string_view.h"
 #include "ares.h"
 
 namespace Envoy {
@@ -179,8 +181,13 @@ private:
   // c-ares callback when a socket state changes, indicating that libevent
   // should listen for read/write events.
   void onAresSocketStateChange(os_fd_t fd, int read, int write);
-  // Initialize the channel.
+  // Initialize the channel (and the extra channels when query sharding is configured).
   void initializeChannel(ares_options* options, int optmask);
+  // Create and configure a single c-ares channel.
+  ares_channel initializeAresChannel(ares_options* options, int optmask);
+  // Return the channel responsible for the given hostname. Queries for the same hostname always
+  // map to the same channel so that its sockets and per-server state are reused.
+  ares_channel channelForHost(absl::string_view dns_name);
   // Check if the only nameserver available is the c-ares default.
   bool isCaresDefaultTheOnlyNameserver();
   // Update timer for c-ares timeouts.
@@ -193,12 +200,16 @@ private:
   Event::Dispatcher& dispatcher_;
   Event::TimerPtr timer_;
   ares_channel channel_;
+  // Additional channels when query_channels > 1. Queries are sharded by hostname hash across
+  // channel_ and these; see channelForHost().
+  std::vector<ares_channel> extra_channels_;
   bool dirty_channel_{};
   envoy::config::core::v3::DnsResolverOptions dns_resolver_options_;
 
   absl::node_hash_map<int, Event::FileEventPtr> events_;
   const bool use_resolvers_as_fallback_;
   const uint32_t udp_max_queries_;
+  const uint32_t query_channels_;
   const absl::optional<std::string> resolvers_csv_;
   const bool filter_unroutable_families_;
   Stats::ScopeSharedPtr scope_;
@@ -0,0 +1,30 @@
+#include "source/extensions/resource_monitors/worker_saturation/config.h"
+
+#include "envoy/extensions/resource_monitors/worker_saturation/v3/worker_saturation.pb.h"
+#include "envoy/extensions/resource_monitors/worker_saturation/v3/worker_saturation.pb.validate.h"
+#include "envoy/registry/registry.h"
+
+#include "source/common/protobuf/utility.h"
+#include "source/extensions/resource_monitors/worker_saturation/worker_saturation_monitor.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace ResourceMonitors {
+namespace WorkerSaturationMonitor {
+
+Server::ResourceMonitorPtr WorkerSaturationMonitorFactory::createResourceMonitorFromProtoTyped(
+    const envoy::extensions::resource_monitors::worker_saturation::v3::WorkerSaturationConfig&
+        config,
+    Server::Configuration::ResourceMonitorFactoryContext& context) {
+  return std::make_unique<WorkerSaturationMonitor>(config, context.api().timeSource());
+}
+
+/**
+ * Static registration for the worker saturation resource monitor factory. @see RegistryFactory.
+ */
+REGISTER_FACTORY(WorkerSaturationMonitorFactory, Server::Configuration::ResourceMonitorFactory);
+
+} // namespace WorkerSaturationMonitor
+} // namespace ResourceMonitors
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "envoy/extensions/resource_monitors/worker_saturation/v3/worker_saturation.pb.h"
+#include "envoy/extensions/resource_monitors/worker_saturation/v3/worker_saturation.pb.validate.h"
+#include "envoy/server/resource_monitor_config.h"
+
+#include "source/extensions/resource_monitors/common/factory_base.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace ResourceMonitors {
+namespace WorkerSaturationMonitor {
+
+class WorkerSaturationMonitorFactory
+    : public Common::FactoryBase<
+          envoy::extensions::resource_monitors::worker_saturation::v3::WorkerSaturationConfig> {
+public:
+  WorkerSaturationMonitorFactory() : FactoryBase("envoy.resource_monitors.worker_saturation") {}
+
+private:
+  Server::ResourceMonitorPtr createResourceMonitorFromProtoTyped(
+      const envoy::extensions::resource_monitors::worker_saturation::v3::WorkerSaturationConfig&
+          config,
+      Server::Configuration::ResourceMonitorFactoryContext& context) override;
+};
+
+} // namespace WorkerSaturationMonitor
+} // namespace ResourceMonitors
+} // namespace Extensions
+} // namespace Envoy
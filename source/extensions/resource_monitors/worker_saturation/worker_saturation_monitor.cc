@@ -0,0 +1,51 @@
+#include "source/extensions/resource_monitors/worker_saturation/worker_saturation_monitor.h"
+
+#include <algorithm>
+
+#include "source/common/common/fmt.h"
+#include "source/common/event/loop_liveness_registry.h"
+#include "source/common/protobuf/utility.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace ResourceMonitors {
+namespace WorkerSaturationMonitor {
+
+WorkerSaturationMonitor::WorkerSaturationMonitor(
+    const envoy::extensions::resource_monitors::worker_saturation::v3::WorkerSaturationConfig&
+        config,
+    TimeSource& time_source)
+    : saturation_loop_delay_(DurationUtil::durationToMilliseconds(config.saturation_loop_delay())),
+      min_loop_delay_(config.has_min_loop_delay()
+                          ? DurationUtil::durationToMilliseconds(config.min_loop_delay())
+                          : 0),
+      time_source_(time_source) {
+  if (saturation_loop_delay_ <= min_loop_delay_) {
+    throw EnvoyException(
+        fmt::format("worker saturation monitor: saturation_loop_delay ({}ms) must be greater "
+                    "than min_loop_delay ({}ms)",
+                    saturation_loop_delay_.count(), min_loop_delay_.count()));
+  }
+}
+
+void WorkerSaturationMonitor::updateResourceUsage(Server::ResourceUpdateCallbacks& callbacks) {
+  const absl::optional<MonotonicTime::duration> max_delay =
+      Event::LoopLivenessRegistry::instance().maxTimeSinceLastActivity(
+          time_source_.monotonicTime());
+
+  Server::ResourceUsage usage;
+  usage.resource_pressure_ = 0.0;
+  // No registered loops (e.g. before workers have started) reports zero pressure.
+  if (max_delay.has_value() && *max_delay > min_loop_delay_) {
+    const double range =
+        std::chrono::duration<double>(saturation_loop_delay_ - min_loop_delay_).count();
+    const double excess = std::chrono::duration<double>(*max_delay - min_loop_delay_).count();
+    usage.resource_pressure_ = std::min(excess / range, 1.0);
+  }
+  callbacks.onSuccess(usage);
+}
+
+} // namespace WorkerSaturationMonitor
+} // namespace ResourceMonitors
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <chrono>
+
+#include "envoy/common/time.h"
+#include "envoy/extensions/resource_monitors/worker_saturation/v3/worker_saturation.pb.h"
+#include "envoy/server/resource_monitor.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace ResourceMonitors {
+namespace WorkerSaturationMonitor {
+
+/**
+ * Reports the worst event-loop delay across the main and worker threads as overload pressure.
+ * The delay is read from Event::LoopLivenessRegistry, which every watchdog-registered dispatcher
+ * feeds at least once per loop iteration, and maps linearly from min_loop_delay (pressure 0) to
+ * saturation_loop_delay (pressure 1).
+ */
+class WorkerSaturationMonitor : public Server::ResourceMonitor {
+public:
+  WorkerSaturationMonitor(
+      const envoy::extensions::resource_monitors::worker_saturation::v3::WorkerSaturationConfig&
+          config,
+      TimeSource& time_source);
+
+  void updateResourceUsage(Server::ResourceUpdateCallbacks& callbacks) override;
+
+private:
+  const std::chrono::milliseconds saturation_loop_delay_;
+  const std::chrono::milliseconds min_loop_delay_;
+  TimeSource& time_source_;
+};
+
+} // namespace WorkerSaturationMonitor
+} // namespace ResourceMonitors
+} // namespace Extensions
+} // namespace Envoy
@@ -51,6 +51,13 @@ MetricsExportRequestPtr OtlpMetricsFlusherImpl::flush(Stats::MetricSnapshot& sna
                                  snapshot.snapshotTime().time_since_epoch())
                                  .count();
 
+  // Reserve for the upper bound (the predicate may exclude some metrics) so the repeated field
+  // does not repeatedly reallocate while the snapshot is flushed.
+  scope_metrics->mutable_metrics()->Reserve(
+      static_cast<int>(snapshot.gauges().size() + snapshot.hostGauges().size() +
+                       snapshot.counters().size() + snapshot.hostCounters().size() +
+                       snapshot.histograms().size()));
+
   for (const auto& gauge : snapshot.gauges()) {
     if (predicate_(gauge)) {
       flushGauge(*scope_metrics->add_metrics(), gauge.get(), snapshot_time_ns);
@@ -132,8 +139,11 @@ void OtlpMetricsFlusherImpl::flushHistogram(opentelemetry::proto::metrics::v1::M
   // TODO(ohadvano): support min/max optional fields for ``HistogramDataPoint``
 
   std::vector<uint64_t> bucket_counts = histogram_stats.computeDisjointBuckets();
-  for (size_t i = 0; i < histogram_stats.supportedBuckets().size(); i++) {
-    data_point->add_explicit_bounds(histogram_stats.supportedBuckets()[i]);
+  const std::vector<double>& supported_buckets = histogram_stats.supportedBuckets();
+  data_point->mutable_explicit_bounds()->Reserve(static_cast<int>(supported_buckets.size()));
+  data_point->mutable_bucket_counts()->Reserve(static_cast<int>(supported_buckets.size() + 1));
+  for (size_t i = 0; i < supported_buckets.size(); i++) {
+    data_point->add_explicit_bounds(supported_buckets[i]);
     data_point->add_bucket_counts(bucket_counts[i]);
   }
 
@@ -150,11 +160,16 @@ void OtlpMetricsFlusherImpl::setMetricCommon(
     const StatType& stat) const {
   data_point.set_time_unix_nano(snapshot_time_ns);
   // TODO(ohadvano): support ``start_time_unix_nano`` optional field
-  metric.set_name(absl::StrCat(config_->statPrefix(), config_->useTagExtractedName()
-                                                          ? stat.tagExtractedName()
-                                                          : stat.name()));
+  if (config_->statPrefix().empty()) {
+    metric.set_name(config_->useTagExtractedName() ? stat.tagExtractedName() : stat.name());
+  } else {
+    metric.set_name(absl::StrCat(config_->statPrefix(), config_->useTagExtractedName()
+                                                            ? stat.tagExtractedName()
+                                                            : stat.name()));
+  }
 
   if (config_->emitTagsAsAttributes()) {
+    data_point.mutable_attributes()->Reserve(static_cast<int>(stat.tags().size()));
     for (const auto& tag : stat.tags()) {
       auto* attribute = data_point.add_attributes();
       attribute->set_key(tag.name_);
@@ -169,11 +184,16 @@ void OtlpMetricsFlusherImpl::setMetricCommon(
     const Stats::Metric& stat) const {
   data_point.set_time_unix_nano(snapshot_time_ns);
   // TODO(ohadvano): support ``start_time_unix_nano optional`` field
-  metric.set_name(absl::StrCat(config_->statPrefix(), config_->useTagExtractedName()
-                                                          ? stat.tagExtractedName()
-                                                          : stat.name()));
+  if (config_->statPrefix().empty()) {
+    metric.set_name(config_->useTagExtractedName() ? stat.tagExtractedName() : stat.name());
+  } else {
+    metric.set_name(absl::StrCat(config_->statPrefix(), config_->useTagExtractedName()
+                                                            ? stat.tagExtractedName()
+                                                            : stat.name()));
+  }
 
   if (config_->emitTagsAsAttributes()) {
+    data_point.mutable_attributes()->Reserve(static_cast<int>(stat.tags().size()));
     for (const auto& tag : stat.tags()) {
       auto* attribute = data_point.add_attributes();
       attribute->set_key(tag.name_);
@@ -80,7 +80,8 @@ void Span::finishSpan() {
   span_.set_end_time_unix_nano(
       std::chrono::nanoseconds(time_source_.systemTime().time_since_epoch()).count());
   if (sampled()) {
-    parent_tracer_.sendSpan(span_);
+    // The span is done at this point, so hand the proto to the tracer without copying it.
+    parent_tracer_.sendSpan(std::move(span_));
   }
 }
 
@@ -112,15 +113,10 @@ void Span::setAttribute(absl::string_view name, const OTelAttribute& attribute_v
       return;
     }
   }
-  // If we haven't found an existing match already, we can add a new key/value.
-  opentelemetry::proto::common::v1::KeyValue key_value =
-      opentelemetry::proto::common::v1::KeyValue();
-  opentelemetry::proto::common::v1::AnyValue value_proto =
-      opentelemetry::proto::common::v1::AnyValue();
-  OtlpUtils::populateAnyValue(value_proto, attribute_value);
-  key_value.set_key(std::string{name});
-  *key_value.mutable_value() = value_proto;
-  *span_.add_attributes() = key_value;
+  // If we haven't found an existing match already, we can add a new key/value in place.
+  opentelemetry::proto::common::v1::KeyValue* key_value = span_.add_attributes();
+  key_value->set_key(std::string{name});
+  OtlpUtils::populateAnyValue(*key_value->mutable_value(), attribute_value);
 }
 
 ::opentelemetry::proto::trace::v1::Status_StatusCode
@@ -226,8 +222,10 @@ void Tracer::flushSpans() {
   *scope_span->mutable_scope()->mutable_name() = "envoy";
   *scope_span->mutable_scope()->mutable_version() = Envoy::VersionInfo::version();
 
-  for (const auto& pending_span : span_buffer_) {
-    (*scope_span->add_spans()) = pending_span;
+  for (auto& pending_span : span_buffer_) {
+    // The buffer is cleared below, so the pending spans can be swapped into the request instead
+    // of being serialized through a deep copy.
+    scope_span->add_spans()->Swap(&pending_span);
   }
   if (exporter_) {
     tracing_stats_.spans_sent_.add(span_buffer_.size());
@@ -241,8 +239,8 @@ void Tracer::flushSpans() {
   span_buffer_.clear();
 }
 
-void Tracer::sendSpan(::opentelemetry::proto::trace::v1::Span& span) {
-  span_buffer_.push_back(span);
+void Tracer::sendSpan(::opentelemetry::proto::trace::v1::Span&& span) {
+  span_buffer_.push_back(std::move(span));
   const uint64_t min_flush_spans =
       runtime_.snapshot().getInteger("tracing.opentelemetry.min_flush_spans", 5U);
   if (span_buffer_.size() >= min_flush_spans) {
@@ -255,18 +253,19 @@ Tracing::SpanPtr Tracer::startSpan(const std::string& operation_name, SystemTime
                                    OptRef<const Tracing::TraceContext> trace_context,
                                    OTelSpanKind span_kind) {
   // Create an Tracers::OpenTelemetry::Span class that will contain the OTel span.
-  Span new_span(operation_name, start_time, time_source_, *this, span_kind);
+  auto new_span =
+      std::make_unique<Span>(operation_name, start_time, time_source_, *this, span_kind);
   uint64_t trace_id_high = random_.random();
   uint64_t trace_id = random_.random();
-  new_span.setTraceId(absl::StrCat(Hex::uint64ToHex(trace_id_high), Hex::uint64ToHex(trace_id)));
+  new_span->setTraceId(absl::StrCat(Hex::uint64ToHex(trace_id_high), Hex::uint64ToHex(trace_id)));
   uint64_t span_id = random_.random();
-  new_span.setId(Hex::uint64ToHex(span_id));
+  new_span->setId(Hex::uint64ToHex(span_id));
   if (sampler_) {
-    callSampler(sampler_, absl::nullopt, new_span, operation_name, trace_context);
+    callSampler(sampler_, absl::nullopt, *new_span, operation_name, trace_context);
   } else {
-    new_span.setSampled(tracing_decision.traced);
+    new_span->setSampled(tracing_decision.traced);
   }
-  return std::make_unique<Span>(new_span);
+  return new_span;
 }
 
 Tracing::SpanPtr Tracer::startSpan(const std::string& operation_name, SystemTime start_time,
@@ -274,25 +273,26 @@ Tracing::SpanPtr Tracer::startSpan(const std::string& operation_name, SystemTime
                                    OptRef<const Tracing::TraceContext> trace_context,
                                    OTelSpanKind span_kind) {
   // Create a new span and populate details from the span context.
-  Span new_span(operation_name, start_time, time_source_, *this, span_kind);
-  new_span.setTraceId(previous_span_context.traceId());
+  auto new_span =
+      std::make_unique<Span>(operation_name, start_time, time_source_, *this, span_kind);
+  new_span->setTraceId(previous_span_context.traceId());
   if (!previous_span_context.parentId().empty()) {
-    new_span.setParentId(previous_span_context.parentId());
+    new_span->setParentId(previous_span_context.parentId());
   }
   // Generate a new identifier for the span id.
   uint64_t span_id = random_.random();
-  new_span.setId(Hex::uint64ToHex(span_id));
+  new_span->setId(Hex::uint64ToHex(span_id));
   if (sampler_) {
     // Sampler should make a sampling decision and set tracestate
-    callSampler(sampler_, previous_span_context, new_span, operation_name, trace_context);
+    callSampler(sampler_, previous_span_context, *new_span, operation_name, trace_context);
   } else {
     // Respect the previous span's sampled flag.
-    new_span.setSampled(previous_span_context.sampled());
+    new_span->setSampled(previous_span_context.sampled());
     if (!previous_span_context.tracestate().empty()) {
-      new_span.setTracestate(std::string{previous_span_context.tracestate()});
+      new_span->setTracestate(std::string{previous_span_context.tracestate()});
     }
   }
-  return std::make_unique<Span>(new_span);
+  return new_span;
 }
 
 } // namespace OpenTelemetry
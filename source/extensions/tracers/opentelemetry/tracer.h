@@ -41,7 +41,7 @@ public:
          OpenTelemetryTracerStats tracing_stats, const ResourceConstSharedPtr resource,
          SamplerSharedPtr sampler);
 
-  void sendSpan(::opentelemetry::proto::trace::v1::Span& span);
+  void sendSpan(::opentelemetry::proto::trace::v1::Span&& span);
 
   Tracing::SpanPtr startSpan(const std::string& operation_name, SystemTime start_time,
 
@@ -119,7 +119,7 @@ AdminImpl::AdminImpl(const std::string& profile_path, Server::Instance& server,
       route_config_provider_(server.timeSource()),
       scoped_route_config_provider_(server.timeSource()), clusters_handler_(server),
       config_dump_handler_(config_tracker_, server), init_dump_handler_(server),
-      stats_handler_(server), logs_handler_(server), profiling_handler_(profile_path),
+      stats_handler_(server), logs_handler_(server), profiling_handler_(server, profile_path),
       runtime_handler_(server), listeners_handler_(server), server_cmd_handler_(server),
       server_info_handler_(server),
       // TODO(jsedgwick) add /runtime_reset endpoint that removes all admin-set values
@@ -156,7 +156,13 @@ AdminImpl::AdminImpl(const std::string& profile_path, Server::Instance& server,
                       {{Admin::ParamDescriptor::Type::Enum,
                         "enable",
                         "enables the CPU profiler",
-                        {"y", "n"}}}),
+                        {"y", "n"}},
+                       {Admin::ParamDescriptor::Type::String, "seconds",
+                        "duration after which the profiler is automatically stopped; requires "
+                        "enable=y"}}),
+          makeHandler("/cpuprofiler_output", "download the most recently captured CPU profile",
+                      MAKE_ADMIN_HANDLER(profiling_handler_.handlerCpuProfilerOutput), false,
+                      false),
           makeHandler("/heapprofiler", "enable/disable the heap profiler",
                       MAKE_ADMIN_HANDLER(profiling_handler_.handlerHeapProfiler), false, true,
                       {{Admin::ParamDescriptor::Type::Enum,
@@ -223,19 +229,7 @@ AdminImpl::AdminImpl(const std::string& profile_path, Server::Instance& server,
           makeHandler("/ready", "print server state, return 200 if LIVE, otherwise return 503",
                       MAKE_ADMIN_HANDLER(server_info_handler_.handlerReady), false, false),
           stats_handler_.statsHandler(false /* not active mode */),
-          makeHandler("/stats/prometheus", "print server stats in prometheus format",
-                      MAKE_ADMIN_HANDLER(stats_handler_.handlerPrometheusStats), false, false,
-                      {{ParamDescriptor::Type::Boolean, "usedonly",
-                        "Only include stats that have been written by system since restart"},
-                       {ParamDescriptor::Type::Boolean, "text_readouts",
-                        "Render text_readouts as new gaugues with value 0 (increases Prometheus "
-                        "data size)"},
-                       {ParamDescriptor::Type::String, "filter",
-                        "Regular expression (Google re2) for filtering stats"},
-                       {ParamDescriptor::Type::Enum,
-                        "histogram_buckets",
-                        "Histogram bucket display mode",
-                        {"cumulative", "summary"}}}),
+          stats_handler_.prometheusStatsHandler(),
           makeHandler("/stats/recentlookups", "Show recent stat-name lookups",
                       MAKE_ADMIN_HANDLER(stats_handler_.handlerStatsRecentLookups), false, false),
           makeHandler("/stats/recentlookups/clear", "clear list of stat-name lookups and counter",
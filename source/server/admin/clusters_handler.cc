@@ -163,10 +163,10 @@ void ClustersHandler::writeClustersAsJson(Buffer::Instance& response) {
           metric.set_type(envoy::admin::v3::SimpleMetric::COUNTER);
         }
 
-        for (const auto& [gauge_name, gauge] : host->gauges()) {
+        for (const auto& [gauge_name, gauge_value] : host->gauges()) {
           auto& metric = *host_status.add_stats();
           metric.set_name(std::string(gauge_name));
-          metric.set_value(gauge.get().value());
+          metric.set_value(gauge_value);
           metric.set_type(envoy::admin::v3::SimpleMetric::GAUGE);
         }
 
@@ -230,8 +230,8 @@ void ClustersHandler::writeClustersAsText(Buffer::Instance& response) {
           all_stats[counter_name] = counter.get().value();
         }
 
-        for (const auto& [gauge_name, gauge] : host->gauges()) {
-          all_stats[gauge_name] = gauge.get().value();
+        for (const auto& [gauge_name, gauge_value] : host->gauges()) {
+          all_stats[gauge_name] = gauge_value;
         }
 
         for (const auto& [stat_name, stat] : all_stats) {
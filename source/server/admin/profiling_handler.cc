@@ -1,39 +1,94 @@
 #include "source/server/admin/profiling_handler.h"
 
+#include "source/common/http/headers.h"
 #include "source/common/profiler/profiler.h"
 #include "source/server/admin/utils.h"
 
+#include "absl/strings/numbers.h"
+
 namespace Envoy {
 namespace Server {
 
-ProfilingHandler::ProfilingHandler(const std::string& profile_path) : profile_path_(profile_path) {}
+namespace {
+// Upper bound for timed CPU profiling runs; long enough for incident capture while guaranteeing a
+// forgotten run cannot keep the profiler enabled indefinitely.
+constexpr uint64_t MaxCpuProfileSeconds = 900;
+} // namespace
+
+ProfilingHandler::ProfilingHandler(Server::Instance& server, const std::string& profile_path)
+    : server_(server), profile_path_(profile_path) {}
 
 Http::Code ProfilingHandler::handlerCpuProfiler(Http::ResponseHeaderMap&,
                                                 Buffer::Instance& response,
                                                 AdminStream& admin_stream) {
   Http::Utility::QueryParamsMulti query_params = admin_stream.queryParams();
   const auto enableVal = query_params.getFirstValue("enable");
-  if (query_params.data().size() != 1 || !enableVal.has_value() ||
+  const auto secondsVal = query_params.getFirstValue("seconds");
+  const size_t expected_params = secondsVal.has_value() ? 2 : 1;
+  if (query_params.data().size() != expected_params || !enableVal.has_value() ||
       (enableVal.value() != "y" && enableVal.value() != "n")) {
-    response.add("?enable=<y|n>\n");
+    response.add("?enable=<y|n>[&seconds=<duration>]\n");
     return Http::Code::BadRequest;
   }
 
   bool enable = enableVal.value() == "y";
+  uint64_t seconds = 0;
+  if (secondsVal.has_value()) {
+    if (!enable || !absl::SimpleAtoi(secondsVal.value(), &seconds) || seconds == 0 ||
+        seconds > MaxCpuProfileSeconds) {
+      response.add(fmt::format("seconds requires enable=y and a value in [1, {}]\n",
+                               MaxCpuProfileSeconds));
+      return Http::Code::BadRequest;
+    }
+  }
+
   if (enable && !Profiler::Cpu::profilerEnabled()) {
     if (!Profiler::Cpu::startProfiler(profile_path_)) {
       response.add("failure to start the profiler");
       return Http::Code::InternalServerError;
     }
-
+    if (seconds > 0) {
+      // Bound the profiling run so a single request captures an incident window; the profile can
+      // then be fetched with /cpuprofiler_output without a second pre-arranged stop.
+      if (cpu_profiler_stop_timer_ == nullptr) {
+        cpu_profiler_stop_timer_ = server_.dispatcher().createTimer([]() {
+          if (Profiler::Cpu::profilerEnabled()) {
+            Profiler::Cpu::stopProfiler();
+          }
+        });
+      }
+      cpu_profiler_stop_timer_->enableTimer(std::chrono::milliseconds(seconds * 1000));
+    }
   } else if (!enable && Profiler::Cpu::profilerEnabled()) {
     Profiler::Cpu::stopProfiler();
+    if (cpu_profiler_stop_timer_ != nullptr) {
+      cpu_profiler_stop_timer_->disableTimer();
+    }
   }
 
   response.add("OK\n");
   return Http::Code::OK;
 }
 
+Http::Code ProfilingHandler::handlerCpuProfilerOutput(Http::ResponseHeaderMap& response_headers,
+                                                      Buffer::Instance& response, AdminStream&) {
+  if (Profiler::Cpu::profilerEnabled()) {
+    response.add("The CPU profiler is still running; stop it or wait for the timed run to finish "
+                 "before fetching the profile.\n");
+    return Http::Code::BadRequest;
+  }
+
+  const auto file_or_error = server_.api().fileSystem().fileReadToEnd(profile_path_);
+  if (!file_or_error.ok() || file_or_error.value().empty()) {
+    response.add("No CPU profile found; start one with POST /cpuprofiler?enable=y first.\n");
+    return Http::Code::NotFound;
+  }
+
+  response_headers.setReferenceContentType(Http::Headers::get().ContentTypeValues.OctetStream);
+  response.add(file_or_error.value());
+  return Http::Code::OK;
+}
+
 Http::Code ProfilingHandler::handlerHeapProfiler(Http::ResponseHeaderMap&,
                                                  Buffer::Instance& response,
                                                  AdminStream& admin_stream) {
@@ -1,9 +1,11 @@
 #pragma once
 
 #include "envoy/buffer/buffer.h"
+#include "envoy/event/timer.h"
 #include "envoy/http/codes.h"
 #include "envoy/http/header_map.h"
 #include "envoy/server/admin.h"
+#include "envoy/server/instance.h"
 
 #include "absl/strings/string_view.h"
 
@@ -13,16 +15,22 @@ namespace Server {
 class ProfilingHandler {
 
 public:
-  ProfilingHandler(const std::string& profile_path);
+  ProfilingHandler(Server::Instance& server, const std::string& profile_path);
 
   Http::Code handlerCpuProfiler(Http::ResponseHeaderMap& response_headers,
                                 Buffer::Instance& response, AdminStream&);
 
+  Http::Code handlerCpuProfilerOutput(Http::ResponseHeaderMap& response_headers,
+                                      Buffer::Instance& response, AdminStream&);
+
   Http::Code handlerHeapProfiler(Http::ResponseHeaderMap& response_headers,
                                  Buffer::Instance& response, AdminStream&);
 
 private:
+  Server::Instance& server_;
   const std::string profile_path_;
+  // Stops a timed CPU profiling run (/cpuprofiler?enable=y&seconds=N) on the main thread.
+  Event::TimerPtr cpu_profiler_stop_timer_;
 };
 
 class TcmallocProfilingHandler {
@@ -8,8 +8,10 @@
 #include "source/common/stats/histogram_impl.h"
 #include "source/common/upstream/host_utility.h"
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_replace.h"
+#include "absl/synchronization/mutex.h"
 
 namespace Envoy {
 namespace Server {
@@ -46,6 +48,61 @@ std::string sanitizeValue(const absl::string_view value) {
                                     });
 }
 
+/**
+ * Memoization cache for sanitized names and formatted tag fragments.
+ * Sanitization is a pure function of its input, so entries never need
+ * invalidation, and metric families and tag name/value pairs recur heavily
+ * both within a scrape and across scrapes: the regex replacement in
+ * sanitizeName dominates the cost of rendering a large stat set. The cache is
+ * bounded so that pathological tag cardinality costs CPU, as it does today,
+ * rather than unbounded memory; once the cache is full, further inputs are
+ * sanitized without being remembered.
+ */
+class SanitizationCache {
+public:
+  // Far more entries than the distinct metric families and tag pairs of a
+  // large server; at roughly 100 bytes per entry this caps the cache at about
+  // 10 MiB.
+  static constexpr size_t MaxEntries = 100 * 1000;
+
+  std::string sanitizedName(absl::string_view name) {
+    return lookup(names_, name, [name]() { return sanitizeName(name); });
+  }
+
+  std::string formattedTag(const Stats::Tag& tag) {
+    // The key encodes the name length so that distinct (name, value) pairs
+    // cannot collide across the concatenation boundary.
+    const std::string key = absl::StrCat(tag.name_.size(), ".", tag.name_, tag.value_);
+    return lookup(tags_, key, [&tag]() {
+      return fmt::format("{}=\"{}\"", sanitizeName(tag.name_), sanitizeValue(tag.value_));
+    });
+  }
+
+private:
+  std::string lookup(absl::flat_hash_map<std::string, std::string>& map, absl::string_view key,
+                     const std::function<std::string()>& compute) {
+    {
+      absl::MutexLock lock(&mu_);
+      auto iter = map.find(key);
+      if (iter != map.end()) {
+        return iter->second;
+      }
+    }
+    std::string value = compute();
+    absl::MutexLock lock(&mu_);
+    if (names_.size() + tags_.size() < MaxEntries) {
+      map.emplace(key, value);
+    }
+    return value;
+  }
+
+  absl::Mutex mu_;
+  absl::flat_hash_map<std::string, std::string> names_ ABSL_GUARDED_BY(mu_);
+  absl::flat_hash_map<std::string, std::string> tags_ ABSL_GUARDED_BY(mu_);
+};
+
+SanitizationCache& sanitizationCache() { CONSTRUCT_ON_FIRST_USE(SanitizationCache); }
+
 /*
  * Comparator for Stats::Metric that does not require a string representation
  * to make the comparison, for memory efficiency.
@@ -64,72 +121,16 @@ struct PrimitiveMetricSnapshotLessThan {
   }
 };
 
-std::string generateNumericOutput(uint64_t value, const Stats::TagVector& tags,
-                                  const std::string& prefixed_tag_extracted_name) {
-  const std::string formatted_tags = PrometheusStatsFormatter::formattedTags(tags);
-  return fmt::format("{0}{{{1}}} {2}\n", prefixed_tag_extracted_name, formatted_tags, value);
-}
-
 /*
  * Return the prometheus output for a numeric Stat (Counter or Gauge).
  */
 template <class StatType>
 std::string generateStatNumericOutput(const StatType& metric,
                                       const std::string& prefixed_tag_extracted_name) {
-  return generateNumericOutput(metric.value(), metric.tags(), prefixed_tag_extracted_name);
+  return PrometheusStatsFormatter::generateNumericOutput(metric.value(), metric.tags(),
+                                                         prefixed_tag_extracted_name);
 }
 
-/*
- * Returns the prometheus output for a TextReadout in gauge format.
- * It is a workaround of a limitation of prometheus which stores only numeric metrics.
- * The output is a gauge named the same as a given text-readout. The value of returned gauge is
- * always equal to 0. Returned gauge contains all tags of a given text-readout and one additional
- * tag {"text_value":"textReadout.value"}.
- */
-std::string generateTextReadoutOutput(const Stats::TextReadout& text_readout,
-                                      const std::string& prefixed_tag_extracted_name) {
-  auto tags = text_readout.tags();
-  tags.push_back(Stats::Tag{"text_value", text_readout.value()});
-  const std::string formattedTags = PrometheusStatsFormatter::formattedTags(tags);
-  return fmt::format("{0}{{{1}}} 0\n", prefixed_tag_extracted_name, formattedTags);
-}
-
-/*
- * Returns the prometheus output for a histogram. The output is a multi-line string (with embedded
- * newlines) that contains all the individual bucket counts and sum/count for a single histogram
- * (metric_name plus all tags).
- */
-std::string generateHistogramOutput(const Stats::ParentHistogram& histogram,
-                                    const std::string& prefixed_tag_extracted_name) {
-  const std::string tags = PrometheusStatsFormatter::formattedTags(histogram.tags());
-  const std::string hist_tags = histogram.tags().empty() ? EMPTY_STRING : (tags + ",");
-
-  const Stats::HistogramStatistics& stats = histogram.cumulativeStatistics();
-  Stats::ConstSupportedBuckets& supported_buckets = stats.supportedBuckets();
-  const std::vector<uint64_t>& computed_buckets = stats.computedBuckets();
-  std::string output;
-  for (size_t i = 0; i < supported_buckets.size(); ++i) {
-    double bucket = supported_buckets[i];
-    uint64_t value = computed_buckets[i];
-    // We want to print the bucket in a fixed point (non-scientific) format. The fmt library
-    // doesn't have a specific modifier to format as a fixed-point value only so we use the
-    // 'g' operator which prints the number in general fixed point format or scientific format
-    // with precision 50 to round the number up to 32 significant digits in fixed point format
-    // which should cover pretty much all cases
-    output.append(fmt::format("{0}_bucket{{{1}le=\"{2:.32g}\"}} {3}\n", prefixed_tag_extracted_name,
-                              hist_tags, bucket, value));
-  }
-
-  output.append(fmt::format("{0}_bucket{{{1}le=\"+Inf\"}} {2}\n", prefixed_tag_extracted_name,
-                            hist_tags, stats.sampleCount()));
-  output.append(fmt::format("{0}_sum{{{1}}} {2:.32g}\n", prefixed_tag_extracted_name, tags,
-                            stats.sampleSum()));
-  output.append(fmt::format("{0}_count{{{1}}} {2}\n", prefixed_tag_extracted_name, tags,
-                            stats.sampleCount()));
-
-  return output;
-};
-
 /**
  * Processes a stat type (counter, gauge, histogram) by generating all output lines, sorting
  * them by tag-extracted metric name, and then outputting them in the correct sorted order into
@@ -269,20 +270,65 @@ uint64_t outputPrimitiveStatType(Buffer::Instance& response, const StatsParams&
     std::sort(group.second.begin(), group.second.end(), PrimitiveMetricSnapshotLessThan());
 
     for (const auto& metric : group.second) {
-      response.add(generateNumericOutput(metric->value(), metric->tags(),
-                                         prefixed_tag_extracted_name.value()));
+      response.add(PrometheusStatsFormatter::generateNumericOutput(
+          metric->value(), metric->tags(), prefixed_tag_extracted_name.value()));
     }
   }
   return result;
 }
 
-/*
- * Returns the prometheus output for a summary. The output is a multi-line string (with embedded
- * newlines) that contains all the individual quantile values and sum/count for a single histogram
- * (metric_name plus all tags).
- */
-std::string generateSummaryOutput(const Stats::ParentHistogram& histogram,
-                                  const std::string& prefixed_tag_extracted_name) {
+} // namespace
+
+std::string
+PrometheusStatsFormatter::generateNumericOutput(uint64_t value, const Stats::TagVector& tags,
+                                                const std::string& prefixed_tag_extracted_name) {
+  const std::string formatted_tags = formattedTags(tags);
+  return fmt::format("{0}{{{1}}} {2}\n", prefixed_tag_extracted_name, formatted_tags, value);
+}
+
+std::string PrometheusStatsFormatter::generateTextReadoutOutput(
+    const Stats::TextReadout& text_readout, const std::string& prefixed_tag_extracted_name) {
+  auto tags = text_readout.tags();
+  tags.push_back(Stats::Tag{"text_value", text_readout.value()});
+  const std::string formatted_tags = formattedTags(tags);
+  return fmt::format("{0}{{{1}}} 0\n", prefixed_tag_extracted_name, formatted_tags);
+}
+
+std::string
+PrometheusStatsFormatter::generateHistogramOutput(const Stats::ParentHistogram& histogram,
+                                                  const std::string& prefixed_tag_extracted_name) {
+  const std::string tags = PrometheusStatsFormatter::formattedTags(histogram.tags());
+  const std::string hist_tags = histogram.tags().empty() ? EMPTY_STRING : (tags + ",");
+
+  const Stats::HistogramStatistics& stats = histogram.cumulativeStatistics();
+  Stats::ConstSupportedBuckets& supported_buckets = stats.supportedBuckets();
+  const std::vector<uint64_t>& computed_buckets = stats.computedBuckets();
+  std::string output;
+  for (size_t i = 0; i < supported_buckets.size(); ++i) {
+    double bucket = supported_buckets[i];
+    uint64_t value = computed_buckets[i];
+    // We want to print the bucket in a fixed point (non-scientific) format. The fmt library
+    // doesn't have a specific modifier to format as a fixed-point value only so we use the
+    // 'g' operator which prints the number in general fixed point format or scientific format
+    // with precision 50 to round the number up to 32 significant digits in fixed point format
+    // which should cover pretty much all cases
+    output.append(fmt::format("{0}_bucket{{{1}le=\"{2:.32g}\"}} {3}\n", prefixed_tag_extracted_name,
+                              hist_tags, bucket, value));
+  }
+
+  output.append(fmt::format("{0}_bucket{{{1}le=\"+Inf\"}} {2}\n", prefixed_tag_extracted_name,
+                            hist_tags, stats.sampleCount()));
+  output.append(fmt::format("{0}_sum{{{1}}} {2:.32g}\n", prefixed_tag_extracted_name, tags,
+                            stats.sampleSum()));
+  output.append(fmt::format("{0}_count{{{1}}} {2}\n", prefixed_tag_extracted_name, tags,
+                            stats.sampleCount()));
+
+  return output;
+};
+
+std::string
+PrometheusStatsFormatter::generateSummaryOutput(const Stats::ParentHistogram& histogram,
+                                                const std::string& prefixed_tag_extracted_name) {
   const std::string tags = PrometheusStatsFormatter::formattedTags(histogram.tags());
   const std::string hist_tags = histogram.tags().empty() ? EMPTY_STRING : (tags + ",");
 
@@ -305,13 +351,11 @@ std::string generateSummaryOutput(const Stats::ParentHistogram& histogram,
   return output;
 };
 
-} // namespace
-
 std::string PrometheusStatsFormatter::formattedTags(const std::vector<Stats::Tag>& tags) {
   std::vector<std::string> buf;
   buf.reserve(tags.size());
   for (const Stats::Tag& tag : tags) {
-    buf.push_back(fmt::format("{}=\"{}\"", sanitizeName(tag.name_), sanitizeValue(tag.value_)));
+    buf.push_back(sanitizationCache().formattedTag(tag));
   }
   return absl::StrJoin(buf, ",");
 }
@@ -339,7 +383,8 @@ PrometheusStatsFormatter::metricName(const std::string& extracted_name,
       custom_namespaces.stripRegisteredPrefix(extracted_name);
   if (custom_namespace_stripped.has_value()) {
     // This case the name has a custom namespace, and it is a custom metric.
-    const std::string sanitized_name = sanitizeName(custom_namespace_stripped.value());
+    const std::string sanitized_name =
+        sanitizationCache().sanitizedName(custom_namespace_stripped.value());
     // We expose these metrics without modifying (e.g. without "envoy_"),
     // so we have to check the "user-defined" stat name complies with the Prometheus naming
     // convention. Specifically the name must start with the "[a-zA-Z_]" pattern.
@@ -355,7 +400,7 @@ PrometheusStatsFormatter::metricName(const std::string& extracted_name,
   // If it does not have a custom namespace, add namespacing prefix to avoid conflicts, as per best
   // practice: https://prometheus.io/docs/practices/naming/#metric-names Also, naming conventions on
   // https://prometheus.io/docs/concepts/data_model/
-  return absl::StrCat("envoy_", sanitizeName(extracted_name));
+  return absl::StrCat("envoy_", sanitizationCache().sanitizedName(extracted_name));
 }
 
 uint64_t PrometheusStatsFormatter::statsAsPrometheus(
@@ -400,6 +445,15 @@ uint64_t PrometheusStatsFormatter::statsAsPrometheus(
   // Note: This assumes that there is no overlap in stat name between per-endpoint stats and all
   // other stats. If this is not true, then the counters/gauges for per-endpoint need to be combined
   // with the above counter/gauge calls so that stats can be properly grouped.
+  metric_name_count +=
+      primitiveMetricsAsPrometheus(cluster_manager, response, params, custom_namespaces);
+
+  return metric_name_count;
+}
+
+uint64_t PrometheusStatsFormatter::primitiveMetricsAsPrometheus(
+    const Upstream::ClusterManager& cluster_manager, Buffer::Instance& response,
+    const StatsParams& params, const Stats::CustomStatNamespaces& custom_namespaces) {
   std::vector<Stats::PrimitiveCounterSnapshot> host_counters;
   std::vector<Stats::PrimitiveGaugeSnapshot> host_gauges;
   Upstream::HostUtility::forEachHostMetric(
@@ -409,7 +463,7 @@ uint64_t PrometheusStatsFormatter::statsAsPrometheus(
       },
       [&](Stats::PrimitiveGaugeSnapshot&& metric) { host_gauges.emplace_back(std::move(metric)); });
 
-  metric_name_count +=
+  uint64_t metric_name_count =
       outputPrimitiveStatType(response, params, host_counters, "counter", custom_namespaces);
 
   metric_name_count +=
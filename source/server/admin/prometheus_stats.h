@@ -51,6 +51,49 @@ public:
   static absl::optional<std::string>
   metricName(const std::string& extracted_name,
              const Stats::CustomStatNamespaces& custom_namespace_factory);
+
+  /**
+   * Returns the prometheus output line for a numeric value (Counter or Gauge).
+   */
+  static std::string generateNumericOutput(uint64_t value, const Stats::TagVector& tags,
+                                           const std::string& prefixed_tag_extracted_name);
+
+  /**
+   * Returns the prometheus output for a TextReadout in gauge format.
+   * It is a workaround of a limitation of prometheus which stores only numeric metrics.
+   * The output is a gauge named the same as a given text-readout. The value of returned gauge is
+   * always equal to 0. Returned gauge contains all tags of a given text-readout and one additional
+   * tag {"text_value":"textReadout.value"}.
+   */
+  static std::string generateTextReadoutOutput(const Stats::TextReadout& text_readout,
+                                               const std::string& prefixed_tag_extracted_name);
+
+  /**
+   * Returns the prometheus output for a histogram. The output is a multi-line string (with
+   * embedded newlines) that contains all the individual bucket counts and sum/count for a
+   * single histogram (metric_name plus all tags).
+   */
+  static std::string generateHistogramOutput(const Stats::ParentHistogram& histogram,
+                                             const std::string& prefixed_tag_extracted_name);
+
+  /**
+   * Returns the prometheus output for a summary. The output is a multi-line string (with
+   * embedded newlines) that contains all the individual quantile values and sum/count for a
+   * single histogram (metric_name plus all tags).
+   */
+  static std::string generateSummaryOutput(const Stats::ParentHistogram& histogram,
+                                           const std::string& prefixed_tag_extracted_name);
+
+  /**
+   * Collects the per-endpoint counters and gauges from the cluster manager and appends them to
+   * the response in prometheus format. These are rendered in one batch as there is no shared
+   * pointer with which to hold them across streaming chunks.
+   * @return uint64_t the number of metric types inserted in response.
+   */
+  static uint64_t
+  primitiveMetricsAsPrometheus(const Upstream::ClusterManager& cluster_manager,
+                               Buffer::Instance& response, const StatsParams& params,
+                               const Stats::CustomStatNamespaces& custom_namespaces);
 };
 
 } // namespace Server
@@ -0,0 +1,178 @@
+#include "source/server/admin/prometheus_stats_request.h"
+
+#include <algorithm>
+
+#include "source/common/common/empty_string.h"
+#include "source/common/common/fmt.h"
+
+namespace Envoy {
+namespace Server {
+
+PrometheusStatsRequest::PrometheusStatsRequest(Stats::Store& stats, const StatsParams& params,
+                                               const Stats::CustomStatNamespaces& custom_namespaces,
+                                               const Upstream::ClusterManager& cluster_manager)
+    : params_(params), stats_(stats), custom_namespaces_(custom_namespaces),
+      cluster_manager_(cluster_manager) {}
+
+Http::Code PrometheusStatsRequest::start(Http::ResponseHeaderMap&) {
+  // First capture all the scopes and hold onto them with a SharedPtr so they
+  // can't be deleted after the initial iteration.
+  stats_.forEachScope(
+      [this](size_t s) { scopes_.reserve(s); },
+      [this](const Stats::Scope& scope) { scopes_.emplace_back(scope.getConstShared()); });
+
+  startPhase();
+  return Http::Code::OK;
+}
+
+bool PrometheusStatsRequest::nextChunk(Buffer::Instance& response) {
+  // nextChunk's contract is to add up to chunk_size_ additional bytes. The
+  // caller is not required to drain the bytes after each call to nextChunk.
+  const uint64_t starting_response_length = response.length();
+  while (response.length() - starting_response_length < chunk_size_) {
+    while (stat_map_.empty()) {
+      switch (phase_) {
+      case Phase::Counters:
+        phase_ = Phase::Gauges;
+        startPhase();
+        break;
+      case Phase::Gauges:
+        phase_ = Phase::TextReadouts;
+        startPhase();
+        break;
+      case Phase::TextReadouts:
+        phase_ = Phase::Histograms;
+        startPhase();
+        break;
+      case Phase::Histograms:
+        // The per-host metrics do not adhere to the streaming contract; there
+        // is no shared pointer with which to hold them across chunks, so they
+        // are rendered in one batch. See StatsRequest::renderPerHostMetrics.
+        PrometheusStatsFormatter::primitiveMetricsAsPrometheus(cluster_manager_, response, params_,
+                                                               custom_namespaces_);
+        return false;
+      }
+    }
+
+    auto iter = stat_map_.begin();
+    StatGroup group = std::move(iter->second);
+    switch (static_cast<StatGroupIndex>(group.index())) {
+    case StatGroupIndex::TextReadout:
+      // TextReadout stats are returned in gauge format, so "gauge" type is set intentionally.
+      renderGroup<Stats::TextReadout>(response, iter->first,
+                                      absl::get<std::vector<Stats::TextReadoutSharedPtr>>(group),
+                                      PrometheusStatsFormatter::generateTextReadoutOutput, "gauge");
+      break;
+    case StatGroupIndex::Counter:
+      renderGroup<Stats::Counter>(
+          response, iter->first, absl::get<std::vector<Stats::CounterSharedPtr>>(group),
+          [](const Stats::Counter& counter, const std::string& prefixed_name) -> std::string {
+            return PrometheusStatsFormatter::generateNumericOutput(counter.value(), counter.tags(),
+                                                                   prefixed_name);
+          },
+          "counter");
+      break;
+    case StatGroupIndex::Gauge:
+      renderGroup<Stats::Gauge>(
+          response, iter->first, absl::get<std::vector<Stats::GaugeSharedPtr>>(group),
+          [](const Stats::Gauge& gauge, const std::string& prefixed_name) -> std::string {
+            return PrometheusStatsFormatter::generateNumericOutput(gauge.value(), gauge.tags(),
+                                                                   prefixed_name);
+          },
+          "gauge");
+      break;
+    case StatGroupIndex::Histogram: {
+      const bool summary =
+          params_.histogram_buckets_mode_ == Utility::HistogramBucketsMode::Summary;
+      renderGroup<Stats::Histogram>(
+          response, iter->first, absl::get<std::vector<Stats::HistogramSharedPtr>>(group),
+          [summary](const Stats::Histogram& histogram,
+                    const std::string& prefixed_name) -> std::string {
+            const auto* parent = dynamic_cast<const Stats::ParentHistogram*>(&histogram);
+            if (parent == nullptr) {
+              return EMPTY_STRING;
+            }
+            return summary ? PrometheusStatsFormatter::generateSummaryOutput(*parent, prefixed_name)
+                           : PrometheusStatsFormatter::generateHistogramOutput(*parent,
+                                                                               prefixed_name);
+          },
+          summary ? "summary" : "histogram");
+      break;
+    }
+    }
+    stat_map_.erase(iter);
+  }
+  return true;
+}
+
+void PrometheusStatsRequest::startPhase() {
+  ASSERT(stat_map_.empty());
+  switch (phase_) {
+  case Phase::Counters:
+    populateStatsFromScopes<Stats::Counter>();
+    break;
+  case Phase::Gauges:
+    populateStatsFromScopes<Stats::Gauge>();
+    break;
+  case Phase::TextReadouts:
+    // Text readouts are only rendered on request; the buffered implementation
+    // passes an empty vector to statsAsPrometheus when they are not requested.
+    if (params_.prometheus_text_readouts_) {
+      populateStatsFromScopes<Stats::TextReadout>();
+    }
+    break;
+  case Phase::Histograms:
+    populateStatsFromScopes<Stats::Histogram>();
+    break;
+  }
+}
+
+template <class StatType> void PrometheusStatsRequest::populateStatsFromScopes() {
+  Stats::IterateFn<StatType> collect = [this](const Stats::RefcountPtr<StatType>& stat) -> bool {
+    if (!params_.shouldShowMetric(*stat)) {
+      return true;
+    }
+    auto iter = stat_map_
+                    .try_emplace(stat->tagExtractedName(),
+                                 std::vector<Stats::RefcountPtr<StatType>>())
+                    .first;
+    absl::get<std::vector<Stats::RefcountPtr<StatType>>>(iter->second).emplace_back(stat);
+    return true;
+  };
+  for (const Stats::ConstScopeSharedPtr& scope : scopes_) {
+    scope->iterate(collect);
+  }
+}
+
+template <class StatType>
+void PrometheusStatsRequest::renderGroup(
+    Buffer::Instance& response, const std::string& tag_extracted_name,
+    std::vector<Stats::RefcountPtr<StatType>>& group,
+    const std::function<std::string(const StatType& stat, const std::string& prefixed_name)>&
+        generate,
+    absl::string_view type) {
+  const absl::optional<std::string> prefixed_name =
+      PrometheusStatsFormatter::metricName(tag_extracted_name, custom_namespaces_);
+  if (!prefixed_name.has_value()) {
+    return;
+  }
+
+  // Sort before producing the final output to satisfy the "preferred" ordering
+  // from the prometheus spec: metrics will be sorted by their tags' textual
+  // representation, which will be consistent across calls. Sorting also makes
+  // duplicates adjacent: a stat reachable through more than one scope is
+  // collected once per scope, so de-dup by object identity before rendering.
+  std::sort(group.begin(), group.end(),
+            [](const Stats::RefcountPtr<StatType>& a, const Stats::RefcountPtr<StatType>& b) {
+              return a->constSymbolTable().lessThan(a->statName(), b->statName());
+            });
+  group.erase(std::unique(group.begin(), group.end()), group.end());
+
+  response.add(fmt::format("# TYPE {0} {1}\n", prefixed_name.value(), type));
+  for (const Stats::RefcountPtr<StatType>& stat : group) {
+    response.add(generate(*stat, prefixed_name.value()));
+  }
+}
+
+} // namespace Server
+} // namespace Envoy
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "envoy/server/admin.h"
+
+#include "source/server/admin/prometheus_stats.h"
+#include "source/server/admin/stats_params.h"
+#include "source/server/admin/utils.h"
+
+#include "absl/container/btree_map.h"
+#include "absl/types/variant.h"
+
+namespace Envoy {
+namespace Server {
+
+// Captures context for a streaming Prometheus stats request, implementing the
+// Admin::Request interface. This mirrors StatsRequest, but groups stats by
+// their tag-extracted name rather than emitting them individually: the
+// Prometheus exposition format requires that all series of a metric family
+// appear contiguously under a single TYPE annotation, and series of the same
+// family can come from different scopes (e.g. per-cluster stats), so we cannot
+// stream scope-at-a-time the way StatsRequest does.
+class PrometheusStatsRequest : public Admin::Request {
+  using ScopeVec = std::vector<Stats::ConstScopeSharedPtr>;
+  using StatGroup = absl::variant<std::vector<Stats::TextReadoutSharedPtr>,
+                                  std::vector<Stats::CounterSharedPtr>,
+                                  std::vector<Stats::GaugeSharedPtr>,
+                                  std::vector<Stats::HistogramSharedPtr>>;
+
+  // Ordered to match the StatGroup variant.
+  enum class StatGroupIndex { TextReadout, Counter, Gauge, Histogram };
+
+  // The phases are rendered in the same order as the fully buffered
+  // implementation in PrometheusStatsFormatter::statsAsPrometheus, so that the
+  // output is unchanged: counters, then gauges, then text readouts (opt-in),
+  // then histograms, then per-host primitive metrics.
+  enum class Phase {
+    Counters,
+    Gauges,
+    TextReadouts,
+    Histograms,
+  };
+
+public:
+  static constexpr uint64_t DefaultChunkSize = 2 * 1000 * 1000;
+
+  PrometheusStatsRequest(Stats::Store& stats, const StatsParams& params,
+                         const Stats::CustomStatNamespaces& custom_namespaces,
+                         const Upstream::ClusterManager& cluster_manager);
+
+  // Admin::Request
+  Http::Code start(Http::ResponseHeaderMap& response_headers) override;
+
+  // Streams out the next chunk of stats to the client. Each metric family is
+  // rendered as a unit -- a TYPE line followed by all its series -- and we end
+  // the chunk once the desired chunk size is reached, so the event loop can
+  // flush the buffer to the network between chunks instead of stalling while
+  // the entire response is serialized.
+  bool nextChunk(Buffer::Instance& response) override;
+
+  // Sets the chunk size.
+  void setChunkSize(uint64_t chunk_size) { chunk_size_ = chunk_size; }
+
+private:
+  // Populates stat_map_ with the metric families for the current phase. This
+  // buffers shared pointers for one stat type at a time, but no rendered text,
+  // so its cost is bounded by the number of stats rather than the size of the
+  // serialized output.
+  void startPhase();
+
+  // Populates all the metrics of the templatized type from scopes_, grouped by
+  // tag-extracted name. Here we exploit that Scope::iterate is a generic
+  // templatized function to avoid code duplication.
+  template <class StatType> void populateStatsFromScopes();
+
+  // Renders one metric family: the TYPE annotation followed by one line per
+  // series, sorted for reproducible output. Does nothing if the family's name
+  // cannot be translated to a valid Prometheus name.
+  template <class StatType>
+  void renderGroup(Buffer::Instance& response, const std::string& tag_extracted_name,
+                   std::vector<Stats::RefcountPtr<StatType>>& group,
+                   const std::function<std::string(const StatType& stat,
+                                                   const std::string& prefixed_name)>& generate,
+                   absl::string_view type);
+
+  StatsParams params_;
+  Stats::Store& stats_;
+  const Stats::CustomStatNamespaces& custom_namespaces_;
+  const Upstream::ClusterManager& cluster_manager_;
+  ScopeVec scopes_;
+  absl::btree_map<std::string, StatGroup> stat_map_;
+  Phase phase_{Phase::Counters};
+  uint64_t chunk_size_{DefaultChunkSize};
+};
+
+} // namespace Server
+} // namespace Envoy
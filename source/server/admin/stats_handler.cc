@@ -11,6 +11,7 @@
 #include "source/common/http/headers.h"
 #include "source/common/http/utility.h"
 #include "source/server/admin/prometheus_stats.h"
+#include "source/server/admin/prometheus_stats_request.h"
 #include "source/server/admin/stats_request.h"
 
 #include "absl/strings/numbers.h"
@@ -80,16 +81,7 @@ Admin::RequestPtr StatsHandler::makeRequest(AdminStream& admin_stream) {
   }
 
   if (params.format_ == StatsFormat::Prometheus) {
-    // TODO(#16139): modify streaming algorithm to cover Prometheus.
-    //
-    // This may be easiest to accomplish by populating the set
-    // with tagExtractedName(), and allowing for vectors of
-    // stats as multiples will have the same tag-extracted names.
-    // Ideally we'd find a way to do this without slowing down
-    // the non-Prometheus implementations.
-    Buffer::OwnedImpl response;
-    Http::Code code = prometheusFlushAndRender(params, response);
-    return Admin::makeStaticTextRequest(response, code);
+    return makePrometheusRequest(params);
   }
 
   if (server_.statsConfig().flushOnAdmin()) {
@@ -113,40 +105,20 @@ Admin::RequestPtr StatsHandler::makeRequest(Stats::Store& stats, const StatsPara
   return std::make_unique<StatsRequest>(stats, params, cluster_manager, url_handler_fn);
 }
 
-Http::Code StatsHandler::handlerPrometheusStats(Http::ResponseHeaderMap&,
-                                                Buffer::Instance& response,
-                                                AdminStream& admin_stream) {
-  return prometheusStats(admin_stream.getRequestHeaders().getPathValue(), response);
-}
-
-Http::Code StatsHandler::prometheusStats(absl::string_view path_and_query,
-                                         Buffer::Instance& response) {
-  StatsParams params;
-  Http::Code code = params.parse(path_and_query, response);
-  if (code != Http::Code::OK) {
-    return code;
+Admin::RequestPtr StatsHandler::makePrometheusRequest(const StatsParams& params) {
+  absl::Status status = PrometheusStatsFormatter::validateParams(params);
+  if (!status.ok()) {
+    Buffer::OwnedImpl response;
+    response.add(status.message());
+    return Admin::makeStaticTextRequest(response, Http::Code::BadRequest);
   }
 
   if (server_.statsConfig().flushOnAdmin()) {
     server_.flushStats();
   }
 
-  return prometheusFlushAndRender(params, response);
-}
-
-Http::Code StatsHandler::prometheusFlushAndRender(const StatsParams& params,
-                                                  Buffer::Instance& response) {
-  absl::Status paramsStatus = PrometheusStatsFormatter::validateParams(params);
-  if (!paramsStatus.ok()) {
-    response.add(paramsStatus.message());
-    return Http::Code::BadRequest;
-  }
-  if (server_.statsConfig().flushOnAdmin()) {
-    server_.flushStats();
-  }
-  prometheusRender(server_.stats(), server_.api().customStatNamespaces(), server_.clusterManager(),
-                   params, response);
-  return Http::Code::OK;
+  return std::make_unique<PrometheusStatsRequest>(
+      server_.stats(), params, server_.api().customStatNamespaces(), server_.clusterManager());
 }
 
 void StatsHandler::prometheusRender(Stats::Store& stats,
@@ -217,5 +189,38 @@ Admin::UrlHandler StatsHandler::statsHandler(bool active_mode) {
       params};
 }
 
+Admin::UrlHandler StatsHandler::prometheusStatsHandler() {
+  Admin::ParamDescriptor usedonly{
+      Admin::ParamDescriptor::Type::Boolean, "usedonly",
+      "Only include stats that have been written by system since restart"};
+  Admin::ParamDescriptor text_readouts{
+      Admin::ParamDescriptor::Type::Boolean, "text_readouts",
+      "Render text_readouts as new gaugues with value 0 (increases Prometheus data size)"};
+  Admin::ParamDescriptor filter{Admin::ParamDescriptor::Type::String, "filter",
+                                "Regular expression (Google re2) for filtering stats"};
+  Admin::ParamDescriptor histogram_buckets{Admin::ParamDescriptor::Type::Enum,
+                                           "histogram_buckets",
+                                           "Histogram bucket display mode",
+                                           {"cumulative", "summary"}};
+
+  return {"/stats/prometheus",
+          "print server stats in prometheus format",
+          [this](AdminStream& admin_stream) -> Admin::RequestPtr {
+            StatsParams params;
+            Buffer::OwnedImpl response;
+            Http::Code code =
+                params.parse(admin_stream.getRequestHeaders().getPathValue(), response);
+            if (code != Http::Code::OK) {
+              return Admin::makeStaticTextRequest(response, code);
+            }
+            // The prometheus format is implied by the path, so there is no format query param.
+            params.format_ = StatsFormat::Prometheus;
+            return makePrometheusRequest(params);
+          },
+          false,
+          false,
+          {usedonly, text_readouts, filter, histogram_buckets}};
+}
+
 } // namespace Server
 } // namespace Envoy
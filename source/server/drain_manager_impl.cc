@@ -186,12 +186,19 @@ void DrainManagerImpl::startDrainSequence(std::function<void()> drain_complete_c
   }
 
   uint32_t step_count = 0;
-  size_t num_cbs = cbs_.size();
+  const size_t num_cbs = cbs_.size();
+  // Pace the registered callbacks evenly across the first quarter of the drain window; compute
+  // the per-step quantum once instead of redoing the floating-point math for every callback
+  // (there can be one callback per drained connection).
+  const double step_quantum_ms =
+      num_cbs == 0
+          ? 0.0
+          : static_cast<double>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(remaining_time).count()) /
+                4 / num_cbs;
   THROW_IF_NOT_OK(cbs_.runCallbacksWith([&]() {
     // switch to floating-point math to avoid issues with integer division
-    std::chrono::milliseconds delay{static_cast<int64_t>(
-        static_cast<double>(step_count) / 4 / num_cbs *
-        std::chrono::duration_cast<std::chrono::milliseconds>(remaining_time).count())};
+    std::chrono::milliseconds delay{static_cast<int64_t>(step_count * step_quantum_ms)};
     step_count++;
     return delay;
   }));
@@ -21,11 +21,14 @@
 #include "source/common/common/logger.h"
 #include "source/common/config/utility.h"
 #include "source/common/protobuf/utility.h"
+#include "source/common/runtime/runtime_features.h"
 #include "source/common/stats/symbol_table.h"
+#include "source/common/thread/stack_capture.h"
 #include "source/server/watchdog_impl.h"
 
 #include "absl/synchronization/mutex.h"
 #include "absl/synchronization/notification.h"
+#include "absl/time/time.h"
 
 namespace Envoy {
 namespace Server {
@@ -55,6 +58,8 @@ GuardDogImpl::GuardDogImpl(Stats::Scope& stats_scope, const Server::Configuratio
           Stats::StatNameManagedStorage(absl::StrCat(name, ".watchdog_mega_miss"),
                                         stats_scope.symbolTable())
               .statName())),
+      log_stuck_thread_stacks_(Runtime::runtimeFeatureEnabled(
+          "envoy.reloadable_features.guarddog_log_stuck_thread_stacks")),
       dispatcher_(api.allocateDispatcher(absl::StrCat(name, "_guarddog_thread"))),
       loop_timer_(dispatcher_->createTimer([this]() { step(); })),
       events_to_actions_([&](const Server::Configuration::Watchdog& config) -> EventToActionsMap {
@@ -171,6 +176,25 @@ void GuardDogImpl::step() {
     }
   }
 
+  // A megamiss means an event loop has been blocked for a long time; attribute it by
+  // interrupting each stuck thread and logging its current stack before the megamiss actions
+  // run. The capture machinery costs nothing until the first megamiss occurs.
+  if (!mega_miss_threads.empty() && log_stuck_thread_stacks_) {
+    for (const auto& thread_pair : mega_miss_threads) {
+      const auto& tid = thread_pair.first;
+      const auto stack = Thread::captureThreadStack(tid, absl::Milliseconds(100));
+      if (stack.has_value()) {
+        ENVOY_LOG_MISC(error,
+                       "Watchdog MEGAMISS: thread with tid {} is stuck; stack (use "
+                       "tools/stack_decode.py to get line numbers):\n{}",
+                       tid.debugString(), *stack);
+      } else {
+        ENVOY_LOG_MISC(error, "Watchdog MEGAMISS: thread with tid {} is stuck; stack unavailable.",
+                       tid.debugString());
+      }
+    }
+  }
+
   // Run megamiss and miss handlers
   if (!mega_miss_threads.empty()) {
     invokeGuardDogActions(WatchDogAction::MEGAMISS, mega_miss_threads, now);
@@ -1,6 +1,11 @@
 #include "source/server/hot_restarting_child.h"
 
+#include <sys/mman.h>
+
+#include "source/common/api/os_sys_calls_impl.h"
+#include "source/common/api/os_sys_calls_impl_hot_restart.h"
 #include "source/common/buffer/buffer_impl.h"
+#include "source/common/common/fmt.h"
 #include "source/common/common/utility.h"
 #include "source/common/network/utility.h"
 
@@ -150,7 +155,7 @@ std::unique_ptr<HotRestartMessage> HotRestartingChild::getParentStats() {
   }
 
   HotRestartMessage wrapped_request;
-  wrapped_request.mutable_request()->mutable_stats();
+  wrapped_request.mutable_request()->mutable_stats()->set_accept_shared_memory(true);
   main_rpc_stream_.sendHotRestartMessage(parent_address_, wrapped_request);
 
   std::unique_ptr<HotRestartMessage> wrapped_reply =
@@ -158,9 +163,44 @@ std::unique_ptr<HotRestartMessage> HotRestartingChild::getParentStats() {
   RELEASE_ASSERT(
       main_rpc_stream_.replyIsExpectedType(wrapped_reply.get(), HotRestartMessage::Reply::kStats),
       "Hot restart parent did not respond as expected to get stats request.");
+  readStatsFromSharedMemory(*wrapped_reply->mutable_reply()->mutable_stats());
   return wrapped_reply;
 }
 
+void HotRestartingChild::readStatsFromSharedMemory(HotRestartMessage::Reply::Stats& stats) {
+  if (stats.shared_memory_name().empty()) {
+    // The parent sent the stats inline, either because it predates shared memory stats export or
+    // because it could not create the region.
+    return;
+  }
+  const std::string shmem_name = stats.shared_memory_name();
+  const uint64_t size = stats.shared_memory_size();
+
+  Api::OsSysCalls& os_sys_calls = Api::OsSysCallsSingleton::get();
+  Api::HotRestartOsSysCalls& hot_restart_os_sys_calls = Api::HotRestartOsSysCallsSingleton::get();
+
+  const Api::SysCallIntResult open_result =
+      hot_restart_os_sys_calls.shmOpen(shmem_name.c_str(), O_RDONLY, S_IRUSR);
+  RELEASE_ASSERT(open_result.return_value_ != -1,
+                 fmt::format("cannot open shared memory region {} published by the hot restart "
+                             "parent for stats. Error: {}",
+                             shmem_name, errorDetails(open_result.errno_)));
+  const Api::SysCallPtrResult mmap_result =
+      os_sys_calls.mmap(nullptr, size, PROT_READ, MAP_SHARED, open_result.return_value_, 0);
+  os_sys_calls.close(open_result.return_value_);
+  RELEASE_ASSERT(mmap_result.return_value_ != MAP_FAILED,
+                 fmt::format("cannot map shared memory region {} published by the hot restart "
+                             "parent for stats. Error: {}",
+                             shmem_name, errorDetails(mmap_result.errno_)));
+
+  const bool parsed = stats.ParseFromArray(mmap_result.return_value_, size);
+  munmap(mmap_result.return_value_, size);
+  // The parent recreates the region on its next export, so unlink it now that it is consumed to
+  // avoid leaking the name past the last export.
+  hot_restart_os_sys_calls.shmUnlink(shmem_name.c_str());
+  RELEASE_ASSERT(parsed, "Hot restart parent published an unparseable stats snapshot.");
+}
+
 void HotRestartingChild::drainParentListeners() {
   if (parent_terminated_) {
     return;
@@ -277,7 +317,7 @@ absl::Status HotRestartingChild::onSocketEventUdpForwarding() {
     }
     switch (wrapped_request->request().request_case()) {
     case HotRestartMessage::Request::kForwardedUdpPacket: {
-      const auto& req = wrapped_request->request().forwarded_udp_packet();
+      auto& req = *wrapped_request->mutable_request()->mutable_forwarded_udp_packet();
       Network::UdpRecvData packet;
       auto local_or_error = Network::Utility::resolveUrl(req.local_addr());
       RETURN_IF_NOT_OK(local_or_error.status());
@@ -290,7 +330,17 @@ absl::Status HotRestartingChild::onSocketEventUdpForwarding() {
       }
       packet.receive_time_ =
           MonotonicTime(std::chrono::microseconds{req.receive_time_epoch_microseconds()});
-      packet.buffer_ = std::make_unique<Buffer::OwnedImpl>(req.payload());
+      // Move the payload out of the decoded message rather than copying it into the buffer; the
+      // self-deleting fragment keeps the string alive until the worker has consumed the packet.
+      auto payload = std::make_shared<std::string>(std::move(*req.mutable_payload()));
+      packet.buffer_ = std::make_unique<Buffer::OwnedImpl>();
+      if (!payload->empty()) {
+        packet.buffer_->addBufferFragment(*new Buffer::BufferFragmentImpl(
+            payload->data(), payload->size(),
+            [payload](const void*, size_t, const Buffer::BufferFragmentImpl* fragment) {
+              delete fragment;
+            }));
+      }
       onForwardedUdpPacket(req.worker_index(), std::move(packet));
       break;
     }
@@ -57,6 +57,11 @@ public:
   void registerParentDrainedCallback(const Network::Address::InstanceConstSharedPtr& addr,
                                      absl::AnyInvocable<void()> action) override;
   std::unique_ptr<envoy::HotRestartMessage> getParentStats();
+  // Replaces a stats reply that references a shared memory snapshot (see
+  // HotRestartingParent::publishStatsToSharedMemory) with the payload parsed out of the mapped
+  // region, then unlinks the region. No-op for replies with inline stats. Exposed as a static
+  // for testing.
+  static void readStatsFromSharedMemory(envoy::HotRestartMessage::Reply::Stats& stats);
   void drainParentListeners();
   absl::optional<HotRestart::AdminShutdownResponse> sendParentAdminShutdownRequest();
   void sendParentTerminateRequest();
@@ -1,7 +1,13 @@
 #include "source/server/hot_restarting_parent.h"
 
+#include <sys/mman.h>
+
 #include "envoy/server/instance.h"
 
+#include "source/common/api/os_sys_calls_impl.h"
+#include "source/common/api/os_sys_calls_impl_hot_restart.h"
+#include "source/common/common/fmt.h"
+#include "source/common/common/utility.h"
 #include "source/common/memory/stats.h"
 #include "source/common/network/utility.h"
 #include "source/common/stats/stat_merger.h"
@@ -15,7 +21,7 @@ using HotRestartMessage = envoy::HotRestartMessage;
 
 HotRestartingParent::HotRestartingParent(int base_id, int restart_epoch,
                                          const std::string& socket_path, mode_t socket_mode)
-    : HotRestartingBase(base_id), restart_epoch_(restart_epoch) {
+    : HotRestartingBase(base_id), base_id_(base_id), restart_epoch_(restart_epoch) {
   std::string socket_path_udp = socket_path + "_udp";
   child_address_ = main_rpc_stream_.createDomainSocketAddress(restart_epoch_ + 1, "child",
                                                               socket_path, socket_mode);
@@ -85,7 +91,12 @@ void HotRestartingParent::onSocketEvent() {
 
     case HotRestartMessage::Request::kStats: {
       HotRestartMessage wrapped_reply;
-      internal_->exportStatsToChild(wrapped_reply.mutable_reply()->mutable_stats());
+      HotRestartMessage::Reply::Stats* stats = wrapped_reply.mutable_reply()->mutable_stats();
+      internal_->exportStatsToChild(stats);
+      if (wrapped_request->request().stats().accept_shared_memory()) {
+        publishStatsToSharedMemory(*stats,
+                                   fmt::format("/envoy_stats_shared_memory_{}", base_id_));
+      }
       main_rpc_stream_.sendHotRestartMessage(child_address_, wrapped_reply);
       break;
     }
@@ -118,6 +129,47 @@ void HotRestartingParent::onSocketEvent() {
 
 void HotRestartingParent::shutdown() { socket_event_.reset(); }
 
+void HotRestartingParent::publishStatsToSharedMemory(HotRestartMessage::Reply::Stats& stats,
+                                                     const std::string& shmem_name) {
+  const std::string serialized = stats.SerializeAsString();
+  if (serialized.empty()) {
+    return;
+  }
+
+  Api::OsSysCalls& os_sys_calls = Api::OsSysCallsSingleton::get();
+  Api::HotRestartOsSysCalls& hot_restart_os_sys_calls = Api::HotRestartOsSysCallsSingleton::get();
+
+  const Api::SysCallIntResult open_result =
+      hot_restart_os_sys_calls.shmOpen(shmem_name.c_str(), O_CREAT | O_RDWR, S_IRUSR | S_IWUSR);
+  if (open_result.return_value_ == -1) {
+    ENVOY_LOG(warn, "cannot open shared memory region {} for stats export, sending inline: {}",
+              shmem_name, errorDetails(open_result.errno_));
+    return;
+  }
+  const Api::SysCallIntResult truncate_result =
+      os_sys_calls.ftruncate(open_result.return_value_, serialized.size());
+  if (truncate_result.return_value_ == -1) {
+    ENVOY_LOG(warn, "cannot size shared memory region {} for stats export, sending inline: {}",
+              shmem_name, errorDetails(truncate_result.errno_));
+    os_sys_calls.close(open_result.return_value_);
+    return;
+  }
+  const Api::SysCallPtrResult mmap_result = os_sys_calls.mmap(
+      nullptr, serialized.size(), PROT_READ | PROT_WRITE, MAP_SHARED, open_result.return_value_, 0);
+  os_sys_calls.close(open_result.return_value_);
+  if (mmap_result.return_value_ == MAP_FAILED) {
+    ENVOY_LOG(warn, "cannot map shared memory region {} for stats export, sending inline: {}",
+              shmem_name, errorDetails(mmap_result.errno_));
+    return;
+  }
+  memcpy(mmap_result.return_value_, serialized.data(), serialized.size()); // NOLINT(safe-memcpy)
+  munmap(mmap_result.return_value_, serialized.size());
+
+  stats.Clear();
+  stats.set_shared_memory_name(shmem_name);
+  stats.set_shared_memory_size(serialized.size());
+}
+
 HotRestartingParent::Internal::Internal(Server::Instance* server,
                                         HotRestartMessageSender& udp_sender)
     : server_(server), udp_sender_(udp_sender) {
@@ -25,6 +25,15 @@ public:
   void shutdown();
   void sendHotRestartMessage(envoy::HotRestartMessage&& msg) override;
 
+  // Serializes 'stats' into the named POSIX shared memory region and replaces its contents with
+  // a reference to the region (shared_memory_name/shared_memory_size), so that the child can map
+  // and merge the snapshot in one pass instead of receiving it through the datagram-sized chunks
+  // of the RPC channel. If the region cannot be created the stats are left inline, which the
+  // child also accepts. The child unlinks the region after consuming it, so each export creates
+  // it anew. Exposed as a static for testing.
+  static void publishStatsToSharedMemory(envoy::HotRestartMessage::Reply::Stats& stats,
+                                         const std::string& shmem_name);
+
   // The hot restarting parent's hot restart logic. Each function is meant to be called to fulfill a
   // request from the child for that action.
   class Internal : public Network::NonDispatchedUdpPacketHandler {
@@ -52,6 +61,7 @@ public:
 private:
   void onSocketEvent();
 
+  const int base_id_;
   const int restart_epoch_;
   sockaddr_un child_address_;
   sockaddr_un child_address_udp_forwarding_;
@@ -1,5 +1,6 @@
 #include "source/server/server.h"
 
+#include <algorithm>
 #include <csignal>
 #include <cstdint>
 #include <ctime>
@@ -215,15 +216,103 @@ MetricSnapshotImpl::MetricSnapshotImpl(Stats::Store& store,
   snapshot_time_ = time_source.systemTime();
 }
 
+DeltaMetricSnapshot::DeltaMetricSnapshot(Stats::MetricSnapshot& snapshot, DeltaFlushState& state) {
+  for (const CounterSnapshot& counter : snapshot.counters()) {
+    // Counter deltas are already latched by the full snapshot; an unchanged counter is exactly
+    // one with a zero delta, so no persistent state is needed for counters.
+    if (counter.delta_ != 0) {
+      counters_.push_back(counter);
+    }
+  }
+
+  absl::flat_hash_map<std::string, uint64_t> gauge_values;
+  gauge_values.reserve(snapshot.gauges().size());
+  for (const auto& gauge : snapshot.gauges()) {
+    const uint64_t value = gauge.get().value();
+    const auto it = state.last_gauge_values_.find(gauge.get().name());
+    if (it == state.last_gauge_values_.end() || it->second != value) {
+      gauges_.push_back(gauge);
+    }
+    gauge_values[gauge.get().name()] = value;
+  }
+
+  // Histograms have no previous-value representation; a histogram changed if it recorded any
+  // samples in the interval that ended with this flush's merge.
+  for (const auto& histogram : snapshot.histograms()) {
+    if (histogram.get().intervalStatistics().sampleCount() != 0) {
+      histograms_.push_back(histogram);
+    }
+  }
+
+  absl::flat_hash_map<std::string, std::string> text_readout_values;
+  text_readout_values.reserve(snapshot.textReadouts().size());
+  for (const auto& text_readout : snapshot.textReadouts()) {
+    std::string value = text_readout.get().value();
+    const auto it = state.last_text_readout_values_.find(text_readout.get().name());
+    if (it == state.last_text_readout_values_.end() || it->second != value) {
+      text_readouts_.push_back(text_readout);
+    }
+    text_readout_values[text_readout.get().name()] = std::move(value);
+  }
+
+  for (const Stats::PrimitiveCounterSnapshot& counter : snapshot.hostCounters()) {
+    if (counter.delta() != 0) {
+      host_counters_.push_back(counter);
+    }
+  }
+
+  absl::flat_hash_map<std::string, uint64_t> host_gauge_values;
+  host_gauge_values.reserve(snapshot.hostGauges().size());
+  for (const Stats::PrimitiveGaugeSnapshot& gauge : snapshot.hostGauges()) {
+    const auto it = state.last_host_gauge_values_.find(gauge.name());
+    if (it == state.last_host_gauge_values_.end() || it->second != gauge.value()) {
+      host_gauges_.push_back(gauge);
+    }
+    host_gauge_values[gauge.name()] = gauge.value();
+  }
+
+  // Replace rather than update the persistent maps so that entries for stats that no longer
+  // exist are dropped instead of accumulating across flushes.
+  state.last_gauge_values_ = std::move(gauge_values);
+  state.last_text_readout_values_ = std::move(text_readout_values);
+  state.last_host_gauge_values_ = std::move(host_gauge_values);
+
+  snapshot_time_ = snapshot.snapshotTime();
+}
+
 void InstanceUtil::flushMetricsToSinks(const std::list<Stats::SinkPtr>& sinks, Stats::Store& store,
-                                       Upstream::ClusterManager& cm, TimeSource& time_source) {
+                                       Upstream::ClusterManager& cm, TimeSource& time_source,
+                                       DeltaFlushState* delta_state) {
   // Create a snapshot and flush to all sinks.
   // NOTE: Even if there are no sinks, creating the snapshot has the important property that it
   //       latches all counters on a periodic basis. The hot restart code assumes this is being
   //       done so this should not be removed.
   MetricSnapshotImpl snapshot(store, cm, time_source);
+
+  const bool have_delta_sink =
+      delta_state != nullptr &&
+      std::any_of(sinks.begin(), sinks.end(), [](const Stats::SinkPtr& sink) {
+        return sink->flushMode() == Stats::Sink::FlushMode::Delta;
+      });
+  if (!have_delta_sink) {
+    for (const auto& sink : sinks) {
+      sink->flush(snapshot);
+    }
+    return;
+  }
+
+  // Deliver a full snapshot to delta sinks on the first flush and on every FullFlushInterval'th
+  // flush thereafter, so downstream collectors recover dropped or aged-out series. The delta
+  // snapshot is still constructed on full flushes to keep the previous-value maps current.
+  ++delta_state->flush_count_;
+  const bool full_flush = (delta_state->flush_count_ % DeltaFlushState::FullFlushInterval) == 1;
+  DeltaMetricSnapshot delta_snapshot(snapshot, *delta_state);
   for (const auto& sink : sinks) {
-    sink->flush(snapshot);
+    if (sink->flushMode() == Stats::Sink::FlushMode::Delta && !full_flush) {
+      sink->flush(delta_snapshot);
+    } else {
+      sink->flush(snapshot);
+    }
   }
 }
 
@@ -283,7 +372,7 @@ void InstanceBase::flushStatsInternal() {
   updateServerStats();
   auto& stats_config = config_.statsConfig();
   InstanceUtil::flushMetricsToSinks(stats_config.sinks(), stats_store_, clusterManager(),
-                                    timeSource());
+                                    timeSource(), &delta_flush_state_);
   // TODO(ramaraochavali): consider adding different flush interval for histograms.
   if (stat_flush_timer_ != nullptr) {
     stat_flush_timer_->enableTimer(stats_config.flushInterval());
@@ -353,9 +442,12 @@ absl::Status InstanceUtil::loadBootstrapConfig(
   const std::string& config_path = options.configPath();
   const std::string& config_yaml = options.configYaml();
   const envoy::config::bootstrap::v3::Bootstrap& config_proto = options.configProto();
+  // ByteSizeLong() walks the whole message, which is not cheap for very large bootstraps, so
+  // compute it once for both the emptiness checks below.
+  const size_t config_proto_size = config_proto.ByteSizeLong();
 
   // One of config_path and config_yaml or bootstrap should be specified.
-  if (config_path.empty() && config_yaml.empty() && config_proto.ByteSizeLong() == 0) {
+  if (config_path.empty() && config_yaml.empty() && config_proto_size == 0) {
     return absl::InvalidArgumentError(
         "At least one of --config-path or --config-yaml or Options::configProto() "
         "should be non-empty");
@@ -375,7 +467,7 @@ absl::Status InstanceUtil::loadBootstrapConfig(
 #endif
     bootstrap.MergeFrom(bootstrap_override);
   }
-  if (config_proto.ByteSizeLong() != 0) {
+  if (config_proto_size != 0) {
     bootstrap.MergeFrom(config_proto);
   }
   MessageUtil::validate(bootstrap, validation_visitor);
@@ -48,6 +48,7 @@
 #include "source/server/listener_hooks.h"
 #include "source/server/worker_impl.h"
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/container/node_hash_map.h"
 #include "absl/types/optional.h"
 
@@ -115,6 +116,25 @@ public:
   virtual Runtime::LoaderPtr createRuntime(Instance& server, Configuration::Initial& config) PURE;
 };
 
+/**
+ * Persistent bookkeeping for sinks that request Stats::Sink::FlushMode::Delta:
+ * the gauge and text readout values observed at the previous flush, and a
+ * counter used to schedule the periodic full flushes. One instance is owned by
+ * the server and shared by all delta sinks, which is sound because every sink
+ * observes every flush.
+ */
+struct DeltaFlushState {
+  // Every Nth flush is delivered in full to delta sinks, so that downstream
+  // collectors recover dropped or aged-out series within a bounded number of
+  // intervals.
+  static constexpr uint64_t FullFlushInterval = 10;
+
+  absl::flat_hash_map<std::string, uint64_t> last_gauge_values_;
+  absl::flat_hash_map<std::string, std::string> last_text_readout_values_;
+  absl::flat_hash_map<std::string, uint64_t> last_host_gauge_values_;
+  uint64_t flush_count_{0};
+};
+
 /**
  * Helpers used during server creation.
  */
@@ -131,9 +151,13 @@ public:
    * flush() on each sink.
    * @param sinks supplies the list of sinks.
    * @param store provides the store being flushed.
+   * @param delta_state optional persistent state enabling delta flushes; when provided, sinks
+   *                    reporting FlushMode::Delta receive a snapshot restricted to changed
+   *                    metrics on most flushes. When absent all sinks receive full snapshots.
    */
   static void flushMetricsToSinks(const std::list<Stats::SinkPtr>& sinks, Stats::Store& store,
-                                  Upstream::ClusterManager& cm, TimeSource& time_source);
+                                  Upstream::ClusterManager& cm, TimeSource& time_source,
+                                  DeltaFlushState* delta_state = nullptr);
 
   /**
    * Load a bootstrap config and perform validation.
@@ -431,6 +455,7 @@ private:
   bool enable_reuse_port_default_{false};
   Regex::EnginePtr regex_engine_;
   bool stats_flush_in_progress_ : 1;
+  DeltaFlushState delta_flush_state_;
   std::unique_ptr<Memory::AllocatorManager> memory_allocator_manager_;
 
   template <class T>
@@ -489,5 +514,41 @@ private:
   SystemTime snapshot_time_;
 };
 
+// A view over a full MetricSnapshot restricted to the metrics whose value
+// changed since the previous flush, for sinks that request
+// Stats::Sink::FlushMode::Delta. Construction also refreshes the persistent
+// delta state with the current values, replacing the previous maps so that
+// entries for deleted stats do not accumulate.
+class DeltaMetricSnapshot : public Stats::MetricSnapshot {
+public:
+  DeltaMetricSnapshot(Stats::MetricSnapshot& snapshot, DeltaFlushState& state);
+
+  // Stats::MetricSnapshot
+  const std::vector<CounterSnapshot>& counters() override { return counters_; }
+  const std::vector<std::reference_wrapper<const Stats::Gauge>>& gauges() override {
+    return gauges_;
+  };
+  const std::vector<std::reference_wrapper<const Stats::ParentHistogram>>& histograms() override {
+    return histograms_;
+  }
+  const std::vector<std::reference_wrapper<const Stats::TextReadout>>& textReadouts() override {
+    return text_readouts_;
+  }
+  const std::vector<Stats::PrimitiveCounterSnapshot>& hostCounters() override {
+    return host_counters_;
+  }
+  const std::vector<Stats::PrimitiveGaugeSnapshot>& hostGauges() override { return host_gauges_; }
+  SystemTime snapshotTime() const override { return snapshot_time_; }
+
+private:
+  std::vector<CounterSnapshot> counters_;
+  std::vector<std::reference_wrapper<const Stats::Gauge>> gauges_;
+  std::vector<std::reference_wrapper<const Stats::ParentHistogram>> histograms_;
+  std::vector<std::reference_wrapper<const Stats::TextReadout>> text_readouts_;
+  std::vector<Stats::PrimitiveCounterSnapshot> host_counters_;
+  std::vector<Stats::PrimitiveGaugeSnapshot> host_gauges_;
+  SystemTime snapshot_time_;
+};
+
 } // namespace Server
 } // namespace Envoy
@@ -0,0 +1,234 @@
+// Consolidated codec microbenchmarks: HTTP/1 parsing (Balsa and http-parser), HTTP/2 request
+// dispatch, and header-map population, all driven with representative downstream traffic shapes
+// so codec changes can be compared release-to-release on realistic requests instead of only
+// minimal ones. Throughput is reported as bytes/second via SetBytesProcessed.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "source/common/buffer/buffer_impl.h"
+#include "source/common/common/assert.h"
+#include "source/common/http/header_map_impl.h"
+#include "source/common/http/http1/codec_impl.h"
+#include "source/common/http/http2/codec_impl.h"
+#include "source/common/http/utility.h"
+#include "source/common/stats/isolated_store_impl.h"
+
+#include "test/common/http/http2/http2_frame.h"
+#include "test/mocks/http/mocks.h"
+#include "test/mocks/network/mocks.h"
+#include "test/mocks/server/overload_manager.h"
+
+#include "absl/strings/str_cat.h"
+#include "benchmark/benchmark.h"
+#include "gmock/gmock.h"
+
+using testing::_;
+using testing::Invoke;
+using testing::NiceMock;
+
+namespace Envoy {
+namespace Http {
+namespace {
+
+// Representative downstream request shapes.
+enum class TrafficShape {
+  // "GET /" with only a host header.
+  Minimal,
+  // A browser-like GET with a typical dozen headers.
+  Browser,
+  // A request carrying a multi-kilobyte cookie, as seen behind session-heavy applications.
+  LargeCookie,
+};
+
+std::vector<std::pair<std::string, std::string>> shapeHeaders(TrafficShape shape) {
+  switch (shape) {
+  case TrafficShape::Minimal:
+    return {};
+  case TrafficShape::Browser:
+    return {
+        {"user-agent", "Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like "
+                       "Gecko) Chrome/120.0 Safari/537.36"},
+        {"accept", "text/html,application/xhtml+xml,application/xml;q=0.9,image/avif,*/*;q=0.8"},
+        {"accept-encoding", "gzip, deflate, br"},
+        {"accept-language", "en-US,en;q=0.9"},
+        {"cache-control", "max-age=0"},
+        {"cookie", "session=0123456789abcdef0123456789abcdef; theme=dark; tz=UTC"},
+        {"referer", "https://example.com/index.html"},
+        {"sec-fetch-dest", "document"},
+        {"sec-fetch-mode", "navigate"},
+        {"sec-fetch-site", "same-origin"},
+        {"upgrade-insecure-requests", "1"},
+        {"x-forwarded-for", "203.0.113.7"},
+    };
+  case TrafficShape::LargeCookie:
+    return {{"cookie", absl::StrCat("session=", std::string(4096, 'a'))}};
+  }
+  return {};
+}
+
+std::string makeHttp1RequestBlock(TrafficShape shape, size_t count) {
+  std::string request = "GET /path/to/resource?query=value HTTP/1.1\r\nhost: example.com\r\n";
+  for (const auto& header : shapeHeaders(shape)) {
+    absl::StrAppend(&request, header.first, ": ", header.second, "\r\n");
+  }
+  absl::StrAppend(&request, "\r\n");
+  std::string block;
+  for (size_t i = 0; i < count; i++) {
+    block += request;
+  }
+  return block;
+}
+
+std::string makeHttp2RequestBlock(TrafficShape shape, size_t count) {
+  using Http2::Http2Frame;
+  std::string wire(Http2Frame::Preamble, 24);
+  const Http2Frame settings_frame = Http2Frame::makeEmptySettingsFrame();
+  wire += std::string(settings_frame);
+  std::vector<Http2Frame::Header> extra_headers;
+  for (const auto& header : shapeHeaders(shape)) {
+    extra_headers.emplace_back(header.first, header.second);
+  }
+  for (size_t i = 0; i < count; i++) {
+    wire += std::string(
+        Http2Frame::makeRequest(i, "example.com", "/path/to/resource?query=value", extra_headers));
+  }
+  return wire;
+}
+
+// A fresh server codec is created per dispatch (matching the per-connection lifecycle in
+// production); the construction cost is amortized over the requests in the block.
+class Http1ServerHarness {
+public:
+  explicit Http1ServerHarness(bool use_balsa) {
+    settings_.use_balsa_parser_ = use_balsa;
+    ON_CALL(callbacks_, newStream(_, _))
+        .WillByDefault(Invoke([&](ResponseEncoder&, bool) -> RequestDecoder& { return decoder_; }));
+    ON_CALL(connection_, write(_, _)).WillByDefault(Invoke([](Buffer::Instance& data, bool) {
+      data.drain(data.length());
+    }));
+  }
+
+  void dispatchRequests(absl::string_view block) {
+    server_ = std::make_unique<Http1::ServerConnectionImpl>(
+        connection_, Http1::CodecStats::atomicGet(stats_, *store_.rootScope()), callbacks_,
+        settings_, Http::DEFAULT_MAX_REQUEST_HEADERS_KB, Http::DEFAULT_MAX_HEADERS_COUNT,
+        envoy::config::core::v3::HttpProtocolOptions::ALLOW, overload_manager_);
+    Buffer::OwnedImpl buffer(block);
+    const Status status = server_->dispatch(buffer);
+    ASSERT(status.ok());
+  }
+
+private:
+  Http1Settings settings_;
+  Stats::IsolatedStoreImpl store_;
+  Http1::CodecStats::AtomicPtr stats_;
+
+  NiceMock<MockRequestDecoder> decoder_;
+  NiceMock<Network::MockConnection> connection_;
+  NiceMock<MockServerConnectionCallbacks> callbacks_;
+  NiceMock<Server::MockOverloadManager> overload_manager_;
+
+  ServerConnectionPtr server_;
+};
+
+class Http2ServerHarness {
+public:
+  Http2ServerHarness()
+      : settings_(Envoy::Http2::Utility::initializeAndValidateOptions(
+                      envoy::config::core::v3::Http2ProtocolOptions())
+                      .value()) {
+    ON_CALL(callbacks_, newStream(_, _))
+        .WillByDefault(Invoke([&](ResponseEncoder&, bool) -> RequestDecoder& { return decoder_; }));
+    ON_CALL(connection_, write(_, _)).WillByDefault(Invoke([](Buffer::Instance& data, bool) {
+      data.drain(data.length());
+    }));
+  }
+
+  void dispatchRequests(absl::string_view wire) {
+    server_ = std::make_unique<Http2::ServerConnectionImpl>(
+        connection_, callbacks_, Http2::CodecStats::atomicGet(stats_, *store_.rootScope()), random_,
+        settings_, Http::DEFAULT_MAX_REQUEST_HEADERS_KB, Http::DEFAULT_MAX_HEADERS_COUNT,
+        envoy::config::core::v3::HttpProtocolOptions::ALLOW, overload_manager_);
+    Buffer::OwnedImpl buffer(wire);
+    const Status status = server_->dispatch(buffer);
+    ASSERT(status.ok());
+  }
+
+private:
+  const envoy::config::core::v3::Http2ProtocolOptions settings_;
+  Stats::IsolatedStoreImpl store_;
+  Http2::CodecStats::AtomicPtr stats_;
+
+  NiceMock<MockRequestDecoder> decoder_;
+  NiceMock<Network::MockConnection> connection_;
+  NiceMock<MockServerConnectionCallbacks> callbacks_;
+  NiceMock<Random::MockRandomGenerator> random_;
+  NiceMock<Server::MockOverloadManager> overload_manager_;
+
+  ServerConnectionPtr server_;
+};
+
+constexpr size_t RequestsPerIteration = 100;
+
+void http1ServerDispatch(benchmark::State& state) {
+  const auto shape = static_cast<TrafficShape>(state.range(0));
+  const bool use_balsa = state.range(1) == 1;
+  Http1ServerHarness harness(use_balsa);
+  const std::string block = makeHttp1RequestBlock(shape, RequestsPerIteration);
+  for (auto _ : state) { // NOLINT
+    harness.dispatchRequests(block);
+  }
+  state.SetBytesProcessed(state.iterations() * block.size());
+  state.SetItemsProcessed(state.iterations() * RequestsPerIteration);
+}
+BENCHMARK(http1ServerDispatch)
+    ->ArgsProduct({{0, 1, 2}, {0, 1}})
+    ->ArgNames({"shape", "balsa"})
+    ->Unit(benchmark::kMicrosecond);
+
+void http2ServerDispatch(benchmark::State& state) {
+  const auto shape = static_cast<TrafficShape>(state.range(0));
+  Http2ServerHarness harness;
+  const std::string wire = makeHttp2RequestBlock(shape, RequestsPerIteration);
+  for (auto _ : state) { // NOLINT
+    harness.dispatchRequests(wire);
+  }
+  state.SetBytesProcessed(state.iterations() * wire.size());
+  state.SetItemsProcessed(state.iterations() * RequestsPerIteration);
+}
+BENCHMARK(http2ServerDispatch)
+    ->ArgsProduct({{0, 1, 2}})
+    ->ArgNames({"shape"})
+    ->Unit(benchmark::kMicrosecond);
+
+void headerMapPopulateAndIterate(benchmark::State& state) {
+  const auto shape = static_cast<TrafficShape>(state.range(0));
+  const auto headers_to_add = shapeHeaders(shape);
+  size_t bytes = 0;
+  for (const auto& header : headers_to_add) {
+    bytes += header.first.size() + header.second.size();
+  }
+  for (auto _ : state) { // NOLINT
+    auto headers = RequestHeaderMapImpl::create();
+    headers->setHost("example.com");
+    headers->setPath("/path/to/resource?query=value");
+    headers->setMethod("GET");
+    for (const auto& header : headers_to_add) {
+      headers->addCopy(LowerCaseString(header.first), header.second);
+    }
+    size_t total = 0;
+    headers->iterate([&total](const HeaderEntry& entry) -> HeaderMap::Iterate {
+      total += entry.value().size();
+      return HeaderMap::Iterate::Continue;
+    });
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetBytesProcessed(state.iterations() * bytes);
+}
+BENCHMARK(headerMapPopulateAndIterate)->ArgsProduct({{0, 1, 2}})->ArgNames({"shape"});
+
+} // namespace
+} // namespace Http
+} // namespace Envoy
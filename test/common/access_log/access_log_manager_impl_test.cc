@@ -168,8 +168,8 @@ TEST_F(AccessLogManagerImplTest, FlushToLogFileOnDemand) {
   EXPECT_EQ(0UL, store_.counter("filesystem.flushed_by_timer").value());
 
   // The first write to a given file will start the flush thread. Because AccessManagerImpl::write
-  // holds the write_lock_ when the thread is started, the thread will flush on its first loop, once
-  // it obtains the write_lock_. Perform a write to get all that out of the way.
+  // stages the data before the thread is started, the thread will flush on its first loop when its
+  // initial pending check sees the staged data. Perform a write to get all that out of the way.
   EXPECT_CALL(*file_, write_(_))
       .WillOnce(Invoke([](absl::string_view data) -> Api::IoCallSizeResult {
         return Filesystem::resultSuccess<ssize_t>(static_cast<ssize_t>(data.length()));
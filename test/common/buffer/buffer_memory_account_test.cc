@@ -480,6 +480,48 @@ TEST_F(BufferMemoryAccountTest, RemainsInSameBucketIfChangesWithinThreshold) {
   account->clearDownstream();
 }
 
+TEST_F(BufferMemoryAccountTest, DefersClassUpdatesUntilSettlementWhenHookInstalled) {
+  uint32_t settlement_requests = 0;
+  factory_.setAccountSettlementHook([&settlement_requests]() { ++settlement_requests; });
+  auto account = factory_.createAccount(mock_reset_handler_);
+
+  // Class updates are deferred; the factory requests a single settlement pass
+  // regardless of the number of balance changes within the iteration.
+  account->charge(kMinimumBalanceToTrack);
+  account->charge(kMinimumBalanceToTrack);
+  EXPECT_EQ(settlement_requests, 1);
+  factory_.inspectMemoryClasses(noAccountsTracked);
+
+  factory_.settleAccountUpdates();
+  factory_.inspectMemoryClasses([](MemoryClassesToAccountsSet& memory_classes_to_account) {
+    EXPECT_EQ(memory_classes_to_account[1].size(), 1);
+  });
+
+  // The next balance change requests a settlement pass for the new iteration.
+  account->credit(getBalance(account));
+  EXPECT_EQ(settlement_requests, 2);
+  factory_.settleAccountUpdates();
+  factory_.inspectMemoryClasses(noAccountsTracked);
+
+  account->clearDownstream();
+}
+
+TEST_F(BufferMemoryAccountTest, ResetAccountsGivenPressureSettlesPendingUpdates) {
+  factory_.setAccountSettlementHook([]() {});
+  auto account = factory_.createAccount(mock_reset_handler_);
+
+  account->charge(kThresholdForFinalBucket);
+  factory_.inspectMemoryClasses(noAccountsTracked);
+
+  // Reading the tracked accounts settles deferred class updates first, so the
+  // account is visible to the overload reset pass.
+  EXPECT_CALL(mock_reset_handler_, resetStream(_));
+  EXPECT_EQ(factory_.resetAccountsGivenPressure(1.0), 1);
+
+  account->credit(getBalance(account));
+  account->clearDownstream();
+}
+
 TEST(WatermarkBufferFactoryTest, CanConfigureMinimumTrackingAmount) {
   auto config = envoy::config::overload::v3::BufferFactoryConfig();
   config.set_minimum_account_to_track_power_of_two(3);
@@ -1437,6 +1437,29 @@ TYPED_TEST(OwnedImplTypedTest, ReadReserveAndCommit) {
   OwnedImplTest::expectSlices({{6, 4090, 4096}}, buf);
 }
 
+// Default sized slice storage drained from one buffer must be reused (LIFO) by the next
+// default sized allocation on the same thread instead of hitting the allocator.
+TEST_F(OwnedImplTest, SliceStorageRecycledThroughThreadLocalPool) {
+  const void* first_storage;
+  {
+    Buffer::OwnedImpl buffer;
+    auto reservation = buffer.reserveSingleSlice(16384);
+    first_storage = reservation.slice().mem_;
+    reservation.commit(16384);
+    buffer.drain(16384);
+    // Draining all data does not destroy the slice until the buffer goes away.
+  }
+
+  Buffer::OwnedImpl other;
+  auto reservation = other.reserveSingleSlice(16384);
+  EXPECT_EQ(first_storage, reservation.slice().mem_);
+
+  // Non-default sizes bypass the pool.
+  Buffer::OwnedImpl large;
+  auto large_reservation = large.reserveSingleSlice(32768);
+  EXPECT_NE(first_storage, large_reservation.slice().mem_);
+}
+
 } // namespace
 } // namespace Buffer
 } // namespace Envoy
@@ -1,4 +1,9 @@
+#include "envoy/config/endpoint/v3/endpoint.pb.h"
+#include "envoy/config/endpoint/v3/endpoint.pb.validate.h"
+
 #include "source/common/config/decoded_resource_impl.h"
+#include "source/common/config/opaque_resource_decoder_impl.h"
+#include "source/common/protobuf/message_validator_impl.h"
 
 #include "test/mocks/config/mocks.h"
 #include "test/test_common/utility.h"
@@ -150,6 +155,50 @@ TEST(DecodedResourceImplTest, All) {
   }
 }
 
+// With an arena supplied and an arena-capable decoder, the resource is decoded onto the arena and
+// the decoded resource keeps the arena alive.
+TEST(DecodedResourceImplTest, ArenaDecoding) {
+  ProtobufMessage::StrictValidationVisitorImpl validation_visitor;
+  OpaqueResourceDecoderImpl<envoy::config::endpoint::v3::ClusterLoadAssignment> resource_decoder(
+      validation_visitor, "cluster_name");
+  envoy::config::endpoint::v3::ClusterLoadAssignment cluster_resource;
+  cluster_resource.set_cluster_name("fare");
+  ProtobufWkt::Any resource_any;
+  resource_any.PackFrom(cluster_resource);
+
+  auto arena = std::make_shared<Protobuf::Arena>();
+  DecodedResourceImplPtr decoded_resource =
+      *DecodedResourceImpl::fromResource(resource_decoder, resource_any, "1", arena);
+  EXPECT_EQ("fare", decoded_resource->name());
+  EXPECT_THAT(decoded_resource->resource(), ProtoEq(cluster_resource));
+  EXPECT_EQ(arena.get(), decoded_resource->resource().GetArena());
+  // The decoded resource holds a reference on the shared arena.
+  EXPECT_EQ(2, arena.use_count());
+  decoded_resource.reset();
+  EXPECT_EQ(1, arena.use_count());
+}
+
+// Decoders without arena support fall back to heap decoding even when an arena is supplied.
+TEST(DecodedResourceImplTest, ArenaDecodingFallback) {
+  MockOpaqueResourceDecoder resource_decoder;
+  ProtobufWkt::Any some_opaque_resource;
+  some_opaque_resource.set_type_url("some_type_url");
+
+  EXPECT_CALL(resource_decoder, decodeResource(ProtoEq(some_opaque_resource)))
+      .WillOnce(InvokeWithoutArgs(
+          []() -> ProtobufTypes::MessagePtr { return std::make_unique<ProtobufWkt::Empty>(); }));
+  EXPECT_CALL(resource_decoder, resourceName(ProtoEq(ProtobufWkt::Empty())))
+      .WillOnce(Return("some_name"));
+  auto arena = std::make_shared<Protobuf::Arena>();
+  DecodedResourceImplPtr decoded_resource =
+      *DecodedResourceImpl::fromResource(resource_decoder, some_opaque_resource, "1", arena);
+  EXPECT_EQ("some_name", decoded_resource->name());
+  EXPECT_THAT(decoded_resource->resource(), ProtoEq(ProtobufWkt::Empty()));
+  EXPECT_EQ(nullptr, decoded_resource->resource().GetArena());
+  // The arena is not retained when it was not used for the decode.
+  EXPECT_EQ(1, arena.use_count());
+}
+
 } // namespace
 } // namespace Config
 } // namespace Envoy
@@ -77,6 +77,21 @@ TEST_F(OpaqueResourceDecoderImplTest, Success) {
   EXPECT_EQ("foo", result.second);
 }
 
+// Arena decoding produces the same message, owned by the arena.
+TEST_F(OpaqueResourceDecoderImplTest, ArenaSuccess) {
+  envoy::config::endpoint::v3::ClusterLoadAssignment cluster_resource;
+  cluster_resource.set_cluster_name("foo");
+  ProtobufWkt::Any opaque_resource;
+  opaque_resource.PackFrom(cluster_resource);
+  Protobuf::Arena arena;
+  Protobuf::Message* decoded_resource =
+      resource_decoder_.decodeResourceWithArena(opaque_resource, arena);
+  ASSERT_NE(nullptr, decoded_resource);
+  EXPECT_EQ(&arena, decoded_resource->GetArena());
+  EXPECT_THAT(*decoded_resource, ProtoEq(cluster_resource));
+  EXPECT_EQ("foo", resource_decoder_.resourceName(*decoded_resource));
+}
+
 } // namespace
 } // namespace Config
 } // namespace Envoy
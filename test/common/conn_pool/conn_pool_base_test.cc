@@ -5,6 +5,7 @@
 #include "test/mocks/upstream/cluster_info.h"
 #include "test/mocks/upstream/host.h"
 #include "test/test_common/simulated_time_system.h"
+#include "test/test_common/test_runtime.h"
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -82,6 +83,7 @@ public:
 class TestConnPoolImplBase : public ConnPoolImplBase {
 public:
   using ConnPoolImplBase::ConnPoolImplBase;
+  using ConnPoolImplBase::perUpstreamPreconnectRatio;
   ConnectionPool::Cancellable* newPendingStream(AttachContext& context,
                                                 bool can_send_early_data) override {
     auto entry = std::make_unique<TestPendingStream>(*this, context, can_send_early_data);
@@ -684,5 +686,77 @@ TEST_F(ConnPoolImplDispatcherBaseTest, PoolDrainsWithEarlyDataStreams) {
   closeStream();
 }
 
+// Verify that with a configured preconnect ratio above one, the effective ratio adapts
+// to the observed stream arrival rate and connection establishment latency, using the
+// configured value only as an upper bound.
+TEST_F(ConnPoolImplDispatcherBaseTest, AdaptivePreconnectRatio) {
+  ON_CALL(*cluster_, perUpstreamPreconnectRatio).WillByDefault(Return(3.0));
+  EXPECT_CALL(pool_, instantiateActiveClient).Times(AnyNumber());
+  EXPECT_CALL(pool_, onPoolReady).Times(AnyNumber());
+
+  // With no samples recorded, the configured ratio is used as-is.
+  EXPECT_FLOAT_EQ(3.0, pool_.perUpstreamPreconnectRatio());
+
+  // First stream; the connection completes its handshake after 100ms.
+  pool_.newStreamImpl(context_, /*can_send_early_data=*/false);
+  time_system_.advanceTimeAndRun(std::chrono::milliseconds(100), *dispatcher_,
+                                 Event::Dispatcher::RunType::NonBlock);
+  clients_.front()->onEvent(Network::ConnectionEvent::Connected);
+
+  // A single arrival yields no inter-arrival sample, so the configured ratio still applies.
+  EXPECT_FLOAT_EQ(3.0, pool_.perUpstreamPreconnectRatio());
+
+  // A second stream a full second later: with one stream expected per second and 100ms
+  // handshakes, barely any extra capacity is warranted.
+  time_system_.advanceTimeAndRun(std::chrono::milliseconds(1000), *dispatcher_,
+                                 Event::Dispatcher::RunType::NonBlock);
+  pool_.newStreamImpl(context_, /*can_send_early_data=*/false);
+  const float slow_ratio = pool_.perUpstreamPreconnectRatio();
+  EXPECT_GT(slow_ratio, 1.0);
+  EXPECT_LT(slow_ratio, 1.1);
+
+  // A burst of back-to-back arrivals drives the effective ratio back up, still capped
+  // by the configured value.
+  for (int i = 0; i < 20; ++i) {
+    time_system_.advanceTimeAndRun(std::chrono::milliseconds(1), *dispatcher_,
+                                   Event::Dispatcher::RunType::NonBlock);
+    pool_.newStreamImpl(context_, /*can_send_early_data=*/false);
+  }
+  const float burst_ratio = pool_.perUpstreamPreconnectRatio();
+  EXPECT_GT(burst_ratio, slow_ratio);
+  EXPECT_LE(burst_ratio, 3.0);
+
+  // Clean up. Closing the connections fails the streams still pending.
+  EXPECT_CALL(pool_, onPoolFailure).Times(AnyNumber());
+  pool_.destructAllConnections();
+}
+
+// With the runtime feature disabled, the configured ratio is used regardless of the
+// observed arrival rate and connect latency.
+TEST_F(ConnPoolImplDispatcherBaseTest, AdaptivePreconnectRatioDisabled) {
+  TestScopedRuntime scoped_runtime;
+  scoped_runtime.mergeValues({{"envoy.reloadable_features.conn_pool_adaptive_preconnect", "false"}});
+
+  ON_CALL(*cluster_, perUpstreamPreconnectRatio).WillByDefault(Return(3.0));
+  EXPECT_CALL(pool_, instantiateActiveClient).Times(AnyNumber());
+  EXPECT_CALL(pool_, onPoolReady).Times(AnyNumber());
+
+  // Record a handshake latency sample and an inter-arrival sample which would otherwise
+  // scale the ratio down.
+  pool_.newStreamImpl(context_, /*can_send_early_data=*/false);
+  time_system_.advanceTimeAndRun(std::chrono::milliseconds(100), *dispatcher_,
+                                 Event::Dispatcher::RunType::NonBlock);
+  clients_.front()->onEvent(Network::ConnectionEvent::Connected);
+  time_system_.advanceTimeAndRun(std::chrono::milliseconds(1000), *dispatcher_,
+                                 Event::Dispatcher::RunType::NonBlock);
+  pool_.newStreamImpl(context_, /*can_send_early_data=*/false);
+
+  EXPECT_FLOAT_EQ(3.0, pool_.perUpstreamPreconnectRatio());
+
+  // Clean up. Closing the connections fails the stream still pending.
+  EXPECT_CALL(pool_, onPoolFailure).Times(AnyNumber());
+  pool_.destructAllConnections();
+}
+
 } // namespace ConnectionPool
 } // namespace Envoy
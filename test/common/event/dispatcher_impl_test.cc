@@ -284,6 +284,37 @@ TEST(DeferredDeleteTest, DeferredDelete) {
   dispatcher->clearDeferredDeleteList();
 }
 
+TEST(DeferredDeleteTest, BatchedDeferredDelete) {
+  Api::ApiPtr api = Api::createApiForTest();
+  DispatcherPtr dispatcher(api->allocateDispatcher("test_thread"));
+  static_cast<DispatcherImpl*>(dispatcher.get())->setDeferredDeleteBatchSizeForTest(2);
+
+  uint32_t deleted = 0;
+  for (int i = 0; i < 5; i++) {
+    dispatcher->deferredDelete(
+        DeferredDeletablePtr{new TestDeferredDeletable([&deleted]() -> void { deleted++; })});
+  }
+
+  // Each pass destroys at most the configured batch and reposts itself for the remainder.
+  dispatcher->clearDeferredDeleteList();
+  EXPECT_EQ(2, deleted);
+  dispatcher->clearDeferredDeleteList();
+  EXPECT_EQ(4, deleted);
+  dispatcher->clearDeferredDeleteList();
+  EXPECT_EQ(5, deleted);
+
+  // Objects deferred during an in-progress drain land on the other vector and are destroyed by
+  // subsequent passes, still respecting the budget.
+  for (int i = 0; i < 3; i++) {
+    dispatcher->deferredDelete(
+        DeferredDeletablePtr{new TestDeferredDeletable([&deleted]() -> void { deleted++; })});
+  }
+  dispatcher->clearDeferredDeleteList();
+  EXPECT_EQ(7, deleted);
+  dispatcher->clearDeferredDeleteList();
+  EXPECT_EQ(8, deleted);
+}
+
 TEST(DeferredTaskTest, DeferredTask) {
   InSequence s;
   Api::ApiPtr api = Api::createApiForTest();
@@ -1352,6 +1383,35 @@ TEST_F(TimerImplTest, TimerChainDelete) {
   dispatcher_->run(Dispatcher::RunType::NonBlock);
 }
 
+// Millisecond granularity timers are armed through libevent's common timeout lists. Verify that
+// arming, rescheduling with a different duration, disabling and firing behave the same as heap
+// timers, and that overflowing the bounded common timeout cache falls back cleanly to the heap.
+TEST_F(TimerImplTest, ManyTimersWithSharedDurations) {
+  EXPECT_CALL(prepare_watcher_, ready()).Times(testing::AnyNumber());
+
+  int fired = 0;
+  std::vector<Event::TimerPtr> timers;
+  for (int i = 0; i < 100; i++) {
+    timers.emplace_back(dispatcher_->createTimer([&fired] { fired++; }));
+    // 40 distinct durations is more than the common timeout cache holds, so the longer
+    // durations fall back to the min-heap.
+    timers.back()->enableTimer(std::chrono::milliseconds(1 + (i % 40)));
+    EXPECT_TRUE(timers.back()->enabled());
+  }
+
+  // Reschedule one of the common timeout timers onto another duration and disable another.
+  timers[0]->enableTimer(std::chrono::milliseconds(5));
+  timers[1]->disableTimer();
+  EXPECT_FALSE(timers[1]->enabled());
+
+  dispatcher_->run(Dispatcher::RunType::Block);
+
+  EXPECT_EQ(99, fired);
+  for (const auto& timer : timers) {
+    EXPECT_FALSE(timer->enabled());
+  }
+}
+
 class TimerImplTimingTest : public testing::Test {
 public:
   std::chrono::nanoseconds getTimerTiming(Event::SimulatedTimeSystem& time_system,
@@ -523,6 +523,34 @@ TEST_F(ScaledRangeTimerManagerTest, MultipleTimersSameTimesFastClock) {
   EXPECT_THAT(*timers[2].trigger_times, ElementsAre(start + std::chrono::seconds(3)));
 }
 
+TEST_F(ScaledRangeTimerManagerTest, MultipleTimersSharingMinDurationQueue) {
+  ScaledRangeTimerManagerImpl manager(dispatcher_);
+  std::vector<TrackedRangeTimer> timers;
+  timers.reserve(3);
+
+  const MonotonicTime start = simTime().monotonicTime();
+
+  // All 3 timers have the same 2 second min duration, so they share a single underlying timer
+  // while in the waiting-for-min state.
+  for (int i = 0; i < 3; ++i) {
+    timers.emplace_back(AbsoluteMinimum(std::chrono::seconds(2)), manager, simTime());
+  }
+  timers[0].timer->enableTimer(std::chrono::seconds(3));
+  timers[1].timer->enableTimer(std::chrono::seconds(4));
+  timers[2].timer->enableTimer(std::chrono::seconds(5));
+
+  // Disabling a timer in the middle of the shared min-duration queue shouldn't affect the others.
+  timers[1].timer->disableTimer();
+
+  for (int i = 0; i < 6; ++i) {
+    simTime().advanceTimeAndRun(std::chrono::seconds(1), dispatcher_, Dispatcher::RunType::Block);
+  }
+
+  EXPECT_THAT(*timers[0].trigger_times, ElementsAre(start + std::chrono::seconds(3)));
+  EXPECT_TRUE(timers[1].trigger_times->empty());
+  EXPECT_THAT(*timers[2].trigger_times, ElementsAre(start + std::chrono::seconds(5)));
+}
+
 TEST_F(ScaledRangeTimerManagerTest, ScheduledWithScalingFactorZero) {
   ScaledRangeTimerManagerImpl manager(dispatcher_);
   manager.setScaleFactor(UnitFloat(0));
@@ -254,6 +254,30 @@ TEST(SubstitutionFormatterTest, plainNumberFormatter) {
               ProtoEq(ValueUtil::numberValue(400)));
 }
 
+TEST(SubstitutionFormatterTest, formatToAppendsToOutput) {
+  NiceMock<StreamInfo::MockStreamInfo> stream_info;
+  std::string output;
+
+  PlainStringFormatter string_formatter("plain");
+  EXPECT_TRUE(string_formatter.formatWithContextTo({}, stream_info, output));
+  EXPECT_EQ("plain", output);
+
+  PlainNumberFormatter number_formatter(400);
+  EXPECT_TRUE(number_formatter.formatWithContextTo({}, stream_info, output));
+  EXPECT_EQ("plain400", output);
+
+  // A provider without a value appends nothing and reports it to the caller so that the
+  // caller can insert its unspecified-value string.
+  StreamInfoFormatter request_duration_format("REQUEST_DURATION");
+  EXPECT_FALSE(request_duration_format.formatWithContextTo({}, stream_info, output));
+  EXPECT_EQ("plain400", output);
+
+  StreamInfoFormatter bytes_received_format("BYTES_RECEIVED");
+  EXPECT_CALL(stream_info, bytesReceived()).WillRepeatedly(Return(1));
+  EXPECT_TRUE(bytes_received_format.formatWithContextTo({}, stream_info, output));
+  EXPECT_EQ("plain4001", output);
+}
+
 TEST(SubstitutionFormatterTest, inFlightDuration) {
   Event::SimulatedTimeSystem time_system;
   time_system.setSystemTime(std::chrono::milliseconds(0));
@@ -33,5 +33,46 @@ TEST(CharacterSetValidationTest, Test) {
   }
 }
 
+TEST(CharacterSetValidationTest, BulkValidatorMatchesScalar) {
+  // The vectorized path must agree with the per-byte lookup for every byte value,
+  // at every alignment, and across the 16 byte block boundary.
+  for (const auto& table : {kGenericHeaderNameCharTable, kUriQueryAndFragmentCharTable}) {
+    const CharTableBulkValidator validator(table);
+    for (unsigned c = 0; c < 256; ++c) {
+      for (size_t length : {1, 3, 15, 16, 17, 32, 33, 64}) {
+        std::string input(length, 'a');
+        for (size_t position : {size_t(0), length / 2, length - 1}) {
+          input[position] = static_cast<char>(c);
+          bool expected = true;
+          for (const char in : input) {
+            expected &= testCharInTable(table, in);
+          }
+          EXPECT_EQ(validator.allCharsInTable(input), expected)
+              << "char " << c << " length " << length << " position " << position;
+          input[position] = 'a';
+        }
+      }
+    }
+  }
+}
+
+TEST(CharacterSetValidationTest, BulkValidatorExtendedAsciiAllowed) {
+  // A table that uniformly allows extended ASCII (like the UHV header value table)
+  // takes the vectorized path and must accept obs-text bytes.
+  constexpr std::array<uint32_t, 8> kTableWithObsText = {
+      0b00000000000000000000000000000000, 0b11111111111111111111111111111111,
+      0b11111111111111111111111111111111, 0b11111111111111111111111111111110,
+      0b11111111111111111111111111111111, 0b11111111111111111111111111111111,
+      0b11111111111111111111111111111111, 0b11111111111111111111111111111111,
+  };
+  const CharTableBulkValidator validator(kTableWithObsText);
+  for (unsigned c = 0; c < 256; ++c) {
+    std::string input(32, static_cast<char>(c));
+    EXPECT_EQ(validator.allCharsInTable(input), testCharInTable(kTableWithObsText, input[0]))
+        << "char " << c;
+  }
+  EXPECT_TRUE(validator.allCharsInTable(""));
+}
+
 } // namespace Http
 } // namespace Envoy
@@ -0,0 +1,51 @@
+#include "source/common/http/filter_chain_timing.h"
+
+#include "test/test_common/simulated_time_system.h"
+
+#include "absl/strings/match.h"
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Http {
+namespace {
+
+class FilterChainTimingTest : public testing::Test {
+protected:
+  Event::SimulatedTimeSystem time_system_;
+};
+
+TEST_F(FilterChainTimingTest, SerializesCheckpointsRelativeToStart) {
+  FilterChainTimingRecorder recorder(time_system_);
+
+  time_system_.advanceTimeWait(std::chrono::microseconds(5));
+  recorder.record("envoy.filters.http.lua", FilterChainTimingRecorder::Event::DecodeHeaders);
+  time_system_.advanceTimeWait(std::chrono::microseconds(10));
+  recorder.record("envoy.filters.http.router", FilterChainTimingRecorder::Event::DecodeHeaders);
+  time_system_.advanceTimeWait(std::chrono::microseconds(3));
+  recorder.record("envoy.filters.http.lua", FilterChainTimingRecorder::Event::EncodeHeaders);
+
+  EXPECT_EQ("decode-headers:envoy.filters.http.lua=5000ns,"
+            "decode-headers:envoy.filters.http.router=15000ns,"
+            "encode-headers:envoy.filters.http.lua=18000ns",
+            recorder.serializeAsString());
+}
+
+TEST_F(FilterChainTimingTest, EmptyRecorderSerializesToEmptyString) {
+  FilterChainTimingRecorder recorder(time_system_);
+  EXPECT_EQ("", recorder.serializeAsString());
+}
+
+TEST_F(FilterChainTimingTest, CheckpointsPastTheLimitAreDroppedAndCounted) {
+  FilterChainTimingRecorder recorder(time_system_);
+
+  for (size_t i = 0; i < FilterChainTimingRecorder::MaxCheckpoints + 2; i++) {
+    recorder.record("filter", FilterChainTimingRecorder::Event::DecodeData);
+  }
+
+  const std::string serialized = recorder.serializeAsString().value();
+  EXPECT_TRUE(absl::EndsWith(serialized, ",dropped=2")) << serialized;
+}
+
+} // namespace
+} // namespace Http
+} // namespace Envoy
@@ -1086,5 +1086,26 @@ TEST(HeaderMapImplTest, HeaderMapMaxLimits) {
   EXPECT_EQ(response_trailer->maxHeadersCount(), 3);
 }
 
+// Arena-backed maps must behave identically to heap-backed ones through add/get/remove/clear,
+// including when the header count forces the arena to chain additional slabs.
+TEST(HeaderMapImplTest, ArenaBackedMode) {
+  auto headers = RequestHeaderMapImpl::create(UINT32_MAX, UINT32_MAX, /*arena_backed=*/true);
+  for (int i = 0; i < 200; ++i) {
+    headers->addCopy(LowerCaseString(absl::StrCat("x-header-", i)), absl::StrCat("value-", i));
+  }
+  EXPECT_EQ(200, headers->size());
+  EXPECT_EQ("value-123",
+            headers->get(LowerCaseString("x-header-123"))[0]->value().getStringView());
+  EXPECT_EQ(1, headers->remove(LowerCaseString("x-header-50")));
+  EXPECT_EQ(199, headers->size());
+  headers->setCopy(LowerCaseString("x-header-51"), "updated");
+  EXPECT_EQ("updated", headers->get(LowerCaseString("x-header-51"))[0]->value().getStringView());
+  headers->clear();
+  EXPECT_TRUE(headers->empty());
+  // The map must remain usable after clear(); new entries keep drawing from the same arena.
+  headers->addCopy(LowerCaseString("x-after-clear"), "value");
+  EXPECT_EQ(1, headers->size());
+}
+
 } // namespace Http
 } // namespace Envoy
@@ -109,6 +109,25 @@ private:
   Http::ServerHeaderValidator* header_validator_{nullptr};
   Http::ResponseEncoder* response_encoder_{nullptr};
 };
+
+// Returns the number of HTTP/2 frames serialized in `data`. A single connection write may carry
+// every frame the codec had pending, so flood tests that track per-frame counts parse each write
+// instead of assuming one frame per write. `data` must start on a frame boundary and contain only
+// complete frames.
+uint32_t countFrames(const Buffer::Instance& data) {
+  uint32_t frame_count = 0;
+  uint64_t offset = 0;
+  while (offset < data.length()) {
+    uint8_t length_field[3];
+    data.copyOut(offset, sizeof(length_field), length_field);
+    const uint32_t payload_length =
+        (length_field[0] << 16) | (length_field[1] << 8) | length_field[2];
+    offset += Http2Frame::HeaderSize + payload_length;
+    ++frame_count;
+  }
+  EXPECT_EQ(offset, data.length());
+  return frame_count;
+}
 } // namespace
 
 enum class Http2Impl {
@@ -2346,7 +2365,7 @@ TEST_P(Http2CodecImplFlowControlTest, WindowUpdateOnReadResumingFlood) {
   Buffer::OwnedImpl buffer;
   ON_CALL(server_connection_, write(_, _))
       .WillByDefault(Invoke([&buffer, &frame_count](Buffer::Instance& frame, bool) {
-        ++frame_count;
+        frame_count += countFrames(frame);
         buffer.move(frame);
       }));
 
@@ -3122,9 +3141,16 @@ TEST_P(Http2CodecImplTest, PingFloodMitigationDisabled) {
     submitPing(client_, i);
   }
 
-  EXPECT_CALL(server_connection_, write(_, _))
-      .Times(CommonUtility::OptionsLimits::DEFAULT_MAX_OUTBOUND_CONTROL_FRAMES + 1);
+  int ack_count = 0;
+  Buffer::OwnedImpl buffer;
+  ON_CALL(server_connection_, write(_, _))
+      .WillByDefault(Invoke([&buffer, &ack_count](Buffer::Instance& frame, bool) {
+        ack_count += countFrames(frame);
+        buffer.move(frame);
+      }));
+
   EXPECT_NO_THROW(driveToCompletion());
+  EXPECT_EQ(ack_count, CommonUtility::OptionsLimits::DEFAULT_MAX_OUTBOUND_CONTROL_FRAMES + 1);
 }
 
 // Verify that outbound control frame counter decreases when send buffer is drained
@@ -3150,7 +3176,7 @@ TEST_P(Http2CodecImplTest, PingFloodCounterReset) {
   Buffer::OwnedImpl buffer;
   ON_CALL(server_connection_, write(_, _))
       .WillByDefault(Invoke([&buffer, &ack_count](Buffer::Instance& frame, bool) {
-        ++ack_count;
+        ack_count += countFrames(frame);
         buffer.move(frame);
       }));
 
@@ -158,6 +158,38 @@ TEST_F(Http3StatusTrackerImplTest, MarkBrokenThenConfirmed) {
   EXPECT_TRUE(tracker_.isHttp3Confirmed());
 }
 
+TEST_F(Http3StatusTrackerImplTest, StateChangedCallback) {
+  int callback_count = 0;
+  MockTimer* timer = new MockTimer(&dispatcher_); // Owned by tracker.
+  Http3StatusTrackerImpl tracker(dispatcher_, [&callback_count]() { ++callback_count; });
+
+  EXPECT_CALL(*timer, enabled()).WillOnce(Return(false));
+  EXPECT_CALL(*timer, enableTimer(std::chrono::milliseconds(1 * 1000), nullptr));
+  tracker.markHttp3Broken();
+  EXPECT_EQ(1, callback_count);
+
+  // Marking broken again does not change the state.
+  EXPECT_CALL(*timer, enabled()).WillOnce(Return(true));
+  tracker.markHttp3Broken();
+  EXPECT_EQ(1, callback_count);
+
+  // Expiration transitions broken to failed recently.
+  timer->invokeCallback();
+  EXPECT_EQ(2, callback_count);
+
+  EXPECT_CALL(*timer, enabled()).WillOnce(Return(false));
+  tracker.markHttp3Confirmed();
+  EXPECT_EQ(3, callback_count);
+
+  // Re-confirming does not change the state.
+  EXPECT_CALL(*timer, enabled()).WillOnce(Return(false));
+  tracker.markHttp3Confirmed();
+  EXPECT_EQ(3, callback_count);
+
+  tracker.markHttp3FailedRecently();
+  EXPECT_EQ(4, callback_count);
+}
+
 TEST_F(Http3StatusTrackerImplTest, MarkFailedRecentlyAndThenBroken) {
   tracker_.markHttp3FailedRecently();
   EXPECT_TRUE(tracker_.hasHttp3FailedRecently());
@@ -86,10 +86,10 @@ TEST_P(HttpServerPropertiesCacheImplTest, SetAlternativesThenSrtt) {
   EXPECT_EQ(0, protocols_->size());
   EXPECT_EQ(std::chrono::microseconds(0), protocols_->getSrtt(origin1_));
   EXPECT_CALL_WHEN_STORE_VALID(
-      addOrUpdate("https://hostname1:1", "alpn1=\"hostname1:1\"; ma=5|0|0", kNoTtl));
+      addOrUpdate("https://hostname1:1", "alpn1=\"hostname1:1\"; ma=5|0|0|0", kNoTtl));
   protocols_->setAlternatives(origin1_, protocols1_);
   EXPECT_CALL_WHEN_STORE_VALID(
-      addOrUpdate("https://hostname1:1", "alpn1=\"hostname1:1\"; ma=5|5|0", kNoTtl));
+      addOrUpdate("https://hostname1:1", "alpn1=\"hostname1:1\"; ma=5|5|0|0", kNoTtl));
   protocols_->setSrtt(origin1_, std::chrono::microseconds(5));
   EXPECT_EQ(1, protocols_->size());
   EXPECT_EQ(std::chrono::microseconds(5), protocols_->getSrtt(origin1_));
@@ -98,12 +98,12 @@ TEST_P(HttpServerPropertiesCacheImplTest, SetAlternativesThenSrtt) {
 TEST_P(HttpServerPropertiesCacheImplTest, SetSrttThenAlternatives) {
   initialize();
   EXPECT_EQ(0, protocols_->size());
-  EXPECT_CALL_WHEN_STORE_VALID(addOrUpdate("https://hostname1:1", "clear|5|0", kNoTtl));
+  EXPECT_CALL_WHEN_STORE_VALID(addOrUpdate("https://hostname1:1", "clear|5|0|0", kNoTtl));
   protocols_->setSrtt(origin1_, std::chrono::microseconds(5));
   EXPECT_EQ(1, protocols_->size());
   EXPECT_EQ(std::chrono::microseconds(5), protocols_->getSrtt(origin1_));
   EXPECT_CALL_WHEN_STORE_VALID(
-      addOrUpdate("https://hostname1:1", "alpn1=\"hostname1:1\"; ma=5|5|0", kNoTtl));
+      addOrUpdate("https://hostname1:1", "alpn1=\"hostname1:1\"; ma=5|5|0|0", kNoTtl));
   protocols_->setAlternatives(origin1_, protocols1_);
   EXPECT_EQ(std::chrono::microseconds(5), protocols_->getSrtt(origin1_));
 }
@@ -111,7 +111,7 @@ TEST_P(HttpServerPropertiesCacheImplTest, SetSrttThenAlternatives) {
 TEST_P(HttpServerPropertiesCacheImplTest, SetConcurrency) {
   initialize();
   EXPECT_EQ(0, protocols_->size());
-  EXPECT_CALL_WHEN_STORE_VALID(addOrUpdate("https://hostname1:1", "clear|0|5", kNoTtl));
+  EXPECT_CALL_WHEN_STORE_VALID(addOrUpdate("https://hostname1:1", "clear|0|5|0", kNoTtl));
   protocols_->setConcurrentStreams(origin1_, 5);
   EXPECT_EQ(5, protocols_->getConcurrentStreams(origin1_));
 }
@@ -119,7 +119,7 @@ TEST_P(HttpServerPropertiesCacheImplTest, SetConcurrency) {
 TEST_P(HttpServerPropertiesCacheImplTest, FindAlternatives) {
   initialize();
   EXPECT_CALL_WHEN_STORE_VALID(
-      addOrUpdate("https://hostname1:1", "alpn1=\"hostname1:1\"; ma=5|0|0", kNoTtl));
+      addOrUpdate("https://hostname1:1", "alpn1=\"hostname1:1\"; ma=5|0|0|0", kNoTtl));
   protocols_->setAlternatives(origin1_, protocols1_);
   OptRef<const std::vector<HttpServerPropertiesCacheImpl::AlternateProtocol>> protocols =
       protocols_->findAlternatives(origin1_);
@@ -130,10 +130,10 @@ TEST_P(HttpServerPropertiesCacheImplTest, FindAlternatives) {
 TEST_P(HttpServerPropertiesCacheImplTest, FindAlternativesAfterReplacement) {
   initialize();
   EXPECT_CALL_WHEN_STORE_VALID(
-      addOrUpdate("https://hostname1:1", "alpn1=\"hostname1:1\"; ma=5|0|0", kNoTtl));
+      addOrUpdate("https://hostname1:1", "alpn1=\"hostname1:1\"; ma=5|0|0|0", kNoTtl));
   protocols_->setAlternatives(origin1_, protocols1_);
   EXPECT_CALL_WHEN_STORE_VALID(
-      addOrUpdate("https://hostname1:1", "alpn2=\"hostname2:2\"; ma=10|0|0", kNoTtl));
+      addOrUpdate("https://hostname1:1", "alpn2=\"hostname2:2\"; ma=10|0|0|0", kNoTtl));
   protocols_->setAlternatives(origin1_, protocols2_);
   OptRef<const std::vector<HttpServerPropertiesCacheImpl::AlternateProtocol>> protocols =
       protocols_->findAlternatives(origin1_);
@@ -145,10 +145,10 @@ TEST_P(HttpServerPropertiesCacheImplTest, FindAlternativesAfterReplacement) {
 TEST_P(HttpServerPropertiesCacheImplTest, FindAlternativesForMultipleOrigins) {
   initialize();
   EXPECT_CALL_WHEN_STORE_VALID(
-      addOrUpdate("https://hostname1:1", "alpn1=\"hostname1:1\"; ma=5|0|0", kNoTtl));
+      addOrUpdate("https://hostname1:1", "alpn1=\"hostname1:1\"; ma=5|0|0|0", kNoTtl));
   protocols_->setAlternatives(origin1_, protocols1_);
   EXPECT_CALL_WHEN_STORE_VALID(
-      addOrUpdate("https://hostname2:2", "alpn2=\"hostname2:2\"; ma=10|0|0", kNoTtl));
+      addOrUpdate("https://hostname2:2", "alpn2=\"hostname2:2\"; ma=10|0|0|0", kNoTtl));
   protocols_->setAlternatives(origin2_, protocols2_);
   OptRef<const std::vector<HttpServerPropertiesCacheImpl::AlternateProtocol>> protocols =
       protocols_->findAlternatives(origin1_);
@@ -162,7 +162,7 @@ TEST_P(HttpServerPropertiesCacheImplTest, FindAlternativesForMultipleOrigins) {
 TEST_P(HttpServerPropertiesCacheImplTest, FindAlternativesAfterExpiration) {
   initialize();
   EXPECT_CALL_WHEN_STORE_VALID(
-      addOrUpdate("https://hostname1:1", "alpn1=\"hostname1:1\"; ma=5|0|0", kNoTtl));
+      addOrUpdate("https://hostname1:1", "alpn1=\"hostname1:1\"; ma=5|0|0|0", kNoTtl));
   protocols_->setAlternatives(origin1_, protocols1_);
   dispatcher_.globalTimeSystem().advanceTimeWait(Seconds(6));
   EXPECT_CALL_WHEN_STORE_VALID(remove("https://hostname1:1"));
@@ -176,12 +176,12 @@ TEST_P(HttpServerPropertiesCacheImplTest, FindAlternativesAfterPartialExpiration
   initialize();
   EXPECT_CALL_WHEN_STORE_VALID(
       addOrUpdate("https://hostname1:1",
-                  "alpn1=\"hostname1:1\"; ma=5,alpn2=\"hostname2:2\"; ma=10|0|0", kNoTtl));
+                  "alpn1=\"hostname1:1\"; ma=5,alpn2=\"hostname2:2\"; ma=10|0|0|0", kNoTtl));
   std::vector<HttpServerPropertiesCacheImpl::AlternateProtocol> both = {protocol1_, protocol2_};
   protocols_->setAlternatives(origin1_, both);
   dispatcher_.globalTimeSystem().advanceTimeWait(Seconds(6));
   EXPECT_CALL_WHEN_STORE_VALID(
-      addOrUpdate("https://hostname1:1", "alpn2=\"hostname2:2\"; ma=10|0|0", kNoTtl));
+      addOrUpdate("https://hostname1:1", "alpn2=\"hostname2:2\"; ma=10|0|0|0", kNoTtl));
   OptRef<const std::vector<HttpServerPropertiesCacheImpl::AlternateProtocol>> protocols =
       protocols_->findAlternatives(origin1_);
   ASSERT_TRUE(protocols.has_value());
@@ -250,8 +250,9 @@ TEST_P(HttpServerPropertiesCacheImplTest, MaxEntries) {
     const HttpServerPropertiesCache::Origin origin = {https_, hostname, i};
     HttpServerPropertiesCache::AlternateProtocol protocol = {alpn1_, hostname, i, expiration1_};
     std::vector<HttpServerPropertiesCache::AlternateProtocol> protocols = {protocol};
-    EXPECT_CALL(*store_, addOrUpdate(absl::StrCat("https://hostname:", i),
-                                     absl::StrCat("alpn1=\"hostname:", i, "\"; ma=5|0|0"), kNoTtl));
+    EXPECT_CALL(*store_,
+                addOrUpdate(absl::StrCat("https://hostname:", i),
+                            absl::StrCat("alpn1=\"hostname:", i, "\"; ma=5|0|0|0"), kNoTtl));
     if (i == max_entries_) {
       EXPECT_CALL(*store_, remove("https://hostname:0"));
     }
@@ -292,15 +293,18 @@ TEST_P(HttpServerPropertiesCacheImplTest, ToAndFromString) {
     EXPECT_EQ(expected_alt_svc, alt_svc);
   };
 
-  testAltSvc("h3-29=\":443\"; ma=86400|0|0", "h3-29=\":443\"; ma=86400|0|0");
+  // Legacy entries without an HTTP/3 status round trip to the new format.
+  testAltSvc("h3-29=\":443\"; ma=86400|0|0", "h3-29=\":443\"; ma=86400|0|0|0");
   testAltSvc("h3-29=\":443\"; ma=86400,h3=\":443\"; ma=60|2|0",
-             "h3-29=\":443\"; ma=86400,h3=\":443\"; ma=60|2|0");
+             "h3-29=\":443\"; ma=86400,h3=\":443\"; ma=60|2|0|0");
+  // The HTTP/3 status is preserved.
+  testAltSvc("h3-29=\":443\"; ma=86400|0|0|2", "h3-29=\":443\"; ma=86400|0|0|2");
 
   // Test once more to make sure we handle time advancing correctly.
   // the absolute expiration time in testAltSvc is expected to be 86400 so add
   // 60s to the default max age.
   dispatcher_.globalTimeSystem().advanceTimeWait(std::chrono::seconds(60));
-  testAltSvc("h3-29=\":443\"; ma=86460|2000|0", "h3-29=\":443\"; ma=86460|2000|0");
+  testAltSvc("h3-29=\":443\"; ma=86460|2000|0", "h3-29=\":443\"; ma=86460|2000|0|0");
 }
 
 TEST_P(HttpServerPropertiesCacheImplTest, InvalidString) {
@@ -308,7 +312,17 @@ TEST_P(HttpServerPropertiesCacheImplTest, InvalidString) {
   // Too many numbers
   EXPECT_FALSE(
       HttpServerPropertiesCacheImpl::originDataFromString(
-          "h3-29=\":443\"; ma=86400,h3=\":443\"; ma=60|1|2|3", dispatcher_.timeSource(), true)
+          "h3-29=\":443\"; ma=86400,h3=\":443\"; ma=60|1|2|3|4", dispatcher_.timeSource(), true)
+          .has_value());
+  // Out of range HTTP/3 status
+  EXPECT_FALSE(
+      HttpServerPropertiesCacheImpl::originDataFromString(
+          "h3-29=\":443\"; ma=86400,h3=\":443\"; ma=60|1|2|9", dispatcher_.timeSource(), true)
+          .has_value());
+  // Non-numeric HTTP/3 status
+  EXPECT_FALSE(
+      HttpServerPropertiesCacheImpl::originDataFromString(
+          "h3-29=\":443\"; ma=86400,h3=\":443\"; ma=60|1|2|a", dispatcher_.timeSource(), true)
           .has_value());
   // Non-numeric rtt
   EXPECT_FALSE(
@@ -325,6 +339,12 @@ TEST_P(HttpServerPropertiesCacheImplTest, InvalidString) {
   EXPECT_TRUE(HttpServerPropertiesCacheImpl::originDataFromString(
                   "h3-29=\":443\"; ma=86400,h3=\":443\"; ma=60|1|2", dispatcher_.timeSource(), true)
                   .has_value());
+
+  // Standard entry with rtt, concurrency and HTTP/3 status.
+  EXPECT_TRUE(
+      HttpServerPropertiesCacheImpl::originDataFromString(
+          "h3-29=\":443\"; ma=86400,h3=\":443\"; ma=60|1|2|3", dispatcher_.timeSource(), true)
+          .has_value());
 }
 
 TEST_P(HttpServerPropertiesCacheImplTest, CacheLoad) {
@@ -368,12 +388,55 @@ TEST_P(HttpServerPropertiesCacheImplTest, ShouldNotUpdateStoreOnCacheLoad) {
   if (store_ != nullptr) {
     EXPECT_CALL(*store_, addOrUpdate(_, _, _)).Times(0);
     EXPECT_CALL(*store_, iterate(_)).WillOnce(Invoke([&](KeyValueStore::ConstIterateCb fn) {
-      fn("https://hostname1:1", "alpn1=\"hostname1:1\"; ma=5|0|0");
+      fn("https://hostname1:1", "alpn1=\"hostname1:1\"; ma=5|0|0|0");
     }));
   }
   initialize();
 }
 
+TEST_P(HttpServerPropertiesCacheImplTest, CacheLoadH3Status) {
+  // This test requires store. Do not execute it when store is not present.
+  if (store_ == nullptr)
+    return;
+  EXPECT_CALL(*store_, iterate(_)).WillOnce(Invoke([&](KeyValueStore::ConstIterateCb fn) {
+    fn("https://hostname1:1", "clear|0|0|2");
+    fn("https://hostname2:2", "clear|0|0|3");
+    fn("https://hostname3:2", "clear|0|0|1");
+  }));
+  EXPECT_CALL(*store_, addOrUpdate(_, _, _)).Times(0);
+  initialize();
+
+  // A persisted broken status is downgraded to failed recently on load.
+  EXPECT_TRUE(protocols_->getOrCreateHttp3StatusTracker(origin1_).hasHttp3FailedRecently());
+  EXPECT_TRUE(protocols_->getOrCreateHttp3StatusTracker(origin2_).isHttp3Confirmed());
+  EXPECT_TRUE(protocols_->getOrCreateHttp3StatusTracker(origin3_).hasHttp3FailedRecently());
+}
+
+TEST_P(HttpServerPropertiesCacheImplTest, Http3StatusChangeUpdatesStore) {
+  initialize();
+  EXPECT_CALL_WHEN_STORE_VALID(addOrUpdate("https://hostname1:1", "clear|0|0|2", kNoTtl));
+  protocols_->getOrCreateHttp3StatusTracker(origin1_).markHttp3Broken();
+
+  EXPECT_CALL_WHEN_STORE_VALID(addOrUpdate("https://hostname1:1", "clear|0|0|3", kNoTtl));
+  protocols_->getOrCreateHttp3StatusTracker(origin1_).markHttp3Confirmed();
+
+  // Re-confirming does not change the status and should not write to the store.
+  if (store_ != nullptr) {
+    EXPECT_CALL(*store_, addOrUpdate(_, _, _)).Times(0);
+  }
+  protocols_->getOrCreateHttp3StatusTracker(origin1_).markHttp3Confirmed();
+}
+
+TEST_P(HttpServerPropertiesCacheImplTest, ResetBrokennessUpdatesStore) {
+  initialize();
+  EXPECT_CALL_WHEN_STORE_VALID(addOrUpdate("https://hostname1:1", "clear|0|0|2", kNoTtl));
+  protocols_->getOrCreateHttp3StatusTracker(origin1_).markHttp3Broken();
+
+  EXPECT_CALL_WHEN_STORE_VALID(addOrUpdate("https://hostname1:1", "clear|0|0|1", kNoTtl));
+  protocols_->resetBrokenness();
+  EXPECT_TRUE(protocols_->getOrCreateHttp3StatusTracker(origin1_).hasHttp3FailedRecently());
+}
+
 TEST_P(HttpServerPropertiesCacheImplTest, GetOrCreateHttp3StatusTracker) {
   max_entries_ = 1u;
   initialize();
@@ -114,5 +114,39 @@ TEST_F(HappyEyeballsConnectionProviderTest, SortAddressesWithHappyEyeballsConfig
             HappyEyeballsConnectionProvider::sortAddressesWithConfig(v6_then_v4, config_no_count));
 }
 
+TEST_F(HappyEyeballsConnectionProviderTest, PrioritizeLastSuccessfulAddress) {
+  auto ip_v4_1 = std::make_shared<Address::Ipv4Instance>("127.0.0.1");
+  auto ip_v4_2 = std::make_shared<Address::Ipv4Instance>("127.0.0.2");
+
+  auto ip_v6_1 = std::make_shared<Address::Ipv6Instance>("ff02::1", 0);
+  auto ip_v6_2 = std::make_shared<Address::Ipv6Instance>("ff02::2", 0);
+
+  std::vector<Address::InstanceConstSharedPtr> interleaved = {ip_v6_1, ip_v4_1, ip_v6_2, ip_v4_2};
+
+  // No last successful address recorded, so unchanged.
+  EXPECT_EQ(interleaved,
+            HappyEyeballsConnectionProvider::prioritizeLastSuccessfulAddress(interleaved, nullptr));
+
+  // Last successful address is already at the front, so unchanged.
+  EXPECT_EQ(interleaved,
+            HappyEyeballsConnectionProvider::prioritizeLastSuccessfulAddress(interleaved, ip_v6_1));
+
+  // The last successful address moves to the front; the relative order of the
+  // other addresses is preserved.
+  std::vector<Address::InstanceConstSharedPtr> v4_2_first = {ip_v4_2, ip_v6_1, ip_v4_1, ip_v6_2};
+  EXPECT_EQ(v4_2_first,
+            HappyEyeballsConnectionProvider::prioritizeLastSuccessfulAddress(interleaved, ip_v4_2));
+
+  // Matching is by address value, not pointer identity.
+  auto ip_v4_2_copy = std::make_shared<Address::Ipv4Instance>("127.0.0.2");
+  EXPECT_EQ(v4_2_first, HappyEyeballsConnectionProvider::prioritizeLastSuccessfulAddress(
+                            interleaved, ip_v4_2_copy));
+
+  // An address which is no longer in the list leaves the list unchanged.
+  auto stale = std::make_shared<Address::Ipv4Instance>("127.0.0.9");
+  EXPECT_EQ(interleaved,
+            HappyEyeballsConnectionProvider::prioritizeLastSuccessfulAddress(interleaved, stale));
+}
+
 } // namespace Network
 } // namespace Envoy
@@ -510,6 +510,11 @@ TEST_P(TcpListenerImplTest, SetListenerRejectFractionIntermediate) {
 }
 
 TEST_P(TcpListenerImplTest, SetListenerRejectFractionAll) {
+  // With deferred accepts disabled, a fully rejecting listener falls back to closing each
+  // connection it accepts.
+  TestScopedRuntime scoped_runtime;
+  scoped_runtime.mergeValues(
+      {{"envoy.reloadable_features.tcp_listener_defer_accepts_when_rejecting_all", "false"}});
   auto socket = std::make_shared<Network::Test::TcpListenSocketImmediateListen>(
       Network::Test::getCanonicalLoopbackAddress(version_));
   MockTcpListenerCallbacks listener_callbacks;
@@ -544,6 +549,42 @@ TEST_P(TcpListenerImplTest, SetListenerRejectFractionAll) {
   dispatcher_->run(Event::Dispatcher::RunType::Block);
 }
 
+TEST_P(TcpListenerImplTest, SetListenerRejectFractionAllLeavesConnectionsInBacklog) {
+  auto socket = std::make_shared<Network::Test::TcpListenSocketImmediateListen>(
+      Network::Test::getCanonicalLoopbackAddress(version_));
+  MockTcpListenerCallbacks listener_callbacks;
+  MockConnectionCallbacks connection_callbacks;
+  Random::MockRandomGenerator random_generator;
+  NiceMock<Runtime::MockLoader> runtime;
+  Server::ThreadLocalOverloadStateOptRef overload_state;
+  TestTcpListenerImpl listener(dispatcherImpl(), random_generator, runtime, socket,
+                               listener_callbacks, true, false, false, overload_state);
+
+  listener.setRejectFraction(UnitFloat(1));
+
+  // While the listener is fully rejecting it stops reading from the listen socket, so the kernel
+  // completes the handshake but the connection is neither accepted nor reset.
+  EXPECT_CALL(connection_callbacks, onEvent(ConnectionEvent::Connected)).WillOnce([&] {
+    dispatcher_->exit();
+  });
+
+  ClientConnectionPtr client_connection = dispatcher_->createClientConnection(
+      socket->connectionInfoProvider().localAddress(), Address::InstanceConstSharedPtr(),
+      Network::Test::createRawBufferSocket(), nullptr, nullptr);
+  client_connection->addConnectionCallbacks(connection_callbacks);
+  client_connection->connect();
+  dispatcher_->run(Event::Dispatcher::RunType::Block);
+
+  // Once the reject fraction clears, the pending connection is accepted from the backlog.
+  listener.setRejectFraction(UnitFloat(0));
+  EXPECT_CALL(listener_callbacks, onAccept_(_)).WillOnce([&] { dispatcher_->exit(); });
+  EXPECT_CALL(listener_callbacks, recordConnectionsAcceptedOnSocketEvent(_));
+  dispatcher_->run(Event::Dispatcher::RunType::Block);
+
+  EXPECT_CALL(connection_callbacks, onEvent(ConnectionEvent::LocalClose));
+  client_connection->close(ConnectionCloseType::NoFlush);
+}
+
 TEST_P(TcpListenerImplTest, LoadShedPointCanRejectConnection) {
   auto socket = std::make_shared<Network::Test::TcpListenSocketImmediateListen>(
       Network::Test::getCanonicalLoopbackAddress(version_));
@@ -131,6 +131,42 @@ TEST(OrcaLoadMetricsTest, AddAllReportedMetrics) {
                      Field(&LoadMetricStats::Stat::total_metric_value, DoubleEq(11))))));
 }
 
+TEST(OrcaLoadMetricsTest, ParseLoadReportMetricNames) {
+  Envoy::Orca::LrsReportMetricNames metric_names;
+  metric_names.push_back("cpu_utilization");
+  metric_names.push_back("named_metrics.foo");
+  metric_names.push_back("utilization.*");
+  metric_names.push_back("not-a-known-metric");
+
+  const LoadReportMetricSelectors selectors = parseLoadReportMetricNames(metric_names);
+  ASSERT_EQ(selectors.size(), 4);
+  EXPECT_EQ(selectors[0].type_, LoadReportMetricSelector::Type::CpuUtilization);
+  EXPECT_EQ(selectors[0].name_, "cpu_utilization");
+  EXPECT_EQ(selectors[1].type_, LoadReportMetricSelector::Type::NamedMetric);
+  EXPECT_EQ(selectors[1].key_, "foo");
+  EXPECT_FALSE(selectors[1].wildcard_);
+  EXPECT_EQ(selectors[2].type_, LoadReportMetricSelector::Type::Utilization);
+  EXPECT_TRUE(selectors[2].wildcard_);
+  EXPECT_TRUE(selectors[2].key_.empty());
+  EXPECT_EQ(selectors[3].type_, LoadReportMetricSelector::Type::Unknown);
+}
+
+// The selector-based scan must report the same values as the name-based scan.
+TEST(OrcaLoadMetricsTest, GetMaxUtilizationFromSelectors) {
+  Envoy::Orca::LrsReportMetricNames metric_names;
+  metric_names.push_back("mem_utilization");
+  metric_names.push_back("named_metrics.nm_foo");
+  metric_names.push_back("utilization.*");
+  metric_names.push_back("not-a-known-metric");
+
+  const auto report = makeOrcaReport();
+  const LoadReportMetricSelectors selectors = parseLoadReportMetricNames(metric_names);
+  EXPECT_DOUBLE_EQ(Envoy::Orca::getMaxUtilization(selectors, report),
+                   Envoy::Orca::getMaxUtilization(metric_names, report));
+  // The max across mem_utilization (1.0), nm_foo (0.1) and the utilization map (0.6, 0.7).
+  EXPECT_DOUBLE_EQ(Envoy::Orca::getMaxUtilization(selectors, report), 1.0);
+}
+
 } // namespace
 } // namespace Orca
 } // namespace Envoy
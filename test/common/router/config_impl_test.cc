@@ -62,9 +62,10 @@ class TestConfigImpl : public ConfigImpl {
 public:
   TestConfigImpl(const envoy::config::route::v3::RouteConfiguration& config,
                  Server::Configuration::ServerFactoryContext& factory_context,
-                 bool validate_clusters_default, absl::Status& creation_status)
+                 bool validate_clusters_default, absl::Status& creation_status,
+                 const ConfigImpl* previous_config = nullptr)
       : ConfigImpl(config, factory_context, ProtobufMessage::getNullValidationVisitor(),
-                   validate_clusters_default, creation_status),
+                   validate_clusters_default, previous_config, creation_status),
         config_(config) {}
 
   void setupRouteConfig(const Http::RequestHeaderMap& headers, uint64_t random_value) const {
@@ -11542,6 +11543,177 @@ virtual_hosts:
             shared_config.ignorePathParametersInPathMatching());
 }
 
+// When a new config version is built with access to its predecessor and only some virtual hosts
+// changed, the unchanged VirtualHostImpl objects must be shared between the two snapshots and the
+// changed ones rebuilt.
+TEST_F(RouteMatcherTest, ReuseUnchangedVirtualHostsOnUpdate) {
+  const std::string yaml = R"EOF(
+virtual_hosts:
+- name: www
+  domains: ["www.lyft.com"]
+  routes:
+  - match:
+      prefix: "/"
+    route:
+      cluster: www
+- name: api
+  domains: ["api.lyft.com"]
+  routes:
+  - match:
+      prefix: "/"
+    route:
+      cluster: {}
+  )EOF";
+
+  factory_context_.cluster_manager_.initializeClusters({"www", "api", "api_v2"}, {});
+  TestConfigImpl config1(parseRouteConfigurationFromYaml(fmt::format(yaml, "api")),
+                         factory_context_, false, creation_status_);
+  TestConfigImpl config2(parseRouteConfigurationFromYaml(fmt::format(yaml, "api_v2")),
+                         factory_context_, false, creation_status_, &config1);
+
+  // The untouched vhost is structurally shared; the edited one is rebuilt.
+  EXPECT_EQ(&config1.route(genHeaders("www.lyft.com", "/", "GET"), 0)->virtualHost(),
+            &config2.route(genHeaders("www.lyft.com", "/", "GET"), 0)->virtualHost());
+  EXPECT_NE(&config1.route(genHeaders("api.lyft.com", "/", "GET"), 0)->virtualHost(),
+            &config2.route(genHeaders("api.lyft.com", "/", "GET"), 0)->virtualHost());
+  EXPECT_EQ("api_v2",
+            config2.route(genHeaders("api.lyft.com", "/", "GET"), 0)->routeEntry()->clusterName());
+
+  // A change outside the virtual hosts invalidates the shared top-level config, so nothing may be
+  // reused even for byte-identical vhosts.
+  auto changed_globally = parseRouteConfigurationFromYaml(fmt::format(yaml, "api"));
+  changed_globally.set_most_specific_header_mutations_wins(true);
+  TestConfigImpl config3(changed_globally, factory_context_, false, creation_status_, &config1);
+  EXPECT_NE(&config1.route(genHeaders("www.lyft.com", "/", "GET"), 0)->virtualHost(),
+            &config3.route(genHeaders("www.lyft.com", "/", "GET"), 0)->virtualHost());
+}
+
+TEST_F(RouteMatcherTest, ReuseUnchangedVirtualHostsDisabledByRuntimeFlag) {
+  mergeValues({{"envoy.reloadable_features.rds_reuse_unchanged_virtual_hosts", "false"}});
+
+  const std::string yaml = R"EOF(
+virtual_hosts:
+- name: www
+  domains: ["www.lyft.com"]
+  routes:
+  - match:
+      prefix: "/"
+    route:
+      cluster: www
+  )EOF";
+
+  factory_context_.cluster_manager_.initializeClusters({"www"}, {});
+  TestConfigImpl config1(parseRouteConfigurationFromYaml(yaml), factory_context_, false,
+                         creation_status_);
+  TestConfigImpl config2(parseRouteConfigurationFromYaml(yaml), factory_context_, false,
+                         creation_status_, &config1);
+  EXPECT_NE(&config1.route(genHeaders("www.lyft.com", "/", "GET"), 0)->virtualHost(),
+            &config2.route(genHeaders("www.lyft.com", "/", "GET"), 0)->virtualHost());
+}
+
+TEST_F(RouteMatcherTest, PerWorkerRouteMatchCache) {
+  const std::string yaml = R"EOF(
+per_worker_route_match_cache_entries: 2
+virtual_hosts:
+- name: www
+  domains: ["www.lyft.com"]
+  routes:
+  - match:
+      prefix: "/api"
+    route:
+      cluster: api
+  - match:
+      prefix: "/"
+    route:
+      cluster: www
+  )EOF";
+
+  factory_context_.cluster_manager_.initializeClusters({"api", "www"}, {});
+  TestConfigImpl config(parseRouteConfigurationFromYaml(yaml), factory_context_, true,
+                        creation_status_);
+
+  // Repeated lookups for the same (authority, method, path) must return the identical route
+  // object via the cache, and the query string must not fragment the key.
+  RouteConstSharedPtr first = config.route(genHeaders("www.lyft.com", "/api/users", "GET"), 0);
+  EXPECT_EQ("api", first->routeEntry()->clusterName());
+  EXPECT_EQ(first.get(),
+            config.route(genHeaders("www.lyft.com", "/api/users", "GET"), 0).get());
+  EXPECT_EQ(first.get(),
+            config.route(genHeaders("www.lyft.com", "/api/users?page=2", "GET"), 0).get());
+
+  // Different keys still resolve correctly, including after LRU eviction of the first entry.
+  EXPECT_EQ("www", config.route(genHeaders("www.lyft.com", "/foo", "GET"), 0)
+                       ->routeEntry()
+                       ->clusterName());
+  EXPECT_EQ("www", config.route(genHeaders("www.lyft.com", "/bar", "GET"), 0)
+                       ->routeEntry()
+                       ->clusterName());
+  EXPECT_EQ("api", config.route(genHeaders("www.lyft.com", "/api/users", "GET"), 0)
+                       ->routeEntry()
+                       ->clusterName());
+}
+
+// A virtual host whose routes are all case sensitive exact or prefix path matches is served
+// through the compiled path index; matching must still be first-match-wins in config order, not
+// longest-prefix-wins.
+TEST_F(RouteMatcherTest, PathOnlyRouteIndexPreservesFirstMatchWins) {
+  const std::string yaml = R"EOF(
+virtual_hosts:
+- name: www
+  domains: ["www.lyft.com"]
+  routes:
+  - match:
+      path: "/api/ping"
+    route:
+      cluster: ping
+  - match:
+      prefix: "/api"
+    route:
+      cluster: api
+  - match:
+      prefix: "/api/v1/users"
+    route:
+      cluster: users
+  - match:
+      path: "/static/logo"
+    route:
+      cluster: logo
+  - match:
+      prefix: "/static"
+    route:
+      cluster: static
+  - match:
+      prefix: "/"
+    route:
+      cluster: www
+  )EOF";
+
+  factory_context_.cluster_manager_.initializeClusters(
+      {"ping", "api", "users", "logo", "static", "www"}, {});
+  TestConfigImpl config(parseRouteConfigurationFromYaml(yaml), factory_context_, true,
+                        creation_status_);
+
+  // An exact match listed before a covering prefix wins.
+  EXPECT_EQ("ping", config.route(genHeaders("www.lyft.com", "/api/ping", "GET"), 0)
+                        ->routeEntry()
+                        ->clusterName());
+  // A shorter prefix listed earlier shadows a longer prefix listed later.
+  EXPECT_EQ("api", config.route(genHeaders("www.lyft.com", "/api/v1/users/123", "GET"), 0)
+                       ->routeEntry()
+                       ->clusterName());
+  // An exact match listed before its covering prefix wins, and the query string is ignored.
+  EXPECT_EQ("logo", config.route(genHeaders("www.lyft.com", "/static/logo?v=2", "GET"), 0)
+                        ->routeEntry()
+                        ->clusterName());
+  EXPECT_EQ("static", config.route(genHeaders("www.lyft.com", "/static/logo2", "GET"), 0)
+                          ->routeEntry()
+                          ->clusterName());
+  // The catch-all prefix still applies.
+  EXPECT_EQ("www", config.route(genHeaders("www.lyft.com", "/anything", "GET"), 0)
+                       ->routeEntry()
+                       ->clusterName());
+}
+
 } // namespace
 } // namespace Router
 } // namespace Envoy
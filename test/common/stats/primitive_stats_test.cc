@@ -0,0 +1,52 @@
+#include "envoy/stats/primitive_stats.h"
+
+#include "test/test_common/thread_factory_for_test.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Stats {
+namespace {
+
+TEST(PrimitiveShardedGaugeTest, SingleThreadAccumulation) {
+  PrimitiveShardedGauge gauge;
+  EXPECT_EQ(0, gauge.value());
+  gauge.inc();
+  gauge.add(4);
+  EXPECT_EQ(5, gauge.value());
+  gauge.dec();
+  gauge.sub(2);
+  EXPECT_EQ(2, gauge.value());
+  gauge.set(42);
+  EXPECT_EQ(42, gauge.value());
+  gauge.set(0);
+  EXPECT_EQ(0, gauge.value());
+}
+
+// The summed value must be exact once writers have finished, regardless of which cells the
+// individual threads were assigned to.
+TEST(PrimitiveShardedGaugeTest, SumsCellsAcrossThreads) {
+  PrimitiveShardedGauge gauge;
+  constexpr int NumThreads = 8;
+  constexpr int IncrementsPerThread = 1000;
+  std::vector<Thread::ThreadPtr> threads;
+  threads.reserve(NumThreads);
+  for (int i = 0; i < NumThreads; i++) {
+    threads.push_back(Thread::threadFactoryForTest().createThread([&gauge]() {
+      for (int j = 0; j < IncrementsPerThread; j++) {
+        gauge.inc();
+      }
+      for (int j = 0; j < IncrementsPerThread / 2; j++) {
+        gauge.dec();
+      }
+    }));
+  }
+  for (auto& thread : threads) {
+    thread->join();
+  }
+  EXPECT_EQ(NumThreads * IncrementsPerThread / 2, gauge.value());
+}
+
+} // namespace
+} // namespace Stats
+} // namespace Envoy
@@ -714,6 +714,46 @@ TEST_F(StatNameTest, RecentLookups) {
   EXPECT_EQ(0, num_calls);
 }
 
+TEST_F(StatNameTest, AddBulk) {
+  const std::vector<absl::string_view> names{"a.b.c", "a.b", "d", "", "a.b.c.e"};
+  const std::vector<StatName> stat_names = pool_.addBulk(names);
+  ASSERT_EQ(names.size(), stat_names.size());
+  for (size_t i = 0; i < names.size(); ++i) {
+    EXPECT_EQ(names[i], table_.toString(stat_names[i]));
+  }
+  // The batch shares tokens across its names and with previously encoded
+  // names; the ref-counts it takes are released by pool_.clear() in teardown,
+  // which asserts numSymbols() drops back to zero.
+  EXPECT_EQ(5, table_.numSymbols()); // a, b, c, d, e.
+  EXPECT_EQ(stat_names[0], makeStat("a.b.c"));
+  EXPECT_EQ(5, table_.numSymbols());
+}
+
+TEST_F(StatNameTest, EncodeExistingTokensTakesFastPath) {
+  // The first encode allocates symbols under the exclusive lock; re-encoding
+  // the same tokens is resolved by the shared-mode fast path and must produce
+  // an identical encoding without growing the table. Ref-count correctness is
+  // verified by the numSymbols() == 0 teardown assertion.
+  const StatName first = makeStat("fast.path.tokens");
+  EXPECT_EQ(3, table_.numSymbols());
+  const StatName second = makeStat("fast.path.tokens");
+  EXPECT_EQ(3, table_.numSymbols());
+  EXPECT_EQ(first, second);
+
+  // Once recent-lookup tracking is enabled, repeated encodes of existing
+  // names must be recorded rather than taking the fast path.
+  table_.setRecentLookupCapacity(10);
+  makeStat("fast.path.tokens");
+  uint64_t count = 0;
+  table_.getRecentLookups([&count](absl::string_view name, uint64_t lookup_count) {
+    if (name == "fast.path.tokens") {
+      count = lookup_count;
+    }
+  });
+  EXPECT_EQ(1, count);
+  table_.setRecentLookupCapacity(0);
+}
+
 TEST_F(StatNameTest, StatNameEmptyEquivalent) {
   StatName empty1;
   StatName empty2 = makeStat("");
@@ -454,5 +454,63 @@ TEST_F(FilterStateImplTest, SetSameDataWithDifferentLifeSpan) {
   EXPECT_EQ(2, filterState().getDataMutable<SimpleType>("test_2")->access());
 }
 
+class TypedKeyedType : public FilterState::Object {
+public:
+  static absl::string_view key() { return "test.typed_keyed_type"; }
+
+  TypedKeyedType(int value) : value_(value) {}
+
+  int access() const { return value_; }
+  void set(int value) { value_ = value; }
+
+private:
+  int value_;
+};
+
+TEST_F(FilterStateImplTest, TypedKeyRoundTrip) {
+  filterState().setData(FilterState::typedKey<TypedKeyedType>(),
+                        std::make_unique<TypedKeyedType>(1), FilterState::StateType::ReadOnly,
+                        FilterState::LifeSpan::FilterChain);
+  ASSERT_NE(nullptr, filterState().getDataReadOnly<TypedKeyedType>());
+  EXPECT_EQ(1, filterState().getDataReadOnly<TypedKeyedType>()->access());
+
+  // The typed and string-keyed paths address the same object.
+  EXPECT_EQ(filterState().getDataReadOnly<TypedKeyedType>(),
+            filterState().getDataReadOnly<TypedKeyedType>(TypedKeyedType::key()));
+}
+
+TEST_F(FilterStateImplTest, TypedKeyMutable) {
+  filterState().setData(FilterState::typedKey<TypedKeyedType>(),
+                        std::make_unique<TypedKeyedType>(1), FilterState::StateType::Mutable,
+                        FilterState::LifeSpan::FilterChain);
+  filterState().getDataMutable<TypedKeyedType>()->set(2);
+  EXPECT_EQ(2, filterState().getDataReadOnly<TypedKeyedType>()->access());
+
+  // Overwriting the mutable object refreshes the typed index.
+  filterState().setData(FilterState::typedKey<TypedKeyedType>(),
+                        std::make_unique<TypedKeyedType>(3), FilterState::StateType::Mutable,
+                        FilterState::LifeSpan::FilterChain);
+  EXPECT_EQ(3, filterState().getDataReadOnly<TypedKeyedType>()->access());
+}
+
+TEST_F(FilterStateImplTest, TypedKeyLookupRecursesIntoParent) {
+  filterState().setData(FilterState::typedKey<TypedKeyedType>(),
+                        std::make_unique<TypedKeyedType>(1), FilterState::StateType::ReadOnly,
+                        FilterState::LifeSpan::Connection);
+  ASSERT_NE(nullptr, filterState().getDataReadOnly<TypedKeyedType>());
+  EXPECT_EQ(1, filterState().getDataReadOnly<TypedKeyedType>()->access());
+}
+
+TEST_F(FilterStateImplTest, TypedKeyFallsBackToStringKeyedStorage) {
+  // Data stored before the typed key is first resolved only lives in the hashed storage; a
+  // typed lookup created afterwards must still find it.
+  filterState().setData("test.typed_key_late_registration", std::make_unique<SimpleType>(1),
+                        FilterState::StateType::ReadOnly, FilterState::LifeSpan::FilterChain);
+  const FilterState::TypedKey late_key("test.typed_key_late_registration");
+  const auto* object = filterState().getDataReadOnlyGeneric(late_key);
+  ASSERT_NE(nullptr, object);
+  EXPECT_EQ(1, dynamic_cast<const SimpleType*>(object)->access());
+}
+
 } // namespace StreamInfo
 } // namespace Envoy
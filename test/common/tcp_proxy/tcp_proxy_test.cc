@@ -50,6 +50,7 @@ namespace TcpProxy {
 namespace {
 
 using ::testing::_;
+using ::testing::AnyNumber;
 using ::testing::DoAll;
 using ::testing::Invoke;
 using ::testing::InvokeWithoutArgs;
@@ -923,23 +924,25 @@ TEST_P(TcpProxyTest, IdleTimeoutWithFilterStateOverride) {
       StreamInfo::FilterState::StateType::ReadOnly, StreamInfo::FilterState::LifeSpan::Connection);
 
   Event::MockTimer* idle_timer = new Event::MockTimer(&filter_callbacks_.connection_.dispatcher_);
+  EXPECT_CALL(*idle_timer, enabled()).Times(AnyNumber());
   EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(idle_timeout_override), _));
   raiseEventUpstreamConnected(0);
 
+  // Once armed, activity only records a timestamp; the timer is not re-armed per event.
   Buffer::OwnedImpl buffer("hello");
-  EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(idle_timeout_override), _));
   filter_->onData(buffer, false);
 
   buffer.add("hello2");
-  EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(idle_timeout_override), _));
   upstream_callbacks_->onUpstreamData(buffer, false);
 
-  EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(idle_timeout_override), _));
   filter_callbacks_.connection_.raiseBytesSentCallbacks(1);
+  upstream_connections_.at(0)->raiseBytesSentCallbacks(2);
 
+  // The first expiry observes the recorded activity and pushes the deadline out.
   EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(idle_timeout_override), _));
-  upstream_connections_.at(0)->raiseBytesSentCallbacks(2);
+  idle_timer->invokeCallback();
 
+  // The second expiry, with no intervening activity, closes the connections.
   EXPECT_CALL(*upstream_connections_.at(0), close(Network::ConnectionCloseType::NoFlush, _));
   EXPECT_CALL(filter_callbacks_.connection_, close(Network::ConnectionCloseType::NoFlush, _));
   EXPECT_CALL(*idle_timer, disableTimer());
@@ -954,23 +957,25 @@ TEST_P(TcpProxyTest, IdleTimeout) {
   setup(1, config);
 
   Event::MockTimer* idle_timer = new Event::MockTimer(&filter_callbacks_.connection_.dispatcher_);
+  EXPECT_CALL(*idle_timer, enabled()).Times(AnyNumber());
   EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(1000), _));
   raiseEventUpstreamConnected(0);
 
+  // Once armed, activity only records a timestamp; the timer is not re-armed per event.
   Buffer::OwnedImpl buffer("hello");
-  EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(1000), _));
   filter_->onData(buffer, false);
 
   buffer.add("hello2");
-  EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(1000), _));
   upstream_callbacks_->onUpstreamData(buffer, false);
 
-  EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(1000), _));
   filter_callbacks_.connection_.raiseBytesSentCallbacks(1);
+  upstream_connections_.at(0)->raiseBytesSentCallbacks(2);
 
+  // The first expiry observes the recorded activity and pushes the deadline out.
   EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(1000), _));
-  upstream_connections_.at(0)->raiseBytesSentCallbacks(2);
+  idle_timer->invokeCallback();
 
+  // The second expiry, with no intervening activity, closes the connections.
   EXPECT_CALL(*upstream_connections_.at(0), close(Network::ConnectionCloseType::NoFlush, _));
   EXPECT_CALL(filter_callbacks_.connection_, close(Network::ConnectionCloseType::NoFlush, _));
   EXPECT_CALL(*idle_timer, disableTimer());
@@ -984,6 +989,7 @@ TEST_P(TcpProxyTest, IdleTimerDisabledDownstreamClose) {
   setup(1, config);
 
   Event::MockTimer* idle_timer = new Event::MockTimer(&filter_callbacks_.connection_.dispatcher_);
+  EXPECT_CALL(*idle_timer, enabled()).Times(AnyNumber());
   EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(1000), _));
   raiseEventUpstreamConnected(0);
 
@@ -998,6 +1004,7 @@ TEST_P(TcpProxyTest, IdleTimerDisabledUpstreamClose) {
   setup(1, config);
 
   Event::MockTimer* idle_timer = new Event::MockTimer(&filter_callbacks_.connection_.dispatcher_);
+  EXPECT_CALL(*idle_timer, enabled()).Times(AnyNumber());
   EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(1000), _));
   raiseEventUpstreamConnected(0);
 
@@ -1012,22 +1019,23 @@ TEST_P(TcpProxyTest, IdleTimeoutWithOutstandingDataFlushed) {
   setup(1, config);
 
   Event::MockTimer* idle_timer = new Event::MockTimer(&filter_callbacks_.connection_.dispatcher_);
+  EXPECT_CALL(*idle_timer, enabled()).Times(AnyNumber());
   EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(1000), _));
   raiseEventUpstreamConnected(0);
 
+  // Once armed, activity only records a timestamp; the timer is not re-armed per event.
   Buffer::OwnedImpl buffer("hello");
-  EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(1000), _));
   filter_->onData(buffer, false);
 
   buffer.add("hello2");
-  EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(1000), _));
   upstream_callbacks_->onUpstreamData(buffer, false);
 
-  EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(1000), _));
   filter_callbacks_.connection_.raiseBytesSentCallbacks(1);
+  upstream_connections_.at(0)->raiseBytesSentCallbacks(2);
 
+  // The first expiry observes the recorded activity and pushes the deadline out.
   EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(1000), _));
-  upstream_connections_.at(0)->raiseBytesSentCallbacks(2);
+  idle_timer->invokeCallback();
 
   // Mark the upstream connection as blocked.
   // This should read-disable the downstream connection.
@@ -1291,6 +1299,8 @@ TEST_P(TcpProxyTest, UpstreamFlushTimeoutConfigured) {
       .WillOnce(Return()); // Cancel default action of raising LocalClose
   EXPECT_CALL(*upstream_connections_.at(0), state())
       .WillOnce(Return(Network::Connection::State::Closing));
+  // The timer is handed to the drainer with a fresh full idle timeout.
+  EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(1000), _));
   filter_callbacks_.connection_.raiseEvent(Network::ConnectionEvent::RemoteClose);
 
   filter_.reset();
@@ -1322,6 +1332,8 @@ TEST_P(TcpProxyTest, UpstreamFlushTimeoutExpired) {
       .WillOnce(Return()); // Cancel default action of raising LocalClose
   EXPECT_CALL(*upstream_connections_.at(0), state())
       .WillOnce(Return(Network::Connection::State::Closing));
+  // The timer is handed to the drainer with a fresh full idle timeout.
+  EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(1000), _));
   filter_callbacks_.connection_.raiseEvent(Network::ConnectionEvent::RemoteClose);
 
   filter_.reset();
@@ -192,6 +192,50 @@ TEST_F(SslContextImplTest, TestPreferClientCiphers) {
   EXPECT_FALSE(SSL_CTX_get_options(ssl_ctx) & SSL_OP_CIPHER_SERVER_PREFERENCE);
 }
 
+// Identical server configurations share one compiled context, while differing server names get
+// their own. A shared context stays tracked until every owner has removed it.
+TEST_F(SslContextImplTest, ServerContextSharedForIdenticalConfig) {
+  const std::string yaml = R"EOF(
+  common_tls_context:
+    tls_certificates:
+      certificate_chain:
+        filename: "{{ test_rundir }}/test/common/tls/test_data/unittest_cert.pem"
+      private_key:
+        filename: "{{ test_rundir }}/test/common/tls/test_data/unittest_key.pem"
+  )EOF";
+
+  envoy::extensions::transport_sockets::tls::v3::DownstreamTlsContext tls_context;
+  TestUtility::loadFromYaml(TestEnvironment::substitute(yaml), tls_context);
+  auto cfg1 = ServerContextConfigImpl::create(tls_context, factory_context_, false).value();
+  auto cfg2 = ServerContextConfigImpl::create(tls_context, factory_context_, false).value();
+  EXPECT_EQ(cfg1->contentHash(), cfg2->contentHash());
+
+  Envoy::Ssl::ServerContextSharedPtr ctx1 =
+      manager_.createSslServerContext(*store_.rootScope(), *cfg1, {}, nullptr).value();
+  Envoy::Ssl::ServerContextSharedPtr ctx2 =
+      manager_.createSslServerContext(*store_.rootScope(), *cfg2, {}, nullptr).value();
+  EXPECT_EQ(ctx1, ctx2);
+
+  // A context built for different server names is not shared.
+  Envoy::Ssl::ServerContextSharedPtr ctx3 =
+      manager_.createSslServerContext(*store_.rootScope(), *cfg1, {"example.com"}, nullptr).value();
+  EXPECT_NE(ctx1, ctx3);
+
+  auto countContexts = [this]() {
+    uint32_t count = 0;
+    manager_.iterateContexts([&count](const Envoy::Ssl::Context&) { ++count; });
+    return count;
+  };
+  // The shared context remains tracked until both owners have removed it.
+  EXPECT_EQ(2, countContexts());
+  manager_.removeContext(ctx1);
+  EXPECT_EQ(2, countContexts());
+  manager_.removeContext(ctx2);
+  EXPECT_EQ(1, countContexts());
+  manager_.removeContext(ctx3);
+  EXPECT_EQ(0, countContexts());
+}
+
 TEST_F(SslContextImplTest, TestExpiringCert) {
   const std::string yaml = R"EOF(
   common_tls_context:
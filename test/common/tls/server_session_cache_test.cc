@@ -0,0 +1,87 @@
+#include <ctime>
+
+#include "source/common/tls/server_session_cache.h"
+
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+#include "openssl/ssl.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace TransportSockets {
+namespace Tls {
+namespace {
+
+class ServerSessionCacheTest : public testing::Test {
+public:
+  ServerSessionCacheTest() : ssl_ctx_(SSL_CTX_new(TLS_method())) {}
+
+  bssl::UniquePtr<SSL_SESSION> makeSession(uint32_t timeout = 300) {
+    bssl::UniquePtr<SSL_SESSION> session(SSL_SESSION_new(ssl_ctx_.get()));
+    SSL_SESSION_set_time(session.get(), time(nullptr));
+    SSL_SESSION_set_timeout(session.get(), timeout);
+    return session;
+  }
+
+  bssl::UniquePtr<SSL_CTX> ssl_ctx_;
+  ServerSessionCache cache_;
+};
+
+TEST_F(ServerSessionCacheTest, StoreAndFind) {
+  bssl::UniquePtr<SSL_SESSION> session = makeSession();
+  SSL_SESSION* raw = session.get();
+  cache_.store("key1", std::move(session));
+  EXPECT_EQ(1, cache_.sessionCount());
+
+  bssl::UniquePtr<SSL_SESSION> found = cache_.find("key1");
+  EXPECT_EQ(raw, found.get());
+  EXPECT_EQ(nullptr, cache_.find("key2"));
+
+  // The entry stays in the cache so other workers can resume with the same ID.
+  EXPECT_NE(nullptr, cache_.find("key1"));
+}
+
+TEST_F(ServerSessionCacheTest, StoreReplacesExistingEntry) {
+  cache_.store("key1", makeSession());
+  bssl::UniquePtr<SSL_SESSION> replacement = makeSession();
+  SSL_SESSION* raw = replacement.get();
+  cache_.store("key1", std::move(replacement));
+  EXPECT_EQ(1, cache_.sessionCount());
+  EXPECT_EQ(raw, cache_.find("key1").get());
+}
+
+TEST_F(ServerSessionCacheTest, Remove) {
+  cache_.store("key1", makeSession());
+  cache_.remove("key1");
+  EXPECT_EQ(0, cache_.sessionCount());
+  EXPECT_EQ(nullptr, cache_.find("key1"));
+}
+
+TEST_F(ServerSessionCacheTest, ExpiredSessionIsDropped) {
+  bssl::UniquePtr<SSL_SESSION> session = makeSession();
+  // Stamp the session well past its timeout.
+  SSL_SESSION_set_time(session.get(), time(nullptr) - 600);
+  SSL_SESSION_set_timeout(session.get(), 300);
+  cache_.store("key1", std::move(session));
+  EXPECT_EQ(1, cache_.sessionCount());
+
+  EXPECT_EQ(nullptr, cache_.find("key1"));
+  EXPECT_EQ(0, cache_.sessionCount());
+}
+
+TEST_F(ServerSessionCacheTest, EvictsOldestEntriesWhenFull) {
+  // Fill the cache to its full capacity and then add one more session to each shard's worth of
+  // keys. The cache must stay bounded and the most recently stored entries must be retained.
+  const size_t capacity = ServerSessionCache::ShardCount * ServerSessionCache::MaxSessionsPerShard;
+  for (size_t i = 0; i < capacity + ServerSessionCache::ShardCount; i++) {
+    cache_.store(absl::StrCat("key", i), makeSession());
+  }
+  EXPECT_LE(cache_.sessionCount(), capacity);
+  EXPECT_NE(nullptr, cache_.find(absl::StrCat("key", capacity)));
+}
+
+} // namespace
+} // namespace Tls
+} // namespace TransportSockets
+} // namespace Extensions
+} // namespace Envoy
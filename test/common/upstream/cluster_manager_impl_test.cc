@@ -984,6 +984,64 @@ TEST_F(ClusterManagerImplTest, DuplicateCluster) {
   EXPECT_THROW(create(config), EnvoyException);
 }
 
+// Validate that a cluster with lazy_init set is not created at startup and is created and
+// warmed on first use.
+TEST_F(ClusterManagerImplTest, LazyInitCluster) {
+  const std::string yaml = R"EOF(
+static_resources:
+  clusters:
+  - name: eager_cluster
+    connect_timeout: 0.250s
+    type: static
+    lb_policy: round_robin
+    load_assignment:
+      cluster_name: eager_cluster
+      endpoints:
+      - lb_endpoints:
+        - endpoint:
+            address:
+              socket_address:
+                address: 127.0.0.1
+                port_value: 11001
+  - name: lazy_cluster
+    connect_timeout: 0.250s
+    type: static
+    lazy_init: true
+    lb_policy: round_robin
+    load_assignment:
+      cluster_name: lazy_cluster
+      endpoints:
+      - lb_endpoints:
+        - endpoint:
+            address:
+              socket_address:
+                address: 127.0.0.1
+                port_value: 11002
+  )EOF";
+
+  create(parseBootstrapFromV3Yaml(yaml));
+
+  // Only the eager cluster is created at startup; the lazy cluster is retained as config.
+  checkStats(1 /*added*/, 0 /*modified*/, 0 /*removed*/, 1 /*active*/, 0 /*warming*/);
+  EXPECT_EQ(1UL, factory_.stats_
+                     .gauge("cluster_manager.lazy_clusters", Stats::Gauge::ImportMode::NeverImport)
+                     .value());
+  EXPECT_EQ(nullptr, cluster_manager_->getThreadLocalCluster("lazy_cluster"));
+
+  // First use creates the cluster; a static cluster warms immediately.
+  EXPECT_TRUE(cluster_manager_->maybeInitializeLazyCluster("lazy_cluster"));
+  EXPECT_NE(nullptr, cluster_manager_->getThreadLocalCluster("lazy_cluster"));
+  checkStats(2 /*added*/, 0 /*modified*/, 0 /*removed*/, 2 /*active*/, 0 /*warming*/);
+  EXPECT_EQ(0UL, factory_.stats_
+                     .gauge("cluster_manager.lazy_clusters", Stats::Gauge::ImportMode::NeverImport)
+                     .value());
+
+  // Subsequent requests find nothing left to initialize.
+  EXPECT_FALSE(cluster_manager_->maybeInitializeLazyCluster("lazy_cluster"));
+
+  factory_.tls_.shutdownThread();
+}
+
 TEST_F(ClusterManagerImplTest, ValidClusterName) {
   const std::string yaml = R"EOF(
 static_resources:
@@ -2319,6 +2377,27 @@ TEST_P(ClusterManagerLifecycleTest, DynamicAddRemove) {
 }
 
 // Validates that a callback can remove itself from the callbacks list.
+// Repeated thread local cluster lookups hit a per-thread memo of the last
+// successful lookup; verify it returns the same entry and is invalidated when
+// the cluster is removed.
+TEST_P(ClusterManagerLifecycleTest, ThreadLocalClusterLookupMemo) {
+  create(defaultConfig());
+
+  std::shared_ptr<MockClusterMockPrioritySet> cluster1(new NiceMock<MockClusterMockPrioritySet>());
+  EXPECT_CALL(factory_, clusterFromProto_(_, _, _, _))
+      .WillOnce(Return(std::make_pair(cluster1, nullptr)));
+  EXPECT_CALL(*cluster1, initialize(_));
+  EXPECT_TRUE(cluster_manager_->addOrUpdateCluster(defaultStaticCluster("fake_cluster"), ""));
+  cluster1->initialize_callback_();
+
+  ThreadLocalCluster* entry = cluster_manager_->getThreadLocalCluster("fake_cluster");
+  ASSERT_NE(nullptr, entry);
+  EXPECT_EQ(entry, cluster_manager_->getThreadLocalCluster("fake_cluster"));
+
+  EXPECT_TRUE(cluster_manager_->removeCluster("fake_cluster"));
+  EXPECT_EQ(nullptr, cluster_manager_->getThreadLocalCluster("fake_cluster"));
+}
+
 TEST_P(ClusterManagerLifecycleTest, ClusterAddOrUpdateCallbackRemovalDuringIteration) {
   create(defaultConfig());
 
@@ -4281,6 +4360,76 @@ TEST_P(ClusterManagerLifecycleTest, MergedUpdates) {
   EXPECT_EQ(1, factory_.stats_.counter("cluster_manager.update_merge_cancelled").value());
 }
 
+// Tests that a batched update spanning multiple priorities is delivered to workers as a single
+// cross-thread update covering all the priorities it touched.
+TEST_P(ClusterManagerLifecycleTest, BatchedMultiPriorityUpdatePostedOnce) {
+  // Ensure we see the right set of added/removed hosts on every call.
+  EXPECT_CALL(local_cluster_update_, post(_, _, _))
+      .WillOnce(Invoke([](uint32_t priority, const HostVector& hosts_added,
+                          const HostVector& hosts_removed) -> void {
+        // Initial add of the 2 static localhost endpoints.
+        EXPECT_EQ(0, priority);
+        EXPECT_EQ(2, hosts_added.size());
+        EXPECT_EQ(0, hosts_removed.size());
+      }))
+      .WillOnce(Invoke([](uint32_t priority, const HostVector& hosts_added,
+                          const HostVector& hosts_removed) -> void {
+        // P0 half of the batched update.
+        EXPECT_EQ(0, priority);
+        EXPECT_EQ(0, hosts_added.size());
+        EXPECT_EQ(1, hosts_removed.size());
+      }))
+      .WillOnce(Invoke([](uint32_t priority, const HostVector& hosts_added,
+                          const HostVector& hosts_removed) -> void {
+        // P1 half of the batched update.
+        EXPECT_EQ(1, priority);
+        EXPECT_EQ(1, hosts_added.size());
+        EXPECT_EQ(0, hosts_removed.size());
+      }));
+
+  createWithLocalClusterUpdate();
+
+  Cluster& cluster = cluster_manager_->activeClusters().begin()->second;
+  HostVectorSharedPtr hosts(
+      new HostVector(cluster.prioritySet().hostSetsPerPriority()[0]->hosts()));
+  HostsPerLocalitySharedPtr hosts_per_locality = std::make_shared<HostsPerLocalityImpl>();
+
+  // Move the second host from P0 to P1 in one batch.
+  struct MoveHostBatchUpdateCb : public PrioritySet::BatchUpdateCb {
+    MoveHostBatchUpdateCb(HostVectorSharedPtr hosts, HostsPerLocalitySharedPtr hosts_per_locality)
+        : hosts_(hosts), hosts_per_locality_(hosts_per_locality) {}
+
+    void batchUpdate(PrioritySet::HostUpdateCb& host_update_cb) override {
+      HostVectorSharedPtr p0_hosts = std::make_shared<HostVector>(HostVector{hosts_->front()});
+      host_update_cb.updateHosts(
+          0,
+          updateHostsParams(p0_hosts, hosts_per_locality_,
+                            std::make_shared<const HealthyHostVector>(*p0_hosts),
+                            hosts_per_locality_),
+          {}, {}, {hosts_->back()}, 123, absl::nullopt, absl::nullopt);
+
+      HostVectorSharedPtr p1_hosts = std::make_shared<HostVector>(HostVector{hosts_->back()});
+      host_update_cb.updateHosts(
+          1,
+          updateHostsParams(p1_hosts, hosts_per_locality_,
+                            std::make_shared<const HealthyHostVector>(*p1_hosts),
+                            hosts_per_locality_),
+          {}, {hosts_->back()}, {}, 123, absl::nullopt, absl::nullopt);
+    }
+
+    HostVectorSharedPtr hosts_;
+    HostsPerLocalitySharedPtr hosts_per_locality_;
+  };
+
+  MoveHostBatchUpdateCb batch_update(hosts, hosts_per_locality);
+  cluster.prioritySet().batchHostUpdate(batch_update);
+
+  // Both per-priority updates rode a single cross-thread post, so the cluster was only
+  // updated once.
+  EXPECT_EQ(1, factory_.stats_.counter("cluster_manager.cluster_updated").value());
+  EXPECT_EQ(0, factory_.stats_.counter("cluster_manager.cluster_updated_via_merge").value());
+}
+
 // Tests that mergeable updates outside of a window get applied immediately.
 TEST_P(ClusterManagerLifecycleTest, MergedUpdatesOutOfWindow) {
   // Ensure we see the right set of added/removed hosts on every call.
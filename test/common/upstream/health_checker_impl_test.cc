@@ -4337,6 +4337,63 @@ TEST_F(TcpHealthCheckerImplTest, Success) {
   read_filter_->onData(response, false);
 }
 
+// When health_check.shared_probes is enabled, a second cluster with an identical health check
+// config and the same host address consumes the first cluster's probe result instead of opening
+// its own probe connection.
+TEST_F(TcpHealthCheckerImplTest, SharedProbeResultConsumedAcrossClusters) {
+  InSequence s;
+
+  ON_CALL(runtime_.snapshot_, getBoolean("health_check.shared_probes", false))
+      .WillByDefault(Return(true));
+
+  setupData();
+  cluster_->prioritySet().getMockHostSet(0)->hosts_ = {
+      makeTestHost(cluster_->info_, "tcp://127.0.0.1:80", simTime())};
+  expectSessionCreate();
+  expectClientCreate();
+  EXPECT_CALL(*connection_, write(_, _));
+  EXPECT_CALL(*timeout_timer_, enableTimer(_, _));
+  health_checker_->start();
+
+  connection_->raiseEvent(Network::ConnectionEvent::Connected);
+
+  EXPECT_CALL(*timeout_timer_, disableTimer());
+  EXPECT_CALL(*interval_timer_, enableTimer(_, _));
+  Buffer::OwnedImpl response;
+  addUint8(response, 2);
+  read_filter_->onData(response, false);
+
+  // A second, identically configured checker over the same host address. No client connection is
+  // expected: the session applies the shared result and re-arms its interval timer directly.
+  auto second_cluster = std::make_shared<NiceMock<MockClusterMockPrioritySet>>();
+  std::shared_ptr<TcpHealthCheckerImpl> second_checker = std::make_shared<TcpHealthCheckerImpl>(
+      *second_cluster, parseHealthCheckFromV3Yaml(R"EOF(
+    timeout: 1s
+    interval: 1s
+    unhealthy_threshold: 2
+    healthy_threshold: 2
+    tcp_health_check:
+      send:
+        text: "01"
+      receive:
+      - text: "02"
+    )EOF"),
+      dispatcher_, runtime_, random_, HealthCheckEventLoggerPtr());
+  second_cluster->prioritySet().getMockHostSet(0)->hosts_ = {
+      makeTestHost(second_cluster->info_, "tcp://127.0.0.1:80", simTime())};
+  Event::MockTimer* second_interval_timer = new Event::MockTimer(&dispatcher_);
+  Event::MockTimer* second_timeout_timer = new Event::MockTimer(&dispatcher_);
+  EXPECT_CALL(*second_timeout_timer, disableTimer());
+  EXPECT_CALL(*second_interval_timer, enableTimer(_, _));
+  second_checker->start();
+
+  EXPECT_EQ(1UL,
+            second_cluster->info_->stats_store_.counter("health_check.shared_result").value());
+  EXPECT_EQ(0UL, second_cluster->info_->stats_store_.counter("health_check.attempt").value());
+  EXPECT_EQ(Host::Health::Healthy,
+            second_cluster->prioritySet().getMockHostSet(0)->hosts_[0]->coarseHealth());
+}
+
 // Tests that a successful healthcheck will disconnect the client when reuse_connection is false.
 TEST_F(TcpHealthCheckerImplTest, DataWithoutReusingConnection) {
   InSequence s;
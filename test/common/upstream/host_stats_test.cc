@@ -21,8 +21,7 @@ TEST(HostStatsTest, CountersSortedByName) {
 // Verify that gauges are sorted by name.
 TEST(HostStatsTest, GaugesSortedByName) {
   HostStats host_stats;
-  std::vector<std::pair<absl::string_view, Stats::PrimitiveGaugeReference>> gauges =
-      host_stats.gauges();
+  std::vector<std::pair<absl::string_view, uint64_t>> gauges = host_stats.gauges();
   EXPECT_FALSE(gauges.empty());
 
   for (size_t i = 1; i < gauges.size(); ++i) {
@@ -201,6 +201,10 @@ public:
     ClusterManagerImpl::notifyExpiredDiscovery(name);
   }
 
+  bool maybeInitializeLazyCluster(const std::string& name) {
+    return ClusterManagerImpl::maybeInitializeLazyCluster(name);
+  }
+
   ClusterDiscoveryManager createAndSwapClusterDiscoveryManager(std::string thread_name) {
     return ClusterManagerImpl::createAndSwapClusterDiscoveryManager(std::move(thread_name));
   }
@@ -106,6 +106,18 @@ private:
     mockAddEntry(MOCK_TCP_LOG_FIELD_NAME);
   }
 
+  ProtobufWkt::Struct* addInPlaceHttpEntry() override {
+    mockAddEntry(MOCK_HTTP_LOG_FIELD_NAME);
+    in_place_http_entry_.Clear();
+    return &in_place_http_entry_;
+  }
+
+  ProtobufWkt::Empty* addInPlaceTcpEntry() override {
+    mockAddEntry(MOCK_TCP_LOG_FIELD_NAME);
+    in_place_tcp_entry_.Clear();
+    return &in_place_tcp_entry_;
+  }
+
   bool isEmpty() override { return message_.fields().empty(); }
 
   void initMessage() override { ++num_inits_; }
@@ -117,6 +129,8 @@ private:
 
   int num_inits_ = 0;
   int num_clears_ = 0;
+  ProtobufWkt::Struct in_place_http_entry_;
+  ProtobufWkt::Empty in_place_tcp_entry_;
 };
 
 class StreamingGrpcAccessLogTest : public testing::Test {
@@ -219,6 +233,61 @@ TEST_F(StreamingGrpcAccessLogTest, BasicFlow) {
             TestUtility::findCounter(stats_store_, "mock_access_log_prefix.logs_written")->value());
 }
 
+TEST_F(StreamingGrpcAccessLogTest, InPlaceEntryFlow) {
+  initLogger(FlushInterval, 0);
+
+  // Start a stream for the first log.
+  MockAccessLogStream stream;
+  AccessLogCallbacks* callbacks;
+  expectStreamStart(stream, &callbacks);
+  // Build an HTTP entry in place and commit it.
+  expectFlushedLogEntriesCount(stream, MOCK_HTTP_LOG_FIELD_NAME, 1);
+  ProtobufWkt::Struct* http_entry = logger_->startHttpLogEntry();
+  ASSERT_NE(nullptr, http_entry);
+  http_entry->mutable_fields()->insert({"test-key", ProtobufWkt::Value()});
+  logger_->finishHttpLogEntry();
+  EXPECT_EQ(1, logger_->numInits());
+  EXPECT_EQ(1, logger_->numClears());
+  EXPECT_EQ(1,
+            TestUtility::findCounter(stats_store_, "mock_access_log_prefix.logs_written")->value());
+
+  // Build a TCP entry in place and commit it.
+  expectFlushedLogEntriesCount(stream, MOCK_TCP_LOG_FIELD_NAME, 1);
+  ASSERT_NE(nullptr, logger_->startTcpLogEntry());
+  logger_->finishTcpLogEntry();
+  EXPECT_EQ(2, logger_->numClears());
+  // TCP logging doesn't change the logs_written counter.
+  EXPECT_EQ(1,
+            TestUtility::findCounter(stats_store_, "mock_access_log_prefix.logs_written")->value());
+}
+
+TEST_F(StreamingGrpcAccessLogTest, InPlaceEntryDropped) {
+  InSequence s;
+  initLogger(FlushInterval, 1);
+
+  // Start a stream for the first log.
+  MockAccessLogStream stream;
+  AccessLogCallbacks* callbacks;
+  expectStreamStart(stream, &callbacks);
+
+  // Fail to flush, so the log stays buffered up.
+  EXPECT_CALL(stream, isAboveWriteBufferHighWatermark()).WillOnce(Return(true));
+  EXPECT_CALL(stream, sendMessageRaw_(_, false)).Times(0);
+  ProtobufWkt::Struct* http_entry = logger_->startHttpLogEntry();
+  ASSERT_NE(nullptr, http_entry);
+  http_entry->mutable_fields()->insert({"test-key", ProtobufWkt::Value()});
+  logger_->finishHttpLogEntry();
+  EXPECT_EQ(1,
+            TestUtility::findCounter(stats_store_, "mock_access_log_prefix.logs_written")->value());
+
+  // The buffer is full, so the next entry can't even be started.
+  EXPECT_CALL(stream, isAboveWriteBufferHighWatermark()).WillOnce(Return(true));
+  EXPECT_CALL(stream, sendMessageRaw_(_, false)).Times(0);
+  EXPECT_EQ(nullptr, logger_->startHttpLogEntry());
+  EXPECT_EQ(1,
+            TestUtility::findCounter(stats_store_, "mock_access_log_prefix.logs_dropped")->value());
+}
+
 TEST_F(StreamingGrpcAccessLogTest, WatermarksOverrun) {
   InSequence s;
   initLogger(FlushInterval, 1);
@@ -40,6 +40,23 @@ public:
   // GrpcAccessLogger
   MOCK_METHOD(void, log, (HTTPAccessLogEntry && entry));
   MOCK_METHOD(void, log, (envoy::data::accesslog::v3::TCPAccessLogEntry && entry));
+
+  // Bridge the in-place entry API to the mocked log() methods so that tests can keep asserting on
+  // the logged entries.
+  HTTPAccessLogEntry* startHttpLogEntry() override { return &http_entry_; }
+  void finishHttpLogEntry() override {
+    log(std::move(http_entry_));
+    http_entry_.Clear();
+  }
+  envoy::data::accesslog::v3::TCPAccessLogEntry* startTcpLogEntry() override { return &tcp_entry_; }
+  void finishTcpLogEntry() override {
+    log(std::move(tcp_entry_));
+    tcp_entry_.Clear();
+  }
+
+private:
+  HTTPAccessLogEntry http_entry_;
+  envoy::data::accesslog::v3::TCPAccessLogEntry tcp_entry_;
 };
 
 class MockGrpcAccessLoggerCache : public GrpcCommon::GrpcAccessLoggerCache {
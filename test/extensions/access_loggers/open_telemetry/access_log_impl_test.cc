@@ -54,6 +54,23 @@ public:
   // GrpcAccessLogger
   MOCK_METHOD(void, log, (LogRecord && entry));
   MOCK_METHOD(void, log, (ProtobufWkt::Empty && entry));
+
+  // Bridge the in-place entry API to the mocked log() methods so that tests can keep asserting on
+  // the logged entries.
+  LogRecord* startHttpLogEntry() override { return &log_record_; }
+  void finishHttpLogEntry() override {
+    log(std::move(log_record_));
+    log_record_.Clear();
+  }
+  ProtobufWkt::Empty* startTcpLogEntry() override { return &empty_entry_; }
+  void finishTcpLogEntry() override {
+    log(std::move(empty_entry_));
+    empty_entry_.Clear();
+  }
+
+private:
+  LogRecord log_record_;
+  ProtobufWkt::Empty empty_entry_;
 };
 
 class MockGrpcAccessLoggerCache : public GrpcAccessLoggerCache {
@@ -255,7 +255,8 @@ TEST_F(OriginalDstClusterTest, AddressCollision) {
   auto lb1 = OriginalDstCluster::LoadBalancer(handle_);
   auto lb2 = OriginalDstCluster::LoadBalancer(handle_);
 
-  // Simulate concurrent request for the same address from two workers.
+  // Simulate concurrent request for the same address from two workers. Only the first queued
+  // host triggers a post; the second host is picked up by the same drain callback.
   Event::PostCb post_cb1;
   EXPECT_CALL(server_context_.dispatcher_, post(_)).WillOnce([&post_cb1](Event::PostCb cb) {
     post_cb1 = std::move(cb);
@@ -263,21 +264,13 @@ TEST_F(OriginalDstClusterTest, AddressCollision) {
   HostConstSharedPtr host1 = lb1.chooseHost(&lb_context);
   ASSERT_NE(host1, nullptr);
   EXPECT_EQ(*connection.connectionInfoProvider().localAddress(), *host1->address());
-  Event::PostCb post_cb2;
-  EXPECT_CALL(server_context_.dispatcher_, post(_)).WillOnce([&post_cb2](Event::PostCb cb) {
-    post_cb2 = std::move(cb);
-  });
   HostConstSharedPtr host2 = lb2.chooseHost(&lb_context);
   ASSERT_NE(host2, nullptr);
   EXPECT_EQ(*connection.connectionInfoProvider().localAddress(), *host2->address());
 
-  // Process main callbacks sequentially.
+  // Both pending hosts are added by a single main thread callback.
   EXPECT_CALL(membership_updated_, ready());
   post_cb1();
-  EXPECT_EQ(1UL, cluster_->prioritySet().hostSetsPerPriority()[0]->hosts().size());
-  EXPECT_EQ(1UL, cluster_->prioritySet().hostSetsPerPriority()[0]->healthyHosts().size());
-  EXPECT_CALL(membership_updated_, ready());
-  post_cb2();
   EXPECT_EQ(2UL, cluster_->prioritySet().hostSetsPerPriority()[0]->hosts().size());
   EXPECT_EQ(2UL, cluster_->prioritySet().hostSetsPerPriority()[0]->healthyHosts().size());
 
@@ -383,16 +376,12 @@ TEST_F(OriginalDstClusterTest, CollisionHostInUse) {
     post_cb1 = std::move(cb);
   });
   HostConstSharedPtr host1 = OriginalDstCluster::LoadBalancer(handle_).chooseHost(&lb_context);
-  Event::PostCb post_cb2;
-  EXPECT_CALL(server_context_.dispatcher_, post(_)).WillOnce([&post_cb2](Event::PostCb cb) {
-    post_cb2 = std::move(cb);
-  });
+  // The second host for the same address does not trigger another post; both hosts are drained
+  // by the first callback.
   HostConstSharedPtr host2 = OriginalDstCluster::LoadBalancer(handle_).chooseHost(&lb_context);
 
   EXPECT_CALL(membership_updated_, ready());
   post_cb1();
-  EXPECT_CALL(membership_updated_, ready());
-  post_cb2();
 
   // Borrow a collision host2 handle.
   auto handle = host2->acquireHandle();
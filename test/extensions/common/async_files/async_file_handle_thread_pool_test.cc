@@ -344,12 +344,21 @@ MATCHER_P(IsMemoryMatching, str, "") {
   return ExplainMatchResult(expected, target, result_listener);
 }
 
+MATCHER_P(IsIovecMatching, str, "") {
+  absl::string_view expected{str};
+  *result_listener << "is iovec matching " << expected;
+  const iovec* iov = arg;
+  absl::string_view target{static_cast<const char*>(iov->iov_base), expected.size()};
+  return iov->iov_len == expected.size() &&
+         ExplainMatchResult(expected, target, result_listener);
+}
+
 TEST_F(AsyncFileHandleWithMockPosixTest, PartialWriteRetries) {
   auto handle = createAnonymousFile();
   Buffer::OwnedImpl write_value{"hello"};
-  EXPECT_CALL(mock_posix_file_operations_, pwrite(_, IsMemoryMatching("hello"), 5, 0))
+  EXPECT_CALL(mock_posix_file_operations_, pwritev(_, IsIovecMatching("hello"), 1, 0))
       .WillOnce(Return(Api::SysCallSizeResult{3, 0}));
-  EXPECT_CALL(mock_posix_file_operations_, pwrite(_, IsMemoryMatching("lo"), 2, 3))
+  EXPECT_CALL(mock_posix_file_operations_, pwritev(_, IsIovecMatching("lo"), 1, 3))
       .WillOnce(Return(Api::SysCallSizeResult{2, 0}));
   absl::StatusOr<size_t> write_status;
   EXPECT_OK(handle->write(dispatcher_.get(), write_value, 0, [&](absl::StatusOr<size_t> status) {
@@ -1897,6 +1897,57 @@ TEST_F(DnsCacheImplTest, CacheLoad) {
   }
 }
 
+// An entry loaded from the key value store that is already past its TTL is still served, but is
+// scheduled for an early background refresh instead of waiting out another full TTL.
+TEST_F(DnsCacheImplTest, CacheLoadStaleEntryRefreshesEarly) {
+  auto* time_source = new NiceMock<MockTimeSystem>();
+  context_.server_factory_context_.dispatcher_.time_system_.reset(time_source);
+  // The entry below was resolved at epoch 0 with a 40s TTL; the current time is well past that.
+  ON_CALL(*time_source, monotonicTime())
+      .WillByDefault(Return(MonotonicTime(std::chrono::seconds(100))));
+
+  // Configure the cache.
+  MockKeyValueStoreFactory factory;
+  EXPECT_CALL(factory, createEmptyConfigProto()).WillRepeatedly(Invoke([]() {
+    return std::make_unique<
+        envoy::extensions::key_value::file_based::v3::FileBasedKeyValueStoreConfig>();
+  }));
+  MockKeyValueStore* store{};
+  EXPECT_CALL(factory, createStore(_, _, _, _)).WillOnce(Invoke([&store]() {
+    auto ret = std::make_unique<NiceMock<MockKeyValueStore>>();
+    store = ret.get();
+    EXPECT_CALL(*store, iterate).WillOnce(Invoke([&](KeyValueStore::ConstIterateCb fn) {
+      fn("foo.com:80", "10.0.0.2:80|40|0");
+    }));
+    return ret;
+  }));
+  Registry::InjectFactory<KeyValueStoreFactory> injector(factory);
+  auto* key_value_config = config_.mutable_key_value_config()->mutable_config();
+  key_value_config->set_name("mock_key_value_store_factory");
+  key_value_config->mutable_typed_config()->PackFrom(
+      envoy::extensions::key_value::file_based::v3::FileBasedKeyValueStoreConfig());
+
+  Event::MockTimer* resolve_timer =
+      new Event::MockTimer(&context_.server_factory_context_.dispatcher_);
+  new Event::MockTimer(&context_.server_factory_context_.dispatcher_); // Timeout timer.
+  // The mock random generator returns 0, so the splay within the minimum refresh interval
+  // collapses to an immediate refresh.
+  EXPECT_CALL(*resolve_timer, enableTimer(std::chrono::milliseconds(0), _));
+
+  initialize();
+  ASSERT(store != nullptr);
+  EXPECT_EQ(1, TestUtility::findCounter(context_.store_, "dns_cache.foo.cache_load")->value());
+  EXPECT_EQ(1,
+            TestUtility::findCounter(context_.store_, "dns_cache.foo.cache_load_stale")->value());
+
+  // The stale entry is still served while the refresh is pending.
+  MockLoadDnsCacheEntryCallbacks callbacks;
+  auto result = dns_cache_->loadDnsCacheEntry("foo.com", 80, false, callbacks);
+  EXPECT_EQ(DnsCache::LoadDnsCacheEntryStatus::InCache, result.status_);
+  EXPECT_EQ(result.handle_, nullptr);
+  EXPECT_NE(absl::nullopt, result.host_info_);
+}
+
 // Make sure the cache manager can handle the context going out of scope.
 TEST(DnsCacheManagerImplTest, TestLifetime) {
   NiceMock<Server::Configuration::MockGenericFactoryContext> context;
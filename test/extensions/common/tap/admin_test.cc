@@ -2,6 +2,7 @@
 #include <memory>
 
 #include "envoy/config/tap/v3/common.pb.h"
+#include "envoy/data/tap/v3/wrapper.pb.h"
 
 #include "source/extensions/common/tap/admin.h"
 #include "source/extensions/common/tap/tap.h"
@@ -368,6 +369,57 @@ TEST_F(AdminHandlerTest, CloseMidStream) {
   sinkHandle->submitTrace(makeTraceWrapper(), format);
 }
 
+// Test that a streaming admin tap can write length delimited binary proto frames.
+TEST_F(AdminHandlerTest, StreamingTapLengthDelimited) {
+  using ProtoOutputSink = envoy::config::tap::v3::OutputSink;
+  const std::string request_yaml =
+      R"EOF(
+config_id: test_config_id
+tap_config:
+  match:
+    any_match: true
+  output_config:
+    sinks:
+      - format: PROTO_BINARY_LENGTH_DELIMITED
+        streaming_admin: {}
+)EOF";
+
+  setup();
+  MockExtensionConfig extension_config;
+  handler_->registerConfig(extension_config, "test_config_id");
+
+  Buffer::OwnedImpl body(request_yaml);
+  EXPECT_CALL(admin_stream_, getRequestBody()).WillRepeatedly(Return(&body));
+  EXPECT_CALL(extension_config, newTapConfig(_, handler_.get()));
+  EXPECT_CALL(admin_stream_, setEndStreamOnComplete(false));
+  EXPECT_CALL(admin_stream_, addOnDestroyCallback(_));
+  EXPECT_EQ(Http::Code::OK, makeRequest("/tap"));
+
+  StrictMock<Http::MockStreamDecoderFilterCallbacks> sink;
+  ON_CALL(admin_stream_, getDecoderFilterCallbacks()).WillByDefault(ReturnRef(sink));
+  EXPECT_CALL(admin_stream_, getDecoderFilterCallbacks());
+  Buffer::OwnedImpl captured;
+  EXPECT_CALL(sink, encodeData(_, false))
+      .WillOnce(Invoke([&captured](Buffer::Instance& data, bool) { captured.move(data); }));
+
+  // Direct access to the handle is required so we can submit traces directly
+  PerTapSinkHandlePtr sink_handle =
+      handler_->createPerTapSinkHandle(0, ProtoOutputSink::OutputSinkTypeCase::kStreamingAdmin);
+  EXPECT_CALL(main_thread_dispatcher_, post(_));
+  sink_handle->submitTrace(makeTraceWrapper(), ProtoOutputSink::PROTO_BINARY_LENGTH_DELIMITED);
+  main_thread_dispatcher_.drain();
+
+  // The frame is a varint length prefix followed by a serialized TraceWrapper.
+  const std::string frame = captured.toString();
+  Protobuf::io::CodedInputStream coded_stream(reinterpret_cast<const uint8_t*>(frame.data()),
+                                              frame.size());
+  uint64_t message_size;
+  ASSERT_TRUE(coded_stream.ReadVarint64(&message_size));
+  EXPECT_EQ(frame.size() - coded_stream.CurrentPosition(), message_size);
+  envoy::data::tap::v3::TraceWrapper trace;
+  EXPECT_TRUE(trace.ParseFromArray(frame.data() + coded_stream.CurrentPosition(), message_size));
+}
+
 // Test that when performing a buffered tap, verify the admin_stream_ encodes each packet.
 TEST_F(BufferedAdminHandlerTest, BufferedTapWrites) {
   using ProtoOutputSink = envoy::config::tap::v3::OutputSink;
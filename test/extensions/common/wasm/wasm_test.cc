@@ -703,6 +703,67 @@ TEST_P(WasmCommonTest, VmCache) {
   proxy_wasm::clearWasmCachesForTesting();
 }
 
+// With envoy.reloadable_features.wasm_retain_base_vms enabled the base VM survives dropping the
+// last configuration reference and a subsequent createWasm() with the same vm_key reuses it
+// instead of recompiling the module.
+TEST_P(WasmCommonTest, VmRetention) {
+  TestScopedRuntime scoped_runtime;
+  scoped_runtime.mergeValues({{"envoy.reloadable_features.wasm_retain_base_vms", "true"}});
+  Stats::IsolatedStoreImpl stats_store;
+  Api::ApiPtr api = Api::createApiForTest(stats_store);
+  NiceMock<Upstream::MockClusterManager> cluster_manager;
+  NiceMock<Init::MockManager> init_manager;
+  NiceMock<Server::MockServerLifecycleNotifier> lifecycle_notifier;
+  Event::DispatcherPtr dispatcher(api->allocateDispatcher("wasm_test"));
+  RemoteAsyncDataProviderPtr remote_data_provider;
+  auto scope = Stats::ScopeSharedPtr(stats_store.createScope("wasm."));
+  NiceMock<LocalInfo::MockLocalInfo> local_info;
+  auto vm_configuration = "vm_cache";
+
+  envoy::extensions::wasm::v3::PluginConfig plugin_config;
+  auto vm_config = plugin_config.mutable_vm_config();
+  vm_config->set_runtime(absl::StrCat("envoy.wasm.runtime.", std::get<0>(GetParam())));
+  ProtobufWkt::StringValue vm_configuration_string;
+  vm_configuration_string.set_value(vm_configuration);
+  vm_config->mutable_configuration()->PackFrom(vm_configuration_string);
+  std::string code;
+  if (std::get<0>(GetParam()) != "null") {
+    code = TestEnvironment::readFileToStringForTest(TestEnvironment::substitute(
+        absl::StrCat("{{ test_rundir }}/test/extensions/common/wasm/test_data/test_cpp.wasm")));
+  } else {
+    // The name of the Null VM plugin.
+    code = "CommonWasmTestCpp";
+  }
+  EXPECT_FALSE(code.empty());
+  vm_config->mutable_code()->mutable_local()->set_inline_bytes(code);
+  auto plugin = std::make_shared<Extensions::Common::Wasm::Plugin>(
+      plugin_config, envoy::config::core::v3::TrafficDirection::UNSPECIFIED, local_info, nullptr);
+
+  WasmHandleSharedPtr wasm_handle;
+  createWasm(plugin, scope, cluster_manager, init_manager, *dispatcher, *api, lifecycle_notifier,
+             remote_data_provider,
+             [&wasm_handle](const WasmHandleSharedPtr& w) { wasm_handle = w; });
+  EXPECT_NE(wasm_handle, nullptr);
+  Wasm* base_wasm = wasm_handle->wasm().get();
+
+  // Drop the only strong reference held by "configuration". proxy-wasm's de-duplication
+  // registry only holds weak references, so without retention the next createWasm() would
+  // compile a fresh VM.
+  wasm_handle.reset();
+
+  WasmHandleSharedPtr wasm_handle2;
+  createWasm(plugin, scope, cluster_manager, init_manager, *dispatcher, *api, lifecycle_notifier,
+             remote_data_provider,
+             [&wasm_handle2](const WasmHandleSharedPtr& w) { wasm_handle2 = w; });
+  EXPECT_NE(wasm_handle2, nullptr);
+  EXPECT_EQ(base_wasm, wasm_handle2->wasm().get());
+  wasm_handle2.reset();
+
+  // Release the retained base VM while this test's dispatcher is still alive.
+  clearCodeCacheForTesting();
+  proxy_wasm::clearWasmCachesForTesting();
+}
+
 TEST_P(WasmCommonTest, RemoteCode) {
   if (std::get<0>(GetParam()) == "null") {
     return;
@@ -105,6 +105,33 @@ TEST_F(ZstdCompressorImplTest, CompressWitHugeBuffer) {
   verifyWithDecompressor(std::move(compressor));
 }
 
+TEST_F(ZstdCompressorImplTest, ContextPooling) {
+  ZstdCCtxPool pool;
+
+  // A compressor built on the pool parks its context on destruction.
+  {
+    Buffer::OwnedImpl buffer;
+    ZstdCompressorImpl compressor(default_compression_level_, default_enable_checksum_,
+                                  default_strategy_, default_cdict_manager_, 4096, &pool);
+    TestUtility::feedBufferWithRandomCharacters(buffer, 4096);
+    compressor.compress(buffer, Envoy::Compression::Compressor::State::Finish);
+  }
+
+  // The parked context is handed back out on the next take.
+  auto cctx = pool.take();
+  ZSTD_CCtx* recycled = cctx.get();
+  pool.park(std::move(cctx));
+  auto cctx2 = pool.take();
+  EXPECT_EQ(recycled, cctx2.get());
+  pool.park(std::move(cctx2));
+
+  // A compressor built on the recycled context still produces frames the decompressor accepts.
+  auto compressor =
+      std::make_unique<ZstdCompressorImpl>(default_compression_level_, default_enable_checksum_,
+                                           default_strategy_, default_cdict_manager_, 4096, &pool);
+  verifyWithDecompressor(std::move(compressor));
+}
+
 TEST_F(ZstdCompressorImplTest, IllegalConfig) {
   envoy::extensions::compression::zstd::compressor::v3::Zstd zstd;
   Zstd::Compressor::ZstdCompressorLibraryFactory lib_factory;
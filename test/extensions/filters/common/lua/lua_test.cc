@@ -86,6 +86,65 @@ TEST_F(LuaTest, CoroutineRefCounting) {
   lua_gc(cr2->luaState(), LUA_GCCOLLECT, 0);
 }
 
+// Coroutine threads that finish cleanly are parked and reused across createCoroutine() calls;
+// yielded or errored threads are left to the GC.
+TEST_F(LuaTest, CoroutinePooling) {
+  const std::string SCRIPT{R"EOF(
+    function callMe()
+    end
+
+    function yieldMe()
+      coroutine.yield()
+    end
+
+    function errorMe()
+      error("broken")
+    end
+  )EOF"};
+
+  InSequence s;
+  setup(SCRIPT);
+  const int call_me = state_->getGlobalRef(state_->registerGlobal("callMe", initializers_));
+  const int yield_me = state_->getGlobalRef(state_->registerGlobal("yieldMe", initializers_));
+  const int error_me = state_->getGlobalRef(state_->registerGlobal("errorMe", initializers_));
+
+  // A coroutine that finishes cleanly is parked on destruction and handed back out with a clean
+  // stack.
+  CoroutinePtr cr1(state_->createCoroutine());
+  cr1->start(call_me, 0, yield_callback_);
+  EXPECT_EQ(cr1->state(), Coroutine::State::Finished);
+  lua_State* recycled = cr1->luaState();
+  cr1.reset();
+
+  CoroutinePtr cr2(state_->createCoroutine());
+  EXPECT_EQ(recycled, cr2->luaState());
+  EXPECT_EQ(0, lua_gettop(cr2->luaState()));
+
+  // The recycled thread can run another script invocation.
+  cr2->start(call_me, 0, yield_callback_);
+  EXPECT_EQ(cr2->state(), Coroutine::State::Finished);
+  cr2.reset();
+
+  // A coroutine destroyed while yielded is not reused.
+  CoroutinePtr cr3(state_->createCoroutine());
+  EXPECT_CALL(on_yield_, ready());
+  cr3->start(yield_me, 0, yield_callback_);
+  EXPECT_EQ(cr3->state(), Coroutine::State::Yielded);
+  lua_State* yielded_thread = cr3->luaState();
+  cr3.reset();
+
+  CoroutinePtr cr4(state_->createCoroutine());
+  EXPECT_NE(yielded_thread, cr4->luaState());
+
+  // A coroutine that errored is not reused either.
+  EXPECT_THROW_WITH_REGEX(cr4->start(error_me, 0, yield_callback_), LuaException, "broken");
+  lua_State* errored_thread = cr4->luaState();
+  cr4.reset();
+
+  CoroutinePtr cr5(state_->createCoroutine());
+  EXPECT_NE(errored_thread, cr5->luaState());
+}
+
 // Test that we don't crash when empty errors are used (see PR #15471)
 TEST_F(LuaTest, EmptyError) {
   const std::string SCRIPT{R"EOF(
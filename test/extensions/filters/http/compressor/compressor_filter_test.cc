@@ -1,11 +1,17 @@
+#include <deque>
+
+#include "source/common/common/base64.h"
+#include "source/common/crypto/utility.h"
 #include "source/extensions/filters/http/compressor/compressor_filter.h"
 
 #include "test/mocks/compression/compressor/mocks.h"
 #include "test/mocks/http/mocks.h"
 #include "test/mocks/runtime/mocks.h"
 #include "test/mocks/stats/mocks.h"
+#include "test/test_common/thread_factory_for_test.h"
 #include "test/test_common/utility.h"
 
+#include "absl/synchronization/mutex.h"
 #include "gtest/gtest.h"
 
 namespace Envoy {
@@ -28,14 +34,26 @@ public:
     EXPECT_CALL(*compressor, compress(_, _)).Times(expected_compress_calls_);
     return compressor;
   }
+  Envoy::Compression::Compressor::CompressorPtr
+  createCompressorWithDictionary(absl::string_view dictionary) override {
+    if (!supports_dictionaries_) {
+      return nullptr;
+    }
+    last_dictionary_ = std::string(dictionary);
+    return createCompressor();
+  }
   const std::string& statsPrefix() const override { CONSTRUCT_ON_FIRST_USE(std::string, "test."); }
   const std::string& contentEncoding() const override { return content_encoding_; }
 
   void setExpectedCompressCalls(uint32_t calls) { expected_compress_calls_ = calls; }
+  void setSupportsDictionaries() { supports_dictionaries_ = true; }
+  const std::string& lastDictionary() const { return last_dictionary_; }
 
 private:
   uint32_t expected_compress_calls_{1};
   const std::string content_encoding_;
+  bool supports_dictionaries_{};
+  std::string last_dictionary_;
 };
 
 class CompressorFilterTest : public testing::Test {
@@ -1170,6 +1188,268 @@ TEST_P(ChooseFirstTest, Validate) {
   doResponse(headers, is_compression_expected, false, content_encoding);
 }
 
+class AsyncCompressorFilterTest : public CompressorFilterTest {
+public:
+  void setUpAsyncFilter(std::string&& json) {
+    envoy::extensions::filters::http::compressor::v3::Compressor compressor;
+    TestUtility::loadFromJson(json, compressor);
+    auto compressor_factory = std::make_unique<TestCompressorFactory>("test");
+    compressor_factory_ = compressor_factory.get();
+    config_ = std::make_shared<CompressorFilterConfig>(compressor, "test.", *stats_.rootScope(),
+                                                       runtime_, std::move(compressor_factory),
+                                                       &Thread::threadFactoryForTest());
+    filter_ = std::make_unique<CompressorFilter>(config_);
+    filter_->setDecoderFilterCallbacks(decoder_callbacks_);
+    filter_->setEncoderFilterCallbacks(encoder_callbacks_);
+    response_stats_prefix_ = "response.";
+    // The pool posts compressed chunks back to the worker dispatcher; capture them so the test
+    // can run them as the dispatcher would.
+    ON_CALL(encoder_callbacks_.dispatcher_, post(_))
+        .WillByDefault(Invoke([this](Event::PostCb cb) {
+          absl::MutexLock lock(&posts_mutex_);
+          posts_.push_back(std::move(cb));
+        }));
+  }
+
+  // Waits for the compression pool to post a result back and runs it.
+  void runNextPostedCallback() {
+    Event::PostCb cb;
+    {
+      absl::MutexLock lock(&posts_mutex_);
+      posts_mutex_.Await(absl::Condition(
+          +[](std::deque<Event::PostCb>* posts) { return !posts->empty(); }, &posts_));
+      cb = std::move(posts_.front());
+      posts_.pop_front();
+    }
+    cb();
+  }
+
+  static constexpr absl::string_view default_async_config_ = R"EOF(
+{
+  "response_direction_config": {
+    "async_compression": {}
+  },
+  "compressor_library": {
+     "name": "test",
+     "typed_config": {
+       "@type": "type.googleapis.com/envoy.extensions.compression.gzip.compressor.v3.Gzip"
+     }
+  }
+}
+)EOF";
+
+  absl::Mutex posts_mutex_;
+  std::deque<Event::PostCb> posts_ ABSL_GUARDED_BY(posts_mutex_);
+};
+
+// A response body chunk is compressed off-thread and injected back into the filter chain.
+TEST_F(AsyncCompressorFilterTest, CompressesOffThread) {
+  setUpAsyncFilter(std::string(default_async_config_));
+
+  doRequestNoCompression({{":method", "get"}, {"accept-encoding", "deflate, test"}});
+  Http::TestResponseHeaderMapImpl headers{{":status", "200"}, {"content-length", "256"}};
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->encodeHeaders(headers, false));
+  EXPECT_EQ("test", headers.get_("content-encoding"));
+
+  populateBuffer(256);
+  EXPECT_EQ(Http::FilterDataStatus::StopIterationNoBuffer, filter_->encodeData(data_, true));
+  EXPECT_EQ(0, data_.length());
+
+  EXPECT_CALL(encoder_callbacks_, injectEncodedDataToFilterChain(_, true))
+      .WillOnce(Invoke(
+          [&](Buffer::Instance& data, bool) { EXPECT_EQ(expected_str_, data.toString()); }));
+  runNextPostedCallback();
+
+  EXPECT_EQ(256,
+            stats_.counter("test.compressor.test.test.response.total_uncompressed_bytes").value());
+  EXPECT_EQ(256,
+            stats_.counter("test.compressor.test.test.response.total_compressed_bytes").value());
+  EXPECT_EQ(1, stats_.counter("test.compressor.test.test.response.compressed").value());
+}
+
+// Trailers are held back until the final compressed output has been injected before them.
+TEST_F(AsyncCompressorFilterTest, TrailersWaitForFinalChunk) {
+  setUpAsyncFilter(std::string(default_async_config_));
+  compressor_factory_->setExpectedCompressCalls(2);
+
+  doRequestNoCompression({{":method", "get"}, {"accept-encoding", "deflate, test"}});
+  Http::TestResponseHeaderMapImpl headers{{":status", "200"}, {"content-length", "256"}};
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->encodeHeaders(headers, false));
+
+  populateBuffer(256);
+  EXPECT_EQ(Http::FilterDataStatus::StopIterationNoBuffer, filter_->encodeData(data_, false));
+  EXPECT_CALL(encoder_callbacks_, injectEncodedDataToFilterChain(_, false));
+  runNextPostedCallback();
+
+  Http::TestResponseTrailerMapImpl trailers;
+  EXPECT_EQ(Http::FilterTrailersStatus::StopIteration, filter_->encodeTrailers(trailers));
+  EXPECT_CALL(encoder_callbacks_, injectEncodedDataToFilterChain(_, false));
+  EXPECT_CALL(encoder_callbacks_, continueEncoding());
+  runNextPostedCallback();
+}
+
+// Watermark backpressure is signaled while a stream's queued bytes exceed the limit.
+TEST_F(AsyncCompressorFilterTest, WatermarkBackpressure) {
+  setUpAsyncFilter(R"EOF(
+{
+  "response_direction_config": {
+    "async_compression": {
+      "high_watermark_bytes": 64
+    }
+  },
+  "compressor_library": {
+     "name": "test",
+     "typed_config": {
+       "@type": "type.googleapis.com/envoy.extensions.compression.gzip.compressor.v3.Gzip"
+     }
+  }
+}
+)EOF");
+
+  doRequestNoCompression({{":method", "get"}, {"accept-encoding", "deflate, test"}});
+  Http::TestResponseHeaderMapImpl headers{{":status", "200"}, {"content-length", "256"}};
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->encodeHeaders(headers, false));
+
+  populateBuffer(256);
+  EXPECT_CALL(encoder_callbacks_, onEncoderFilterAboveWriteBufferHighWatermark());
+  EXPECT_EQ(Http::FilterDataStatus::StopIterationNoBuffer, filter_->encodeData(data_, true));
+
+  EXPECT_CALL(encoder_callbacks_, onEncoderFilterBelowWriteBufferLowWatermark());
+  EXPECT_CALL(encoder_callbacks_, injectEncodedDataToFilterChain(_, true));
+  runNextPostedCallback();
+}
+
+// Results arriving after the stream is destroyed are dropped.
+TEST_F(AsyncCompressorFilterTest, ResultAfterDestroyIsDropped) {
+  setUpAsyncFilter(std::string(default_async_config_));
+
+  doRequestNoCompression({{":method", "get"}, {"accept-encoding", "deflate, test"}});
+  Http::TestResponseHeaderMapImpl headers{{":status", "200"}, {"content-length", "256"}};
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->encodeHeaders(headers, false));
+
+  populateBuffer(256);
+  EXPECT_EQ(Http::FilterDataStatus::StopIterationNoBuffer, filter_->encodeData(data_, true));
+  filter_->onDestroy();
+
+  EXPECT_CALL(encoder_callbacks_, injectEncodedDataToFilterChain(_, _)).Times(0);
+  runNextPostedCallback();
+}
+
+class SharedDictionaryCompressorFilterTest : public CompressorFilterTest {
+protected:
+  void SetUp() override {
+    envoy::extensions::filters::http::compressor::v3::Compressor compressor;
+    TestUtility::loadFromJson(std::string(dictionary_config_), compressor);
+    auto compressor_factory = std::make_unique<TestCompressorFactory>("zstd");
+    compressor_factory->setSupportsDictionaries();
+    compressor_factory_ = compressor_factory.get();
+    config_ = std::make_shared<CompressorFilterConfig>(compressor, "test.", *stats_.rootScope(),
+                                                       runtime_, std::move(compressor_factory));
+    filter_ = std::make_unique<CompressorFilter>(config_);
+    filter_->setDecoderFilterCallbacks(decoder_callbacks_);
+    filter_->setEncoderFilterCallbacks(encoder_callbacks_);
+  }
+
+  static std::string digestOf(absl::string_view payload) {
+    Buffer::OwnedImpl buffer(payload);
+    const std::vector<uint8_t> digest =
+        Envoy::Common::Crypto::UtilitySingleton::get().getSha256Digest(buffer);
+    return {digest.begin(), digest.end()};
+  }
+
+  static std::string availableDictionaryValue(const std::string& digest) {
+    return absl::StrCat(":", Base64::encode(digest.data(), digest.size()), ":");
+  }
+
+  static constexpr absl::string_view dictionary_config_ = R"EOF(
+{
+  "shared_dictionary": {
+    "resources": [
+      {
+        "path_prefix": "/assets/",
+        "match": "/assets/*"
+      }
+    ]
+  },
+  "compressor_library": {
+     "name": "test",
+     "typed_config": {
+       "@type": "type.googleapis.com/envoy.extensions.compression.gzip.compressor.v3.Gzip"
+     }
+  }
+}
+)EOF";
+};
+
+// Responses to configured dictionary resources are advertised with Use-As-Dictionary and their
+// identity payload is captured into the store.
+TEST_F(SharedDictionaryCompressorFilterTest, StoresAdvertisedDictionaryResource) {
+  Http::TestRequestHeaderMapImpl request_headers{
+      {":method", "get"}, {":path", "/assets/app.js"}, {"accept-encoding", "zstd"}};
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->decodeHeaders(request_headers, false));
+
+  Http::TestResponseHeaderMapImpl headers{
+      {":status", "200"}, {"content-length", "256"}, {"content-type", "text/html"}};
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->encodeHeaders(headers, false));
+  EXPECT_EQ("match=\"/assets/*\"", headers.get_("use-as-dictionary"));
+
+  populateBuffer(256);
+  EXPECT_EQ(Http::FilterDataStatus::Continue, filter_->encodeData(data_, true));
+  EXPECT_EQ(1, stats_.counter("test.compressor.test.test.shared_dictionary_stored").value());
+  // The identity payload, not the compressed one, must be retrievable by its digest.
+  const auto stored = config_->dictionaryStore()->find(digestOf(expected_str_));
+  ASSERT_NE(nullptr, stored);
+  EXPECT_EQ(expected_str_, *stored);
+}
+
+// A request negotiating a stored dictionary gets a dcz response framed with the dictionary
+// digest and compressed by a dictionary-primed compressor.
+TEST_F(SharedDictionaryCompressorFilterTest, CompressesWithNegotiatedDictionary) {
+  const std::string dictionary(512, 'a');
+  const std::string digest = digestOf(dictionary);
+  config_->dictionaryStore()->insert(digest, dictionary);
+
+  Http::TestRequestHeaderMapImpl request_headers{
+      {":method", "get"},
+      {":path", "/app/main.js"},
+      {"accept-encoding", "dcz, zstd"},
+      {"available-dictionary", availableDictionaryValue(digest)}};
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->decodeHeaders(request_headers, false));
+
+  Http::TestResponseHeaderMapImpl headers{
+      {":status", "200"}, {"content-length", "256"}, {"content-type", "text/html"}};
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->encodeHeaders(headers, false));
+  EXPECT_EQ("dcz", headers.get_("content-encoding"));
+  EXPECT_EQ("available-dictionary, Accept-Encoding", headers.get_("vary"));
+  EXPECT_EQ(dictionary, compressor_factory_->lastDictionary());
+
+  populateBuffer(256);
+  EXPECT_EQ(Http::FilterDataStatus::Continue, filter_->encodeData(data_, true));
+  // The payload opens with the zstd skippable frame embedding the dictionary digest.
+  const std::string payload = data_.toString();
+  ASSERT_GT(payload.size(), 40);
+  EXPECT_EQ(absl::string_view("\x5e\x2a\x4d\x18\x20\x00\x00\x00", 8), payload.substr(0, 8));
+  EXPECT_EQ(digest, payload.substr(8, 32));
+  EXPECT_EQ(expected_str_, payload.substr(40));
+  EXPECT_EQ(1, stats_.counter("test.compressor.test.test.shared_dictionary_used").value());
+}
+
+// An Available-Dictionary digest that is not in the store falls back to regular negotiation.
+TEST_F(SharedDictionaryCompressorFilterTest, FallsBackWhenDictionaryUnknown) {
+  Http::TestRequestHeaderMapImpl request_headers{
+      {":method", "get"},
+      {":path", "/app/main.js"},
+      {"accept-encoding", "dcz, zstd"},
+      {"available-dictionary", availableDictionaryValue(digestOf("unknown"))}};
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->decodeHeaders(request_headers, false));
+
+  Http::TestResponseHeaderMapImpl headers{
+      {":status", "200"}, {"content-length", "256"}, {"content-type", "text/html"}};
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->encodeHeaders(headers, false));
+  EXPECT_EQ("zstd", headers.get_("content-encoding"));
+  EXPECT_EQ(0, stats_.counter("test.compressor.test.test.shared_dictionary_used").value());
+}
+
 TEST(CompressorFilterConfigTests, MakeCompressorTest) {
   const envoy::extensions::filters::http::compressor::v3::Compressor compressor_cfg;
   NiceMock<Runtime::MockLoader> runtime;
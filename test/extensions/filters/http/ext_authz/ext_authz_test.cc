@@ -1744,6 +1744,139 @@ TEST_F(HttpFilterTest, ClearCache) {
   EXPECT_EQ(1U, config_->stats().ok_.value());
 }
 
+// Verifies that a plain allowed decision is stored in the decision cache and that a repeated
+// request carrying the same configured header skips the authorization call.
+TEST_F(HttpFilterTest, DecisionCacheServesRepeatedRequest) {
+  InSequence s;
+
+  initialize(R"EOF(
+  grpc_service:
+    envoy_grpc:
+      cluster_name: "ext_authz_server"
+  decision_cache:
+    headers:
+    - authorization
+  )EOF");
+
+  prepareCheck();
+  request_headers_.addCopy(LowerCaseString("authorization"), "Bearer legit-token");
+
+  Filters::Common::ExtAuthz::Response response{};
+  response.status = Filters::Common::ExtAuthz::CheckStatus::OK;
+  EXPECT_CALL(*client_, check(_, _, _, _))
+      .WillOnce(Invoke([&](Filters::Common::ExtAuthz::RequestCallbacks& callbacks,
+                           const envoy::service::auth::v3::CheckRequest&, Tracing::Span&,
+                           const StreamInfo::StreamInfo&) -> void {
+        callbacks.onComplete(std::make_unique<Filters::Common::ExtAuthz::Response>(response));
+      }));
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->decodeHeaders(request_headers_, false));
+  EXPECT_EQ(1U, config_->stats().decision_cache_miss_.value());
+  EXPECT_EQ(0U, config_->stats().decision_cache_hit_.value());
+
+  // A second stream with the same authorization header is allowed from the cache.
+  auto* client = new NiceMock<Filters::Common::ExtAuthz::MockClient>();
+  auto filter = std::make_unique<Filter>(config_, Filters::Common::ExtAuthz::ClientPtr{client});
+  filter->setDecoderFilterCallbacks(decoder_filter_callbacks_);
+  filter->setEncoderFilterCallbacks(encoder_filter_callbacks_);
+  EXPECT_CALL(*client, check(_, _, _, _)).Times(0);
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter->decodeHeaders(request_headers_, false));
+  EXPECT_EQ(1U, config_->stats().decision_cache_miss_.value());
+  EXPECT_EQ(1U, config_->stats().decision_cache_hit_.value());
+
+  // A stream without any of the configured headers bypasses the cache entirely.
+  Http::TestRequestHeaderMapImpl bare_headers{};
+  auto* bare_client = new NiceMock<Filters::Common::ExtAuthz::MockClient>();
+  auto bare_filter =
+      std::make_unique<Filter>(config_, Filters::Common::ExtAuthz::ClientPtr{bare_client});
+  bare_filter->setDecoderFilterCallbacks(decoder_filter_callbacks_);
+  bare_filter->setEncoderFilterCallbacks(encoder_filter_callbacks_);
+  EXPECT_CALL(*bare_client, check(_, _, _, _));
+  EXPECT_EQ(Http::FilterHeadersStatus::StopAllIterationAndWatermark,
+            bare_filter->decodeHeaders(bare_headers, false));
+  EXPECT_EQ(1U, config_->stats().decision_cache_miss_.value());
+  EXPECT_EQ(1U, config_->stats().decision_cache_hit_.value());
+}
+
+// Verifies that allowed decisions carrying mutations are not stored in the decision cache.
+TEST_F(HttpFilterTest, DecisionCacheSkipsMutatingResponse) {
+  InSequence s;
+
+  initialize(R"EOF(
+  grpc_service:
+    envoy_grpc:
+      cluster_name: "ext_authz_server"
+  decision_cache:
+    headers:
+    - authorization
+  )EOF");
+
+  prepareCheck();
+  request_headers_.addCopy(LowerCaseString("authorization"), "Bearer legit-token");
+
+  Filters::Common::ExtAuthz::Response response{};
+  response.status = Filters::Common::ExtAuthz::CheckStatus::OK;
+  response.headers_to_set = {{"x-authz-user", "alice"}};
+  EXPECT_CALL(*client_, check(_, _, _, _))
+      .WillOnce(Invoke([&](Filters::Common::ExtAuthz::RequestCallbacks& callbacks,
+                           const envoy::service::auth::v3::CheckRequest&, Tracing::Span&,
+                           const StreamInfo::StreamInfo&) -> void {
+        callbacks.onComplete(std::make_unique<Filters::Common::ExtAuthz::Response>(response));
+      }));
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->decodeHeaders(request_headers_, false));
+
+  // The mutating allow was not cached, so the repeated request checks again.
+  auto* client = new NiceMock<Filters::Common::ExtAuthz::MockClient>();
+  auto filter = std::make_unique<Filter>(config_, Filters::Common::ExtAuthz::ClientPtr{client});
+  filter->setDecoderFilterCallbacks(decoder_filter_callbacks_);
+  filter->setEncoderFilterCallbacks(encoder_filter_callbacks_);
+  EXPECT_CALL(*client, check(_, _, _, _));
+  EXPECT_EQ(Http::FilterHeadersStatus::StopAllIterationAndWatermark,
+            filter->decodeHeaders(request_headers_, false));
+  EXPECT_EQ(2U, config_->stats().decision_cache_miss_.value());
+  EXPECT_EQ(0U, config_->stats().decision_cache_hit_.value());
+}
+
+// Verifies that cached decisions stop being served once the configured TTL has elapsed.
+TEST_F(HttpFilterTest, DecisionCacheEntryExpires) {
+  InSequence s;
+
+  initialize(R"EOF(
+  grpc_service:
+    envoy_grpc:
+      cluster_name: "ext_authz_server"
+  decision_cache:
+    headers:
+    - authorization
+    ttl: 1s
+  )EOF");
+
+  prepareCheck();
+  request_headers_.addCopy(LowerCaseString("authorization"), "Bearer legit-token");
+
+  Filters::Common::ExtAuthz::Response response{};
+  response.status = Filters::Common::ExtAuthz::CheckStatus::OK;
+  EXPECT_CALL(*client_, check(_, _, _, _))
+      .WillOnce(Invoke([&](Filters::Common::ExtAuthz::RequestCallbacks& callbacks,
+                           const envoy::service::auth::v3::CheckRequest&, Tracing::Span&,
+                           const StreamInfo::StreamInfo&) -> void {
+        callbacks.onComplete(std::make_unique<Filters::Common::ExtAuthz::Response>(response));
+      }));
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->decodeHeaders(request_headers_, false));
+
+  decoder_filter_callbacks_.dispatcher_.globalTimeSystem().advanceTimeWait(
+      std::chrono::milliseconds(1001));
+
+  auto* client = new NiceMock<Filters::Common::ExtAuthz::MockClient>();
+  auto filter = std::make_unique<Filter>(config_, Filters::Common::ExtAuthz::ClientPtr{client});
+  filter->setDecoderFilterCallbacks(decoder_filter_callbacks_);
+  filter->setEncoderFilterCallbacks(encoder_filter_callbacks_);
+  EXPECT_CALL(*client, check(_, _, _, _));
+  EXPECT_EQ(Http::FilterHeadersStatus::StopAllIterationAndWatermark,
+            filter->decodeHeaders(request_headers_, false));
+  EXPECT_EQ(2U, config_->stats().decision_cache_miss_.value());
+  EXPECT_EQ(0U, config_->stats().decision_cache_hit_.value());
+}
+
 // Verifies that the filter clears the route cache when an authorization response:
 // 1. is an OK response.
 // 2. has headers to append.
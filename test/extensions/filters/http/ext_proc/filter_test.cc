@@ -3832,6 +3832,22 @@ TEST_F(HttpFilterTest, SendDynamicMetadata) {
   filter_->onDestroy();
 }
 
+// Verify that when no forwarding namespaces are configured, processing requests
+// carry no metadata context at all rather than an empty one.
+TEST_F(HttpFilterTest, NoMetadataContextWithoutForwardingNamespaces) {
+  initialize(R"EOF(
+  grpc_service:
+    envoy_grpc:
+      cluster_name: "ext_proc_server"
+  )EOF");
+
+  EXPECT_EQ(FilterHeadersStatus::StopIteration, filter_->decodeHeaders(request_headers_, true));
+  processRequestHeaders(false, absl::nullopt);
+  EXPECT_FALSE(last_request_.has_metadata_context());
+
+  filter_->onDestroy();
+}
+
 // Verify that when returning an response with dynamic_metadata field set, the filter emits
 // dynamic metadata.
 TEST_F(HttpFilterTest, EmitDynamicMetadata) {
@@ -1126,9 +1126,25 @@ public:
 TEST_F(AuthenticatorJwtCacheTest, TestNonProvider) {
   createAuthenticator(absl::nullopt);
 
-  // For invalid provider, jwt_cache is not called.
-  EXPECT_CALL(jwks_cache_.jwks_data_.jwt_cache_, lookup(_)).Times(0);
-  EXPECT_CALL(jwks_cache_.jwks_data_.jwt_cache_, insert(GoodToken, _)).Times(0);
+  // Without a specific provider, jwt_cache is consulted once the provider has been resolved from
+  // the token's issuer.
+  EXPECT_CALL(jwks_cache_.jwks_data_.jwt_cache_, lookup(_)).WillOnce(Return(nullptr));
+  // jwt_cache insert is called for a good jwt.
+  EXPECT_CALL(jwks_cache_.jwks_data_.jwt_cache_, insert(GoodToken, _));
+
+  Http::TestRequestHeaderMapImpl headers{{"Authorization", "Bearer " + std::string(GoodToken)}};
+  expectVerifyStatus(Status::Ok, headers);
+}
+
+TEST_F(AuthenticatorJwtCacheTest, TestNonProviderCacheHit) {
+  createAuthenticator(absl::nullopt);
+
+  ::google::jwt_verify::Jwt cached_jwt;
+  cached_jwt.parseFromString(GoodToken);
+  // jwt_cache hit on the issuer path: lookup return a cached jwt.
+  EXPECT_CALL(jwks_cache_.jwks_data_.jwt_cache_, lookup(_)).WillOnce(Return(&cached_jwt));
+  // jwt_cache insert is not called.
+  EXPECT_CALL(jwks_cache_.jwks_data_.jwt_cache_, insert(_, _)).Times(0);
 
   Http::TestRequestHeaderMapImpl headers{{"Authorization", "Bearer " + std::string(GoodToken)}};
   expectVerifyStatus(Status::Ok, headers);
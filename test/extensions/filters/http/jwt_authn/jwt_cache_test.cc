@@ -1,3 +1,4 @@
+#include <chrono>
 #include <memory>
 
 #include "envoy/extensions/filters/http/jwt_authn/v3/config.pb.h"
@@ -19,10 +20,11 @@ namespace {
 
 class JwtCacheTest : public testing::Test {
 public:
-  void setupCache(bool enable) {
+  void setupCache(bool enable,
+                  uint64_t clock_skew_seconds = ::google::jwt_verify::kClockSkewInSecond) {
     envoy::extensions::filters::http::jwt_authn::v3::JwtCacheConfig config;
     config.set_jwt_cache_size(0);
-    cache_ = JwtCache::create(enable, config, time_system_);
+    cache_ = JwtCache::create(enable, config, clock_skew_seconds, time_system_);
   }
 
   void loadJwt(const char* jwt_str) {
@@ -80,6 +82,29 @@ TEST_F(JwtCacheTest, TestExpiredToken) {
   EXPECT_TRUE(jwt == nullptr);
 }
 
+TEST_F(JwtCacheTest, TestClockSkewKeepsRecentlyExpiredToken) {
+  // setup an enabled cache with a 100 second clock skew tolerance.
+  setupCache(true, 100);
+  loadJwt(ExpiredToken);
+
+  // 10 seconds past the token's expiration, within the configured skew.
+  time_system_.setSystemTime(
+      std::chrono::system_clock::time_point(std::chrono::seconds(1205005587 + 10)));
+
+  auto* origin_jwt = jwt_.get();
+  cache_->insert(ExpiredToken, std::move(jwt_));
+
+  auto* jwt1 = cache_->lookup(ExpiredToken);
+  // found since the token is expired by less than the skew.
+  EXPECT_EQ(jwt1, origin_jwt);
+
+  // Beyond the skew the entry is evicted.
+  time_system_.setSystemTime(
+      std::chrono::system_clock::time_point(std::chrono::seconds(1205005587 + 200)));
+  auto* jwt2 = cache_->lookup(ExpiredToken);
+  EXPECT_TRUE(jwt2 == nullptr);
+}
+
 } // namespace
 } // namespace JwtAuthn
 } // namespace HttpFilters
@@ -187,6 +187,9 @@ class ConfigBufferSizeGTSingleRequest : public Config {
   std::chrono::milliseconds bufferFlushTimeoutInMs() const override {
     return std::chrono::milliseconds(1);
   }
+  absl::optional<std::chrono::milliseconds> bufferFlushLatencyBudget() const override {
+    return absl::nullopt;
+  }
   uint32_t maxUpstreamUnknownConnections() const override { return 0; }
   bool enableCommandStats() const override { return false; }
   ReadPolicy readPolicy() const override { return ReadPolicy::Primary; }
@@ -339,6 +342,107 @@ TEST_F(RedisClientImplTest, Basic) {
   client_->close();
 }
 
+class ConfigAdaptiveFlushLatencyBudget : public Config {
+  bool disableOutlierEvents() const override { return false; }
+  std::chrono::milliseconds opTimeout() const override { return std::chrono::milliseconds(25); }
+  bool enableHashtagging() const override { return false; }
+  bool enableRedirection() const override { return false; }
+  unsigned int maxBufferSizeBeforeFlush() const override { return 0; }
+  std::chrono::milliseconds bufferFlushTimeoutInMs() const override {
+    return std::chrono::milliseconds(3);
+  }
+  absl::optional<std::chrono::milliseconds> bufferFlushLatencyBudget() const override {
+    return std::chrono::milliseconds(10);
+  }
+  uint32_t maxUpstreamUnknownConnections() const override { return 0; }
+  bool enableCommandStats() const override { return false; }
+  ReadPolicy readPolicy() const override { return ReadPolicy::Primary; }
+  bool connectionRateLimitEnabled() const override { return false; }
+  uint32_t connectionRateLimitPerSec() const override { return 0; }
+};
+
+TEST_F(RedisClientImplTest, AdaptiveBatchDelaysFlushByBudgetMinusRtt) {
+  // With a latency budget configured, the first request is flushed immediately since there is no
+  // RTT estimate yet. Once a response establishes the estimate, subsequent flushes are delayed by
+  // the budget minus the measured RTT, and fall back to immediate flushes when the estimate
+  // consumes the whole budget.
+  InSequence s;
+
+  setup(std::make_shared<ConfigAdaptiveFlushLatencyBudget>());
+
+  // No RTT sample yet: flush immediately.
+  Common::Redis::RespValue request1;
+  MockClientCallbacks callbacks1;
+  EXPECT_CALL(*encoder_, encode(Ref(request1), _));
+  EXPECT_CALL(*flush_timer_, enabled()).WillOnce(Return(false));
+  PoolRequest* handle1 = client_->makeRequest(request1, callbacks1);
+  EXPECT_NE(nullptr, handle1);
+
+  // Respond 2ms after the flush, establishing a 2ms RTT estimate.
+  simTime().advanceTimeWait(std::chrono::milliseconds(2));
+  Buffer::OwnedImpl fake_data;
+  EXPECT_CALL(*decoder_, decode(Ref(fake_data))).WillOnce(Invoke([&](Buffer::Instance&) -> void {
+    InSequence s;
+    Common::Redis::RespValuePtr response1(new Common::Redis::RespValue());
+    EXPECT_CALL(callbacks1, onResponse_(Ref(response1)));
+    EXPECT_CALL(*connect_or_op_timer_, disableTimer());
+    EXPECT_CALL(host_->outlier_detector_,
+                putResult(Upstream::Outlier::Result::ExtOriginRequestSuccess, _));
+    callbacks_->onRespValue(std::move(response1));
+  }));
+  upstream_read_filter_->onData(fake_data, false);
+
+  // The next request is held for the budget (10ms) minus the measured RTT (2ms).
+  Common::Redis::RespValue request2;
+  MockClientCallbacks callbacks2;
+  EXPECT_CALL(*encoder_, encode(Ref(request2), _));
+  EXPECT_CALL(*flush_timer_, enableTimer(std::chrono::milliseconds(8), _));
+  PoolRequest* handle2 = client_->makeRequest(request2, callbacks2);
+  EXPECT_NE(nullptr, handle2);
+
+  // Pretend the flush timer fires.
+  EXPECT_CALL(*flush_timer_, enabled()).WillOnce(Return(false));
+  flush_timer_->invokeCallback();
+
+  // A slow response (38ms) drags the moving average to (3 * 2ms + 38ms) / 4 = 11ms, above the
+  // budget.
+  simTime().advanceTimeWait(std::chrono::milliseconds(38));
+  Buffer::OwnedImpl fake_data2;
+  EXPECT_CALL(*decoder_, decode(Ref(fake_data2))).WillOnce(Invoke([&](Buffer::Instance&) -> void {
+    InSequence s;
+    Common::Redis::RespValuePtr response2(new Common::Redis::RespValue());
+    EXPECT_CALL(callbacks2, onResponse_(Ref(response2)));
+    EXPECT_CALL(*connect_or_op_timer_, disableTimer());
+    EXPECT_CALL(host_->outlier_detector_,
+                putResult(Upstream::Outlier::Result::ExtOriginRequestSuccess, _));
+    callbacks_->onRespValue(std::move(response2));
+  }));
+  upstream_read_filter_->onData(fake_data2, false);
+
+  // The RTT estimate now exceeds the budget, so batching cannot pay off: flush immediately.
+  Common::Redis::RespValue request3;
+  MockClientCallbacks callbacks3;
+  EXPECT_CALL(*encoder_, encode(Ref(request3), _));
+  EXPECT_CALL(*flush_timer_, enabled()).WillOnce(Return(false));
+  PoolRequest* handle3 = client_->makeRequest(request3, callbacks3);
+  EXPECT_NE(nullptr, handle3);
+
+  Buffer::OwnedImpl fake_data3;
+  EXPECT_CALL(*decoder_, decode(Ref(fake_data3))).WillOnce(Invoke([&](Buffer::Instance&) -> void {
+    InSequence s;
+    Common::Redis::RespValuePtr response3(new Common::Redis::RespValue());
+    EXPECT_CALL(callbacks3, onResponse_(Ref(response3)));
+    EXPECT_CALL(*connect_or_op_timer_, disableTimer());
+    EXPECT_CALL(host_->outlier_detector_,
+                putResult(Upstream::Outlier::Result::ExtOriginRequestSuccess, _));
+    callbacks_->onRespValue(std::move(response3));
+  }));
+  upstream_read_filter_->onData(fake_data3, false);
+
+  EXPECT_CALL(*connect_or_op_timer_, disableTimer());
+  client_->close();
+}
+
 class ConfigEnableCommandStats : public Config {
   bool disableOutlierEvents() const override { return false; }
   std::chrono::milliseconds opTimeout() const override { return std::chrono::milliseconds(25); }
@@ -348,6 +452,9 @@ class ConfigEnableCommandStats : public Config {
   std::chrono::milliseconds bufferFlushTimeoutInMs() const override {
     return std::chrono::milliseconds(0);
   }
+  absl::optional<std::chrono::milliseconds> bufferFlushLatencyBudget() const override {
+    return absl::nullopt;
+  }
   ReadPolicy readPolicy() const override { return ReadPolicy::Primary; }
   uint32_t maxUpstreamUnknownConnections() const override { return 0; }
   bool enableCommandStats() const override { return true; }
@@ -736,6 +843,9 @@ class ConfigOutlierDisabled : public Config {
   std::chrono::milliseconds bufferFlushTimeoutInMs() const override {
     return std::chrono::milliseconds(0);
   }
+  absl::optional<std::chrono::milliseconds> bufferFlushLatencyBudget() const override {
+    return absl::nullopt;
+  }
   ReadPolicy readPolicy() const override { return ReadPolicy::Primary; }
   uint32_t maxUpstreamUnknownConnections() const override { return 0; }
   bool enableCommandStats() const override { return false; }
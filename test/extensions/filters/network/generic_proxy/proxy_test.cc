@@ -358,6 +358,46 @@ TEST_F(FilterTest, RepeatedStreamIdForTwoStreams) {
   EXPECT_EQ(0, filter_->activeStreamsForTest().size());
 }
 
+TEST_F(FilterTest, BatchOfHeaderFrames) {
+  initializeFilter();
+
+  std::vector<RequestHeaderFramePtr> requests;
+  for (uint64_t i = 0; i < 3; i++) {
+    auto request = std::make_unique<FakeStreamCodecFactory::FakeRequest>();
+    request->stream_frame_flags_ = {i, FrameFlags::FLAG_EMPTY};
+    requests.push_back(std::move(request));
+  }
+
+  filter_->onDecodingSuccess(std::move(requests));
+
+  EXPECT_EQ(3, filter_->activeStreamsForTest().size());
+  EXPECT_EQ(filter_config_->stats().downstream_rq_total_.value(), 3);
+  EXPECT_EQ(filter_config_->stats().downstream_rq_active_.value(), 3);
+}
+
+TEST_F(FilterTest, BatchOfHeaderFramesStopsAfterDecodingFailure) {
+  initializeFilter();
+
+  // The second frame reuses the stream id of the first one and will trigger a decoding
+  // failure that closes the connection. The third frame should be dropped.
+  std::vector<RequestHeaderFramePtr> requests;
+  auto request_0 = std::make_unique<FakeStreamCodecFactory::FakeRequest>();
+  request_0->stream_frame_flags_ = {0, FrameFlags::FLAG_EMPTY};
+  requests.push_back(std::move(request_0));
+  auto request_1 = std::make_unique<FakeStreamCodecFactory::FakeRequest>();
+  request_1->stream_frame_flags_ = {0, FrameFlags::FLAG_EMPTY};
+  requests.push_back(std::move(request_1));
+  auto request_2 = std::make_unique<FakeStreamCodecFactory::FakeRequest>();
+  request_2->stream_frame_flags_ = {1, FrameFlags::FLAG_EMPTY};
+  requests.push_back(std::move(request_2));
+
+  EXPECT_CALL(filter_callbacks_.connection_, close(_));
+  filter_->onDecodingSuccess(std::move(requests));
+
+  EXPECT_EQ(0, filter_->activeStreamsForTest().size());
+  EXPECT_EQ(filter_config_->stats().downstream_rq_total_.value(), 1);
+}
+
 TEST_F(FilterTest, CommonFrameBeforeHeaderFrame) {
   initializeFilter();
 
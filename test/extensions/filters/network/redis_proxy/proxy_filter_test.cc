@@ -1322,6 +1322,120 @@ TEST_F(RedisProxyFilterWithExternalAuthAndExpiration, ExternalAuthError) {
   EXPECT_EQ(Network::FilterStatus::Continue, filter_->onData(fake_data, false));
 }
 
+class RedisProxyFilterWithLocalCacheTest : public RedisProxyFilterTest {
+public:
+  static constexpr const char* LocalCacheConfig = R"EOF(
+  prefix_routes:
+    catch_all_route:
+      cluster: fake_cluster
+  stat_prefix: foo
+  settings:
+    op_timeout: 0.01s
+  local_cache:
+    ttl: 5s
+    max_entries: 16
+  )EOF";
+
+  RedisProxyFilterWithLocalCacheTest() : RedisProxyFilterTest(LocalCacheConfig) {}
+
+  static Common::Redis::RespValuePtr makeBulkStringArray(const std::vector<std::string>& strings) {
+    std::vector<Common::Redis::RespValue> values(strings.size());
+    for (uint64_t i = 0; i < strings.size(); i++) {
+      values[i].type(Common::Redis::RespType::BulkString);
+      values[i].asString() = strings[i];
+    }
+    auto value = std::make_unique<Common::Redis::RespValue>();
+    value->type(Common::Redis::RespType::Array);
+    value->asArray().swap(values);
+    return value;
+  }
+
+  // Issue a GET that misses the cache and respond with a bulk string, filling the cache.
+  void getThroughSplitter(const std::string& key, const std::string& value) {
+    Buffer::OwnedImpl fake_data;
+    CommandSplitter::MockSplitRequest* request_handle = new CommandSplitter::MockSplitRequest();
+    CommandSplitter::SplitCallbacks* request_callbacks{};
+    EXPECT_CALL(*decoder_, decode(Ref(fake_data))).WillOnce(Invoke([&](Buffer::Instance&) -> void {
+      EXPECT_CALL(splitter_, makeRequest_(_, _, _, _))
+          .WillOnce(
+              DoAll(WithArg<1>(SaveArgAddress(&request_callbacks)), Return(request_handle)));
+      decoder_callbacks_->onRespValue(makeBulkStringArray({"get", key}));
+    }));
+    EXPECT_EQ(Network::FilterStatus::Continue, filter_->onData(fake_data, false));
+
+    Common::Redis::RespValuePtr response(new Common::Redis::RespValue());
+    response->type(Common::Redis::RespType::BulkString);
+    response->asString() = value;
+    EXPECT_CALL(*encoder_, encode(Eq(ByRef(*response)), _));
+    EXPECT_CALL(filter_callbacks_.connection_, write(_, _));
+    request_callbacks->onResponse(std::move(response));
+  }
+
+  // Issue a GET that is served from the cache; the splitter must not see it.
+  void getFromCache(const std::string& key, const std::string& value) {
+    Buffer::OwnedImpl fake_data;
+    Common::Redis::RespValue expected;
+    expected.type(Common::Redis::RespType::BulkString);
+    expected.asString() = value;
+    EXPECT_CALL(*decoder_, decode(Ref(fake_data))).WillOnce(Invoke([&](Buffer::Instance&) -> void {
+      EXPECT_CALL(*encoder_, encode(Eq(ByRef(expected)), _));
+      EXPECT_CALL(filter_callbacks_.connection_, write(_, _));
+      decoder_callbacks_->onRespValue(makeBulkStringArray({"GET", key}));
+    }));
+    EXPECT_EQ(Network::FilterStatus::Continue, filter_->onData(fake_data, false));
+  }
+};
+
+TEST_F(RedisProxyFilterWithLocalCacheTest, LocalCacheServesRepeatedGets) {
+  InSequence s;
+
+  getThroughSplitter("foo", "bar");
+  EXPECT_EQ(1UL, config_->stats_.downstream_rq_local_cache_miss_.value());
+
+  getFromCache("foo", "bar");
+  EXPECT_EQ(1UL, config_->stats_.downstream_rq_local_cache_hit_.value());
+  EXPECT_EQ(1UL, config_->stats_.downstream_rq_local_cache_miss_.value());
+}
+
+TEST_F(RedisProxyFilterWithLocalCacheTest, LocalCacheWriteInvalidationAndExpiry) {
+  InSequence s;
+
+  getThroughSplitter("foo", "bar");
+  getFromCache("foo", "bar");
+
+  // A write command for the key passes through the splitter and invalidates the entry.
+  {
+    Buffer::OwnedImpl fake_data;
+    CommandSplitter::MockSplitRequest* request_handle = new CommandSplitter::MockSplitRequest();
+    CommandSplitter::SplitCallbacks* request_callbacks{};
+    EXPECT_CALL(*decoder_, decode(Ref(fake_data))).WillOnce(Invoke([&](Buffer::Instance&) -> void {
+      EXPECT_CALL(splitter_, makeRequest_(_, _, _, _))
+          .WillOnce(
+              DoAll(WithArg<1>(SaveArgAddress(&request_callbacks)), Return(request_handle)));
+      decoder_callbacks_->onRespValue(makeBulkStringArray({"set", "foo", "baz"}));
+    }));
+    EXPECT_EQ(Network::FilterStatus::Continue, filter_->onData(fake_data, false));
+
+    Common::Redis::RespValuePtr response(new Common::Redis::RespValue());
+    response->type(Common::Redis::RespType::SimpleString);
+    response->asString() = "OK";
+    EXPECT_CALL(*encoder_, encode(Eq(ByRef(*response)), _));
+    EXPECT_CALL(filter_callbacks_.connection_, write(_, _));
+    request_callbacks->onResponse(std::move(response));
+  }
+
+  // The next GET misses and re-fills the cache with the new value.
+  getThroughSplitter("foo", "baz");
+  getFromCache("foo", "baz");
+
+  // Entries expire after the TTL and the key goes upstream again.
+  time_source_.advanceTimeWait(std::chrono::seconds(6));
+  getThroughSplitter("foo", "baz");
+
+  EXPECT_EQ(3UL, config_->stats_.downstream_rq_local_cache_miss_.value());
+  EXPECT_EQ(2UL, config_->stats_.downstream_rq_local_cache_hit_.value());
+}
+
 } // namespace RedisProxy
 } // namespace NetworkFilters
 } // namespace Extensions
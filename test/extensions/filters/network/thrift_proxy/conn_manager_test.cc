@@ -2416,6 +2416,114 @@ payload_passthrough: true
             "name - passthrough_enabled=true framed binary call framed binary call - 0 0 0 -\n");
 }
 
+// A filter that inspects the response direction only disables passthrough for responses: the
+// request payload is still passed through.
+TEST_F(ThriftConnectionManagerTest, PayloadPassthroughPerDirectionEncoderFilterDissents) {
+  const std::string yaml = fmt::format(R"EOF(
+stat_prefix: test
+payload_passthrough: true
+{}
+)EOF",
+                                       accessLogConfig());
+
+  initializeFilter(yaml);
+  writeFramedBinaryMessage(buffer_, MessageType::Call, 0x0F);
+
+  EXPECT_CALL(*decoder_filter_, passthroughSupported()).WillRepeatedly(Return(true));
+  EXPECT_CALL(*bidirectional_filter_, decodePassthroughSupported()).WillRepeatedly(Return(true));
+  EXPECT_CALL(*encoder_filter_, passthroughSupported()).WillRepeatedly(Return(false));
+  EXPECT_CALL(*bidirectional_filter_, encodePassthroughSupported()).WillRepeatedly(Return(true));
+
+  EXPECT_CALL(*decoder_filter_, passthroughData(_));
+  EXPECT_CALL(*bidirectional_filter_, decodePassthroughData(_));
+  EXPECT_CALL(*encoder_filter_, passthroughData(_)).Times(0);
+  EXPECT_CALL(*bidirectional_filter_, encodePassthroughData(_)).Times(0);
+
+  ThriftFilters::DecoderFilterCallbacks* callbacks{};
+  EXPECT_CALL(*decoder_filter_, setDecoderFilterCallbacks(_))
+      .WillOnce(
+          Invoke([&](ThriftFilters::DecoderFilterCallbacks& cb) -> void { callbacks = &cb; }));
+
+  EXPECT_EQ(filter_->onData(buffer_, false), Network::FilterStatus::StopIteration);
+  EXPECT_EQ(1U, store_.counter("test.request_call").value());
+
+  writeFramedBinaryMessage(write_buffer_, MessageType::Reply, 0x0F);
+
+  FramedTransportImpl transport;
+  BinaryProtocolImpl proto;
+  callbacks->startUpstreamResponse(transport, proto);
+
+  EXPECT_CALL(filter_callbacks_.connection_.dispatcher_, deferredDelete_(_));
+  EXPECT_EQ(ThriftFilters::ResponseStatus::Complete, callbacks->upstreamData(write_buffer_));
+
+  filter_callbacks_.connection_.dispatcher_.clearDeferredDeleteList();
+
+  EXPECT_EQ(1U, store_.counter("test.request").value());
+  EXPECT_EQ(1U, store_.counter("test.request_passthrough").value());
+  EXPECT_EQ(0U, stats_.request_active_.value());
+  EXPECT_EQ(1U, store_.counter("test.response").value());
+  EXPECT_EQ(1U, store_.counter("test.response_reply").value());
+  EXPECT_EQ(0U, store_.counter("test.response_passthrough").value());
+  EXPECT_EQ(1U, store_.counter("test.response_success").value());
+
+  EXPECT_EQ(access_log_data_, "name - passthrough_enabled=false framed binary call framed "
+                              "binary reply success 0 0 0 -\n");
+}
+
+// The inverse: a filter that inspects the request direction only forces a deep decode of the
+// request while the response payload is still passed through.
+TEST_F(ThriftConnectionManagerTest, PayloadPassthroughPerDirectionDecoderFilterDissents) {
+  const std::string yaml = fmt::format(R"EOF(
+stat_prefix: test
+payload_passthrough: true
+{}
+)EOF",
+                                       accessLogConfig());
+
+  initializeFilter(yaml);
+  writeFramedBinaryMessage(buffer_, MessageType::Call, 0x0F);
+
+  EXPECT_CALL(*decoder_filter_, passthroughSupported()).WillRepeatedly(Return(false));
+  EXPECT_CALL(*bidirectional_filter_, decodePassthroughSupported()).WillRepeatedly(Return(true));
+  EXPECT_CALL(*encoder_filter_, passthroughSupported()).WillRepeatedly(Return(true));
+  EXPECT_CALL(*bidirectional_filter_, encodePassthroughSupported()).WillRepeatedly(Return(true));
+
+  EXPECT_CALL(*decoder_filter_, passthroughData(_)).Times(0);
+  EXPECT_CALL(*bidirectional_filter_, decodePassthroughData(_)).Times(0);
+  EXPECT_CALL(*encoder_filter_, passthroughData(_));
+  EXPECT_CALL(*bidirectional_filter_, encodePassthroughData(_));
+
+  ThriftFilters::DecoderFilterCallbacks* callbacks{};
+  EXPECT_CALL(*decoder_filter_, setDecoderFilterCallbacks(_))
+      .WillOnce(
+          Invoke([&](ThriftFilters::DecoderFilterCallbacks& cb) -> void { callbacks = &cb; }));
+
+  EXPECT_EQ(filter_->onData(buffer_, false), Network::FilterStatus::StopIteration);
+  EXPECT_EQ(1U, store_.counter("test.request_call").value());
+
+  writeFramedBinaryMessage(write_buffer_, MessageType::Reply, 0x0F);
+
+  FramedTransportImpl transport;
+  BinaryProtocolImpl proto;
+  callbacks->startUpstreamResponse(transport, proto);
+
+  EXPECT_CALL(filter_callbacks_.connection_.dispatcher_, deferredDelete_(_));
+  EXPECT_EQ(ThriftFilters::ResponseStatus::Complete, callbacks->upstreamData(write_buffer_));
+
+  filter_callbacks_.connection_.dispatcher_.clearDeferredDeleteList();
+
+  EXPECT_EQ(1U, store_.counter("test.request").value());
+  EXPECT_EQ(0U, store_.counter("test.request_passthrough").value());
+  EXPECT_EQ(0U, stats_.request_active_.value());
+  EXPECT_EQ(1U, store_.counter("test.response").value());
+  EXPECT_EQ(1U, store_.counter("test.response_reply").value());
+  EXPECT_EQ(1U, store_.counter("test.response_passthrough").value());
+  EXPECT_EQ(1U, store_.counter("test.response_success").value());
+
+  EXPECT_EQ(access_log_data_, "name - passthrough_enabled=false framed binary call framed "
+                              "binary reply success 0 0 0 -\n");
+}
+
 TEST_F(ThriftConnectionManagerTest, PayloadPassthroughRouting) {
   const std::string yaml = R"EOF(
 transport: FRAMED
@@ -35,12 +35,13 @@ public:
       const bool enable_latency_threshold_metrics = true,
       const std::chrono::milliseconds default_latency_threshold = std::chrono::milliseconds(100),
       const LatencyThresholdOverrideList& latency_threshold_overrides =
-          LatencyThresholdOverrideList()) {
+          LatencyThresholdOverrideList(),
+      const uint32_t response_latency_sample_period = 1) {
     config_ = std::make_shared<ZooKeeperFilterConfig>(
         stat_prefix_, 1048576, enable_per_opcode_request_bytes_metrics,
         enable_per_opcode_response_bytes_metrics, enable_per_opcode_decoder_error_metrics,
         enable_latency_threshold_metrics, default_latency_threshold, latency_threshold_overrides,
-        scope_);
+        response_latency_sample_period, scope_);
     filter_ = std::make_unique<ZooKeeperFilter>(config_, time_system_);
     filter_->initializeReadFilterCallbacks(filter_callbacks_);
   }
@@ -981,6 +982,21 @@ TEST_F(ZooKeeperFilterTest, DisablePerOpcodeResponseBytesMetrics) {
   EXPECT_NE(absl::nullopt, findHistogram("test.zookeeper.connect_response_latency"));
 }
 
+TEST_F(ZooKeeperFilterTest, ResponseLatencySampling) {
+  initialize(true, true, true, true, std::chrono::milliseconds(100),
+             LatencyThresholdOverrideList(), 2);
+
+  for (int i = 0; i < 3; i++) {
+    filter_->onResponse(OpCodes::Ping, 1000, 2000, 0, std::chrono::milliseconds(5));
+  }
+
+  // Response and fast/slow counters are exact regardless of the sample period.
+  EXPECT_EQ(3UL, store_.counter("test.zookeeper.ping_resp").value());
+  EXPECT_EQ(3UL, store_.counter("test.zookeeper.ping_resp_fast").value());
+  // With a sample period of 2, only the first and the third response latency are recorded.
+  EXPECT_EQ(2UL, store_.histogramValues("test.zookeeper.ping_response_latency", false).size());
+}
+
 TEST_F(ZooKeeperFilterTest, Connect) {
   initialize();
 
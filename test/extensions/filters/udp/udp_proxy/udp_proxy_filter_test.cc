@@ -129,7 +129,11 @@ public:
     void expectWriteToUpstream(const std::string& data, int sys_errno = 0,
                                const Network::Address::Ip* local_ip = nullptr,
                                bool expect_connect = false, int connect_sys_errno = 0) {
-      EXPECT_CALL(*idle_timer_, enableTimer(parent_.config_->sessionTimeout(), nullptr));
+      // The idle timer is only armed when it is not already pending; subsequent datagrams just
+      // record the activity time.
+      if (!idle_timer_->enabled_) {
+        EXPECT_CALL(*idle_timer_, enableTimer(parent_.config_->sessionTimeout(), nullptr));
+      }
       if (expect_connect) {
         EXPECT_CALL(*socket_->io_handle_, connect(_))
             .WillOnce(Invoke([connect_sys_errno]() -> Api::SysCallIntResult {
@@ -188,7 +192,9 @@ public:
 
     void recvDataFromUpstream(const std::string& data, int recv_sys_errno = 0,
                               int send_sys_errno = 0) {
-      EXPECT_CALL(*idle_timer_, enableTimer(parent_.config_->sessionTimeout(), nullptr));
+      if (!idle_timer_->enabled_) {
+        EXPECT_CALL(*idle_timer_, enableTimer(parent_.config_->sessionTimeout(), nullptr));
+      }
 
       if (parent_.expect_gro_) {
         EXPECT_CALL(*socket_->io_handle_, supportsUdpGro());
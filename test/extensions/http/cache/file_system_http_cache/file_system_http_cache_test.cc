@@ -186,6 +186,25 @@ TEST_F(FileSystemHttpCacheTestWithNoDefaultCache, EvictsOldestFilesUntilUnderSiz
   EXPECT_EQ(cache_->stats().eviction_runs_.value(), 1);
 }
 
+TEST_F(FileSystemHttpCacheTestWithNoDefaultCache, LookupIndexIsPopulatedByScanAndEviction) {
+  const std::string file_contents = "XXXXX";
+  ConfigProto cfg = testConfig();
+  cfg.set_enable_in_memory_lookup_index(true);
+  cfg.mutable_max_cache_entry_count()->set_value(1);
+  env_.writeStringToFileForTest(absl::StrCat(cache_path_, "cache-a"), file_contents, true);
+  env_.writeStringToFileForTest(absl::StrCat(cache_path_, "cache-b"), file_contents, true);
+  cache_ = std::dynamic_pointer_cast<FileSystemHttpCache>(
+      http_cache_factory_->getCache(cacheConfig(cfg), context_));
+  // The initial scan indexes both files, then the entry count limit provokes an
+  // eviction run which removes the older file (ties broken by name) from disk and
+  // from the index.
+  waitForEvictionThreadIdle();
+  EXPECT_FALSE(Filesystem::fileSystemForTest().fileExists(absl::StrCat(cache_path_, "cache-a")));
+  EXPECT_FALSE(cache_->lookupIndex().mayContain("cache-a"));
+  EXPECT_TRUE(cache_->lookupIndex().mayContain("cache-b"));
+  EXPECT_FALSE(cache_->lookupIndex().mayContain("cache-unrelated"));
+}
+
 class FileSystemHttpCacheTest : public FileSystemCacheTestContext, public ::testing::Test {
   void SetUp() override { initCache(); }
 };
@@ -482,6 +501,49 @@ TEST_F(FileSystemHttpCacheTestWithMockFiles, FailedOpenForReadReturnsMiss) {
   EXPECT_EQ(cache_->stats().cache_hit_.value(), 0);
 }
 
+class FileSystemHttpCacheTestWithMockFilesAndLookupIndex
+    : public FileSystemHttpCacheTestWithMockFiles {
+  void SetUp() override {
+    ConfigProto cfg = testConfig();
+    cfg.set_enable_in_memory_lookup_index(true);
+    cache_ = std::dynamic_pointer_cast<FileSystemHttpCache>(
+        http_cache_factory_->getCache(cacheConfig(cfg), context_));
+    // Wait for the initial scan so the index is populated (with nothing).
+    waitForEvictionThreadIdle();
+  }
+};
+
+TEST_F(FileSystemHttpCacheTestWithMockFilesAndLookupIndex,
+       UnindexedLookupIsMissWithoutFileOperations) {
+  EXPECT_CALL(*mock_async_file_manager_, openExistingFile(_, _, _, _)).Times(0);
+  auto lookup = testLookupContext();
+  absl::Cleanup destroy_lookup([&lookup]() { lookup->onDestroy(); });
+  LookupResult result;
+  lookup->getHeaders([&](LookupResult&& r, bool /*end_stream*/) { result = std::move(r); });
+  EXPECT_EQ(result.cache_entry_status_, CacheEntryStatus::Unusable);
+  EXPECT_EQ(cache_->stats().cache_miss_.value(), 1);
+  EXPECT_EQ(cache_->stats().index_fast_misses_.value(), 1);
+  // File handle didn't get used but is expected to be closed.
+  EXPECT_OK(mock_async_file_handle_->close(nullptr, [](absl::Status) {}));
+}
+
+TEST_F(FileSystemHttpCacheTestWithMockFilesAndLookupIndex, IndexedLookupProceedsToFileOpen) {
+  cache_->lookupIndex().addFile(cache_->generateFilename(key_));
+  auto lookup = testLookupContext();
+  absl::Cleanup destroy_lookup([&lookup]() { lookup->onDestroy(); });
+  LookupResult result;
+  EXPECT_CALL(*mock_async_file_manager_, openExistingFile(_, _, _, _));
+  lookup->getHeaders([&](LookupResult&& r, bool /*end_stream*/) { result = std::move(r); });
+  mock_async_file_manager_->nextActionCompletes(
+      absl::StatusOr<AsyncFileHandle>(absl::UnknownError("Intentionally failed to open file")));
+  pumpDispatcher();
+  // File handle didn't get used but is expected to be closed.
+  EXPECT_OK(mock_async_file_handle_->close(nullptr, [](absl::Status) {}));
+  EXPECT_EQ(result.cache_entry_status_, CacheEntryStatus::Unusable);
+  EXPECT_EQ(cache_->stats().cache_miss_.value(), 1);
+  EXPECT_EQ(cache_->stats().index_fast_misses_.value(), 0);
+}
+
 TEST_F(FileSystemHttpCacheTestWithMockFiles, FailedReadOfHeaderBlockInvalidatesTheCacheEntry) {
   // Fake-add two files of size 12345, so we can validate the stats decrease of removing a file.
   cache_->trackFileAdded(12345);
@@ -0,0 +1,48 @@
+#include "source/extensions/http/cache/file_system_http_cache/lookup_index.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace HttpFilters {
+namespace Cache {
+namespace FileSystemHttpCache {
+namespace {
+
+TEST(LookupIndexTest, DisabledIndexMayContainAnything) {
+  LookupIndex index{false};
+  index.markPopulated();
+  EXPECT_TRUE(index.mayContain("cache-a"));
+  index.addFile("cache-a");
+  index.removeFile("cache-a");
+  EXPECT_TRUE(index.mayContain("cache-a"));
+}
+
+TEST(LookupIndexTest, UnpopulatedIndexMayContainAnything) {
+  LookupIndex index{true};
+  EXPECT_TRUE(index.mayContain("cache-a"));
+  index.addFile("cache-b");
+  EXPECT_TRUE(index.mayContain("cache-a"));
+}
+
+TEST(LookupIndexTest, PopulatedIndexTracksAddsAndRemoves) {
+  LookupIndex index{true};
+  index.addFile("cache-a");
+  index.markPopulated();
+  EXPECT_TRUE(index.mayContain("cache-a"));
+  EXPECT_FALSE(index.mayContain("cache-b"));
+  index.addFile("cache-b");
+  EXPECT_TRUE(index.mayContain("cache-b"));
+  index.removeFile("cache-a");
+  EXPECT_FALSE(index.mayContain("cache-a"));
+  // Removing a name that isn't present is a no-op.
+  index.removeFile("cache-c");
+  EXPECT_TRUE(index.mayContain("cache-b"));
+}
+
+} // namespace
+} // namespace FileSystemHttpCache
+} // namespace Cache
+} // namespace HttpFilters
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,170 @@
+#include "envoy/http/header_map.h"
+#include "envoy/registry/registry.h"
+
+#include "source/common/buffer/buffer_impl.h"
+#include "source/extensions/filters/http/cache/cache_entry_utils.h"
+#include "source/extensions/filters/http/cache/cache_headers_utils.h"
+#include "source/extensions/http/cache/sharded_lru_http_cache/frequency_sketch.h"
+#include "source/extensions/http/cache/sharded_lru_http_cache/sharded_lru_http_cache.h"
+
+#include "test/extensions/filters/http/cache/http_cache_implementation_test_common.h"
+#include "test/mocks/server/factory_context.h"
+#include "test/test_common/simulated_time_system.h"
+#include "test/test_common/utility.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace HttpFilters {
+namespace Cache {
+namespace {
+
+using ShardedLruHttpCache::FrequencySketch;
+
+class ShardedLruHttpCacheTestDelegate : public HttpCacheTestDelegate {
+public:
+  std::shared_ptr<HttpCache> cache() override { return cache_; }
+  bool validationEnabled() const override { return true; }
+
+private:
+  std::shared_ptr<ShardedLruHttpCache::ShardedLruHttpCache> cache_ =
+      std::make_shared<ShardedLruHttpCache::ShardedLruHttpCache>(16, 256 * 1024 * 1024);
+};
+
+INSTANTIATE_TEST_SUITE_P(ShardedLruHttpCacheTest, HttpCacheImplementationTest,
+                         testing::Values(std::make_unique<ShardedLruHttpCacheTestDelegate>),
+                         [](const testing::TestParamInfo<HttpCacheImplementationTest::ParamType>&) {
+                           return "ShardedLruHttpCache";
+                         });
+
+// Backend-specific tests for eviction, admission and body sharing, which the shared conformance
+// suite does not exercise.
+class ShardedLruEvictionTest : public testing::Test {
+protected:
+  ShardedLruEvictionTest() : vary_allow_list_({}, factory_context_) {}
+
+  LookupRequest makeLookupRequest(absl::string_view path) {
+    Http::TestRequestHeaderMapImpl request_headers{{":path", std::string(path)},
+                                                   {":method", "GET"},
+                                                   {":scheme", "https"},
+                                                   {":authority", "example.com"}};
+    return {request_headers, time_system_.systemTime(), vary_allow_list_};
+  }
+
+  bool insert(ShardedLruHttpCache::ShardedLruHttpCache& cache, absl::string_view path,
+              uint64_t body_size) {
+    auto headers = Http::createHeaderMap<Http::ResponseHeaderMapImpl>(
+        Http::TestResponseHeaderMapImpl{{":status", "200"}});
+    return cache.insert(makeLookupRequest(path).key(), std::move(headers), ResponseMetadata{},
+                        std::make_shared<const std::string>(body_size, 'a'), nullptr);
+  }
+
+  bool contains(ShardedLruHttpCache::ShardedLruHttpCache& cache, absl::string_view path) {
+    return cache.lookup(makeLookupRequest(path)).response_headers_ != nullptr;
+  }
+
+  Event::SimulatedTimeSystem time_system_;
+  testing::NiceMock<Server::Configuration::MockServerFactoryContext> factory_context_;
+  VaryAllowList vary_allow_list_;
+};
+
+TEST_F(ShardedLruEvictionTest, EvictsLeastRecentlyUsedWhenOverBudget) {
+  // A single shard so all entries compete for the same budget. Each entry is roughly 1.2 KiB
+  // (1 KiB body plus key, headers and bookkeeping overhead), so three fit and a fourth does not.
+  ShardedLruHttpCache::ShardedLruHttpCache cache(1, 4096);
+  EXPECT_TRUE(insert(cache, "/a", 1024));
+  EXPECT_TRUE(insert(cache, "/b", 1024));
+  EXPECT_TRUE(insert(cache, "/c", 1024));
+  // Touch "/a" so "/b" becomes the least recently used entry.
+  EXPECT_TRUE(contains(cache, "/a"));
+
+  EXPECT_TRUE(insert(cache, "/d", 1024));
+  EXPECT_FALSE(contains(cache, "/b"));
+  EXPECT_TRUE(contains(cache, "/a"));
+  EXPECT_TRUE(contains(cache, "/c"));
+  EXPECT_TRUE(contains(cache, "/d"));
+}
+
+TEST_F(ShardedLruEvictionTest, RejectsInsertionLargerThanShardBudget) {
+  ShardedLruHttpCache::ShardedLruHttpCache cache(1, 4096);
+  EXPECT_FALSE(insert(cache, "/too-big", 8192));
+  EXPECT_FALSE(contains(cache, "/too-big"));
+}
+
+TEST_F(ShardedLruEvictionTest, AdmissionRejectsColdNewcomerOverPopularVictim) {
+  ShardedLruHttpCache::ShardedLruHttpCache cache(1, 4096);
+  EXPECT_TRUE(insert(cache, "/popular", 1024));
+  // Build up the victim's recorded frequency well above a single access.
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_TRUE(contains(cache, "/popular"));
+  }
+  EXPECT_TRUE(insert(cache, "/b", 1024));
+  EXPECT_TRUE(insert(cache, "/c", 1024));
+
+  // "/popular" is now the LRU victim, but the cold newcomer loses the frequency comparison and
+  // is rejected instead.
+  EXPECT_FALSE(insert(cache, "/cold", 1024));
+  EXPECT_TRUE(contains(cache, "/popular"));
+  EXPECT_FALSE(contains(cache, "/cold"));
+}
+
+TEST_F(ShardedLruEvictionTest, LookupsShareOneBodyAllocation) {
+  ShardedLruHttpCache::ShardedLruHttpCache cache(1, 4096);
+  EXPECT_TRUE(insert(cache, "/a", 1024));
+  const auto first = cache.lookup(makeLookupRequest("/a"));
+  const auto second = cache.lookup(makeLookupRequest("/a"));
+  ASSERT_NE(first.body_, nullptr);
+  EXPECT_EQ(first.body_.get(), second.body_.get());
+}
+
+TEST(FrequencySketchTest, CountsAndSaturates) {
+  FrequencySketch sketch(1024);
+  const uint64_t hot = 0x1234567890abcdef;
+  const uint64_t cold = 0xfedcba0987654321;
+  EXPECT_EQ(sketch.frequency(hot), 0);
+  for (int i = 0; i < 3; ++i) {
+    sketch.record(hot);
+  }
+  EXPECT_GE(sketch.frequency(hot), 3);
+  for (int i = 0; i < 100; ++i) {
+    sketch.record(hot);
+  }
+  // 4-bit counters saturate at 15.
+  EXPECT_EQ(sketch.frequency(hot), 15);
+  EXPECT_EQ(sketch.frequency(cold), 0);
+}
+
+TEST(FrequencySketchTest, AgingHalvesCountersButKeepsOrdering) {
+  // A small capacity so the aging threshold is reached quickly.
+  FrequencySketch sketch(16);
+  const uint64_t hot = 0x1234567890abcdef;
+  const uint64_t warm = 0xfedcba0987654321;
+  for (int i = 0; i < 200; ++i) {
+    sketch.record(hot);
+    if (i % 4 == 0) {
+      sketch.record(warm);
+    }
+  }
+  // Aging has run several times, so neither counter holds its full history, but the relative
+  // popularity survives.
+  EXPECT_LT(sketch.frequency(warm), 15);
+  EXPECT_GT(sketch.frequency(hot), sketch.frequency(warm));
+}
+
+TEST(Registration, GetFactory) {
+  HttpCacheFactory* factory = Registry::FactoryRegistry<HttpCacheFactory>::getFactoryByType(
+      "envoy.extensions.http.cache.sharded_lru_http_cache.v3.ShardedLruHttpCacheConfig");
+  ASSERT_NE(factory, nullptr);
+  envoy::extensions::filters::http::cache::v3::CacheConfig config;
+  testing::NiceMock<Server::Configuration::MockFactoryContext> factory_context;
+  config.mutable_typed_config()->PackFrom(*factory->createEmptyConfigProto());
+  EXPECT_EQ(factory->getCache(config, factory_context)->cacheInfo().name_,
+            "envoy.extensions.http.cache.sharded_lru");
+}
+
+} // namespace
+} // namespace Cache
+} // namespace HttpFilters
+} // namespace Extensions
+} // namespace Envoy
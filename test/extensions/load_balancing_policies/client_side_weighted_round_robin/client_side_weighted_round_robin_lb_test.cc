@@ -52,7 +52,9 @@ public:
   getUtilizationFromOrcaReport(const xds::data::orca::v3::OrcaLoadReport& orca_load_report,
                                const std::vector<std::string>& utilization_from_metric_names) {
     return ClientSideWeightedRoundRobinLoadBalancer::OrcaLoadReportHandler::
-        getUtilizationFromOrcaReport(orca_load_report, utilization_from_metric_names);
+        getUtilizationFromOrcaReport(orca_load_report,
+                                     Orca::parseLoadReportMetricNames(
+                                         utilization_from_metric_names));
   }
 
   static absl::StatusOr<uint32_t>
@@ -60,7 +62,9 @@ public:
                                 const std::vector<std::string>& utilization_from_metric_names,
                                 double error_utilization_penalty) {
     return ClientSideWeightedRoundRobinLoadBalancer::OrcaLoadReportHandler::
-        calculateWeightFromOrcaReport(orca_load_report, utilization_from_metric_names,
+        calculateWeightFromOrcaReport(orca_load_report,
+                                      Orca::parseLoadReportMetricNames(
+                                          utilization_from_metric_names),
                                       error_utilization_penalty);
   }
 
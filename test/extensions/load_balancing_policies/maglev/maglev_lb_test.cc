@@ -18,6 +18,17 @@
 
 namespace Envoy {
 namespace Upstream {
+
+// Peer for poking at the private table caching internals.
+class MaglevLoadBalancerTestPeer {
+public:
+  static ThreadAwareLoadBalancerBase::HashingLoadBalancerSharedPtr
+  createTable(MaglevLoadBalancer& lb, const NormalizedHostWeightVector& normalized_host_weights,
+              double max_normalized_weight) {
+    return lb.createLoadBalancer(normalized_host_weights, 0.0, max_normalized_weight);
+  }
+};
+
 namespace {
 
 class TestLoadBalancerContext : public LoadBalancerContextBase {
@@ -127,6 +138,26 @@ TEST_F(MaglevLoadBalancerTest, DefaultMaglevTableSize) {
   EXPECT_EQ(defaultValue, lb_->tableSize());
 };
 
+// A rebuild with identical inputs reuses the previously built table; changed inputs build a new
+// one.
+TEST_F(MaglevLoadBalancerTest, TableReusedWhenBuildInputsUnchanged) {
+  host_set_.hosts_ = {makeTestHost(info_, "tcp://127.0.0.1:90", simTime()),
+                      makeTestHost(info_, "tcp://127.0.0.1:91", simTime())};
+  host_set_.healthy_hosts_ = host_set_.hosts_;
+  host_set_.runCallbacks({}, {});
+  init(7);
+
+  const NormalizedHostWeightVector weights{{host_set_.hosts_[0], 0.5}, {host_set_.hosts_[1], 0.5}};
+  const auto table1 = MaglevLoadBalancerTestPeer::createTable(*lb_, weights, 0.5);
+  const auto table2 = MaglevLoadBalancerTestPeer::createTable(*lb_, weights, 0.5);
+  EXPECT_EQ(table1, table2);
+
+  const NormalizedHostWeightVector changed_weights{{host_set_.hosts_[0], 0.25},
+                                                   {host_set_.hosts_[1], 0.75}};
+  const auto table3 = MaglevLoadBalancerTestPeer::createTable(*lb_, changed_weights, 0.75);
+  EXPECT_NE(table1, table3);
+}
+
 // Basic sanity tests.
 TEST_F(MaglevLoadBalancerTest, Basic) {
   host_set_.hosts_ = {makeTestHost(info_, "tcp://127.0.0.1:90", simTime()),
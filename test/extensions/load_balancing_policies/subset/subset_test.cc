@@ -928,6 +928,47 @@ TEST_F(SubsetLoadBalancerTest, BalancesSubset) {
   EXPECT_EQ(4U, stats_.lb_subsets_selected_.value());
 }
 
+TEST_P(SubsetLoadBalancerTest, BalancesSubsetWithMatchCache) {
+  ON_CALL(runtime_.snapshot_, getInteger("upstream.subset_lb.match_cache_max_entries", 0))
+      .WillByDefault(Return(100));
+  EXPECT_CALL(subset_info_, fallbackPolicy())
+      .WillRepeatedly(Return(envoy::config::cluster::v3::Cluster::LbSubsetConfig::NO_FALLBACK));
+
+  std::vector<SubsetSelectorPtr> subset_selectors = {makeSelector(
+      {"version"},
+      envoy::config::cluster::v3::Cluster::LbSubsetConfig::LbSubsetSelector::NOT_DEFINED)};
+
+  EXPECT_CALL(subset_info_, subsetSelectors()).WillRepeatedly(ReturnRef(subset_selectors));
+
+  init({
+      {"tcp://127.0.0.1:80", {{"version", "1.0"}}},
+      {"tcp://127.0.0.1:81", {{"version", "1.0"}}},
+      {"tcp://127.0.0.1:82", {{"version", "1.1"}}},
+      {"tcp://127.0.0.1:83", {{"version", "1.1"}}},
+  });
+
+  TestLoadBalancerContext context_10({{"version", "1.0"}});
+  TestLoadBalancerContext context_11({{"version", "1.1"}});
+
+  // The first pick for each distinct criteria walks the subset trie; repeated picks are resolved
+  // from the match cache.
+  EXPECT_EQ(host_set_.hosts_[0], lb_->chooseHost(&context_10));
+  EXPECT_EQ(host_set_.hosts_[2], lb_->chooseHost(&context_11));
+  EXPECT_EQ(host_set_.hosts_[1], lb_->chooseHost(&context_10));
+  EXPECT_EQ(host_set_.hosts_[3], lb_->chooseHost(&context_11));
+  EXPECT_EQ(4U, stats_.lb_subsets_selected_.value());
+  EXPECT_EQ(2U, stats_.lb_subsets_match_cache_hit_.value());
+
+  // Host updates invalidate cached lookups, so the next pick per criteria walks the rebuilt
+  // subsets again before the cache warms back up.
+  modifyHosts({makeHost("tcp://127.0.0.1:84", {{"version", "1.0"}})}, {host_set_.hosts_[2]});
+
+  EXPECT_NE(nullptr, lb_->chooseHost(&context_10));
+  EXPECT_EQ(2U, stats_.lb_subsets_match_cache_hit_.value());
+  EXPECT_NE(nullptr, lb_->chooseHost(&context_10));
+  EXPECT_EQ(3U, stats_.lb_subsets_match_cache_hit_.value());
+}
+
 TEST_P(SubsetLoadBalancerTest, BalancesSubsetAfterUpdate) {
   EXPECT_CALL(subset_info_, fallbackPolicy())
       .WillRepeatedly(Return(envoy::config::cluster::v3::Cluster::LbSubsetConfig::NO_FALLBACK));
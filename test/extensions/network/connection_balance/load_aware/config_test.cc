@@ -0,0 +1,56 @@
+#include "envoy/config/core/v3/extension.pb.h"
+#include "envoy/extensions/network/connection_balance/load_aware/v3/load_aware.pb.h"
+#include "envoy/registry/registry.h"
+
+#include "source/extensions/network/connection_balance/load_aware/config.h"
+
+#include "test/mocks/server/factory_context.h"
+#include "test/test_common/utility.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace LoadAware {
+namespace {
+
+envoy::config::core::v3::TypedExtensionConfig makeTypedConfig(uint64_t reference_ms) {
+  envoy::extensions::network::connection_balance::load_aware::v3::LoadAwareConfig config;
+  config.mutable_delay_cost_reference()->set_nanos(static_cast<int32_t>(reference_ms) * 1000000);
+  envoy::config::core::v3::TypedExtensionConfig typed_config;
+  typed_config.set_name("envoy.network.connection_balance.load_aware");
+  typed_config.mutable_typed_config()->PackFrom(config);
+  return typed_config;
+}
+
+TEST(LoadAwareConnectionBalanceFactoryTest, CreateBalancer) {
+  auto factory = Registry::FactoryRegistry<Network::ConnectionBalanceFactory>::getFactory(
+      "envoy.network.connection_balance.load_aware");
+  ASSERT_NE(factory, nullptr);
+
+  testing::NiceMock<Server::Configuration::MockFactoryContext> context;
+  auto balancer = factory->createConnectionBalancerFromProto(makeTypedConfig(100), context);
+  EXPECT_NE(balancer, nullptr);
+}
+
+TEST(LoadAwareConnectionBalanceFactoryTest, RejectsSubMillisecondReference) {
+  auto factory = Registry::FactoryRegistry<Network::ConnectionBalanceFactory>::getFactory(
+      "envoy.network.connection_balance.load_aware");
+  ASSERT_NE(factory, nullptr);
+
+  envoy::extensions::network::connection_balance::load_aware::v3::LoadAwareConfig config;
+  config.mutable_delay_cost_reference()->set_nanos(1000);
+  envoy::config::core::v3::TypedExtensionConfig typed_config;
+  typed_config.set_name("envoy.network.connection_balance.load_aware");
+  typed_config.mutable_typed_config()->PackFrom(config);
+
+  testing::NiceMock<Server::Configuration::MockFactoryContext> context;
+  EXPECT_THROW_WITH_MESSAGE(
+      factory->createConnectionBalancerFromProto(typed_config, context), EnvoyException,
+      "load aware connection balancer: delay_cost_reference must be at least 1ms");
+}
+
+} // namespace
+} // namespace LoadAware
+} // namespace Extensions
+} // namespace Envoy
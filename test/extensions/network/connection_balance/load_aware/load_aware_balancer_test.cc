@@ -0,0 +1,93 @@
+#include <chrono>
+
+#include "source/extensions/network/connection_balance/load_aware/load_aware_balancer.h"
+
+#include "test/test_common/simulated_time_system.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace LoadAware {
+namespace {
+
+class FakeBalancedHandler : public Network::BalancedConnectionHandler {
+public:
+  FakeBalancedHandler(uint64_t connections, std::chrono::milliseconds loop_delay)
+      : connections_(connections), loop_delay_(loop_delay) {}
+
+  // Network::BalancedConnectionHandler
+  uint64_t numConnections() const override { return connections_; }
+  void incNumConnections() override { ++connections_; }
+  void post(Network::ConnectionSocketPtr&&) override {}
+  void onAcceptWorker(Network::ConnectionSocketPtr&&, bool, bool) override {}
+  MonotonicTime::duration timeSinceLastLoopActivity(MonotonicTime) const override {
+    return loop_delay_;
+  }
+
+  uint64_t connections_;
+  std::chrono::milliseconds loop_delay_;
+};
+
+class LoadAwareConnectionBalancerTest : public testing::Test {
+protected:
+  LoadAwareConnectionBalancerTest() : balancer_(std::chrono::milliseconds(100), time_system_) {}
+
+  Event::SimulatedTimeSystem time_system_;
+  LoadAwareConnectionBalancerImpl balancer_;
+};
+
+// With all workers responsive the balancer degenerates to exact balancing.
+TEST_F(LoadAwareConnectionBalancerTest, PrefersFewestConnectionsWhenLoopsResponsive) {
+  FakeBalancedHandler handler1(2, std::chrono::milliseconds(0));
+  FakeBalancedHandler handler2(5, std::chrono::milliseconds(0));
+  FakeBalancedHandler handler3(1, std::chrono::milliseconds(0));
+  balancer_.registerHandler(handler1);
+  balancer_.registerHandler(handler2);
+  balancer_.registerHandler(handler3);
+
+  EXPECT_EQ(&handler3, &balancer_.pickTargetHandler(handler1));
+  // The balancer must account for the incoming connection on the picked handler.
+  EXPECT_EQ(2, handler3.numConnections());
+}
+
+// A stalled worker's connections are charged more, so a responsive worker is preferred even
+// though it has more connections.
+TEST_F(LoadAwareConnectionBalancerTest, StalledWorkerChargedMoreForItsConnections) {
+  // Scores with a 100ms reference: (1 + 1) * (1 + 200/100) = 6 vs. (3 + 1) * 1 = 4.
+  FakeBalancedHandler stalled(1, std::chrono::milliseconds(200));
+  FakeBalancedHandler responsive(3, std::chrono::milliseconds(0));
+  balancer_.registerHandler(stalled);
+  balancer_.registerHandler(responsive);
+
+  EXPECT_EQ(&responsive, &balancer_.pickTargetHandler(stalled));
+  EXPECT_EQ(4, responsive.numConnections());
+}
+
+// A stalled worker is not excluded outright: once the responsive workers hold enough
+// connections, the stalled worker becomes the cheaper choice again.
+TEST_F(LoadAwareConnectionBalancerTest, StalledWorkerStillUsable) {
+  // Scores with a 100ms reference: (0 + 1) * (1 + 200/100) = 3 vs. (9 + 1) * 1 = 10.
+  FakeBalancedHandler stalled(0, std::chrono::milliseconds(200));
+  FakeBalancedHandler responsive(9, std::chrono::milliseconds(0));
+  balancer_.registerHandler(stalled);
+  balancer_.registerHandler(responsive);
+
+  EXPECT_EQ(&stalled, &balancer_.pickTargetHandler(responsive));
+  EXPECT_EQ(1, stalled.numConnections());
+}
+
+TEST_F(LoadAwareConnectionBalancerTest, UnregisteredHandlerNotPicked) {
+  FakeBalancedHandler handler1(0, std::chrono::milliseconds(0));
+  FakeBalancedHandler handler2(5, std::chrono::milliseconds(0));
+  balancer_.registerHandler(handler1);
+  balancer_.registerHandler(handler2);
+  balancer_.unregisterHandler(handler1);
+
+  EXPECT_EQ(&handler2, &balancer_.pickTargetHandler(handler2));
+}
+
+} // namespace
+} // namespace LoadAware
+} // namespace Extensions
+} // namespace Envoy
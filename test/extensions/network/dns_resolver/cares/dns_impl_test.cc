@@ -403,6 +403,7 @@ public:
   DnsResolverImplPeer(DnsResolverImpl* resolver) : resolver_(resolver) {}
 
   ares_channel channel() const { return resolver_->channel_; }
+  const std::vector<ares_channel>& extraChannels() const { return resolver_->extra_channels_; }
   bool isChannelDirty() const { return resolver_->dirty_channel_; }
   const absl::node_hash_map<int, Event::FileEventPtr>& events() { return resolver_->events_; }
   // Reset the channel state for a DnsResolverImpl such that it will only use
@@ -723,6 +724,7 @@ public:
 
     cares.set_filter_unroutable_families(filterUnroutableFamilies());
     cares.set_allocated_udp_max_queries(udpMaxQueries());
+    cares.set_allocated_query_channels(queryChannels());
 
     // Copy over the dns_resolver_options_.
     cares.mutable_dns_resolver_options()->MergeFrom(dns_resolver_options);
@@ -772,6 +774,10 @@ public:
     }
     ares_set_servers_ports_csv(
         peer_->channel(), socket_->connectionInfoProvider().localAddress()->asString().c_str());
+    for (ares_channel extra : peer_->extraChannels()) {
+      ares_set_servers_ports_csv(
+          extra, socket_->connectionInfoProvider().localAddress()->asString().c_str());
+    }
   }
 
   void TearDown() override {
@@ -963,6 +969,7 @@ protected:
   virtual bool setResolverInConstructor() const { return false; }
   virtual bool filterUnroutableFamilies() const { return false; }
   virtual ProtobufWkt::UInt32Value* udpMaxQueries() const { return 0; }
+  virtual ProtobufWkt::UInt32Value* queryChannels() const { return 0; }
   Stats::TestUtil::TestStore stats_store_;
   NiceMock<Runtime::MockLoader> runtime_;
   std::unique_ptr<TestDnsServer> server_;
@@ -2135,5 +2142,45 @@ TEST_P(DnsImplAresFlagsForMaxUdpQueriesinTest, UdpMaxQueriesIsSet) {
   ares_destroy_options(&opts);
 }
 
+class DnsImplQueryChannelsTest : public DnsImplTest {
+protected:
+  bool tcpOnly() const override { return false; }
+  void updateDnsResolverOptions() override {
+    dns_resolver_options_.set_use_tcp_for_dns_lookups(true);
+  }
+  bool setResolverInConstructor() const override { return true; }
+  ProtobufWkt::UInt32Value* queryChannels() const override {
+    auto query_channels = std::make_unique<ProtobufWkt::UInt32Value>();
+    query_channels->set_value(4);
+    return dynamic_cast<ProtobufWkt::UInt32Value*>(query_channels.release());
+  }
+};
+
+// Parameterize the DNS test server socket address.
+INSTANTIATE_TEST_SUITE_P(IpVersions, DnsImplQueryChannelsTest,
+                         testing::ValuesIn(TestEnvironment::getIpVersionsForTest()),
+                         TestUtility::ipTestParamsToString);
+
+// Validate that when `query_channels` is greater than one the extra channels are created, all
+// point at the configured resolver, and hostnames sharded across them resolve correctly.
+TEST_P(DnsImplQueryChannelsTest, HostnamesShardedAcrossChannels) {
+  ASSERT_EQ(3U, peer_->extraChannels().size());
+
+  const std::vector<std::string> hosts = {"a.some.domain", "b.some.domain", "c.some.domain",
+                                          "d.some.domain", "e.some.domain", "f.some.domain"};
+  for (size_t i = 0; i < hosts.size(); i++) {
+    server_->addHosts(hosts[i], {fmt::format("201.134.56.{}", i + 1)}, RecordType::A);
+  }
+  for (size_t i = 0; i < hosts.size(); i++) {
+    EXPECT_NE(nullptr, resolveWithExpectations(
+                           hosts[i], DnsLookupFamily::V4Only,
+                           DnsResolver::ResolutionStatus::Completed,
+                           {fmt::format("201.134.56.{}", i + 1)}, {}, absl::nullopt));
+    dispatcher_->run(Event::Dispatcher::RunType::Block);
+  }
+  checkStats(6 /*resolve_total*/, 0 /*pending_resolutions*/, 0 /*not_found*/,
+             0 /*get_addr_failure*/, 0 /*timeouts*/);
+}
+
 } // namespace Network
 } // namespace Envoy
@@ -0,0 +1,59 @@
+#include "envoy/extensions/resource_monitors/worker_saturation/v3/worker_saturation.pb.h"
+#include "envoy/registry/registry.h"
+
+#include "source/extensions/resource_monitors/worker_saturation/config.h"
+#include "source/server/resource_monitor_config_impl.h"
+
+#include "test/mocks/event/mocks.h"
+#include "test/mocks/server/options.h"
+#include "test/test_common/utility.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace ResourceMonitors {
+namespace WorkerSaturationMonitor {
+namespace {
+
+TEST(WorkerSaturationMonitorFactoryTest, CreateMonitor) {
+  auto factory =
+      Registry::FactoryRegistry<Server::Configuration::ResourceMonitorFactory>::getFactory(
+          "envoy.resource_monitors.worker_saturation");
+  EXPECT_NE(factory, nullptr);
+
+  envoy::extensions::resource_monitors::worker_saturation::v3::WorkerSaturationConfig config;
+  config.mutable_saturation_loop_delay()->set_nanos(500 * 1000 * 1000);
+  Event::MockDispatcher dispatcher;
+  Api::ApiPtr api = Api::createApiForTest();
+  Server::MockOptions options;
+  Server::Configuration::ResourceMonitorFactoryContextImpl context(
+      dispatcher, options, *api, ProtobufMessage::getStrictValidationVisitor());
+  auto monitor = factory->createResourceMonitor(config, context);
+  EXPECT_NE(monitor, nullptr);
+}
+
+TEST(WorkerSaturationMonitorFactoryTest, RejectsInvertedDelays) {
+  auto factory =
+      Registry::FactoryRegistry<Server::Configuration::ResourceMonitorFactory>::getFactory(
+          "envoy.resource_monitors.worker_saturation");
+  EXPECT_NE(factory, nullptr);
+
+  envoy::extensions::resource_monitors::worker_saturation::v3::WorkerSaturationConfig config;
+  config.mutable_saturation_loop_delay()->set_nanos(100 * 1000 * 1000);
+  config.mutable_min_loop_delay()->set_nanos(200 * 1000 * 1000);
+  Event::MockDispatcher dispatcher;
+  Api::ApiPtr api = Api::createApiForTest();
+  Server::MockOptions options;
+  Server::Configuration::ResourceMonitorFactoryContextImpl context(
+      dispatcher, options, *api, ProtobufMessage::getStrictValidationVisitor());
+  EXPECT_THROW_WITH_MESSAGE(factory->createResourceMonitor(config, context), EnvoyException,
+                            "worker saturation monitor: saturation_loop_delay (100ms) must be "
+                            "greater than min_loop_delay (200ms)");
+}
+
+} // namespace
+} // namespace WorkerSaturationMonitor
+} // namespace ResourceMonitors
+} // namespace Extensions
+} // namespace Envoy
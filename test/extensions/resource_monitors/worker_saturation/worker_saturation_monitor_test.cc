@@ -0,0 +1,126 @@
+#include "envoy/extensions/resource_monitors/worker_saturation/v3/worker_saturation.pb.h"
+
+#include "source/common/event/loop_liveness_registry.h"
+#include "source/extensions/resource_monitors/worker_saturation/worker_saturation_monitor.h"
+
+#include "test/test_common/simulated_time_system.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace ResourceMonitors {
+namespace WorkerSaturationMonitor {
+namespace {
+
+class ResourcePressure : public Server::ResourceUpdateCallbacks {
+public:
+  void onSuccess(const Server::ResourceUsage& usage) override {
+    pressure_ = usage.resource_pressure_;
+  }
+
+  void onFailure(const EnvoyException& error) override { error_ = error; }
+
+  bool hasPressure() const { return pressure_.has_value(); }
+  bool hasError() const { return error_.has_value(); }
+  double pressure() const { return *pressure_; }
+
+private:
+  absl::optional<double> pressure_;
+  absl::optional<EnvoyException> error_;
+};
+
+class WorkerSaturationMonitorTest : public testing::Test {
+protected:
+  WorkerSaturationMonitor makeMonitor(uint64_t saturation_ms, uint64_t min_ms = 0) {
+    envoy::extensions::resource_monitors::worker_saturation::v3::WorkerSaturationConfig config;
+    config.mutable_saturation_loop_delay()->set_nanos(static_cast<int32_t>(saturation_ms) *
+                                                      1000000);
+    if (min_ms != 0) {
+      config.mutable_min_loop_delay()->set_nanos(static_cast<int32_t>(min_ms) * 1000000);
+    }
+    return {config, time_system_};
+  }
+
+  Event::SimulatedTimeSystem time_system_;
+};
+
+TEST_F(WorkerSaturationMonitorTest, NoRegisteredLoopsReportsZero) {
+  WorkerSaturationMonitor monitor = makeMonitor(500);
+  ResourcePressure resource;
+  monitor.updateResourceUsage(resource);
+  ASSERT_TRUE(resource.hasPressure());
+  EXPECT_EQ(0.0, resource.pressure());
+}
+
+TEST_F(WorkerSaturationMonitorTest, PressureTracksWorstLoopDelay) {
+  WorkerSaturationMonitor monitor = makeMonitor(500);
+  auto& registry = Event::LoopLivenessRegistry::instance();
+  Event::LoopLivenessRegistry::SlotPtr responsive =
+      registry.add("worker_0", time_system_.monotonicTime());
+  Event::LoopLivenessRegistry::SlotPtr stalled =
+      registry.add("worker_1", time_system_.monotonicTime());
+
+  time_system_.advanceTimeWait(std::chrono::milliseconds(250));
+  responsive->record(time_system_.monotonicTime());
+
+  // The stalled loop is 250ms behind, half of the 500ms saturation delay.
+  ResourcePressure resource;
+  monitor.updateResourceUsage(resource);
+  ASSERT_TRUE(resource.hasPressure());
+  EXPECT_DOUBLE_EQ(0.5, resource.pressure());
+
+  // Once both loops catch up, the pressure drops back to zero.
+  stalled->record(time_system_.monotonicTime());
+  responsive->record(time_system_.monotonicTime());
+  monitor.updateResourceUsage(resource);
+  EXPECT_EQ(0.0, resource.pressure());
+}
+
+TEST_F(WorkerSaturationMonitorTest, PressureSaturatesAtOne) {
+  WorkerSaturationMonitor monitor = makeMonitor(500);
+  Event::LoopLivenessRegistry::SlotPtr slot =
+      Event::LoopLivenessRegistry::instance().add("worker_0", time_system_.monotonicTime());
+
+  time_system_.advanceTimeWait(std::chrono::seconds(5));
+  ResourcePressure resource;
+  monitor.updateResourceUsage(resource);
+  ASSERT_TRUE(resource.hasPressure());
+  EXPECT_EQ(1.0, resource.pressure());
+}
+
+TEST_F(WorkerSaturationMonitorTest, DelaysBelowMinReportZero) {
+  WorkerSaturationMonitor monitor = makeMonitor(500, 100);
+  Event::LoopLivenessRegistry::SlotPtr slot =
+      Event::LoopLivenessRegistry::instance().add("worker_0", time_system_.monotonicTime());
+
+  time_system_.advanceTimeWait(std::chrono::milliseconds(100));
+  ResourcePressure resource;
+  monitor.updateResourceUsage(resource);
+  ASSERT_TRUE(resource.hasPressure());
+  EXPECT_EQ(0.0, resource.pressure());
+
+  // Pressure ramps over the [min, saturation] range: 300ms is halfway between 100ms and 500ms.
+  time_system_.advanceTimeWait(std::chrono::milliseconds(200));
+  monitor.updateResourceUsage(resource);
+  EXPECT_DOUBLE_EQ(0.5, resource.pressure());
+}
+
+TEST_F(WorkerSaturationMonitorTest, DeregisteredLoopIsIgnored) {
+  WorkerSaturationMonitor monitor = makeMonitor(500);
+  {
+    Event::LoopLivenessRegistry::SlotPtr slot =
+        Event::LoopLivenessRegistry::instance().add("worker_0", time_system_.monotonicTime());
+    time_system_.advanceTimeWait(std::chrono::seconds(5));
+  }
+  ResourcePressure resource;
+  monitor.updateResourceUsage(resource);
+  ASSERT_TRUE(resource.hasPressure());
+  EXPECT_EQ(0.0, resource.pressure());
+}
+
+} // namespace
+} // namespace WorkerSaturationMonitor
+} // namespace ResourceMonitors
+} // namespace Extensions
+} // namespace Envoy
@@ -83,6 +83,8 @@ public:
   MOCK_METHOD(SysCallSizeResult, readv, (os_fd_t, const iovec*, int));
   MOCK_METHOD(SysCallSizeResult, pwrite,
               (os_fd_t fd, const void* buffer, size_t length, off_t offset), (const));
+  MOCK_METHOD(SysCallSizeResult, pwritev, (os_fd_t fd, const iovec* iov, int num_iov, off_t offset),
+              (const));
   MOCK_METHOD(SysCallSizeResult, pread, (os_fd_t fd, void* buffer, size_t length, off_t offset),
               (const));
   MOCK_METHOD(SysCallSizeResult, send, (os_fd_t socket, void* buffer, size_t length, int flags));
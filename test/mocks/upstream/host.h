@@ -84,6 +84,8 @@ public:
 
   MOCK_METHOD(Network::Address::InstanceConstSharedPtr, address, (), (const));
   MOCK_METHOD(SharedConstAddressVector, addressListOrNull, (), (const));
+  MOCK_METHOD(Network::Address::InstanceConstSharedPtr, lastSuccessfulAddress, (), (const));
+  MOCK_METHOD(void, setLastSuccessfulAddress, (Network::Address::InstanceConstSharedPtr), (const));
   MOCK_METHOD(Network::Address::InstanceConstSharedPtr, healthCheckAddress, (), (const));
   MOCK_METHOD(bool, canary, (), (const));
   MOCK_METHOD(void, canary, (bool new_canary));
@@ -162,6 +164,8 @@ public:
 
   MOCK_METHOD(Network::Address::InstanceConstSharedPtr, address, (), (const));
   MOCK_METHOD(SharedConstAddressVector, addressListOrNull, (), (const));
+  MOCK_METHOD(Network::Address::InstanceConstSharedPtr, lastSuccessfulAddress, (), (const));
+  MOCK_METHOD(void, setLastSuccessfulAddress, (Network::Address::InstanceConstSharedPtr), (const));
   MOCK_METHOD(Network::Address::InstanceConstSharedPtr, healthCheckAddress, (), (const));
   MOCK_METHOD(bool, canary, (), (const));
   MOCK_METHOD(void, canary, (bool new_canary));
@@ -176,8 +180,7 @@ public:
               (Event::Dispatcher & dispatcher,
                const Network::ConnectionSocket::OptionsSharedPtr& options),
               (const));
-  MOCK_METHOD((std::vector<std::pair<absl::string_view, Stats::PrimitiveGaugeReference>>), gauges,
-              (), (const));
+  MOCK_METHOD((std::vector<std::pair<absl::string_view, uint64_t>>), gauges, (), (const));
   MOCK_METHOD(HealthCheckHostMonitor&, healthChecker, (), (const));
   MOCK_METHOD(void, healthFlagClear, (HealthFlag flag));
   MOCK_METHOD(bool, healthFlagGet, (HealthFlag flag), (const));
@@ -154,6 +154,8 @@ TEST_P(AdminInstanceTest, Help) {
   /contention: dump current Envoy mutex contention stats (if enabled)
   /cpuprofiler (POST): enable/disable the CPU profiler
       enable: enables the CPU profiler; One of (y, n)
+      seconds: duration after which the profiler is automatically stopped; requires enable=y
+  /cpuprofiler_output: download the most recently captured CPU profile
   /drain_listeners (POST): drain listeners
       graceful: When draining listeners, enter a graceful drain period prior to closing listeners. This behaviour and duration is configurable via server options or CLI
       skip_exit: When draining listeners, do not exit after the drain period. This must be used with graceful
@@ -65,13 +65,9 @@ TEST_P(AdminInstanceTest, ClustersJsonAndText) {
       {"rest_counter", rest_counter},
       {"test_counter", test_counter},
   };
-  Stats::PrimitiveGauge test_gauge;
-  test_gauge.set(11);
-  Stats::PrimitiveGauge atest_gauge;
-  atest_gauge.set(10);
-  std::vector<std::pair<absl::string_view, Stats::PrimitiveGaugeReference>> gauges = {
-      {"atest_gauge", atest_gauge},
-      {"test_gauge", test_gauge},
+  std::vector<std::pair<absl::string_view, uint64_t>> gauges = {
+      {"atest_gauge", 10},
+      {"test_gauge", 11},
   };
   ON_CALL(*host, counters()).WillByDefault(Invoke([&counters]() { return counters; }));
   ON_CALL(*host, gauges()).WillByDefault(Invoke([&gauges]() { return gauges; }));
@@ -29,6 +29,35 @@ TEST_P(AdminInstanceTest, AdminCpuProfiler) {
   EXPECT_FALSE(Profiler::Cpu::profilerEnabled());
 }
 
+TEST_P(AdminInstanceTest, AdminCpuProfilerBadSeconds) {
+  Buffer::OwnedImpl data;
+  Http::TestResponseHeaderMapImpl header_map;
+
+  // The seconds parameter is validated before the profiler is touched, so these are rejected
+  // whether or not a real profiler is linked in.
+  EXPECT_EQ(Http::Code::BadRequest,
+            postCallback("/cpuprofiler?enable=y&seconds=0", header_map, data));
+  EXPECT_EQ(Http::Code::BadRequest,
+            postCallback("/cpuprofiler?enable=y&seconds=bogus", header_map, data));
+  EXPECT_EQ(Http::Code::BadRequest,
+            postCallback("/cpuprofiler?enable=y&seconds=100000", header_map, data));
+  EXPECT_EQ(Http::Code::BadRequest,
+            postCallback("/cpuprofiler?enable=n&seconds=5", header_map, data));
+  EXPECT_FALSE(Profiler::Cpu::profilerEnabled());
+}
+
+TEST_P(AdminInstanceTest, AdminCpuProfilerOutputMissing) {
+  Buffer::OwnedImpl data;
+  AdminImpl admin_bad_profile_path(TestEnvironment::temporaryPath("some/unlikely/bad/path.prof"),
+                                   server_, false);
+  Http::TestResponseHeaderMapImpl header_map;
+  request_headers_.setMethod(Http::Headers::get().MethodValues.Get);
+  request_headers_.setPath("/cpuprofiler_output");
+  admin_filter_.decodeHeaders(request_headers_, false);
+  EXPECT_EQ(Http::Code::NotFound,
+            admin_bad_profile_path.runCallback(header_map, data, admin_filter_));
+}
+
 TEST_P(AdminInstanceTest, AdminHeapProfilerOnRepeatedRequest) {
   Buffer::OwnedImpl data;
   Http::TestResponseHeaderMapImpl header_map;
@@ -0,0 +1,172 @@
+#include <memory>
+
+#include "source/common/buffer/buffer_impl.h"
+#include "source/common/stats/custom_stat_namespaces_impl.h"
+#include "source/common/stats/thread_local_store.h"
+#include "source/server/admin/prometheus_stats_request.h"
+
+#include "test/mocks/event/mocks.h"
+#include "test/mocks/stats/mocks.h"
+#include "test/mocks/thread_local/mocks.h"
+#include "test/mocks/upstream/cluster_manager.h"
+#include "test/test_common/stats_utility.h"
+#include "test/test_common/utility.h"
+
+#include "gtest/gtest.h"
+
+using testing::HasSubstr;
+using testing::NiceMock;
+using testing::Not;
+using testing::StartsWith;
+
+namespace Envoy {
+namespace Server {
+
+class PrometheusStatsRequestTest : public testing::Test {
+protected:
+  PrometheusStatsRequestTest() : pool_(symbol_table_), alloc_(symbol_table_), store_(alloc_) {
+    store_.addSink(sink_);
+    store_.initializeThreading(main_thread_dispatcher_, tls_);
+  }
+
+  ~PrometheusStatsRequestTest() override {
+    tls_.shutdownGlobalThreading();
+    store_.shutdownThreading();
+    tls_.shutdownThread();
+  }
+
+  std::unique_ptr<PrometheusStatsRequest> makeRequest(
+      bool used_only = false, bool text_readouts = false,
+      Utility::HistogramBucketsMode histogram_buckets_mode = Utility::HistogramBucketsMode::Unset) {
+    StatsParams params;
+    params.used_only_ = used_only;
+    params.prometheus_text_readouts_ = text_readouts;
+    params.format_ = StatsFormat::Prometheus;
+    params.histogram_buckets_mode_ = histogram_buckets_mode;
+    return std::make_unique<PrometheusStatsRequest>(store_, params, custom_namespaces_,
+                                                    endpoints_helper_.cm_);
+  }
+
+  // Executes a request, counting the chunks that were generated.
+  uint32_t iterateChunks(PrometheusStatsRequest& request) {
+    Http::TestResponseHeaderMapImpl response_headers;
+    Http::Code code = request.start(response_headers);
+    EXPECT_EQ(Http::Code::OK, code);
+    Buffer::OwnedImpl data;
+    uint32_t num_chunks = 0;
+    bool more = true;
+    do {
+      more = request.nextChunk(data);
+      uint64_t size = data.length();
+      if (size > 0) {
+        ++num_chunks;
+        data.drain(size);
+      }
+    } while (more);
+    return num_chunks;
+  }
+
+  // Executes a request, returning the rendered buffer as a string.
+  std::string response(PrometheusStatsRequest& request) {
+    Http::TestResponseHeaderMapImpl response_headers;
+    Http::Code code = request.start(response_headers);
+    EXPECT_EQ(Http::Code::OK, code);
+    Buffer::OwnedImpl data;
+    while (request.nextChunk(data)) {
+    }
+    return data.toString();
+  }
+
+  Stats::StatName makeStatName(absl::string_view name) { return pool_.add(name); }
+
+  Stats::SymbolTableImpl symbol_table_;
+  Stats::StatNamePool pool_;
+  Stats::AllocatorImpl alloc_;
+  NiceMock<Stats::MockSink> sink_;
+  NiceMock<Event::MockDispatcher> main_thread_dispatcher_;
+  NiceMock<ThreadLocal::MockInstance> tls_;
+  Stats::ThreadLocalStoreImpl store_;
+  Stats::CustomStatNamespacesImpl custom_namespaces_;
+  Upstream::PerEndpointMetricsTestHelper endpoints_helper_;
+};
+
+TEST_F(PrometheusStatsRequestTest, Empty) { EXPECT_EQ(0, iterateChunks(*makeRequest())); }
+
+TEST_F(PrometheusStatsRequestTest, OneCounter) {
+  store_.rootScope()->counterFromStatName(makeStatName("foo"));
+  std::unique_ptr<PrometheusStatsRequest> request = makeRequest();
+  EXPECT_EQ("# TYPE envoy_foo counter\nenvoy_foo{} 0\n", response(*request));
+}
+
+TEST_F(PrometheusStatsRequestTest, OneCounterUsedOnly) {
+  store_.rootScope()->counterFromStatName(makeStatName("foo"));
+  EXPECT_EQ(0, iterateChunks(*makeRequest(true)));
+}
+
+// All series of a metric family must be emitted contiguously under a single
+// TYPE annotation, even when they come from different scopes.
+TEST_F(PrometheusStatsRequestTest, FamilySpansScopes) {
+  Stats::ScopeSharedPtr scope1 = store_.createScope("a");
+  Stats::ScopeSharedPtr scope2 = store_.createScope("a");
+  Stats::StatNameTagVector c1_tags{{makeStatName("cluster"), makeStatName("c1")}};
+  Stats::StatNameTagVector c2_tags{{makeStatName("cluster"), makeStatName("c2")}};
+  scope1->counterFromStatNameWithTags(makeStatName("foo"), c1_tags);
+  scope2->counterFromStatNameWithTags(makeStatName("foo"), c2_tags);
+  std::unique_ptr<PrometheusStatsRequest> request = makeRequest();
+  EXPECT_EQ("# TYPE envoy_a_foo counter\n"
+            "envoy_a_foo{cluster=\"c1\"} 0\n"
+            "envoy_a_foo{cluster=\"c2\"} 0\n",
+            response(*request));
+}
+
+// A stat that is reachable through more than one scope must be emitted once.
+TEST_F(PrometheusStatsRequestTest, DeDupsOverlappingScopes) {
+  Stats::ScopeSharedPtr scope1 = store_.createScope("a");
+  Stats::ScopeSharedPtr scope2 = store_.createScope("a");
+  scope1->counterFromStatName(makeStatName("foo"));
+  scope2->counterFromStatName(makeStatName("foo"));
+  std::unique_ptr<PrometheusStatsRequest> request = makeRequest();
+  EXPECT_EQ("# TYPE envoy_a_foo counter\nenvoy_a_foo{} 0\n", response(*request));
+}
+
+TEST_F(PrometheusStatsRequestTest, TextReadoutsOptIn) {
+  store_.rootScope()->textReadoutFromStatName(makeStatName("foo"));
+  std::unique_ptr<PrometheusStatsRequest> request = makeRequest();
+  EXPECT_THAT(response(*request), Not(HasSubstr("envoy_foo")));
+  request = makeRequest(false, true);
+  EXPECT_EQ("# TYPE envoy_foo gauge\nenvoy_foo{text_value=\"\"} 0\n", response(*request));
+}
+
+TEST_F(PrometheusStatsRequestTest, OneHistogram) {
+  store_.rootScope()->histogramFromStatName(makeStatName("foo"),
+                                            Stats::Histogram::Unit::Milliseconds);
+  std::unique_ptr<PrometheusStatsRequest> request = makeRequest();
+  EXPECT_THAT(response(*request), StartsWith("# TYPE envoy_foo histogram\n"));
+}
+
+TEST_F(PrometheusStatsRequestTest, OneHistogramSummary) {
+  store_.rootScope()->histogramFromStatName(makeStatName("foo"),
+                                            Stats::Histogram::Unit::Milliseconds);
+  std::unique_ptr<PrometheusStatsRequest> request =
+      makeRequest(false, false, Utility::HistogramBucketsMode::Summary);
+  EXPECT_THAT(response(*request), StartsWith("# TYPE envoy_foo summary\n"));
+}
+
+TEST_F(PrometheusStatsRequestTest, OneHostCounter) {
+  auto& cluster = endpoints_helper_.makeCluster("mycluster", 0);
+  endpoints_helper_.addHostSingleCounter(cluster);
+  std::unique_ptr<PrometheusStatsRequest> request = makeRequest();
+  EXPECT_THAT(response(*request), HasSubstr("# TYPE envoy_cluster_endpoint_c1 counter\n"));
+}
+
+TEST_F(PrometheusStatsRequestTest, ManyStatsSmallChunkSize) {
+  for (uint32_t i = 0; i < 100; ++i) {
+    store_.rootScope()->counterFromStatName(makeStatName(absl::StrCat("foo", i)));
+  }
+  std::unique_ptr<PrometheusStatsRequest> request = makeRequest();
+  request->setChunkSize(100);
+  EXPECT_EQ(34, iterateChunks(*request));
+}
+
+} // namespace Server
+} // namespace Envoy
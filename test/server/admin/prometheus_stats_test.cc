@@ -193,6 +193,15 @@ TEST_F(PrometheusStatsFormatterTest, FormattedTags) {
   EXPECT_EQ(expected, actual);
 }
 
+TEST_F(PrometheusStatsFormatterTest, FormattedTagsNoCollisionAcrossNameValueBoundary) {
+  // Tag pairs whose concatenated name+value bytes are identical must render
+  // distinctly; this guards the keying of the memoized tag fragments.
+  std::vector<Stats::Tag> tags1{{"ab", "c"}};
+  std::vector<Stats::Tag> tags2{{"a", "bc"}};
+  EXPECT_EQ("ab=\"c\"", PrometheusStatsFormatter::formattedTags(tags1));
+  EXPECT_EQ("a=\"bc\"", PrometheusStatsFormatter::formattedTags(tags2));
+}
+
 TEST_F(PrometheusStatsFormatterTest, MetricNameCollison) {
   Stats::CustomStatNamespacesImpl custom_namespaces;
 
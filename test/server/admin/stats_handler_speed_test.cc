@@ -77,8 +77,7 @@ public:
     return host_stats_.counters();
   }
 
-  std::vector<std::pair<absl::string_view, Stats::PrimitiveGaugeReference>>
-  gauges() const override {
+  std::vector<std::pair<absl::string_view, uint64_t>> gauges() const override {
     return host_stats_.gauges();
   }
 
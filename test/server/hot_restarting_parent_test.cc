@@ -1,5 +1,6 @@
 #include <memory>
 
+#include "source/common/common/fmt.h"
 #include "source/common/network/address_impl.h"
 #include "source/server/hot_restarting_child.h"
 #include "source/server/hot_restarting_parent.h"
@@ -342,6 +343,39 @@ TEST_F(HotRestartingParentTest, UdpPacketIsForwarded) {
   hot_restarting_parent_.handle(worker_index, packet);
 }
 
+// Round trip a stats export through the shared memory region: the parent replaces the inline
+// payload with a reference to the region, and the child recovers the payload from it.
+TEST_F(HotRestartingParentTest, StatsSharedMemoryRoundTrip) {
+  HotRestartMessage::Reply::Stats stats;
+  stats.set_memory_allocated(123);
+  stats.set_num_connections(4);
+  (*stats.mutable_counter_deltas())["c1"] = 7;
+  (*stats.mutable_gauges())["g1"] = 9;
+
+  const std::string shmem_name = fmt::format("/envoy_stats_shared_memory_test_{}", getpid());
+  HotRestartingParent::publishStatsToSharedMemory(stats, shmem_name);
+  EXPECT_EQ(shmem_name, stats.shared_memory_name());
+  EXPECT_GT(stats.shared_memory_size(), 0);
+  EXPECT_TRUE(stats.counter_deltas().empty());
+  EXPECT_TRUE(stats.gauges().empty());
+
+  HotRestartingChild::readStatsFromSharedMemory(stats);
+  EXPECT_TRUE(stats.shared_memory_name().empty());
+  EXPECT_EQ(123, stats.memory_allocated());
+  EXPECT_EQ(4, stats.num_connections());
+  EXPECT_EQ(7, stats.counter_deltas().at("c1"));
+  EXPECT_EQ(9, stats.gauges().at("g1"));
+}
+
+// A reply with inline stats (e.g. from a parent that predates shared memory stats export) passes
+// through the child's shared memory handling untouched.
+TEST_F(HotRestartingParentTest, InlineStatsPassThrough) {
+  HotRestartMessage::Reply::Stats stats;
+  (*stats.mutable_counter_deltas())["c1"] = 7;
+  HotRestartingChild::readStatsFromSharedMemory(stats);
+  EXPECT_EQ(7, stats.counter_deltas().at("c1"));
+}
+
 } // namespace
 } // namespace Server
 } // namespace Envoy
@@ -160,6 +160,86 @@ TEST(ServerInstanceUtil, flushImportModeUninitializedGauges) {
   InstanceUtil::flushMetricsToSinks(sinks, store, cm, time_system);
 }
 
+// A mock sink that opts into delta flushes.
+class MockDeltaSink : public Stats::MockSink {
+public:
+  Stats::Sink::FlushMode flushMode() const override { return Stats::Sink::FlushMode::Delta; }
+};
+
+TEST(ServerInstanceUtil, deltaFlushHelper) {
+  InSequence s;
+
+  NiceMock<Upstream::MockClusterManager> cm;
+  Stats::TestUtil::TestStore store;
+  Event::SimulatedTimeSystem time_system;
+  Stats::Counter& c = store.counter("hello");
+  Stats::Gauge& g = store.gauge("world", Stats::Gauge::ImportMode::Accumulate);
+  c.inc();
+  g.set(5);
+  store.textReadout("text").set("is important");
+
+  std::list<Stats::SinkPtr> sinks;
+  MockDeltaSink* delta_sink = new StrictMock<MockDeltaSink>();
+  sinks.emplace_back(delta_sink);
+  Stats::MockSink* full_sink = new StrictMock<Stats::MockSink>();
+  sinks.emplace_back(full_sink);
+  DeltaFlushState state;
+
+  // The first flush is always delivered in full, even to delta sinks.
+  EXPECT_CALL(*delta_sink, flush(_)).WillOnce(Invoke([](Stats::MetricSnapshot& snapshot) {
+    EXPECT_EQ(snapshot.counters().size(), 1);
+    EXPECT_EQ(snapshot.gauges().size(), 1);
+    EXPECT_EQ(snapshot.textReadouts().size(), 1);
+  }));
+  EXPECT_CALL(*full_sink, flush(_));
+  InstanceUtil::flushMetricsToSinks(sinks, store, cm, time_system, &state);
+
+  // Nothing changed, so the delta sink sees an empty snapshot while the full sink still sees
+  // everything.
+  EXPECT_CALL(*delta_sink, flush(_)).WillOnce(Invoke([](Stats::MetricSnapshot& snapshot) {
+    EXPECT_TRUE(snapshot.counters().empty());
+    EXPECT_TRUE(snapshot.gauges().empty());
+    EXPECT_TRUE(snapshot.textReadouts().empty());
+  }));
+  EXPECT_CALL(*full_sink, flush(_)).WillOnce(Invoke([](Stats::MetricSnapshot& snapshot) {
+    EXPECT_EQ(snapshot.counters().size(), 1);
+    EXPECT_EQ(snapshot.gauges().size(), 1);
+    EXPECT_EQ(snapshot.textReadouts().size(), 1);
+  }));
+  InstanceUtil::flushMetricsToSinks(sinks, store, cm, time_system, &state);
+
+  // Only the metrics that changed since the previous flush are delivered to the delta sink.
+  c.inc();
+  g.set(6);
+  EXPECT_CALL(*delta_sink, flush(_)).WillOnce(Invoke([](Stats::MetricSnapshot& snapshot) {
+    ASSERT_EQ(snapshot.counters().size(), 1);
+    EXPECT_EQ(snapshot.counters()[0].counter_.get().name(), "hello");
+    EXPECT_EQ(snapshot.counters()[0].delta_, 1);
+    ASSERT_EQ(snapshot.gauges().size(), 1);
+    EXPECT_EQ(snapshot.gauges()[0].get().value(), 6);
+    EXPECT_TRUE(snapshot.textReadouts().empty());
+  }));
+  EXPECT_CALL(*full_sink, flush(_));
+  InstanceUtil::flushMetricsToSinks(sinks, store, cm, time_system, &state);
+
+  // Flushes 4 through 10 deliver empty deltas; flush 11 is the periodic full sync.
+  for (int flush = 4; flush <= 10; ++flush) {
+    EXPECT_CALL(*delta_sink, flush(_)).WillOnce(Invoke([](Stats::MetricSnapshot& snapshot) {
+      EXPECT_TRUE(snapshot.counters().empty());
+      EXPECT_TRUE(snapshot.gauges().empty());
+    }));
+    EXPECT_CALL(*full_sink, flush(_));
+    InstanceUtil::flushMetricsToSinks(sinks, store, cm, time_system, &state);
+  }
+  EXPECT_CALL(*delta_sink, flush(_)).WillOnce(Invoke([](Stats::MetricSnapshot& snapshot) {
+    EXPECT_EQ(snapshot.counters().size(), 1);
+    EXPECT_EQ(snapshot.gauges().size(), 1);
+    EXPECT_EQ(snapshot.textReadouts().size(), 1);
+  }));
+  EXPECT_CALL(*full_sink, flush(_));
+  InstanceUtil::flushMetricsToSinks(sinks, store, cm, time_system, &state);
+}
+
 class RunHelperTest : public testing::Test {
 public:
   RunHelperTest() {
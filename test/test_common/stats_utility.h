@@ -66,9 +66,8 @@ public:
             Return(std::vector<std::pair<absl::string_view, Stats::PrimitiveCounterReference>>{
                 {"c1", c1}, {"c2", c2}}));
     ON_CALL(*host, gauges())
-        .WillByDefault(
-            Return(std::vector<std::pair<absl::string_view, Stats::PrimitiveGaugeReference>>{
-                {"g1", g1}, {"g2", g2}}));
+        .WillByDefault(Return(std::vector<std::pair<absl::string_view, uint64_t>>{
+            {"g1", g1.value()}, {"g2", g2.value()}}));
     host_set->hosts_.push_back(host);
     return *host;
   }
@@ -92,8 +91,7 @@ public:
             Return(std::vector<std::pair<absl::string_view, Stats::PrimitiveCounterReference>>{
                 {"c1", c1}}));
     ON_CALL(*host, gauges())
-        .WillByDefault(
-            Return(std::vector<std::pair<absl::string_view, Stats::PrimitiveGaugeReference>>{}));
+        .WillByDefault(Return(std::vector<std::pair<absl::string_view, uint64_t>>{}));
     host_set->hosts_.push_back(host);
     return *host;
   }
@@ -117,7 +115,7 @@ public:
             Return(std::vector<std::pair<absl::string_view, Stats::PrimitiveCounterReference>>{}));
     ON_CALL(*host, gauges())
         .WillByDefault(Return(
-            std::vector<std::pair<absl::string_view, Stats::PrimitiveGaugeReference>>{{"g1", g1}}));
+            std::vector<std::pair<absl::string_view, uint64_t>>{{"g1", g1.value()}}));
     host_set->hosts_.push_back(host);
     return *host;
   }
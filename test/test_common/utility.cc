@@ -424,12 +424,12 @@ bool TestUtility::gaugesZeroed(const std::vector<Stats::GaugeSharedPtr>& gauges)
 
 // static
 bool TestUtility::gaugesZeroed(
-    const std::vector<std::pair<absl::string_view, Stats::PrimitiveGaugeReference>>& gauges) {
+    const std::vector<std::pair<absl::string_view, uint64_t>>& gauges) {
   // Returns true if all gauges are 0 except the circuit_breaker remaining resource
   // gauges which default to the resource max.
   std::regex omitted(".*circuit_breakers\\..*\\.remaining.*");
   for (const auto& gauge : gauges) {
-    if (!std::regex_match(std::string(gauge.first), omitted) && gauge.second.get().value() != 0) {
+    if (!std::regex_match(std::string(gauge.first), omitted) && gauge.second != 0) {
       return false;
     }
   }